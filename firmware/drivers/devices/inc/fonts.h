@@ -22,6 +22,8 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 05/04/2024 | Document creation		                         						|
+ * | 18/10/2026 | Run-length encoded fonts (tools/font_rle.py)							|
+ * | 18/10/2026 | Anti-aliased 2 and 4 bpp fonts (tools/font_aa.py)						|
  * 
  **/
 
@@ -30,6 +32,16 @@
 /*==================[macros]=================================================*/
 
 /*==================[typedef]================================================*/
+/**
+ * @brief Encoding of glyph data
+ */
+typedef enum {
+	FONT_1BPP = 0,		/*!< 1 bit per pixel, rows padded to bytes, MSB first */
+	FONT_RLE,			/*!< Runs of background and foreground pixels packed in nibbles, see tools/font_rle.py */
+	FONT_2BPP,			/*!< 2 bits of coverage per pixel, rows padded to bytes, first pixel in the MSB, see tools/font_aa.py */
+	FONT_4BPP,			/*!< 4 bits of coverage per pixel, rows padded to bytes, first pixel in the MSB, see tools/font_aa.py */
+} font_encoding_t;
+
 /**
  * @brief Character information
  */
@@ -44,6 +56,7 @@ typedef struct{
 	uint8_t 		font_height;   	/*!< Font height in pixels */
 	char_info_t 	*info;			/*!< Character info array */
 	const uint8_t 	*data; 			/*!< Font array */
+	uint8_t			encoding;		/*!< Encoding of font array (font_encoding_t), FONT_1BPP if not set */
 } Font_t;
 
 /*==================[external data declaration]==============================*/
@@ -57,6 +57,32 @@
 #include <stdint.h>
 #include "stdbool.h"
 
+#define BEAT_FIR_HISTORY 22  // samples of history of the 23 tap low pass filter
+#define BEAT_BLOCK_SIZE 32   // samples filtered at once by checkForBeatBlock()
+
+//  State of one beat detector, one for each stream (IR, Red, several sensors)
+typedef struct
+{
+  int16_t IR_AC_Max;
+  int16_t IR_AC_Min;
+  int16_t IR_AC_Signal_Current;
+  int16_t IR_AC_Signal_Previous;
+  int16_t IR_AC_Signal_min;
+  int16_t IR_AC_Signal_max;
+  int16_t IR_Average_Estimated;
+  int16_t positiveEdge;
+  int16_t negativeEdge;
+  int32_t ir_avg_reg;
+  int16_t cbuf[32];
+  uint8_t offset;
+} beat_detector_t;
+
+void beatDetectorInit(beat_detector_t *det);
+bool checkForBeatDetector(beat_detector_t *det, int32_t sample);
+uint16_t checkForBeatBlock(beat_detector_t *det, const int32_t *samples, uint16_t len, uint16_t *beats, uint16_t max_beats);
+void lowPassFIRFilterBlock(const int16_t *din, int16_t *dout, uint16_t len);
+
+//  Single stream functions, state in a global detector
 bool checkForBeat(int32_t sample);
 int16_t averageDCEstimator(int32_t *p, uint16_t x);
 int16_t lowPassFIRFilter(int16_t din);
@@ -20,11 +20,13 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 05/04/2024 | Document creation		                         						|
+ * | 18/10/2026 | Run-length encoded icons (tools/font_rle.py)							|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdint.h>
+#include "fonts.h"
 /*==================[macros]=================================================*/
 
 /*==================[typedef]================================================*/
@@ -106,6 +108,8 @@ typedef struct{
 	uint8_t 		width;			/*!< Icon width in pixels */
 	uint16_t 		offset;			/*!< Offset between icons in data array */
 	const uint8_t 	*data; 			/*!< Icon data array */
+	uint8_t			encoding;		/*!< Encoding of data array (font_encoding_t), FONT_1BPP if not set */
+	const uint32_t	*offsets;		/*!< Position of each icon in data array, used instead of offset if not NULL */
 } icon_font_t;
 
 /*==================[external data declaration]==============================*/
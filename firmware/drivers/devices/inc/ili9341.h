@@ -12,6 +12,18 @@
  * TFT color display connected to the ESP-EDU. It uses a SPI port and 3 GPIOs to 
  * communicate with the ILI9341 LCD driver chip.
  *
+ * @note Drawing functions queue their SPI transfers and return while the data is sent 
+ * by DMA, so the next drawing is prepared at the same time. Use ILI9341Flush to wait 
+ * until everything drawn has reached the LCD.
+ *
+ * @note A region of the LCD can be drawn in a RAM framebuffer (ili9341_framebuffer_t). 
+ * While it is selected, drawing functions inside it only change the RAM and keep track 
+ * of the changed areas, that ILI9341FramebufferFlush sends to the LCD.
+ *
+ * @note Fonts and icons can be 1 bpp, run-length encoded or anti-aliased (font_encoding_t). 
+ * Anti-aliased glyphs are blended with the background color given when they are drawn, 
+ * not with the pixels already on the LCD.
+ *
  * @author Albano Peñalva
  *
  * @note Hardware connections:
@@ -33,6 +45,15 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 18/01/2024 | Document creation		                         |
+ * | 18/10/2026 | Persistent SPI device, batched transfers        |
+ * | 18/10/2026 | DMA queued transfers, ILI9341Flush             |
+ * | 18/10/2026 | Framebuffer with dirty areas                   |
+ * | 18/10/2026 | Lines, circles and triangles drawn by spans    |
+ * | 18/10/2026 | Strings in one area, glyph cache               |
+ * | 18/10/2026 | Integers drawn over are drawn whole again      |
+ * | 18/10/2026 | Run-length encoded and anti-aliased glyphs     |
+ * | 18/10/2026 | Hardware vertical scrolling                    |
+ * | 18/10/2026 | Count of the bytes sent, ILI9341BytesSent      |
  *
  */
 
@@ -46,6 +67,7 @@
 #define ILI9341_WIDTH       240			/*!< LCD width in pixels */
 #define ILI9341_HEIGHT      320			/*!< LCD height in pixels */
 #define ILI9341_PIXEL_MAX	76800
+#define ILI9341_DIRTY_MAX	8			/*!< Maximum number of dirty areas of a framebuffer */
 /* 16bits colors (RGB565) */			/*	 R,   G,   B */
 #define ILI9341_BLACK          	0x0000  /*   0,   0,   0 */
 #define ILI9341_NAVY           	0x000F 	/*   0,   0, 128 */
@@ -80,6 +102,30 @@ typedef enum ili9341_orientation {
 	ILI9341_Landscape_1, 	/*!< Landscape orientation mode 1 */
 	ILI9341_Landscape_2  	/*!< Landscape orientation mode 2 */
 } ili9341_orientation_t;
+
+/**
+ * @brief  Rectangular area of the LCD
+ */
+typedef struct {
+	uint16_t x0;			/*!< Start column */
+	uint16_t y0;			/*!< Start row */
+	uint16_t x1;			/*!< End column */
+	uint16_t y1;			/*!< End row */
+} ili9341_rect_t;
+
+/**
+ * @brief  RAM framebuffer of a region of the LCD
+ */
+typedef struct {
+	uint16_t x;				/*!< X position of top left corner */
+	uint16_t y;				/*!< Y position of top left corner */
+	uint16_t width;			/*!< Width in pixels */
+	uint16_t height;		/*!< Height in pixels */
+	uint16_t *pixels;		/*!< Buffer of width * height pixels */
+	uint16_t back_color;	/*!< Initial color (RGB565) */
+	ili9341_rect_t dirty[ILI9341_DIRTY_MAX];	/*!< Areas changed since the last flush */
+	uint8_t n_dirty;		/*!< Number of dirty areas */
+} ili9341_framebuffer_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -92,6 +138,55 @@ typedef enum ili9341_orientation {
  */
 uint8_t ILI9341Init(spi_dev_t spi_dev, uint8_t gpio_dc, uint8_t gpio_rst);
 
+/**
+ * @brief  		Waits until all the drawing operations have been sent to the LCD
+ * @retval 		None
+ */
+void ILI9341Flush(void);
+
+/**
+ * @brief  		Number of bytes sent to the LCD since ILI9341Init, commands included
+ * @note		Bytes are counted when they are queued. The difference between two calls is
+ * 				the SPI traffic of the drawing made between them.
+ * @retval 		Number of bytes, it wraps around at 2^32
+ */
+uint32_t ILI9341BytesSent(void);
+
+/**
+ * @brief  		Initializes a framebuffer with its background color
+ * @note		x, y, width, height, pixels and back_color must be set. The whole region is
+ * 				sent to the LCD by the first flush.
+ * @param[in]  	fb: Framebuffer
+ * @retval 		None
+ */
+void ILI9341FramebufferInit(ili9341_framebuffer_t * fb);
+
+/**
+ * @brief  		Selects the framebuffer where drawing functions render
+ * @note		Drawing inside the framebuffer is rendered in RAM. Drawing partly inside it is
+ * 				rendered in RAM and on the LCD. Drawing outside it goes to the LCD.
+ * @param[in]  	fb: Framebuffer, NULL to draw on the LCD
+ * @retval 		None
+ */
+void ILI9341FramebufferSelect(ili9341_framebuffer_t * fb);
+
+/**
+ * @brief  		Sends the dirty areas of the selected framebuffer to the LCD
+ * @retval 		None
+ */
+void ILI9341FramebufferFlush(void);
+
+/**
+ * @brief  		Sets a RAM buffer to keep glyphs expanded to RGB565
+ * @note		Glyphs drawn are kept with their colors and copied, instead of expanded, when they
+ * 				are drawn again. When the glyphs of a string do not fit, the cache starts again.
+ * 				A font_89 digit takes about 3600 pixels.
+ * @param[in]  	pixels: Buffer, NULL to disable the cache
+ * @param[in]  	size: Number of pixels of the buffer
+ * @retval 		None
+ */
+void ILI9341GlyphCacheInit(uint16_t * pixels, uint32_t size);
+
 /**
  * @brief  		Draws single pixel to LCD
  * @param[in]  	x: X position for pixel
@@ -115,6 +210,28 @@ void ILI9341Fill(uint16_t color);
  */
 void ILI9341Rotate(ili9341_orientation_t orientation);
 
+/**
+ * @brief  		Defines the area of the LCD moved by ILI9341Scroll
+ * @note		The LCD scrolls along its 320 pixels side: the area is a band of rows from the left
+ * 				to the right side in portrait orientations, and a band of columns from the top to
+ * 				the bottom in landscape orientations. The rest of the LCD stays fixed.
+ * 				ILI9341Rotate stops scrolling.
+ * @param[in]	start: First row (portrait) or column (landscape) of the area
+ * @param[in]	length: Number of rows or columns of the area, 0 to stop scrolling
+ * @retval 		None
+ */
+void ILI9341ScrollArea(uint16_t start, uint16_t length);
+
+/**
+ * @brief  		Scrolls the area defined by ILI9341ScrollArea without sending any pixel
+ * @note		Drawing is not affected by the scroll: it uses the coordinates the pixels have
+ * 				when the offset is 0. The row or column drawn at start + offset is shown at start,
+ * 				and the ones before it are shown at the end of the area.
+ * @param[in]	offset: Rows or columns the content is moved up (portrait) or left (landscape)
+ * @retval 		None
+ */
+void ILI9341Scroll(uint16_t offset);
+
 /**
  * @brief  		Draw a single character on the LCD
  * @param[in]  	x: X position of top left corner
@@ -141,6 +258,10 @@ void ILI9341DrawIcon(uint16_t x, uint16_t y, icon_t icon, icon_font_t* icon_font
 
 /**
  * @brief  		Draw an integer on the LCD
+ * @note		Digits equal to the ones of the last integer drawn at the same position, with the
+ * 				same font and colors, are not drawn again. They are drawn whole again after something
+ * 				is drawn over them, the framebuffer holding them is initialized, the LCD is filled,
+ * 				rotated or scrolled, or ILI9341DrawIntInvalidate is called.
  * @param[in]  	x: X position of top left corner
  * @param[in]  	y: Y position of top left corner
  * @param[in] 	num: Number to be displayed
@@ -152,8 +273,17 @@ void ILI9341DrawIcon(uint16_t x, uint16_t y, icon_t icon, icon_font_t* icon_font
  */
 void ILI9341DrawInt(uint16_t x, uint16_t y, uint32_t num, uint8_t dig, Font_t* font, uint16_t foreground, uint16_t background);
 
+/**
+ * @brief  		Forget the integers drawn by ILI9341DrawInt, the next ones are drawn whole
+ * @note		Needed only when the LCD is changed out of this driver, for example after a reset
+ * @retval		None
+ */
+void ILI9341DrawIntInvalidate(void);
+
 /**
  * @brief  		Draw a string on the LCD
+ * @note		Each line of the string is drawn in a single area, including the column of
+ * 				background between characters, when it fits in the LCD width.
  * @param[in] 	x: X position of top left corner of first character in string
  * @param[in]  	y: Y position of top left corner of first character in string
  * @param[in]  	str: Pointer to first character
@@ -176,6 +306,7 @@ void ILI9341GetStringSize(char* str, Font_t* font, uint16_t* width, uint16_t* he
 
 /**
  * @brief  		Draws line on the LCD
+ * @note		Pixels of the line in the same row or column are sent in a single area
  * @param[in]  	x0: X coordinate of starting point
  * @param[in]  	y0: Y coordinate of starting point
  * @param[in]  	x1: X coordinate of ending point
@@ -209,6 +340,7 @@ void ILI9341DrawFilledRectangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t
 
 /**
  * @brief  		Draws circle on the LCD
+ * @note		The circle could be partly out of the LCD
  * @param[in]  	x0: X coordinate of center circle point
  * @param[in]  	y0: Y coordinate of center circle point
  * @param[in]  	r: Circle radius
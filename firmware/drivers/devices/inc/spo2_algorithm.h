@@ -80,9 +80,44 @@
 
 //uch_spo2_table is approximated as  -45.060*ratioAverage* ratioAverage + 30.354 *ratioAverage + 94.845 ;
 
-static  int32_t an_x[ BUFFER_SIZE]; //ir
-static  int32_t an_y[ BUFFER_SIZE]; //red
+#define STREAM_RING_SIZE 16   // power of 2, > STREAM_DELAY
+#define STREAM_MIN_DISTANCE 4 // same as maxim_find_peaks() in the batch algorithm
+#define STREAM_MAX_FLAT 4     // longest flat valley, samples
+#define STREAM_DELAY (STREAM_MIN_DISTANCE + STREAM_MAX_FLAT + 5) // raw samples are measured after the valleys are final
+#define STREAM_MAX_VALLEYS 15
+#define STREAM_MAX_RATIOS 5
 
+/**
+* Streaming heart rate/SpO2 calculation
+*
+* Same processing as maxim_heart_rate_and_oxygen_saturation() over the last BUFFER_SIZE samples, updated
+* with constant work for each sample: DC by exponential average, 4 pt moving average in a ring, valleys
+* tracked as the samples arrive and AC/DC maxima measured between valleys with STREAM_DELAY samples delay.
+* The result is available at any sample with maxim_spo2_stream_result().
+*/
+typedef struct {
+  int32_t n_count;                              // number of samples
+  uint32_t aun_ir[STREAM_RING_SIZE];            // last raw samples
+  uint32_t aun_red[STREAM_RING_SIZE];
+  int32_t n_ir_dc;                              // DC of ir, x32
+  int32_t an_ma4[MA4_SIZE];                     // last inverted ir samples
+  int32_t n_ma4_sum;
+  int32_t n_th1;                                // mean of the moving average, x32
+  int32_t n_ma4_prev;
+  int32_t n_cand_loc, n_cand_val, n_cand_width; // rising edge of a valley, -1 if none
+  int32_t n_pend_loc, n_pend_val;               // last valley, may be replaced by a deeper one, -1 if none
+  int32_t an_valley_locs[STREAM_MAX_VALLEYS];   // valleys in the last BUFFER_SIZE samples
+  int32_t n_valley_first, n_valley_count;
+  int32_t an_meas_locs[STREAM_MAX_VALLEYS];     // valleys not measured yet
+  int32_t n_meas_first, n_meas_count;
+  int32_t n_seg_loc;                            // first valley of the measured period, -1 if none
+  uint32_t un_seg_ir, un_seg_red;               // raw values at the valley
+  int32_t n_x_dc_max, n_x_dc_max_idx;
+  int32_t n_y_dc_max, n_y_dc_max_idx, n_x_at_y_max;
+  int32_t an_ratio[STREAM_MAX_RATIOS];          // last ratios and their valleys
+  int32_t an_ratio_locs[STREAM_MAX_RATIOS];
+  int32_t n_ratio_pos, n_ratio_count;
+} maxim_spo2_stream_t;
 
 void maxim_heart_rate_and_oxygen_saturation(uint32_t *pun_ir_buffer, int32_t n_ir_buffer_length, uint32_t *pun_red_buffer, int32_t *pn_spo2, int8_t *pch_spo2_valid, int32_t *pn_heart_rate, int8_t *pch_hr_valid);
 
@@ -90,8 +125,11 @@ void maxim_heart_rate_and_oxygen_saturation(uint32_t *pun_ir_buffer, int32_t n_i
 void maxim_find_peaks(int32_t *pn_locs, int32_t *n_npks,  int32_t  *pn_x, int32_t n_size, int32_t n_min_height, int32_t n_min_distance, int32_t n_max_num);
 void maxim_peaks_above_min_height(int32_t *pn_locs, int32_t *n_npks,  int32_t  *pn_x, int32_t n_size, int32_t n_min_height);
 void maxim_remove_close_peaks(int32_t *pn_locs, int32_t *pn_npks, int32_t *pn_x, int32_t n_min_distance);
-void maxim_sort_ascend(int32_t  *pn_x, int32_t n_size);
-void maxim_sort_indices_descend(int32_t  *pn_x, int32_t *pn_indx, int32_t n_size);
+int32_t maxim_ratio_median(int32_t *pn_x, int32_t n_size);
+
+void maxim_spo2_stream_init(maxim_spo2_stream_t *ps_stream);
+void maxim_spo2_stream_add(maxim_spo2_stream_t *ps_stream, uint32_t un_ir, uint32_t un_red);
+void maxim_spo2_stream_result(maxim_spo2_stream_t *ps_stream, int32_t *pn_spo2, int8_t *pch_spo2_valid, int32_t *pn_heart_rate, int8_t *pch_hr_valid);
 
 
 #endif /* MODULES_INC_SPO2_ALGORITHM_H_ */
@@ -53,55 +53,45 @@
 
 #include "heartRate.h"
 
-int16_t IR_AC_Max = 20;
-int16_t IR_AC_Min = -20;
-
-int16_t IR_AC_Signal_Current = 0;
-int16_t IR_AC_Signal_Previous;
-int16_t IR_AC_Signal_min = 0;
-int16_t IR_AC_Signal_max = 0;
-int16_t IR_Average_Estimated;
-
-int16_t positiveEdge = 0;
-int16_t negativeEdge = 0;
-int32_t ir_avg_reg = 0;
-
-int16_t cbuf[32];
-uint8_t offset = 0;
+//  Detector of checkForBeat()
+static beat_detector_t detector = {.IR_AC_Max = 20, .IR_AC_Min = -20};
 
 static const uint16_t FIRCoeffs[12] = {172, 321, 579, 927, 1360, 1858, 2390, 2916, 3391, 3768, 4012, 4096};
 
-//  Heart Rate Monitor functions takes a sample value and the sample number
-//  Returns true if a beat is detected
-//  A running average of four samples is recommended for display on the screen.
-bool checkForBeat(int32_t sample)
+//  Initialize the state of a detector
+void beatDetectorInit(beat_detector_t *det)
+{
+  uint8_t *p = (uint8_t *)det;
+  for (uint16_t i = 0 ; i < sizeof(beat_detector_t) ; i++)
+  {
+    p[i] = 0;
+  }
+  det->IR_AC_Max = 20;
+  det->IR_AC_Min = -20;
+}
+
+//  Beat detection on the filtered AC signal
+static bool beatEdge(beat_detector_t *det, int16_t current)
 {
   bool beatDetected = false;
 
   //  Save current state
-  IR_AC_Signal_Previous = IR_AC_Signal_Current;
-
-  //This is good to view for debugging
-  //Serial.print("Signal_Current: ");
-  //Serial.println(IR_AC_Signal_Current);
-
-  //  Process next data sample
-  IR_Average_Estimated = averageDCEstimator(&ir_avg_reg, sample);
-  IR_AC_Signal_Current = lowPassFIRFilter(sample - IR_Average_Estimated);
+  det->IR_AC_Signal_Previous = det->IR_AC_Signal_Current;
+  det->IR_AC_Signal_Current = current;
 
   //  Detect positive zero crossing (rising edge)
-  if ((IR_AC_Signal_Previous < 0) & (IR_AC_Signal_Current >= 0))
+  if ((det->IR_AC_Signal_Previous < 0) & (det->IR_AC_Signal_Current >= 0))
   {
 
-    IR_AC_Max = IR_AC_Signal_max; //Adjust our AC max and min
-    IR_AC_Min = IR_AC_Signal_min;
+    det->IR_AC_Max = det->IR_AC_Signal_max; //Adjust our AC max and min
+    det->IR_AC_Min = det->IR_AC_Signal_min;
 
-    positiveEdge = 1;
-    negativeEdge = 0;
-    IR_AC_Signal_max = 0;
+    det->positiveEdge = 1;
+    det->negativeEdge = 0;
+    det->IR_AC_Signal_max = 0;
 
     //if ((IR_AC_Max - IR_AC_Min) > 100 & (IR_AC_Max - IR_AC_Min) < 1000)
-    if (((IR_AC_Max - IR_AC_Min) > 20) & ((IR_AC_Max - IR_AC_Min) < 1000))
+    if (((det->IR_AC_Max - det->IR_AC_Min) > 20) & ((det->IR_AC_Max - det->IR_AC_Min) < 1000))
     {
       //Heart beat!!!
       beatDetected = true;
@@ -109,28 +99,105 @@ bool checkForBeat(int32_t sample)
   }
 
   //  Detect negative zero crossing (falling edge)
-  if ((IR_AC_Signal_Previous > 0) & (IR_AC_Signal_Current <= 0))
+  if ((det->IR_AC_Signal_Previous > 0) & (det->IR_AC_Signal_Current <= 0))
   {
-    positiveEdge = 0;
-    negativeEdge = 1;
-    IR_AC_Signal_min = 0;
+    det->positiveEdge = 0;
+    det->negativeEdge = 1;
+    det->IR_AC_Signal_min = 0;
   }
 
   //  Find Maximum value in positive cycle
-  if (positiveEdge & (IR_AC_Signal_Current > IR_AC_Signal_Previous))
+  if (det->positiveEdge & (det->IR_AC_Signal_Current > det->IR_AC_Signal_Previous))
   {
-    IR_AC_Signal_max = IR_AC_Signal_Current;
+    det->IR_AC_Signal_max = det->IR_AC_Signal_Current;
   }
 
   //  Find Minimum value in negative cycle
-  if (negativeEdge & (IR_AC_Signal_Current < IR_AC_Signal_Previous))
+  if (det->negativeEdge & (det->IR_AC_Signal_Current < det->IR_AC_Signal_Previous))
   {
-    IR_AC_Signal_min = IR_AC_Signal_Current;
+    det->IR_AC_Signal_min = det->IR_AC_Signal_Current;
   }
 
   return(beatDetected);
 }
 
+//  Low Pass FIR Filter of a detector
+static int16_t beatFIRFilter(beat_detector_t *det, int16_t din)
+{
+  det->cbuf[det->offset] = din;
+
+  int32_t z = mul16(FIRCoeffs[11], det->cbuf[(det->offset - 11) & 0x1F]);
+
+  for (uint8_t i = 0 ; i < 11 ; i++)
+  {
+    z += mul16(FIRCoeffs[i], det->cbuf[(det->offset - i) & 0x1F] + det->cbuf[(det->offset - 22 + i) & 0x1F]);
+  }
+
+  det->offset++;
+  det->offset %= 32; //Wrap condition
+
+  return(z >> 15);
+}
+
+//  Heart Rate Monitor functions takes a sample value and the sample number
+//  Returns true if a beat is detected
+//  A running average of four samples is recommended for display on the screen.
+bool checkForBeatDetector(beat_detector_t *det, int32_t sample)
+{
+  //  Process next data sample
+  det->IR_Average_Estimated = averageDCEstimator(&det->ir_avg_reg, sample);
+  return(beatEdge(det, beatFIRFilter(det, sample - det->IR_Average_Estimated)));
+}
+
+//  Same as checkForBeatDetector() for a block of samples, the low pass filter runs on
+//  BEAT_BLOCK_SIZE samples at once without the circular buffer.
+//  Indexes of the samples with a beat are written to beats, returns number of beats.
+uint16_t checkForBeatBlock(beat_detector_t *det, const int32_t *samples, uint16_t len, uint16_t *beats, uint16_t max_beats)
+{
+  int16_t x[BEAT_FIR_HISTORY + BEAT_BLOCK_SIZE];
+  int16_t y[BEAT_BLOCK_SIZE];
+  uint16_t count = 0;
+
+  for (uint16_t start = 0 ; start < len ; start += BEAT_BLOCK_SIZE)
+  {
+    uint16_t n = (len - start < BEAT_BLOCK_SIZE) ? (len - start) : BEAT_BLOCK_SIZE;
+
+    //  History from the circular buffer, then the AC signal of the block
+    for (uint8_t i = 0 ; i < BEAT_FIR_HISTORY ; i++)
+    {
+      x[i] = det->cbuf[(det->offset - BEAT_FIR_HISTORY + i) & 0x1F];
+    }
+    for (uint16_t i = 0 ; i < n ; i++)
+    {
+      det->IR_Average_Estimated = averageDCEstimator(&det->ir_avg_reg, samples[start + i]);
+      x[BEAT_FIR_HISTORY + i] = samples[start + i] - det->IR_Average_Estimated;
+    }
+
+    lowPassFIRFilterBlock(x, y, n);
+
+    for (uint16_t i = 0 ; i < n ; i++)
+    {
+      if (beatEdge(det, y[i]) & (count < max_beats))
+      {
+        beats[count++] = start + i;
+      }
+    }
+
+    //  Last samples back to the circular buffer, so both functions could be mixed
+    for (uint8_t i = 0 ; i < BEAT_FIR_HISTORY ; i++)
+    {
+      det->cbuf[(det->offset + n - BEAT_FIR_HISTORY + i) & 0x1F] = x[n + i];
+    }
+    det->offset = (det->offset + n) & 0x1F;
+  }
+  return(count);
+}
+
+bool checkForBeat(int32_t sample)
+{
+  return(checkForBeatDetector(&detector, sample));
+}
+
 //  Average DC Estimator
 int16_t averageDCEstimator(int32_t *p, uint16_t x)
 {
@@ -141,19 +208,42 @@ int16_t averageDCEstimator(int32_t *p, uint16_t x)
 //  Low Pass FIR Filter
 int16_t lowPassFIRFilter(int16_t din)
 {
-  cbuf[offset] = din;
+  return(beatFIRFilter(&detector, din));
+}
 
-  int32_t z = mul16(FIRCoeffs[11], cbuf[(offset - 11) & 0x1F]);
+//  Low Pass FIR Filter of a block: din holds BEAT_FIR_HISTORY samples of history followed by
+//  len new samples, dout gets len filtered samples.
+//  Symmetric filter, 12 multiplications per sample, two outputs per iteration share the loads.
+void lowPassFIRFilterBlock(const int16_t *din, int16_t *dout, uint16_t len)
+{
+  uint16_t n = 0;
 
-  for (uint8_t i = 0 ; i < 11 ; i++)
+  for ( ; n + 1 < len ; n += 2)
   {
-    z += mul16(FIRCoeffs[i], cbuf[(offset - i) & 0x1F] + cbuf[(offset - 22 + i) & 0x1F]);
+    const int16_t *x = &din[n];
+    int32_t z0 = mul16(FIRCoeffs[11], x[11]);
+    int32_t z1 = mul16(FIRCoeffs[11], x[12]);
+
+    for (uint8_t i = 0 ; i < 11 ; i++)
+    {
+      z0 += mul16(FIRCoeffs[i], x[22 - i] + x[i]);
+      z1 += mul16(FIRCoeffs[i], x[23 - i] + x[i + 1]);
+    }
+    dout[n] = z0 >> 15;
+    dout[n + 1] = z1 >> 15;
   }
 
-  offset++;
-  offset %= 32; //Wrap condition
+  if (n < len)
+  {
+    const int16_t *x = &din[n];
+    int32_t z = mul16(FIRCoeffs[11], x[11]);
 
-  return(z >> 15);
+    for (uint8_t i = 0 ; i < 11 ; i++)
+    {
+      z += mul16(FIRCoeffs[i], x[22 - i] + x[i]);
+    }
+    dout[n] = z >> 15;
+  }
 }
 
 //  Integer multiplier
@@ -15,6 +15,7 @@
 #include "spi_mcu.h"
 #include "gpio_mcu.h"
 #include "delay_mcu.h"
+#include "esp_attr.h"
 /*==================[macros and definitions]=================================*/
 #define NULL 0
 
@@ -23,6 +24,15 @@
 #define MSK_BIT16 0x8000			/*!< 16th bit mask */
 #define MSK_BIT8 0x80				/*!< 8th bit mask */
 #define MAX_VALUE_SIZE 256			/*!< Maximum length of a data array to prevent excessive use of memory */
+#define LCD_BUFFER_SIZE 2048		/*!< Length of the pixel buffers of data bursts */
+#define LCD_BUFFERS 2				/*!< Number of pixel buffers, one is filled while the other one is sent */
+#define LCD_BATCH_MAX 4				/*!< Maximum number of commands sent in one batch */
+#define LCD_WINDOW_COST 16			/*!< Pixels sent in the time of an area setup, dirty areas closer than this are merged */
+#define LCD_TEXT_MAX 64				/*!< Maximum number of characters of a line of text drawn in one area */
+#define LCD_GLYPH_CACHE_MAX 16		/*!< Maximum number of glyphs in the glyph cache */
+#define LCD_INT_MAX 4				/*!< Number of integers drawn whose digits are remembered */
+#define LCD_CMD ((void*)0)			/*!< DC level of commands, passed to the SPI transaction start callback */
+#define LCD_DATA ((void*)1)			/*!< DC level of parameters and data, passed to the SPI transaction start callback */
 #define LEFT -1						/*!< Horizontal grow direction */
 #define RIGHT 1						/*!< Horizontal grow direction */
 #define DOWN 1						/*!< Vertical grow direction */
@@ -32,6 +42,7 @@
 #define RESET				0x01 	/*!< Resets the commands and parameters to their S/W Reset default values */
 #define SLEEP_IN			0x10 	/*!< Enter to the minimum power consumption mode */
 #define SLEEP_OUT			0x11 	/*!< Turns off sleep mode */
+#define NORMAL_MODE_ON		0x13 	/*!< Returns to normal mode from partial or vertical scroll mode */
 #define DISPLAY_INV_OFF		0x20 	/*!< Recover from display inversion mode */
 #define DISPLAY_INV_ON		0x21 	/*!< Invert every bit from the frame memory to the display */
 #define GAMMA_SET			0x26 	/*!< Select the desired Gamma curve for the current display */
@@ -40,6 +51,8 @@
 #define COLUMN_ADDR_SET		0x2A 	/*!< Define columns of frame memory where MCU can access */
 #define PAGE_ADDR_SET		0x2B 	/*!< Define rows of frame memory where MCU can access */
 #define MEM_WRITE			0x2C 	/*!< Transfer data from MCU to frame memory */
+#define VERT_SCROLL_DEF		0x33 	/*!< Defines the top fixed, vertical scrolling and bottom fixed areas */
+#define VERT_SCROLL_ADDR	0x37 	/*!< Line of frame memory shown at the top of the vertical scrolling area */
 #define MEM_ACC_CTRL		0x36 	/*!< Defines read/write scanning direction of frame memory */
 #define PIXEL_FORMAT_SET	0x3A 	/*!< Sets the pixel format for the RGB image data used by the interface */
 #define WRITE_DISP_BRIGHT	0x51 	/*!< Adjust the brightness value of the display */
@@ -82,26 +95,128 @@ typedef struct {
     uint32_t databytes; 	/*!< Number of bytes of data to transmit */
     uint8_t *data;			/*!< Pointer to data or parameters array */
 } lcd_cmd_t;
+
+/**
+ * @brief Glyph expanded to RGB565 in the glyph cache
+ */
+typedef struct {
+	const Font_t *font;		/*!< Font of the glyph */
+	char data;				/*!< Character */
+	uint16_t foreground;	/*!< Character color */
+	uint16_t background;	/*!< Background color */
+	uint16_t *pixels;		/*!< Pixels, high byte first, in the glyph cache buffer */
+} glyph_cache_t;
+
+/**
+ * @brief Position in the data of a glyph being drawn, row by row
+ */
+typedef struct {
+	const uint8_t *data;	/*!< Next byte of glyph data */
+	uint8_t encoding;		/*!< Encoding of glyph data (font_encoding_t) */
+	bool low;				/*!< Next nibble is the low one of the byte, FONT_RLE */
+	uint8_t color;			/*!< Color of the current run, FONT_RLE */
+	uint16_t run;			/*!< Pixels left of the current run, FONT_RLE */
+} glyph_reader_t;
+
+/**
+ * @brief Integer drawn by ILI9341DrawInt
+ */
+typedef struct {
+	uint16_t x;				/*!< X position */
+	uint16_t y;				/*!< Y position */
+	const Font_t *font;		/*!< Font */
+	uint16_t foreground;	/*!< Character color */
+	uint16_t background;	/*!< Background color */
+	uint8_t dig;			/*!< Number of digits, 0 if the entry is not used */
+	uint32_t num;			/*!< Number drawn */
+	uint16_t x1;			/*!< Last column the digits can take */
+	uint16_t y1;			/*!< Last row the digits take */
+} int_drawn_t;
 /*==================[internal data declaration]==============================*/
 
 /*==================[internal functions declaration]=========================*/
 
 /**
- * @brief  		Send command and parameters/data to LCD
+ * @brief  		Drives DC pin before each SPI transfer
+ * @note		Called by the SPI driver in interrupt context, it and GPIOState are in IRAM
+ * @param[in]  	param: LCD_CMD or LCD_DATA
+ * @retval 		None
+ */
+static void IRAM_ATTR DcCallback(void * param);
+
+/**
+ * @brief  		Get the next pixel buffer to fill with a data burst
+ * @note		Waits until the LCD received the previous burst from the buffer
+ * @retval 		Pointer to a buffer of LCD_BUFFER_SIZE bytes
+ */
+static uint8_t * NextBuffer(void);
+
+/**
+ * @brief  		Queue commands and parameters/data to LCD in a single SPI batch
+ * @param[in]  	data: Array of structures with the commands and parameters/data to send
+ * @param[in]  	count: Number of commands (up to LCD_BATCH_MAX)
+ * @retval 		None
+ */
+static void WriteLCDBatch(lcd_cmd_t * data, uint8_t count);
+
+/**
+ * @brief  		Queue command and parameters/data to LCD
+ * @note		Parameters or data longer than 4 bytes must be in the last buffer given by NextBuffer or
+ * 				in constant memory, they are sent by DMA after this function returns
  * @param[in]  	data: Structure with the command and parameters/data to send
  * @retval 		None
  */
-void WriteLCD(lcd_cmd_t * data);
+static void WriteLCD(lcd_cmd_t * data);
 
 /**
- * @brief  		Define an area of frame memory where MCU can access
+ * @brief  		Write pixels to the framebuffer at the position of the area being written
+ * @param[in]  	data: Pixels (RGB565, high byte first)
+ * @param[in]  	databytes: Number of bytes of data
+ * @retval 		None
+ */
+static void FramebufferWrite(const uint8_t * data, uint32_t databytes);
+
+/**
+ * @brief  		Add an area to the dirty areas of a framebuffer
+ * @note		Areas are merged when the union costs less than sending them apart, or when there
+ * 				is no room for a new one
+ * @param[in]  	fb: Framebuffer
+ * @param[in]  	area: Changed area
+ * @retval 		None
+ */
+static void FramebufferDirty(ili9341_framebuffer_t * fb, ili9341_rect_t area);
+
+/**
+ * @brief  		Write pixels to the area being written, on the LCD and/or the framebuffer
+ * @param[in]  	data: Pixels, from the last buffer given by NextBuffer
+ * @param[in]  	databytes: Number of bytes of data
+ * @retval 		None
+ */
+static void WritePixels(uint8_t * data, uint32_t databytes);
+
+/**
+ * @brief  		Define an area of frame memory where MCU can access and start writing it
+ * @note		Column and row addresses are only sent when they change from the previous area.
+ * 				When the area is inside the selected framebuffer it is only written to RAM.
  * @param[in]  	x1: Start column
  * @param[in]  	y1: Start row
  * @param[in]  	x2: End column
  * @param[in]  	y2: End row
+ * @param[in]  	data: First pixels to write, NULL to send only the memory write command
+ * @param[in]  	databytes: Number of bytes of data
+ * @retval 		None
+ */
+static void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t * data, uint32_t databytes);
+
+/**
+ * @brief  		Forget the integers drawn by ILI9341DrawInt that overlap an area drawn over them
+ * @param[in]  	x0: Start column
+ * @param[in]  	y0: Start row
+ * @param[in]  	x1: End column
+ * @param[in]  	y1: End row
  * @retval 		None
  */
-void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+static void IntDrawnErase(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
 
 /**
  * @brief  		Fill an srea of LCD with a determined color
@@ -112,7 +227,119 @@ void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
  * @param[in]	color: color
  * @retval 		None
  */
-void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
+static void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
+
+/**
+ * @brief  		Fill a horizontal or vertical span of pixels in a single window, clipped to the LCD
+ * @param[in]  	x0: Start column, could be out of the LCD
+ * @param[in]  	y0: Start row, could be out of the LCD
+ * @param[in]  	x1: End column, could be out of the LCD
+ * @param[in]  	y1: End row, could be out of the LCD
+ * @param[in]	color: color
+ * @retval 		None
+ */
+static void FillSpan(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+/**
+ * @brief  		Set the colors of the text lookup tables
+ * @param[in]	foreground: Color of set bits
+ * @param[in]	background: Color of clear bits
+ * @retval 		None
+ */
+static void TextColors(uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Compute the blend tables of anti-aliased glyphs
+ * @note		Tables are only computed again when the colors or the bits per pixel change
+ * @param[in]	foreground: Color of full coverage
+ * @param[in]	background: Color of no coverage
+ * @param[in]	encoding: FONT_2BPP or FONT_4BPP, other encodings do not use blend tables
+ * @retval 		None
+ */
+static void TextBlend(uint16_t foreground, uint16_t background, uint8_t encoding);
+
+/**
+ * @brief  		Expand a row of a 1 bpp bitmap to RGB565 with the text lookup tables
+ * @note		Pixels are written 2 at a time (32 bits) from the first 32 bits aligned one
+ * @param[in]  	bits: Row of the bitmap, MSB first
+ * @param[in]  	width: Number of pixels of the row
+ * @param[out] 	dst: Pixels
+ * @retval 		None
+ */
+static void ExpandRow(const uint8_t * bits, uint16_t width, uint16_t * dst);
+
+/**
+ * @brief  		Expand a row of an anti-aliased bitmap to RGB565 with the blend tables
+ * @param[in]  	bits: Row of the bitmap, first pixel in the MSB
+ * @param[in]  	width: Number of pixels of the row
+ * @param[in]	encoding: FONT_2BPP or FONT_4BPP
+ * @param[out] 	dst: Pixels
+ * @retval 		None
+ */
+static void BlendRow(const uint8_t * bits, uint16_t width, uint8_t encoding, uint16_t * dst);
+
+/**
+ * @brief  		Start reading a glyph
+ * @param[out] 	reader: Position in the glyph data
+ * @param[in]  	data: First byte of the glyph
+ * @param[in]  	encoding: Encoding of glyph data (font_encoding_t)
+ * @retval 		None
+ */
+static void GlyphStart(glyph_reader_t * reader, const uint8_t * data, uint8_t encoding);
+
+/**
+ * @brief  		Read the next nibble of a run-length encoded glyph
+ * @param[in]  	reader: Position in the glyph data
+ * @retval 		Nibble
+ */
+static uint8_t GlyphNibble(glyph_reader_t * reader);
+
+/**
+ * @brief  		Expand the next row of a glyph to RGB565 with the text lookup tables
+ * @param[in]  	reader: Position in the glyph data
+ * @param[in]  	width: Number of pixels of the row
+ * @param[out] 	dst: Pixels
+ * @retval 		None
+ */
+static void GlyphRow(glyph_reader_t * reader, uint16_t width, uint16_t * dst);
+
+/**
+ * @brief  		Copy a row of pixels
+ * @param[in]  	src: Pixels to copy
+ * @param[in]  	width: Number of pixels of the row
+ * @param[out] 	dst: Pixels
+ * @retval 		None
+ */
+static void CopyRow(const uint16_t * src, uint16_t width, uint16_t * dst);
+
+/**
+ * @brief  		Find a glyph in the glyph cache, for the colors of the text lookup tables
+ * @param[in]  	font: Font
+ * @param[in]  	data: Character
+ * @retval 		Pointer to the pixels of the glyph, NULL if it is not in the cache
+ */
+static const uint16_t * GlyphFind(const Font_t * font, char data);
+
+/**
+ * @brief  		Expand a glyph into the glyph cache, for the colors of the text lookup tables
+ * @param[in]  	font: Font
+ * @param[in]  	data: Character
+ * @retval 		Pointer to the pixels of the glyph, NULL if there is no room for it
+ */
+static const uint16_t * GlyphExpand(const Font_t * font, char data);
+
+/**
+ * @brief  		Draw a line of text in a single area, with a 1 pixel background column between characters
+ * @param[in]  	x: X position of top left corner
+ * @param[in]  	y: Y position of top left corner
+ * @param[in]  	str: Characters, '\r' are skipped
+ * @param[in]  	len: Number of characters (up to LCD_TEXT_MAX)
+ * @param[in]  	font: Font
+ * @param[in]  	foreground: Color for characters (RGB565)
+ * @param[in]  	background: Color for background (RGB565)
+ * @retval 		None
+ */
+static void DrawText(uint16_t x, uint16_t y, const char * str, uint8_t len, Font_t * font, uint16_t foreground, uint16_t background);
 
 /*==================[internal data definition]===============================*/
 /**
@@ -180,10 +407,39 @@ spi_mcu_config_t spi_conf = {
 	.bitrate = SPI_BR, 
 	.transfer_mode = SPI_POLLING, 
 	.func_p = NULL,
-	.param_p = NULL };
+	.param_p = NULL,
+	.pre_func_p = DcCallback };
 
 static spi_dev_t ili9341_spi;				/*!< uC SPI port */
 static gpio_t ili9341_dc, ili9341_rst;		/*!< uC GPIO ports to use as CS, DC and RST */
+static DMA_ATTR uint8_t lcd_buffers[LCD_BUFFERS][LCD_BUFFER_SIZE];	/*!< Pixel buffers of data bursts */
+static uint32_t lcd_buffer_transfer[LCD_BUFFERS];	/*!< Last SPI transfer queued while each buffer was in use */
+static uint8_t lcd_buffer_act = 0;					/*!< Buffer in use */
+static uint16_t lcd_area[4];				/*!< Last area sent: start column, end column, start row, end row */
+static bool lcd_area_valid = false;			/*!< Column and row addresses were sent */
+static uint32_t lcd_bytes = 0;				/*!< Bytes queued for the LCD since ILI9341Init, commands included */
+static ili9341_framebuffer_t * lcd_fb = NULL;	/*!< Framebuffer where drawing is rendered, NULL to draw on LCD */
+static uint16_t fb_area[4];					/*!< Area being written: start column, end column, start row, end row */
+static uint16_t fb_x, fb_y;					/*!< Next pixel of the area being written */
+static bool fb_write = false;				/*!< Area being written intersects the framebuffer */
+static bool lcd_write = true;				/*!< Area being written is sent to the LCD */
+static uint16_t text_lut16[2];				/*!< Background and foreground pixels, as they are sent */
+static uint32_t text_lut32[4];				/*!< Pairs of background and foreground pixels, as they are sent */
+static uint16_t text_blend16[16];			/*!< Colors of each coverage level of anti-aliased glyphs, as they are sent */
+static uint32_t text_blend32[16];			/*!< Pairs of colors of 2 bpp coverage levels, as they are sent */
+static uint16_t text_blend_fg, text_blend_bg;	/*!< Colors (RGB565) of the blend tables */
+static uint8_t text_blend_encoding = FONT_1BPP;	/*!< Encoding the blend tables were computed for, FONT_1BPP if none */
+static const uint16_t * text_glyphs[LCD_TEXT_MAX];	/*!< Cached glyphs of the line of text being drawn */
+static uint16_t * glyph_buffer = NULL;		/*!< Buffer of the glyph cache, NULL if there is no cache */
+static uint32_t glyph_buffer_size, glyph_buffer_used;	/*!< Pixels of the glyph cache buffer, total and used */
+static glyph_cache_t glyph_cache[LCD_GLYPH_CACHE_MAX];	/*!< Glyphs in the cache */
+static uint8_t glyph_cached = 0;			/*!< Number of glyphs in the cache */
+static int_drawn_t int_drawn[LCD_INT_MAX];	/*!< Last integers drawn */
+static uint16_t scroll_top = 0;				/*!< First line of the frame memory in the scrolling area */
+static uint16_t scroll_length = 0;			/*!< Lines of the scrolling area, 0 if the LCD is not scrolling */
+static bool scroll_reversed = false;		/*!< Lines of the frame memory go against the coordinates of the orientation */
+static uint8_t int_next = 0;				/*!< Next entry of int_drawn to replace */
+static bool int_drawing = false;			/*!< ILI9341DrawInt or a framebuffer flush is drawing, its areas do not erase int_drawn */
 
 static orientation_properties_t lcd_orientation = {
 		ILI9341_WIDTH,
@@ -193,24 +449,127 @@ static orientation_properties_t lcd_orientation = {
 
 /*==================[internal functions definition]==========================*/
 
-void WriteLCD(lcd_cmd_t * data){
-	SpiInit(&spi_conf);
-	/* If command is NULL don't send command */
-	if (data->cmd != NULL){
-		/* Send command */
-		GPIOOff(ili9341_dc);
-		SpiWrite(ili9341_spi, &data->cmd, 1);
+static void IRAM_ATTR DcCallback(void * param){
+	GPIOState(ili9341_dc, param != LCD_CMD);
+}
+
+static uint8_t * NextBuffer(void){
+	lcd_buffer_act = (lcd_buffer_act + 1) % LCD_BUFFERS;
+	/* Wait until the LCD received the previous burst from this buffer */
+	SpiWaitWrite(ili9341_spi, lcd_buffer_transfer[lcd_buffer_act]);
+	return lcd_buffers[lcd_buffer_act];
+}
+
+static void WriteLCDBatch(lcd_cmd_t * data, uint8_t count){
+	spi_mcu_transfer_t transfers[2 * LCD_BATCH_MAX];
+	uint8_t n = 0;
+	for (uint8_t i = 0; i < count; i++){
+		/* If command is NULL don't send command */
+		if (data[i].cmd != NULL){
+			transfers[n].tx_buffer = &data[i].cmd;
+			transfers[n].size = 1;
+			transfers[n].param_p = LCD_CMD;
+			lcd_bytes++;
+			n++;
+		}
+		/* If there are parameters or data to send */
+		if (data[i].databytes != NULL){
+			transfers[n].tx_buffer = data[i].data;
+			transfers[n].size = data[i].databytes;
+			transfers[n].param_p = LCD_DATA;
+			lcd_bytes += data[i].databytes;
+			n++;
+		}
+	}
+	/* DC pin is driven by DcCallback at the start of each transfer. Transfers are
+	sent by DMA while the next burst is filled in the other buffer */
+	lcd_buffer_transfer[lcd_buffer_act] = SpiQueueWrite(ili9341_spi, transfers, n);
+}
+
+static void WriteLCD(lcd_cmd_t * data){
+	WriteLCDBatch(data, 1);
+}
+
+static void FramebufferWrite(const uint8_t * data, uint32_t databytes){
+	uint8_t * pixels = (uint8_t *)lcd_fb->pixels;
+	uint32_t n = databytes / 2;
+	uint32_t run, i;
+	int32_t start, end;
+	while (n > 0){
+		/* Pixels left in the current row of the area */
+		run = fb_area[1] - fb_x + 1;
+		if (run > n){
+			run = n;
+		}
+		/* Part of the row inside the framebuffer */
+		if (fb_y >= lcd_fb->y && fb_y < lcd_fb->y + lcd_fb->height){
+			start = fb_x > lcd_fb->x ? fb_x : lcd_fb->x;
+			end = fb_x + run < lcd_fb->x + lcd_fb->width ? fb_x + run : lcd_fb->x + lcd_fb->width;
+			uint8_t * dst = &pixels[2 * ((fb_y - lcd_fb->y) * lcd_fb->width + start - lcd_fb->x)];
+			const uint8_t * src = &data[2 * (start - fb_x)];
+			for (i = 0; (int32_t)i < 2 * (end - start); i++){
+				dst[i] = src[i];
+			}
+		}
+		data += 2 * run;
+		n -= run;
+		fb_x += run;
+		/* Next row, the area wraps around as in the LCD */
+		if (fb_x > fb_area[1]){
+			fb_x = fb_area[0];
+			fb_y = fb_y < fb_area[3] ? fb_y + 1 : fb_area[2];
+		}
 	}
-	/* If there are parameters or data to send */
-	if (data->databytes != NULL){
-		/* Send parameters or data */
-		GPIOOn(ili9341_dc);
-		SpiWrite(ili9341_spi, data->data, data->databytes);
+}
+
+static void FramebufferDirty(ili9341_framebuffer_t * fb, ili9341_rect_t area){
+	static ili9341_rect_t u;
+	int32_t extra, best_extra;
+	int8_t i, best;
+	while (1){
+		best = -1;
+		best_extra = INT32_MAX;
+		for (i = 0; i < fb->n_dirty; i++){
+			u.x0 = area.x0 < fb->dirty[i].x0 ? area.x0 : fb->dirty[i].x0;
+			u.y0 = area.y0 < fb->dirty[i].y0 ? area.y0 : fb->dirty[i].y0;
+			u.x1 = area.x1 > fb->dirty[i].x1 ? area.x1 : fb->dirty[i].x1;
+			u.y1 = area.y1 > fb->dirty[i].y1 ? area.y1 : fb->dirty[i].y1;
+			/* Pixels sent again by the union, less than 0 if the areas overlap */
+			extra = (int32_t)(u.x1 - u.x0 + 1) * (u.y1 - u.y0 + 1)
+					- (int32_t)(area.x1 - area.x0 + 1) * (area.y1 - area.y0 + 1)
+					- (int32_t)(fb->dirty[i].x1 - fb->dirty[i].x0 + 1) * (fb->dirty[i].y1 - fb->dirty[i].y0 + 1);
+			if (extra < best_extra){
+				best_extra = extra;
+				best = i;
+			}
+		}
+		if (best < 0 || (best_extra > LCD_WINDOW_COST && fb->n_dirty < ILI9341_DIRTY_MAX)){
+			fb->dirty[fb->n_dirty++] = area;
+			return;
+		}
+		/* Merge with the best area and try again with the union */
+		area.x0 = area.x0 < fb->dirty[best].x0 ? area.x0 : fb->dirty[best].x0;
+		area.y0 = area.y0 < fb->dirty[best].y0 ? area.y0 : fb->dirty[best].y0;
+		area.x1 = area.x1 > fb->dirty[best].x1 ? area.x1 : fb->dirty[best].x1;
+		area.y1 = area.y1 > fb->dirty[best].y1 ? area.y1 : fb->dirty[best].y1;
+		fb->dirty[best] = fb->dirty[--fb->n_dirty];
 	}
 }
 
-void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1){
+static void WritePixels(uint8_t * data, uint32_t databytes){
+	if (lcd_write){
+		lcd_cmd_t lcd_pixels = {NULL, databytes, data};
+		WriteLCD(&lcd_pixels);
+	}
+	if (fb_write){
+		FramebufferWrite(data, databytes);
+	}
+}
+
+static void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t * data, uint32_t databytes){
 	static uint16_t aux;
+	lcd_cmd_t lcd_cmds[3];
+	uint8_t n = 0;
 	/* The lower column must be send first */
 	if (x0 > x1){
 		aux = x0;
@@ -223,19 +582,65 @@ void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1){
 		y0 = y1;
 		y1 = aux;
 	}
+	/* Integers drawn over are drawn whole the next time */
+	if (!int_drawing){
+		IntDrawnErase(x0, y0, x1, y1);
+	}
+	/* Areas inside the framebuffer are drawn in RAM, areas partly inside it are drawn on both */
+	fb_write = lcd_fb != NULL && x1 >= lcd_fb->x && x0 < lcd_fb->x + lcd_fb->width
+			&& y1 >= lcd_fb->y && y0 < lcd_fb->y + lcd_fb->height;
+	lcd_write = !fb_write || x0 < lcd_fb->x || x1 >= lcd_fb->x + lcd_fb->width
+			|| y0 < lcd_fb->y || y1 >= lcd_fb->y + lcd_fb->height;
+	if (fb_write){
+		fb_area[0] = x0;
+		fb_area[1] = x1;
+		fb_area[2] = y0;
+		fb_area[3] = y1;
+		fb_x = x0;
+		fb_y = y0;
+		if (!lcd_write){
+			FramebufferDirty(lcd_fb, (ili9341_rect_t){x0, y0, x1, y1});
+		}
+		if (data != NULL){
+			FramebufferWrite(data, databytes);
+		}
+		if (!lcd_write){
+			return;
+		}
+	}
 	uint8_t columns[] = {HighByte(x0), LowByte(x0), HighByte(x1), LowByte(x1)};
-	lcd_cmd_t lcd_columns = {COLUMN_ADDR_SET, 4, columns};
 	uint8_t rows[] = {HighByte(y0), LowByte(y0), HighByte(y1), LowByte(y1)};
-	lcd_cmd_t lcd_rows = {PAGE_ADDR_SET, 4, rows};
-	WriteLCD(&lcd_columns);
-	WriteLCD(&lcd_rows);
+	/* Addresses are kept by the LCD, send only the ones that changed */
+	if (!lcd_area_valid || x0 != lcd_area[0] || x1 != lcd_area[1]){
+		lcd_cmds[n++] = (lcd_cmd_t){COLUMN_ADDR_SET, 4, columns};
+	}
+	if (!lcd_area_valid || y0 != lcd_area[2] || y1 != lcd_area[3]){
+		lcd_cmds[n++] = (lcd_cmd_t){PAGE_ADDR_SET, 4, rows};
+	}
+	lcd_area[0] = x0;
+	lcd_area[1] = x1;
+	lcd_area[2] = y0;
+	lcd_area[3] = y1;
+	lcd_area_valid = true;
+	/* Start writing LCD memory */
+	lcd_cmds[n++] = (lcd_cmd_t){MEM_WRITE, databytes, data};
+	WriteLCDBatch(lcd_cmds, n);
+}
+
+static void IntDrawnErase(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1){
+	for (uint8_t i = 0; i < LCD_INT_MAX; i++){
+		if (int_drawn[i].dig != 0 && x0 <= int_drawn[i].x1 && x1 >= int_drawn[i].x
+				&& y0 <= int_drawn[i].y1 && y1 >= int_drawn[i].y){
+			int_drawn[i].dig = 0;
+		}
+	}
 }
 
-void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
+static void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
 	static uint16_t i;
-	static int32_t bytes_count;
+	static int32_t bytes_count, bytes_burst;
 	static int16_t x_dist, y_dist;
-	static uint8_t pixel[MAX_VALUE_SIZE];
+	static uint8_t *pixel;
 
 	x_dist = x1 - x0;
 	y_dist = y1 - y0;
@@ -247,37 +652,423 @@ void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
 	}
 	/* Number of bytes to write. We have to write 2 bytes/pixel (16bits color) */
 	bytes_count = (x_dist + 1) * (y_dist + 1) * 2;
-	/* Define area to fill */
-	SetCursorPosition(x0, y0, x1, y1);
+	bytes_burst = bytes_count < LCD_BUFFER_SIZE ? bytes_count : LCD_BUFFER_SIZE;
 
-	for (i = 0; i < MAX_VALUE_SIZE; i += 2){
+	pixel = NextBuffer();
+	for (i = 0; i < bytes_burst; i += 2){
 		pixel[i] = HighByte(color);
 		pixel[i + 1] = LowByte(color);
 	}
-	/* Start writing LCD memory */
-	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
-	WriteLCD(&lcd_write);
+	/* Define area to fill and send the first burst */
+	SetCursorPosition(x0, y0, x1, y1, pixel, bytes_burst);
+	bytes_count -= bytes_burst;
+
+	/* The same buffer is sent until the area is filled */
+	while(bytes_count > 0){
+		bytes_burst = bytes_count < LCD_BUFFER_SIZE ? bytes_count : LCD_BUFFER_SIZE;
+		WritePixels(pixel, bytes_burst);
+		bytes_count -= bytes_burst;
+	}
+}
+
+static void FillSpan(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color){
+	static int16_t aux;
+	if (x0 > x1){
+		aux = x0;
+		x0 = x1;
+		x1 = aux;
+	}
+	if (y0 > y1){
+		aux = y0;
+		y0 = y1;
+		y1 = aux;
+	}
+	/* Spans out of the LCD are not drawn, the ones partly out are cut */
+	if (x1 < 0 || y1 < 0 || x0 >= lcd_orientation.width || y0 >= lcd_orientation.height){
+		return;
+	}
+	if (x0 < 0){
+		x0 = 0;
+	}
+	if (y0 < 0){
+		y0 = 0;
+	}
+	if (x1 >= lcd_orientation.width){
+		x1 = lcd_orientation.width - 1;
+	}
+	if (y1 >= lcd_orientation.height){
+		y1 = lcd_orientation.height - 1;
+	}
+	Fill(x0, y0, x1, y1, color);
+}
+
+static void TextColors(uint16_t foreground, uint16_t background){
+	static uint8_t i;
+	uint16_t colors[] = {background, foreground};
+	union {
+		uint8_t bytes[4];
+		uint16_t pixel;
+		uint32_t pair;
+	} lut;
+	/* Bytes are arranged as they are sent, whatever the byte order of the uC */
+	for (i = 0; i < 4; i++){
+		lut.bytes[0] = HighByte(colors[i >> 1]);
+		lut.bytes[1] = LowByte(colors[i >> 1]);
+		lut.bytes[2] = HighByte(colors[i & 1]);
+		lut.bytes[3] = LowByte(colors[i & 1]);
+		text_lut32[i] = lut.pair;
+	}
+	for (i = 0; i < 2; i++){
+		lut.bytes[0] = HighByte(colors[i]);
+		lut.bytes[1] = LowByte(colors[i]);
+		text_lut16[i] = lut.pixel;
+	}
+}
+
+static void TextBlend(uint16_t foreground, uint16_t background, uint8_t encoding){
+	static uint8_t i, levels;
+	static uint16_t color;
+	union {
+		uint8_t bytes[4];
+		uint16_t pixels[2];
+		uint32_t pair;
+	} lut;
+
+	if (encoding != FONT_2BPP && encoding != FONT_4BPP){
+		return;
+	}
+	if (encoding == text_blend_encoding && foreground == text_blend_fg && background == text_blend_bg){
+		return;
+	}
+	text_blend_encoding = encoding;
+	text_blend_fg = foreground;
+	text_blend_bg = background;
+	levels = encoding == FONT_2BPP ? 3 : 15;
+	/* Each channel of RGB565 is blended on its own, rounded to the nearest level */
+	for (i = 0; i <= levels; i++){
+		color = ((((background >> 11) * (levels - i) + (foreground >> 11) * i + levels / 2) / levels) << 11)
+			| (((((background >> 5) & 0x3F) * (levels - i) + ((foreground >> 5) & 0x3F) * i + levels / 2) / levels) << 5)
+			| (((background & 0x1F) * (levels - i) + (foreground & 0x1F) * i + levels / 2) / levels);
+		lut.bytes[0] = HighByte(color);
+		lut.bytes[1] = LowByte(color);
+		text_blend16[i] = lut.pixels[0];
+	}
+	if (encoding == FONT_2BPP){
+		/* A nibble of 2 bpp coverage is a pair of pixels */
+		for (i = 0; i < 16; i++){
+			lut.pixels[0] = text_blend16[i >> 2];
+			lut.pixels[1] = text_blend16[i & 0x03];
+			text_blend32[i] = lut.pair;
+		}
+	}
+}
 
-	while(bytes_count - MAX_VALUE_SIZE > 0){
-		lcd_cmd_t lcd_pixel = {NULL, MAX_VALUE_SIZE, pixel};
-		WriteLCD(&lcd_pixel);
-		bytes_count -= MAX_VALUE_SIZE;
+static void ExpandRow(const uint8_t * bits, uint16_t width, uint16_t * dst){
+	static uint16_t j;
+	static uint8_t shift;
+	uint32_t * dst32;
+
+	j = 0;
+	if (((uintptr_t)dst & 2) && width > 0){
+		/* First pixel alone, the rest of the pairs are not aligned to the bytes of the row */
+		*dst++ = text_lut16[bits[0] >> 7];
+		j = 1;
+	}
+	dst32 = (uint32_t *)dst;
+	if (j == 0){
+		/* Pairs never cross a byte */
+		for (; j + 1 < width; j += 2){
+			*dst32++ = text_lut32[(bits[j >> 3] >> (6 - (j & 7))) & 0x03];
+		}
+	}
+	else{
+		for (; j + 1 < width; j += 2){
+			shift = j & 7;
+			if (shift < 7){
+				*dst32++ = text_lut32[(bits[j >> 3] >> (6 - shift)) & 0x03];
+			}
+			else{
+				*dst32++ = text_lut32[((bits[j >> 3] & 0x01) << 1) | (bits[(j >> 3) + 1] >> 7)];
+			}
+		}
+	}
+	if (j < width){
+		/* Last pixel alone */
+		*(uint16_t *)dst32 = text_lut16[(bits[j >> 3] >> (7 - (j & 7))) & 0x01];
+	}
+}
+
+static void BlendRow(const uint8_t * bits, uint16_t width, uint8_t encoding, uint16_t * dst){
+	static uint16_t j;
+	uint32_t * dst32;
+
+	if (encoding == FONT_4BPP){
+		/* A byte is a pair of pixels */
+		for (j = 0; j + 1 < width; j += 2){
+			*dst++ = text_blend16[bits[j >> 1] >> 4];
+			*dst++ = text_blend16[bits[j >> 1] & 0x0F];
+		}
+		if (j < width){
+			*dst = text_blend16[bits[j >> 1] >> 4];
+		}
+		return;
+	}
+	j = 0;
+	if (((uintptr_t)dst & 2) && width > 0){
+		/* First pixel alone, the rest of the pairs are not aligned to the nibbles of the row */
+		*dst++ = text_blend16[bits[0] >> 6];
+		j = 1;
+	}
+	dst32 = (uint32_t *)dst;
+	if (j == 0){
+		/* Pairs are the nibbles of the row */
+		for (; j + 1 < width; j += 2){
+			*dst32++ = text_blend32[(bits[j >> 2] >> (4 - 2 * (j & 3))) & 0x0F];
+		}
+	}
+	else{
+		for (; j + 1 < width; j += 2){
+			*dst32++ = text_blend32[(((bits[j >> 2] >> (6 - 2 * (j & 3))) & 0x03) << 2)
+				| ((bits[(j + 1) >> 2] >> (6 - 2 * ((j + 1) & 3))) & 0x03)];
+		}
+	}
+	if (j < width){
+		/* Last pixel alone */
+		*(uint16_t *)dst32 = text_blend16[(bits[j >> 2] >> (6 - 2 * (j & 3))) & 0x03];
+	}
+}
+
+static void GlyphStart(glyph_reader_t * reader, const uint8_t * data, uint8_t encoding){
+	reader->data = data;
+	reader->encoding = encoding;
+	reader->low = false;
+	/* First run is background */
+	reader->color = 1;
+	reader->run = 0;
+}
+
+static uint8_t GlyphNibble(glyph_reader_t * reader){
+	static uint8_t nibble;
+	if (reader->low){
+		nibble = *reader->data++ & 0x0F;
+	}
+	else{
+		nibble = *reader->data >> 4;
+	}
+	reader->low = !reader->low;
+	return nibble;
+}
+
+static void GlyphRow(glyph_reader_t * reader, uint16_t width, uint16_t * dst){
+	static uint16_t n;
+	static uint16_t pixel;
+	static uint32_t pair;
+
+	if (reader->encoding == FONT_2BPP || reader->encoding == FONT_4BPP){
+		BlendRow(reader->data, width, reader->encoding, dst);
+		reader->data += reader->encoding == FONT_2BPP ? (width + 3) / 4 : (width + 1) / 2;
+		return;
+	}
+	if (reader->encoding != FONT_RLE){
+		ExpandRow(reader->data, width, dst);
+		reader->data += (width + 7) / 8;
+		return;
+	}
+	while (width > 0){
+		/* Next run, of the other color */
+		while (reader->run == 0){
+			reader->run = GlyphNibble(reader);
+			if (reader->run == 15){
+				reader->run += GlyphNibble(reader) << 4;
+				reader->run += GlyphNibble(reader);
+			}
+			reader->color ^= 1;
+		}
+		n = reader->run < width ? reader->run : width;
+		reader->run -= n;
+		width -= n;
+		/* Runs are filled 2 pixels at a time */
+		pixel = text_lut16[reader->color];
+		pair = text_lut32[reader->color ? 0x03 : 0x00];
+		if (((uintptr_t)dst & 2) && n > 0){
+			*dst++ = pixel;
+			n--;
+		}
+		for (; n >= 2; n -= 2){
+			*(uint32_t *)dst = pair;
+			dst += 2;
+		}
+		if (n > 0){
+			*dst++ = pixel;
+		}
+	}
+}
+
+static void CopyRow(const uint16_t * src, uint16_t width, uint16_t * dst){
+	static uint16_t j;
+	const uint32_t * src32;
+	uint32_t * dst32;
+
+	j = 0;
+	/* Pairs of pixels are copied when both rows have the same alignment */
+	if ((((uintptr_t)src ^ (uintptr_t)dst) & 2) == 0){
+		if (((uintptr_t)dst & 2) && width > 0){
+			*dst++ = *src++;
+			j = 1;
+		}
+		src32 = (const uint32_t *)src;
+		dst32 = (uint32_t *)dst;
+		for (; j + 1 < width; j += 2){
+			*dst32++ = *src32++;
+		}
+		src = (const uint16_t *)src32;
+		dst = (uint16_t *)dst32;
+	}
+	for (; j < width; j++){
+		*dst++ = *src++;
+	}
+}
+
+static const uint16_t * GlyphFind(const Font_t * font, char data){
+	static uint8_t i;
+	glyph_cache_t * glyph;
+
+	for (i = 0; i < glyph_cached; i++){
+		glyph = &glyph_cache[i];
+		if (glyph->font == font && glyph->data == data
+				&& glyph->foreground == text_lut16[1] && glyph->background == text_lut16[0]){
+			return glyph->pixels;
+		}
+	}
+	return NULL;
+}
+
+static const uint16_t * GlyphExpand(const Font_t * font, char data){
+	static uint16_t row, width;
+	static uint32_t size;
+	glyph_cache_t * glyph;
+	glyph_reader_t reader;
+
+	width = font->info[data - ' '].width;
+	/* Glyphs start 32 bits aligned */
+	size = ((uint32_t)width * font->font_height + 1) & ~1;
+	if (glyph_buffer == NULL || glyph_cached == LCD_GLYPH_CACHE_MAX || size > glyph_buffer_size - glyph_buffer_used){
+		return NULL;
+	}
+	glyph = &glyph_cache[glyph_cached++];
+	glyph->font = font;
+	glyph->data = data;
+	glyph->foreground = text_lut16[1];
+	glyph->background = text_lut16[0];
+	glyph->pixels = &glyph_buffer[glyph_buffer_used];
+	glyph_buffer_used += size;
+	GlyphStart(&reader, &font->data[font->info[data - ' '].offset], font->encoding);
+	for (row = 0; row < font->font_height; row++){
+		GlyphRow(&reader, width, &glyph->pixels[row * width]);
+	}
+	return glyph->pixels;
+}
+
+static void DrawText(uint16_t x, uint16_t y, const char * str, uint8_t len, Font_t * font, uint16_t foreground, uint16_t background){
+	static uint8_t c, n, missing;
+	static uint16_t row, rows_burst, width, w;
+	static uint32_t missing_size;
+	static uint16_t *pixel, *dst;
+	static char chars[LCD_TEXT_MAX];
+	static glyph_reader_t readers[LCD_TEXT_MAX];
+
+	/* Characters and width of the area */
+	n = 0;
+	width = 0;
+	for (c = 0; c < len; c++){
+		if (str[c] != '\r'){
+			chars[n++] = str[c];
+			width += font->info[str[c] - ' '].width + 1;
+		}
+	}
+	if (n == 0){
+		return;
+	}
+	width--;
+	/* Text of the same color as the background is just a filled area */
+	if (foreground == background){
+		Fill(x, y, x + width - 1, y + font->font_height - 1, background);
+		return;
+	}
+	TextColors(foreground, background);
+	TextBlend(foreground, background, font->encoding);
+
+	/* Glyphs of the line are kept in the cache at once, it starts again when they do not fit with the others */
+	missing = 0;
+	missing_size = 0;
+	for (c = 0; c < n; c++){
+		text_glyphs[c] = GlyphFind(font, chars[c]);
+		if (text_glyphs[c] == NULL){
+			missing++;
+			missing_size += ((uint32_t)font->info[chars[c] - ' '].width * font->font_height + 1) & ~1;
+		}
+	}
+	if (missing > 0 && missing <= LCD_GLYPH_CACHE_MAX && missing_size <= glyph_buffer_size
+			&& (glyph_cached + missing > LCD_GLYPH_CACHE_MAX || missing_size > glyph_buffer_size - glyph_buffer_used)){
+		glyph_cached = 0;
+		glyph_buffer_used = 0;
+	}
+	for (c = 0; c < n; c++){
+		text_glyphs[c] = GlyphFind(font, chars[c]);
+		if (text_glyphs[c] == NULL){
+			text_glyphs[c] = GlyphExpand(font, chars[c]);
+		}
+		/* Glyphs not in the cache are decoded row by row into the bursts */
+		GlyphStart(&readers[c], &font->data[font->info[chars[c] - ' '].offset], font->encoding);
+	}
+
+	/* Whole rows of the area are written to each burst */
+	rows_burst = LCD_BUFFER_SIZE / (2 * width);
+	for (row = 0; row < font->font_height; row += rows_burst){
+		if (rows_burst > font->font_height - row){
+			rows_burst = font->font_height - row;
+		}
+		pixel = (uint16_t *)NextBuffer();
+		dst = pixel;
+		for (uint16_t r = row; r < row + rows_burst; r++){
+			for (c = 0; c < n; c++){
+				w = font->info[chars[c] - ' '].width;
+				if (text_glyphs[c] != NULL){
+					CopyRow(&text_glyphs[c][r * w], w, dst);
+				}
+				else{
+					GlyphRow(&readers[c], w, dst);
+				}
+				dst += w;
+				/* Space between characters */
+				if (c < n - 1){
+					*dst++ = text_lut16[0];
+				}
+			}
+		}
+		if (row == 0){
+			SetCursorPosition(x, y, x + width - 1, y + font->font_height - 1, (uint8_t *)pixel, 2 * (dst - pixel));
+		}
+		else{
+			WritePixels((uint8_t *)pixel, 2 * (dst - pixel));
+		}
 	}
-	lcd_cmd_t lcd_pixel = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixel);
 }
 
 /*==================[external functions definition]==========================*/
 
 uint8_t ILI9341Init(spi_dev_t spi_dev, uint8_t gpio_dc, uint8_t gpio_rst){
-	/* SPI configuration */
-	spi_conf.device = spi_dev;
-	ili9341_spi = spi_dev;
 	/* GPIOs configuration and initialization */
 	ili9341_dc = gpio_dc;
 	ili9341_rst = gpio_rst;
 	GPIOInit(ili9341_dc, GPIO_OUTPUT);
 	GPIOInit(ili9341_rst, GPIO_OUTPUT);
+	lcd_bytes = 0;
+	/* SPI configuration, the device stays added to the bus */
+	spi_conf.device = spi_dev;
+	ili9341_spi = spi_dev;
+	SpiInit(&spi_conf);
+	lcd_area_valid = false;
 
 	/* RST must be held low for minimum 10µsec after VCC have been applied */
 	DelayUs(10);
@@ -286,6 +1077,7 @@ uint8_t ILI9341Init(spi_dev_t spi_dev, uint8_t gpio_dc, uint8_t gpio_rst){
 	DelayUs(10);
 	/* It will be necessary to wait 5msec before sending new command following software reset */
 	WriteLCD(&lcd_reset);
+	ILI9341Flush();
 	DelayMs(5);
 	/* Send initial configuration to LCD */
 	for (uint8_t i = 0; i < sizeof(lcd_init)/sizeof(lcd_cmd_t); i++){
@@ -293,29 +1085,116 @@ uint8_t ILI9341Init(spi_dev_t spi_dev, uint8_t gpio_dc, uint8_t gpio_rst){
 	}
 	/* It will be necessary to wait 5msec before sending next command after sleep out */
 	WriteLCD(&lcd_sleep_out);
+	ILI9341Flush();
 	DelayMs(10);
 	WriteLCD(&lcd_on);
+	ILI9341Flush();
 	DelayMs(20);
 	/* Start screen on White */
 	ILI9341Fill(ILI9341_WHITE);
+	ILI9341Flush();
 	DelayMs(20);
 	return true;
 }
 
+void ILI9341Flush(void){
+	SpiWaitWrite(ili9341_spi, SPI_QUEUE_LAST);
+}
+
+uint32_t ILI9341BytesSent(void){
+	return lcd_bytes;
+}
+
+void ILI9341FramebufferInit(ili9341_framebuffer_t * fb){
+	uint32_t i;
+	for (i = 0; i < (uint32_t)fb->width * fb->height; i++){
+		/* Pixels are stored with the high byte first, as they are sent */
+		((uint8_t *)fb->pixels)[2 * i] = HighByte(fb->back_color);
+		((uint8_t *)fb->pixels)[2 * i + 1] = LowByte(fb->back_color);
+	}
+	/* Integers drawn in the framebuffer are erased */
+	IntDrawnErase(fb->x, fb->y, fb->x + fb->width - 1, fb->y + fb->height - 1);
+	/* The whole framebuffer is sent by the first flush */
+	fb->dirty[0] = (ili9341_rect_t){fb->x, fb->y, fb->x + fb->width - 1, fb->y + fb->height - 1};
+	fb->n_dirty = 1;
+}
+
+void ILI9341FramebufferSelect(ili9341_framebuffer_t * fb){
+	lcd_fb = fb;
+	fb_write = false;
+	lcd_write = true;
+}
+
+void ILI9341FramebufferFlush(void){
+	static uint8_t i;
+	static uint16_t row, rows_burst, row_bytes;
+	static int32_t bytes_burst;
+	static uint8_t *pixel;
+	ili9341_framebuffer_t * fb = lcd_fb;
+	if (fb == NULL){
+		return;
+	}
+	/* Dirty areas are sent to the LCD, not drawn again in the framebuffer. They
+	hold what was drawn already, integers in them are kept */
+	lcd_fb = NULL;
+	int_drawing = true;
+	for (i = 0; i < fb->n_dirty; i++){
+		ili9341_rect_t * area = &fb->dirty[i];
+		row_bytes = 2 * (area->x1 - area->x0 + 1);
+		/* Whole rows are copied to each burst */
+		rows_burst = LCD_BUFFER_SIZE / row_bytes;
+		for (row = area->y0; row <= area->y1; row += rows_burst){
+			if (rows_burst > area->y1 - row + 1){
+				rows_burst = area->y1 - row + 1;
+			}
+			pixel = NextBuffer();
+			bytes_burst = 0;
+			for (uint16_t r = row; r < row + rows_burst; r++){
+				const uint8_t * src = &((uint8_t *)fb->pixels)[2 * ((r - fb->y) * fb->width + area->x0 - fb->x)];
+				for (uint16_t b = 0; b < row_bytes; b++){
+					pixel[bytes_burst++] = src[b];
+				}
+			}
+			if (row == area->y0){
+				SetCursorPosition(area->x0, area->y0, area->x1, area->y1, pixel, bytes_burst);
+			} else{
+				WritePixels(pixel, bytes_burst);
+			}
+		}
+	}
+	int_drawing = false;
+	fb->n_dirty = 0;
+	lcd_fb = fb;
+}
+
+void ILI9341GlyphCacheInit(uint16_t * pixels, uint32_t size){
+	glyph_buffer = pixels;
+	glyph_buffer_size = pixels == NULL ? 0 : size;
+	/* Glyphs start 32 bits aligned */
+	if (pixels != NULL && ((uintptr_t)pixels & 2)){
+		glyph_buffer++;
+		glyph_buffer_size--;
+	}
+	glyph_buffer_used = 0;
+	glyph_cached = 0;
+}
+
 void ILI9341DrawPixel(uint16_t x, uint16_t y, uint16_t color){
-	/* Define area (pixel) to fill */
-	SetCursorPosition(x, y, x, y);
 	uint8_t pixels[] = {HighByte(color), LowByte(color)};
-	lcd_cmd_t lcd_pixels = {MEM_WRITE, sizeof(pixels), pixels};
-	WriteLCD(&lcd_pixels);
+	/* Define area (pixel) and fill it in a single batch */
+	SetCursorPosition(x, y, x, y, pixels, sizeof(pixels));
 }
 
 void ILI9341Fill(uint16_t color){
+	/* Integers drawn are erased */
+	ILI9341DrawIntInvalidate();
 	Fill(0, 0, lcd_orientation.width, lcd_orientation.height, color);
 }
 
 void ILI9341Rotate(ili9341_orientation_t orientation){
 	uint8_t mem_acc[1];
+	/* Integers drawn are not at the same place anymore */
+	ILI9341DrawIntInvalidate();
 	switch(orientation)	{
 	case ILI9341_Portrait_1:
 		mem_acc[0] = 0x48;		/*!< Row Address Order (MY) = 0, Column Address Order (MX) = 1, Row/Column Exchange (MV) = 0 */
@@ -347,14 +1226,66 @@ void ILI9341Rotate(ili9341_orientation_t orientation){
 	}
 	lcd_cmd_t lcd_mem_acc = {MEM_ACC_CTRL, 1, mem_acc};
 	WriteLCD(&lcd_mem_acc);
+	/* The scrolling area is not at the same place anymore */
+	if (scroll_length > 0){
+		ILI9341ScrollArea(0, 0);
+	}
+}
+
+void ILI9341ScrollArea(uint16_t start, uint16_t length){
+	static uint8_t *params;
+	static uint16_t bottom;
+
+	if (length == 0 || start >= ILI9341_HEIGHT){
+		lcd_cmd_t lcd_normal = {NORMAL_MODE_ON, 0, NULL};
+		WriteLCD(&lcd_normal);
+		scroll_length = 0;
+		return;
+	}
+	if (length > ILI9341_HEIGHT - start){
+		length = ILI9341_HEIGHT - start;
+	}
+	/* Integers drawn could move with the scrolling area */
+	ILI9341DrawIntInvalidate();
+	/* The LCD scrolls the lines of its frame memory, along the 320 pixels side. In
+	Portrait_2 and Landscape_2 they go from the bottom and from the right */
+	scroll_reversed = lcd_orientation.orientation == ILI9341_Portrait_2 || lcd_orientation.orientation == ILI9341_Landscape_2;
+	scroll_top = scroll_reversed ? ILI9341_HEIGHT - start - length : start;
+	scroll_length = length;
+	bottom = ILI9341_HEIGHT - scroll_top - scroll_length;
+	/* Parameters longer than 4 bytes are sent from a burst buffer */
+	params = NextBuffer();
+	params[0] = HighByte(scroll_top);
+	params[1] = LowByte(scroll_top);
+	params[2] = HighByte(scroll_length);
+	params[3] = LowByte(scroll_length);
+	params[4] = HighByte(bottom);
+	params[5] = LowByte(bottom);
+	lcd_cmd_t lcd_scroll_def = {VERT_SCROLL_DEF, 6, params};
+	WriteLCD(&lcd_scroll_def);
+	ILI9341Scroll(0);
+}
+
+void ILI9341Scroll(uint16_t offset){
+	static uint16_t line;
+
+	if (scroll_length == 0){
+		return;
+	}
+	/* Integers drawn could move with the scrolling area */
+	ILI9341DrawIntInvalidate();
+	offset %= scroll_length;
+	if (scroll_reversed){
+		offset = (scroll_length - offset) % scroll_length;
+	}
+	line = scroll_top + offset;
+	uint8_t address[] = {HighByte(line), LowByte(line)};
+	lcd_cmd_t lcd_scroll_addr = {VERT_SCROLL_ADDR, 2, address};
+	WriteLCD(&lcd_scroll_addr);
 }
 
 void ILI9341DrawChar(uint16_t x, uint16_t y, char data, Font_t* font, uint16_t foreground, uint16_t background){
-	static uint32_t i, j, k;
-	static uint32_t char_row;
 	static uint16_t lcd_x, lcd_y;
-	static int32_t bytes_count, bytes_row;
-	static uint8_t pixel[MAX_VALUE_SIZE];
 
 	/* Set coordinates */
 	lcd_x = x;
@@ -365,58 +1296,14 @@ void ILI9341DrawChar(uint16_t x, uint16_t y, char data, Font_t* font, uint16_t f
 		lcd_y += font->font_height;
 		lcd_x = 0;
 	}
-
-	SetCursorPosition(lcd_x, lcd_y, lcd_x + font->info[data - ' '].width - 1, lcd_y + font->font_height - 1);
-
-	/* Number of bytes to write. We have to write 2 bytes/pixel */
-	bytes_count = font->font_height * font->info[data - ' '].width * 2;
-
-	/* Start writing LCD memory */
-	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
-	WriteLCD(&lcd_write);
-
-	/* Draw font data */
-	/* go through character rows */
-	k = 0;
-	for (i = 0; i < font->font_height; i++)	{
-		/* */
-		char_row = font->info[data - ' '].offset + i * ((font->info[data - ' '].width + 7) / 8);
-		/* go through character columns */
-		bytes_row = -1;
-		for (j = 0; j < font->info[data - ' '].width; j++){
-			if(j % 8 == 0){
-				bytes_row++;
-			}
-			/* If exceed buffer size, send buffer */
-			if ((2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE + 1) > MAX_VALUE_SIZE){
-				lcd_cmd_t lcd_pixels = {NULL, MAX_VALUE_SIZE, pixel};
-				WriteLCD(&lcd_pixels);
-				bytes_count -= MAX_VALUE_SIZE;
-				k++;
-			}
-			/* The n=FontWidth first bits of the 16bits row data draws the corresponding part of a character */
-			if (font->data[char_row + bytes_row] & (MSK_BIT8 >> (j % 8))){
-				/* if bit = 1, draw put foreground color */
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE] = HighByte(foreground);
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(foreground);
-			}
-			else{
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE] = HighByte(background);
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(background);
-			}
-		}
-	}
-	/* Send the rest of the buffer */
-	lcd_cmd_t lcd_pixels = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixels);
+	DrawText(lcd_x, lcd_y, &data, 1, font, foreground, background);
 }
 
 void ILI9341DrawIcon(uint16_t x, uint16_t y, icon_t icon, icon_font_t* icon_font, uint16_t foreground, uint16_t background){
-	static uint32_t i, j, k;
-	static uint32_t char_row;
+	static uint16_t row, rows_burst;
 	static uint16_t lcd_x, lcd_y;
-	static int32_t bytes_count, bytes_row;
-	static uint8_t pixel[MAX_VALUE_SIZE];
+	static uint16_t *pixel, *dst;
+	glyph_reader_t reader;
 
 	/* Set coordinates */
 	lcd_x = x;
@@ -427,75 +1314,169 @@ void ILI9341DrawIcon(uint16_t x, uint16_t y, icon_t icon, icon_font_t* icon_font
 		lcd_y += icon_font->height;
 		lcd_x = 0;
 	}
+	TextColors(foreground, background);
+	TextBlend(foreground, background, icon_font->encoding);
+	if (icon_font->offsets != NULL){
+		GlyphStart(&reader, &icon_font->data[icon_font->offsets[icon]], icon_font->encoding);
+	}
+	else{
+		GlyphStart(&reader, &icon_font->data[icon * icon_font->offset], icon_font->encoding);
+	}
 
-	SetCursorPosition(lcd_x, lcd_y, lcd_x + icon_font->width - 1, lcd_y + icon_font->height - 1);
-
-	/* Number of bytes to write. We have to write 2 bytes/pixel */
-	bytes_count = icon_font->height * icon_font->width * 2;
-
-	/* Start writing LCD memory */
-	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
-	WriteLCD(&lcd_write);
-
-	/* Draw font data */
-	/* go through character rows */
-	k = 0;
-	for (i = 0; i < icon_font->height; i++)	{
-		/*  */
-		char_row = icon * icon_font->offset + i * ((icon_font->width + 7) / 8);
-		/* go through character columns */
-		bytes_row = -1;
-		for (j = 0; j < icon_font->width; j++){
-			if(j % 8 == 0){
-				bytes_row++;
-			}
-			/* If exceed buffer size, send buffer */
-			if ((2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE + 1) > MAX_VALUE_SIZE){
-				lcd_cmd_t lcd_pixels = {NULL, MAX_VALUE_SIZE, pixel};
-				WriteLCD(&lcd_pixels);
-				bytes_count -= MAX_VALUE_SIZE;
-				k++;
-			}
-			/* The n=FontWidth first bits of the 16bits row data draws the corresponding part of a character */
-			if (icon_font->data[char_row + bytes_row] & (MSK_BIT8 >> (j % 8))){
-				/* if bit = 1, draw put foreground color */
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE] = HighByte(foreground);
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(foreground);
-			}
-			else{
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE] = HighByte(background);
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(background);
-			}
+	/* Whole rows of the icon are written to each burst */
+	rows_burst = LCD_BUFFER_SIZE / (2 * icon_font->width);
+	for (row = 0; row < icon_font->height; row += rows_burst){
+		if (rows_burst > icon_font->height - row){
+			rows_burst = icon_font->height - row;
+		}
+		pixel = (uint16_t *)NextBuffer();
+		dst = pixel;
+		for (uint16_t r = row; r < row + rows_burst; r++){
+			GlyphRow(&reader, icon_font->width, dst);
+			dst += icon_font->width;
+		}
+		if (row == 0){
+			SetCursorPosition(lcd_x, lcd_y, lcd_x + icon_font->width - 1, lcd_y + icon_font->height - 1, (uint8_t *)pixel, 2 * (dst - pixel));
+		}
+		else{
+			WritePixels((uint8_t *)pixel, 2 * (dst - pixel));
 		}
 	}
-	/* Send the rest of the buffer */
-	lcd_cmd_t lcd_pixels = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixels);
 }
 
 void ILI9341DrawInt(uint16_t x, uint16_t y, uint32_t num, uint8_t dig, Font_t* font, uint16_t foreground, uint16_t background){
-	static uint16_t i;
+	static uint8_t i;
 	static uint16_t lcd_x, lcd_y;
+	static uint16_t digit_x0[10], digit_x1[10], prev_x0, prev_x1;
+	static int16_t drawn_x0, drawn_x1;
+	static uint16_t draw, draw_prev;
+	static uint32_t value, prev;
+	static uint8_t width;
+	static int_drawn_t *drawn;
 
 	/* Set coordinates */
 	lcd_x = x;
 	lcd_y = y;
+	if (dig > 10){
+		dig = 10;
+	}
+
+	/* Previous number drawn at the same place */
+	drawn = NULL;
+	for (i = 0; i < LCD_INT_MAX; i++){
+		if (int_drawn[i].dig == dig && int_drawn[i].x == x && int_drawn[i].y == y && int_drawn[i].font == font
+				&& int_drawn[i].foreground == foreground && int_drawn[i].background == background){
+			drawn = &int_drawn[i];
+		}
+	}
+	draw = 0;
+	drawn_x0 = 0;
+	drawn_x1 = -1;
+	if (drawn == NULL){
+		/* Digits take up to dig times the widest one */
+		width = 0;
+		for (i = '0'; i <= '9'; i++){
+			width = font->info[i - ' '].width > width ? font->info[i - ' '].width : width;
+		}
+		drawn = &int_drawn[int_next];
+		int_next = (int_next + 1) % LCD_INT_MAX;
+		*drawn = (int_drawn_t){x, y, font, foreground, background, 0, num, x + width * dig, y + font->font_height - 1};
+		/* Other integers drawn over are forgotten */
+		IntDrawnErase(x, y, drawn->x1, drawn->y1);
+		drawn->dig = dig;
+		draw = (1 << dig) - 1;
+	}
+	prev = drawn->num;
+	drawn->num = num;
+
+	/* Digits that changed are drawn, with the columns of the digit drawn before at their place */
+	value = num;
+	for (i=0; i<dig; i++){
+		digit_x0[i] = x + font->info[value%10 + '0' - ' '].width * (dig-1-i) + 1;
+		digit_x1[i] = digit_x0[i] + font->info[value%10 + '0' - ' '].width - 1;
+		if (value%10 != prev%10){
+			draw |= 1 << i;
+			prev_x0 = x + font->info[prev%10 + '0' - ' '].width * (dig-1-i) + 1;
+			prev_x1 = prev_x0 + font->info[prev%10 + '0' - ' '].width - 1;
+			if (drawn_x0 > drawn_x1){
+				drawn_x0 = prev_x0;
+				drawn_x1 = prev_x1;
+			}
+			drawn_x0 = prev_x0 < drawn_x0 ? prev_x0 : drawn_x0;
+			drawn_x1 = prev_x1 > drawn_x1 ? prev_x1 : drawn_x1;
+		}
+		value = value/10;
+		prev = prev/10;
+	}
+	/* Digits overlapping the columns drawn are drawn too, to keep the same overlap */
+	do{
+		draw_prev = draw;
+		for (i=0; i<dig; i++){
+			if ((draw & (1 << i)) && drawn_x0 > drawn_x1){
+				drawn_x0 = digit_x0[i];
+				drawn_x1 = digit_x1[i];
+			}
+			if ((draw & (1 << i)) || (digit_x0[i] <= drawn_x1 && digit_x1[i] >= drawn_x0)){
+				draw |= 1 << i;
+				drawn_x0 = digit_x0[i] < drawn_x0 ? digit_x0[i] : drawn_x0;
+				drawn_x1 = digit_x1[i] > drawn_x1 ? digit_x1[i] : drawn_x1;
+			}
+		}
+	} while (draw != draw_prev);
 
+	int_drawing = true;
 	for (i=0; i<dig; i++){
-		lcd_x = x + font->info[num%10 + '0' - ' '].width * (dig-1-i) + 1;
-		ILI9341DrawChar(lcd_x, lcd_y, num%10 + '0', font, foreground, background);
+		if (draw & (1 << i)){
+			lcd_x = digit_x0[i];
+			ILI9341DrawChar(lcd_x, lcd_y, num%10 + '0', font, foreground, background);
+		}
 		num = num/10;
 	}
+	int_drawing = false;
+}
+
+void ILI9341DrawIntInvalidate(void){
+	for (uint8_t i = 0; i < LCD_INT_MAX; i++){
+		int_drawn[i].dig = 0;
+	}
 }
 
 void ILI9341DrawString(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t foreground, uint16_t background){
 	static uint16_t lcd_x, lcd_y;
+	static uint16_t len, n, width;
 
 	/* Set coordinates */
 	lcd_x = x;
 	lcd_y = y;
 
 	while (*str != '\0'){	/* End of string */
+		/* Characters and width of the line */
+		len = 0;
+		n = 0;
+		width = 0;
+		while (str[len] != '\0' && str[len] != '\n'){
+			if (str[len] != '\r'){
+				width += font->info[str[len] - ' '].width + 1;
+				n++;
+			}
+			len++;
+		}
+		/* Put the line to LCD in a single area when it fits */
+		if (n <= LCD_TEXT_MAX && lcd_x + width - 1 <= lcd_orientation.width){
+			DrawText(lcd_x, lcd_y, str, len, font, foreground, background);
+			str += len;
+		}
+		else{
+			while (*str != '\0' && *str != '\n'){
+				if (*str != '\r'){
+					/* Put character to LCD */
+					ILI9341DrawChar(lcd_x, lcd_y, *str, font, foreground, background);
+					lcd_x += font->info[*str - ' '].width + 1;
+				}
+				/* Next character */
+				str++;
+			}
+		}
 		/* New line */
 		if (*str == '\n'){
 			lcd_y += font->font_height + 1;
@@ -509,15 +1490,6 @@ void ILI9341DrawString(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t
 			}
 			str++;
 		}
-		else if (*str == '\r'){
-				str++;
-			}
-
-		/* Put character to LCD */
-		ILI9341DrawChar(lcd_x, lcd_y, *str, font, foreground, background);
-		lcd_x += font->info[*str - ' '].width + 1;
-		/* Next character */
-		str++;
 	}
 }
 
@@ -536,6 +1508,8 @@ void ILI9341GetStringSize(char* str, Font_t* font, uint16_t* width, uint16_t* he
 
 void ILI9341DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
 	static int16_t x_dist, y_dist, x_grow, y_grow, error, error_2;
+	static int16_t run_x, run_y;
+	static bool grow_x, grow_y, run_end;
 
 	/* Check for overflow */
 	if (x0 >= lcd_orientation.width){
@@ -576,24 +1550,42 @@ void ILI9341DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_
 	/* Diagonal line */
 	else{
 		error = x_dist - y_dist;
+		/* Pixels of the same row (flat lines) or column (steep lines) are sent as a single run */
+		run_x = x0;
+		run_y = y0;
 
 		while (1){
-			/* Draw start point */
-			ILI9341DrawPixel(x0, y0, color);
 			/* Loop ends when start point reaches end point */
 			if (x0 == x1 && y0 == y1){
+				FillSpan(run_x, run_y, x0, y0, color);
 				break;
 			}
 			error_2 = 2 * error;
 			/* Determine if line must grow in x direction */
-			if (error_2 > -y_dist){
+			grow_x = error_2 > -y_dist;
+			if (grow_x){
 				error -= y_dist;
-				x0 += x_grow;	/* Move start point */
 			}
 			/* Determine if line must grow in y direction */
-			if (error_2 < x_dist){
+			grow_y = error_2 < x_dist;
+			if (grow_y){
 				error += x_dist;
-				y0 += y_grow;	/* Move start point */
+			}
+			/* Run ends when the line moves across it */
+			run_end = (x_dist >= y_dist) ? grow_y : grow_x;
+			if (run_end){
+				FillSpan(run_x, run_y, x0, y0, color);
+			}
+			/* Move start point */
+			if (grow_x){
+				x0 += x_grow;
+			}
+			if (grow_y){
+				y0 += y_grow;
+			}
+			if (run_end){
+				run_x = x0;
+				run_y = y0;
 			}
 		}
 	}
@@ -611,39 +1603,50 @@ void ILI9341DrawFilledRectangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t
 }
 
 void ILI9341DrawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
-	static int16_t f, ddF_x, ddF_y, x, y;
+	static int16_t f, ddF_x, ddF_y, x, y, run_x;
 
 	f = 1 - r;
 	ddF_x = 1;
 	ddF_y = -2 * r;
 	x = 0;
 	y = r;
-
-	ILI9341DrawPixel(x0, y0 + r, color);
-	ILI9341DrawPixel(x0, y0 - r, color);
-	ILI9341DrawPixel(x0 + r, y0, color);
-	ILI9341DrawPixel(x0 - r, y0, color);
-
-    while (x < y){
-        if (f >= 0){
-            y--;
-            ddF_y += 2;
-            f += ddF_y;
-        }
-        x++;
-        ddF_x += 2;
-        f += ddF_x;
-
-        ILI9341DrawPixel(x0 + x, y0 + y, color);
-        ILI9341DrawPixel(x0 - x, y0 + y, color);
-        ILI9341DrawPixel(x0 + x, y0 - y, color);
-        ILI9341DrawPixel(x0 - x, y0 - y, color);
-
-        ILI9341DrawPixel(x0 + y, y0 + x, color);
-        ILI9341DrawPixel(x0 - y, y0 + x, color);
-        ILI9341DrawPixel(x0 + y, y0 - x, color);
-        ILI9341DrawPixel(x0 - y, y0 - x, color);
-    }
+	/* Points of an octant with the same y are a run: horizontal at top and bottom, vertical at the sides */
+	run_x = 0;
+
+	while (1){
+		if (x >= y || f >= 0){
+			if (run_x == 0){
+				/* First run is centered on the axes */
+				FillSpan(x0 - x, y0 + y, x0 + x, y0 + y, color);
+				FillSpan(x0 - x, y0 - y, x0 + x, y0 - y, color);
+				FillSpan(x0 + y, y0 - x, x0 + y, y0 + x, color);
+				FillSpan(x0 - y, y0 - x, x0 - y, y0 + x, color);
+			}
+			else{
+				FillSpan(x0 + run_x, y0 + y, x0 + x, y0 + y, color);
+				FillSpan(x0 - x, y0 + y, x0 - run_x, y0 + y, color);
+				FillSpan(x0 + run_x, y0 - y, x0 + x, y0 - y, color);
+				FillSpan(x0 - x, y0 - y, x0 - run_x, y0 - y, color);
+
+				FillSpan(x0 + y, y0 + run_x, x0 + y, y0 + x, color);
+				FillSpan(x0 - y, y0 + run_x, x0 - y, y0 + x, color);
+				FillSpan(x0 + y, y0 - x, x0 + y, y0 - run_x, color);
+				FillSpan(x0 - y, y0 - x, x0 - y, y0 - run_x, color);
+			}
+			run_x = x + 1;
+		}
+		if (x >= y){
+			break;
+		}
+		if (f >= 0){
+			y--;
+			ddF_y += 2;
+			f += ddF_y;
+		}
+		x++;
+		ddF_x += 2;
+		f += ddF_x;
+	}
 }
 
 void ILI9341DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
@@ -655,28 +1658,26 @@ void ILI9341DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
 	x = 0;
 	y = r;
 
-    ILI9341DrawPixel(x0, y0 + r, color);
-    ILI9341DrawPixel(x0, y0 - r, color);
-    ILI9341DrawPixel(x0 + r, y0, color);
-    ILI9341DrawPixel(x0 - r, y0, color);
-    ILI9341DrawLine(x0 - r, y0, x0 + r, y0, color);
-
-    while (x < y){
-        if (f >= 0){
-            y--;
-            ddF_y += 2;
-            f += ddF_y;
-        }
-        x++;
-        ddF_x += 2;
-        f += ddF_x;
+	FillSpan(x0 - r, y0, x0 + r, y0, color);
 
-        ILI9341DrawLine(x0 - x, y0 + y, x0 + x, y0 + y, color);
-        ILI9341DrawLine(x0 + x, y0 - y, x0 - x, y0 - y, color);
+	while (x < y){
+		if (f >= 0){
+			/* Rows at y0 +/- y are drawn once, with their widest span */
+			FillSpan(x0 - x, y0 + y, x0 + x, y0 + y, color);
+			FillSpan(x0 - x, y0 - y, x0 + x, y0 - y, color);
+			y--;
+			ddF_y += 2;
+			f += ddF_y;
+		}
+		x++;
+		ddF_x += 2;
+		f += ddF_x;
 
-        ILI9341DrawLine(x0 + y, y0 + x, x0 - y, y0 + x, color);
-        ILI9341DrawLine(x0 + y, y0 - x, x0 - y, y0 - x, color);
-    }
+		FillSpan(x0 - y, y0 + x, x0 + y, y0 + x, color);
+		FillSpan(x0 - y, y0 - x, x0 + y, y0 - x, color);
+	}
+	FillSpan(x0 - x, y0 + y, x0 + x, y0 + y, color);
+	FillSpan(x0 - x, y0 - y, x0 + x, y0 - y, color);
 }
 
 void ILI9341DrawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color){
@@ -692,10 +1693,8 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
 	static int16_t y_1 = 0;
 	static int16_t x_2 = 0;
 	static int16_t y_2 = 0;
-	static int16_t x_aux = 0;
-	static int16_t y_aux = 0;
-	static int16_t scanline_y = 0;
-	float invslope1, invslope2, curx1, curx2;
+	static int16_t x_a, x_b, scanline_y, last_y;
+	static int32_t dx01, dy01, dx02, dy02, dx12, dy12, sum_a, sum_b;
 	if((y0 <= y1) && (y0 <= y2)){
 		x_0 = x0;
 		y_0 = y0;
@@ -739,98 +1738,74 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
 			y_2 = y0;
 		}
 	}
-	if(y_1 == y_2){
-		// Bottom flat triangle
-		invslope1 = (float)(x_1 - x_0) / (float)(y_1 - y_0);
-		invslope2 = (float)(x_2 - x_0) / (float)(y_2 - y_0);
-		curx1 = x_0;
-		curx2 = x_0;
-		scanline_y = y_0;
-		while(scanline_y < y_1){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
-			curx1 += invslope1;
-			curx2 += invslope2;
-			scanline_y++;
-		}
-  	}
-  	else if (y_0 == y_1){
-		// Top flat triangle
-		invslope1 = (float)(x_2 - x_0) / (float)(y_2 - y_0);
-		invslope2 = (float)(x_2 - x_1) / (float)(y_2 - y_1);
-		curx1 = x_2;
-		curx2 = x_2;
-		scanline_y = y_2;
-		while(scanline_y > y_0){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
-			curx1 -= invslope1;
-			curx2 -= invslope2;
-			scanline_y--;
-		}
-  	}
-  	else{
-		// Split in a flat top triangle and a bottom flat triangle
-		x_aux = (int)(x_0 + (float)(y_1 - y_0) / (float)(y_2 - y_0) * (x_2 - x_0));
-		y_aux = y_1;
-		// Bottom flat triangle
-		invslope1 = (float)(x_1 - x_0) / (float)(y_1 - y_0);
-		invslope2 = (float)(x_aux - x_0) / (float)(y_aux - y_0);
-		curx1 = x_0;
-		curx2 = x_0;
-		scanline_y = y_0;
-		while(scanline_y < y_1){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
-			curx1 += invslope1;
-			curx2 += invslope2;
-			scanline_y++;
-		}
-		// Top flat triangle
-		invslope1 = (float)(x_2 - x_1) / (float)(y_2 - y_1);
-		invslope2 = (float)(x_2 - x_aux) / (float)(y_2 - y_aux);
-		curx1 = x_2;
-		curx2 = x_2;
-		scanline_y = y_2;
-		while(scanline_y > y_1){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
-			curx1 -= invslope1;
-			curx2 -= invslope2;
-			scanline_y--;
-		}
-		ILI9341DrawLine(x_1, y_1, x_aux, y_aux, color);
-  	}
+	if(y_0 == y_2){
+		/* All vertices in one row */
+		x_a = x_0 < x_1 ? (x_0 < x_2 ? x_0 : x_2) : (x_1 < x_2 ? x_1 : x_2);
+		x_b = x_0 > x_1 ? (x_0 > x_2 ? x_0 : x_2) : (x_1 > x_2 ? x_1 : x_2);
+		FillSpan(x_a, y_0, x_b, y_0, color);
+		return;
+	}
+	/* Edges are walked with integer steps, each scanline is a single span */
+	dx01 = x_1 - x_0;
+	dy01 = y_1 - y_0;
+	dx02 = x_2 - x_0;
+	dy02 = y_2 - y_0;
+	dx12 = x_2 - x_1;
+	dy12 = y_2 - y_1;
+	sum_a = 0;
+	sum_b = 0;
+	/* Upper part, between edges 0-1 and 0-2. Row y_1 belongs to it when the bottom is flat */
+	last_y = (y_1 == y_2) ? y_1 : y_1 - 1;
+	for(scanline_y = y_0; scanline_y <= last_y; scanline_y++){
+		x_a = x_0 + sum_a / dy01;
+		x_b = x_0 + sum_b / dy02;
+		sum_a += dx01;
+		sum_b += dx02;
+		FillSpan(x_a, scanline_y, x_b, scanline_y, color);
+	}
+	/* Lower part, between edges 1-2 and 0-2 */
+	sum_a = dx12 * (scanline_y - y_1);
+	sum_b = dx02 * (scanline_y - y_0);
+	for(; scanline_y <= y_2; scanline_y++){
+		x_a = x_1 + sum_a / dy12;
+		x_b = x_0 + sum_b / dy02;
+		sum_a += dx12;
+		sum_b += dx02;
+		FillSpan(x_a, scanline_y, x_b, scanline_y, color);
+	}
 }
 
 void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* pic){
-	static uint16_t i, j;
-	static int32_t bytes_count;
-	static uint8_t pixel[MAX_VALUE_SIZE];
-
-	SetCursorPosition(x, y, x + width - 1, y + height - 1);
+	static int32_t i, bytes_count, bytes_burst;
+	static uint8_t *pixel;
 
 	/* Number of bytes to write. We have to write 2 bytes/pixel */
 	bytes_count = width * height * 2;
 
-	/* Start writing LCD memory */
-	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
-	WriteLCD(&lcd_write);
-
-	j = 0;
-	while(bytes_count - MAX_VALUE_SIZE > 0){
-		for (i = 0; i < MAX_VALUE_SIZE; i++){
-			pixel[i] = pic[j * MAX_VALUE_SIZE + i];
-		}
-		lcd_cmd_t lcd_pixel = {NULL, MAX_VALUE_SIZE, pixel};
-		WriteLCD(&lcd_pixel);
-		bytes_count -= MAX_VALUE_SIZE;
-		j++;
+	/* Pictures are in flash, they are copied to RAM before each burst */
+	bytes_burst = bytes_count < LCD_BUFFER_SIZE ? bytes_count : LCD_BUFFER_SIZE;
+	pixel = NextBuffer();
+	for (i = 0; i < bytes_burst; i++){
+		pixel[i] = pic[i];
 	}
-	for (i = 0; i < bytes_count; i++){
-		pixel[i] = pic[j * MAX_VALUE_SIZE + i];
+	SetCursorPosition(x, y, x + width - 1, y + height - 1, pixel, bytes_burst);
+	pic += bytes_burst;
+	bytes_count -= bytes_burst;
+
+	while(bytes_count > 0){
+		bytes_burst = bytes_count < LCD_BUFFER_SIZE ? bytes_count : LCD_BUFFER_SIZE;
+		pixel = NextBuffer();
+		for (i = 0; i < bytes_burst; i++){
+			pixel[i] = pic[i];
+		}
+		WritePixels(pixel, bytes_burst);
+		pic += bytes_burst;
+		bytes_count -= bytes_burst;
 	}
-	lcd_cmd_t lcd_pixel = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixel);
 }
 
 uint8_t ILI9341DeInit(void){
+	ILI9341Flush();
 	return 0;
 }
 
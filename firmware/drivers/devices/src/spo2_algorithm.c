@@ -60,6 +60,10 @@
 #include "spo2_algorithm.h"
 
 #define MIN(a,b) (((a)<(b))?(a):(b))
+#define MAX_PEAKS 15
+
+static  int32_t an_x[ BUFFER_SIZE]; //ir
+static  int32_t an_y[ BUFFER_SIZE]; //red
 
 const uint8_t uch_spo2_table[184]={ 95, 95, 95, 96, 96, 96, 97, 97, 97, 97, 97, 98, 98, 98, 98, 98, 99, 99, 99, 99,
               99, 99, 99, 99, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
@@ -94,7 +98,7 @@ void maxim_heart_rate_and_oxygen_saturation(uint32_t *pun_ir_buffer, int32_t n_i
 {
   uint32_t un_ir_mean;
   int32_t k, n_i_ratio_count;
-  int32_t i, n_exact_ir_valley_locs_count, n_middle_idx;
+  int32_t i, n_exact_ir_valley_locs_count;
   int32_t n_th1, n_npks;
   int32_t an_ir_valley_locs[15] ;
   int32_t n_peak_interval_sum;
@@ -192,13 +196,7 @@ void maxim_heart_rate_and_oxygen_saturation(uint32_t *pun_ir_buffer, int32_t n_i
     }
   }
   // choose median value since PPG signal may varies from beat to beat
-  maxim_sort_ascend(an_ratio, n_i_ratio_count);
-  n_middle_idx= n_i_ratio_count/2;
-
-  if (n_middle_idx >1)
-    n_ratio_average =( an_ratio[n_middle_idx-1] +an_ratio[n_middle_idx])/2; // use median
-  else
-    n_ratio_average = an_ratio[n_middle_idx ];
+  n_ratio_average = maxim_ratio_median(an_ratio, n_i_ratio_count);
 
   if( n_ratio_average>2 && n_ratio_average <184){
     n_spo2_calc= uch_spo2_table[n_ratio_average] ;
@@ -243,7 +241,7 @@ void maxim_peaks_above_min_height( int32_t *pn_locs, int32_t *n_npks,  int32_t
       n_width = 1;
       while (i+n_width < n_size && pn_x[i] == pn_x[i+n_width])  // find flat peaks
         n_width++;
-      if (pn_x[i] > pn_x[i+n_width] && (*n_npks) < 15 ){      // find right edge of peaks
+      if (pn_x[i] > pn_x[i+n_width] && (*n_npks) < MAX_PEAKS ){      // find right edge of peaks
         pn_locs[(*n_npks)++] = i;
         // for flat peaks, peak location is left edge
         i += n_width+1;
@@ -256,69 +254,307 @@ void maxim_peaks_above_min_height( int32_t *pn_locs, int32_t *n_npks,  int32_t
   }
 }
 
+static int8_t maxim_peak_kept(int32_t *pn_locs, int32_t n_npks, int32_t *pn_x, int32_t n_min_distance, int8_t *ach_kept, int32_t i)
+/**
+* \brief        Check if peak is kept
+* \par          Details
+*               Peak is kept if no larger kept peak is closer than MIN_DISTANCE, which is the result of removing
+*               peaks from large to small. Of equal peaks the left one is larger. The lag-zero peak at index -1
+*               removes peaks close to the start. Each peak is decided once, larger neighbours first.
+*
+* \retval       1 if peak is kept
+*/
+{
+  int32_t j, n_kept;
+  if (ach_kept[i] >= 0) return ach_kept[i];
+  n_kept = pn_locs[i] + 1 > n_min_distance; // lag-zero peak of autocorr is at index -1
+  for (j = i-1; n_kept && j >= 0 && pn_locs[i] - pn_locs[j] <= n_min_distance; j--){
+    if (pn_x[pn_locs[j]] >= pn_x[pn_locs[i]] && maxim_peak_kept(pn_locs, n_npks, pn_x, n_min_distance, ach_kept, j))
+      n_kept = 0;
+  }
+  for (j = i+1; n_kept && j < n_npks && pn_locs[j] - pn_locs[i] <= n_min_distance; j++){
+    if (pn_x[pn_locs[j]] > pn_x[pn_locs[i]] && maxim_peak_kept(pn_locs, n_npks, pn_x, n_min_distance, ach_kept, j))
+      n_kept = 0;
+  }
+  ach_kept[i] = n_kept;
+  return n_kept;
+}
+
 void maxim_remove_close_peaks(int32_t *pn_locs, int32_t *pn_npks, int32_t *pn_x, int32_t n_min_distance)
 /**
 * \brief        Remove peaks
 * \par          Details
-*               Remove peaks separated by less than MIN_DISTANCE
+*               Remove peaks separated by less than MIN_DISTANCE, the smaller of two close peaks is removed.
+*               pn_locs must be in ascending order, with at most MAX_PEAKS peaks as found by
+*               maxim_peaks_above_min_height(). Linear time, only neighbour peaks are compared.
 *
 * \retval       None
 */
 {
+  int32_t i, n_old_npks;
+  int8_t ach_kept[MAX_PEAKS];
 
-  int32_t i, j, n_old_npks, n_dist;
+  n_old_npks = MIN( *pn_npks, MAX_PEAKS );
+  for ( i = 0; i < n_old_npks; i++ ) ach_kept[i] = -1;
+  *pn_npks = 0;
+  for ( i = 0; i < n_old_npks; i++ ){
+    if ( maxim_peak_kept( pn_locs, n_old_npks, pn_x, n_min_distance, ach_kept, i ) )
+      pn_locs[(*pn_npks)++] = pn_locs[i];
+  }
+}
 
-  /* Order peaks from large to small */
-  maxim_sort_indices_descend( pn_x, pn_locs, *pn_npks );
+int32_t maxim_ratio_median(int32_t *pn_x, int32_t n_size)
+/**
+* \brief        Median of ratios
+* \par          Details
+*               Median of at most 5 values as taken by the algorithm, mean of the two middle values for 4 and 5.
+*               Sorting network of 5 values, missing values are padded with the largest value.
+*               The array is sorted in ascending order.
+*
+* \retval       Median
+*/
+{
+  static const uint8_t auch_pairs[9][2] = { {0, 1}, {3, 4}, {2, 4}, {2, 3}, {0, 3}, {0, 2}, {1, 4}, {1, 3}, {1, 2} };
+  int32_t an_v[5], k, n_temp, n_middle_idx;
 
-  for ( i = -1; i < *pn_npks; i++ ){
-    n_old_npks = *pn_npks;
-    *pn_npks = i+1;
-    for ( j = i+1; j < n_old_npks; j++ ){
-      n_dist =  pn_locs[j] - ( i == -1 ? -1 : pn_locs[i] ); // lag-zero peak of autocorr is at index -1
-      if ( n_dist > n_min_distance || n_dist < -n_min_distance )
-        pn_locs[(*pn_npks)++] = pn_locs[j];
+  if (n_size == 0) return pn_x[0];
+  for (k=0; k< 5; k++) an_v[k] = k < n_size ? pn_x[k] : INT32_MAX;
+  for (k=0; k< 9; k++){
+    if (an_v[auch_pairs[k][0]] > an_v[auch_pairs[k][1]]){
+      n_temp = an_v[auch_pairs[k][0]];
+      an_v[auch_pairs[k][0]] = an_v[auch_pairs[k][1]];
+      an_v[auch_pairs[k][1]] = n_temp;
     }
   }
+  for (k=0; k< n_size; k++) pn_x[k] = an_v[k];
+  n_middle_idx= n_size/2;
+  if (n_middle_idx >1)
+    return ( an_v[n_middle_idx-1] +an_v[n_middle_idx])/2; // use median
+  return an_v[n_middle_idx ];
+}
 
-  // Resort indices int32_to ascending order
-  maxim_sort_ascend( pn_locs, *pn_npks );
+void maxim_spo2_stream_init(maxim_spo2_stream_t *ps_stream)
+/**
+* \brief        Initialize streaming heart rate/SpO2 calculation
+* \par          Details
+*               Clears the state, the first BUFFER_SIZE samples fill the window as in the batch algorithm
+*
+* \param[out]   *ps_stream               - Calculation state
+*
+* \retval       None
+*/
+{
+  int32_t k;
+  uint8_t *puch_state = (uint8_t *)ps_stream;
+  for (k=0; k< (int32_t)sizeof(maxim_spo2_stream_t); k++) puch_state[k]=0;
+  ps_stream->n_cand_loc = -1;
+  ps_stream->n_pend_loc = -1;
+  ps_stream->n_seg_loc = -1;
 }
 
-void maxim_sort_ascend(int32_t  *pn_x, int32_t n_size)
+static void maxim_stream_valley(maxim_spo2_stream_t *ps_stream, int32_t n_loc)
 /**
-* \brief        Sort array
+* \brief        Add final valley
 * \par          Details
-*               Sort array in ascending order (insertion sort algorithm)
+*               Valley is used for the heart rate and queued for the AC/DC measurement
 *
 * \retval       None
 */
 {
-  int32_t i, j, n_temp;
-  for (i = 1; i < n_size; i++) {
-    n_temp = pn_x[i];
-    for (j = i; j > 0 && n_temp < pn_x[j-1]; j--)
-        pn_x[j] = pn_x[j-1];
-    pn_x[j] = n_temp;
+  if (ps_stream->n_valley_count == STREAM_MAX_VALLEYS){
+    ps_stream->n_valley_first = (ps_stream->n_valley_first + 1) % STREAM_MAX_VALLEYS;
+    ps_stream->n_valley_count--;
   }
+  ps_stream->an_valley_locs[(ps_stream->n_valley_first + ps_stream->n_valley_count++) % STREAM_MAX_VALLEYS] = n_loc;
+  if (ps_stream->n_meas_count < STREAM_MAX_VALLEYS)
+    ps_stream->an_meas_locs[(ps_stream->n_meas_first + ps_stream->n_meas_count++) % STREAM_MAX_VALLEYS] = n_loc;
 }
 
-void maxim_sort_indices_descend(  int32_t  *pn_x, int32_t *pn_indx, int32_t n_size)
+static void maxim_stream_peak(maxim_spo2_stream_t *ps_stream, int32_t n_loc, int32_t n_val)
 /**
-* \brief        Sort indices
+* \brief        Add peak of the inverted signal
 * \par          Details
-*               Sort indices according to descending order (insertion sort algorithm)
+*               Of peaks closer than STREAM_MIN_DISTANCE the highest is kept, as maxim_remove_close_peaks()
 *
 * \retval       None
 */
 {
-  int32_t i, j, n_temp;
-  for (i = 1; i < n_size; i++) {
-    n_temp = pn_indx[i];
-    for (j = i; j > 0 && pn_x[n_temp] > pn_x[pn_indx[j-1]]; j--)
-      pn_indx[j] = pn_indx[j-1];
-    pn_indx[j] = n_temp;
+  if (ps_stream->n_pend_loc >= 0 && n_loc - ps_stream->n_pend_loc <= STREAM_MIN_DISTANCE){
+    if (n_val > ps_stream->n_pend_val){
+      ps_stream->n_pend_loc = n_loc;
+      ps_stream->n_pend_val = n_val;
+    }
+    return;
   }
+  if (ps_stream->n_pend_loc >= 0) maxim_stream_valley(ps_stream, ps_stream->n_pend_loc);
+  ps_stream->n_pend_loc = n_loc;
+  ps_stream->n_pend_val = n_val;
 }
 
+static void maxim_stream_measure(maxim_spo2_stream_t *ps_stream, int32_t n_loc, uint32_t un_ir, uint32_t un_red)
+/**
+* \brief        Measure AC/DC of one raw sample
+* \par          Details
+*               Maximum of ir and red between valleys, at each valley the an_ratio of the period is calculated
+*               as in maxim_heart_rate_and_oxygen_saturation()
+*
+* \retval       None
+*/
+{
+  int32_t n_y_ac, n_x_ac, n_nume, n_denom, n_len, n_x, n_y;
+  n_x = un_ir;
+  n_y = un_red;
+  if (ps_stream->n_meas_count > 0 && ps_stream->an_meas_locs[ps_stream->n_meas_first] == n_loc){
+    ps_stream->n_meas_first = (ps_stream->n_meas_first + 1) % STREAM_MAX_VALLEYS;
+    ps_stream->n_meas_count--;
+    n_len = n_loc - ps_stream->n_seg_loc;
+    if (ps_stream->n_seg_loc >= 0 && n_len > 3){
+      n_y_ac = ((int32_t)(n_y - ps_stream->un_seg_red))*(ps_stream->n_y_dc_max_idx - ps_stream->n_seg_loc); //red
+      n_y_ac = ps_stream->un_seg_red + n_y_ac/n_len;
+      n_y_ac = ps_stream->n_y_dc_max - n_y_ac;
+      n_x_ac = ((int32_t)(n_x - ps_stream->un_seg_ir))*(ps_stream->n_x_dc_max_idx - ps_stream->n_seg_loc); // ir
+      n_x_ac = ps_stream->un_seg_ir + n_x_ac/n_len;
+      n_x_ac = ps_stream->n_x_at_y_max - n_x_ac;
+      n_nume = ((int64_t)n_y_ac*ps_stream->n_x_dc_max)>>7;
+      n_denom = ((int64_t)n_x_ac*ps_stream->n_y_dc_max)>>7;
+      if (n_denom>0 && n_nume != 0){
+        ps_stream->an_ratio[ps_stream->n_ratio_pos] = ((int64_t)n_nume*100)/n_denom;
+        ps_stream->an_ratio_locs[ps_stream->n_ratio_pos] = ps_stream->n_seg_loc;
+        ps_stream->n_ratio_pos = (ps_stream->n_ratio_pos + 1) % STREAM_MAX_RATIOS;
+        if (ps_stream->n_ratio_count < STREAM_MAX_RATIOS) ps_stream->n_ratio_count++;
+      }
+    }
+    // next period starts at this valley
+    ps_stream->n_seg_loc = n_loc;
+    ps_stream->un_seg_ir = un_ir;
+    ps_stream->un_seg_red = un_red;
+    ps_stream->n_x_dc_max = -16777216;
+    ps_stream->n_y_dc_max = -16777216;
+  }
+  if (ps_stream->n_seg_loc < 0) return;
+  if (n_x > ps_stream->n_x_dc_max) {ps_stream->n_x_dc_max = n_x; ps_stream->n_x_dc_max_idx = n_loc;}
+  if (n_y > ps_stream->n_y_dc_max) {ps_stream->n_y_dc_max = n_y; ps_stream->n_y_dc_max_idx = n_loc; ps_stream->n_x_at_y_max = n_x;}
+}
 
+void maxim_spo2_stream_add(maxim_spo2_stream_t *ps_stream, uint32_t un_ir, uint32_t un_red)
+/**
+* \brief        Add sample to the streaming heart rate/SpO2 calculation
+* \par          Details
+*               Constant work per sample, no buffers are shifted
+*
+* \param[in,out] *ps_stream              - Calculation state
+* \param[in]    un_ir                    - IR sensor sample
+* \param[in]    un_red                   - Red sensor sample
+*
+* \retval       None
+*/
+{
+  int32_t n = ps_stream->n_count++;
+  int32_t k = n - (MA4_SIZE - 1); // index of the moving average
+  int32_t n_x, n_ma4, n_th1, m;
+
+  ps_stream->aun_ir[n & (STREAM_RING_SIZE-1)] = un_ir;
+  ps_stream->aun_red[n & (STREAM_RING_SIZE-1)] = un_red;
+
+  // remove DC and invert signal so that we can use peak detector as valley detector
+  if (n == 0) ps_stream->n_ir_dc = un_ir<<5;
+  ps_stream->n_ir_dc += un_ir - (ps_stream->n_ir_dc>>5);
+  n_x = (ps_stream->n_ir_dc>>5) - (int32_t)un_ir;
+
+  // 4 pt Moving Average
+  ps_stream->n_ma4_sum += n_x - ps_stream->an_ma4[n % MA4_SIZE];
+  ps_stream->an_ma4[n % MA4_SIZE] = n_x;
+  if (k >= 0){
+    n_ma4 = ps_stream->n_ma4_sum/(int)4;
+    if (k == 0) ps_stream->n_th1 = n_ma4<<5;
+    ps_stream->n_th1 += n_ma4 - (ps_stream->n_th1>>5);
+    n_th1 = ps_stream->n_th1>>5;
+    if( n_th1<30) n_th1=30; // min allowed
+    if( n_th1>60) n_th1=60; // max allowed
+
+    // peaks above threshold, for flat peaks location is left edge
+    if (k > 0 && n_ma4 > ps_stream->n_ma4_prev && n_ma4 > n_th1){
+      ps_stream->n_cand_loc = k;
+      ps_stream->n_cand_val = n_ma4;
+      ps_stream->n_cand_width = 1;
+    }
+    else if (ps_stream->n_cand_loc >= 0){
+      if (n_ma4 < ps_stream->n_cand_val) {
+        maxim_stream_peak(ps_stream, ps_stream->n_cand_loc, ps_stream->n_cand_val);
+        ps_stream->n_cand_loc = -1;
+      }
+      else if (++ps_stream->n_cand_width > STREAM_MAX_FLAT)
+        ps_stream->n_cand_loc = -1;
+    }
+    ps_stream->n_ma4_prev = n_ma4;
+
+    // no closer peak could be found any more
+    if (ps_stream->n_pend_loc >= 0 && k > ps_stream->n_pend_loc + STREAM_MIN_DISTANCE + STREAM_MAX_FLAT + 1){
+      maxim_stream_valley(ps_stream, ps_stream->n_pend_loc);
+      ps_stream->n_pend_loc = -1;
+    }
+  }
+
+  // raw samples are measured when the valleys around them are final
+  m = n - STREAM_DELAY;
+  if (m >= 0)
+    maxim_stream_measure(ps_stream, m, ps_stream->aun_ir[m & (STREAM_RING_SIZE-1)], ps_stream->aun_red[m & (STREAM_RING_SIZE-1)]);
+}
+
+void maxim_spo2_stream_result(maxim_spo2_stream_t *ps_stream, int32_t *pn_spo2, int8_t *pch_spo2_valid, int32_t *pn_heart_rate, int8_t *pch_hr_valid)
+/**
+* \brief        Heart rate and SpO2 level of the last BUFFER_SIZE samples
+* \par          Details
+*               Heart rate from the mean interval of the valleys, SpO2 from the median of the last an_ratio values,
+*               could be called after any sample
+*
+* \param[in,out] *ps_stream              - Calculation state
+* \param[out]    *pn_spo2                - Calculated SpO2 value
+* \param[out]    *pch_spo2_valid         - 1 if the calculated SpO2 value is valid
+* \param[out]    *pn_heart_rate          - Calculated heart rate value
+* \param[out]    *pch_hr_valid           - 1 if the calculated heart rate value is valid
+*
+* \retval       None
+*/
+{
+  int32_t k, n_first, n_last, n_ratio_average;
+  int32_t an_ratio[STREAM_MAX_RATIOS], n_i_ratio_count;
+  int32_t n_start = ps_stream->n_count - BUFFER_SIZE;
+
+  // valleys out of the window
+  while (ps_stream->n_valley_count > 0 && ps_stream->an_valley_locs[ps_stream->n_valley_first] < n_start){
+    ps_stream->n_valley_first = (ps_stream->n_valley_first + 1) % STREAM_MAX_VALLEYS;
+    ps_stream->n_valley_count--;
+  }
+  if (ps_stream->n_valley_count >= 2){
+    n_first = ps_stream->an_valley_locs[ps_stream->n_valley_first];
+    n_last = ps_stream->an_valley_locs[(ps_stream->n_valley_first + ps_stream->n_valley_count - 1) % STREAM_MAX_VALLEYS];
+    *pn_heart_rate = (int32_t)( (FreqS*60)/ ((n_last - n_first)/(ps_stream->n_valley_count - 1)) );
+    *pch_hr_valid = 1;
+  }
+  else{
+    *pn_heart_rate = -999; // unable to calculate because # of peaks are too small
+    *pch_hr_valid = 0;
+  }
+
+  // choose median value since PPG signal may varies from beat to beat
+  n_i_ratio_count = 0;
+  for (k=0; k< ps_stream->n_ratio_count; k++){
+    if (ps_stream->an_ratio_locs[k] >= n_start) an_ratio[n_i_ratio_count++] = ps_stream->an_ratio[k];
+  }
+  if (n_i_ratio_count == 0){
+    *pn_spo2 = -999;
+    *pch_spo2_valid = 0;
+    return;
+  }
+  n_ratio_average = maxim_ratio_median(an_ratio, n_i_ratio_count);
+
+  if( n_ratio_average>2 && n_ratio_average <184){
+    *pn_spo2 = uch_spo2_table[n_ratio_average];
+    *pch_spo2_valid = 1;
+  }
+  else{
+    *pn_spo2 = -999; // do not use SPO2 since signal an_ratio is out of range
+    *pch_spo2_valid = 0;
+  }
+}
@@ -0,0 +1,267 @@
+/**
+ * @file mock_lcd.c
+ * @brief SPI, GPIO and delay mock with a model of the ILI9341 panel for host tests of the display driver
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "mock_lcd.h"
+#include "spi_mcu.h"
+#include "gpio_mcu.h"
+#include "delay_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define COLUMN_ADDR_SET		0x2A
+#define PAGE_ADDR_SET		0x2B
+#define MEM_WRITE			0x2C
+#define MEM_ACC_CTRL		0x36
+#define MADCTL_MY			0x80	/*!< Row address order */
+#define MADCTL_MX			0x40	/*!< Column address order */
+#define MADCTL_MV			0x20	/*!< Row/column exchange */
+#define NO_COMMAND			-1
+/**
+ * @brief Transfer waiting in the queue
+ */
+typedef struct{
+	uint8_t *tx_buffer;			/*!< Buffer of the data, sent later */
+	uint8_t tx_data[4];			/*!< Copy of transfers of up to 4 bytes, as the SPI driver does */
+	uint32_t size;
+	void *param_p;
+} queued_transfer_t;
+/*==================[internal data definition]===============================*/
+static gpio_t dc_pin;
+static bool dc_level;
+static bool spi_ready;
+static void (*pre_func)(void *);
+static int16_t cmd;							/*!< Last command, NO_COMMAND after init */
+static uint32_t params;						/*!< Parameter bytes received for cmd */
+static uint8_t param[4];
+static uint8_t madctl;
+static uint16_t col_start, col_end, row_start, row_end;	/*!< Area of the memory write */
+static uint16_t col, row;					/*!< Next pixel of the memory write */
+static uint8_t pixel_high;
+static queued_transfer_t queue[MOCK_LCD_QUEUE];
+static uint32_t queue_in, queue_out;		/*!< Transfers queued and sent, numbered as in spi_mcu.c */
+/*==================[external data definition]===============================*/
+uint16_t mock_lcd_mem[MOCK_LCD_ROWS][MOCK_LCD_COLUMNS];
+mock_lcd_stats_t mock_lcd_stats;
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Memory cell of a point of the display, as set by the memory access control
+ */
+static uint16_t *MemCell(uint16_t x, uint16_t y){
+	uint16_t mem_row = madctl & MADCTL_MV ? x : y;
+	uint16_t mem_col = madctl & MADCTL_MV ? y : x;
+	if(madctl & MADCTL_MY){
+		mem_row = MOCK_LCD_ROWS - 1 - mem_row;
+	}
+	if(madctl & MADCTL_MX){
+		mem_col = MOCK_LCD_COLUMNS - 1 - mem_col;
+	}
+	if((mem_row >= MOCK_LCD_ROWS) || (mem_col >= MOCK_LCD_COLUMNS)){
+		return NULL;
+	}
+	return &mock_lcd_mem[mem_row][mem_col];
+}
+
+/**
+ * @brief Decodes a byte as the panel does
+ */
+static void ByteIn(uint8_t byte){
+	mock_lcd_stats.bytes++;
+	if(!dc_level){
+		mock_lcd_stats.commands++;
+		cmd = byte;
+		params = 0;
+		if(cmd == MEM_WRITE){
+			col = col_start;
+			row = row_start;
+		}
+		return;
+	}
+	switch(cmd){
+	case NO_COMMAND:
+		mock_lcd_stats.errors++;
+		break;
+	case COLUMN_ADDR_SET:
+	case PAGE_ADDR_SET:
+		if(params < 4){
+			param[params] = byte;
+		}
+		if(params == 3){
+			if(cmd == COLUMN_ADDR_SET){
+				col_start = param[0] << 8 | param[1];
+				col_end = param[2] << 8 | param[3];
+			}
+			else{
+				row_start = param[0] << 8 | param[1];
+				row_end = param[2] << 8 | param[3];
+			}
+		}
+		break;
+	case MEM_ACC_CTRL:
+		madctl = byte;
+		break;
+	case MEM_WRITE:
+		if(params % 2 == 0){
+			pixel_high = byte;
+			break;
+		}
+		uint16_t *cell = MemCell(col, row);
+		if(cell != NULL){
+			*cell = pixel_high << 8 | byte;
+		}
+		/* The address wraps inside the area */
+		if(++col > col_end){
+			col = col_start;
+			if(++row > row_end){
+				row = row_start;
+			}
+		}
+		break;
+	}
+	params++;
+}
+
+/**
+ * @brief One SPI transfer: DC is driven by the transaction start callback
+ */
+static void Transfer(uint8_t *buffer, uint32_t size, void *param_p){
+	if(!spi_ready){
+		mock_lcd_stats.errors++;
+		return;
+	}
+	if(pre_func != NULL){
+		pre_func(param_p);
+	}
+	mock_lcd_stats.transfers++;
+	for(uint32_t i = 0; i < size; i++){
+		ByteIn(buffer[i]);
+	}
+}
+
+/**
+ * @brief Sends the oldest queued transfer
+ */
+static void QueuePop(void){
+	queued_transfer_t *t = &queue[queue_out % MOCK_LCD_QUEUE];
+	Transfer(t->tx_buffer != NULL ? t->tx_buffer : t->tx_data, t->size, t->param_p);
+	queue_out++;
+}
+/*==================[external functions definition]==========================*/
+void MockLcdInit(gpio_t dc){
+	dc_pin = dc;
+	dc_level = false;
+	spi_ready = false;
+	pre_func = NULL;
+	cmd = NO_COMMAND;
+	madctl = 0;
+	col_start = row_start = 0;
+	col_end = MOCK_LCD_COLUMNS - 1;
+	row_end = MOCK_LCD_ROWS - 1;
+	memset(mock_lcd_mem, 0, sizeof(mock_lcd_mem));
+	/* Transfers left by a previous test are dropped, the numbers given to the driver go on */
+	queue_out = queue_in;
+	MockLcdClearStats();
+}
+
+void MockLcdClearStats(void){
+	memset(&mock_lcd_stats, 0, sizeof(mock_lcd_stats));
+}
+
+uint32_t MockLcdPending(void){
+	return queue_in - queue_out;
+}
+
+uint16_t MockLcdPixel(uint16_t x, uint16_t y){
+	uint16_t *cell = MemCell(x, y);
+	return cell != NULL ? *cell : 0;
+}
+
+uint8_t SpiInit(spi_mcu_config_t *spi){
+	mock_lcd_stats.inits++;
+	spi_ready = true;
+	pre_func = spi->pre_func_p;
+	return true;
+}
+
+void SpiRead(spi_dev_t device, uint8_t *rx_buffer, uint32_t rx_buffer_size){
+	memset(rx_buffer, 0, rx_buffer_size);
+}
+
+void SpiWrite(spi_dev_t device, uint8_t *tx_buffer, uint32_t tx_buffer_size){
+	if(MockLcdPending() != 0){
+		mock_lcd_stats.errors++;
+	}
+	Transfer(tx_buffer, tx_buffer_size, NULL);
+}
+
+uint32_t SpiQueueWrite(spi_dev_t device, spi_mcu_transfer_t *transfers, uint32_t count){
+	for(uint32_t i = 0; i < count; i++){
+		if(transfers[i].size == 0){
+			continue;
+		}
+		if(MockLcdPending() == MOCK_LCD_QUEUE){
+			QueuePop();
+		}
+		queued_transfer_t *t = &queue[queue_in % MOCK_LCD_QUEUE];
+		t->size = transfers[i].size;
+		t->param_p = transfers[i].param_p;
+		if(t->size <= sizeof(t->tx_data)){
+			memcpy(t->tx_data, transfers[i].tx_buffer, t->size);
+			t->tx_buffer = NULL;
+		}
+		else{
+			t->tx_buffer = transfers[i].tx_buffer;
+		}
+		queue_in++;
+		mock_lcd_stats.queued++;
+	}
+	return queue_in;
+}
+
+void SpiWaitWrite(spi_dev_t device, uint32_t transfer){
+	if(transfer == SPI_QUEUE_LAST){
+		transfer = queue_in;
+	}
+	while((int32_t)(transfer - queue_out) > 0){
+		QueuePop();
+	}
+}
+
+void SpiReadWrite(spi_dev_t device, uint8_t *tx_buffer, uint8_t *rx_buffer, uint32_t buffer_size){
+	Transfer(tx_buffer, buffer_size, NULL);
+	memset(rx_buffer, 0, buffer_size);
+}
+
+uint8_t SpiDeInit(spi_dev_t device){
+	SpiWaitWrite(device, SPI_QUEUE_LAST);
+	spi_ready = false;
+	return true;
+}
+
+void GPIOInit(gpio_t pin, io_t io){
+}
+
+void GPIOOn(gpio_t pin){
+	GPIOState(pin, true);
+}
+
+void GPIOOff(gpio_t pin){
+	GPIOState(pin, false);
+}
+
+void GPIOState(gpio_t pin, bool state){
+	if(pin == dc_pin){
+		dc_level = state;
+	}
+}
+
+void DelaySec(uint16_t sec){
+}
+
+void DelayMs(uint16_t msec){
+}
+
+void DelayUs(uint16_t usec){
+}
+/*==================[end of file]============================================*/
@@ -0,0 +1,75 @@
+#ifndef MOCK_LCD_H
+#define MOCK_LCD_H
+/**
+ * @file mock_lcd.h
+ * @brief SPI, GPIO and delay mock with a model of the ILI9341 panel for host tests of the display driver
+ *
+ * mock_lcd.c replaces spi_mcu.c, gpio_mcu.c and delay_mcu.c: the bytes written to the SPI bus are
+ * decoded as the panel does, with the level of the DC pin at the start of each transfer, and the pixels
+ * land in a model of the frame memory.
+ *
+ * Queued transfers are sent as late as the DMA may send them: when their slot in the queue is needed
+ * again or when they are waited for. A buffer changed before its transfer was waited for shows up as
+ * wrong pixels.
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include "gpio_mcu.h"
+/*==================[macros]=================================================*/
+#define MOCK_LCD_ROWS		320		/*!< Rows of the frame memory */
+#define MOCK_LCD_COLUMNS	240		/*!< Columns of the frame memory */
+#define MOCK_LCD_QUEUE		8		/*!< Transfers queued per device, as in spi_mcu.c */
+/*==================[typedef]================================================*/
+/**
+ * @brief Counters of the SPI traffic
+ */
+typedef struct{
+	uint32_t inits;			/*!< Calls to SpiInit */
+	uint32_t transfers;		/*!< SPI transfers, command or data */
+	uint32_t bytes;			/*!< Bytes written */
+	uint32_t commands;		/*!< Command bytes */
+	uint32_t queued;		/*!< Transfers queued with SpiQueueWrite */
+	uint32_t errors;		/*!< Writes before SpiInit, data with no command or polling writes with queued transfers pending */
+} mock_lcd_stats_t;
+/*==================[external data declaration]==============================*/
+/**
+ * @brief Frame memory of the panel, in memory rows and columns
+ */
+extern uint16_t mock_lcd_mem[MOCK_LCD_ROWS][MOCK_LCD_COLUMNS];
+
+/**
+ * @brief SPI traffic since MockLcdInit()
+ */
+extern mock_lcd_stats_t mock_lcd_stats;
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Clears the panel model and the counters
+ *
+ * @param dc GPIO driven as the data/command pin of the panel
+ */
+void MockLcdInit(gpio_t dc);
+
+/**
+ * @brief Clears the counters of the SPI traffic, the frame memory is kept
+ */
+void MockLcdClearStats(void);
+
+/**
+ * @brief Number of queued transfers not sent yet
+ *
+ * @return uint32_t Transfers pending
+ */
+uint32_t MockLcdPending(void);
+
+/**
+ * @brief Color shown by the panel at a point, with the orientation set by the last memory access control
+ *
+ * @param x Column of the display
+ * @param y Row of the display
+ * @return uint16_t Color of the pixel
+ */
+uint16_t MockLcdPixel(uint16_t x, uint16_t y);
+
+#endif
+/*==================[end of file]============================================*/
@@ -0,0 +1,158 @@
+/**
+ * @file test_heart_rate.c
+ * @brief Host test of the block beat detector and FIR filter against the per sample ones
+ *
+ * The detector does not use the hardware, the tests run on the host:
+ *
+ *     gcc -I../inc test_heart_rate.c ../src/heartRate.c -lm -o test_heart_rate
+ *     ./test_heart_rate
+ *
+ * The exit code is the number of failed checks.
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <math.h>
+#include "heartRate.h"
+/*==================[macros and definitions]=================================*/
+#define PPG_FS          100             /* sample rate of the record, Hz */
+#define PPG_LEN         200000          /* 33 minutes of samples */
+#define PPG_BURST       20000           /* samples of each burst of saturated noise */
+#define FIR_LEN         10000           /* samples of the low pass filter test */
+#define BEATS_MIN       1000            /* beats the record must give */
+#define BLOCK_SIZES     6
+
+#define CHECK(cond, ...) do{ if(!(cond)){ printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); failed++; } }while(0)
+/*==================[internal data definition]===============================*/
+static int failed = 0;
+static int32_t ppg[PPG_LEN];
+static bool beat[PPG_LEN];
+static uint16_t block_beats[PPG_LEN];
+static uint32_t noise_seed;
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Uniform noise, the same on every host
+ *
+ * @param amplitude Peak amplitude
+ * @return int32_t Noise sample
+ */
+static int32_t PpgNoise(int32_t amplitude){
+    noise_seed = noise_seed * 1664525 + 1013904223;
+    return (int32_t)((noise_seed >> 8) % (2 * amplitude + 1)) - amplitude;
+}
+
+/**
+ * @brief Generates an IR record: pulse at 78 bpm with baseline wander and
+ * noise, every other PPG_BURST samples with large noise that saturates the
+ * 16 bit AC signal
+ */
+static void PpgRecord(void){
+    noise_seed = 3;
+    for(int i = 0; i < PPG_LEN; i++){
+        float t = (float)i / PPG_FS;
+        ppg[i] = 50000 + 400 * sinf(2 * M_PI * 1.3f * t) + 150 * sinf(2 * M_PI * 0.1f * t) + PpgNoise(20);
+        if((i / PPG_BURST) % 2){
+            ppg[i] += PpgNoise(15000) + 15000;
+        }
+    }
+}
+
+/**
+ * @brief checkForBeatBlock() detects the same beats as checkForBeatDetector()
+ * for any block size, also mixing both functions on the same detector
+ */
+static void TestBlockVsSample(void){
+    const uint16_t sizes[BLOCK_SIZES] = {1, 7, 25, BEAT_BLOCK_SIZE, 100, 1000};
+    beat_detector_t det;
+    int beats = 0;
+    PpgRecord();
+    beatDetectorInit(&det);
+    for(int i = 0; i < PPG_LEN; i++){
+        beat[i] = checkForBeatDetector(&det, ppg[i]);
+        beats += beat[i];
+    }
+    CHECK(beats >= BEATS_MIN, "only %d beats in the record", beats);
+    for(int mixed = 0; mixed < 2; mixed++){
+        for(int k = 0; k < BLOCK_SIZES; k++){
+            int differ = 0;
+            beatDetectorInit(&det);
+            for(int start = 0; start < PPG_LEN; start += sizes[k]){
+                int len = (PPG_LEN - start < sizes[k]) ? (PPG_LEN - start) : sizes[k];
+                int count;
+                bool detected[1000] = {false};
+                /* One of every three blocks sample by sample */
+                if(mixed && ((start / sizes[k]) % 3 == 0)){
+                    for(int i = 0; i < len; i++){
+                        detected[i] = checkForBeatDetector(&det, ppg[start + i]);
+                    }
+                }
+                else{
+                    count = checkForBeatBlock(&det, &ppg[start], len, block_beats, len);
+                    for(int j = 0; j < count; j++){
+                        detected[block_beats[j]] = true;
+                    }
+                }
+                for(int i = 0; i < len; i++){
+                    differ += detected[i] != beat[start + i];
+                }
+            }
+            printf("Block of %4d%s: %d of %d beats differ\n", sizes[k], mixed ? " mixed" : "", differ, beats);
+            CHECK(differ == 0, "block of %d%s: %d samples differ", sizes[k], mixed ? " mixed" : "", differ);
+        }
+    }
+}
+
+/**
+ * @brief checkForBeatBlock() writes up to max_beats beats but keeps detecting
+ * over the whole block
+ */
+static void TestMaxBeats(void){
+    beat_detector_t det;
+    uint16_t beats[2];
+    int first = 0, second = 0;
+    beatDetectorInit(&det);
+    for(int i = 0; i < PPG_BURST; i++){
+        bool detected = checkForBeatDetector(&det, ppg[i]);
+        first += detected && (i < PPG_BURST / 2);
+        second += detected && (i >= PPG_BURST / 2);
+    }
+    beatDetectorInit(&det);
+    int count = checkForBeatBlock(&det, ppg, PPG_BURST / 2, beats, 2);
+    CHECK(first > 2, "only %d beats", first);
+    CHECK(count == 2, "%d beats with max_beats 2", count);
+    count = checkForBeatBlock(&det, &ppg[PPG_BURST / 2], PPG_BURST / 2, block_beats, PPG_BURST / 2);
+    CHECK(count == second, "%d beats after the limited block, %d expected", count, second);
+}
+
+/**
+ * @brief lowPassFIRFilterBlock() gives the output of lowPassFIRFilter(),
+ * including full scale inputs
+ */
+static void TestFIRBlock(void){
+    static int16_t din[BEAT_FIR_HISTORY + FIR_LEN], dout[FIR_LEN];
+    int differ = 0;
+    noise_seed = 7;
+    for(int i = 0; i < BEAT_FIR_HISTORY; i++){
+        din[i] = 0;
+    }
+    for(int i = 0; i < FIR_LEN; i++){
+        din[BEAT_FIR_HISTORY + i] = (i / 1000) % 2 ? PpgNoise(32767) : 2000 * sinf(2 * M_PI * i / 77.0f) + PpgNoise(50);
+    }
+    /* Odd length, the last output out of the loop of two */
+    lowPassFIRFilterBlock(din, dout, FIR_LEN - 1);
+    for(int i = 0; i < FIR_LEN - 1; i++){
+        differ += lowPassFIRFilter(din[BEAT_FIR_HISTORY + i]) != dout[i];
+    }
+    printf("FIR block: %d of %d samples differ\n", differ, FIR_LEN - 1);
+    CHECK(differ == 0, "FIR block: %d samples differ", differ);
+}
+
+/*==================[external functions definition]==========================*/
+int main(void){
+    TestBlockVsSample();
+    TestMaxBeats();
+    TestFIRBlock();
+    printf(failed ? "%d checks failed\n" : "All checks passed\n", failed);
+    return failed;
+}
+/*==================[end of file]============================================*/
@@ -0,0 +1,418 @@
+/**
+ * @file test_ili9341.c
+ * @brief Host tests of the ILI9341 driver on the SPI/GPIO mock of mock_lcd.c
+ *
+ * The SPI bus is replaced by a model of the panel, the tests run on the host:
+ *
+ *     gcc -Ihost -I../inc -I../../microcontroller/inc test_ili9341.c mock_lcd.c ../src/ili9341.c ../src/fonts.c ../src/icons.c -o test_ili9341
+ *     ./test_ili9341
+ *
+ * The exit code is the number of failed checks.
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <string.h>
+#include "ili9341.h"
+#include "mock_lcd.h"
+/*==================[macros and definitions]=================================*/
+#define LCD_DC          GPIO_9
+#define LCD_RST         GPIO_18
+#define PICTURE_WIDTH   120
+#define PICTURE_HEIGHT  80             /* 19200 bytes, 10 bursts */
+#define FB_X            20
+#define FB_Y            40
+#define FB_WIDTH        100
+#define FB_HEIGHT       60
+#define GLYPH_CACHE_SIZE 16384          /* 4 font_89 digits */
+
+#define CHECK(cond, ...) do{ if(!(cond)){ printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); failed++; } }while(0)
+/*==================[internal data definition]===============================*/
+static int failed = 0;
+static uint16_t reference[MOCK_LCD_ROWS][MOCK_LCD_COLUMNS];
+static uint8_t picture[PICTURE_WIDTH * PICTURE_HEIGHT * 2];
+static uint16_t fb_pixels[FB_WIDTH * FB_HEIGHT];
+static uint16_t glyph_pixels[GLYPH_CACHE_SIZE];
+static bool int_reference;
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Initializes the driver on a cleared panel model
+ */
+static void LcdStart(void){
+    MockLcdInit(LCD_DC);
+    ILI9341Init(SPI_1, LCD_DC, LCD_RST);
+}
+
+/**
+ * @brief Number of points of the display that differ from a color in an area
+ */
+static uint32_t AreaDiff(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
+    uint32_t diff = 0;
+    for(uint16_t y = y0; y <= y1; y++){
+        for(uint16_t x = x0; x <= x1; x++){
+            diff += MockLcdPixel(x, y) != color;
+        }
+    }
+    return diff;
+}
+
+/**
+ * @brief The LCD is added to the SPI bus once and the screen starts white
+ */
+static void TestInit(void){
+    LcdStart();
+    CHECK(mock_lcd_stats.inits == 1, "SpiInit called %lu times by ILI9341Init", (unsigned long)mock_lcd_stats.inits);
+    CHECK(mock_lcd_stats.errors == 0, "%lu protocol errors", (unsigned long)mock_lcd_stats.errors);
+    CHECK(AreaDiff(0, 0, ILI9341_WIDTH - 1, ILI9341_HEIGHT - 1, ILI9341_WHITE) == 0, "screen not white after init");
+    ILI9341DrawPixel(10, 10, ILI9341_RED);
+    ILI9341DrawLine(0, 0, 100, 37, ILI9341_BLUE);
+    ILI9341DrawString(20, 100, "Hola", &font_22, ILI9341_BLACK, ILI9341_WHITE);
+    CHECK(mock_lcd_stats.inits == 1, "SpiInit called again while drawing");
+}
+
+/**
+ * @brief A pixel lands on its point in every orientation, and a pixel in the
+ * same place sends only the memory write and the color
+ */
+static void TestPixel(void){
+    static const ili9341_orientation_t orientations[] = {ILI9341_Portrait_1, ILI9341_Portrait_2, ILI9341_Landscape_1, ILI9341_Landscape_2};
+    LcdStart();
+    for(int i = 0; i < 4; i++){
+        uint16_t width = i < 2 ? ILI9341_WIDTH : ILI9341_HEIGHT;
+        uint16_t height = i < 2 ? ILI9341_HEIGHT : ILI9341_WIDTH;
+        ILI9341Rotate(orientations[i]);
+        ILI9341Fill(ILI9341_WHITE);
+        ILI9341DrawPixel(3, 5, ILI9341_RED);
+        ILI9341DrawPixel(width - 1, height - 1, ILI9341_BLUE);
+        ILI9341Flush();
+        CHECK(MockLcdPixel(3, 5) == ILI9341_RED, "orientation %d: pixel not at (3, 5)", i);
+        CHECK(MockLcdPixel(width - 1, height - 1) == ILI9341_BLUE, "orientation %d: pixel not at the last corner", i);
+        CHECK(AreaDiff(0, 0, width - 1, height - 1, ILI9341_WHITE) == 2, "orientation %d: pixels drawn elsewhere", i);
+    }
+    /* Areas that share the end row or column */
+    ILI9341DrawLine(50, 10, 50, 20, ILI9341_BLUE);
+    ILI9341DrawPixel(60, 20, ILI9341_RED);
+    ILI9341DrawLine(70, 30, 90, 30, ILI9341_BLUE);
+    ILI9341DrawPixel(90, 40, ILI9341_RED);
+    ILI9341Flush();
+    CHECK(AreaDiff(50, 10, 50, 20, ILI9341_BLUE) == 0 && AreaDiff(70, 30, 90, 30, ILI9341_BLUE) == 0, "lines not drawn");
+    CHECK(MockLcdPixel(60, 20) == ILI9341_RED && MockLcdPixel(90, 40) == ILI9341_RED, "pixels after lines not drawn");
+    MockLcdClearStats();
+    ILI9341DrawPixel(3, 5, ILI9341_GREEN);
+    ILI9341DrawPixel(3, 5, ILI9341_RED);
+    ILI9341Flush();
+    CHECK(mock_lcd_stats.bytes == 13 + 3, "pixels took %lu bytes, the area of the second one was sent again", (unsigned long)mock_lcd_stats.bytes);
+    CHECK(MockLcdPixel(3, 5) == ILI9341_RED, "last pixel lost");
+}
+
+/**
+ * @brief A filled rectangle gives the frame memory of the same pixels drawn one
+ * by one, in bursts
+ */
+static void TestFilledRectangle(void){
+    LcdStart();
+    for(uint16_t y = 40; y <= 199; y++){
+        for(uint16_t x = 7; x <= 230; x++){
+            ILI9341DrawPixel(x, y, ILI9341_CYAN);
+        }
+    }
+    ILI9341Flush();
+    memcpy(reference, mock_lcd_mem, sizeof(reference));
+    LcdStart();
+    MockLcdClearStats();
+    ILI9341DrawFilledRectangle(230, 199, 7, 40, ILI9341_CYAN);
+    ILI9341Flush();
+    CHECK(memcmp(reference, mock_lcd_mem, sizeof(reference)) == 0, "filled rectangle differs from its pixels");
+    CHECK(mock_lcd_stats.transfers <= 6 + 224 * 160 * 2 / 2048 + 1, "filled rectangle took %lu transfers", (unsigned long)mock_lcd_stats.transfers);
+}
+
+/**
+ * @brief Text is drawn with the bitmaps of the font, one pixel of space between
+ * characters
+ */
+static void TestString(void){
+    const char *str = "Hola 123";
+    uint16_t x0 = 12, y0 = 30, x = x0;
+    LcdStart();
+    ILI9341DrawString(x0, y0, (char *)str, &font_22, ILI9341_BLACK, ILI9341_YELLOW);
+    ILI9341Flush();
+    CHECK(mock_lcd_stats.errors == 0, "%lu protocol errors", (unsigned long)mock_lcd_stats.errors);
+    for(const char *c = str; *c != '\0'; c++){
+        char_info_t *info = &font_22.info[*c - ' '];
+        uint32_t diff = 0;
+        for(uint16_t i = 0; i < font_22.font_height; i++){
+            const uint8_t *row = &font_22.data[info->offset + i * ((info->width + 7) / 8)];
+            for(uint16_t j = 0; j < info->width; j++){
+                uint16_t color = row[j / 8] & (0x80 >> (j % 8)) ? ILI9341_BLACK : ILI9341_YELLOW;
+                diff += MockLcdPixel(x + j, y0 + i) != color;
+            }
+        }
+        CHECK(diff == 0, "'%c': %lu pixels differ from the font", *c, (unsigned long)diff);
+        x += info->width + 1;
+    }
+}
+
+/**
+ * @brief Drawing returns with its transfers queued, and the bursts of a
+ * picture, text and fills alternate between buffers without changing one
+ * before the DMA sent it
+ */
+static void TestQueue(void){
+    uint32_t seed = 1, diff = 0;
+    uint16_t width, height;
+    for(uint32_t i = 0; i < sizeof(picture); i++){
+        seed = seed * 1664525 + 1013904223;
+        picture[i] = seed >> 24;
+    }
+    LcdStart();
+    ILI9341DrawFilledRectangle(0, 0, 239, 99, ILI9341_GREEN);
+    ILI9341DrawPicture(10, 20, PICTURE_WIDTH, PICTURE_HEIGHT, picture);
+    CHECK(MockLcdPending() > 0, "picture sent before returning, no transfer queued");
+    ILI9341DrawString(0, 120, "0123", &font_89, ILI9341_RED, ILI9341_BLACK);
+    ILI9341DrawFilledRectangle(200, 0, 239, 99, ILI9341_BLUE);
+    ILI9341Flush();
+    CHECK(MockLcdPending() == 0, "%lu transfers pending after ILI9341Flush", (unsigned long)MockLcdPending());
+    CHECK(ILI9341BytesSent() == mock_lcd_stats.bytes, "ILI9341BytesSent gives %lu bytes, %lu sent", (unsigned long)ILI9341BytesSent(), (unsigned long)mock_lcd_stats.bytes);
+    CHECK(mock_lcd_stats.errors == 0, "%lu protocol errors", (unsigned long)mock_lcd_stats.errors);
+    for(uint16_t y = 0; y < PICTURE_HEIGHT; y++){
+        for(uint16_t x = 0; x < PICTURE_WIDTH; x++){
+            uint16_t color = picture[2 * (y * PICTURE_WIDTH + x)] << 8 | picture[2 * (y * PICTURE_WIDTH + x) + 1];
+            diff += MockLcdPixel(10 + x, 20 + y) != color;
+        }
+    }
+    CHECK(diff == 0, "%lu pixels of the picture changed before they were sent", (unsigned long)diff);
+    CHECK(AreaDiff(0, 0, 199, 19, ILI9341_GREEN) == 0, "first fill changed");
+    CHECK(AreaDiff(200, 0, 239, 99, ILI9341_BLUE) == 0, "last fill not drawn");
+    memcpy(reference, mock_lcd_mem, sizeof(reference));
+    /* The same scene flushed after each drawing */
+    MockLcdInit(LCD_DC);
+    ILI9341Init(SPI_1, LCD_DC, LCD_RST);
+    ILI9341DrawFilledRectangle(0, 0, 239, 99, ILI9341_GREEN);
+    ILI9341Flush();
+    ILI9341DrawPicture(10, 20, PICTURE_WIDTH, PICTURE_HEIGHT, picture);
+    ILI9341Flush();
+    /* Text lines are drawn in one area, with background between characters but
+     * not after the last one */
+    ILI9341GetStringSize("0123", &font_89, &width, &height);
+    ILI9341DrawFilledRectangle(0, 120, width - 2, 120 + height - 1, ILI9341_BLACK);
+    for(uint16_t x = 0, c = '0'; c <= '3'; x += font_89.info[c - ' '].width + 1, c++){
+        ILI9341DrawChar(x, 120, c, &font_89, ILI9341_RED, ILI9341_BLACK);
+        ILI9341Flush();
+    }
+    ILI9341DrawFilledRectangle(200, 0, 239, 99, ILI9341_BLUE);
+    ILI9341Flush();
+    CHECK(memcmp(reference, mock_lcd_mem, sizeof(reference)) == 0, "queued drawing differs from drawing flushed at each step");
+}
+
+/**
+ * @brief Draws the scene of TestFramebuffer: inside, across the border and
+ * outside the framebuffer area
+ */
+static void FramebufferScene(void){
+    ILI9341DrawFilledRectangle(30, 50, 40, 60, ILI9341_RED);
+    ILI9341DrawPixel(41, 50, ILI9341_RED);
+    ILI9341DrawPixel(60, 90, ILI9341_BLUE);
+    ILI9341DrawChar(70, 45, 'H', &font_22, ILI9341_YELLOW, ILI9341_BLACK);
+    ILI9341DrawFilledRectangle(110, 70, 130, 80, ILI9341_MAGENTA);
+    ILI9341DrawFilledRectangle(150, 200, 160, 210, ILI9341_GREEN);
+}
+
+/**
+ * @brief Drawing inside a framebuffer stays in RAM until the flush, which
+ * sends only the dirty areas and gives the panel drawn directly
+ */
+static void TestFramebuffer(void){
+    ili9341_framebuffer_t fb = {
+        .x = FB_X,
+        .y = FB_Y,
+        .width = FB_WIDTH,
+        .height = FB_HEIGHT,
+        .pixels = fb_pixels,
+        .back_color = ILI9341_BLACK
+    };
+    uint32_t area_bytes = 0;
+    uint8_t n_dirty;
+    /* Reference drawn on the panel */
+    LcdStart();
+    ILI9341DrawFilledRectangle(FB_X, FB_Y, FB_X + FB_WIDTH - 1, FB_Y + FB_HEIGHT - 1, ILI9341_BLACK);
+    FramebufferScene();
+    ILI9341Flush();
+    memcpy(reference, mock_lcd_mem, sizeof(reference));
+
+    LcdStart();
+    ILI9341FramebufferInit(&fb);
+    ILI9341FramebufferSelect(&fb);
+    ILI9341FramebufferFlush();
+    ILI9341Flush();
+    CHECK(AreaDiff(FB_X, FB_Y, FB_X + FB_WIDTH - 1, FB_Y + FB_HEIGHT - 1, ILI9341_BLACK) == 0, "first flush did not send the background");
+    CHECK(fb.n_dirty == 0, "%d dirty areas after flush", fb.n_dirty);
+    FramebufferScene();
+    ILI9341Flush();
+    CHECK(MockLcdPixel(30, 50) == ILI9341_BLACK && MockLcdPixel(60, 90) == ILI9341_BLACK, "drawing inside the framebuffer sent before the flush");
+    CHECK(MockLcdPixel(150, 200) == ILI9341_GREEN, "drawing outside the framebuffer not sent");
+    CHECK(AreaDiff(110, 70, 130, 80, ILI9341_MAGENTA) == 0, "drawing across the framebuffer border not sent");
+    /* The rectangle and its next pixel share an area, the far pixel and the
+     * character have their own, drawing across the border is not dirty */
+    CHECK(fb.n_dirty == 3, "%d dirty areas, 3 expected", fb.n_dirty);
+    for(uint8_t i = 0; i < fb.n_dirty; i++){
+        area_bytes += 2 * (fb.dirty[i].x1 - fb.dirty[i].x0 + 1) * (fb.dirty[i].y1 - fb.dirty[i].y0 + 1);
+    }
+    CHECK(area_bytes == 2 * (12 * 11 + 1 + font_22.info['H' - ' '].width * font_22.font_height), "dirty areas cover %lu bytes", (unsigned long)area_bytes);
+    /* One address window and memory write per area */
+    n_dirty = fb.n_dirty;
+    MockLcdClearStats();
+    ILI9341FramebufferFlush();
+    ILI9341Flush();
+    CHECK(mock_lcd_stats.bytes == area_bytes + 11 * n_dirty, "flush sent %lu bytes for %lu bytes of dirty areas", (unsigned long)mock_lcd_stats.bytes, (unsigned long)area_bytes);
+    CHECK(memcmp(reference, mock_lcd_mem, sizeof(reference)) == 0, "framebuffer flush differs from drawing on the panel");
+    for(uint16_t y = 0; y < FB_HEIGHT; y++){
+        for(uint16_t x = 0; x < FB_WIDTH; x++){
+            uint16_t color = fb_pixels[y * FB_WIDTH + x];
+            CHECK(MockLcdPixel(FB_X + x, FB_Y + y) == (uint16_t)(color << 8 | color >> 8), "framebuffer and panel differ at (%d, %d)", FB_X + x, FB_Y + y);
+        }
+    }
+    MockLcdClearStats();
+    ILI9341FramebufferFlush();
+    ILI9341Flush();
+    CHECK(mock_lcd_stats.bytes == 0, "second flush sent %lu bytes", (unsigned long)mock_lcd_stats.bytes);
+    ILI9341FramebufferSelect(NULL);
+}
+
+/**
+ * @brief Draws the scene of TestGlyphCache: characters drawn again, with other
+ * colors and with another font
+ */
+static void GlyphScene(void){
+    ILI9341DrawString(0, 0, "072", &font_89, ILI9341_RED, ILI9341_WHITE);
+    ILI9341DrawString(0, 100, "071", &font_89, ILI9341_RED, ILI9341_WHITE);
+    ILI9341DrawString(0, 200, "072", &font_89, ILI9341_BLUE, ILI9341_BLACK);
+    ILI9341DrawString(0, 295, "Hola 072", &font_22, ILI9341_BLACK, ILI9341_YELLOW);
+}
+
+/**
+ * @brief Text drawn through the glyph cache, big enough, too small or not
+ * aligned, gives the pixels of text drawn without it
+ */
+static void TestGlyphCache(void){
+    static const struct{
+        uint16_t offset;
+        uint32_t size;
+    } caches[] = {{0, GLYPH_CACHE_SIZE}, {1, GLYPH_CACHE_SIZE - 1}, {0, 4000}, {0, 100}};
+    uint32_t used;
+    LcdStart();
+    ILI9341GlyphCacheInit(NULL, 0);
+    GlyphScene();
+    ILI9341Flush();
+    memcpy(reference, mock_lcd_mem, sizeof(reference));
+    for(uint8_t i = 0; i < sizeof(caches) / sizeof(caches[0]); i++){
+        memset(glyph_pixels, 0, sizeof(glyph_pixels));
+        LcdStart();
+        ILI9341GlyphCacheInit(&glyph_pixels[caches[i].offset], caches[i].size);
+        GlyphScene();
+        ILI9341Flush();
+        CHECK(memcmp(reference, mock_lcd_mem, sizeof(reference)) == 0, "cache %d: text differs from text drawn without cache", i);
+        used = 0;
+        for(uint32_t p = 0; p < GLYPH_CACHE_SIZE; p++){
+            used += glyph_pixels[p] != 0;
+            CHECK(glyph_pixels[p] == 0 || (p >= caches[i].offset && p < caches[i].offset + caches[i].size), "cache %d: pixel %lu written out of the buffer", i, (unsigned long)p);
+        }
+        CHECK(caches[i].size < 1000 || used > 0, "cache %d: no glyph cached", i);
+    }
+    ILI9341GlyphCacheInit(NULL, 0);
+}
+
+/**
+ * @brief Draws an integer of 3 digits, forgetting the ones drawn before for
+ * the reference
+ */
+static void Int(uint16_t x, uint16_t y, uint32_t num){
+    if(int_reference){
+        ILI9341DrawIntInvalidate();
+    }
+    ILI9341DrawInt(x, y, num, 3, &font_22, ILI9341_BLACK, ILI9341_WHITE);
+}
+
+/**
+ * @brief Draws the scene of TestDrawInt: integers drawn over by other
+ * primitives and by other integers
+ */
+static void IntScene(void){
+    ILI9341Fill(ILI9341_WHITE);
+    Int(10, 10, 123);
+    Int(10, 50, 456);
+    Int(10, 90, 111);
+    ILI9341DrawFilledRectangle(15, 12, 30, 20, ILI9341_RED);
+    Int(10, 10, 124);
+    Int(10, 50, 457);
+    ILI9341DrawString(12, 52, "88", &font_22, ILI9341_BLUE, ILI9341_WHITE);
+    Int(10, 50, 458);
+    ILI9341DrawPicture(14, 92, 20, 20, picture);
+    Int(10, 90, 112);
+    ILI9341DrawLine(0, 0, 100, 100, ILI9341_GREEN);
+    Int(10, 10, 125);
+    Int(10, 130, 999);
+    Int(20, 130, 0);
+    Int(10, 130, 998);
+}
+
+/**
+ * @brief Integers drawn again send only the digits that change, and they are
+ * drawn whole after something is drawn over them. A framebuffer flush keeps
+ * the digits in the framebuffer.
+ */
+static void TestDrawInt(void){
+    ili9341_framebuffer_t fb = {
+        .x = FB_X,
+        .y = FB_Y,
+        .width = FB_WIDTH,
+        .height = FB_HEIGHT,
+        .pixels = fb_pixels,
+        .back_color = ILI9341_WHITE
+    };
+    uint32_t bytes;
+    uint16_t width_kept, width_whole;
+    int_reference = true;
+    LcdStart();
+    IntScene();
+    ILI9341Flush();
+    bytes = mock_lcd_stats.bytes;
+    memcpy(reference, mock_lcd_mem, sizeof(reference));
+    int_reference = false;
+    LcdStart();
+    IntScene();
+    ILI9341Flush();
+    CHECK(memcmp(reference, mock_lcd_mem, sizeof(reference)) == 0, "integers drawn over differ from integers drawn whole");
+    CHECK(mock_lcd_stats.bytes < bytes, "%lu bytes remembering the digits, %lu drawing them whole", (unsigned long)mock_lcd_stats.bytes, (unsigned long)bytes);
+
+    LcdStart();
+    ILI9341FramebufferInit(&fb);
+    ILI9341FramebufferSelect(&fb);
+    Int(FB_X + 5, FB_Y + 5, 321);
+    ILI9341FramebufferFlush();
+    Int(FB_X + 5, FB_Y + 5, 322);
+    CHECK(fb.n_dirty == 1, "%d dirty areas", fb.n_dirty);
+    width_kept = fb.dirty[0].x1 - fb.dirty[0].x0 + 1;
+    ILI9341FramebufferFlush();
+    ILI9341FramebufferInit(&fb);
+    ILI9341FramebufferFlush();
+    Int(FB_X + 5, FB_Y + 5, 322);
+    CHECK(fb.n_dirty == 1, "%d dirty areas", fb.n_dirty);
+    width_whole = fb.dirty[0].x1 - fb.dirty[0].x0 + 1;
+    CHECK(width_kept < width_whole, "%d columns drawn after a framebuffer flush, %d drawing the integer whole", width_kept, width_whole);
+    ILI9341FramebufferSelect(NULL);
+}
+
+/*==================[external functions definition]==========================*/
+int main(void){
+    TestInit();
+    TestPixel();
+    TestFilledRectangle();
+    TestString();
+    TestQueue();
+    TestFramebuffer();
+    TestGlyphCache();
+    TestDrawInt();
+    printf(failed ? "%d checks failed\n" : "All checks passed\n", failed);
+    return failed;
+}
+/*==================[end of file]============================================*/
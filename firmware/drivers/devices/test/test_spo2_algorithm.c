@@ -0,0 +1,303 @@
+/**
+ * @file test_spo2_algorithm.c
+ * @brief Host tests of the SpO2/HR peak pipeline and of the streaming calculation against the batch one
+ *
+ * The calculation does not use the hardware, the tests run on the host:
+ *
+ *     gcc -I../inc test_spo2_algorithm.c ../src/spo2_algorithm.c -lm -o test_spo2_algorithm
+ *     ./test_spo2_algorithm [capture.txt ...]
+ *
+ * The records are synthetic: there is no recorded MAX3010x capture in the tree yet. Captures logged with
+ * PPG_CAPTURE in examples/ej_max3010x (one "red ir" line per sample at FreqS, other lines are skipped) are
+ * given as arguments and compared the same way.
+ *
+ * The exit code is the number of failed checks.
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "spo2_algorithm.h"
+/*==================[macros and definitions]=================================*/
+#define PPG_RECORDS     6
+#define PPG_LEN         (FreqS * 120)   /* 2 minutes of samples */
+#define PPG_LEN_MAX     (FreqS * 600)   /* longest capture, 10 minutes */
+#define PPG_STEP        FreqS           /* results compared once per second */
+#define HR_TOLERANCE    1.0f            /* mean difference of the heart rate, in steps of HrStep() */
+#define SPO2_TOLERANCE  0.5f            /* mean difference of the SpO2, % */
+#define VALID_MIN       90              /* windows valid in both calculations, % */
+#define PEAK_SETS       2000000         /* random peak sets compared with the reference */
+#define RATIO_SETS      1000000         /* random ratio sets compared with the reference */
+
+#define CHECK(cond, ...) do{ if(!(cond)){ printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); failed++; } }while(0)
+/*==================[internal data definition]===============================*/
+static int failed = 0;
+static uint32_t ir[PPG_LEN_MAX], red[PPG_LEN_MAX];
+static uint32_t noise_seed;
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Uniform noise, the same on every host
+ *
+ * @param amplitude Peak amplitude
+ * @return float Noise sample
+ */
+static float PpgNoise(float amplitude){
+    noise_seed = noise_seed * 1664525 + 1013904223;
+    return amplitude * ((float)(noise_seed >> 8) / (1 << 23) - 1);
+}
+
+/**
+ * @brief Pulse shape: fast systolic rise, slow decay with dicrotic notch
+ *
+ * @param phase Phase of the beat, in beats
+ * @return float Absorption, from 0 to 1
+ */
+static float PpgPulse(float phase){
+    phase -= floorf(phase);
+    if(phase < 0.15f){
+        return 0.5f - 0.5f * cosf(M_PI * phase / 0.15f);
+    }
+    return expf(-(phase - 0.15f) * 3.0f) * (1 + 0.08f * sinf(2 * M_PI * (phase - 0.15f) * 2.5f));
+}
+
+/**
+ * @brief Generates a PPG record with respiratory modulation of the rate,
+ * baseline wander and noise
+ *
+ * @param seed Seed of the noise
+ * @param bpm Mean heart rate
+ * @param ratio Ratio of the red and ir AC/DC, sets the SpO2
+ */
+static void PpgRecord(unsigned int seed, float bpm, float ratio){
+    float phase = 0;
+    noise_seed = seed;
+    for(int i = 0; i < PPG_LEN; i++){
+        float t = (float)i / FreqS;
+        phase += bpm * (1 + 0.05f * sinf(2 * M_PI * 0.2f * t)) / 60 / FreqS;
+        float pulse = PpgPulse(phase);
+        float wander = 300 * sinf(2 * M_PI * 0.1f * t);
+        ir[i] = 120000 + wander - 1500 * pulse + PpgNoise(10);
+        red[i] = 90000 + 0.75f * wander - 1500 * 0.75f * ratio * pulse + PpgNoise(10);
+    }
+}
+
+/**
+ * @brief Change of the heart rate for one sample of the mean valley interval
+ *
+ * The batch calculation gives FreqS * 60 / n, with n the mean valley interval truncated to samples: at
+ * 25 Hz the steps go from 1 bpm at 40 bpm to 11 bpm at 130 bpm, a closer match can not be expected.
+ *
+ * @param hr Heart rate, bpm
+ * @return float Step of the heart rate at hr, bpm
+ */
+static float HrStep(int32_t hr){
+    int32_t n = (FreqS * 60) / hr;
+    return (float)(FreqS * 60) / n - (float)(FreqS * 60) / (n + 1);
+}
+
+/**
+ * @brief Loads a capture, one "red ir" line per sample
+ *
+ * @param path Capture file
+ * @return int Number of samples, 0 if the file can not be read
+ */
+static int PpgCapture(const char *path){
+    char line[128];
+    int len = 0;
+    FILE *file = fopen(path, "r");
+    if(file == NULL){
+        return 0;
+    }
+    while((len < PPG_LEN_MAX) && (fgets(line, sizeof(line), file) != NULL)){
+        unsigned long r, i;
+        if(sscanf(line, "%lu %lu", &r, &i) == 2){
+            red[len] = r;
+            ir[len] = i;
+            len++;
+        }
+    }
+    fclose(file);
+    return len;
+}
+
+/**
+ * @brief Insertion sort in ascending order, as the removed maxim_sort_ascend()
+ */
+static void RefSortAscend(int32_t *pn_x, int32_t n_size){
+    int32_t i, j, n_temp;
+    for(i = 1; i < n_size; i++){
+        n_temp = pn_x[i];
+        for(j = i; j > 0 && n_temp < pn_x[j - 1]; j--){
+            pn_x[j] = pn_x[j - 1];
+        }
+        pn_x[j] = n_temp;
+    }
+}
+
+/**
+ * @brief Insertion sort of indices by descending value, as the removed
+ * maxim_sort_indices_descend()
+ */
+static void RefSortIndicesDescend(int32_t *pn_x, int32_t *pn_indx, int32_t n_size){
+    int32_t i, j, n_temp;
+    for(i = 1; i < n_size; i++){
+        n_temp = pn_indx[i];
+        for(j = i; j > 0 && pn_x[n_temp] > pn_x[pn_indx[j - 1]]; j--){
+            pn_indx[j] = pn_indx[j - 1];
+        }
+        pn_indx[j] = n_temp;
+    }
+}
+
+/**
+ * @brief Reference of maxim_remove_close_peaks(): the original Maxim code,
+ * which removes peaks from large to small with insertion sorts
+ */
+static void RefRemoveClosePeaks(int32_t *pn_locs, int32_t *pn_npks, int32_t *pn_x, int32_t n_min_distance){
+    int32_t i, j, n_old_npks, n_dist;
+    RefSortIndicesDescend(pn_x, pn_locs, *pn_npks);
+    for(i = -1; i < *pn_npks; i++){
+        n_old_npks = *pn_npks;
+        *pn_npks = i + 1;
+        for(j = i + 1; j < n_old_npks; j++){
+            n_dist = pn_locs[j] - (i == -1 ? -1 : pn_locs[i]);
+            if(n_dist > n_min_distance || n_dist < -n_min_distance){
+                pn_locs[(*pn_npks)++] = pn_locs[j];
+            }
+        }
+    }
+    RefSortAscend(pn_locs, *pn_npks);
+}
+
+/**
+ * @brief Reference of maxim_ratio_median(): the original Maxim code, with an
+ * insertion sort
+ */
+static int32_t RefRatioMedian(int32_t *pn_x, int32_t n_size){
+    int32_t n_middle_idx = n_size / 2;
+    RefSortAscend(pn_x, n_size);
+    if(n_middle_idx > 1){
+        return (pn_x[n_middle_idx - 1] + pn_x[n_middle_idx]) / 2;
+    }
+    return pn_x[n_middle_idx];
+}
+
+/**
+ * @brief The peak pipeline without sorts gives the same peaks and medians as
+ * the original code. These are the only changes of the batch calculation, so
+ * its results are the same too.
+ */
+static void TestPeaksVsReference(void){
+    int32_t x[BUFFER_SIZE], locs[15], ref_locs[15], npks, ref_npks;
+    int32_t ratios[STREAM_MAX_RATIOS], ref_ratios[STREAM_MAX_RATIOS];
+    long peaks_diff = 0, median_diff = 0;
+    noise_seed = 1;
+    for(long t = 0; t < PEAK_SETS; t++){
+        /* Heights with many ties in a third of the sets, peaks 1 to 8 samples apart */
+        int32_t distance = 1 + (int32_t)(PpgNoise(4) + 4);
+        int32_t range = t % 3 == 0 ? 3 : 1000;
+        int32_t pos = (int32_t)(PpgNoise(2) + 2);
+        for(int i = 0; i < BUFFER_SIZE; i++){
+            x[i] = (int32_t)(PpgNoise(range / 2.0f) + range / 2.0f);
+        }
+        ref_npks = (int32_t)(PpgNoise(8) + 8);
+        for(int i = 0; i < ref_npks; i++){
+            pos += 1 + (int32_t)(PpgNoise(4) + 4);
+            if(pos >= BUFFER_SIZE){
+                ref_npks = i;
+                break;
+            }
+            ref_locs[i] = pos;
+        }
+        npks = ref_npks;
+        memcpy(locs, ref_locs, sizeof(locs));
+        RefRemoveClosePeaks(ref_locs, &ref_npks, x, distance);
+        maxim_remove_close_peaks(locs, &npks, x, distance);
+        if((npks != ref_npks) || memcmp(locs, ref_locs, npks * sizeof(int32_t))){
+            peaks_diff++;
+        }
+    }
+    for(long t = 0; t < RATIO_SETS; t++){
+        int32_t count = (int32_t)(PpgNoise(3) + 3) % (STREAM_MAX_RATIOS + 1);
+        int32_t range = t & 1 ? 5 : 200;
+        for(int i = 0; i < STREAM_MAX_RATIOS; i++){
+            ratios[i] = ref_ratios[i] = (int32_t)(PpgNoise(range / 2.0f) + range / 2.0f);
+        }
+        if(RefRatioMedian(ref_ratios, count) != maxim_ratio_median(ratios, count)){
+            median_diff++;
+        }
+    }
+    printf("Peaks: %ld of %d sets differ, medians: %ld of %d sets differ\n", peaks_diff, PEAK_SETS, median_diff, RATIO_SETS);
+    CHECK(peaks_diff == 0, "%ld peak sets differ from the reference", peaks_diff);
+    CHECK(median_diff == 0, "%ld medians differ from the reference", median_diff);
+}
+
+/**
+ * @brief The streaming calculation gives the result of the batch calculation
+ * over the last BUFFER_SIZE samples, within the tolerances
+ *
+ * @param name Name of the record
+ * @param len Number of samples in ir and red
+ */
+static void TestStreamVsBatch(const char *name, int len){
+    int windows = 0, hr_count = 0, spo2_count = 0;
+    float hr_diff = 0, hr_steps = 0, spo2_diff = 0;
+    maxim_spo2_stream_t stream;
+    maxim_spo2_stream_init(&stream);
+    for(int i = 0; i < len; i++){
+        int32_t batch_spo2, batch_hr, stream_spo2, stream_hr;
+        int8_t batch_spo2_valid, batch_hr_valid, stream_spo2_valid, stream_hr_valid;
+        maxim_spo2_stream_add(&stream, ir[i], red[i]);
+        if((i < BUFFER_SIZE) || ((i + 1) % PPG_STEP != 0)){
+            continue;
+        }
+        maxim_heart_rate_and_oxygen_saturation(&ir[i + 1 - BUFFER_SIZE], BUFFER_SIZE, &red[i + 1 - BUFFER_SIZE],
+            &batch_spo2, &batch_spo2_valid, &batch_hr, &batch_hr_valid);
+        maxim_spo2_stream_result(&stream, &stream_spo2, &stream_spo2_valid, &stream_hr, &stream_hr_valid);
+        windows++;
+        if(batch_hr_valid && stream_hr_valid){
+            hr_diff += abs(batch_hr - stream_hr);
+            hr_steps += abs(batch_hr - stream_hr) / HrStep(batch_hr);
+            hr_count++;
+        }
+        if(batch_spo2_valid && stream_spo2_valid){
+            spo2_diff += abs(batch_spo2 - stream_spo2);
+            spo2_count++;
+        }
+    }
+    hr_diff /= hr_count > 0 ? hr_count : 1;
+    hr_steps /= hr_count > 0 ? hr_count : 1;
+    spo2_diff /= spo2_count > 0 ? spo2_count : 1;
+    printf("%s: HR valid %d/%d, mean |dHR| %.2f bpm (%.2f steps); SpO2 valid %d/%d, mean |dSpO2| %.2f\n",
+        name, hr_count, windows, hr_diff, hr_steps, spo2_count, windows, spo2_diff);
+    CHECK(windows > 0, "%s: shorter than %d samples", name, BUFFER_SIZE + PPG_STEP);
+    CHECK(hr_count * 100 >= windows * VALID_MIN, "%s: HR valid in %d of %d windows", name, hr_count, windows);
+    CHECK(spo2_count * 100 >= windows * VALID_MIN, "%s: SpO2 valid in %d of %d windows", name, spo2_count, windows);
+    CHECK(hr_steps <= HR_TOLERANCE, "%s: mean |dHR| %.2f steps", name, hr_steps);
+    CHECK(spo2_diff <= SPO2_TOLERANCE, "%s: mean |dSpO2| %.2f", name, spo2_diff);
+}
+
+/*==================[external functions definition]==========================*/
+int main(int argc, char *argv[]){
+    TestPeaksVsReference();
+    for(int rec = 0; rec < PPG_RECORDS; rec++){
+        char name[32];
+        float bpm = 55 + 15 * rec;
+        float ratio = 0.45f + 0.07f * rec;
+        PpgRecord(rec + 1, bpm, ratio);
+        snprintf(name, sizeof(name), "%3.0f bpm, ratio %.2f", bpm, ratio);
+        TestStreamVsBatch(name, PPG_LEN);
+    }
+    for(int arg = 1; arg < argc; arg++){
+        int len = PpgCapture(argv[arg]);
+        CHECK(len > 0, "%s: no samples", argv[arg]);
+        if(len > 0){
+            TestStreamVsBatch(argv[arg], len);
+        }
+    }
+    printf(failed ? "%d checks failed\n" : "All checks passed\n", failed);
+    return failed;
+}
+/*==================[end of file]============================================*/
@@ -0,0 +1,156 @@
+/**
+ * @file test_vumeter.c
+ * @brief Host tests of the vumeter of the audio player example on the SPI/GPIO mock of mock_lcd.c
+ *
+ * The vumeter draws only the steps that change. Its frames are compared with
+ * the same bars drawn from scratch:
+ *
+ *     gcc -Ihost -I../inc -I../../microcontroller/inc -I../../../examples/ej_lcdcolor_audioplayer/main test_vumeter.c mock_lcd.c ../src/ili9341.c ../src/fonts.c ../src/icons.c ../../../examples/ej_lcdcolor_audioplayer/main/vumeter.c -o test_vumeter
+ *     ./test_vumeter
+ *
+ * The exit code is the number of failed checks.
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <string.h>
+#include "ili9341.h"
+#include "vumeter.h"
+#include "mock_lcd.h"
+/*==================[macros and definitions]=================================*/
+#define LCD_DC          GPIO_9
+#define LCD_RST         GPIO_18
+#define BARS            16
+#define FRAMES          60
+#define BACK_COLOR      0x0884
+#define STEP_DIST       7               /* as in vumeter.c */
+
+#define CHECK(cond, ...) do{ if(!(cond)){ printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); failed++; } }while(0)
+/*==================[internal data definition]===============================*/
+static int failed = 0;
+static uint16_t screen[MOCK_LCD_ROWS][MOCK_LCD_COLUMNS];
+static uint8_t values[FRAMES][BARS];
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Initializes the driver on a cleared panel model
+ */
+static void LcdStart(void){
+    MockLcdInit(LCD_DC);
+    ILI9341Init(SPI_1, LCD_DC, LCD_RST);
+}
+
+/**
+ * @brief Vumeter of 16 bars of 200x100 pixels, as the one of the audio player
+ */
+static vumeter_t Vumeter(uint8_t peak_hold, uint8_t decay){
+    vumeter_t vum = {
+        .x_pos = 20,
+        .y_pos = 120,
+        .width = 200,
+        .height = 100,
+        .n_bars = BARS,
+        .step_color_1 = ILI9341_GREEN,
+        .step_color_2 = ILI9341_YELLOW,
+        .step_color_3 = ILI9341_ORANGE,
+        .step_color_4 = ILI9341_RED,
+        .back_color = BACK_COLOR,
+        .peak_hold = peak_hold,
+        .decay = decay
+    };
+    return vum;
+}
+
+/**
+ * @brief Steps of a bar shown on the panel, as a mask from the bottom one
+ */
+static uint32_t StepsShown(vumeter_t *vum, uint8_t bar){
+    uint16_t x = vum->x_pos + bar * (vum->width / vum->n_bars) + 2;
+    uint32_t mask = 0;
+    for(uint8_t j = 0; STEP_DIST * (j + 1) <= vum->height; j++){
+        if(MockLcdPixel(x, vum->y_pos + vum->height - STEP_DIST * j - 2) != vum->back_color){
+            mask |= 1UL << j;
+        }
+    }
+    return mask;
+}
+
+/**
+ * @brief Each frame drawn over the previous one gives the bars drawn from
+ * scratch, with fewer bytes
+ */
+static void TestDelta(void){
+    vumeter_t vum = Vumeter(0, 0);
+    uint32_t seed = 1, bytes_delta = 0, bytes_full = 0, diff;
+    for(uint8_t f = 0; f < FRAMES; f++){
+        for(uint8_t i = 0; i < BARS; i++){
+            seed = seed * 1664525 + 1013904223;
+            /* Half of the frames change little, as music does */
+            values[f][i] = f > 0 && (f & 1) ? values[f - 1][i] + (int8_t)(seed >> 28) : seed >> 24;
+        }
+    }
+    for(uint8_t f = 0; f < FRAMES; f++){
+        /* Bars drawn from scratch */
+        LcdStart();
+        VumeterInit(&vum);
+        MockLcdClearStats();
+        VumeterUpdate(&vum, values[f]);
+        ILI9341Flush();
+        bytes_full += mock_lcd_stats.bytes;
+        memcpy(screen, mock_lcd_mem, sizeof(screen));
+        /* Frames drawn one over the other */
+        LcdStart();
+        VumeterInit(&vum);
+        for(uint8_t g = 0; g < f; g++){
+            VumeterUpdate(&vum, values[g]);
+        }
+        MockLcdClearStats();
+        VumeterUpdate(&vum, values[f]);
+        ILI9341Flush();
+        bytes_delta += mock_lcd_stats.bytes;
+        diff = 0;
+        for(uint16_t y = 0; y < MOCK_LCD_ROWS; y++){
+            for(uint16_t x = 0; x < MOCK_LCD_COLUMNS; x++){
+                diff += screen[y][x] != mock_lcd_mem[y][x];
+            }
+        }
+        CHECK(diff == 0, "frame %d: %lu pixels differ from the bars drawn from scratch", f, (unsigned long)diff);
+        CHECK(mock_lcd_stats.errors == 0, "frame %d: %lu protocol errors", f, (unsigned long)mock_lcd_stats.errors);
+    }
+    CHECK(bytes_delta < bytes_full / 2, "%lu bytes drawing the changes, %lu drawing the bars", (unsigned long)bytes_delta, (unsigned long)bytes_full);
+}
+
+/**
+ * @brief A bar falls decay steps per frame and its peak is held peak_hold
+ * frames, then falls one step per frame
+ */
+static void TestPeakDecay(void){
+    vumeter_t vum = Vumeter(2, 1);
+    /* 180 gives 10 steps of 7 pixels in 100 */
+    uint8_t high[BARS] = {180}, low[BARS] = {0};
+    static const struct{
+        uint8_t bar;
+        uint8_t peak;
+    } expected[] = {{10, 10}, {9, 10}, {8, 10}, {7, 9}, {6, 8}, {5, 7}, {4, 6}, {3, 5}, {2, 4}, {1, 3}, {0, 2}, {0, 1}, {0, 0}};
+    uint32_t mask;
+    LcdStart();
+    VumeterInit(&vum);
+    for(uint8_t f = 0; f < sizeof(expected) / sizeof(expected[0]); f++){
+        VumeterUpdate(&vum, f == 0 ? high : low);
+        ILI9341Flush();
+        mask = (1UL << expected[f].bar) - 1;
+        if(expected[f].peak > 0){
+            mask |= 1UL << (expected[f].peak - 1);
+        }
+        CHECK(StepsShown(&vum, 0) == mask, "frame %d: steps 0x%lx shown, 0x%lx expected", f, (unsigned long)StepsShown(&vum, 0), (unsigned long)mask);
+        CHECK(StepsShown(&vum, 1) == 0, "frame %d: steps shown on an empty bar", f);
+    }
+}
+
+/*==================[external functions definition]==========================*/
+int main(void){
+    TestDelta();
+    TestPeakDecay();
+    printf(failed ? "%d checks failed\n" : "All checks passed\n", failed);
+    return failed;
+}
+/*==================[end of file]============================================*/
@@ -0,0 +1,152 @@
+# -*- coding: utf-8 -*-
+"""
+Fuentes suavizadas (anti-aliasing) para el driver ILI9341.
+
+Dibuja los caracteres de una fuente TrueType/OpenType con Pillow y genera un
+.c y un .h con los glifos en 2 o 4 bits por pixel (FONT_2BPP / FONT_4BPP):
+cada pixel guarda cuánto lo cubre el caracter, de 0 (fondo) al máximo (color
+del caracter). Las filas se completan hasta el byte y el primer pixel va en los
+bits más significativos. El driver convierte cada nivel en un color con una
+tabla calculada para el color de caracter y de fondo, por lo que dibujar sigue
+siendo una búsqueda en tabla por pixel.
+
+Los glifos se recortan a lo ancho como los de fonts.c (el driver agrega una
+columna de fondo entre caracteres). Se usa el mayor tamaño de la fuente cuyos
+caracteres entran en la altura pedida; las filas que sobran se reparten arriba
+y abajo. Los caracteres que no están en el subconjunto quedan con ancho 0 y no
+se dibujan.
+
+Uso:
+    python font_aa.py DejaVuSans-Bold.ttf -o ecg_fonts -s font_89_aa=89:0123456789
+    python font_aa.py DejaVuSans.ttf -o ui_fonts -b 2 -s font_22_aa=22 -s font_30_aa=30
+
+Cada -s es NOMBRE=ALTURA[:CARACTERES]. Por defecto se generan todos los
+caracteres, en 4 bits por pixel. Necesita Pillow (pip install pillow).
+"""
+
+import argparse
+import os
+import re
+import sys
+
+from PIL import Image, ImageDraw, ImageFont
+
+from font_rle import FIRST_CHAR, LAST_CHAR, c_bytes
+
+
+def ink_rows(font, chars):
+    """Primera y última fila con tinta de los caracteres, respecto de la línea de base"""
+    top, bottom = 0, 0
+    for char in chars:
+        left, t, right, b = font.getbbox(char, anchor='ls')
+        if right > left and b > t:
+            top = min(top, t)
+            bottom = max(bottom, b)
+    return top, bottom
+
+
+def fit_font(path, height, chars):
+    """Mayor tamaño de la fuente cuyos caracteres entran en height filas"""
+    low, high = 1, 4 * height
+    while low < high:
+        size = (low + high + 1) // 2
+        top, bottom = ink_rows(ImageFont.truetype(path, size), chars)
+        if bottom - top <= height:
+            low = size
+        else:
+            high = size - 1
+    font = ImageFont.truetype(path, low)
+    top, bottom = ink_rows(font, chars)
+    return font, top - (height - (bottom - top)) // 2
+
+
+def glyph_levels(font, char, top, height, bpp):
+    """Ancho y niveles de cobertura de un glifo por filas"""
+    left, t, right, b = font.getbbox(char, anchor='ls')
+    if right <= left or b <= t:
+        # Caracteres sin tinta, como el espacio
+        return max(1, round(font.getlength(char)) - 1), None
+    width = right - left
+    image = Image.new('L', (width, height), 0)
+    ImageDraw.Draw(image).text((-left, -top), char, font=font, fill=255, anchor='ls')
+    top_level = (1 << bpp) - 1
+    return width, [(v * top_level + 127) // 255 for v in image.tobytes()]
+
+
+def pack(levels, width, height, bpp):
+    """Filas completadas hasta el byte, primer pixel en los bits más significativos"""
+    per_byte = 8 // bpp
+    data = []
+    for row in range(height):
+        for j in range(0, width, per_byte):
+            value = 0
+            for k in range(per_byte):
+                level = levels[row * width + j + k] if levels is not None and j + k < width else 0
+                value |= level << (8 - bpp * (k + 1))
+            data.append(value)
+    return data
+
+
+def convert_font(path, out_name, height, chars, bpp):
+    all_chars = [chr(c) for c in range(ord(FIRST_CHAR), ord(LAST_CHAR) + 1)]
+    selected = all_chars if chars is None else [c for c in all_chars if c in chars]
+    font, top = fit_font(path, height, selected)
+    aa_data = []
+    aa_info = []
+    raw = 0
+    for char in all_chars:
+        if char not in selected:
+            aa_info.append((0, 0, char))
+            continue
+        width, levels = glyph_levels(font, char, top, height, bpp)
+        raw += height * ((width + 7) // 8)
+        aa_info.append((width, len(aa_data), char))
+        aa_data += pack(levels, width, height, bpp)
+    if len(aa_data) > 0xFFFF:
+        sys.exit('%s: %i bytes, the offsets of char_info_t are 16 bits' % (out_name, len(aa_data)))
+    name = os.path.basename(path)
+    code = '/**\n * @brief %s %i pt (%i pixels height), %i bpp anti-aliased data array.\n */\n' % (
+        name, font.size, height, bpp)
+    code += 'const uint8_t %s_data[] = {\n%s\n};\n\n' % (out_name, c_bytes(aa_data))
+    code += '/**\n * @brief %s character info array.\n */\n' % out_name
+    code += 'char_info_t %s_info[] = {\n' % out_name
+    for width, offset, char in aa_info:
+        code += '\t{%i, %i}, \t\t/* %s */ \n' % (width, offset, char)
+    code += '};\n\n'
+    code += 'Font_t %s = {\n\t%i,\n\t%s_info,\n\t%s_data,\n\tFONT_%iBPP\n};\n\n' % (
+        out_name, height, out_name, out_name, bpp)
+    print('%-16s %s %i pt: %6i bytes (%6i bytes at 1 bpp)' % (
+        out_name, name, font.size, len(aa_data) + 4 * len(aa_info), raw + 4 * len(aa_info)))
+    return code, 'extern Font_t %s;\n' % out_name
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Anti-aliased fonts for the ILI9341 driver')
+    parser.add_argument('font', help='TrueType or OpenType font file')
+    parser.add_argument('-o', '--output', required=True, help='output path, without extension')
+    parser.add_argument('-b', '--bpp', type=int, choices=(2, 4), default=4, help='bits per pixel')
+    parser.add_argument('-s', '--select', action='append', required=True, help='NAME=HEIGHT[:CHARS]')
+    args = parser.parse_args()
+
+    guard = re.sub(r'\W', '_', os.path.basename(args.output)).upper() + '_H_'
+    code = ''
+    decl = ''
+    for select in args.select:
+        match = re.match(r'^(\w+)=(\d+)(?::(.*))?$', select, re.S)
+        if match is None:
+            sys.exit('wrong selection: ' + select)
+        out_name, height, chars = match.groups()
+        c, d = convert_font(args.font, out_name, int(height), chars, args.bpp)
+        code += c
+        decl += d
+
+    with open(args.output + '.h', 'w', encoding='utf-8') as f:
+        f.write('/* Generated by font_aa.py, do not edit */\n')
+        f.write('#ifndef %s\n#define %s\n\n#include "fonts.h"\n\n%s\n#endif\n' % (guard, guard, decl))
+    with open(args.output + '.c', 'w', encoding='utf-8') as f:
+        f.write('/* Generated by font_aa.py, do not edit */\n')
+        f.write('#include "%s.h"\n\n%s' % (os.path.basename(args.output), code))
+
+
+if __name__ == '__main__':
+    main()
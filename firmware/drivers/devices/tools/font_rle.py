@@ -0,0 +1,193 @@
+# -*- coding: utf-8 -*-
+"""
+Compresión de fuentes e íconos monocromáticos para el driver ILI9341.
+
+Lee los arreglos de fonts.c / icons.c (formato de The Dot Factory, 1 bit por
+pixel) y genera un .c y un .h con los glifos codificados por longitud de
+corrida (FONT_RLE): cada glifo se recorre por filas, sin el relleno de fin de
+fila, y se guarda la longitud de las corridas alternadas de fondo y de color,
+empezando por el fondo. Cada corrida ocupa un nibble (primero el más
+significativo): de 0 a 14 pixeles es el valor del nibble, 15 indica que los
+dos nibbles siguientes son la longitud menos 15 (de 15 a 270 pixeles). Las
+corridas más largas se parten con una corrida de 0 pixeles del otro color.
+Cada glifo empieza en un byte.
+
+Se puede generar un subconjunto de caracteres por aplicación; los caracteres
+que no están en el subconjunto quedan con ancho 0 y no se dibujan.
+
+Uso:
+    python font_rle.py fonts.c icons.c -o ecg_fonts -s font_89:0123456789=font_89_digits
+    python font_rle.py fonts.c -o all_fonts -s font_11 -s font_22
+
+Cada -s es NOMBRE[:CARACTERES][=NOMBRE_GENERADO]. Por defecto se generan todos
+los caracteres y el nombre generado es NOMBRE_rle.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+FIRST_CHAR = ' '
+LAST_CHAR = '~'
+
+
+def strip_comments(text):
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    return re.sub(r'//[^\n]*', '', text)
+
+
+def parse_sources(paths):
+    """Arreglos de datos, de información de caracteres y estructuras de los archivos"""
+    data, info, fonts, icons = {}, {}, {}, {}
+    for path in paths:
+        with open(path, encoding='utf-8') as f:
+            text = strip_comments(f.read())
+        for name, body in re.findall(r'const\s+uint8_t\s+(\w+)\s*\[\s*\]\s*=\s*\{(.*?)\};', text, re.S):
+            data[name] = bytes(int(v, 0) for v in re.findall(r'0[xX][0-9a-fA-F]+|\d+', body))
+        for name, body in re.findall(r'char_info_t\s+(\w+)\s*\[\s*\]\s*=\s*\{(.*?)\};', text, re.S):
+            info[name] = [(int(w), int(o)) for w, o in re.findall(r'\{\s*(\d+)\s*,\s*(\d+)\s*\}', body)]
+        for name, body in re.findall(r'Font_t\s+(\w+)\s*=\s*\{(.*?)\};', text, re.S):
+            height, info_name, data_name = [v.strip() for v in body.split(',')[:3]]
+            fonts[name] = (int(height), info_name, data_name)
+        for name, body in re.findall(r'icon_font_t\s+(\w+)\s*=\s*\{(.*?)\};', text, re.S):
+            height, width, offset, data_name = [v.strip() for v in body.split(',')[:4]]
+            icons[name] = (int(height), int(width), int(offset), data_name)
+    return data, info, fonts, icons
+
+
+def glyph_bits(data, offset, width, height):
+    """Pixeles de un glifo por filas, sin el relleno de fin de fila"""
+    bytes_row = (width + 7) // 8
+    bits = []
+    for row in range(height):
+        start = offset + row * bytes_row
+        for j in range(width):
+            bits.append((data[start + j // 8] >> (7 - j % 8)) & 1)
+    return bits
+
+
+def rle(bits):
+    """Corridas alternadas empezando por el fondo, empaquetadas en nibbles"""
+    nibbles = []
+    color = 0
+    i = 0
+    while i < len(bits):
+        j = i
+        while j < len(bits) and bits[j] == color:
+            j += 1
+        run = j - i
+        while run > 270:
+            nibbles += [15, 15, 15, 0]
+            run -= 270
+        if run < 15:
+            nibbles.append(run)
+        else:
+            nibbles += [15, (run - 15) >> 4, (run - 15) & 15]
+        color ^= 1
+        i = j
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    return [(nibbles[k] << 4) | nibbles[k + 1] for k in range(0, len(nibbles), 2)]
+
+
+def c_bytes(values, indent='\t'):
+    lines = []
+    for i in range(0, len(values), 16):
+        lines.append(indent + ', '.join('0x%02X' % v for v in values[i:i + 16]) + ',')
+    return '\n'.join(lines)
+
+
+def convert_font(name, out_name, chars, font, data, info):
+    height, info_name, data_name = font
+    src_data = data[data_name]
+    src_info = info[info_name]
+    rle_data = []
+    rle_info = []
+    raw = 0
+    for index, (width, offset) in enumerate(src_info):
+        char = chr(ord(FIRST_CHAR) + index)
+        if chars is not None and char not in chars:
+            rle_info.append((0, 0, char))
+            continue
+        raw += height * ((width + 7) // 8)
+        rle_info.append((width, len(rle_data), char))
+        rle_data += rle(glyph_bits(src_data, offset, width, height))
+    if len(rle_data) > 0xFFFF:
+        sys.exit('%s: %i bytes, the offsets of char_info_t are 16 bits' % (out_name, len(rle_data)))
+    code = '/**\n * @brief %s (%i pixels height) run-length encoded data array.\n */\n' % (name, height)
+    code += 'const uint8_t %s_data[] = {\n%s\n};\n\n' % (out_name, c_bytes(rle_data))
+    code += '/**\n * @brief %s character info array.\n */\n' % out_name
+    code += 'char_info_t %s_info[] = {\n' % out_name
+    for width, offset, char in rle_info:
+        code += '\t{%i, %i}, \t\t/* %s */ \n' % (width, offset, char)
+    code += '};\n\n'
+    code += 'Font_t %s = {\n\t%i,\n\t%s_info,\n\t%s_data,\n\tFONT_RLE\n};\n\n' % (out_name, height, out_name, out_name)
+    # Sin los caracteres que no se usan, el arreglo original completo queda fuera del binario
+    raw_total = len(src_data) + 4 * len(src_info)
+    rle_total = len(rle_data) + 4 * len(rle_info)
+    print('%-16s %6i bytes (%6i bytes of glyphs) -> %6i bytes' % (out_name, raw_total, raw, rle_total))
+    return code, 'extern Font_t %s;\n' % out_name
+
+
+def convert_icons(name, out_name, icons_sel, icon_font, data):
+    height, width, offset, data_name = icon_font
+    src_data = data[data_name]
+    count = len(src_data) // offset
+    rle_data = []
+    offsets = []
+    for icon in range(count):
+        offsets.append(len(rle_data))
+        if icons_sel is not None and icon not in icons_sel:
+            continue
+        rle_data += rle(glyph_bits(src_data, icon * offset, width, height))
+    code = '/**\n * @brief %s run-length encoded data array.\n */\n' % name
+    code += 'const uint8_t %s_data[] = {\n%s\n};\n\n' % (out_name, c_bytes(rle_data))
+    code += '/**\n * @brief %s position of each icon in data array.\n */\n' % out_name
+    code += 'const uint32_t %s_offsets[] = {\n%s\n};\n\n' % (out_name, '\n'.join(
+        '\t' + ', '.join(str(o) for o in offsets[i:i + 8]) + ',' for i in range(0, len(offsets), 8)))
+    code += 'icon_font_t %s = {\n\t%i,\n\t%i,\n\t0,\n\t%s_data,\n\tFONT_RLE,\n\t%s_offsets\n};\n\n' % (
+        out_name, height, width, out_name, out_name)
+    rle_total = len(rle_data) + 4 * len(offsets)
+    print('%-16s %6i bytes -> %6i bytes' % (out_name, len(src_data), rle_total))
+    return code, 'extern icon_font_t %s;\n' % out_name
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Run-length encoding of ILI9341 fonts and icons')
+    parser.add_argument('sources', nargs='+', help='fonts.c and/or icons.c')
+    parser.add_argument('-o', '--output', required=True, help='output path, without extension')
+    parser.add_argument('-s', '--select', action='append', required=True,
+                        help='NAME[:CHARS][=OUT_NAME], CHARS are icon numbers separated by commas for icons')
+    args = parser.parse_args()
+
+    data, info, fonts, icons = parse_sources(args.sources)
+    guard = re.sub(r'\W', '_', os.path.basename(args.output)).upper() + '_H_'
+    code = ''
+    decl = ''
+    for select in args.select:
+        match = re.match(r'^(\w+)(?::([^=]*))?(?:=(\w+))?$', select)
+        if match is None:
+            sys.exit('wrong selection: ' + select)
+        name, chars, out_name = match.groups()
+        out_name = out_name or name + '_rle'
+        if name in fonts:
+            c, d = convert_font(name, out_name, chars, fonts[name], data, info)
+        elif name in icons:
+            sel = None if chars is None else [int(i) for i in chars.split(',')]
+            c, d = convert_icons(name, out_name, sel, icons[name], data)
+        else:
+            sys.exit('%s not found' % name)
+        code += c
+        decl += d
+
+    with open(args.output + '.h', 'w', encoding='utf-8') as f:
+        f.write('/* Generated by font_rle.py, do not edit */\n')
+        f.write('#ifndef %s\n#define %s\n\n#include "fonts.h"\n#include "icons.h"\n\n%s\n#endif\n' % (guard, guard, decl))
+    with open(args.output + '.c', 'w', encoding='utf-8') as f:
+        f.write('/* Generated by font_rle.py, do not edit */\n')
+        f.write('#include "%s.h"\n\n%s' % (os.path.basename(args.output), code))
+
+
+if __name__ == '__main__':
+    main()
@@ -26,6 +26,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 18/10/2026 | GPIOState in IRAM, callable from interrupts							|
  * 
  **/
 
@@ -103,6 +104,8 @@ void GPIOOff(gpio_t pin);
 /**
  * @brief Change GPIO state
  * 
+ * @note Runs from IRAM, it can be called from interrupts and SPI transaction callbacks
+ * 
  * @param pin GPIO number
  * @param state GPIO state (true: high - false: low)
  */
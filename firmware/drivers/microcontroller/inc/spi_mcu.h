@@ -21,12 +21,15 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 09/02/2024 | Document creation		                         						|
+ * | 18/10/2026 | Pre-transfer callback and batched writes								|
+ * | 18/10/2026 | Queued (DMA) writes instead of batched writes							|
  * 
  **/
 /*==================[inclusions]=============================================*/
 #include <stdbool.h>
 #include <stdint.h>
 /*==================[macros]=================================================*/
+#define SPI_QUEUE_LAST	0xFFFFFFFF	/*!< SpiWaitWrite argument to wait for all the queued transfers */
 
 /*==================[typedef]================================================*/
 
@@ -68,7 +71,17 @@ typedef struct{
 	transfer_mode_t transfer_mode;	/*!< Transfer mode */
 	void *func_p;					/*!< Pointer to callback function for transaction end */
 	void *param_p;					/*!< Pointer to callback parameter */
+	void *pre_func_p;				/*!< Pointer to callback function for transaction start, it receives the param_p of each transfer, runs in interrupt context and must be in IRAM (NULL if not used) */
 } spi_mcu_config_t;
+
+/**
+ * @brief Single transfer of a batch
+ */
+typedef struct{
+	uint8_t *tx_buffer;				/*!< Pointer to data to write */
+	uint32_t size;					/*!< Number of bytes to write */
+	void *param_p;					/*!< Parameter for the transaction start callback */
+} spi_mcu_transfer_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -98,6 +111,28 @@ void SpiRead(spi_dev_t device, uint8_t * rx_buffer, uint32_t rx_buffer_size);
  */
 void SpiWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size);
 
+/**
+ * @brief Queue a batch of transfers to write from SPI port, without waiting for them
+ * 
+ * @note Transfers are sent by DMA in the background, in order. Up to 8 transfers can be pending,
+ * when the queue is full this function waits for the oldest one. Transfers of up to 4 bytes are
+ * copied, longer buffers must not be modified until SpiWaitWrite returns for their transfer.
+ * 
+ * @param device SPI device to write to
+ * @param transfers array of transfers, transfers with size 0 are skipped
+ * @param count number of transfers
+ * @return uint32_t number of the last transfer queued, to be passed to SpiWaitWrite
+ */
+uint32_t SpiQueueWrite(spi_dev_t device, spi_mcu_transfer_t * transfers, uint32_t count);
+
+/**
+ * @brief Wait until a transfer queued with SpiQueueWrite is finished
+ * 
+ * @param device SPI device
+ * @param transfer number returned by SpiQueueWrite, or SPI_QUEUE_LAST to wait for all of them
+ */
+void SpiWaitWrite(spi_dev_t device, uint32_t transfer);
+
 /**
  * @brief Write and Read data simultaneous from SPI port
  * 
@@ -14,6 +14,8 @@
 #include <stdint.h>
 #include "driver/gpio.h"
 #include "driver/gpio_filter.h"
+#include "hal/gpio_ll.h"
+#include "esp_attr.h"
 /*==================[macros and definitions]=================================*/
 #define GPIO_QTY 	24
 #define FILTER_QTY	8
@@ -88,9 +90,10 @@ void GPIOOff(gpio_t pin){
 	gpio_set_level(gpio_list[pin].pin, gpio_list[pin].state);
 }
 
-void GPIOState(gpio_t pin, bool state){
+void IRAM_ATTR GPIOState(gpio_t pin, bool state){
 	gpio_list[pin].state = state;
-	gpio_set_level(gpio_list[pin].pin, gpio_list[pin].state);
+	/* Direct register write, gpio_set_level is in flash */
+	gpio_ll_set_level(&GPIO, gpio_list[pin].pin, gpio_list[pin].state);
 }
 
 void GPIOToggle(gpio_t pin){
@@ -22,7 +22,16 @@
 #define PIN_NUM_CS1		GPIO_19	/*!<  */
 #define PIN_NUM_CS2		GPIO_18	/*!<  */
 #define PIN_NUM_CS3		GPIO_9	/*!<  */
+#define SPI_QUEUE_SIZE	8		/*!< Transactions queued per device */
 /*==================[internal data declaration]==============================*/
+/**
+ * @brief Transactions queued to a device, they must stay valid until finished
+ */
+typedef struct{
+    spi_transaction_t trans[SPI_QUEUE_SIZE];	/*!< Transactions */
+    uint32_t queued;							/*!< Number of transfers queued since init */
+    uint32_t done;								/*!< Number of transfers finished since init */
+} spi_queue_t;
 spi_device_handle_t spi_1, spi_2, spi_3;
 const spi_bus_config_t bus_cfg = {
     .miso_io_num = PIN_NUM_MISO,
@@ -39,6 +48,10 @@ void (*spi_3_isr_p)(void*);	/*!<  */
 void *spi_1_user_data;	    /*!<  */
 void *spi_2_user_data;	    /*!<  */
 void *spi_3_user_data;	    /*!<  */
+void (*spi_1_pre_p)(void*);	/*!<  */
+void (*spi_2_pre_p)(void*);	/*!<  */
+void (*spi_3_pre_p)(void*);	/*!<  */
+spi_queue_t spi_queue_1, spi_queue_2, spi_queue_3;
 /*==================[internal functions declaration]=========================*/
 static void IRAM_ATTR spi_1_isr(spi_transaction_t *t){
 	spi_1_isr_p(spi_1_user_data);
@@ -49,6 +62,40 @@ static void IRAM_ATTR spi_2_isr(spi_transaction_t *t){
 static void IRAM_ATTR spi_3_isr(spi_transaction_t *t){
 	spi_3_isr_p(spi_3_user_data);
 }
+static void IRAM_ATTR spi_1_pre(spi_transaction_t *t){
+	spi_1_pre_p(t->user);
+}
+static void IRAM_ATTR spi_2_pre(spi_transaction_t *t){
+	spi_2_pre_p(t->user);
+}
+static void IRAM_ATTR spi_3_pre(spi_transaction_t *t){
+	spi_3_pre_p(t->user);
+}
+static spi_queue_t * SpiQueue(spi_dev_t device, spi_device_handle_t * handle){
+    switch(device){
+        case SPI_2:
+            *handle = spi_2;
+            return &spi_queue_2;
+        case SPI_3:
+            *handle = spi_3;
+            return &spi_queue_3;
+        default:
+            *handle = spi_1;
+            return &spi_queue_1;
+    }
+}
+static void SpiTransfer(spi_transaction_t * t, spi_mcu_transfer_t * transfer){
+    memset(t, 0, sizeof(spi_transaction_t));
+    t->length = transfer->size * 8;
+    t->user = transfer->param_p;
+    if(transfer->size <= sizeof(t->tx_data)){
+        /* Short commands and parameters are sent from the transaction itself */
+        t->flags = SPI_TRANS_USE_TXDATA;
+        memcpy(t->tx_data, transfer->tx_buffer, transfer->size);
+    } else{
+        t->tx_buffer = transfer->tx_buffer;
+    }
+}
 /*==================[internal data definition]===============================*/
 
 /*==================[external data definition]===============================*/
@@ -65,7 +112,7 @@ uint8_t SpiInit(spi_mcu_config_t* spi){
 	spi_device_interface_config_t dev_cfg = {
         .clock_speed_hz = spi->bitrate,     	
         .mode = spi->clk_mode,                  
-        .queue_size = 8,                        
+        .queue_size = SPI_QUEUE_SIZE,           
     };
     switch(spi->device){
         case SPI_1:
@@ -74,26 +121,38 @@ uint8_t SpiInit(spi_mcu_config_t* spi){
             if(transfer_mode_1 == SPI_INTERRUPT){
                 dev_cfg.post_cb = spi_1_isr;
             } 
+            if(spi->pre_func_p != NULL){
+                dev_cfg.pre_cb = spi_1_pre;
+                spi_1_pre_p = spi->pre_func_p;
+            }
             spi_bus_add_device(SPI2_HOST, &dev_cfg, &spi_1);
             spi_1_isr_p = spi->func_p;
             spi_1_user_data = spi->param_p;
             break;
         case SPI_2:
             dev_cfg.spics_io_num = PIN_NUM_CS2;
+            transfer_mode_2 = spi->transfer_mode;
             if(transfer_mode_2 == SPI_INTERRUPT){
                 dev_cfg.post_cb = spi_2_isr;
             } 
-            transfer_mode_1 = spi->transfer_mode;
+            if(spi->pre_func_p != NULL){
+                dev_cfg.pre_cb = spi_2_pre;
+                spi_2_pre_p = spi->pre_func_p;
+            }
             spi_bus_add_device(SPI2_HOST, &dev_cfg, &spi_2);
             spi_2_isr_p = spi->func_p;
             spi_2_user_data = spi->param_p;
             break;
         case SPI_3:
             dev_cfg.spics_io_num = PIN_NUM_CS3;
+            transfer_mode_3 = spi->transfer_mode;
             if(transfer_mode_3 == SPI_INTERRUPT){
                 dev_cfg.post_cb = spi_3_isr;
             } 
-            transfer_mode_1 = spi->transfer_mode;
+            if(spi->pre_func_p != NULL){
+                dev_cfg.pre_cb = spi_3_pre;
+                spi_3_pre_p = spi->pre_func_p;
+            }
             spi_bus_add_device(SPI2_HOST, &dev_cfg, &spi_3);
             spi_3_isr_p = spi->func_p;
             spi_3_user_data = spi->param_p;
@@ -181,6 +240,41 @@ void SpiWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size){
     }
 }
 
+uint32_t SpiQueueWrite(spi_dev_t device, spi_mcu_transfer_t * transfers, uint32_t count){
+    spi_device_handle_t handle;
+    spi_transaction_t *t;
+    spi_queue_t *queue = SpiQueue(device, &handle);
+    for(uint32_t i = 0; i < count; i++){
+        if(transfers[i].size == 0){
+            continue;
+        }
+        /* Free the oldest transaction when the queue is full */
+        if(queue->queued - queue->done == SPI_QUEUE_SIZE){
+            spi_device_get_trans_result(handle, &t, portMAX_DELAY);
+            queue->done++;
+        }
+        t = &queue->trans[queue->queued % SPI_QUEUE_SIZE];
+        SpiTransfer(t, &transfers[i]);
+        spi_device_queue_trans(handle, t, portMAX_DELAY);
+        queue->queued++;
+    }
+    return queue->queued;
+}
+
+void SpiWaitWrite(spi_dev_t device, uint32_t transfer){
+    spi_device_handle_t handle;
+    spi_transaction_t *t;
+    spi_queue_t *queue = SpiQueue(device, &handle);
+    if(transfer == SPI_QUEUE_LAST){
+        transfer = queue->queued;
+    }
+    /* Counters can wrap around */
+    while((int32_t)(transfer - queue->done) > 0){
+        spi_device_get_trans_result(handle, &t, portMAX_DELAY);
+        queue->done++;
+    }
+}
+
 void SpiReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t buffer_size){
     spi_transaction_t t;
     memset(&t, 0, sizeof(t));       // Zero out the transaction
@@ -29,6 +29,10 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 12/09/2023 | Document creation		                         |
+ * | 18/10/2026 | Vumeter in framebuffer, frame time benchmark   |
+ * | 18/10/2026 | Frame time benchmark only with LCD_BENCHMARK   |
+ * | 18/10/2026 | Vumeter peak hold and decay                    |
+ * | 18/10/2026 | SPI bytes per frame in the benchmark           |
  *
  * @author Albano Peñalva (albano.penalva@uner.edu.ar)
  *
@@ -39,6 +43,7 @@
 #include <stdint.h>
 #include <string.h>
 #include <math.h>
+#include "esp_timer.h"
 
 #include "timer_mcu.h"
 #include "gpio_mcu.h"
@@ -66,12 +71,20 @@
 #define COLOR_MAIN_3        0x6ab8
 #define COLOR_MAIN_4        0x71b9
 #define COLOR_BG_1          0x0884
+#define VUM_WIDTH           200
+#define VUM_HEIGHT          100
+#define VUM_PEAK_HOLD       8           /* cuadros de 128 ms, ~1 s */
+#define VUM_DECAY           2           /* escalones por cuadro */
+/* Descomentar para medir el tiempo de actualización del vúmetro al inicio */
+// #define LCD_BENCHMARK
+#define BENCHMARK_FRAMES    50
 /*==================[internal data definition]===============================*/
 TaskHandle_t plot_task_handle = NULL;
 static float fft[CHUNK/2];
 static float chunk[CHUNK];
 static uint32_t song_index = 0;
 static bool reset = false;
+static uint16_t vum_pixels[(VUM_WIDTH + 1) * (VUM_HEIGHT + 1)];
 /*==================[internal functions declaration]=========================*/
 /**
  * @brief Función ejecutada en la interrupción de la tecla 1.
@@ -138,6 +151,56 @@ void Song2Bars(const uint8_t* song, uint8_t* bars){
     }
 }
 
+#ifdef LCD_BENCHMARK
+/**
+ * @brief Mide el tiempo y los bytes enviados por SPI en cada actualización del
+ * vúmetro, dibujando directo en el display y en el framebuffer.
+ * 
+ * @param vum Vúmetro
+ * @param fb Framebuffer del área del vúmetro
+ */
+static void FrameBenchmark(vumeter_t *vum, ili9341_framebuffer_t *fb){
+    int64_t start, direct, framebuffer;
+    uint32_t bytes, direct_bytes, framebuffer_bytes;
+    uint8_t bars[VUM_BARS];
+
+    /* Directo en el display */
+    ILI9341FramebufferSelect(NULL);
+    VumeterInit(vum);
+    bytes = ILI9341BytesSent();
+    start = esp_timer_get_time();
+    for(uint8_t f=0; f<BENCHMARK_FRAMES; f++){
+        for(uint8_t i=0; i<VUM_BARS; i++){
+            bars[i] = f * 37 + i * 53;
+        }
+        VumeterUpdate(vum, bars);
+        ILI9341Flush();
+    }
+    direct = (esp_timer_get_time() - start) / BENCHMARK_FRAMES;
+    direct_bytes = (ILI9341BytesSent() - bytes) / BENCHMARK_FRAMES;
+
+    /* En el framebuffer, se envían solo las áreas modificadas */
+    ILI9341FramebufferInit(fb);
+    ILI9341FramebufferSelect(fb);
+    VumeterInit(vum);
+    ILI9341FramebufferFlush();
+    bytes = ILI9341BytesSent();
+    start = esp_timer_get_time();
+    for(uint8_t f=0; f<BENCHMARK_FRAMES; f++){
+        for(uint8_t i=0; i<VUM_BARS; i++){
+            bars[i] = f * 37 + i * 53;
+        }
+        VumeterUpdate(vum, bars);
+        ILI9341FramebufferFlush();
+        ILI9341Flush();
+    }
+    framebuffer = (esp_timer_get_time() - start) / BENCHMARK_FRAMES;
+    framebuffer_bytes = (ILI9341BytesSent() - bytes) / BENCHMARK_FRAMES;
+    printf("Vumetro: %lld us y %lu bytes por cuadro directo, %lld us y %lu bytes con framebuffer\n",
+        direct, direct_bytes, framebuffer, framebuffer_bytes);
+}
+#endif
+
 /**
  * @brief Tarea encargada de la graficación en el display LCD.
  * 
@@ -164,6 +227,7 @@ static void PlotTask(void *pvParameter){
             /* Vúmetro */
             Song2Bars(&song[song_index-CHUNK], bars);
             VumeterUpdate(vum, bars);
+            ILI9341FramebufferFlush();
             /* Progress bar */
             ILI9341DrawFilledCircle(20+200*progress_bar_index/progress_bar, 223, 7, COLOR_BG_1);
             progress_bar_index++;
@@ -177,6 +241,7 @@ static void PlotTask(void *pvParameter){
             ILI9341DrawIcon(107, 255, ICON_PLAY, &icon_30, COLOR_MAIN_1, COLOR_BG_1);
             ILI9341DrawFilledRectangle(0, 45, 240, 100, COLOR_BG_1);
             VumeterInit(vum);
+            ILI9341FramebufferFlush();
             progress_bar_index = 0;
         }     
     }
@@ -204,16 +269,33 @@ void app_main(void){
     static vumeter_t v = {
         .x_pos = 20,
         .y_pos = 100,
-        .width = 200,
-        .height = 100,
+        .width = VUM_WIDTH,
+        .height = VUM_HEIGHT,
         .n_bars = VUM_BARS,
         .step_color_1 = COLOR_MAIN_1,
         .step_color_2 = COLOR_MAIN_2,
         .step_color_3 = COLOR_MAIN_3,
         .step_color_4 = COLOR_MAIN_4,
+        .back_color = COLOR_BG_1,
+        .peak_hold = VUM_PEAK_HOLD,
+        .decay = VUM_DECAY
+    };
+    /* El vúmetro se dibuja en RAM y se envían al display solo las áreas modificadas */
+    static ili9341_framebuffer_t vum_fb = {
+        .x = 20,
+        .y = 100,
+        .width = VUM_WIDTH + 1,
+        .height = VUM_HEIGHT + 1,
+        .pixels = vum_pixels,
         .back_color = COLOR_BG_1
     };
+#ifdef LCD_BENCHMARK
+    FrameBenchmark(&v, &vum_fb);
+#endif
+    ILI9341FramebufferInit(&vum_fb);
+    ILI9341FramebufferSelect(&vum_fb);
     VumeterInit(&v);
+    ILI9341FramebufferFlush();
     /* Iconos */
     ILI9341DrawString(10, 8, "10:20", &font_22, COLOR_MAIN_2, COLOR_BG_1);
     ILI9341DrawIcon(180, 8, ICON_WIFI_3, &icon_22, COLOR_MAIN_2, COLOR_BG_1);
@@ -10,6 +10,7 @@
  */
 
 /*==================[inclusions]=============================================*/
+#include <stdbool.h>
 #include "vumeter.h"
 #include "ili9341.h"
 /*==================[macros and definitions]=================================*/
@@ -26,13 +27,66 @@
 #define COLOR_TH_3      80
 /*==================[internal data declaration]==============================*/
 static uint16_t bars_width, bars_dist, bars_gap;
+static uint8_t bar_steps[VUMETER_BARS_MAX];		/* steps drawn of each bar */
+static uint8_t peak_steps[VUMETER_BARS_MAX];	/* peak of each bar, drawn on step peak - 1, 0 without peak */
+static uint8_t peak_frames[VUMETER_BARS_MAX];	/* frames left before each peak falls */
 /*==================[internal functions declaration]=========================*/
+/**
+ * @brief Color of a step, by its height
+ * 
+ * @param vum       Structure with the plot configuration
+ * @param step      step, from the bottom
+ * @return          color
+ */
+static uint16_t StepColor(vumeter_t * vum, uint8_t step);
+
+/**
+ * @brief Draws a step of a bar
+ * 
+ * @param vum       Structure with the plot configuration
+ * @param bar_start x position of the bar
+ * @param step      step, from the bottom
+ */
+static void DrawStep(vumeter_t * vum, uint16_t bar_start, uint8_t step);
 
+/**
+ * @brief Erases consecutive steps of a bar in a single area
+ * 
+ * @param vum       Structure with the plot configuration
+ * @param bar_start x position of the bar
+ * @param first     lowest step to erase
+ * @param end       step after the highest one to erase
+ */
+static void EraseSteps(vumeter_t * vum, uint16_t bar_start, uint8_t first, uint8_t end);
 /*==================[internal data definition]===============================*/
 
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static uint16_t StepColor(vumeter_t * vum, uint8_t step){
+    if(STEP_DIST*step < vum->height*COLOR_TH_1/100){
+        return vum->step_color_1;
+    } else if(STEP_DIST*step < vum->height*COLOR_TH_2/100){
+        return vum->step_color_2;
+    } else if(STEP_DIST*step < vum->height*COLOR_TH_3/100){
+        return vum->step_color_3;
+    }
+    return vum->step_color_4;
+}
+
+static void DrawStep(vumeter_t * vum, uint16_t bar_start, uint8_t step){
+    uint16_t step_start = vum->y_pos+vum->height-(STEP_DIST)*step;
+    ILI9341DrawFilledRectangle(bar_start, step_start,
+        bar_start + bars_width, step_start - STEP_HEIGHT,
+        StepColor(vum, step));
+}
+
+static void EraseSteps(vumeter_t * vum, uint16_t bar_start, uint8_t first, uint8_t end){
+    /* The gaps between steps are background too */
+    ILI9341DrawFilledRectangle(bar_start, vum->y_pos+vum->height-(STEP_DIST)*first,
+        bar_start + bars_width, vum->y_pos+vum->height-(STEP_DIST)*(end-1) - STEP_HEIGHT,
+        vum->back_color);
+}
 
 /*==================[external functions definition]==========================*/
 void VumeterInit(vumeter_t * vum){
@@ -42,33 +96,60 @@ void VumeterInit(vumeter_t * vum){
     bars_width = (vum->width / vum->n_bars) * BAR_WIDTH_PERC / 100;
     bars_dist = (vum->width / vum->n_bars);
     bars_gap = bars_dist - bars_width;
+    for (uint8_t i=0; i<VUMETER_BARS_MAX; i++){
+        bar_steps[i] = 0;
+        peak_steps[i] = 0;
+        peak_frames[i] = 0;
+    }
 }
 
 void VumeterUpdate(vumeter_t * vum, uint8_t * values){
-    uint16_t n_steps, color, step_start, bar_start;
-    for (uint8_t i=0; i<vum->n_bars; i++){
-        /* Delete previous bar */
+    uint16_t n_steps, bar_start, top;
+    uint8_t peak;
+    int16_t erase_from;
+    bool drawn, draw;
+    for (uint8_t i=0; i<vum->n_bars && i<VUMETER_BARS_MAX; i++){
         bar_start = vum->x_pos+i*bars_dist + bars_gap/2;
-        ILI9341DrawFilledRectangle(bar_start, vum->y_pos,
-			bar_start + bars_width, vum->y_pos + vum->height,
-			vum->back_color);
-        /* Draw bar's steps */
         n_steps = ((values[i] * vum->height) / BAR_MAX) / STEP_DIST;
-        for(uint8_t j=0; j<n_steps; j++){
-            step_start = vum->y_pos+vum->height-(STEP_DIST)*j;
-            if(STEP_DIST*j < vum->height*COLOR_TH_1/100){
-                color = vum->step_color_1;
-            } else if(STEP_DIST*j < vum->height*COLOR_TH_2/100){
-                color = vum->step_color_2;
-            } else if(STEP_DIST*j < vum->height*COLOR_TH_3/100){
-                color = vum->step_color_3;
-            }else{
-                color = vum->step_color_4;
+        /* Bar falls at most decay steps per frame */
+        if(vum->decay > 0 && n_steps + vum->decay < bar_steps[i]){
+            n_steps = bar_steps[i] - vum->decay;
+        }
+        /* Peak goes up with the bar, it is held and then falls one step per frame */
+        peak = peak_steps[i];
+        if(vum->peak_hold > 0){
+            if(n_steps >= peak){
+                peak = n_steps;
+                peak_frames[i] = vum->peak_hold;
+            } else if(peak_frames[i] > 0){
+                peak_frames[i]--;
+            } else{
+                peak--;
+            }
+        }
+        /* Steps that change, from the bottom, consecutive erased steps in one area */
+        top = n_steps > bar_steps[i] ? n_steps : bar_steps[i];
+        top = top > peak_steps[i] ? top : peak_steps[i];
+        erase_from = -1;
+        for(uint8_t j=0; j<=top; j++){
+            drawn = j < bar_steps[i] || j + 1 == peak_steps[i];
+            draw = j < n_steps || j + 1 == peak;
+            if(j < top && drawn && !draw){
+                if(erase_from < 0){
+                    erase_from = j;
+                }
+                continue;
+            }
+            if(erase_from >= 0){
+                EraseSteps(vum, bar_start, erase_from, j);
+                erase_from = -1;
+            }
+            if(j < top && draw && !drawn){
+                DrawStep(vum, bar_start, j);
             }
-            ILI9341DrawFilledRectangle(bar_start, step_start,
-                bar_start + bars_width, step_start - STEP_HEIGHT,
-                color);
         }
+        bar_steps[i] = n_steps;
+        peak_steps[i] = peak;
     }
 }
 /*==================[end of file]============================================*/
@@ -16,12 +16,14 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 12/04/2024 | Document creation		                         						|
+ * | 18/10/2026 | Only changed steps are drawn, peak hold and decay						|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdint.h>
 /*==================[macros]=================================================*/
+#define VUMETER_BARS_MAX	32		/*!< Maximum number of bars */
 
 /*==================[typedef]================================================*/
 /**
@@ -39,6 +41,8 @@ typedef struct{
     uint16_t step_color_3;		/*!< number of bars */
     uint16_t step_color_4;		/*!< number of bars */
     uint16_t back_color;		/*!< plot background color */
+    uint8_t peak_hold;			/*!< frames the highest step is held before falling one step per frame, 0 without peak */
+    uint8_t decay;				/*!< maximum number of steps a bar falls per frame, 0 to follow the values at once */
 } vumeter_t;
 
 /*==================[external data declaration]==============================*/
@@ -54,6 +58,9 @@ void VumeterInit(vumeter_t * vum);
 /**
  * @brief 
  * 
+ * Only the steps that appear are drawn and only the ones that disappear are
+ * erased, with the peak and the decay of each bar in the same pass.
+ * 
  * @param vum       Structure with the plot configuration
  * @param values    height of each vumeter bar (from 0 to 256)
  */
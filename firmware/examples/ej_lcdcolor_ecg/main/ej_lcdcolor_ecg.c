@@ -27,6 +27,15 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 05/04/2024 | Document creation		                         |
+ * | 18/10/2026 | Heart rate measured by the QRS detector        |
+ * | 18/10/2026 | Display throughput benchmark                   |
+ * | 18/10/2026 | Display benchmark only with LCD_BENCHMARK      |
+ * | 18/10/2026 | Plot in framebuffer, frame time benchmark      |
+ * | 18/10/2026 | Frame time benchmark only with LCD_BENCHMARK   |
+ * | 18/10/2026 | Glyph cache for the heart rate digits          |
+ * | 18/10/2026 | Compressed digits-only font_89                 |
+ * | 18/10/2026 | Roll and hardware scroll plot benchmark        |
+ * | 18/10/2026 | Benchmark of several traces drawn by columns   |
  *
  * @author Albano Peñalva (albano.penalva@uner.edu.ar)
  *
@@ -36,9 +45,12 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <string.h>
+#include <stdlib.h>
 #include "sys/time.h"
+#include "esp_timer.h"
 
 #include "iir_filter.h"
+#include "dsps_qrs.h"
 #include "timer_mcu.h"
 #include "gpio_mcu.h"
 #include "rtc_mcu.h"
@@ -50,12 +62,24 @@
 #include "ili9341.h"
 #include "roll_plot.h"
 #include "heart_pic.h"
+#include "ecg_fonts.h"
 /*==================[macros and definitions]=================================*/
 #define BUFFER_SIZE         256
 #define SAMPLE_FREQ	        200
 #define T_SENIAL            4000 
 #define CHUNK               16 
 #define LIGHT_BLUE_COLOR    0x0B2F
+#define ECG_BITS            8           /* Resolución de las muestras de ECG */
+#define QRS_BEATS_MAX       4           /* Latidos detectados por bloque */
+/* Descomentar para medir la velocidad del display al inicio */
+// #define LCD_BENCHMARK
+#define BENCHMARK_REPEAT    10
+#define BENCHMARK_FRAMES    50
+#define BENCHMARK_SAMPLES   2000
+#define BENCHMARK_TRACES    4
+#define PLOT_WIDTH          240
+#define PLOT_HEIGHT         100
+#define GLYPH_CACHE_SIZE    16384
 /*==================[internal data definition]===============================*/
 float ecg[] = {
      76,  76,  77,  77,  76,  83,  85,  78,  76,  85,  93,  85,  79,
@@ -80,9 +104,169 @@ float ecg[] = {
      71,  72,  82,  82,  76,  77,  76,  76,  75
 };
 static float ecg_filt[CHUNK];
+static int16_t ecg_adc[CHUNK];
+static qrs_s16_t qrs;
+static uint16_t plot_pixels[(PLOT_WIDTH + 1) * (PLOT_HEIGHT + 1)];
+static uint16_t glyph_pixels[GLYPH_CACHE_SIZE];
 TaskHandle_t plot_task_handle = NULL;
-uint8_t frecuencia_cardiaca = 71;
+uint16_t frecuencia_cardiaca = 0;      /* 0 hasta detectar dos latidos */
 /*==================[internal functions declaration]=========================*/
+#ifdef LCD_BENCHMARK
+/**
+ * @brief Mide la velocidad de escritura del display en pixeles por segundo
+ * para la pantalla completa, líneas de 1 pixel y texto. Al terminar vuelve a
+ * habilitar el caché de glifos de app_main.
+ * 
+ */
+static void LcdBenchmark(void){
+    int64_t start, time, cpu;
+    uint32_t pixels;
+    uint16_t width, height;
+
+    /* Pantalla completa */
+    start = esp_timer_get_time();
+    for(uint8_t i=0; i<BENCHMARK_REPEAT; i++){
+        ILI9341Fill(i & 1 ? ILI9341_WHITE : ILI9341_BLACK);
+    }
+    /* Las transferencias terminan después de que ILI9341Fill retorna */
+    cpu = esp_timer_get_time() - start;
+    ILI9341Flush();
+    time = esp_timer_get_time() - start;
+    printf("Pantalla completa: %lld pixeles/s, %lld fps, %lld us en ILI9341Fill de %lld us\n",
+        (int64_t)ILI9341_PIXEL_MAX * BENCHMARK_REPEAT * 1000000 / time, (int64_t)BENCHMARK_REPEAT * 1000000 / time, cpu, time);
+
+    /* Líneas diagonales de 1 pixel */
+    pixels = 0;
+    start = esp_timer_get_time();
+    for(uint16_t y=0; y<ILI9341_HEIGHT; y+=8){
+        ILI9341DrawLine(0, y, ILI9341_WIDTH - 1, ILI9341_HEIGHT - 1 - y, ILI9341_RED);
+        height = abs(ILI9341_HEIGHT - 1 - 2 * y);
+        pixels += (height > ILI9341_WIDTH - 1 ? height : ILI9341_WIDTH - 1) + 1;
+    }
+    ILI9341Flush();
+    time = esp_timer_get_time() - start;
+    printf("Lineas: %lld pixeles/s\n", (int64_t)pixels * 1000000 / time);
+
+    /* Texto */
+    ILI9341GetStringSize("0123456789", &font_22, &width, &height);
+    start = esp_timer_get_time();
+    for(uint8_t i=0; i<BENCHMARK_REPEAT; i++){
+        ILI9341DrawString(0, i * (height + 1), "0123456789", &font_22, ILI9341_WHITE, LIGHT_BLUE_COLOR);
+    }
+    ILI9341Flush();
+    time = esp_timer_get_time() - start;
+    printf("Texto: %lld pixeles/s\n", (int64_t)width * height * BENCHMARK_REPEAT * 1000000 / time);
+
+    /* Dígitos de la frecuencia cardíaca (comprimidos), sin y con caché de glifos */
+    ILI9341GetStringSize("000", &font_89_digits, &width, &height);
+    for(uint8_t cache=0; cache<2; cache++){
+        ILI9341GlyphCacheInit(cache ? glyph_pixels : NULL, GLYPH_CACHE_SIZE);
+        start = esp_timer_get_time();
+        for(uint8_t i=0; i<BENCHMARK_REPEAT; i++){
+            ILI9341DrawString(20, 60, i & 1 ? "071" : "072", &font_89_digits, LIGHT_BLUE_COLOR, ILI9341_WHITE);
+        }
+        cpu = esp_timer_get_time() - start;
+        ILI9341Flush();
+        time = esp_timer_get_time() - start;
+        printf("Digitos font_89 %s cache: %lld pixeles/s, %lld us en ILI9341DrawString de %lld us\n", cache ? "con" : "sin",
+            (int64_t)width * height * BENCHMARK_REPEAT * 1000000 / time, cpu, time);
+    }
+    ILI9341GlyphCacheInit(glyph_pixels, GLYPH_CACHE_SIZE);
+}
+
+/**
+ * @brief Mide el tiempo por muestra de una gráfica de todo el ancho del display
+ * en horizontal, borrando adelante (RT_PLOT_ROLL) y con el scroll del display
+ * (RT_PLOT_SCROLL). Deja el display en vertical.
+ * 
+ */
+static void ScrollBenchmark(void){
+    int64_t start, time[2];
+    plot_t plot = {
+        .x_pos = 0,
+        .y_pos = 70,
+        .width = ILI9341_HEIGHT,
+        .height = PLOT_HEIGHT,
+        .x_scale = 30,
+        .back_color = ILI9341_WHITE
+    };
+    signal_t signal = {
+        .y_scale = 40,
+        .y_offset = 0,
+        .color = ILI9341_RED
+    };
+
+    /* El display se desplaza a lo largo de sus 320 pixeles, en horizontal */
+    ILI9341Rotate(ILI9341_Landscape_1);
+    for(uint8_t mode=RT_PLOT_ROLL; mode<=RT_PLOT_SCROLL; mode++){
+        ILI9341Fill(ILI9341_WHITE);
+        plot.mode = mode;
+        RTPlotInit(&plot);
+        RTSignalInit(&plot, &signal);
+        start = esp_timer_get_time();
+        for(uint16_t i=0; i<BENCHMARK_SAMPLES; i++){
+            RTPlotDraw(&signal, ecg[(uint8_t)i]);
+        }
+        ILI9341Flush();
+        time[mode] = esp_timer_get_time() - start;
+    }
+    printf("Grafica horizontal: %lld us por muestra borrando adelante, %lld us con scroll\n",
+        time[RT_PLOT_ROLL] / BENCHMARK_SAMPLES, time[RT_PLOT_SCROLL] / BENCHMARK_SAMPLES);
+    ILI9341Rotate(ILI9341_Portrait_2);
+}
+
+/**
+ * @brief Mide las columnas por segundo de la gráfica con 1, 2 y 4 señales,
+ * dibujando cada señal por separado (RTPlotDraw) y todas juntas por columnas
+ * (RTPlotDrawSignals).
+ * 
+ */
+static void TracesBenchmark(void){
+    int64_t start, time[2];
+    int16_t data[BENCHMARK_TRACES];
+    signal_t traces[BENCHMARK_TRACES];
+    signal_t *signals[BENCHMARK_TRACES];
+    uint16_t colors[BENCHMARK_TRACES] = {ILI9341_RED, ILI9341_BLUE, ILI9341_DARKGREEN, ILI9341_MAGENTA};
+    plot_t plot = {
+        .x_pos = 0,
+        .y_pos = 160,
+        .width = PLOT_WIDTH,
+        .height = PLOT_HEIGHT,
+        .x_scale = 100,
+        .back_color = ILI9341_WHITE
+    };
+
+    for(uint8_t n=1; n<=BENCHMARK_TRACES; n*=2){
+        for(uint8_t columns=0; columns<2; columns++){
+            RTPlotInit(&plot);
+            for(uint8_t s=0; s<n; s++){
+                traces[s] = (signal_t){.y_scale = 40, .y_offset = 15 * s, .color = colors[s]};
+                RTSignalInit(&plot, &traces[s]);
+                signals[s] = &traces[s];
+            }
+            start = esp_timer_get_time();
+            for(uint16_t i=0; i<BENCHMARK_SAMPLES; i++){
+                for(uint8_t s=0; s<n; s++){
+                    data[s] = ecg[(uint8_t)(i + 40 * s)];
+                }
+                if(columns){
+                    RTPlotDrawSignals(signals, data, n);
+                }else{
+                    for(uint8_t s=0; s<n; s++){
+                        RTPlotDraw(signals[s], data[s]);
+                    }
+                }
+            }
+            ILI9341Flush();
+            time[columns] = esp_timer_get_time() - start;
+        }
+        /* Con x_scale de 100 cada muestra es una columna */
+        printf("Grafica con %d senales: %lld columnas/s por separado, %lld columnas/s por columnas\n", n,
+            (int64_t)BENCHMARK_SAMPLES * 1000000 / time[0], (int64_t)BENCHMARK_SAMPLES * 1000000 / time[1]);
+    }
+}
+#endif
+
 /**
  * @brief Función ejecutada en la interrupción del Timer
  * 
@@ -91,6 +275,45 @@ void FuncTimerSenial(void* param){
     xTaskNotifyGive(plot_task_handle);
 }
 
+#ifdef LCD_BENCHMARK
+/**
+ * @brief Mide el tiempo de actualización de la gráfica por bloque de CHUNK 
+ * muestras, dibujando directo en el display y en el framebuffer.
+ * 
+ */
+static void FrameBenchmark(plot_t *plot, signal_t *signal, ili9341_framebuffer_t *fb){
+    int64_t start, direct, framebuffer;
+
+    /* Directo en el display */
+    ILI9341FramebufferSelect(NULL);
+    start = esp_timer_get_time();
+    for(uint8_t f=0; f<BENCHMARK_FRAMES; f++){
+        for(uint8_t i=0; i<CHUNK; i++){
+            RTPlotDraw(signal, ecg[(uint8_t)(f * CHUNK + i)]);
+        }
+        ILI9341Flush();
+    }
+    direct = (esp_timer_get_time() - start) / BENCHMARK_FRAMES;
+
+    /* En el framebuffer, se envían solo las áreas modificadas */
+    ILI9341FramebufferInit(fb);
+    ILI9341FramebufferSelect(fb);
+    RTPlotInit(plot);
+    RTSignalInit(plot, signal);
+    ILI9341FramebufferFlush();
+    start = esp_timer_get_time();
+    for(uint8_t f=0; f<BENCHMARK_FRAMES; f++){
+        for(uint8_t i=0; i<CHUNK; i++){
+            RTPlotDraw(signal, ecg[(uint8_t)(f * CHUNK + i)]);
+        }
+        ILI9341FramebufferFlush();
+        ILI9341Flush();
+    }
+    framebuffer = (esp_timer_get_time() - start) / BENCHMARK_FRAMES;
+    printf("Grafica ECG: %lld us por bloque directo, %lld us con framebuffer\n", direct, framebuffer);
+}
+#endif
+
 /**
  * @brief Tarea encargada de filtrar la señal y graficarla en
  * el display LCD.
@@ -98,17 +321,19 @@ void FuncTimerSenial(void* param){
  */
 static void PlotTask(void *pvParameter){
     static uint8_t indice = 0;
-    static char freq[] = "000";
+    static char freq[] = "---";
     static char hour_min[] = "00:00";
     static bool beat = true;
     rtc_t actual_time;
+    qrs_beat_t beats[QRS_BEATS_MAX];
+    int n_beats;
 
     /* Configuración de área de gráfica */
     plot_t plot1 = {
         .x_pos = 0,
         .y_pos = 160,
-        .width = 240,
-        .height = 100,
+        .width = PLOT_WIDTH,
+        .height = PLOT_HEIGHT,
         .x_scale = 30,
         .back_color = ILI9341_WHITE
 	};
@@ -122,6 +347,22 @@ static void PlotTask(void *pvParameter){
         .y_prev = 0
 	};
 	RTSignalInit(&plot1, &ecg1);
+    /* La gráfica se dibuja en RAM y se envían al display solo las áreas modificadas */
+    ili9341_framebuffer_t plot_fb = {
+        .x = plot1.x_pos,
+        .y = plot1.y_pos,
+        .width = PLOT_WIDTH + 1,
+        .height = PLOT_HEIGHT + 1,
+        .pixels = plot_pixels,
+        .back_color = plot1.back_color
+    };
+#ifdef LCD_BENCHMARK
+    FrameBenchmark(&plot1, &ecg1, &plot_fb);
+#endif
+    ILI9341FramebufferInit(&plot_fb);
+    ILI9341FramebufferSelect(&plot_fb);
+    RTPlotInit(&plot1);
+    RTSignalInit(&plot1, &ecg1);
 
     while(true){
         ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
@@ -130,20 +371,35 @@ static void PlotTask(void *pvParameter){
         HiPassFilter(&ecg[indice], ecg_filt, CHUNK);
         LowPassFilter(ecg_filt, ecg_filt, CHUNK);
 
+        /* Detección de latidos, sobre las muestras sin filtrar */
+        for(uint8_t i=0; i<CHUNK; i++){
+            ecg_adc[i] = ecg[indice + i];
+        }
+        n_beats = dsps_qrs_s16(&qrs, ecg_adc, CHUNK, beats, QRS_BEATS_MAX);
+        for(uint8_t i=0; i<n_beats; i++){
+            /* El primer latido no tiene intervalo RR */
+            if(beats[i].rr_ms > 0){
+                frecuencia_cardiaca = 60000 / beats[i].rr_ms;
+            }
+        }
+
         /* Graficación de señal */
         for(uint8_t i=0; i<CHUNK; i++){
             RTPlotDraw(&ecg1, ecg_filt[i]);
         }
+        ILI9341FramebufferFlush();
         indice += CHUNK;
 
         if(indice == 0){
             /* Actualización de datos en display */
-            ILI9341DrawString(20, 60, freq, &font_89, ILI9341_WHITE, ILI9341_WHITE);
+            ILI9341DrawString(20, 60, freq, &font_89_digits, ILI9341_WHITE, ILI9341_WHITE);
             ILI9341DrawString(10, 8, hour_min, &font_30, LIGHT_BLUE_COLOR, LIGHT_BLUE_COLOR);
-            sprintf(freq, "%03i", frecuencia_cardiaca);
+            if(frecuencia_cardiaca > 0){
+                sprintf(freq, "%03i", frecuencia_cardiaca);
+            }
             RtcRead(&actual_time);
             sprintf(hour_min, "%02i:%02i", actual_time.hour%MAX_HOUR, actual_time.min%MAX_MIN);
-            ILI9341DrawString(20, 60, freq, &font_89, LIGHT_BLUE_COLOR, ILI9341_WHITE);
+            ILI9341DrawString(20, 60, freq, &font_89_digits, LIGHT_BLUE_COLOR, ILI9341_WHITE);
             ILI9341DrawString(10, 8, hour_min, &font_30, ILI9341_WHITE, LIGHT_BLUE_COLOR);
             if(beat){
                 ILI9341DrawPicture(170, 65, HEART_WIDTH, HEART_HEIGHT, heart);
@@ -167,14 +423,21 @@ void app_main(void){
 
     /* Configuración de display */
     ILI9341Init(SPI_1, GPIO_9, GPIO_18);
+    /* Caché de glifos para los dígitos de la frecuencia cardíaca */
+    ILI9341GlyphCacheInit(glyph_pixels, GLYPH_CACHE_SIZE);
 	ILI9341Rotate(ILI9341_Portrait_2);
+#ifdef LCD_BENCHMARK
+    LcdBenchmark();
+    ScrollBenchmark();
+    TracesBenchmark();
+#endif
 	ILI9341Fill(ILI9341_WHITE);
     ILI9341DrawFilledRectangle(0, 0, 240, 40, LIGHT_BLUE_COLOR);
     ILI9341DrawFilledRectangle(0, 280, 240, 320, LIGHT_BLUE_COLOR);
     ILI9341DrawString(10, 290, "TIME10S", &font_22, ILI9341_WHITE, LIGHT_BLUE_COLOR);
     ILI9341DrawString(178, 290, "00:04", &font_22, ILI9341_WHITE, LIGHT_BLUE_COLOR);
     ILI9341DrawString(178, 120, "bpm", &font_22, LIGHT_BLUE_COLOR, ILI9341_WHITE);
-    ILI9341DrawString(20, 60, "000", &font_89, LIGHT_BLUE_COLOR, ILI9341_WHITE);
+    ILI9341DrawString(20, 60, "---", &font_89_digits, LIGHT_BLUE_COLOR, ILI9341_WHITE);
     ILI9341DrawIcon(170, 8, ICON_BLUETOOTH, &icon_30, ILI9341_WHITE, LIGHT_BLUE_COLOR);
     ILI9341DrawIcon(200, 8, ICON_BAT_3, &icon_30, ILI9341_WHITE, LIGHT_BLUE_COLOR);
 
@@ -182,6 +445,9 @@ void app_main(void){
     LowPassInit(SAMPLE_FREQ, 30, ORDER_2);
     HiPassInit(SAMPLE_FREQ, 1, ORDER_2);
 
+    /* Detector de latidos */
+    dsps_qrs_init_s16(&qrs, SAMPLE_FREQ, ECG_BITS);
+
     /* Tarea para actualizar pantalla */
     xTaskCreate(&PlotTask, "Plot", 4096, NULL, 5, &plot_task_handle);
 
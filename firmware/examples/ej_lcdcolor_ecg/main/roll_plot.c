@@ -13,28 +13,151 @@
 #include "roll_plot.h"
 #include "ili9341.h"
 /*==================[macros and definitions]=================================*/
+#define COLUMN_MAX	ILI9341_HEIGHT		/*!< Maximum number of pixels of a plot column */
 
 /*==================[internal data declaration]==============================*/
-
+static uint8_t column[2 * 2 * COLUMN_MAX];	/*!< Pixels of a plot column and the blank one after it, high byte first */
 /*==================[internal functions declaration]=========================*/
+/**
+ * @brief  		Row of a data value in a plot
+ * @param[in]  	signal: Structure with the signal configuration
+ * @param[in]  	data: Data value
+ * @retval 		Row, limited to the plot
+ */
+static int16_t DataRow(signal_t * signal, int16_t data);
+
+/**
+ * @brief  		Draws a column of the plot with the traces of all signals in a single window
+ * @note		In RT_PLOT_ROLL mode the window also takes the next column, blank. In
+ * 				RT_PLOT_SCROLL mode the column is scrolled to the right end of the plot.
+ * @param[in]  	plot: Structure with the plot configuration
+ * @param[in]  	x: Column
+ * @param[in]  	signals: Signals, each one is drawn from y_min to y_max
+ * @param[in]  	count: Number of signals
+ * @retval 		NONE
+ */
+static void DrawColumn(plot_t * plot, uint16_t x, signal_t * signals[], uint8_t count);
+
+/**
+ * @brief  		Adds a point to each signal of a plot, drawing the columns they complete
+ * @param[in]  	signals: Signals of the same plot, they must be initialized together
+ * @param[in]  	y_act: Row of the point of each signal
+ * @param[in]  	count: Number of signals
+ * @retval 		NONE
+ */
+static void ColumnsDraw(signal_t * signals[], const int16_t * y_act, uint8_t count);
 
 /*==================[internal data definition]===============================*/
 
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static int16_t DataRow(signal_t * signal, int16_t data){
+	plot_t * plot = signal->plot;
+	int16_t y = plot->y_pos + plot->height - (data * signal->y_scale) / 100 - signal->y_offset;
+	/* it can exceed plot limits */
+	if (y < plot->y_pos){
+		y = plot->y_pos;
+	}
+	if (y > (plot->y_pos + plot->height)){
+		y = plot->y_pos + plot->height;
+	}
+	return y;
+}
+
+static void DrawColumn(plot_t * plot, uint16_t x, signal_t * signals[], uint8_t count){
+	uint16_t rows = plot->height + 1;
+	uint16_t width = 1;
+	uint16_t pixel, i;
+	if (rows > COLUMN_MAX){
+		rows = COLUMN_MAX;
+	}
+	/* The blank column ahead separates new data from the old one */
+	if (plot->mode == RT_PLOT_ROLL && x + 1 < plot->x_pos + plot->width){
+		width = 2;
+	}
+	for (i = 0; i < rows * width; i++){
+		column[2 * i] = plot->back_color >> 8;
+		column[2 * i + 1] = plot->back_color & 0xFF;
+	}
+	/* Traces are drawn in order, the last signal on top */
+	for (uint8_t s = 0; s < count; s++){
+		pixel = signals[s]->color;
+		for (i = signals[s]->y_min - plot->y_pos; i <= signals[s]->y_max - plot->y_pos && i < rows; i++){
+			column[2 * width * i] = pixel >> 8;
+			column[2 * width * i + 1] = pixel & 0xFF;
+		}
+	}
+	ILI9341DrawPicture(x, plot->y_pos, width, rows, column);
+	if (plot->mode == RT_PLOT_SCROLL){
+		/* The column just drawn is shown at the right end of the plot */
+		ILI9341Scroll(x - plot->x_pos + 1);
+	}
+}
+
+static void ColumnsDraw(signal_t * signals[], const int16_t * y_act, uint8_t count){
+	plot_t * plot = signals[0]->plot;
+	int32_t x_act = signals[0]->x_prev + plot->x_scale;
+	int16_t x_col = signals[0]->x_prev / 100;
+	int16_t dx = x_act / 100 - x_col;
+	int16_t y_border[RT_PLOT_SIGNALS_MAX];
+	uint8_t s;
+
+	if (count > RT_PLOT_SIGNALS_MAX){
+		count = RT_PLOT_SIGNALS_MAX;
+	}
+	/* Columns are drawn once the data reaches the next one, the segment crosses
+	the border between two columns at its middle */
+	for (int16_t c = 0; c < dx; c++){
+		for (s = 0; s < count; s++){
+			y_border[s] = signals[s]->y_prev + ((y_act[s] - signals[s]->y_prev) * (2 * c + 1)) / (2 * dx);
+			if (y_border[s] < signals[s]->y_min){
+				signals[s]->y_min = y_border[s];
+			}
+			if (y_border[s] > signals[s]->y_max){
+				signals[s]->y_max = y_border[s];
+			}
+		}
+		if (x_col >= plot->x_pos + plot->width){
+			x_col -= plot->width;
+		}
+		DrawColumn(plot, x_col++, signals, count);
+		for (s = 0; s < count; s++){
+			signals[s]->y_min = y_border[s];
+			signals[s]->y_max = y_border[s];
+		}
+	}
+	/* Columns are reused from the left once the right end is reached */
+	if (x_act >= (plot->x_pos + plot->width) * 100){
+		x_act -= plot->width * 100;
+	}
+	for (s = 0; s < count; s++){
+		if (y_act[s] < signals[s]->y_min){
+			signals[s]->y_min = y_act[s];
+		}
+		if (y_act[s] > signals[s]->y_max){
+			signals[s]->y_max = y_act[s];
+		}
+		signals[s]->x_prev = x_act;
+		signals[s]->y_prev = y_act[s];
+	}
+}
 
 /*==================[external functions definition]==========================*/
 void RTPlotInit(plot_t * plot){
 	ILI9341DrawFilledRectangle(plot->x_pos, plot->y_pos,
 			plot->x_pos + plot->width, plot->y_pos + plot->height,
 			plot->back_color);
-
+	if (plot->mode == RT_PLOT_SCROLL){
+		ILI9341ScrollArea(plot->x_pos, plot->width);
+	}
 }
 
 void RTSignalInit(plot_t * plot, signal_t * signal){
 	signal->x_prev = plot->x_pos * 100;
 	signal->y_prev = plot->y_pos + plot->height - signal->y_offset;
+	signal->y_min = signal->y_prev;
+	signal->y_max = signal->y_prev;
 	signal->plot = plot;
 }
 
@@ -42,13 +165,10 @@ void RTPlotDraw(signal_t * signal, int16_t data){
     int16_t x_act, y_act, blanck_act;
     plot_t * plot = signal->plot;
     /* next point to draw */
-    y_act = plot->y_pos + plot->height - (data * signal->y_scale) / 100 - signal->y_offset;
-    /* it can exceed plot limits */
-    if (y_act < plot->y_pos){
-        y_act = plot->y_pos;
-    }
-    if (y_act > (plot->y_pos + plot->height)){
-        y_act = plot->y_pos + plot->height;
+    y_act = DataRow(signal, data);
+    if (plot->mode == RT_PLOT_SCROLL){
+        ColumnsDraw(&signal, &y_act, 1);
+        return;
     }
     /* when reach right limit it start again from left */
     x_act = signal->x_prev + plot->x_scale;
@@ -75,4 +195,15 @@ void RTPlotDraw(signal_t * signal, int16_t data){
     signal->y_prev = y_act;
 }
 
+void RTPlotDrawSignals(signal_t * signals[], const int16_t * data, uint8_t count){
+	int16_t y_act[RT_PLOT_SIGNALS_MAX];
+	if (count > RT_PLOT_SIGNALS_MAX){
+		count = RT_PLOT_SIGNALS_MAX;
+	}
+	for (uint8_t s = 0; s < count; s++){
+		y_act[s] = DataRow(signals[s], data[s]);
+	}
+	ColumnsDraw(signals, y_act, count);
+}
+
 /*==================[end of file]============================================*/
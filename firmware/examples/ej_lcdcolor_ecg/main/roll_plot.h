@@ -18,14 +18,28 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 04/04/2024 | Document creation		                         						|
+ * | 18/10/2026 | Scrolling plot with the hardware scroll of the LCD						|
+ * | 18/10/2026 | Several signals per plot drawn by columns								|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdint.h>
 /*==================[macros]=================================================*/
+#define RT_PLOT_SIGNALS_MAX	8		/*!< Maximum number of signals drawn together by RTPlotDrawSignals */
 
 /*==================[typedef]================================================*/
+/**
+ * @brief Ways of drawing the new data
+ */
+typedef enum{
+	RT_PLOT_ROLL = 0,	/*!< Data is drawn from left to right and starts again from the left, erasing ahead */
+	RT_PLOT_SCROLL,		/*!< Newest data is at the right and the plot moves left with the hardware scroll of
+							the LCD. Only for landscape orientations, the columns of the plot scroll from the
+							top to the bottom of the LCD. Draws directly on the LCD, not in a framebuffer.
+							Several signals must be drawn together with RTPlotDrawSignals */
+} plot_mode_t;
+
 /**
  * @brief 
  * 
@@ -37,6 +51,7 @@ typedef struct{
     uint16_t height; 	/*!< plot height */
     uint16_t x_scale;	/*!< x scale in % (number of pixels drawn per 100 data samples) */
     uint16_t back_color;/*!< plot background color */
+    plot_mode_t mode;	/*!< RT_PLOT_ROLL if not set */
 } plot_t;
 
 /**
@@ -49,6 +64,8 @@ typedef struct{
 	uint16_t color;		/*!< plot color */
 	uint16_t x_prev;	/*!< x position of last point drawn */
 	uint16_t y_prev;	/*!< y position of last point drawn */
+	uint16_t y_min;		/*!< top of the column not drawn yet, when drawn by columns */
+	uint16_t y_max;		/*!< bottom of the column not drawn yet, when drawn by columns */
 	plot_t * plot;		/*!< plot in which the signal'll be drawn */
 } signal_t;
 
@@ -77,10 +94,23 @@ void RTSignalInit(plot_t * plot, signal_t * signal);
  * @param[in]  	signal: Structure with the signal configuration
  * @param[in]	data: Data value to draw in plot
  * @return  	None
- * @note
+ * @note		In RT_PLOT_SCROLL mode each column is sent as a single window, background and
+ * 				trace, once the data reaches the next column
  */
 void RTPlotDraw(signal_t * signal, int16_t data);
 
+/**
+ * @brief		Draws a new data value of several signals of the same plot
+ * @param[in]  	signals: Signals, initialized with the same plot one after the other
+ * @param[in]	data: Data value of each signal
+ * @param[in]	count: Number of signals, up to RT_PLOT_SIGNALS_MAX
+ * @return  	None
+ * @note		Each column of the plot is sent once, with the background and the traces of all
+ * 				the signals, the last one on top. The bytes sent do not depend on the number of
+ * 				signals. In RT_PLOT_ROLL mode the blank column ahead goes in the same window.
+ */
+void RTPlotDrawSignals(signal_t * signals[], const int16_t * data, uint8_t count);
+
 #endif /* ROLL_PLOT_H_ */
 
 /*==================[end of file]============================================*/
@@ -18,6 +18,9 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 21/05/2024 | Document creation		                         |
+ * | 18/10/2026 | Streaming HR/SPO2 calculation                  |
+ * | 18/10/2026 | PPG capture output for test_spo2_algorithm     |
+ * | 18/10/2026 | Optional HR/SPO2 calculation benchmark         |
  *
  * @author Juan Ignacio Cerrudo (juan.cerrudo@uner.edu.ar)
  *
@@ -27,28 +30,72 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <math.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include <iir_filter.h>
 #include <max3010x.h>
 #include "spo2_algorithm.h"
 #include "led.h"
+#include "esp_timer.h"
 /*==================[macros and definitions]=================================*/
 #define BUFFER_SIZE 256
 #define SAMPLE_FREQ	100
 #define CONFIG_BLINK_PERIOD 100
+/* Descomentar para enviar por UART una línea "red ir" por muestra y registrar una captura para test_spo2_algorithm */
+// #define PPG_CAPTURE
+#ifdef PPG_CAPTURE
+#define SAMPLE_AVERAGE 4	/* 100 Hz / 4 = FreqS, la frecuencia de muestreo del algoritmo */
+#else
+#define SAMPLE_AVERAGE 1
+#endif
+/* Descomentar para medir el tiempo de cálculo de HR/SPO2 al inicio */
+// #define SPO2_BENCHMARK
+#define BENCHMARK_LEN (FreqS * 4)
+#define BENCHMARK_REPEAT 100
 /*==================[internal data definition]===============================*/
 float dato_filt;
 float dato;
 
-uint32_t irBuffer[100]; //infrared LED sensor data
-uint32_t redBuffer[100];  //red LED sensor data
-int32_t bufferLength=100; //data length
+maxim_spo2_stream_t spo2Stream; //heart rate/SPO2 calculation state
 int32_t spo2; //SPO2 value
 int8_t validSPO2; //indicator to show if the SPO2 calculation is valid
 int32_t heartRate; //heart rate value
 int8_t validHeartRate; //indicator to show if the heart rate calculation is valid
 /*==================[internal functions declaration]=========================*/
+#ifdef SPO2_BENCHMARK
+/**
+ * @brief Mide el tiempo de cálculo de HR/SPO2 sobre una señal PPG sintética
+ * de 72 lpm, con el algoritmo por bloques y con el algoritmo continuo.
+ */
+static void SpO2Benchmark(void){
+    static uint32_t ir[BENCHMARK_LEN], red[BENCHMARK_LEN];
+    maxim_spo2_stream_t stream;
+    int32_t spo2, heartRate;
+    int8_t validSPO2, validHeartRate;
+    for(uint8_t i = 0; i < BENCHMARK_LEN; i++){
+        float pulse = sinf(2 * M_PI * 1.2f * i / FreqS);
+        ir[i] = 120000 - 1000 * pulse;
+        red[i] = 90000 - 500 * pulse;
+    }
+    int64_t start = esp_timer_get_time();
+    for(uint8_t r = 0; r < BENCHMARK_REPEAT; r++){
+        maxim_heart_rate_and_oxygen_saturation(ir, BENCHMARK_LEN, red, &spo2, &validSPO2, &heartRate, &validHeartRate);
+    }
+    int64_t batch = (esp_timer_get_time() - start) / BENCHMARK_REPEAT;
+    maxim_spo2_stream_init(&stream);
+    start = esp_timer_get_time();
+    for(uint8_t r = 0; r < BENCHMARK_REPEAT; r++){
+        for(uint8_t i = 0; i < BENCHMARK_LEN; i++){
+            maxim_spo2_stream_add(&stream, ir[i], red[i]);
+        }
+    }
+    int64_t sample = (esp_timer_get_time() - start) * 1000 / (BENCHMARK_REPEAT * BENCHMARK_LEN);
+    printf("Bloque de %d muestras: %lld us, HR= %ld, SPO2= %ld\n", BENCHMARK_LEN, batch, heartRate, spo2);
+    maxim_spo2_stream_result(&stream, &spo2, &validSPO2, &heartRate, &validHeartRate);
+    printf("Continuo: %lld ns por muestra, HR= %ld, SPO2= %ld\n", sample, heartRate, spo2);
+}
+#endif
 
 /*==================[external functions definition]==========================*/
 void app_main(void){
@@ -56,37 +103,38 @@ void app_main(void){
 	HiPassInit(SAMPLE_FREQ, 1, ORDER_4);
     LedsInit();
     MAX3010X_begin();
-	MAX3010X_setup( 30, 1 , 2, SAMPLE_FREQ, 69, 4096);
+	MAX3010X_setup( 30, SAMPLE_AVERAGE , 2, SAMPLE_FREQ, 69, 4096);
     /* Se imprimen por consola los valores de frequencia y magnitud correspondiente */
     printf("****MAX30102 Test****\n");
+#ifdef SPO2_BENCHMARK
+    SpO2Benchmark();
+#endif
 
+    maxim_spo2_stream_init(&spo2Stream);
     while(1){
         uint8_t i;
-	    for (i = 25; i < 100; i++)
-	    {
-		    redBuffer[i - 25] = redBuffer[i];
-		    irBuffer[i - 25] = irBuffer[i];
-	    }
-
-	    //take 25 sets of samples before calculating the heart rate.
-	    for ( i = 75; i < 100; i++)
+	    //take 25 sets of samples before showing the heart rate.
+	    for ( i = 0; i < 25; i++)
 	    {
 		    while (MAX3010X_available() == false) //do we have new data?
 			    MAX3010X_check(); //Check the sensor for new data
-            
-		    redBuffer[i] = MAX3010X_getRed();
-		    irBuffer[i] = MAX3010X_getIR();
+
+		    uint32_t red = MAX3010X_getRed();
+		    uint32_t ir = MAX3010X_getIR();
 		    MAX3010X_nextSample(); //We're finished with this sample so move to next sample
-		            
+		    maxim_spo2_stream_add(&spo2Stream, ir, red);
+#ifdef PPG_CAPTURE
+		    printf("%lu %lu\n", red, ir);
+#endif
+
             //send samples and calculation result to terminal program through UART
-	     	dato = (float)redBuffer[i];
+	     	dato = (float)red;
 			HiPassFilter(&dato, &dato_filt, 1);
-	        //printf("%ld,%2.2f,%ld\n", redBuffer[i], dato_filt, heartRate);
-             
+	        //printf("%ld,%2.2f,%ld\n", red, dato_filt, heartRate);
 	}
 
-	//After gathering 25 new samples recalculate HR and SP02
-	maxim_heart_rate_and_oxygen_saturation(irBuffer, bufferLength, redBuffer, &spo2, &validSPO2, &heartRate, &validHeartRate);
+	//HR and SP02 of the last 100 samples, updated with each sample
+	maxim_spo2_stream_result(&spo2Stream, &spo2, &validSPO2, &heartRate, &validHeartRate);
     printf("HR= %ld, HRvalid= %d \n", heartRate, validHeartRate);
     printf("SPO2= %ld, SPO2Valid= %d \n", spo2, validSPO2);
 	LedToggle(LED_1);
@@ -37,18 +37,24 @@ extern "C"
 #include "dsps_d_gen.h"
 #include "dsps_h_gen.h"
 #include "dsps_tone_gen.h"
+#include "dsps_sig_gen.h"
 #include "dsps_snr.h"
 #include "dsps_sfdr.h"
+#include "dsps_quality.h"
 
 #include "dsps_fft2r.h"
 #include "dsps_fft4r.h"
 #include "dsps_dct.h"
 
+// Attitude estimation
+#include "dsps_ahrs.h"
+
 // Matrix operations
 #include "dspm_matrix.h"
 
 // Support functions
 #include "dsps_view.h"
+#include "dsps_export.h"
 
 // Image processing functions:
 #include "dspi_dotprod.h"
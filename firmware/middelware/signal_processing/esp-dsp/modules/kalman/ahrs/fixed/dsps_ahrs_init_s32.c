@@ -0,0 +1,103 @@
+/**
+ * @file dsps_ahrs_init_s32.c
+ * @brief Initialization and fixed-point quaternion helpers of the Mahony and Madgwick filters
+ */
+
+#include "dsps_ahrs.h"
+
+// 1/sqrt(x) in Q29 for the middle of the interval x = [i/64 .. (i + 1)/64), i = 16..63
+static const int32_t ahrs_inv_sqrt_table[48] = {
+    1057347856, 1026693558, 998559613, 972618566, 948599586, 926276469,
+    905458609, 885984104, 867714429, 850530263, 834328203, 819018128,
+    804521086, 790767575, 777696137, 765252196, 753387102, 742057327,
+    731223792, 720851298, 710908045, 701365222, 692196655, 683378504,
+    674889000, 666708225, 658817909, 651201261, 643842818, 636728315,
+    629844563, 623179354, 616721362, 610460069, 604385689, 598489102,
+    592761802, 587195840, 581783781, 576518662, 571393950, 566403514,
+    561541591, 556802759, 552181909, 547674226, 543275165, 538980433,
+};
+
+static esp_err_t ahrs_init_common(ahrs_s32_t *ahrs, float dt)
+{
+    if ((dt <= 0) || (dt >= 1)) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    ahrs->q[0] = 1 << 30;
+    for (int i = 1; i < 4; i++) {
+        ahrs->q[i] = 0;
+    }
+    for (int i = 0; i < 3; i++) {
+        ahrs->e_int[i] = 0;
+    }
+    ahrs->half_dt = (int32_t)(dt * 0.5f * 2147483648.0f);
+    ahrs->kp = 0;
+    ahrs->ki_dt = 0;
+    ahrs->beta_dt = 0;
+    return ESP_OK;
+}
+
+esp_err_t dsps_ahrs_mahony_init_s32(ahrs_s32_t *ahrs, float dt, float kp, float ki)
+{
+    esp_err_t ret = ahrs_init_common(ahrs, dt);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    if ((kp < 0) || (kp >= 32768) || (ki < 0) || (ki * dt >= 1)) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    ahrs->kp = (int32_t)(kp * 65536.0f);
+    ahrs->ki_dt = (int32_t)(ki * dt * 2147483648.0f);
+    return ESP_OK;
+}
+
+esp_err_t dsps_ahrs_madgwick_init_s32(ahrs_s32_t *ahrs, float dt, float beta)
+{
+    esp_err_t ret = ahrs_init_common(ahrs, dt);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    if ((beta < 0) || (beta * dt >= 1)) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    ahrs->beta_dt = (int32_t)(beta * dt * 2147483648.0f);
+    return ESP_OK;
+}
+
+esp_err_t dsps_ahrs_normalize_s32(const int32_t *input, int32_t *output, int len)
+{
+    uint64_t sum = 0;
+    for (int i = 0; i < len; i++) {
+        sum += (int64_t)input[i] * input[i];
+    }
+    if (sum == 0) {
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    // Scale the sum by even shift to the range [2^60 .. 2^62)
+    int shift = (__builtin_clzll(sum) - 2) & ~1;
+    uint64_t sum_n = shift >= 0 ? sum << shift : sum >> -shift;
+    // x = sum_n / 2^62 in Q30, range [0.25 .. 1)
+    int32_t x = (int32_t)(sum_n >> 32);
+
+    // y = 1/sqrt(x) in Q29: table and two Newton iterations y = y * (3 - x*y^2) / 2
+    int32_t y = ahrs_inv_sqrt_table[(x >> 24) - 16];
+    for (int n = 0; n < 2; n++) {
+        int64_t y2 = ((int64_t)y * y) >> 29;
+        int64_t t = (3LL << 29) - ((x * y2) >> 30);
+        y = (int32_t)((y * t) >> 30);
+    }
+
+    // 1/sqrt(sum) = y * 2^(shift/2 - 31), output in Q30
+    int out_shift = 30 - shift / 2;
+    for (int i = 0; i < len; i++) {
+        int64_t val = (int64_t)input[i] * y;
+        output[i] = (int32_t)(out_shift >= 0 ? val >> out_shift : val << -out_shift);
+    }
+    return ESP_OK;
+}
+
+void dsps_ahrs_get_quat_s32(const ahrs_s32_t *ahrs, float q[4])
+{
+    for (int i = 0; i < 4; i++) {
+        q[i] = ahrs->q[i] * (1.0f / (1 << 30));
+    }
+}
@@ -0,0 +1,50 @@
+/**
+ * @file dsps_ahrs_madgwick_s32.c
+ * @brief Fixed-point Madgwick attitude update from gyroscope and accelerometer
+ */
+
+#include "dsps_ahrs.h"
+
+// Product of Q30 and Q29 values in Q55, with headroom for the sum of the gradient terms
+#define AHRS_QF(a, b) (((int64_t)(a) * (b)) >> 4)
+
+esp_err_t dsps_ahrs_madgwick_s32(ahrs_s32_t *ahrs, const int32_t gyro[3], const int32_t accel[3])
+{
+    int32_t *q = ahrs->q;
+
+    // q = q + 0.5 * q * [0, w] * dt
+    int32_t h[3]; // w*dt/2, Q30
+    for (int i = 0; i < 3; i++) {
+        h[i] = (int32_t)(((int64_t)gyro[i] * ahrs->half_dt) >> 17);
+    }
+    int32_t qn[4];
+    qn[0] = q[0] + (int32_t)((-(int64_t)q[1] * h[0] - (int64_t)q[2] * h[1] - (int64_t)q[3] * h[2]) >> 30);
+    qn[1] = q[1] + (int32_t)(((int64_t)q[0] * h[0] + (int64_t)q[2] * h[2] - (int64_t)q[3] * h[1]) >> 30);
+    qn[2] = q[2] + (int32_t)(((int64_t)q[0] * h[1] - (int64_t)q[1] * h[2] + (int64_t)q[3] * h[0]) >> 30);
+    qn[3] = q[3] + (int32_t)(((int64_t)q[0] * h[2] + (int64_t)q[1] * h[1] - (int64_t)q[2] * h[0]) >> 30);
+
+    int32_t a[3];
+    if (dsps_ahrs_normalize_s32(accel, a, 3) == ESP_OK) {
+        // Objective function f = v(q) - a, where v(q) is estimated direction of gravity, Q29
+        int32_t f[3];
+        f[0] = (int32_t)((((((int64_t)q[1] * q[3]) - ((int64_t)q[0] * q[2])) >> 29) - a[0]) >> 1);
+        f[1] = (int32_t)((((((int64_t)q[0] * q[1]) + ((int64_t)q[2] * q[3])) >> 29) - a[1]) >> 1);
+        f[2] = (int32_t)(((((1LL << 60) - 2 * ((int64_t)q[1] * q[1]) - 2 * ((int64_t)q[2] * q[2])) >> 30) - a[2]) >> 1);
+
+        // Gradient s = J' * f, Q26
+        int32_t s[4];
+        s[0] = (int32_t)((-2 * AHRS_QF(q[2], f[0]) + 2 * AHRS_QF(q[1], f[1])) >> 29);
+        s[1] = (int32_t)((2 * AHRS_QF(q[3], f[0]) + 2 * AHRS_QF(q[0], f[1]) - 4 * AHRS_QF(q[1], f[2])) >> 29);
+        s[2] = (int32_t)((-2 * AHRS_QF(q[0], f[0]) + 2 * AHRS_QF(q[3], f[1]) - 4 * AHRS_QF(q[2], f[2])) >> 29);
+        s[3] = (int32_t)((2 * AHRS_QF(q[1], f[0]) + 2 * AHRS_QF(q[2], f[1])) >> 29);
+
+        // q = q - beta * dt * s/|s|
+        if (dsps_ahrs_normalize_s32(s, s, 4) == ESP_OK) {
+            for (int i = 0; i < 4; i++) {
+                qn[i] -= (int32_t)(((int64_t)s[i] * ahrs->beta_dt) >> 31);
+            }
+        }
+    }
+
+    return dsps_ahrs_normalize_s32(qn, q, 4);
+}
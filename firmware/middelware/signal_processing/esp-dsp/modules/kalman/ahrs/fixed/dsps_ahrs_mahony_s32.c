@@ -0,0 +1,45 @@
+/**
+ * @file dsps_ahrs_mahony_s32.c
+ * @brief Fixed-point Mahony attitude update from gyroscope and accelerometer
+ */
+
+#include "dsps_ahrs.h"
+
+esp_err_t dsps_ahrs_mahony_s32(ahrs_s32_t *ahrs, const int32_t gyro[3], const int32_t accel[3])
+{
+    int32_t *q = ahrs->q;
+    int32_t w[3] = {gyro[0], gyro[1], gyro[2]}; // rad/sec, Q16
+
+    int32_t a[3];
+    if (dsps_ahrs_normalize_s32(accel, a, 3) == ESP_OK) {
+        // Estimated direction of gravity, Q30
+        int32_t v[3];
+        v[0] = (int32_t)((((int64_t)q[1] * q[3]) - ((int64_t)q[0] * q[2])) >> 29);
+        v[1] = (int32_t)((((int64_t)q[0] * q[1]) + ((int64_t)q[2] * q[3])) >> 29);
+        v[2] = (int32_t)((((int64_t)q[0] * q[0]) - ((int64_t)q[1] * q[1]) - ((int64_t)q[2] * q[2]) + ((int64_t)q[3] * q[3])) >> 30);
+
+        // Error is cross product between measured and estimated direction of gravity, Q30
+        int32_t e[3];
+        e[0] = (int32_t)((((int64_t)a[1] * v[2]) - ((int64_t)a[2] * v[1])) >> 30);
+        e[1] = (int32_t)((((int64_t)a[2] * v[0]) - ((int64_t)a[0] * v[2])) >> 30);
+        e[2] = (int32_t)((((int64_t)a[0] * v[1]) - ((int64_t)a[1] * v[0])) >> 30);
+
+        for (int i = 0; i < 3; i++) {
+            ahrs->e_int[i] += (int32_t)(((int64_t)e[i] * ahrs->ki_dt) >> 31);
+            w[i] += (int32_t)(((int64_t)e[i] * ahrs->kp) >> 30) + (ahrs->e_int[i] >> 14);
+        }
+    }
+
+    // q = q + 0.5 * q * [0, w] * dt
+    int32_t h[3]; // w*dt/2, Q30
+    for (int i = 0; i < 3; i++) {
+        h[i] = (int32_t)(((int64_t)w[i] * ahrs->half_dt) >> 17);
+    }
+    int32_t qn[4];
+    qn[0] = q[0] + (int32_t)((-(int64_t)q[1] * h[0] - (int64_t)q[2] * h[1] - (int64_t)q[3] * h[2]) >> 30);
+    qn[1] = q[1] + (int32_t)(((int64_t)q[0] * h[0] + (int64_t)q[2] * h[2] - (int64_t)q[3] * h[1]) >> 30);
+    qn[2] = q[2] + (int32_t)(((int64_t)q[0] * h[1] - (int64_t)q[1] * h[2] + (int64_t)q[3] * h[0]) >> 30);
+    qn[3] = q[3] + (int32_t)(((int64_t)q[0] * h[2] + (int64_t)q[1] * h[1] - (int64_t)q[2] * h[0]) >> 30);
+
+    return dsps_ahrs_normalize_s32(qn, q, 4);
+}
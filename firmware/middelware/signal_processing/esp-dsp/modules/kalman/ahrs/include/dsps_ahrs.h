@@ -0,0 +1,120 @@
+/**
+ * @file dsps_ahrs.h
+ * @brief Fixed-point Mahony and Madgwick attitude estimators for IMUs without magnetometer
+ */
+
+#ifndef _dsps_ahrs_H_
+#define _dsps_ahrs_H_
+
+#include "dsp_err.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * Convert float value to Q16 fixed point format, used for gyroscope and accelerometer inputs.
+ */
+#define DSPS_AHRS_Q16(x) ((int32_t)((x) * 65536.0f))
+
+/**
+ * @brief Data struct of s32 AHRS filter
+ *
+ * Lightweight attitude estimator for IMU without magnetometer: Mahony or Madgwick filter in fixed point.
+ * The quaternion and input conventions are the same as for ekf_imu13states:
+ * qdot = 0.5 * q * [0, w], gyroscope in rad/sec, accelerometer in g,
+ * gravity vector in sensor frame = {2*(q1*q3 - q0*q2), 2*(q0*q1 + q2*q3), q0^2 - q1^2 - q2^2 + q3^2}.
+ *
+ * All fields of this structure are initialized by the dsps_ahrs_mahony_init_s32(...) or
+ * dsps_ahrs_madgwick_init_s32(...) functions.
+ */
+typedef struct ahrs_s32_s {
+    int32_t q[4];       /*!< Attitude quaternion, Q30.*/
+    int32_t e_int[3];   /*!< Mahony: integral of the error, estimation of gyroscope bias with negative sign, rad/sec Q30.*/
+    int32_t half_dt;    /*!< Half of the sample period, sec Q31.*/
+    int32_t kp;         /*!< Mahony: proportional gain, Q16.*/
+    int32_t ki_dt;      /*!< Mahony: integral gain multiplied by the sample period, Q31.*/
+    int32_t beta_dt;    /*!< Madgwick: gain multiplied by the sample period, Q31.*/
+} ahrs_s32_t;
+
+/**
+ * @brief   initialize structure for s32 Mahony filter
+ *
+ * Function set attitude quaternion to {1, 0, 0, 0} and clear the integral of the error.
+ *
+ * @param ahrs: pointer to the filter structure, that must be preallocated
+ * @param dt: sample period in seconds, must be less than 1
+ * @param kp: proportional gain, typical value is 1..2
+ * @param ki: integral gain, typical value is 0..0.1. Value 0 disables gyroscope bias estimation
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_ahrs_mahony_init_s32(ahrs_s32_t *ahrs, float dt, float kp, float ki);
+
+/**
+ * @brief   initialize structure for s32 Madgwick filter
+ *
+ * Function set attitude quaternion to {1, 0, 0, 0}.
+ *
+ * @param ahrs: pointer to the filter structure, that must be preallocated
+ * @param dt: sample period in seconds, must be less than 1
+ * @param beta: gain of the gradient step, rad/sec. Typical value is 0.05..0.2
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_ahrs_madgwick_init_s32(ahrs_s32_t *ahrs, float dt, float beta);
+
+/**@{*/
+/**
+ * @brief   s32 Mahony and Madgwick filters update
+ *
+ * Functions integrate gyroscope measurement and correct attitude by accelerometer measurement.
+ * If accelerometer vector is zero, only gyroscope integration is done.
+ * The implementation use ANSI C and could be compiled and run on any platform
+ *
+ * @param ahrs: pointer to the filter structure, that must be initialized before
+ * @param[in] gyro: gyroscope measurement XYZ in rad/sec, Q16
+ * @param[in] accel: accelerometer measurement XYZ in g, Q16. Absolute values must be less than 2^30
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_ahrs_mahony_s32(ahrs_s32_t *ahrs, const int32_t gyro[3], const int32_t accel[3]);
+esp_err_t dsps_ahrs_madgwick_s32(ahrs_s32_t *ahrs, const int32_t gyro[3], const int32_t accel[3]);
+/**@}*/
+
+/**
+ * @brief   normalize vector to unit length
+ *
+ * Function normalizes vector without division and floating point operations.
+ * Input and output could be the same array.
+ *
+ * @param[in] input: input vector, absolute values must be less than 2^30
+ * @param[out] output: unit vector, Q30
+ * @param len: length of the vector, up to 4
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_DSP_INVALID_PARAM if input vector is zero
+ */
+esp_err_t dsps_ahrs_normalize_s32(const int32_t *input, int32_t *output, int len);
+
+/**
+ * @brief   get attitude quaternion of the filter as float values
+ *
+ * @param ahrs: pointer to the filter structure
+ * @param[out] q: attitude quaternion
+ */
+void dsps_ahrs_get_quat_s32(const ahrs_s32_t *ahrs, float q[4]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _dsps_ahrs_H_
@@ -0,0 +1,162 @@
+/**
+ * @file test_dsps_ahrs_s32.cpp
+ * @brief Tests of the fixed-point Mahony and Madgwick filters
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "unity.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dsps_ahrs.h"
+#include "ekf_imu13states.h"
+#include "sdkconfig.h"
+#include "test_imu_replay.h"
+
+#ifndef CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ
+#define CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ 160
+#endif
+
+static const char *TAG = "dsps_ahrs";
+
+// MPU6050 raw samples to Q16: gyroscope 131 LSB per deg/sec, accelerometer 16384 LSB per g
+#define TEST_GYRO_RAW_TO_Q16(x)     (((int32_t)(x) * 35764) >> 12)
+#define TEST_ACCEL_RAW_TO_Q16(x)    ((int32_t)(x) * 4)
+
+TEST_CASE("dsps_ahrs_normalize_s32 functionality", "[dsps]")
+{
+    srand(1);
+    for (int n = 0 ; n < 1000 ; n++) {
+        int32_t v[4];
+        int32_t v_norm[4];
+        int len = 3 + (n & 1);
+        // Vectors from very short to the maximum length
+        int shift = n % 30;
+        float norm = 0;
+        for (int i = 0 ; i < len ; i++) {
+            v[i] = (rand() - RAND_MAX / 2) >> shift;
+            norm += (float)v[i] * v[i];
+        }
+        norm = sqrtf(norm);
+        if (dsps_ahrs_normalize_s32(v, v_norm, len) != ESP_OK) {
+            TEST_ASSERT_EQUAL(0, norm);
+            continue;
+        }
+        for (int i = 0 ; i < len ; i++) {
+            TEST_ASSERT_FLOAT_WITHIN(1e-5, v[i] / norm, v_norm[i] / (float)(1 << 30));
+        }
+    }
+}
+
+static void mahony_update(void *ctx, const int16_t sample[6])
+{
+    int32_t gyro[3];
+    int32_t accel[3];
+    for (int i = 0 ; i < 3 ; i++) {
+        gyro[i] = TEST_GYRO_RAW_TO_Q16(sample[i]);
+        accel[i] = TEST_ACCEL_RAW_TO_Q16(sample[3 + i]);
+    }
+    dsps_ahrs_mahony_s32((ahrs_s32_t *)ctx, gyro, accel);
+}
+
+static void madgwick_update(void *ctx, const int16_t sample[6])
+{
+    int32_t gyro[3];
+    int32_t accel[3];
+    for (int i = 0 ; i < 3 ; i++) {
+        gyro[i] = TEST_GYRO_RAW_TO_Q16(sample[i]);
+        accel[i] = TEST_ACCEL_RAW_TO_Q16(sample[3 + i]);
+    }
+    dsps_ahrs_madgwick_s32((ahrs_s32_t *)ctx, gyro, accel);
+}
+
+static void ahrs_gravity(void *ctx, float gravity[3])
+{
+    float q[4];
+    dsps_ahrs_get_quat_s32((ahrs_s32_t *)ctx, q);
+    gravity[0] = 2 * (q[1] * q[3] - q[0] * q[2]);
+    gravity[1] = 2 * (q[2] * q[3] + q[0] * q[1]);
+    gravity[2] = q[0] * q[0] - q[1] * q[1] - q[2] * q[2] + q[3] * q[3];
+}
+
+TEST_CASE("dsps_ahrs_mahony_s32 replay MPU6050 log", "[dsps]")
+{
+    ahrs_s32_t ahrs;
+    TEST_ASSERT_EQUAL(ESP_OK, dsps_ahrs_mahony_init_s32(&ahrs, 1.0f / TEST_IMU_LOG_FS, 2.0f, 0.1f));
+    test_imu_estimator_t estimator = {"dsps_ahrs_mahony_s32", &ahrs, mahony_update, ahrs_gravity};
+    test_imu_replay_result_t result;
+
+    test_imu_replay(&estimator, &result);
+    TEST_ASSERT_LESS_THAN(2, (int)result.tilt_err_rms);
+    TEST_ASSERT_LESS_THAN(CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ * 1000000 / TEST_IMU_LOG_FS, result.cycles);
+}
+
+TEST_CASE("dsps_ahrs_madgwick_s32 replay MPU6050 log", "[dsps]")
+{
+    ahrs_s32_t ahrs;
+    TEST_ASSERT_EQUAL(ESP_OK, dsps_ahrs_madgwick_init_s32(&ahrs, 1.0f / TEST_IMU_LOG_FS, 0.1f));
+    test_imu_estimator_t estimator = {"dsps_ahrs_madgwick_s32", &ahrs, madgwick_update, ahrs_gravity};
+    test_imu_replay_result_t result;
+
+    test_imu_replay(&estimator, &result);
+    TEST_ASSERT_LESS_THAN(2, (int)result.tilt_err_rms);
+    TEST_ASSERT_LESS_THAN(CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ * 1000000 / TEST_IMU_LOG_FS, result.cycles);
+}
+
+struct ekf_replay_ctx {
+    ekf_imu13states *ekf13;
+    float R[3];
+};
+
+static void ekf_update(void *ctx, const int16_t sample[6])
+{
+    ekf_replay_ctx *c = (ekf_replay_ctx *)ctx;
+    float gyro[3];
+    float accel[3];
+    for (int i = 0 ; i < 3 ; i++) {
+        gyro[i] = sample[i] * TEST_IMU_LOG_GYRO_SCALE;
+        accel[i] = sample[3 + i] * TEST_IMU_LOG_ACCEL_SCALE;
+    }
+    c->ekf13->Process(gyro, 1.0f / TEST_IMU_LOG_FS);
+    c->ekf13->UpdateRefMeasurementAccel(accel, c->R);
+}
+
+static void ekf_gravity(void *ctx, float gravity[3])
+{
+    float *q = ((ekf_replay_ctx *)ctx)->ekf13->X.data;
+    gravity[0] = 2 * (q[1] * q[3] - q[0] * q[2]);
+    gravity[1] = 2 * (q[2] * q[3] + q[0] * q[1]);
+    gravity[2] = q[0] * q[0] - q[1] * q[1] - q[2] * q[2] + q[3] * q[3];
+}
+
+TEST_CASE("dsps_ahrs_s32 and ekf_imu13states comparison", "[dsps]")
+{
+    ahrs_s32_t mahony;
+    ahrs_s32_t madgwick;
+    dsps_ahrs_mahony_init_s32(&mahony, 1.0f / TEST_IMU_LOG_FS, 2.0f, 0.1f);
+    dsps_ahrs_madgwick_init_s32(&madgwick, 1.0f / TEST_IMU_LOG_FS, 0.1f);
+    ekf_imu13states *ekf13 = new  ekf_imu13states();
+    ekf13->Init();
+    ekf_replay_ctx ekf_ctx = {ekf13, {0.01, 0.01, 0.01}};
+
+    test_imu_estimator_t estimators[3] = {
+        {"ekf_imu13states", &ekf_ctx, ekf_update, ekf_gravity},
+        {"dsps_ahrs_mahony_s32", &mahony, mahony_update, ahrs_gravity},
+        {"dsps_ahrs_madgwick_s32", &madgwick, madgwick_update, ahrs_gravity},
+    };
+    test_imu_replay_result_t results[3];
+    for (int i = 0 ; i < 3 ; i++) {
+        test_imu_replay(&estimators[i], &results[i]);
+    }
+    delete ekf13;
+
+    ESP_LOGI(TAG, "%-24s %10s %10s %10s", "estimator", "rms, deg", "max, deg", "cycles");
+    for (int i = 0 ; i < 3 ; i++) {
+        ESP_LOGI(TAG, "%-24s %10.3f %10.3f %10i", estimators[i].name, results[i].tilt_err_rms, results[i].tilt_err_max, results[i].cycles);
+    }
+    // Lightweight filters must be much faster than EKF
+    TEST_ASSERT_LESS_THAN(results[0].cycles, results[1].cycles * 4);
+    TEST_ASSERT_LESS_THAN(results[0].cycles, results[2].cycles * 4);
+}
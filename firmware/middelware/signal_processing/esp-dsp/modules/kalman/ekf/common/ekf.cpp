@@ -22,7 +22,16 @@ ekf::ekf(int x, int w) : NUMX(x),
     F(*new dspm::Mat(x, x)),
     G(*new dspm::Mat(x, w)),
     P(*new dspm::Mat(x, x)),
-    Q(*new dspm::Mat(w, w))
+    Q(*new dspm::Mat(w, w)),
+    F_blocks(NULL),
+    F_blocks_num(0),
+    G_blocks(NULL),
+    G_blocks_num(0),
+    Xlast(x, 1),
+    Xk(x, 1),
+    Xk_sum(x, 1),
+    FP(x, x),
+    GQ(x, w)
 {
 
     this->P *= 0;
@@ -45,8 +54,8 @@ ekf::~ekf()
     delete &P;
     delete &Q;
 
-    delete this->HP;
-    delete this->Km;
+    delete[] this->HP;
+    delete[] this->Km;
 }
 
 void ekf::Process(float *u, float dt)
@@ -58,23 +67,38 @@ void ekf::Process(float *u, float dt)
 
 void ekf::RungeKutta(dspm::Mat &x, float *U, float dt)
 {
-
     float dt2 = dt / 2.0f;
+    float *x_data = x.data;
+    float *x_last = this->Xlast.data;
+    float *k = this->Xk.data;
+    float *k_sum = this->Xk_sum.data;
+
+    this->Xlast = x;              // make a working copy
+    StateXdot(x, U, this->Xk);    // k1 = f(x, u)
+    for (int i = 0; i < this->NUMX; i++) {
+        k_sum[i] = k[i];
+        x_data[i] = x_last[i] + k[i] * dt2;
+    }
 
-    dspm::Mat Xlast = x;          // make a working copy
-    dspm::Mat K1 = StateXdot(x, U); // k1 = f(x, u)
-    x = Xlast + (K1 * dt2);
-
-    dspm::Mat K2 = StateXdot(x, U); // k2 = f(x + 0.5*dT*k1, u)
-    x = Xlast + K2 * dt2;
+    StateXdot(x, U, this->Xk);    // k2 = f(x + 0.5*dT*k1, u)
+    for (int i = 0; i < this->NUMX; i++) {
+        k_sum[i] += 2.0f * k[i];
+        x_data[i] = x_last[i] + k[i] * dt2;
+    }
 
-    dspm::Mat K3 = StateXdot(x, U); // k3 = f(x + 0.5*dT*k2, u)
-    x = Xlast + K3 * dt;
+    StateXdot(x, U, this->Xk);    // k3 = f(x + 0.5*dT*k2, u)
+    for (int i = 0; i < this->NUMX; i++) {
+        k_sum[i] += 2.0f * k[i];
+        x_data[i] = x_last[i] + k[i] * dt;
+    }
 
-    dspm::Mat K4 = StateXdot(x, U); // k4 = f(x + dT * k3, u)
+    StateXdot(x, U, this->Xk);    // k4 = f(x + dT * k3, u)
 
     // Xnew = X + dT * (k1 + 2 * k2 + 2 * k3 + k4) / 6
-    x = Xlast + (K1 + 2.0f * K2 + 2.0f * K3 + K4) * (dt / 6.0f);
+    float dt6 = dt / 6.0f;
+    for (int i = 0; i < this->NUMX; i++) {
+        x_data[i] = x_last[i] + (k_sum[i] + k[i]) * dt6;
+    }
 }
 
 dspm::Mat ekf::SkewSym4x4(float w[3])
@@ -135,21 +159,145 @@ dspm::Mat ekf::qProduct(float *q)
     return result;
 }
 
+void ekf::SetSparsity(const block_t *f_blocks, int f_num, const block_t *g_blocks, int g_num)
+{
+    this->F_blocks = f_blocks;
+    this->F_blocks_num = f_num;
+    this->G_blocks = g_blocks;
+    this->G_blocks_num = g_num;
+}
+
 void ekf::CovariancePrediction(float dt)
 {
-    dspm::Mat f = this->F * dt;
+    if ((this->F_blocks != NULL) && (this->G_blocks != NULL)) {
+        this->CovariancePredictionSparse(dt);
+    } else {
+        this->CovariancePredictionDense(dt);
+    }
+}
 
-    f = f + dspm::Mat::eye(this->NUMX);
+void ekf::CovariancePredictionSparse(float dt)
+{
+    // FP = f*P = P + dt*F*P
+    this->FP = this->P;
+    for (int b = 0; b < this->F_blocks_num; b++) {
+        const block_t &blk = this->F_blocks[b];
+        for (int i = blk.row; i < blk.row + blk.rows; i++) {
+            float *fp_row = &FP(i, 0);
+            for (int k = blk.col; k < blk.col + blk.cols; k++) {
+                float f_ik = dt * F(i, k);
+                const float *p_row = &P(k, 0);
+                for (int j = 0; j < this->NUMX; j++) {
+                    fp_row[j] += f_ik * p_row[j];
+                }
+            }
+        }
+    }
+    // GQ = G*Q
+    this->GQ.clear();
+    for (int b = 0; b < this->G_blocks_num; b++) {
+        const block_t &blk = this->G_blocks[b];
+        for (int i = blk.row; i < blk.row + blk.rows; i++) {
+            float *gq_row = &GQ(i, 0);
+            for (int l = blk.col; l < blk.col + blk.cols; l++) {
+                float g_il = G(i, l);
+                const float *q_row = &Q(l, 0);
+                for (int k = 0; k < this->NUMW; k++) {
+                    gq_row[k] += g_il * q_row[k];
+                }
+            }
+        }
+    }
+    // P = FP + dt*FP*F' + dt^2*GQ*G', upper triangle only
+    for (int i = 0; i < this->NUMX; i++) {
+        for (int j = i; j < this->NUMX; j++) {
+            P(i, j) = FP(i, j);
+        }
+    }
+    for (int b = 0; b < this->F_blocks_num; b++) {
+        const block_t &blk = this->F_blocks[b];
+        for (int j = blk.row; j < blk.row + blk.rows; j++) {
+            for (int k = blk.col; k < blk.col + blk.cols; k++) {
+                float f_jk = dt * F(j, k);
+                for (int i = 0; i <= j; i++) {
+                    P(i, j) += FP(i, k) * f_jk;
+                }
+            }
+        }
+    }
+    float dt_2 = dt * dt;
+    for (int b = 0; b < this->G_blocks_num; b++) {
+        const block_t &blk = this->G_blocks[b];
+        for (int j = blk.row; j < blk.row + blk.rows; j++) {
+            for (int k = blk.col; k < blk.col + blk.cols; k++) {
+                float g_jk = dt_2 * G(j, k);
+                for (int i = 0; i <= j; i++) {
+                    P(i, j) += GQ(i, k) * g_jk;
+                }
+            }
+        }
+    }
+    // Mirror upper triangle to the lower one
+    for (int i = 1; i < this->NUMX; i++) {
+        for (int j = 0; j < i; j++) {
+            P(i, j) = P(j, i);
+        }
+    }
+}
 
-    dspm::Mat f_t = f.t();
-    this->P = ((f * this->P) * f_t) + (dt * dt) * ((G * Q) * G.t());
+void ekf::CovariancePredictionDense(float dt)
+{
+    // FP = f*P = P + dt*F*P
+    this->FP = this->P;
+    for (int i = 0; i < this->NUMX; i++) {
+        for (int k = 0; k < this->NUMX; k++) {
+            float f_ik = F(i, k);
+            if (f_ik == 0) {
+                continue;
+            }
+            f_ik *= dt;
+            for (int j = 0; j < this->NUMX; j++) {
+                FP(i, j) += f_ik * P(k, j);
+            }
+        }
+    }
+    // GQ = G*Q
+    this->GQ.clear();
+    for (int i = 0; i < this->NUMX; i++) {
+        for (int l = 0; l < this->NUMW; l++) {
+            float g_il = G(i, l);
+            if (g_il == 0) {
+                continue;
+            }
+            for (int k = 0; k < this->NUMW; k++) {
+                GQ(i, k) += g_il * Q(l, k);
+            }
+        }
+    }
+    // P = FP*f' + dt^2*GQ*G', the result is symmetric
+    float dt_2 = dt * dt;
+    for (int i = 0; i < this->NUMX; i++) {
+        for (int j = i; j < this->NUMX; j++) {
+            float fpf = FP(i, j);
+            for (int k = 0; k < this->NUMX; k++) {
+                if (F(j, k) != 0) {
+                    fpf += dt * FP(i, k) * F(j, k);
+                }
+            }
+            float gqg = 0;
+            for (int k = 0; k < this->NUMW; k++) {
+                if (G(j, k) != 0) {
+                    gqg += GQ(i, k) * G(j, k);
+                }
+            }
+            P(i, j) = P(j, i) = fpf + dt_2 * gqg;
+        }
+    }
 }
 
 void ekf::Update(dspm::Mat &H, float *measured, float *expected, float *R)
 {
     float HPHR, Error;
-    dspm::Mat Y(measured, H.rows, 1);
-    dspm::Mat Z(expected, H.rows, 1);
 
     for (int m = 0; m < H.rows; m++) {
         for (int j = 0; j < this->NUMX; j++) {
@@ -157,9 +305,13 @@ void ekf::Update(dspm::Mat &H, float *measured, float *expected, float *R)
             HP[j] = 0;
         }
         for (int k = 0; k < this->NUMX; k++) {
+            float h_mk = H(m, k);
+            if (h_mk == 0) {
+                continue;
+            }
             for (int j = 0; j < this->NUMX; j++) {
                 // Find Hp = H*P
-                HP[j] += H(m, k) * P(k, j);
+                HP[j] += h_mk * P(k, j);
             }
         }
         HPHR = R[m]; // Find  HPHR = H*P*H' + R
@@ -171,13 +323,14 @@ void ekf::Update(dspm::Mat &H, float *measured, float *expected, float *R)
             Km[k] = HP[k] * invHPHR; // find K = HP/HPHR
         }
         for (int i = 0; i < this->NUMX; i++) {
-            // Find P(m)= P(m-1) + K*HP
+            // Joseph form: P(m) = (I - K*H)*P(m-1)*(I - K*H)' + K*R*K'
+            //                   = P(m-1) - K*HP - HP'*K' + K*HPHR*K'
             for (int j = i; j < NUMX; j++) {
-                P(i, j) = P(j, i) = P(i, j) - Km[i] * HP[j];
+                P(i, j) = P(j, i) = P(i, j) - Km[i] * HP[j] - HP[i] * Km[j] + HPHR * Km[i] * Km[j];
             }
         }
 
-        Error = Y(m, 0) - Z(m, 0);
+        Error = measured[m] - expected[m];
         for (int i = 0; i < this->NUMX; i++) {
             // Find X(m)= X(m-1) + K*Error
             X(i, 0) = X(i, 0) + Km[i] * Error;
@@ -206,12 +359,18 @@ void ekf::UpdateRef(dspm::Mat &H, float *measured, float *expected, float *R)
 }
 
 dspm::Mat ekf::quat2rotm(float q[4])
+{
+    dspm::Mat Rm(3, 3);
+    quat2rotm(q, Rm);
+    return Rm;
+}
+
+void ekf::quat2rotm(const float q[4], dspm::Mat &Rm)
 {
     float q0 = q[0];
     float q1 = q[1];
     float q2 = q[2];
     float q3 = q[3];
-    dspm::Mat Rm(3, 3);
 
     Rm(0, 0) = q0 * q0 + q1 * q1 - q2 * q2 - q3 * q3;
     Rm(1, 0) = 2.0f * (q1 * q2 + q0 * q3);
@@ -222,8 +381,6 @@ dspm::Mat ekf::quat2rotm(float q[4])
     Rm(0, 2) = 2.0f * (q1 * q3 + q0 * q2);
     Rm(1, 2) = 2.0f * (q2 * q3 - q0 * q1);
     Rm(2, 2) = (q0 * q0 - q1 * q1 - q2 * q2 + q3 * q3);
-
-    return Rm;
 }
 
 dspm::Mat ekf::quat2eul(const float q[4])
@@ -388,28 +545,38 @@ dspm::Mat ekf::dFdq(dspm::Mat &vector, dspm::Mat &q)
 dspm::Mat ekf::dFdq_inv(dspm::Mat &vector, dspm::Mat &q)
 {
     dspm::Mat result(3, 4);
-    result(0, 0) = q.data[0] * vector.data[0] + q.data[3] * vector.data[1] - q.data[2] * vector.data[2];
-    result(0, 1) = q.data[1] * vector.data[0] + q.data[2] * vector.data[1] + q.data[3] * vector.data[2];
-    result(0, 2) = -q.data[2] * vector.data[0] + q.data[1] * vector.data[1] - q.data[0] * vector.data[2];
-    result(0, 3) = -q.data[3] * vector.data[0] + q.data[0] * vector.data[1] + q.data[1] * vector.data[2];
-
-    result(1, 0) = -q.data[3] * vector.data[0] + q.data[0] * vector.data[1] + q.data[1] * vector.data[2];
-    result(1, 1) = q.data[2] * vector.data[0] - q.data[1] * vector.data[1] + q.data[0] * vector.data[2];
-    result(1, 2) = q.data[1] * vector.data[0] + q.data[2] * vector.data[1] + q.data[3] * vector.data[2];
-    result(1, 3) = -q.data[0] * vector.data[0] - q.data[3] * vector.data[1] + q.data[2] * vector.data[2];
-
-    result(2, 0) = q.data[2] * vector.data[0] - q.data[1] * vector.data[1] + q.data[0] * vector.data[2];
-    result(2, 1) = q.data[3] * vector.data[0] - q.data[0] * vector.data[1] - q.data[1] * vector.data[2];
-    result(2, 2) = q.data[0] * vector.data[0] + q.data[3] * vector.data[1] - q.data[2] * vector.data[2];
-    result(2, 3) = q.data[1] * vector.data[0] + q.data[2] * vector.data[1] + q.data[3] * vector.data[2];
-
-    result *= 2;
+    dFdq_inv(vector, q, result);
     return result;
 }
 
+void ekf::dFdq_inv(const dspm::Mat &vector, const dspm::Mat &quat, dspm::Mat &result)
+{
+    const float *q = quat.data;
+    const float *v = vector.data;
+    result(0, 0) = 2 * (q[0] * v[0] + q[3] * v[1] - q[2] * v[2]);
+    result(0, 1) = 2 * (q[1] * v[0] + q[2] * v[1] + q[3] * v[2]);
+    result(0, 2) = 2 * (-q[2] * v[0] + q[1] * v[1] - q[0] * v[2]);
+    result(0, 3) = 2 * (-q[3] * v[0] + q[0] * v[1] + q[1] * v[2]);
+
+    result(1, 0) = 2 * (-q[3] * v[0] + q[0] * v[1] + q[1] * v[2]);
+    result(1, 1) = 2 * (q[2] * v[0] - q[1] * v[1] + q[0] * v[2]);
+    result(1, 2) = 2 * (q[1] * v[0] + q[2] * v[1] + q[3] * v[2]);
+    result(1, 3) = 2 * (-q[0] * v[0] - q[3] * v[1] + q[2] * v[2]);
+
+    result(2, 0) = 2 * (q[2] * v[0] - q[1] * v[1] + q[0] * v[2]);
+    result(2, 1) = 2 * (q[3] * v[0] - q[0] * v[1] - q[1] * v[2]);
+    result(2, 2) = 2 * (q[0] * v[0] + q[3] * v[1] - q[2] * v[2]);
+    result(2, 3) = 2 * (q[1] * v[0] + q[2] * v[1] + q[3] * v[2]);
+}
+
 dspm::Mat ekf::StateXdot(dspm::Mat &x, float *u)
 {
     dspm::Mat U(u, this->G.cols, 1);
     dspm::Mat Xdot = (this->F * x + this->G * U);
     return Xdot;
 }
+
+void ekf::StateXdot(dspm::Mat &x, float *u, dspm::Mat &xdot)
+{
+    xdot = StateXdot(x, u);
+}
@@ -112,6 +112,16 @@ public:
      *      - derivative of input vector x and u
      */
     virtual dspm::Mat StateXdot(dspm::Mat &x, float *u);
+    /**
+     * Derivative of state vector X to the preallocated vector.
+     * Default implementation calls StateXdot(x, u). Override the method
+     * to calculate derivative without allocation of temporary matrices.
+     *
+     * @param[in] x: state vector
+     * @param[in] u: control measurement
+     * @param[out] xdot: derivative of input vector x and u, vector [NUMX]x[1]
+     */
+    virtual void StateXdot(dspm::Mat &x, float *u, dspm::Mat &xdot);
     /**
      * Calculation of system state matrices F and G
      * @param[in] x: state vector
@@ -124,15 +134,71 @@ public:
 
     /**
      * Calculates covariance prediction matrux P.
-     * Update matrix P
+     * Update matrix P: P = f*P*f' + dt^2*G*Q*G', where f = I + F*dt.
+     * Calls CovariancePredictionSparse() if sparsity of F and G was defined by SetSparsity(),
+     * and CovariancePredictionDense() otherwise.
      * @param[in] dt: time interval from last update
      */
     virtual void CovariancePrediction(float dt);
 
+    /**
+     * Calculates covariance prediction matrux P by full F and G matrices.
+     * Only upper triangle of P is calculated, lower triangle is mirrored.
+     * Zero elements of F and G are skipped.
+     * @param[in] dt: time interval from last update
+     */
+    void CovariancePredictionDense(float dt);
+
+    /**
+     * Calculates covariance prediction matrux P by non zero blocks of F and G only.
+     * Only upper triangle of P is calculated, lower triangle is mirrored.
+     * @param[in] dt: time interval from last update
+     */
+    void CovariancePredictionSparse(float dt);
+
+    /**
+     * Non zero block of a block-sparse matrix
+     */
+    struct block_t {
+        int row;    /*!< first row of the block */
+        int col;    /*!< first column of the block */
+        int rows;   /*!< amount of rows in the block */
+        int cols;   /*!< amount of columns in the block */
+    };
+
+    /**
+     * Define block-sparse structure of F and G matrices.
+     * All elements outside of the blocks must stay zero.
+     * The arrays are not copied and must be valid for the lifetime of the filter.
+     * @param[in] f_blocks: non zero blocks of F matrix
+     * @param[in] f_num: amount of blocks in f_blocks
+     * @param[in] g_blocks: non zero blocks of G matrix
+     * @param[in] g_num: amount of blocks in g_blocks
+     */
+    void SetSparsity(const block_t *f_blocks, int f_num, const block_t *g_blocks, int g_num);
+
+    /**
+     * Non zero blocks of F matrix, NULL if F is dense
+     */
+    const block_t *F_blocks;
+    /**
+     * Amount of non zero blocks of F matrix
+     */
+    int F_blocks_num;
+    /**
+     * Non zero blocks of G matrix, NULL if G is dense
+     */
+    const block_t *G_blocks;
+    /**
+     * Amount of non zero blocks of G matrix
+     */
+    int G_blocks_num;
+
     /**
      * Update of current state by measured values.
      * Optimized method for non correlated values
      * Calculate Kalman gain and update matrix P and vector X.
+     * Matrix P is updated in Joseph form on upper triangle only, zero elements of H are skipped.
      * @param[in] H: derivative matrix
      * @param[in] measured: array of measured values
      * @param[in] expected: array of expected values
@@ -159,6 +225,19 @@ public:
     */
     float *Km;
 
+    /**
+     * Matrices for intermidieve calculations of RungeKutta(): start state, derivative and derivatives sum
+    */
+    dspm::Mat Xlast, Xk, Xk_sum;
+    /**
+     * Matrix for intermidieve calculations of CovariancePrediction(): f*P
+    */
+    dspm::Mat FP;
+    /**
+     * Matrix for intermidieve calculations of CovariancePrediction(): G*Q
+    */
+    dspm::Mat GQ;
+
 public:
     // Additional universal helper methods
     /**
@@ -170,6 +249,13 @@ public:
      */
     static dspm::Mat quat2rotm(float q[4]);
 
+    /**
+     * Convert quaternion to rotation matrix.
+     * @param[in] q: quaternion
+     * @param[out] Rm: rotation matrix 3x3
+     */
+    static void quat2rotm(const float q[4], dspm::Mat &Rm);
+
     /**
      * Convert rotation matrix to quaternion.
      * @param[in] R: rotation matrix
@@ -225,6 +311,14 @@ public:
      */
     static dspm::Mat dFdq_inv(dspm::Mat &vector, dspm::Mat &quat);
 
+    /**
+     * Df/dq: Derivative of vector by inverted quaternion.
+     * @param[in] vector: input vector
+     * @param[in] quat: quaternion
+     * @param[out] result: derivative matrix 3x4, could be a sub-matrix
+     */
+    static void dFdq_inv(const dspm::Mat &vector, const dspm::Mat &quat, dspm::Mat &result);
+
     /**
      * Make skew-symmetric matrix of vector.
      * @param[in] w: source vector
@@ -14,11 +14,37 @@
 
 #include "ekf_imu13states.h"
 
+// Non zero blocks of F: dqdot/dq and dqdot/dwbias
+static const ekf::block_t imu13_F_blocks[] = {
+    {0, 0, 4, 7},
+};
+
+// Non zero blocks of G
+static const ekf::block_t imu13_G_blocks[] = {
+    {0, 0, 4, 3},   // dqdot / dnw
+    {4, 3, 3, 3},   // random noise wbias
+    {7, 6, 3, 3},   // magnetometer amplitude rotation
+    {7, 12, 3, 3},  // random noise magnetometer amplitude
+    {10, 9, 3, 3},  // magnetometer offset constant
+    {10, 15, 3, 3}, // random noise offset constant
+};
+
 ekf_imu13states::ekf_imu13states() : ekf(13, 18),
     mag0(3, 1),
-    accel0(3, 1)
+    accel0(3, 1),
+    H_ref(10, 13)
 {
     this->NUMU = 3;
+
+    // Constant part of the G matrix
+    for (int i = 0; i < 3; i++) {
+        G(4 + i, 3 + i) = 1;    // random noise wbias
+        G(7 + i, 12 + i) = 1;   // random noise magnetometer amplitude
+        G(10 + i, 9 + i) = 1;   // magnetometer offset constant
+        G(10 + i, 15 + i) = 1;  // random noise offset constant
+    }
+    this->SetSparsity(imu13_F_blocks, sizeof(imu13_F_blocks) / sizeof(imu13_F_blocks[0]),
+                      imu13_G_blocks, sizeof(imu13_G_blocks) / sizeof(imu13_G_blocks[0]));
 }
 
 ekf_imu13states::~ekf_imu13states()
@@ -51,53 +77,67 @@ void ekf_imu13states::Init()
 }
 
 dspm::Mat ekf_imu13states::StateXdot(dspm::Mat &x, float *u)
+{
+    dspm::Mat Xdot(this->NUMX, 1);
+    StateXdot(x, u, Xdot);
+    return Xdot;
+}
+
+void ekf_imu13states::StateXdot(dspm::Mat &x, float *u, dspm::Mat &xdot)
 {
     float wx = u[0] - x(4, 0); // subtract the biases on gyros
     float wy = u[1] - x(5, 0);
     float wz = u[2] - x(6, 0);
-
-    float w[] = {wx, wy, wz};
-    dspm::Mat q = dspm::Mat(x.data, 4, 1);
-
-    // qdot = Q * w
-    dspm::Mat Omega = 0.5 * SkewSym4x4(w);
-    dspm::Mat qdot = Omega * q;
-    dspm::Mat Xdot(this->NUMX, 1);
-    Xdot *= 0;
-    Xdot.Copy(qdot, 0, 0);
+    float *q = x.data;
+
+    // qdot = 0.5 * SkewSym4x4(w) * q
+    xdot.clear();
+    xdot(0, 0) = 0.5f * (-wx * q[1] - wy * q[2] - wz * q[3]);
+    xdot(1, 0) = 0.5f * (wx * q[0] + wz * q[2] - wy * q[3]);
+    xdot(2, 0) = 0.5f * (wy * q[0] - wz * q[1] + wx * q[3]);
+    xdot(3, 0) = 0.5f * (wz * q[0] + wy * q[1] - wx * q[2]);
     // dwbias = 0
     // dMang_Ampl = 0
     // dMang_offset = 0
-    return Xdot;
 }
 
 void ekf_imu13states::LinearizeFG(dspm::Mat &x, float *u)
 {
     float w[3] = {(u[0] - x(4, 0)), (u[1] - x(5, 0)), (u[2] - x(6, 0))}; // subtract the biases on gyros
-    // float w[3] = {u[0], u[1], u[2]}; // subtract the biases on gyros
-
-    this->F *= 0; // Initialize F and G matrixes.
-    this->G *= 0;
-
-    // dqdot / dq - skey matrix
-    F.Copy(0.5 * ekf::SkewSym4x4(w), 0, 0);
-
-    // dqdot/dvector
-    dspm::Mat dq = -0.5 * qProduct(x.data);
-    dspm::Mat dq_q = dq.Get(0, 4, 1, 3);
-
-    // dqdot / dnw
-    G.Copy(dq_q, 0, 0);
-    // dqdot / dwbias
-    F.Copy(dq_q, 0, 4);
-
-    dspm::Mat rotm = -1 * this->quat2rotm(x.data); // Convert quat to rotation matrix
+    float *q = x.data;
+
+    // dqdot / dq - skew matrix 0.5 * SkewSym4x4(w)
+    F(0, 1) = -0.5f * w[0];
+    F(0, 2) = -0.5f * w[1];
+    F(0, 3) = -0.5f * w[2];
+    F(1, 0) = 0.5f * w[0];
+    F(1, 2) = 0.5f * w[2];
+    F(1, 3) = -0.5f * w[1];
+    F(2, 0) = 0.5f * w[1];
+    F(2, 1) = -0.5f * w[2];
+    F(2, 3) = 0.5f * w[0];
+    F(3, 0) = 0.5f * w[2];
+    F(3, 1) = 0.5f * w[1];
+    F(3, 2) = -0.5f * w[0];
+
+    // dqdot/dvector: columns 1..3 of -0.5 * qProduct(q)
+    float dq_q[4][3] = {
+        { 0.5f * q[1],  0.5f * q[2],  0.5f * q[3]},
+        {-0.5f * q[0],  0.5f * q[3], -0.5f * q[2]},
+        {-0.5f * q[3], -0.5f * q[0],  0.5f * q[1]},
+        { 0.5f * q[2], -0.5f * q[1], -0.5f * q[0]},
+    };
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 3; j++) {
+            G(i, j) = dq_q[i][j];      // dqdot / dnw
+            F(i, 4 + j) = dq_q[i][j];  // dqdot / dwbias
+        }
+    }
 
-    G.Copy(rotm, 7, 6);
-    G.Copy(dspm::Mat::eye(3), 4, 3);   // random noise wbias
-    G.Copy(dspm::Mat::eye(3), 7, 12);  // random noise magnetometer amplitude
-    G.Copy(dspm::Mat::eye(3), 10, 9);  // magnetometer offset constant
-    G.Copy(dspm::Mat::eye(3), 10, 15); // random noise offset constant
+    // Convert quat to rotation matrix
+    dspm::Mat rotm = G.getROI(7, 6, 3, 3);
+    this->quat2rotm(q, rotm);
+    rotm *= -1;
 }
 
 void ekf_imu13states::Test()
@@ -187,21 +227,27 @@ void ekf_imu13states::TestFull(bool enable_att)
 void ekf_imu13states::UpdateRefMeasurement(float *accel_data, float *magn_data, float R[6])
 {
     dspm::Mat quat(this->X.data, 4, 1);
-    dspm::Mat H = 0 * dspm::Mat(6, this->NUMX);
-    dspm::Mat Re = this->quat2rotm(quat.data).t();
+    dspm::Mat H = this->H_ref.getROI(0, 0, 6, this->NUMX);
+    dspm::MatFixed<3, 3> Rm;
+    dspm::MatFixed<3, 3> Re;
+    H.clear();
+    this->quat2rotm(quat.data, Rm);
+    Rm.t(Re);
 
     // dAccel/dq
-    dspm::Mat dAccel_dq = ekf::dFdq_inv(this->accel0, quat);
-    H.Copy(dAccel_dq, 3, 0);
+    dspm::Mat dAccel_dq = H.getROI(3, 0, 3, 4, H.stride);
+    ekf::dFdq_inv(this->accel0, quat, dAccel_dq);
 
     // dMagn/dq
     dspm::Mat magn(&this->X.data[7], 3, 1);
     dspm::Mat magn_offset(&this->X.data[10], 3, 1);
-    dspm::Mat dMagn_dq = ekf::dFdq_inv(magn, quat);
-    H.Copy(dMagn_dq, 0, 0);
+    dspm::Mat dMagn_dq = H.getROI(0, 0, 3, 4, H.stride);
+    ekf::dFdq_inv(magn, quat, dMagn_dq);
 
-    dspm::Mat expected_magn = Re * magn + magn_offset;
-    dspm::Mat expected_accel = Re * this->accel0;
+    dspm::MatFixed<3, 1> expected_magn;
+    dspm::MatFixed<3, 1> expected_accel;
+    dspm::Mat::multAdd(Re, magn, magn_offset, expected_magn);
+    dspm::Mat::mult(Re, this->accel0, expected_accel);
 
     float measured_data[6];
     float expected_data[6];
@@ -219,25 +265,33 @@ void ekf_imu13states::UpdateRefMeasurement(float *accel_data, float *magn_data,
 void ekf_imu13states::UpdateRefMeasurementMagn(float *accel_data, float *magn_data, float R[6])
 {
     dspm::Mat quat(this->X.data, 4, 1);
-    dspm::Mat H = 0 * dspm::Mat(6, this->NUMX);
-    dspm::Mat Re = this->quat2rotm(quat.data).t();
+    dspm::Mat H = this->H_ref.getROI(0, 0, 6, this->NUMX);
+    dspm::MatFixed<3, 3> Rm;
+    dspm::MatFixed<3, 3> Re;
+    H.clear();
+    this->quat2rotm(quat.data, Rm);
+    Rm.t(Re);
 
     // We include these two line to update magnetometer initial state
     H.Copy(Re, 0, 7);
-    H.Copy(dspm::Mat::eye(3), 0, 10);
+    for (int i = 0; i < 3; i++) {
+        H(i, 10 + i) = 1;
+    }
 
     // dAccel/dq
-    dspm::Mat dAccel_dq = ekf::dFdq_inv(this->accel0, quat);
-    H.Copy(dAccel_dq, 3, 0);
+    dspm::Mat dAccel_dq = H.getROI(3, 0, 3, 4, H.stride);
+    ekf::dFdq_inv(this->accel0, quat, dAccel_dq);
 
     // dMagn/dq
     dspm::Mat magn(&this->X.data[7], 3, 1);
     dspm::Mat magn_offset(&this->X.data[10], 3, 1);
-    dspm::Mat dMagn_dq = ekf::dFdq_inv(magn, quat);
-    H.Copy(dMagn_dq, 0, 0);
+    dspm::Mat dMagn_dq = H.getROI(0, 0, 3, 4, H.stride);
+    ekf::dFdq_inv(magn, quat, dMagn_dq);
 
-    dspm::Mat expected_magn = Re * magn + magn_offset;
-    dspm::Mat expected_accel = Re * this->accel0;
+    dspm::MatFixed<3, 1> expected_magn;
+    dspm::MatFixed<3, 1> expected_accel;
+    dspm::Mat::multAdd(Re, magn, magn_offset, expected_magn);
+    dspm::Mat::mult(Re, this->accel0, expected_accel);
 
     float measured_data[6];
     float expected_data[6];
@@ -252,28 +306,59 @@ void ekf_imu13states::UpdateRefMeasurementMagn(float *accel_data, float *magn_da
     quat /= quat.norm();
 }
 
+void ekf_imu13states::UpdateRefMeasurementAccel(float *accel_data, float R[3])
+{
+    dspm::Mat quat(this->X.data, 4, 1);
+    dspm::Mat H = this->H_ref.getROI(0, 0, 3, this->NUMX);
+    dspm::MatFixed<3, 3> Rm;
+    dspm::MatFixed<3, 3> Re;
+    H.clear();
+    this->quat2rotm(quat.data, Rm);
+    Rm.t(Re);
+
+    // dAccel/dq
+    dspm::Mat dAccel_dq = H.getROI(0, 0, 3, 4, H.stride);
+    ekf::dFdq_inv(this->accel0, quat, dAccel_dq);
+
+    dspm::MatFixed<3, 1> expected_accel;
+    dspm::Mat::mult(Re, this->accel0, expected_accel);
+
+    this->Update(H, accel_data, expected_accel.data, R);
+    quat /= quat.norm();
+}
+
 void ekf_imu13states::UpdateRefMeasurement(float *accel_data, float *magn_data, float *attitude, float R[10])
 {
     dspm::Mat quat(this->X.data, 4, 1);
-    dspm::Mat H = 0 * dspm::Mat(10, this->NUMX);
-    dspm::Mat Re = this->quat2rotm(quat.data).t();
+    dspm::Mat &H = this->H_ref;
+    dspm::MatFixed<3, 3> Rm;
+    dspm::MatFixed<3, 3> Re;
+    H.clear();
+    this->quat2rotm(quat.data, Rm);
+    Rm.t(Re);
 
     H.Copy(Re, 0, 7);
-    H.Copy(dspm::Mat::eye(3), 0, 10);
+    for (int i = 0; i < 3; i++) {
+        H(i, 10 + i) = 1;
+    }
     // dAccel/dq
-    dspm::Mat dAccel_dq = ekf::dFdq_inv(this->accel0, quat);
-    H.Copy(dAccel_dq, 3, 0);
+    dspm::Mat dAccel_dq = H.getROI(3, 0, 3, 4, H.stride);
+    ekf::dFdq_inv(this->accel0, quat, dAccel_dq);
     // dMagn/dq
     dspm::Mat magn(&this->X.data[7], 3, 1);
     dspm::Mat magn_offset(&this->X.data[10], 3, 1);
-    dspm::Mat dMagn_dq = ekf::dFdq_inv(magn, quat);
-    H.Copy(dMagn_dq, 0, 0);
+    dspm::Mat dMagn_dq = H.getROI(0, 0, 3, 4, H.stride);
+    ekf::dFdq_inv(magn, quat, dMagn_dq);
 
     // dq/dq
-    H.Copy(dspm::Mat::eye(4), 6, 1);
+    for (int i = 0; i < 4; i++) {
+        H(6 + i, 1 + i) = 1;
+    }
 
-    dspm::Mat expected_magn = Re * magn + magn_offset;
-    dspm::Mat expected_accel = Re * this->accel0;
+    dspm::MatFixed<3, 1> expected_magn;
+    dspm::MatFixed<3, 1> expected_accel;
+    dspm::Mat::multAdd(Re, magn, magn_offset, expected_magn);
+    dspm::Mat::mult(Re, this->accel0, expected_accel);
 
     float measured_data[10];
     float expected_data[10];
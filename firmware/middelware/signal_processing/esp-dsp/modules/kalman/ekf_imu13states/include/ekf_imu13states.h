@@ -34,9 +34,13 @@ public:
     virtual ~ekf_imu13states();
     virtual void Init();
 
+    using ekf::StateXdot;
     // Method calculates Xdot values depends on U
     // U - gyroscope values in radian per seconds (rad/sec)
     virtual dspm::Mat StateXdot(dspm::Mat &x, float *u);
+    virtual void StateXdot(dspm::Mat &x, float *u, dspm::Mat &xdot);
+    // Method updates only non constant elements of F and G.
+    // Constant elements are set once by the constructor.
     virtual void LinearizeFG(dspm::Mat &x, float *u);
 
     /**
@@ -64,6 +68,11 @@ public:
     */
     int NUMU;
 
+    /**
+    *     Preallocated measurement matrix for update methods, up to 10 measurements.
+    */
+    dspm::Mat H_ref;
+
     /**
      * Update part of system state by reference measurements accelerometer and magnetometer.
      * Only attitude and gyro bias will be updated.
@@ -83,6 +92,15 @@ public:
      * @param[in] R: measurement noise covariance values for diagonal covariance matrix. Then smaller value, then more you trust them.
      */
     void UpdateRefMeasurementMagn(float *accel_data, float *magn_data, float R[6]);
+    /**
+     * Update attitude and gyro bias by reference accelerometer measurement only.
+     * This method should be used with sensors without magnetometer, like MPU6050.
+     * Yaw angle could not be corrected by accelerometer and stays gyroscope based.
+     *
+     * @param[in] accel_data: accelerometer measurement vector XYZ in g, where 1 g ~ 9.81 m/s^2
+     * @param[in] R: measurement noise covariance values for diagonal covariance matrix. Then smaller value, then more you trust them.
+     */
+    void UpdateRefMeasurementAccel(float *accel_data, float R[3]);
     /**
      * Update system state by reference measurements accelerometer, magnetometer and attitude quaternion.
      * This method could be used when system on constant state or in initialization phase.
@@ -19,9 +19,53 @@
 
 #include "ekf_imu13states.h"
 #include "esp_attr.h"
+#include "sdkconfig.h"
+#include "test_imu_replay.h"
+
+#ifndef CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ
+#define CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ 160
+#endif
 
 static const char *TAG = "ekf_imu13states";
 
+// Count heap allocations made by new, to check the allocations of Process()
+static volatile int test_new_count = 0;
+
+void *operator new(size_t size)
+{
+    test_new_count++;
+    void *ptr = malloc(size);
+    if (ptr == NULL) {
+        abort();
+    }
+    return ptr;
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete(void *ptr, size_t size) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void *ptr, size_t size) noexcept
+{
+    free(ptr);
+}
+
 
 TEST_CASE("ekf_imu13states functionality gyro only", "[dspm]")
 {
@@ -58,3 +102,129 @@ TEST_CASE("ekf_imu13states functionality gyro and magn", "[dspm]")
     printf("Expected result = %i, calculated result = %i\n", 200, (int)(1000 * ekf13->X.data[5] + 0.5));
     printf("Expected result = %i, calculated result = %i\n", 300, (int)(1000 * ekf13->X.data[6] + 0.5));
 }
+
+TEST_CASE("ekf_imu13states Process heap allocations", "[dspm]")
+{
+    ekf_imu13states *ekf13 = new  ekf_imu13states();
+    ekf13->Init();
+    float gyro[3] = {0.1, 0.2, 0.3};
+    float dt = 0.01;
+    int repeat_count = 100;
+
+    int new_count = test_new_count;
+    for (int i = 0 ; i < repeat_count ; i++) {
+        ekf13->Process(gyro, dt);
+    }
+    new_count = test_new_count - new_count;
+    ESP_LOGI(TAG, "Process: %i heap allocations in %i calls", new_count, repeat_count);
+    // Process() works on the matrices allocated by the constructor
+    TEST_ASSERT_EQUAL(0, new_count);
+    delete ekf13;
+}
+
+TEST_CASE("ekf_imu13states Process benchmark", "[dspm]")
+{
+    ekf_imu13states *ekf13 = new  ekf_imu13states();
+    ekf13->Init();
+    float gyro[3] = {0.1, 0.2, 0.3};
+    float dt = 0.01;
+    int repeat_count = 100;
+
+    unsigned int start_b = xthal_get_ccount();
+    for (int i = 0 ; i < repeat_count ; i++) {
+        ekf13->Process(gyro, dt);
+    }
+    unsigned int end_b = xthal_get_ccount();
+    ESP_LOGI(TAG, "Process: %i cycles per call", (int)((end_b - start_b) / repeat_count));
+    dspm::Mat quat(ekf13->X.data, 4, 1);
+    TEST_ASSERT_LESS_THAN(100, (int)(1000 * fabs(quat.norm() - 1)));
+    delete ekf13;
+}
+
+TEST_CASE("ekf_imu13states sparse covariance prediction", "[dspm]")
+{
+    ekf_imu13states *ekf13 = new  ekf_imu13states();
+    ekf13->Init();
+    float gyro[3] = {0.1, 0.2, 0.3};
+    float dt = 0.01;
+    int repeat_count = 100;
+    for (int i = 0 ; i < 10 ; i++) {
+        ekf13->Process(gyro, dt);
+    }
+    ekf13->LinearizeFG(ekf13->X, gyro);
+    dspm::Mat P0 = ekf13->P;
+
+    // Reference: full matrix operations
+    unsigned int start_b = xthal_get_ccount();
+    dspm::Mat f = dspm::Mat::eye(ekf13->NUMX) + ekf13->F * dt;
+    dspm::Mat P_ref = f * P0 * f.t() + (dt * dt) * ekf13->G * ekf13->Q * ekf13->G.t();
+    unsigned int end_b = xthal_get_ccount();
+    int cycles_full = end_b - start_b;
+
+    start_b = xthal_get_ccount();
+    for (int i = 0 ; i < repeat_count ; i++) {
+        ekf13->P = P0;
+        ekf13->CovariancePredictionDense(dt);
+    }
+    end_b = xthal_get_ccount();
+    int cycles_dense = (end_b - start_b) / repeat_count;
+    dspm::Mat P_dense = ekf13->P;
+
+    start_b = xthal_get_ccount();
+    for (int i = 0 ; i < repeat_count ; i++) {
+        ekf13->P = P0;
+        ekf13->CovariancePredictionSparse(dt);
+    }
+    end_b = xthal_get_ccount();
+    int cycles_sparse = (end_b - start_b) / repeat_count;
+
+    ESP_LOGI(TAG, "F*P*F'+Q: full matrix %i, dense %i, sparse %i cycles", cycles_full, cycles_dense, cycles_sparse);
+    for (int i = 0 ; i < ekf13->NUMX ; i++) {
+        for (int j = 0 ; j < ekf13->NUMX ; j++) {
+            float tol = 1e-5 * (1 + fabs(P_ref(i, j)));
+            TEST_ASSERT_FLOAT_WITHIN(tol, P_ref(i, j), P_dense(i, j));
+            TEST_ASSERT_FLOAT_WITHIN(tol, P_ref(i, j), ekf13->P(i, j));
+        }
+    }
+    delete ekf13;
+}
+
+struct ekf_replay_ctx {
+    ekf_imu13states *ekf13;
+    float R[3];
+};
+
+static void ekf_replay_update(void *ctx, const int16_t sample[6])
+{
+    ekf_replay_ctx *c = (ekf_replay_ctx *)ctx;
+    float gyro[3];
+    float accel[3];
+    for (int i = 0 ; i < 3 ; i++) {
+        gyro[i] = sample[i] * TEST_IMU_LOG_GYRO_SCALE;
+        accel[i] = sample[3 + i] * TEST_IMU_LOG_ACCEL_SCALE;
+    }
+    c->ekf13->Process(gyro, 1.0f / TEST_IMU_LOG_FS);
+    c->ekf13->UpdateRefMeasurementAccel(accel, c->R);
+}
+
+static void ekf_replay_gravity(void *ctx, float gravity[3])
+{
+    float *q = ((ekf_replay_ctx *)ctx)->ekf13->X.data;
+    gravity[0] = 2 * (q[1] * q[3] - q[0] * q[2]);
+    gravity[1] = 2 * (q[2] * q[3] + q[0] * q[1]);
+    gravity[2] = q[0] * q[0] - q[1] * q[1] - q[2] * q[2] + q[3] * q[3];
+}
+
+TEST_CASE("ekf_imu13states replay MPU6050 log", "[dspm]")
+{
+    ekf_imu13states *ekf13 = new  ekf_imu13states();
+    ekf13->Init();
+    ekf_replay_ctx ctx = {ekf13, {0.01, 0.01, 0.01}};
+    test_imu_estimator_t estimator = {"ekf_imu13states", &ctx, ekf_replay_update, ekf_replay_gravity};
+    test_imu_replay_result_t result;
+
+    test_imu_replay(&estimator, &result);
+    TEST_ASSERT_LESS_THAN(2, (int)result.tilt_err_rms);
+    TEST_ASSERT_LESS_THAN(CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ * 1000000 / TEST_IMU_LOG_FS, result.cycles);
+    delete ekf13;
+}
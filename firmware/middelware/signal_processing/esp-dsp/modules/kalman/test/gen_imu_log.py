@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+"""
+Generator of test_imu_log.c for the replay tests of the attitude estimators
+
+Without arguments the script writes the simulated log used by the tests: 1 sec without motion,
+3.5 sec of rotation around all axes and 0.5 sec without motion, with gyroscope bias and white noise
+on both sensors. The reference gravity is the one of the simulated attitude.
+
+A recorded capture is converted with:
+    gen_imu_log.py --capture imu.txt [--start 2.5]
+The capture is a text file with one MPU6050 sample per line, as given by MPU6050_getMotion6():
+"ax ay az gx gy gz" raw values, separated by spaces or commas, at 200 Hz and default full scale
+ranges (+-2 g, +-250 deg/sec). Other lines are skipped. TEST_IMU_LOG_LENGTH samples are taken from
+--start seconds, and the sensor must be still during the first second of them.
+A capture has no true attitude, so the reference gravity is the mean accelerometer vector around
+the sample, and only where the sensor is quasi-static: the norm of the mean is within 2% of 1 g
+and the gyroscope, without the bias of the first second, stays below 0.05 rad/sec. Other
+references are {0, 0, 0} and the replay skips them.
+
+Usage:
+    gen_imu_log.py [--capture imu.txt] [--start 0] [-o test_imu_log.c]
+"""
+
+import argparse
+import math
+import os
+import random
+import re
+
+FS = 200
+N = 1000
+TRUTH_DECIM = 10
+DT = 1.0 / FS
+GYRO_LSB = 131.0 * 180 / math.pi    # LSB per rad/sec (+-250 deg/sec)
+ACC_LSB = 16384.0                   # LSB per g (+-2 g)
+BIAS = [0.02, -0.015, 0.01]         # rad/sec
+
+STATIC_WINDOW = 5                   # samples at each side of a reference
+STATIC_ACCEL = 0.02                 # g
+STATIC_GYRO = 0.05                  # rad/sec
+
+
+def qmul(a, b):
+    return [a[0] * b[0] - a[1] * b[1] - a[2] * b[2] - a[3] * b[3],
+            a[0] * b[1] + a[1] * b[0] + a[2] * b[3] - a[3] * b[2],
+            a[0] * b[2] - a[1] * b[3] + a[2] * b[0] + a[3] * b[1],
+            a[0] * b[3] + a[1] * b[2] - a[2] * b[1] + a[3] * b[0]]
+
+
+def rotm(q):
+    q0, q1, q2, q3 = q
+    return [[q0 * q0 + q1 * q1 - q2 * q2 - q3 * q3, 2 * (q1 * q2 - q0 * q3), 2 * (q1 * q3 + q0 * q2)],
+            [2 * (q1 * q2 + q0 * q3), q0 * q0 - q1 * q1 + q2 * q2 - q3 * q3, 2 * (q2 * q3 - q0 * q1)],
+            [2 * (q1 * q3 - q0 * q2), 2 * (q2 * q3 + q0 * q1), q0 * q0 - q1 * q1 - q2 * q2 + q3 * q3]]
+
+
+def omega(t):
+    if t < 1.0:
+        return [0, 0, 0]
+    t -= 1.0
+    env = math.sin(math.pi * min(t, 3.5) / 3.5)
+    if t > 3.5:
+        env = 0
+    return [1.2 * env * math.sin(2 * math.pi * 0.7 * t),
+            0.9 * env * math.sin(2 * math.pi * 0.5 * t + 1.0),
+            0.6 * env * math.cos(2 * math.pi * 0.3 * t)]
+
+
+def simulate():
+    rnd = random.Random(1234)
+    q = [1, 0, 0, 0]
+    samples = []
+    gravity = []
+    for n in range(N):
+        t = n * DT
+        w = omega(t)
+        R = rotm(q)
+        g = [R[2][0], R[2][1], R[2][2]]     # R^T * [0 0 1]
+        gyro = [w[i] + BIAS[i] + rnd.gauss(0, 0.004) for i in range(3)]
+        acc = [g[i] + rnd.gauss(0, 0.01) for i in range(3)]
+        samples.append([int(round(max(-32768, min(32767, gyro[i] * GYRO_LSB)))) for i in range(3)] +
+                       [int(round(max(-32768, min(32767, acc[i] * ACC_LSB)))) for i in range(3)])
+        if n % TRUTH_DECIM == 0:
+            gravity.append([int(round(g[i] * ACC_LSB)) for i in range(3)])
+        # True attitude, integrated in fine steps
+        for k in range(10):
+            dq = qmul(q, [0] + omega(t + k * DT / 10))
+            q = [q[i] + 0.5 * dq[i] * DT / 10 for i in range(4)]
+            norm = math.sqrt(sum(x * x for x in q))
+            q = [x / norm for x in q]
+    return samples, gravity
+
+
+def read_capture(path, start):
+    samples = []
+    for line in open(path):
+        values = re.split(r'[\s,;]+', line.strip())
+        if len(values) != 6:
+            continue
+        try:
+            ax, ay, az, gx, gy, gz = [int(v) for v in values]
+        except ValueError:
+            continue
+        samples.append([gx, gy, gz, ax, ay, az])
+    first = int(round(start * FS))
+    if len(samples) < first + N:
+        raise SystemExit('%s: %d samples, %d needed from %.2f sec' % (path, len(samples), first + N, start))
+    return samples[first:first + N]
+
+
+def capture_gravity(samples):
+    bias = [sum(s[i] for s in samples[:FS]) / FS for i in range(3)]
+    gravity = []
+    for n in range(0, N, TRUTH_DECIM):
+        window = samples[max(0, n - STATIC_WINDOW):n + STATIC_WINDOW + 1]
+        acc = [sum(s[3 + i] for s in window) / len(window) for i in range(3)]
+        norm = math.sqrt(sum(a * a for a in acc)) / ACC_LSB
+        still = all(abs(s[i] - bias[i]) / GYRO_LSB < STATIC_GYRO for s in window for i in range(3))
+        if still and abs(norm - 1) < STATIC_ACCEL:
+            gravity.append([int(round(a)) for a in acc])
+        else:
+            gravity.append([0, 0, 0])
+    return gravity
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generator of test_imu_log.c')
+    parser.add_argument('--capture', help='recorded MPU6050 capture, "ax ay az gx gy gz" per line')
+    parser.add_argument('--start', type=float, default=0, help='start of the log in the capture, sec')
+    parser.add_argument('-o', '--output', default='test_imu_log.c')
+    args = parser.parse_args()
+
+    if args.capture:
+        samples = read_capture(args.capture, args.start)
+        gravity = capture_gravity(samples)
+        brief = 'Samples and reference gravity of a recorded MPU6050 log'
+        source = 'Converted by gen_imu_log.py from %s, %.2f sec onwards, %d of %d samples with reference.' % (
+            os.path.basename(args.capture), args.start, sum(1 for g in gravity if g != [0, 0, 0]), len(gravity))
+    else:
+        samples, gravity = simulate()
+        brief = 'Samples and reference gravity of the simulated MPU6050 log'
+        source = 'Generated by gen_imu_log.py.'
+
+    out = ['/**', ' * @file test_imu_log.c', ' * @brief ' + brief, ' *', ' * ' + source, ' */', '',
+           '#include "test_imu_log.h"', '']
+    out.append('const int16_t test_imu_log[TEST_IMU_LOG_LENGTH][6] = {')
+    out += ['    {' + ', '.join('%d' % v for v in s) + '},' for s in samples]
+    out.append('};')
+    out.append('')
+    out.append('const int16_t test_imu_log_gravity[TEST_IMU_LOG_LENGTH / TEST_IMU_LOG_TRUTH_DECIM][3] = {')
+    out += ['    {' + ', '.join('%d' % v for v in g) + '},' for g in gravity]
+    out.append('};')
+    with open(args.output, 'w') as f:
+        f.write('\n'.join(out) + '\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,46 @@
+/**
+ * @file test_imu_log.h
+ * @brief MPU6050 log for the replay tests of the attitude estimators
+ */
+
+#ifndef _test_imu_log_H_
+#define _test_imu_log_H_
+
+#include <stdint.h>
+
+/**
+ * IMU log for replay tests of attitude estimators.
+ * test_imu_log.c is written by gen_imu_log.py. By default the log is generated by simulation of
+ * the sensor with known motion, the script also converts recorded MPU6050 captures.
+ *
+ * The log has MPU6050 raw samples at default full scale ranges
+ * (gyroscope +-250 deg/sec, accelerometer +-2 g), sampled at TEST_IMU_LOG_FS.
+ * The simulated motion is: 1 sec without motion, 3.5 sec of rotation around all axes, and
+ * 0.5 sec without motion. The gyroscope has constant bias error
+ * {0.02, -0.015, 0.01} rad/sec, both sensors have white noise.
+ *
+ * test_imu_log[n] = {gyro_x, gyro_y, gyro_z, accel_x, accel_y, accel_z}
+ * test_imu_log_gravity[n] = reference gravity vector in sensor frame for sample n * TEST_IMU_LOG_TRUTH_DECIM,
+ *                           in accelerometer LSB. {0, 0, 0} when there is no reference for the sample:
+ *                           a recorded log only has references where the sensor is quasi-static.
+ */
+
+#define TEST_IMU_LOG_LENGTH         1000
+#define TEST_IMU_LOG_FS             200
+#define TEST_IMU_LOG_TRUTH_DECIM    10
+#define TEST_IMU_LOG_GYRO_SCALE     (3.14159265f / 180.0f / 131.0f)     /*!< rad/sec per LSB */
+#define TEST_IMU_LOG_ACCEL_SCALE    (1.0f / 16384.0f)                   /*!< g per LSB */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+extern const int16_t test_imu_log[TEST_IMU_LOG_LENGTH][6];
+extern const int16_t test_imu_log_gravity[TEST_IMU_LOG_LENGTH / TEST_IMU_LOG_TRUTH_DECIM][3];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _test_imu_log_H_
@@ -0,0 +1,56 @@
+/**
+ * @file test_imu_replay.h
+ * @brief Replay harness shared by the attitude estimator tests
+ */
+
+#ifndef _test_imu_replay_H_
+#define _test_imu_replay_H_
+
+#include <stdint.h>
+#include "test_imu_log.h"
+
+/**
+ * Replay harness for attitude estimators.
+ * The harness feeds all samples of test_imu_log to the estimator, measures CPU cycles
+ * of each update and compares estimated gravity vector with the reference one, where the
+ * log has a reference.
+ * The first second of the log is used for convergence and not included to the error.
+ */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * Attitude estimator under test
+ */
+typedef struct test_imu_estimator_s {
+    const char *name;                                       /*!< Name of the estimator for the report.*/
+    void *ctx;                                              /*!< Estimator context, passed to the callbacks.*/
+    void (*update)(void *ctx, const int16_t sample[6]);     /*!< Process one raw sample of test_imu_log, cycles are measured.*/
+    void (*gravity)(void *ctx, float gravity[3]);           /*!< Estimated unit gravity vector in sensor frame.*/
+} test_imu_estimator_t;
+
+/**
+ * Result of the replay
+ */
+typedef struct test_imu_replay_result_s {
+    float tilt_err_rms;     /*!< RMS tilt error, degrees.*/
+    float tilt_err_max;     /*!< Maximum tilt error, degrees.*/
+    int cycles;             /*!< Average CPU cycles per update.*/
+} test_imu_replay_result_t;
+
+/**
+ * Replay test_imu_log through the estimator and log the result.
+ *
+ * @param[in] estimator: estimator under test
+ * @param[out] result: accuracy and performance of the estimator
+ */
+void test_imu_replay(const test_imu_estimator_t *estimator, test_imu_replay_result_t *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _test_imu_replay_H_
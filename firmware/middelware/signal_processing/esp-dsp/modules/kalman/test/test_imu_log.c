@@ -0,0 +1,1114 @@
+/**
+ * @file test_imu_log.c
+ * @brief Samples and reference gravity of the simulated MPU6050 log
+ *
+ * Generated by gen_imu_log.py.
+ */
+
+#include "test_imu_log.h"
+
+const int16_t test_imu_log[TEST_IMU_LOG_LENGTH][6] = {
+    {182, -119, 141, 17, 201, 16303},
+    {144, -124, 77, -120, 284, 16440},
+    {126, -78, 62, -62, 33, 16458},
+    {185, -109, 86, -13, -177, 16337},
+    {140, -120, 54, -62, -221, 16302},
+    {122, -109, 75, 381, -193, 16442},
+    {186, -108, 92, 3, -157, 16411},
+    {188, -99, 95, 179, 238, 16688},
+    {160, -187, 91, 108, 128, 16416},
+    {157, -130, 117, 337, 175, 16640},
+    {179, -105, 59, 121, 76, 16214},
+    {157, -146, 101, -309, -265, 16490},
+    {160, -136, 89, 74, -76, 16416},
+    {95, -123, 20, 28, -130, 16189},
+    {124, -74, 82, -89, 109, 16313},
+    {182, -65, 65, -286, -59, 16405},
+    {143, -107, 73, 44, -70, 16381},
+    {193, -132, 46, 360, 116, 16435},
+    {178, -99, 84, 157, -96, 16055},
+    {95, -113, 37, 248, -254, 16360},
+    {168, -77, 57, 284, -188, 16343},
+    {156, -150, 67, 75, -265, 16121},
+    {156, -122, 74, 9, -106, 16176},
+    {151, -130, 82, 171, -9, 16273},
+    {163, -139, 129, -295, -359, 16298},
+    {110, -91, 108, -257, 106, 16454},
+    {100, -81, 73, 79, -81, 16464},
+    {142, -152, 133, 109, -264, 16488},
+    {163, -90, 102, 73, -224, 16491},
+    {120, -109, 51, 18, -151, 16546},
+    {160, -78, 105, -77, -118, 16174},
+    {165, -158, 68, -65, -195, 16600},
+    {165, -106, 108, -122, 272, 16350},
+    {175, -113, 65, -135, 129, 16338},
+    {169, -61, 68, 199, -120, 16295},
+    {137, -90, 69, 275, -175, 16274},
+    {161, -133, 80, 30, 487, 16501},
+    {194, -120, 111, -12, -181, 16463},
+    {196, -91, 59, 238, 97, 16322},
+    {106, -114, 92, -230, -103, 16568},
+    {169, -82, 143, -148, 129, 16540},
+    {138, -124, 96, -39, 100, 16551},
+    {98, -114, 91, -116, -55, 16181},
+    {110, -121, 48, 52, 251, 16265},
+    {122, -169, 66, -38, 41, 16676},
+    {110, -54, 64, -149, -54, 16386},
+    {138, -109, 57, 363, 147, 16581},
+    {123, -150, 92, -315, -98, 16508},
+    {170, -74, 80, 105, 228, 16370},
+    {146, -148, 119, 266, -30, 16342},
+    {179, -130, 51, -91, -227, 16556},
+    {151, -109, 42, 440, 161, 16536},
+    {175, -140, 44, -113, -68, 16524},
+    {193, -134, 54, -141, 284, 16206},
+    {187, -120, 59, 58, -48, 16710},
+    {183, -48, 25, -164, -270, 16332},
+    {102, -142, 27, -24, 52, 16235},
+    {186, -86, 109, -251, 200, 16590},
+    {112, -110, 110, 207, 18, 16637},
+    {112, -48, 68, -149, -101, 16353},
+    {82, -101, 99, -62, -187, 16456},
+    {62, -135, 92, 56, -116, 16291},
+    {117, -80, 77, 38, 140, 16358},
+    {158, -107, 62, -156, -245, 16770},
+    {193, -133, 90, -57, 22, 16380},
+    {94, -151, 115, -137, 201, 16283},
+    {188, -56, 86, 169, -182, 16449},
+    {138, -92, 98, -105, -75, 16208},
+    {150, -88, 139, -66, 65, 16484},
+    {216, -130, 52, 163, -161, 16460},
+    {100, -129, 66, -255, 111, 16437},
+    {121, -150, 23, 26, 242, 16316},
+    {163, -136, 90, -181, 85, 16151},
+    {133, -64, 86, -184, 99, 16508},
+    {157, -98, 64, 180, 70, 16173},
+    {143, -46, 132, -102, -327, 16442},
+    {176, -66, 78, 123, 280, 16509},
+    {173, -164, 59, -34, -90, 16455},
+    {134, -119, 86, 256, -182, 16217},
+    {123, -116, 83, 109, -29, 16374},
+    {129, -88, 73, -22, -151, 16464},
+    {191, -128, 25, -32, 39, 16101},
+    {127, -123, 70, -18, -27, 16304},
+    {189, -120, 77, -164, 44, 16552},
+    {174, -93, 101, -176, 223, 16247},
+    {162, -161, 76, 59, -62, 16442},
+    {147, -119, 21, -16, -4, 16353},
+    {220, -92, 124, 52, 88, 16304},
+    {122, -140, 93, -76, -124, 16417},
+    {107, -88, 71, -3, -62, 16615},
+    {189, -124, 115, -133, -133, 16195},
+    {97, -154, 47, 80, -72, 16498},
+    {202, -78, 99, -231, -134, 16321},
+    {110, -120, 58, -141, -97, 16421},
+    {201, -72, 56, 190, 105, 16366},
+    {120, -116, 60, 179, -257, 16082},
+    {133, -133, 69, -223, -25, 16714},
+    {209, -82, 36, 69, 44, 16387},
+    {139, -122, 51, -218, 92, 16577},
+    {144, -56, 77, -303, -143, 16742},
+    {188, -105, 55, 175, -5, 16314},
+    {159, -182, 76, -30, 272, 16543},
+    {124, -122, 52, -273, -24, 16364},
+    {130, -107, 59, 121, -193, 16547},
+    {166, -109, 44, 210, 106, 16457},
+    {173, -78, 43, -71, 251, 16527},
+    {150, -158, 92, -145, -81, 16572},
+    {122, -140, 70, -97, -176, 16463},
+    {173, -85, 36, 32, -45, 16508},
+    {160, -100, 119, -10, 127, 16378},
+    {141, -89, 99, 192, 176, 16344},
+    {148, -84, 101, 47, 61, 16136},
+    {158, -112, 60, -70, 201, 15990},
+    {124, -149, 84, -135, 319, 16222},
+    {89, -77, 41, 66, 223, 16323},
+    {140, -96, 100, -45, -128, 16473},
+    {123, -99, 117, -88, -17, 16764},
+    {124, -133, 52, 151, 96, 16344},
+    {126, -90, 125, -152, 16, 16298},
+    {102, -64, 40, 119, -4, 16530},
+    {126, -103, 53, -196, 97, 16141},
+    {133, -119, 27, 86, -93, 16414},
+    {117, -103, 46, -273, 130, 16433},
+    {154, -97, 112, -82, 167, 16801},
+    {170, -134, 65, 208, -170, 16456},
+    {187, -126, 83, -413, 442, 16688},
+    {209, -123, 88, 61, 127, 16519},
+    {191, -158, 127, 38, 39, 16521},
+    {147, -47, 0, 212, -43, 16533},
+    {153, -87, 82, 133, -10, 16183},
+    {187, -116, 73, -125, 240, 16316},
+    {166, -75, 102, 37, -224, 16365},
+    {135, -108, 114, 118, -131, 16235},
+    {171, -96, 96, -59, 157, 16356},
+    {144, -109, 83, 233, -264, 16271},
+    {160, -108, 42, 187, -237, 16400},
+    {206, -113, 42, -167, 196, 16161},
+    {168, -96, 7, -135, -4, 16522},
+    {153, -123, 74, -136, -71, 16252},
+    {108, -106, 105, 40, 203, 16205},
+    {162, -66, 76, -25, 163, 16265},
+    {129, -139, 68, 264, 217, 16384},
+    {189, -99, 10, 189, -466, 16545},
+    {157, -117, 59, -92, 56, 16601},
+    {196, -142, 118, 38, -16, 16236},
+    {224, -150, 88, 39, -40, 16396},
+    {125, -95, 97, -246, -24, 16144},
+    {162, -137, 104, 64, -203, 16514},
+    {75, -86, 58, -173, -127, 16532},
+    {187, -125, 39, 372, -173, 16308},
+    {165, -131, 54, 142, 90, 16368},
+    {209, -128, 66, 318, 286, 16199},
+    {112, -102, 74, 70, -275, 16236},
+    {124, -109, 61, -15, -120, 16354},
+    {154, -100, 94, -261, -66, 16069},
+    {166, -157, 94, 294, 337, 16357},
+    {154, -156, 61, 108, -237, 16363},
+    {183, -104, 82, 10, 266, 16608},
+    {166, -80, 38, 95, 40, 16296},
+    {139, -112, 87, -11, 60, 16554},
+    {136, -109, 60, -142, 118, 16321},
+    {219, -79, 111, 43, -119, 16696},
+    {164, -94, 61, -187, -55, 16493},
+    {115, -100, 103, -66, 267, 16628},
+    {168, -156, 112, 80, -93, 16464},
+    {190, -142, 82, -99, 253, 16671},
+    {148, -117, 63, 189, 145, 16539},
+    {143, -88, 54, 38, 14, 16179},
+    {135, -106, 68, 81, 50, 16246},
+    {160, -94, 73, 155, 80, 16165},
+    {132, -31, 63, -14, -131, 16485},
+    {159, -56, 60, 98, 58, 16451},
+    {208, -125, 44, 47, -128, 16485},
+    {173, -102, 67, -33, 243, 16456},
+    {194, -93, 77, 104, -22, 16322},
+    {151, -163, 50, -78, 113, 16521},
+    {192, -83, 43, 67, -187, 16449},
+    {174, -85, 128, -48, 109, 16773},
+    {128, -113, 87, -57, -6, 16391},
+    {156, -120, 108, 246, 244, 16253},
+    {161, -63, 65, 138, -107, 16260},
+    {172, -103, 30, -248, -67, 16440},
+    {206, -101, 67, -9, 100, 16525},
+    {128, -141, 107, -127, 166, 16124},
+    {123, -130, 67, 135, -203, 16211},
+    {147, -131, 49, -56, -379, 16514},
+    {187, -113, 104, -86, -218, 16210},
+    {150, -98, 54, -17, 222, 16375},
+    {138, -133, 117, 197, 145, 16321},
+    {202, -76, 57, 100, -14, 16207},
+    {169, -96, 48, -176, -277, 16385},
+    {216, -141, 81, -43, -97, 16083},
+    {158, -115, 102, -217, -211, 16140},
+    {160, -51, 60, -277, -339, 16386},
+    {137, -121, 82, 146, -38, 16402},
+    {102, -126, 80, -155, -256, 16574},
+    {142, -95, 70, 14, -196, 16413},
+    {126, -125, 117, -72, -150, 16343},
+    {147, -131, 85, -386, -36, 16294},
+    {126, -185, 128, -258, 67, 16249},
+    {119, -133, 128, 223, -233, 16395},
+    {165, -115, 98, -57, -394, 16629},
+    {210, -69, 76, 130, 226, 16301},
+    {137, -50, 121, -16, 118, 16655},
+    {152, 44, 182, -211, 83, 16135},
+    {180, 12, 165, 392, 95, 16552},
+    {210, 17, 201, 41, 236, 16366},
+    {161, 107, 256, 81, 81, 16265},
+    {199, 133, 266, 136, -158, 16233},
+    {202, 111, 247, -8, -208, 16440},
+    {292, 177, 305, 61, 65, 16368},
+    {255, 238, 346, -215, -33, 16400},
+    {227, 212, 334, 284, -81, 16681},
+    {287, 236, 309, -170, 145, 16592},
+    {373, 302, 387, 94, 64, 16333},
+    {367, 323, 405, -5, -54, 16253},
+    {341, 394, 414, 110, -76, 16508},
+    {387, 328, 438, 83, 12, 16414},
+    {395, 418, 362, 105, 225, 16356},
+    {460, 420, 476, -75, -50, 16563},
+    {463, 455, 477, -13, 300, 16557},
+    {531, 497, 452, 124, -81, 16542},
+    {558, 514, 524, 198, 80, 16185},
+    {617, 537, 494, -131, 217, 16553},
+    {567, 638, 559, -105, 12, 16329},
+    {683, 594, 553, -232, 52, 16020},
+    {725, 687, 598, -207, 104, 16458},
+    {748, 695, 598, -305, -51, 16434},
+    {814, 746, 589, -21, -50, 16539},
+    {843, 795, 632, -93, 174, 16078},
+    {878, 787, 741, -60, 146, 16146},
+    {947, 849, 709, 87, -360, 16537},
+    {953, 853, 682, 111, -108, 16179},
+    {1044, 894, 671, -177, -4, 16477},
+    {1084, 921, 744, -395, 399, 16569},
+    {1102, 956, 738, 19, 190, 16504},
+    {1202, 944, 802, -358, 83, 16333},
+    {1202, 989, 763, -95, 208, 16099},
+    {1270, 1084, 802, -149, 392, 16439},
+    {1340, 1055, 832, -309, 238, 16522},
+    {1394, 1079, 845, -430, 456, 16315},
+    {1464, 1096, 827, -64, 34, 16246},
+    {1506, 1188, 870, -275, 45, 16379},
+    {1591, 1176, 888, -334, 150, 16258},
+    {1568, 1157, 911, -490, 95, 16473},
+    {1661, 1219, 871, -505, 462, 16547},
+    {1710, 1321, 930, -497, 246, 16178},
+    {1745, 1246, 902, -655, 848, 16207},
+    {1819, 1307, 935, -335, 130, 16421},
+    {1890, 1333, 956, -543, 436, 16751},
+    {1929, 1372, 980, -375, 376, 16506},
+    {2009, 1378, 980, -386, 633, 16190},
+    {2078, 1436, 935, -410, 524, 15997},
+    {2074, 1431, 967, -552, 467, 16510},
+    {2144, 1433, 1011, -646, 307, 16352},
+    {2195, 1478, 968, -641, 419, 16582},
+    {2225, 1512, 1037, -667, 374, 16304},
+    {2291, 1546, 1056, -369, 547, 16472},
+    {2358, 1521, 1119, -670, 675, 16206},
+    {2425, 1534, 1097, -594, 919, 16404},
+    {2441, 1627, 1132, -779, 655, 16161},
+    {2557, 1606, 1077, -187, 548, 16432},
+    {2580, 1569, 1139, -427, 537, 16463},
+    {2599, 1631, 1125, -643, 1009, 16120},
+    {2589, 1613, 1136, -694, 661, 16269},
+    {2679, 1631, 1152, -509, 583, 16351},
+    {2852, 1654, 1089, -350, 909, 16476},
+    {2843, 1652, 1145, -662, 771, 16353},
+    {2869, 1669, 1136, -605, 1164, 16550},
+    {2890, 1628, 1186, -832, 403, 16169},
+    {2895, 1683, 1130, -612, 972, 16461},
+    {2963, 1713, 1165, -802, 808, 16004},
+    {2931, 1671, 1223, -652, 653, 16391},
+    {3016, 1699, 1176, -548, 1021, 16127},
+    {3137, 1698, 1179, -574, 1195, 16450},
+    {3137, 1696, 1197, -622, 1006, 16661},
+    {3182, 1685, 1227, -1027, 705, 16282},
+    {3191, 1701, 1200, -546, 1271, 16546},
+    {3220, 1770, 1268, -810, 824, 16596},
+    {3157, 1673, 1190, -1103, 1187, 16176},
+    {3237, 1730, 1224, -947, 983, 16601},
+    {3271, 1654, 1272, -1285, 1075, 16266},
+    {3320, 1729, 1212, -1255, 1507, 15987},
+    {3292, 1680, 1268, -953, 1236, 16125},
+    {3340, 1722, 1276, -776, 1147, 16490},
+    {3314, 1678, 1270, -1072, 1444, 16268},
+    {3354, 1651, 1228, -840, 1253, 16134},
+    {3420, 1673, 1258, -1056, 1493, 16389},
+    {3363, 1706, 1247, -1160, 1131, 16171},
+    {3349, 1665, 1250, -1161, 1178, 16210},
+    {3374, 1639, 1241, -1418, 1677, 16290},
+    {3402, 1632, 1188, -1319, 1624, 16062},
+    {3372, 1608, 1284, -1146, 1832, 16442},
+    {3450, 1579, 1262, -1262, 1506, 16082},
+    {3391, 1588, 1262, -1183, 1624, 16437},
+    {3371, 1585, 1256, -1231, 1603, 16363},
+    {3376, 1589, 1190, -1327, 1828, 16178},
+    {3369, 1560, 1203, -1455, 1806, 16185},
+    {3301, 1493, 1213, -1191, 1968, 16217},
+    {3325, 1517, 1225, -1302, 1567, 16188},
+    {3351, 1493, 1156, -1171, 1966, 15894},
+    {3327, 1432, 1233, -1189, 1770, 16353},
+    {3286, 1484, 1259, -1578, 1724, 15983},
+    {3221, 1368, 1228, -1037, 2369, 16295},
+    {3219, 1328, 1159, -1353, 1960, 16283},
+    {3159, 1354, 1154, -1287, 2229, 16285},
+    {3116, 1318, 1159, -1458, 2113, 15801},
+    {3127, 1258, 1161, -1251, 2011, 16271},
+    {3052, 1285, 1196, -1238, 2205, 16049},
+    {3020, 1220, 1222, -1236, 2194, 16131},
+    {3004, 1167, 1219, -1416, 2554, 16261},
+    {2861, 1156, 1165, -1657, 2622, 16124},
+    {2865, 1097, 1136, -1548, 2419, 16236},
+    {2830, 1008, 1099, -1288, 2553, 16024},
+    {2788, 1020, 1123, -1664, 2242, 16268},
+    {2703, 985, 1126, -1672, 2489, 16158},
+    {2650, 925, 1126, -1832, 2394, 16201},
+    {2530, 889, 1039, -1648, 2435, 15949},
+    {2541, 867, 1073, -1521, 2669, 16410},
+    {2478, 854, 1094, -1900, 2580, 16049},
+    {2404, 778, 1083, -1659, 2320, 16152},
+    {2262, 734, 1056, -1605, 2523, 15789},
+    {2204, 600, 989, -1254, 2355, 15860},
+    {2155, 640, 1052, -1489, 2529, 16134},
+    {2102, 556, 1010, -1458, 2585, 16191},
+    {1967, 565, 1014, -1539, 2735, 16464},
+    {1903, 394, 952, -1653, 2684, 15852},
+    {1758, 401, 968, -1369, 2760, 15921},
+    {1715, 363, 960, -1793, 2418, 16438},
+    {1590, 288, 890, -1606, 2632, 15807},
+    {1501, 235, 854, -1542, 3011, 15978},
+    {1366, 245, 909, -1535, 2688, 16214},
+    {1353, 117, 937, -1674, 2904, 16086},
+    {1209, 79, 832, -1757, 2755, 15960},
+    {1145, 27, 834, -1790, 2477, 15769},
+    {1066, 16, 882, -1580, 2613, 16066},
+    {962, -75, 767, -1647, 2769, 15887},
+    {807, -120, 784, -1592, 2724, 15938},
+    {741, -281, 799, -1519, 2848, 15855},
+    {665, -294, 727, -1628, 2708, 16210},
+    {434, -367, 693, -1611, 2681, 16093},
+    {304, -381, 706, -1651, 3212, 16157},
+    {211, -470, 682, -1495, 2628, 16088},
+    {151, -536, 672, -1264, 3021, 15985},
+    {30, -659, 637, -1360, 2722, 16046},
+    {-116, -629, 558, -1656, 2728, 16016},
+    {-258, -759, 625, -1610, 3069, 16056},
+    {-330, -771, 549, -1705, 2689, 16201},
+    {-457, -857, 534, -1588, 2721, 16309},
+    {-610, -874, 529, -1336, 2749, 16112},
+    {-690, -1059, 498, -1241, 2636, 15964},
+    {-846, -1120, 474, -1518, 2843, 16176},
+    {-977, -1125, 505, -1464, 2915, 16027},
+    {-1148, -1248, 429, -1145, 2940, 16073},
+    {-1257, -1291, 421, -1289, 2816, 16005},
+    {-1318, -1353, 346, -1572, 2688, 16115},
+    {-1506, -1422, 361, -1730, 2817, 16007},
+    {-1633, -1524, 353, -1520, 2534, 16003},
+    {-1739, -1582, 298, -1568, 3117, 16232},
+    {-1916, -1646, 264, -1652, 2668, 16144},
+    {-2006, -1722, 219, -1439, 2672, 16135},
+    {-2206, -1785, 231, -1007, 2790, 16194},
+    {-2299, -1856, 197, -1311, 2586, 16028},
+    {-2436, -1900, 213, -1339, 2811, 16387},
+    {-2496, -2055, 174, -1247, 2585, 15773},
+    {-2666, -2067, 102, -1203, 2410, 16191},
+    {-2779, -2147, 134, -1543, 2664, 15895},
+    {-2982, -2300, 17, -1315, 2343, 15987},
+    {-3088, -2302, 12, -1236, 2258, 16055},
+    {-3209, -2399, 46, -1255, 2232, 16308},
+    {-3363, -2476, -46, -1353, 2441, 16211},
+    {-3420, -2610, -36, -1410, 2191, 16319},
+    {-3612, -2644, -105, -950, 2505, 16159},
+    {-3691, -2658, -74, -1118, 2335, 16448},
+    {-3795, -2724, -144, -921, 2147, 15967},
+    {-3995, -2856, -141, -983, 2084, 16146},
+    {-4126, -2962, -223, -630, 1875, 15922},
+    {-4289, -2981, -207, -942, 1842, 16182},
+    {-4354, -3077, -247, -857, 1831, 16212},
+    {-4420, -3149, -335, -1052, 1670, 16147},
+    {-4589, -3236, -422, -1105, 1826, 16301},
+    {-4692, -3288, -364, -667, 1873, 16135},
+    {-4832, -3353, -433, -756, 1905, 16296},
+    {-4985, -3411, -461, -998, 1796, 16106},
+    {-5035, -3501, -480, -653, 1827, 16239},
+    {-5177, -3588, -479, -967, 1513, 16059},
+    {-5299, -3657, -540, -636, 1560, 16473},
+    {-5367, -3761, -539, -607, 1717, 16269},
+    {-5452, -3753, -604, -552, 1621, 16524},
+    {-5611, -3827, -654, -659, 1539, 16453},
+    {-5706, -3909, -684, -373, 1318, 16524},
+    {-5772, -3982, -740, -690, 1157, 16448},
+    {-5832, -4058, -745, -249, 1250, 16435},
+    {-5993, -4050, -812, -504, 1146, 16420},
+    {-6051, -4117, -839, -455, 850, 16417},
+    {-6201, -4241, -850, -79, 1124, 16079},
+    {-6189, -4270, -837, -27, 879, 16158},
+    {-6289, -4454, -893, 202, 1036, 16159},
+    {-6415, -4403, -953, -219, 681, 16178},
+    {-6486, -4550, -1014, -142, 967, 16380},
+    {-6556, -4561, -1013, 77, 489, 16403},
+    {-6628, -4615, -1003, -33, 390, 16093},
+    {-6713, -4652, -1053, 256, 855, 16101},
+    {-6772, -4719, -1108, -375, 227, 16406},
+    {-6699, -4793, -1156, -4, 476, 16337},
+    {-6885, -4861, -1149, 576, 126, 15991},
+    {-6950, -4935, -1216, 151, 125, 16305},
+    {-7011, -5006, -1358, 159, 480, 16612},
+    {-7033, -4992, -1294, 398, 97, 16082},
+    {-7043, -5065, -1375, 334, -150, 16367},
+    {-7071, -5095, -1348, 294, -155, 16319},
+    {-7122, -5211, -1405, 440, -244, 16362},
+    {-7217, -5190, -1438, 396, -414, 16466},
+    {-7231, -5279, -1481, 600, -361, 16470},
+    {-7245, -5272, -1568, 482, -493, 16254},
+    {-7254, -5320, -1548, 825, -294, 16559},
+    {-7267, -5349, -1517, 643, -515, 16327},
+    {-7312, -5441, -1590, 942, -676, 16197},
+    {-7342, -5527, -1693, 1278, -957, 16271},
+    {-7302, -5559, -1719, 741, -928, 16184},
+    {-7317, -5492, -1773, 1081, -865, 16083},
+    {-7339, -5618, -1742, 1108, -1053, 16379},
+    {-7317, -5622, -1822, 1323, -1052, 15934},
+    {-7282, -5615, -1848, 1052, -1203, 16388},
+    {-7272, -5705, -1925, 1104, -1566, 16468},
+    {-7337, -5808, -1932, 1241, -1159, 16570},
+    {-7267, -5782, -1954, 1410, -1483, 15951},
+    {-7176, -5796, -2032, 1443, -1622, 15825},
+    {-7226, -5790, -2075, 1560, -1408, 16252},
+    {-7108, -5874, -2050, 1647, -1841, 16235},
+    {-7137, -5850, -2087, 1592, -1763, 15958},
+    {-7106, -5915, -2160, 1725, -1745, 16174},
+    {-7025, -5957, -2203, 1640, -1793, 16340},
+    {-6985, -5925, -2182, 1981, -2191, 15894},
+    {-6965, -6033, -2195, 1882, -1828, 15981},
+    {-6880, -5995, -2257, 2281, -1965, 15704},
+    {-6789, -5965, -2276, 1982, -2378, 16364},
+    {-6718, -6080, -2377, 2008, -2243, 16163},
+    {-6660, -6009, -2381, 2181, -2356, 15847},
+    {-6610, -6046, -2390, 1932, -2212, 16142},
+    {-6520, -6063, -2451, 2334, -2247, 16181},
+    {-6431, -6027, -2504, 2347, -2431, 16108},
+    {-6385, -6061, -2554, 2317, -2719, 15973},
+    {-6285, -6090, -2566, 2594, -2431, 15720},
+    {-6198, -6059, -2565, 2727, -2587, 16146},
+    {-6094, -6072, -2622, 2948, -2913, 16228},
+    {-6020, -6140, -2695, 3093, -2877, 16034},
+    {-5900, -6083, -2650, 2520, -3133, 15676},
+    {-5772, -6089, -2756, 3030, -3030, 15833},
+    {-5703, -6098, -2731, 3086, -2850, 15759},
+    {-5612, -6065, -2799, 2812, -2933, 15690},
+    {-5473, -6017, -2818, 3436, -3084, 15733},
+    {-5340, -6039, -2844, 3103, -3078, 15832},
+    {-5242, -6071, -2870, 3098, -3061, 16008},
+    {-5117, -6022, -2932, 3652, -3311, 15958},
+    {-4951, -6009, -3005, 3256, -3266, 15656},
+    {-4831, -6057, -2934, 3201, -3061, 15861},
+    {-4728, -5933, -3021, 3387, -3366, 15546},
+    {-4613, -5949, -3076, 3519, -3821, 15725},
+    {-4423, -5913, -3060, 3676, -3509, 15788},
+    {-4307, -5900, -3113, 3865, -3625, 15843},
+    {-4134, -5878, -3190, 3917, -3601, 15332},
+    {-4037, -5835, -3184, 4033, -3606, 15452},
+    {-3866, -5780, -3186, 3740, -3685, 15361},
+    {-3667, -5747, -3229, 4087, -3554, 15438},
+    {-3514, -5736, -3291, 3952, -3533, 15533},
+    {-3361, -5671, -3320, 4011, -3900, 15115},
+    {-3150, -5719, -3319, 4161, -3639, 15267},
+    {-3070, -5636, -3323, 3811, -3604, 15219},
+    {-2946, -5660, -3406, 4305, -4011, 15508},
+    {-2688, -5573, -3365, 4169, -3616, 15507},
+    {-2516, -5487, -3432, 4236, -3884, 15557},
+    {-2351, -5476, -3429, 4295, -3775, 15238},
+    {-2178, -5516, -3525, 4151, -3554, 15188},
+    {-2044, -5396, -3513, 4693, -3668, 15161},
+    {-1829, -5313, -3563, 4681, -3841, 15286},
+    {-1645, -5286, -3574, 4270, -3833, 15105},
+    {-1499, -5249, -3615, 4555, -3920, 15266},
+    {-1282, -5205, -3642, 4765, -3987, 15011},
+    {-1122, -5131, -3681, 4840, -3919, 15147},
+    {-908, -5088, -3685, 4800, -3679, 15072},
+    {-715, -5013, -3702, 5029, -3914, 15120},
+    {-530, -4971, -3683, 5178, -3527, 14976},
+    {-374, -4892, -3764, 4951, -3583, 14903},
+    {-201, -4815, -3777, 5281, -3922, 15014},
+    {5, -4772, -3832, 5194, -3781, 14763},
+    {194, -4732, -3838, 5437, -4039, 15276},
+    {400, -4636, -3835, 5357, -3672, 15037},
+    {607, -4537, -3902, 5158, -3524, 15117},
+    {815, -4560, -3905, 5409, -3390, 15028},
+    {972, -4455, -3879, 5323, -4199, 15029},
+    {1151, -4305, -3933, 5716, -3625, 14941},
+    {1411, -4340, -3899, 5622, -3855, 14782},
+    {1533, -4250, -3952, 5416, -3813, 14843},
+    {1791, -4156, -3965, 5815, -3413, 14984},
+    {1943, -4096, -4014, 6137, -3677, 14696},
+    {2122, -3959, -4027, 5667, -3288, 14710},
+    {2318, -3907, -4056, 5976, -3401, 14858},
+    {2495, -3869, -4035, 5693, -3395, 14876},
+    {2705, -3764, -4035, 6097, -3519, 15077},
+    {2873, -3654, -4061, 6136, -3240, 14836},
+    {3074, -3633, -4103, 5965, -3554, 14644},
+    {3282, -3534, -4203, 6260, -3489, 14746},
+    {3410, -3460, -4121, 6165, -3541, 14843},
+    {3603, -3306, -4132, 6173, -3219, 15020},
+    {3741, -3253, -4134, 6245, -3146, 14849},
+    {3959, -3124, -4223, 6475, -3050, 14861},
+    {4122, -3071, -4207, 6640, -3178, 14906},
+    {4291, -2967, -4233, 6435, -3120, 14718},
+    {4468, -2881, -4235, 6558, -2710, 14844},
+    {4663, -2819, -4224, 6564, -2850, 14644},
+    {4808, -2643, -4273, 6409, -2958, 14655},
+    {5006, -2556, -4240, 6825, -3027, 14745},
+    {5142, -2523, -4222, 6804, -2698, 14960},
+    {5314, -2412, -4251, 6401, -2738, 14708},
+    {5532, -2264, -4304, 6724, -2485, 14773},
+    {5644, -2212, -4258, 6829, -2492, 14890},
+    {5804, -2160, -4327, 6549, -2438, 14763},
+    {6000, -1985, -4356, 6823, -2175, 14916},
+    {6179, -1874, -4340, 6769, -2104, 14606},
+    {6265, -1781, -4395, 6482, -1931, 14699},
+    {6415, -1724, -4439, 6448, -2169, 14806},
+    {6636, -1616, -4332, 6664, -2037, 14808},
+    {6721, -1525, -4333, 6825, -1883, 14741},
+    {6842, -1431, -4361, 6917, -1793, 14632},
+    {6927, -1292, -4367, 6846, -1915, 14796},
+    {7059, -1183, -4342, 6822, -1590, 14585},
+    {7221, -1037, -4372, 6917, -1361, 14852},
+    {7380, -991, -4376, 6819, -1592, 14728},
+    {7530, -912, -4413, 6917, -1543, 14830},
+    {7536, -769, -4409, 7135, -1457, 15137},
+    {7659, -626, -4409, 6776, -1189, 14776},
+    {7815, -569, -4434, 6744, -1006, 14690},
+    {7880, -463, -4440, 6807, -956, 14644},
+    {8005, -389, -4413, 7053, -863, 14656},
+    {8038, -275, -4402, 6972, -788, 14829},
+    {8148, -121, -4418, 6790, -886, 14732},
+    {8213, -41, -4430, 6720, -625, 14500},
+    {8354, 57, -4414, 6935, -711, 14624},
+    {8393, 182, -4432, 6819, -492, 14946},
+    {8515, 237, -4427, 6622, -415, 14642},
+    {8592, 413, -4430, 6822, -307, 14874},
+    {8609, 426, -4407, 6766, -180, 14761},
+    {8709, 571, -4407, 6779, -123, 15134},
+    {8830, 642, -4473, 6591, 123, 15124},
+    {8820, 862, -4383, 6918, 182, 14625},
+    {8855, 931, -4363, 6825, 74, 14890},
+    {8929, 1050, -4372, 6636, 40, 14825},
+    {8938, 1188, -4365, 6767, 412, 14870},
+    {8995, 1251, -4361, 6788, 599, 14663},
+    {9068, 1329, -4395, 6968, 756, 14939},
+    {9101, 1427, -4370, 7080, 877, 15196},
+    {9113, 1456, -4334, 6804, 821, 14768},
+    {9135, 1619, -4299, 6889, 1201, 14951},
+    {9189, 1753, -4322, 6755, 1180, 15041},
+    {9169, 1832, -4335, 6380, 1452, 14789},
+    {9172, 1946, -4360, 6551, 1122, 14939},
+    {9166, 2097, -4310, 6669, 1183, 14689},
+    {9168, 2163, -4294, 6569, 1687, 14844},
+    {9129, 2212, -4286, 6895, 1742, 14880},
+    {9131, 2336, -4320, 6665, 1965, 14970},
+    {9107, 2481, -4293, 6515, 1895, 14606},
+    {9158, 2562, -4262, 6545, 1971, 15182},
+    {9029, 2632, -4217, 6244, 2340, 14858},
+    {9060, 2725, -4153, 6462, 2140, 14805},
+    {8972, 2785, -4221, 6685, 2196, 14842},
+    {8974, 2893, -4219, 6560, 2364, 15082},
+    {8923, 3020, -4146, 6395, 2528, 14669},
+    {8923, 3131, -4234, 6158, 2641, 14747},
+    {8846, 3186, -4204, 6462, 2324, 14630},
+    {8748, 3299, -4128, 6126, 2850, 14837},
+    {8667, 3329, -4133, 5983, 2902, 15089},
+    {8647, 3416, -4097, 6302, 2929, 14795},
+    {8557, 3575, -4087, 6356, 3011, 15045},
+    {8478, 3615, -4051, 6018, 3323, 14665},
+    {8417, 3742, -4045, 5924, 3311, 14871},
+    {8342, 3814, -4049, 5967, 3776, 14966},
+    {8242, 3785, -4048, 5659, 3351, 14822},
+    {8170, 3923, -4051, 5779, 3527, 14935},
+    {8049, 4009, -3971, 5894, 3707, 14883},
+    {7942, 4089, -3955, 5706, 3816, 14958},
+    {7871, 4175, -3912, 5519, 3963, 14748},
+    {7772, 4331, -3941, 5730, 4438, 14825},
+    {7701, 4296, -3871, 5386, 4165, 15018},
+    {7508, 4410, -3914, 5606, 4412, 15085},
+    {7391, 4442, -3850, 5563, 4494, 15098},
+    {7344, 4629, -3834, 5346, 4412, 14912},
+    {7206, 4664, -3863, 5446, 4553, 15100},
+    {7016, 4721, -3835, 5267, 4499, 15068},
+    {6949, 4802, -3770, 5481, 4803, 14609},
+    {6805, 4860, -3680, 5299, 4928, 14711},
+    {6642, 4919, -3726, 5135, 4902, 15162},
+    {6460, 5018, -3659, 5203, 4844, 15095},
+    {6398, 5065, -3716, 5343, 4879, 14751},
+    {6242, 5087, -3577, 4894, 4820, 15029},
+    {6093, 5187, -3629, 4883, 5086, 14525},
+    {5966, 5233, -3590, 4894, 5441, 14500},
+    {5824, 5334, -3574, 4557, 5154, 15084},
+    {5560, 5355, -3542, 4747, 5185, 14835},
+    {5467, 5380, -3479, 4340, 5267, 14517},
+    {5374, 5467, -3486, 4679, 5474, 14548},
+    {5129, 5482, -3514, 4531, 5535, 14799},
+    {4964, 5560, -3388, 4277, 5594, 14654},
+    {4816, 5591, -3408, 4438, 5769, 14945},
+    {4670, 5647, -3321, 4221, 5867, 14666},
+    {4457, 5708, -3339, 4401, 5469, 14749},
+    {4280, 5686, -3331, 4196, 6032, 14938},
+    {4111, 5744, -3299, 4178, 5832, 15182},
+    {3955, 5765, -3158, 3893, 5845, 14461},
+    {3777, 5784, -3279, 3964, 5683, 14736},
+    {3611, 5857, -3102, 3556, 5952, 14681},
+    {3390, 5873, -3173, 3632, 5959, 14683},
+    {3264, 5910, -3175, 3862, 5728, 14705},
+    {3112, 5996, -3038, 3783, 5796, 14877},
+    {2817, 5978, -3074, 3492, 6118, 14664},
+    {2683, 5978, -3056, 3551, 6057, 14810},
+    {2481, 6058, -2976, 3461, 6244, 15006},
+    {2336, 6038, -2983, 3336, 6166, 14651},
+    {2134, 6008, -2919, 3423, 6504, 14513},
+    {1910, 6071, -2840, 3126, 6373, 14978},
+    {1736, 6113, -2813, 2976, 6482, 14782},
+    {1561, 6094, -2873, 3119, 6246, 14909},
+    {1368, 6198, -2792, 2988, 6142, 14866},
+    {1240, 6076, -2722, 3142, 6384, 14433},
+    {1030, 6215, -2694, 2572, 6356, 14853},
+    {826, 6187, -2722, 2897, 6451, 14938},
+    {642, 6119, -2654, 2820, 6467, 15099},
+    {427, 6131, -2628, 2688, 6148, 14916},
+    {232, 6150, -2599, 2735, 6278, 14953},
+    {68, 6145, -2562, 2421, 6211, 15203},
+    {-93, 6200, -2497, 2358, 6324, 14788},
+    {-308, 6131, -2471, 2325, 6464, 14935},
+    {-485, 6179, -2408, 2221, 6489, 14800},
+    {-664, 6169, -2393, 2289, 5980, 15047},
+    {-874, 6192, -2359, 1979, 6074, 14826},
+    {-1020, 6097, -2390, 1939, 6463, 15007},
+    {-1161, 6115, -2270, 1745, 6522, 14895},
+    {-1440, 6136, -2263, 1900, 6486, 14950},
+    {-1555, 6146, -2253, 1913, 6600, 15133},
+    {-1744, 6066, -2174, 1513, 6220, 14949},
+    {-1896, 6122, -2166, 1883, 6207, 14718},
+    {-2066, 6087, -2140, 1517, 6345, 15076},
+    {-2249, 6046, -2041, 1541, 6119, 15124},
+    {-2425, 5974, -2042, 1573, 6047, 15351},
+    {-2622, 6019, -2014, 1503, 6056, 15128},
+    {-2743, 6021, -1918, 1361, 6510, 15240},
+    {-2910, 5939, -1993, 1345, 6254, 15342},
+    {-3070, 5867, -1845, 1288, 5880, 15026},
+    {-3180, 5923, -1867, 1005, 6192, 15193},
+    {-3348, 5839, -1836, 912, 6287, 14953},
+    {-3525, 5896, -1773, 799, 6064, 15236},
+    {-3633, 5830, -1728, 867, 6050, 15334},
+    {-3800, 5824, -1667, 317, 6061, 15343},
+    {-3961, 5752, -1657, 685, 5816, 15025},
+    {-4076, 5621, -1584, 536, 5567, 15340},
+    {-4230, 5644, -1555, 544, 5992, 15103},
+    {-4416, 5621, -1486, 150, 5643, 15117},
+    {-4524, 5599, -1433, 410, 5683, 15233},
+    {-4701, 5494, -1467, 112, 5627, 15318},
+    {-4805, 5482, -1394, 68, 5736, 15341},
+    {-4921, 5396, -1425, -63, 5740, 15427},
+    {-5030, 5360, -1398, 282, 5610, 15512},
+    {-5173, 5386, -1284, 217, 5663, 15174},
+    {-5205, 5253, -1280, 36, 5648, 15602},
+    {-5403, 5230, -1198, 91, 4993, 15417},
+    {-5447, 5192, -1241, 58, 5298, 15499},
+    {-5590, 5143, -1165, -97, 4910, 15768},
+    {-5695, 5071, -1159, 70, 5158, 15500},
+    {-5776, 4997, -1106, -411, 4839, 15616},
+    {-5871, 4955, -1047, -336, 4994, 15848},
+    {-5921, 4897, -1010, -38, 5078, 15918},
+    {-6035, 4834, -965, -294, 5125, 15590},
+    {-6135, 4790, -928, -244, 5000, 15725},
+    {-6227, 4712, -917, -493, 4962, 15881},
+    {-6258, 4678, -860, -353, 4883, 15437},
+    {-6342, 4596, -802, -575, 4828, 15780},
+    {-6419, 4568, -797, -637, 4565, 15652},
+    {-6485, 4506, -774, -540, 4407, 15886},
+    {-6551, 4393, -714, -854, 4161, 15929},
+    {-6614, 4317, -711, -587, 4743, 15572},
+    {-6632, 4219, -616, -403, 4443, 15800},
+    {-6748, 4129, -619, -853, 4279, 15665},
+    {-6733, 4075, -548, -1020, 4129, 16063},
+    {-6792, 4045, -494, -1329, 4035, 15823},
+    {-6829, 3968, -495, -1021, 3774, 15607},
+    {-6811, 3888, -484, -1357, 3856, 16147},
+    {-6889, 3831, -384, -906, 3687, 15963},
+    {-6929, 3758, -370, -1006, 3630, 15907},
+    {-6920, 3660, -344, -924, 4046, 16286},
+    {-6931, 3570, -296, -1136, 3768, 15955},
+    {-6951, 3533, -239, -1177, 3698, 16026},
+    {-7023, 3452, -280, -1214, 3473, 15913},
+    {-6952, 3396, -161, -1626, 3509, 15725},
+    {-7003, 3325, -172, -885, 3278, 15999},
+    {-6976, 3257, -135, -1436, 3368, 16185},
+    {-6986, 3169, -98, -1200, 3152, 15999},
+    {-6976, 3041, -83, -1376, 3173, 15888},
+    {-6955, 2995, -51, -1378, 3098, 15981},
+    {-6973, 2914, -11, -1389, 3094, 16232},
+    {-6892, 2827, 59, -1588, 2850, 16377},
+    {-6927, 2703, 85, -1852, 3064, 16339},
+    {-6828, 2667, 153, -1700, 2675, 16153},
+    {-6800, 2585, 100, -1418, 2676, 16115},
+    {-6845, 2491, 151, -1594, 2459, 16199},
+    {-6797, 2470, 185, -1633, 2485, 15966},
+    {-6715, 2379, 219, -1584, 2517, 15758},
+    {-6725, 2351, 241, -1628, 2221, 16061},
+    {-6633, 2146, 273, -1999, 2242, 16070},
+    {-6583, 2053, 345, -1932, 2290, 16278},
+    {-6478, 2026, 367, -1649, 2347, 16019},
+    {-6427, 1901, 403, -1856, 1983, 16241},
+    {-6453, 1854, 444, -2143, 2252, 16197},
+    {-6393, 1784, 425, -2051, 1989, 16115},
+    {-6248, 1697, 440, -1890, 1809, 15914},
+    {-6224, 1662, 472, -1780, 1285, 16207},
+    {-6139, 1532, 527, -2091, 1527, 16029},
+    {-6089, 1380, 535, -1923, 1955, 16125},
+    {-6018, 1399, 581, -1916, 1570, 16118},
+    {-5896, 1292, 657, -1953, 1348, 16383},
+    {-5818, 1222, 615, -2024, 1581, 16354},
+    {-5744, 1154, 685, -1977, 1612, 16319},
+    {-5621, 1080, 769, -2129, 1141, 15862},
+    {-5552, 950, 740, -1874, 1080, 16233},
+    {-5493, 872, 748, -2101, 1265, 16115},
+    {-5419, 836, 832, -2242, 1199, 16651},
+    {-5286, 696, 811, -1914, 930, 16149},
+    {-5225, 706, 820, -2254, 1452, 16432},
+    {-5054, 542, 875, -2203, 1137, 16436},
+    {-4971, 541, 934, -2257, 897, 16395},
+    {-4842, 415, 903, -2054, 920, 16344},
+    {-4779, 343, 998, -2133, 1120, 16174},
+    {-4659, 290, 943, -2121, 637, 16147},
+    {-4572, 192, 1018, -2101, 721, 16468},
+    {-4428, 117, 1000, -1858, 765, 16171},
+    {-4327, 28, 1102, -2222, 574, 16257},
+    {-4237, -21, 1084, -2341, 555, 16250},
+    {-4120, -95, 1076, -1924, 391, 16289},
+    {-3978, -159, 1106, -2073, 677, 16351},
+    {-3874, -206, 1137, -1911, 381, 16244},
+    {-3733, -229, 1204, -1850, 490, 16015},
+    {-3599, -385, 1185, -1919, 251, 16081},
+    {-3491, -409, 1163, -1937, 610, 16081},
+    {-3400, -540, 1195, -2043, 609, 16524},
+    {-3270, -545, 1218, -2311, 50, 16497},
+    {-3194, -641, 1269, -2143, 446, 16347},
+    {-2999, -677, 1309, -1895, 346, 16424},
+    {-2919, -736, 1277, -1965, 196, 15784},
+    {-2753, -798, 1329, -2150, 167, 16385},
+    {-2686, -864, 1328, -2026, -68, 16470},
+    {-2482, -897, 1401, -2086, 56, 16312},
+    {-2486, -1017, 1323, -2089, 259, 16231},
+    {-2318, -1098, 1347, -2051, 75, 16310},
+    {-2136, -1100, 1352, -2407, 37, 15897},
+    {-2019, -1217, 1403, -1976, -110, 16162},
+    {-1923, -1257, 1440, -1783, -264, 16082},
+    {-1763, -1301, 1444, -2406, 273, 15941},
+    {-1696, -1342, 1402, -1897, -18, 16734},
+    {-1613, -1428, 1439, -1917, -323, 16170},
+    {-1398, -1498, 1484, -2068, -18, 16113},
+    {-1274, -1534, 1447, -2028, -177, 16307},
+    {-1106, -1589, 1493, -1950, -301, 16114},
+    {-1038, -1608, 1528, -1822, -138, 16389},
+    {-965, -1643, 1557, -1560, -25, 16247},
+    {-796, -1718, 1538, -2213, 154, 16206},
+    {-749, -1749, 1556, -2045, -251, 16266},
+    {-569, -1772, 1534, -1916, -170, 16398},
+    {-401, -1800, 1630, -1747, -365, 16401},
+    {-345, -1886, 1561, -1838, -55, 16323},
+    {-232, -1873, 1595, -1628, -186, 16319},
+    {-134, -1996, 1589, -1324, 30, 16119},
+    {20, -1944, 1590, -1518, -655, 16309},
+    {74, -2040, 1668, -2106, 105, 16192},
+    {181, -2086, 1600, -1538, -189, 16282},
+    {287, -2087, 1621, -1553, 264, 16182},
+    {441, -2128, 1602, -1670, -356, 16343},
+    {545, -2191, 1646, -1808, -139, 16431},
+    {674, -2206, 1694, -1508, -146, 16506},
+    {722, -2188, 1633, -1699, -47, 16234},
+    {853, -2264, 1671, -1511, -76, 16239},
+    {935, -2287, 1690, -1563, -115, 16340},
+    {1030, -2269, 1662, -1210, -17, 16207},
+    {1118, -2361, 1656, -1365, -240, 16330},
+    {1189, -2363, 1674, -1485, 12, 16385},
+    {1303, -2327, 1632, -1512, -209, 16082},
+    {1374, -2450, 1716, -1354, 230, 16250},
+    {1441, -2404, 1678, -1232, 153, 15956},
+    {1586, -2415, 1669, -1311, 113, 16447},
+    {1686, -2455, 1724, -1467, -96, 16096},
+    {1737, -2490, 1658, -1108, -38, 16274},
+    {1789, -2485, 1686, -1277, -6, 16035},
+    {1843, -2462, 1709, -1259, 86, 16450},
+    {1915, -2523, 1656, -1336, 305, 15965},
+    {2002, -2504, 1670, -1173, 141, 16377},
+    {2071, -2589, 1685, -1144, 206, 16288},
+    {2113, -2550, 1689, -1417, 22, 16306},
+    {2142, -2573, 1698, -1081, -112, 16465},
+    {2200, -2539, 1666, -1091, 351, 16611},
+    {2325, -2549, 1628, -1035, -54, 16471},
+    {2331, -2663, 1662, -869, 179, 16414},
+    {2426, -2613, 1650, -1020, 189, 16159},
+    {2473, -2620, 1627, -800, 350, 16292},
+    {2460, -2609, 1687, -1100, 474, 16208},
+    {2551, -2594, 1649, -799, 442, 16364},
+    {2594, -2623, 1612, -871, 618, 16456},
+    {2591, -2623, 1651, -1100, 564, 16516},
+    {2701, -2563, 1620, -812, 417, 16351},
+    {2694, -2590, 1669, -876, 667, 16348},
+    {2752, -2552, 1634, -1027, 742, 16287},
+    {2735, -2535, 1616, -870, 354, 16527},
+    {2792, -2536, 1591, -583, 531, 16435},
+    {2797, -2581, 1615, -575, 470, 16194},
+    {2879, -2492, 1579, -430, 520, 16286},
+    {2805, -2544, 1636, -777, 817, 16171},
+    {2870, -2522, 1567, -592, 686, 16283},
+    {2885, -2511, 1536, -359, 571, 16244},
+    {2881, -2470, 1577, -477, 723, 16741},
+    {2828, -2477, 1519, -619, 600, 16406},
+    {2837, -2470, 1559, -544, 783, 16182},
+    {2921, -2418, 1614, -497, 707, 16184},
+    {2955, -2445, 1510, -445, 1184, 16219},
+    {2921, -2462, 1485, -745, 664, 16258},
+    {2906, -2336, 1459, -237, 1147, 16310},
+    {2899, -2344, 1556, -356, 1128, 16216},
+    {2939, -2316, 1489, -51, 1015, 16681},
+    {2883, -2298, 1452, -401, 915, 16217},
+    {2907, -2323, 1420, -362, 1128, 16306},
+    {2873, -2284, 1395, -563, 1008, 16220},
+    {2883, -2286, 1419, -518, 947, 16363},
+    {2890, -2219, 1446, -393, 1251, 16464},
+    {2831, -2179, 1395, -450, 791, 16471},
+    {2815, -2197, 1380, -519, 924, 16195},
+    {2786, -2169, 1365, 2, 1040, 16428},
+    {2730, -2196, 1331, -104, 1180, 16568},
+    {2788, -2109, 1272, -226, 1258, 16325},
+    {2715, -2086, 1292, -276, 1322, 16448},
+    {2711, -2029, 1287, -178, 1423, 16038},
+    {2686, -2021, 1328, -67, 1122, 15977},
+    {2665, -2002, 1309, 139, 1633, 16581},
+    {2612, -1909, 1269, -117, 1500, 16501},
+    {2611, -1870, 1236, 185, 1227, 16232},
+    {2560, -1853, 1297, 221, 1390, 16340},
+    {2549, -1884, 1261, 79, 1672, 16180},
+    {2464, -1854, 1227, 166, 1864, 16569},
+    {2445, -1835, 1179, 51, 1889, 15962},
+    {2358, -1786, 1175, -162, 1681, 16130},
+    {2337, -1738, 1192, 276, 1497, 16268},
+    {2264, -1762, 1084, 223, 1635, 16463},
+    {2279, -1703, 1074, 257, 1730, 16564},
+    {2268, -1592, 1079, 393, 1245, 16377},
+    {2207, -1593, 1057, -22, 1279, 15988},
+    {2119, -1584, 1049, 214, 1891, 16240},
+    {2119, -1567, 1068, 332, 1591, 16291},
+    {2035, -1449, 1059, 350, 1688, 16262},
+    {1988, -1513, 1006, 405, 1705, 16095},
+    {1972, -1447, 1046, 401, 1613, 16104},
+    {1879, -1420, 957, 11, 1677, 16459},
+    {1801, -1325, 894, 260, 1519, 16243},
+    {1807, -1330, 940, 295, 1899, 16296},
+    {1786, -1288, 931, 334, 1907, 16020},
+    {1724, -1264, 887, 612, 1949, 16260},
+    {1720, -1223, 836, 340, 1834, 16379},
+    {1630, -1223, 863, 328, 1932, 16072},
+    {1554, -1138, 822, 697, 1839, 16123},
+    {1495, -1164, 787, 208, 2208, 16568},
+    {1420, -1068, 795, 359, 2052, 16353},
+    {1442, -1113, 738, 726, 1724, 16030},
+    {1333, -999, 773, 588, 1817, 16316},
+    {1303, -975, 785, 578, 2101, 15968},
+    {1266, -942, 729, 516, 1733, 16058},
+    {1150, -920, 657, 247, 1733, 16010},
+    {1159, -929, 695, 521, 1923, 15876},
+    {1051, -838, 655, 449, 1753, 16006},
+    {1131, -829, 671, 339, 1905, 16190},
+    {1033, -854, 612, 471, 2181, 16217},
+    {944, -748, 603, 460, 2262, 16683},
+    {927, -761, 529, 230, 2257, 16062},
+    {953, -708, 536, 560, 1930, 16373},
+    {801, -661, 528, 617, 2148, 16325},
+    {791, -627, 502, 815, 1869, 16076},
+    {790, -590, 459, 550, 2322, 15948},
+    {679, -561, 450, 490, 1971, 16399},
+    {677, -553, 491, 882, 1921, 16292},
+    {647, -519, 450, 697, 2249, 16325},
+    {579, -453, 458, 613, 1953, 16300},
+    {564, -440, 412, 699, 1944, 16282},
+    {510, -403, 343, 555, 2287, 16481},
+    {516, -412, 345, 643, 2001, 16386},
+    {439, -415, 299, 477, 1926, 16206},
+    {399, -375, 307, 698, 2025, 16195},
+    {333, -288, 317, 745, 1956, 16406},
+    {369, -254, 310, 650, 2319, 16412},
+    {295, -257, 179, 520, 1948, 16006},
+    {261, -260, 217, 391, 2078, 16618},
+    {289, -309, 264, 499, 2039, 16061},
+    {291, -249, 205, 606, 2044, 16221},
+    {209, -208, 180, 744, 2079, 16467},
+    {228, -167, 148, 937, 2031, 16268},
+    {217, -89, 153, 565, 1727, 16100},
+    {180, -177, 81, 559, 2129, 16110},
+    {185, -141, 39, 551, 2256, 16232},
+    {168, -86, 55, 521, 2243, 16434},
+    {139, -89, 60, 528, 2372, 16165},
+    {153, -127, 108, 539, 2060, 16385},
+    {78, -103, 86, 341, 2156, 16133},
+    {156, -90, 27, 703, 1958, 16294},
+    {161, -142, 14, 766, 1790, 15939},
+    {155, -52, 71, 636, 2345, 16189},
+    {202, -129, 86, 471, 2136, 16177},
+    {117, -60, 31, 721, 2173, 16159},
+    {166, -69, 92, 676, 1772, 16277},
+    {244, -92, 106, 499, 2304, 16463},
+    {140, -120, 64, 534, 2102, 16325},
+    {188, -45, 26, 525, 1839, 16212},
+    {112, -139, 116, 623, 1924, 16192},
+    {159, -120, 80, 735, 2012, 16037},
+    {152, -159, 91, 480, 1783, 16235},
+    {96, -50, 110, 496, 1961, 16282},
+    {130, -153, 35, 478, 1975, 16268},
+    {123, -120, 74, 719, 1924, 16232},
+    {217, -113, 63, 749, 2183, 16430},
+    {130, -94, 69, 483, 2131, 16425},
+    {183, -123, 94, 694, 2046, 16261},
+    {106, -137, 96, 609, 1916, 16391},
+    {157, -123, 82, 745, 2344, 16173},
+    {147, -84, 67, 468, 2056, 16314},
+    {147, -91, 130, 576, 2225, 16178},
+    {151, -73, 66, 238, 2173, 16139},
+    {131, -122, 139, 493, 1934, 16342},
+    {145, -83, 102, 524, 2248, 16345},
+    {216, -133, 73, 437, 2030, 16438},
+    {159, -102, 58, 827, 2047, 16390},
+    {121, -129, 108, 431, 2017, 16105},
+    {119, -124, 37, 536, 2311, 16488},
+    {167, -107, 132, 638, 2222, 16320},
+    {222, -147, 63, 502, 1804, 16236},
+    {176, -84, 105, 768, 2140, 16344},
+    {140, -85, 80, 526, 2190, 16252},
+    {114, -132, 39, 921, 2026, 16166},
+    {137, -55, 41, 374, 2143, 16179},
+    {137, -128, 65, 467, 1915, 16058},
+    {93, -140, -1, 721, 2169, 16339},
+    {135, -125, 50, 560, 2283, 16295},
+    {108, -62, 58, 229, 2097, 16530},
+    {197, -80, 82, 665, 2046, 16612},
+    {129, -86, 84, 667, 2123, 16046},
+    {97, -116, 47, 362, 2205, 16357},
+    {158, -122, 109, 644, 2145, 16266},
+    {128, -120, 85, 420, 2106, 16119},
+    {117, -138, 31, 281, 2007, 16319},
+    {113, -110, 68, 430, 2085, 16586},
+    {148, -88, 57, 882, 1898, 15927},
+    {143, -139, 49, 488, 2118, 16281},
+    {121, -136, 61, 487, 2107, 16343},
+    {158, -78, 66, 476, 1951, 16155},
+    {148, -85, 96, 593, 2013, 16380},
+    {128, -123, 45, 643, 2070, 16427},
+    {133, -77, 90, 710, 1929, 16127},
+    {217, -91, 103, 791, 1853, 16458},
+    {109, -92, 106, 576, 1992, 15986},
+    {150, -69, 85, 896, 2123, 16135},
+    {107, -176, 83, 797, 2012, 16017},
+    {148, -134, 127, 886, 2315, 15867},
+    {156, -71, 170, 507, 2151, 16000},
+    {128, -129, 81, 712, 1755, 16358},
+    {99, -81, 39, 463, 1677, 16462},
+    {162, -151, 73, 549, 2200, 15988},
+    {154, -97, 82, 442, 1959, 16451},
+    {152, -79, 58, 635, 2052, 16497},
+    {148, -195, 105, 669, 2215, 16214},
+    {147, -46, 53, 656, 1964, 16056},
+    {162, -105, 67, 511, 2241, 16363},
+    {141, -108, 77, 845, 2175, 16076},
+    {147, -36, 50, 385, 2000, 16090},
+    {163, -96, 49, 600, 1836, 16296},
+    {159, -119, 49, 811, 2015, 16152},
+    {106, -134, 104, 856, 2146, 16530},
+    {145, -80, -8, 559, 2051, 16342},
+    {138, -73, 39, 370, 2214, 15920},
+    {188, -101, 71, 575, 1964, 16394},
+    {136, -133, 101, 456, 2100, 15862},
+    {132, -120, 100, 688, 2052, 16168},
+    {108, -149, 100, 513, 2221, 16196},
+    {175, -108, 107, 588, 2048, 16246},
+    {159, -108, 71, 624, 2255, 16449},
+    {166, -90, 83, 677, 1944, 16297},
+    {159, -131, 57, 521, 1881, 16229},
+    {169, -85, 69, 568, 2138, 15761},
+    {187, -142, 83, 763, 2225, 16361},
+    {103, -148, 87, 349, 2021, 16238},
+    {138, -103, 100, 673, 2111, 16123},
+    {91, -171, 64, 740, 2218, 16440},
+    {128, -170, 111, 707, 1993, 16359},
+    {210, -107, 76, 454, 2159, 15998},
+    {117, -134, 109, 617, 2082, 16187},
+    {118, -82, 106, 465, 2020, 16286},
+    {150, -136, 52, 484, 2256, 16488},
+    {140, -124, 88, 568, 2001, 15957},
+    {121, -88, 51, 724, 2420, 16161},
+    {163, -76, 73, 598, 2067, 16168},
+    {146, -143, 32, 396, 2520, 16450},
+};
+
+const int16_t test_imu_log_gravity[TEST_IMU_LOG_LENGTH / TEST_IMU_LOG_TRUTH_DECIM][3] = {
+    {0, 0, 16384},
+    {0, 0, 16384},
+    {0, 0, 16384},
+    {0, 0, 16384},
+    {0, 0, 16384},
+    {0, 0, 16384},
+    {0, 0, 16384},
+    {0, 0, 16384},
+    {0, 0, 16384},
+    {0, 0, 16384},
+    {0, 0, 16384},
+    {0, 0, 16384},
+    {0, 0, 16384},
+    {0, 0, 16384},
+    {0, 0, 16384},
+    {0, 0, 16384},
+    {0, 0, 16384},
+    {0, 0, 16384},
+    {0, 0, 16384},
+    {0, 0, 16384},
+    {0, 0, 16384},
+    {-15, 3, 16384},
+    {-61, 25, 16384},
+    {-142, 83, 16383},
+    {-257, 191, 16381},
+    {-401, 358, 16375},
+    {-570, 585, 16364},
+    {-755, 868, 16344},
+    {-946, 1196, 16313},
+    {-1132, 1551, 16271},
+    {-1301, 1910, 16220},
+    {-1442, 2245, 16165},
+    {-1543, 2530, 16114},
+    {-1595, 2735, 16075},
+    {-1589, 2837, 16058},
+    {-1520, 2816, 16069},
+    {-1380, 2656, 16108},
+    {-1166, 2351, 16172},
+    {-876, 1904, 16249},
+    {-508, 1326, 16322},
+    {-65, 640, 16371},
+    {449, -122, 16377},
+    {1026, -919, 16326},
+    {1653, -1703, 16211},
+    {2316, -2427, 16037},
+    {2997, -3042, 15818},
+    {3679, -3511, 15575},
+    {4341, -3800, 15335},
+    {4965, -3889, 15122},
+    {5531, -3768, 14955},
+    {6023, -3436, 14844},
+    {6422, -2903, 14791},
+    {6713, -2187, 14785},
+    {6882, -1316, 14810},
+    {6922, -326, 14847},
+    {6826, 737, 14876},
+    {6595, 1824, 14887},
+    {6238, 2884, 14873},
+    {5767, 3866, 14840},
+    {5199, 4728, 14800},
+    {4556, 5432, 14771},
+    {3859, 5954, 14768},
+    {3132, 6277, 14806},
+    {2395, 6394, 14893},
+    {1669, 6311, 15027},
+    {973, 6039, 15199},
+    {322, 5599, 15394},
+    {-269, 5020, 15594},
+    {-788, 4340, 15779},
+    {-1225, 3598, 15937},
+    {-1576, 2839, 16059},
+    {-1837, 2105, 16144},
+    {-2008, 1434, 16197},
+    {-2095, 858, 16227},
+    {-2102, 400, 16244},
+    {-2037, 73, 16257},
+    {-1910, -119, 16272},
+    {-1731, -181, 16291},
+    {-1511, -125, 16314},
+    {-1261, 31, 16335},
+    {-994, 262, 16352},
+    {-722, 543, 16359},
+    {-457, 846, 16356},
+    {-209, 1148, 16342},
+    {13, 1426, 16322},
+    {202, 1664, 16298},
+    {353, 1851, 16275},
+    {465, 1985, 16257},
+    {540, 2066, 16244},
+    {580, 2105, 16238},
+    {592, 2115, 16236},
+    {592, 2115, 16236},
+    {592, 2115, 16236},
+    {592, 2115, 16236},
+    {592, 2115, 16236},
+    {592, 2115, 16236},
+    {592, 2115, 16236},
+    {592, 2115, 16236},
+    {592, 2115, 16236},
+    {592, 2115, 16236},
+};
@@ -0,0 +1,57 @@
+/**
+ * @file test_imu_replay.c
+ * @brief Replay of the IMU log through an attitude estimator, with tilt error and cycles per update
+ */
+
+#include <math.h>
+#include "test_imu_replay.h"
+#include "dsp_common.h"
+#include "esp_log.h"
+#include "sdkconfig.h"
+
+#ifndef CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ
+#define CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ 160
+#endif
+
+static const char *TAG = "imu_replay";
+
+void test_imu_replay(const test_imu_estimator_t *estimator, test_imu_replay_result_t *result)
+{
+    float tilt_err_sum = 0;
+    float tilt_err_max = 0;
+    int tilt_err_count = 0;
+    unsigned int total_cycles = 0;
+
+    for (int n = 0 ; n < TEST_IMU_LOG_LENGTH ; n++) {
+        unsigned int start_b = dsp_get_cpu_cycle_count();
+        estimator->update(estimator->ctx, test_imu_log[n]);
+        total_cycles += dsp_get_cpu_cycle_count() - start_b;
+
+        // Compare gravity vector of estimated attitude with reference after 1 sec of convergence
+        if (((n % TEST_IMU_LOG_TRUTH_DECIM) == 0) && (n >= TEST_IMU_LOG_FS)) {
+            float g_est[3];
+            estimator->gravity(estimator->ctx, g_est);
+            const int16_t *g_ref = test_imu_log_gravity[n / TEST_IMU_LOG_TRUTH_DECIM];
+            float g_ref_norm = sqrtf(g_ref[0] * g_ref[0] + g_ref[1] * g_ref[1] + g_ref[2] * g_ref[2]);
+            if (g_ref_norm == 0) {
+                continue;
+            }
+            float g_est_norm = sqrtf(g_est[0] * g_est[0] + g_est[1] * g_est[1] + g_est[2] * g_est[2]);
+            float cos_err = (g_est[0] * g_ref[0] + g_est[1] * g_ref[1] + g_est[2] * g_ref[2]) / (g_ref_norm * g_est_norm);
+            cos_err = cos_err > 1 ? 1 : cos_err;
+            float tilt_err = acosf(cos_err) * 180 / M_PI;
+            tilt_err_sum += tilt_err * tilt_err;
+            tilt_err_max = tilt_err > tilt_err_max ? tilt_err : tilt_err_max;
+            tilt_err_count++;
+        }
+    }
+    result->tilt_err_rms = sqrtf(tilt_err_sum / tilt_err_count);
+    result->tilt_err_max = tilt_err_max;
+    result->cycles = total_cycles / TEST_IMU_LOG_LENGTH;
+
+    ESP_LOGI(TAG, "%s: tilt error rms %f deg, max %f deg, %i cycles per update, %i.%02i%% of CPU at %i Hz",
+             estimator->name, result->tilt_err_rms, result->tilt_err_max, result->cycles,
+             (int)(100ULL * result->cycles * TEST_IMU_LOG_FS / (CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ * 1000000ULL)),
+             (int)(10000ULL * result->cycles * TEST_IMU_LOG_FS / (CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ * 1000000ULL)) % 100,
+             TEST_IMU_LOG_FS);
+}
@@ -116,6 +116,16 @@ public:
      */
     Mat(const Mat &src);
 
+    /**
+     * @brief Move matrix.
+     *
+     * if src matrix owns its buffer, the buffer is taken over without allocation or copy
+     * otherwise the matrix is copied the same way as the copy constructor does
+     *
+     * @param[in] src: source matrix
+     */
+    Mat(Mat &&src);
+
     /**
      * @brief Create a subset of matrix as ROI (Region of Interest)
      *
@@ -207,6 +217,19 @@ public:
      */
     Mat &operator=(const Mat &src);
 
+    /**
+     * Move operator
+     *
+     * If both matrices own their buffers and have different size, the buffer of src is taken over without allocation or copy.
+     * Otherwise the data is copied as by copy operator, and the destination buffer is not changed.
+     *
+     * @param[in] src: source matrix
+     *
+     * @return
+     *      - matrix with src data
+     */
+    Mat &operator=(Mat &&src);
+
     /**
      * Access to the matrix elements.
      * @param[in] row: row position
@@ -339,6 +362,39 @@ public:
      */
     Mat t();
 
+    /**
+     * Matrix transpose to the preallocated matrix.
+     * Same as t(), but without allocation of the result matrix.
+     *
+     * @param[out] result: matrix [cols]x[rows] to store transposed matrix
+     */
+    void t(Mat &result) const;
+
+    /**
+     * @brief   Multiplication of two matrices to the preallocated matrix
+     *
+     * Same as A*B, but the result is stored to the existing matrix, without temporary matrices.
+     * The result matrix should not be the same as A or B.
+     *
+     * @param[in] A: Input matrix A [M]x[N]
+     * @param[in] B: Input matrix B [N]x[K]
+     * @param[out] result: matrix [M]x[K] to store A*B
+     */
+    static void mult(const Mat &A, const Mat &B, Mat &result);
+
+    /**
+     * @brief   Multiply-accumulate of matrices to the preallocated matrix
+     *
+     * Calculates A*B + C without temporary matrices.
+     * The result matrix should not be the same as A or B, but could be the same as C.
+     *
+     * @param[in] A: Input matrix A [M]x[N]
+     * @param[in] B: Input matrix B [N]x[K]
+     * @param[in] C: Input matrix C [M]x[K]
+     * @param[out] result: matrix [M]x[K] to store A*B + C
+     */
+    static void multAdd(const Mat &A, const Mat &B, const Mat &C, Mat &result);
+
     /**
      * Create identity matrix.
      * Create a square matrix and fill diagonal with 1.
@@ -513,6 +569,19 @@ public:
      *      - determinant value
      */
     float det(int n);
+protected:
+    /**
+     * Check the size of a matrix copied to a matrix with fixed size.
+     * An error is logged when the size does not match.
+     *
+     * @param[in] src: source matrix
+     * @param[in] rows: amount of rows of the fixed matrix
+     * @param[in] cols: amount of columns of the fixed matrix
+     *
+     * @return
+     *      - true if the size of src is [rows]x[cols]
+     */
+    static bool fixedSizeMatches(const Mat &src, int rows, int cols);
 private:
     Mat cofactor(int row, int col, int n);
     Mat adjoint();
@@ -520,6 +589,82 @@ private:
     void allocate(); // Allocate buffer
     Mat expHelper(const Mat &m, int num);
 };
+
+/**
+ * @brief   Matrix with static storage
+ *
+ * The MatFixed class is a Mat with the buffer placed inside the object, so
+ * matrices with size known at compile time could be created on the stack or as
+ * class members without heap allocation. The object could be used everywhere
+ * where Mat is expected. The size of the matrix could not be changed.
+ *
+ * @tparam R: amount of matrix rows
+ * @tparam C: amount of matrix columns
+ */
+template <int R, int C>
+class MatFixed : public Mat {
+public:
+    /**
+     * Constructor fill matrix with 0.
+     */
+    MatFixed() : Mat(storage, R, C, C)
+    {
+        this->sub_matrix = false;
+        this->clear();
+    }
+
+    /**
+     * Constructor copy data from source matrix.
+     * @param[in] src: source matrix [R]x[C]
+     */
+    MatFixed(const Mat &src) : MatFixed()
+    {
+        *this = src;
+    }
+
+    /**
+     * Copy constructor.
+     * @param[in] src: source matrix
+     */
+    MatFixed(const MatFixed &src) : MatFixed()
+    {
+        *this = src;
+    }
+
+    /**
+     * Copy operator. Source matrix must have the same size.
+     *
+     * @param[in] src: source matrix [R]x[C]
+     *
+     * @return
+     *      - matrix copy
+     */
+    MatFixed &operator=(const Mat &src)
+    {
+        if (!fixedSizeMatches(src, R, C)) {
+            return *this;
+        }
+        Mat::operator=(src);
+        return *this;
+    }
+
+    /**
+     * Copy operator.
+     *
+     * @param[in] src: source matrix
+     *
+     * @return
+     *      - matrix copy
+     */
+    MatFixed &operator=(const MatFixed &src)
+    {
+        Mat::operator=(src);
+        return *this;
+    }
+
+private:
+    float storage[R * C];
+};
 /**
  * Print matrix to the standard iostream.
  * @param[in] os: output stream
@@ -31,6 +31,27 @@ using std::endl;
 
 namespace dspm {
 
+// Matrix multiplication, common small shapes use the unrolled versions
+static inline void mat_mult_f32(const float *A, const float *B, float *C, int m, int n, int k)
+{
+    if ((m == n) && (k == 1)) {
+        switch (n) {
+        case 3: dspm_mult_3x3x1_f32(A, B, C); return;
+        case 4: dspm_mult_4x4x1_f32(A, B, C); return;
+        case 6: dspm_mult_6x6x1_f32(A, B, C); return;
+        default: break;
+        }
+    } else if ((m == n) && (k == n)) {
+        switch (n) {
+        case 3: dspm_mult_3x3x3_f32(A, B, C); return;
+        case 4: dspm_mult_4x4x4_f32(A, B, C); return;
+        case 6: dspm_mult_6x6x6_f32(A, B, C); return;
+        default: break;
+        }
+    }
+    dspm_mult_f32(A, B, C, m, n, k);
+}
+
 float Mat::abs_tol = 1e-10;
 
 Mat::Rect::Rect(int x, int y, int width, int height)
@@ -133,6 +154,35 @@ Mat::Mat(const Mat &m)
     }
 }
 
+Mat::Mat(Mat &&m)
+{
+    this->rows = m.rows;
+    this->cols = m.cols;
+    this->padding = m.padding;
+    this->stride = m.stride;
+    this->data = m.data;
+    this->sub_matrix = m.sub_matrix;
+
+    if (m.sub_matrix) {
+        this->length = m.length;
+        this->ext_buff = true;
+    } else if (m.ext_buff) {
+        allocate();
+        memcpy(this->data, m.data, this->length * sizeof(float));
+    } else {
+        // take over the buffer, source matrix became an empty header
+        this->length = m.length;
+        this->ext_buff = false;
+        m.data = nullptr;
+        m.ext_buff = true;
+        m.rows = 0;
+        m.cols = 0;
+        m.stride = 0;
+        m.padding = 0;
+        m.length = 0;
+    }
+}
+
 Mat Mat::getROI(int startRow, int startCol, int roiRows, int roiCols, int stride)
 {
     Mat result(this->data, roiRows, roiCols, 0);
@@ -257,6 +307,34 @@ Mat &Mat::operator=(const Mat &m)
     return *this;
 }
 
+Mat &Mat::operator=(Mat &&m)
+{
+    if (this == &m) {
+        return *this;
+    }
+    // External buffers and sub-matrices keep their memory. Matrices with equal dimensions
+    // keep their buffer too, so pointers to the matrix data stay valid after assignment.
+    if (this->ext_buff || m.ext_buff || ((this->rows == m.rows) && (this->cols == m.cols))) {
+        return (*this = static_cast<const Mat &>(m));
+    }
+    // Take over the buffer instead of allocation and copy
+    delete[] this->data;
+    this->rows = m.rows;
+    this->cols = m.cols;
+    this->stride = m.stride;
+    this->padding = m.padding;
+    this->length = m.length;
+    this->data = m.data;
+    m.data = nullptr;
+    m.ext_buff = true;
+    m.rows = 0;
+    m.cols = 0;
+    m.stride = 0;
+    m.padding = 0;
+    m.length = 0;
+    return *this;
+}
+
 Mat &Mat::operator+=(const Mat &m)
 {
     if ((this->rows != m.rows) || (this->cols != m.cols)) {
@@ -319,7 +397,7 @@ Mat &Mat::operator*=(const Mat &m)
         dspm_mult_ex_f32(temp.data, m.data, this->data, temp.rows, temp.cols, m.cols, temp.padding, m.padding, this->padding);
     } else {
         Mat temp = *this;
-        dspm_mult_f32(temp.data, m.data, this->data, temp.rows, temp.cols, m.cols);
+        mat_mult_f32(temp.data, m.data, this->data, temp.rows, temp.cols, m.cols);
     }
     return (*this);
 }
@@ -389,6 +467,53 @@ Mat Mat::t()
     return ret;
 }
 
+void Mat::t(Mat &result) const
+{
+    if ((result.rows != this->cols) || (result.cols != this->rows)) {
+        ESP_LOGW("Mat", "t Error: result matrix dimensions %dx%d do not match %dx%d", result.rows, result.cols, this->cols, this->rows);
+        return;
+    }
+    for (int i = 0; i < this->rows; ++i) {
+        for (int j = 0; j < this->cols; ++j) {
+            result(j, i) = this->data[i * this->stride + j];
+        }
+    }
+}
+
+void Mat::mult(const Mat &A, const Mat &B, Mat &result)
+{
+    if ((A.cols != B.rows) || (result.rows != A.rows) || (result.cols != B.cols)) {
+        ESP_LOGW("Mat", "mult Error: matrices do not have correct dimensions");
+        return;
+    }
+
+    if (A.padding || B.padding || result.padding) {
+        dspm_mult_ex_f32(A.data, B.data, result.data, A.rows, A.cols, B.cols, A.padding, B.padding, result.padding);
+    } else {
+        mat_mult_f32(A.data, B.data, result.data, A.rows, A.cols, B.cols);
+    }
+}
+
+void Mat::multAdd(const Mat &A, const Mat &B, const Mat &C, Mat &result)
+{
+    if ((A.cols != B.rows) || (C.rows != A.rows) || (C.cols != B.cols) || (result.rows != A.rows) || (result.cols != B.cols)) {
+        ESP_LOGW("Mat", "multAdd Error: matrices do not have correct dimensions");
+        return;
+    }
+
+    // C element is read before the result element is written, so result could be the same matrix as C
+    for (int i = 0; i < A.rows; ++i) {
+        const float *a_row = &A.data[i * A.stride];
+        for (int k = 0; k < B.cols; ++k) {
+            float acc = C(i, k);
+            for (int j = 0; j < A.cols; ++j) {
+                acc += a_row[j] * B.data[j * B.stride + k];
+            }
+            result(i, k) = acc;
+        }
+    }
+}
+
 Mat Mat::eye(int size)
 {
     Mat temp(size, size);
@@ -818,6 +943,15 @@ Mat Mat::inverse()
     return result;
 }
 
+bool Mat::fixedSizeMatches(const Mat &src, int rows, int cols)
+{
+    if ((src.rows != rows) || (src.cols != cols)) {
+        ESP_LOGE("Mat", "operator = Error for fixed matrices: operands matrices dimensions %dx%d and %dx%d do not match", rows, cols, src.rows, src.cols);
+        return false;
+    }
+    return true;
+}
+
 void Mat::allocate()
 {
     this->ext_buff = false;
@@ -929,7 +1063,7 @@ Mat operator*(const Mat &m1, const Mat &m2)
     if (m1.sub_matrix || m2.sub_matrix) {
         dspm_mult_ex_f32(m1.data, m2.data, temp.data, m1.rows, m1.cols, m2.cols, m1.padding, m2.padding, temp.padding);
     } else {
-        dspm_mult_f32(m1.data, m2.data, temp.data, m1.rows, m1.cols, m2.cols);
+        mat_mult_f32(m1.data, m2.data, temp.data, m1.rows, m1.cols, m2.cols);
     }
 
     return temp;
@@ -0,0 +1,51 @@
+/**
+ * @file dspm_mult_3x3x3_s16_ansi.c
+ * @brief Unrolled 3x3 by 3x3 Q15 matrix multiply
+ */
+
+#include "dspm_mult.h"
+
+// C(3,3) = A(3,3)*B(3,3), fully unrolled. Rounding and shift are the same as in dspm_mult_s16_ansi
+esp_err_t dspm_mult_3x3x3_s16_ansi(const int16_t *A, const int16_t *B, int16_t *C, int shift)
+{
+    int final_shift = shift - 15;
+    long long rounding = 0x7fff >> shift;
+    long long acc;
+
+    {
+        int32_t a0 = A[0];
+        int32_t a1 = A[1];
+        int32_t a2 = A[2];
+        acc = rounding + a0 * B[0] + a1 * B[3] + a2 * B[6];
+        C[0] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[1] + a1 * B[4] + a2 * B[7];
+        C[1] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[2] + a1 * B[5] + a2 * B[8];
+        C[2] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+    }
+
+    {
+        int32_t a0 = A[3];
+        int32_t a1 = A[4];
+        int32_t a2 = A[5];
+        acc = rounding + a0 * B[0] + a1 * B[3] + a2 * B[6];
+        C[3] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[1] + a1 * B[4] + a2 * B[7];
+        C[4] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[2] + a1 * B[5] + a2 * B[8];
+        C[5] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+    }
+
+    {
+        int32_t a0 = A[6];
+        int32_t a1 = A[7];
+        int32_t a2 = A[8];
+        acc = rounding + a0 * B[0] + a1 * B[3] + a2 * B[6];
+        C[6] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[1] + a1 * B[4] + a2 * B[7];
+        C[7] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[2] + a1 * B[5] + a2 * B[8];
+        C[8] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,75 @@
+/**
+ * @file dspm_mult_4x4x4_s16_ansi.c
+ * @brief Unrolled 4x4 by 4x4 Q15 matrix multiply
+ */
+
+#include "dspm_mult.h"
+
+// C(4,4) = A(4,4)*B(4,4), fully unrolled. Rounding and shift are the same as in dspm_mult_s16_ansi
+esp_err_t dspm_mult_4x4x4_s16_ansi(const int16_t *A, const int16_t *B, int16_t *C, int shift)
+{
+    int final_shift = shift - 15;
+    long long rounding = 0x7fff >> shift;
+    long long acc;
+
+    {
+        int32_t a0 = A[0];
+        int32_t a1 = A[1];
+        int32_t a2 = A[2];
+        int32_t a3 = A[3];
+        acc = rounding + a0 * B[0] + a1 * B[4] + a2 * B[8] + a3 * B[12];
+        C[0] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[1] + a1 * B[5] + a2 * B[9] + a3 * B[13];
+        C[1] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[2] + a1 * B[6] + a2 * B[10] + a3 * B[14];
+        C[2] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[3] + a1 * B[7] + a2 * B[11] + a3 * B[15];
+        C[3] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+    }
+
+    {
+        int32_t a0 = A[4];
+        int32_t a1 = A[5];
+        int32_t a2 = A[6];
+        int32_t a3 = A[7];
+        acc = rounding + a0 * B[0] + a1 * B[4] + a2 * B[8] + a3 * B[12];
+        C[4] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[1] + a1 * B[5] + a2 * B[9] + a3 * B[13];
+        C[5] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[2] + a1 * B[6] + a2 * B[10] + a3 * B[14];
+        C[6] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[3] + a1 * B[7] + a2 * B[11] + a3 * B[15];
+        C[7] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+    }
+
+    {
+        int32_t a0 = A[8];
+        int32_t a1 = A[9];
+        int32_t a2 = A[10];
+        int32_t a3 = A[11];
+        acc = rounding + a0 * B[0] + a1 * B[4] + a2 * B[8] + a3 * B[12];
+        C[8] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[1] + a1 * B[5] + a2 * B[9] + a3 * B[13];
+        C[9] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[2] + a1 * B[6] + a2 * B[10] + a3 * B[14];
+        C[10] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[3] + a1 * B[7] + a2 * B[11] + a3 * B[15];
+        C[11] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+    }
+
+    {
+        int32_t a0 = A[12];
+        int32_t a1 = A[13];
+        int32_t a2 = A[14];
+        int32_t a3 = A[15];
+        acc = rounding + a0 * B[0] + a1 * B[4] + a2 * B[8] + a3 * B[12];
+        C[12] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[1] + a1 * B[5] + a2 * B[9] + a3 * B[13];
+        C[13] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[2] + a1 * B[6] + a2 * B[10] + a3 * B[14];
+        C[14] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[3] + a1 * B[7] + a2 * B[11] + a3 * B[15];
+        C[15] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,141 @@
+/**
+ * @file dspm_mult_6x6x6_s16_ansi.c
+ * @brief Unrolled 6x6 by 6x6 Q15 matrix multiply
+ */
+
+#include "dspm_mult.h"
+
+// C(6,6) = A(6,6)*B(6,6), fully unrolled. Rounding and shift are the same as in dspm_mult_s16_ansi
+esp_err_t dspm_mult_6x6x6_s16_ansi(const int16_t *A, const int16_t *B, int16_t *C, int shift)
+{
+    int final_shift = shift - 15;
+    long long rounding = 0x7fff >> shift;
+    long long acc;
+
+    {
+        int32_t a0 = A[0];
+        int32_t a1 = A[1];
+        int32_t a2 = A[2];
+        int32_t a3 = A[3];
+        int32_t a4 = A[4];
+        int32_t a5 = A[5];
+        acc = rounding + a0 * B[0] + a1 * B[6] + a2 * B[12] + a3 * B[18] + a4 * B[24] + a5 * B[30];
+        C[0] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[1] + a1 * B[7] + a2 * B[13] + a3 * B[19] + a4 * B[25] + a5 * B[31];
+        C[1] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[2] + a1 * B[8] + a2 * B[14] + a3 * B[20] + a4 * B[26] + a5 * B[32];
+        C[2] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[3] + a1 * B[9] + a2 * B[15] + a3 * B[21] + a4 * B[27] + a5 * B[33];
+        C[3] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[4] + a1 * B[10] + a2 * B[16] + a3 * B[22] + a4 * B[28] + a5 * B[34];
+        C[4] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[5] + a1 * B[11] + a2 * B[17] + a3 * B[23] + a4 * B[29] + a5 * B[35];
+        C[5] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+    }
+
+    {
+        int32_t a0 = A[6];
+        int32_t a1 = A[7];
+        int32_t a2 = A[8];
+        int32_t a3 = A[9];
+        int32_t a4 = A[10];
+        int32_t a5 = A[11];
+        acc = rounding + a0 * B[0] + a1 * B[6] + a2 * B[12] + a3 * B[18] + a4 * B[24] + a5 * B[30];
+        C[6] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[1] + a1 * B[7] + a2 * B[13] + a3 * B[19] + a4 * B[25] + a5 * B[31];
+        C[7] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[2] + a1 * B[8] + a2 * B[14] + a3 * B[20] + a4 * B[26] + a5 * B[32];
+        C[8] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[3] + a1 * B[9] + a2 * B[15] + a3 * B[21] + a4 * B[27] + a5 * B[33];
+        C[9] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[4] + a1 * B[10] + a2 * B[16] + a3 * B[22] + a4 * B[28] + a5 * B[34];
+        C[10] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[5] + a1 * B[11] + a2 * B[17] + a3 * B[23] + a4 * B[29] + a5 * B[35];
+        C[11] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+    }
+
+    {
+        int32_t a0 = A[12];
+        int32_t a1 = A[13];
+        int32_t a2 = A[14];
+        int32_t a3 = A[15];
+        int32_t a4 = A[16];
+        int32_t a5 = A[17];
+        acc = rounding + a0 * B[0] + a1 * B[6] + a2 * B[12] + a3 * B[18] + a4 * B[24] + a5 * B[30];
+        C[12] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[1] + a1 * B[7] + a2 * B[13] + a3 * B[19] + a4 * B[25] + a5 * B[31];
+        C[13] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[2] + a1 * B[8] + a2 * B[14] + a3 * B[20] + a4 * B[26] + a5 * B[32];
+        C[14] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[3] + a1 * B[9] + a2 * B[15] + a3 * B[21] + a4 * B[27] + a5 * B[33];
+        C[15] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[4] + a1 * B[10] + a2 * B[16] + a3 * B[22] + a4 * B[28] + a5 * B[34];
+        C[16] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[5] + a1 * B[11] + a2 * B[17] + a3 * B[23] + a4 * B[29] + a5 * B[35];
+        C[17] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+    }
+
+    {
+        int32_t a0 = A[18];
+        int32_t a1 = A[19];
+        int32_t a2 = A[20];
+        int32_t a3 = A[21];
+        int32_t a4 = A[22];
+        int32_t a5 = A[23];
+        acc = rounding + a0 * B[0] + a1 * B[6] + a2 * B[12] + a3 * B[18] + a4 * B[24] + a5 * B[30];
+        C[18] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[1] + a1 * B[7] + a2 * B[13] + a3 * B[19] + a4 * B[25] + a5 * B[31];
+        C[19] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[2] + a1 * B[8] + a2 * B[14] + a3 * B[20] + a4 * B[26] + a5 * B[32];
+        C[20] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[3] + a1 * B[9] + a2 * B[15] + a3 * B[21] + a4 * B[27] + a5 * B[33];
+        C[21] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[4] + a1 * B[10] + a2 * B[16] + a3 * B[22] + a4 * B[28] + a5 * B[34];
+        C[22] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[5] + a1 * B[11] + a2 * B[17] + a3 * B[23] + a4 * B[29] + a5 * B[35];
+        C[23] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+    }
+
+    {
+        int32_t a0 = A[24];
+        int32_t a1 = A[25];
+        int32_t a2 = A[26];
+        int32_t a3 = A[27];
+        int32_t a4 = A[28];
+        int32_t a5 = A[29];
+        acc = rounding + a0 * B[0] + a1 * B[6] + a2 * B[12] + a3 * B[18] + a4 * B[24] + a5 * B[30];
+        C[24] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[1] + a1 * B[7] + a2 * B[13] + a3 * B[19] + a4 * B[25] + a5 * B[31];
+        C[25] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[2] + a1 * B[8] + a2 * B[14] + a3 * B[20] + a4 * B[26] + a5 * B[32];
+        C[26] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[3] + a1 * B[9] + a2 * B[15] + a3 * B[21] + a4 * B[27] + a5 * B[33];
+        C[27] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[4] + a1 * B[10] + a2 * B[16] + a3 * B[22] + a4 * B[28] + a5 * B[34];
+        C[28] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[5] + a1 * B[11] + a2 * B[17] + a3 * B[23] + a4 * B[29] + a5 * B[35];
+        C[29] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+    }
+
+    {
+        int32_t a0 = A[30];
+        int32_t a1 = A[31];
+        int32_t a2 = A[32];
+        int32_t a3 = A[33];
+        int32_t a4 = A[34];
+        int32_t a5 = A[35];
+        acc = rounding + a0 * B[0] + a1 * B[6] + a2 * B[12] + a3 * B[18] + a4 * B[24] + a5 * B[30];
+        C[30] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[1] + a1 * B[7] + a2 * B[13] + a3 * B[19] + a4 * B[25] + a5 * B[31];
+        C[31] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[2] + a1 * B[8] + a2 * B[14] + a3 * B[20] + a4 * B[26] + a5 * B[32];
+        C[32] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[3] + a1 * B[9] + a2 * B[15] + a3 * B[21] + a4 * B[27] + a5 * B[33];
+        C[33] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[4] + a1 * B[10] + a2 * B[16] + a3 * B[22] + a4 * B[28] + a5 * B[34];
+        C[34] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+        acc = rounding + a0 * B[5] + a1 * B[11] + a2 * B[17] + a3 * B[23] + a4 * B[29] + a5 * B[35];
+        C[35] = final_shift > 0 ? (acc << final_shift) : (acc >> (-final_shift));
+    }
+    return ESP_OK;
+}
@@ -20,6 +20,15 @@
 // c(i,j) = sum(a(i,s)*b(s,j)) , s=1..n
 esp_err_t dspm_mult_s16_ansi(const int16_t *A, const int16_t *B, int16_t *C, int m, int n, int k, int shift)
 {
+    // Common small shapes use the unrolled versions
+    if ((m == n) && (k == n)) {
+        switch (n) {
+        case 3: return dspm_mult_3x3x3_s16_ansi(A, B, C, shift);
+        case 4: return dspm_mult_4x4x4_s16_ansi(A, B, C, shift);
+        case 6: return dspm_mult_6x6x6_s16_ansi(A, B, C, shift);
+        default: break;
+        }
+    }
     int final_shift = shift - 15;
     for (int i = 0 ; i < m ; i++) {
         for (int j = 0 ; j < k ; j++) {
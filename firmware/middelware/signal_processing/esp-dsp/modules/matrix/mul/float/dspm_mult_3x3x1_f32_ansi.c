@@ -0,0 +1,32 @@
+/**
+ * @file dspm_mult_3x3x1_f32_ansi.c
+ * @brief Unrolled 3x3 float matrix by vector multiply
+ */
+
+#include "dspm_mult.h"
+
+// C(3,1) = A(3,3)*B(3,1), fully unrolled
+esp_err_t dspm_mult_3x3x1_f32_ansi(const float *A, const float *B, float *C)
+{
+    {
+        float a0 = A[0];
+        float a1 = A[1];
+        float a2 = A[2];
+        C[0] = a0 * B[0] + a1 * B[1] + a2 * B[2];
+    }
+
+    {
+        float a0 = A[3];
+        float a1 = A[4];
+        float a2 = A[5];
+        C[1] = a0 * B[0] + a1 * B[1] + a2 * B[2];
+    }
+
+    {
+        float a0 = A[6];
+        float a1 = A[7];
+        float a2 = A[8];
+        C[2] = a0 * B[0] + a1 * B[1] + a2 * B[2];
+    }
+    return ESP_OK;
+}
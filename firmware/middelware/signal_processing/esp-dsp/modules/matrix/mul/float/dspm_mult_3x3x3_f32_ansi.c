@@ -0,0 +1,38 @@
+/**
+ * @file dspm_mult_3x3x3_f32_ansi.c
+ * @brief Unrolled 3x3 by 3x3 float matrix multiply
+ */
+
+#include "dspm_mult.h"
+
+// C(3,3) = A(3,3)*B(3,3), fully unrolled
+esp_err_t dspm_mult_3x3x3_f32_ansi(const float *A, const float *B, float *C)
+{
+    {
+        float a0 = A[0];
+        float a1 = A[1];
+        float a2 = A[2];
+        C[0] = a0 * B[0] + a1 * B[3] + a2 * B[6];
+        C[1] = a0 * B[1] + a1 * B[4] + a2 * B[7];
+        C[2] = a0 * B[2] + a1 * B[5] + a2 * B[8];
+    }
+
+    {
+        float a0 = A[3];
+        float a1 = A[4];
+        float a2 = A[5];
+        C[3] = a0 * B[0] + a1 * B[3] + a2 * B[6];
+        C[4] = a0 * B[1] + a1 * B[4] + a2 * B[7];
+        C[5] = a0 * B[2] + a1 * B[5] + a2 * B[8];
+    }
+
+    {
+        float a0 = A[6];
+        float a1 = A[7];
+        float a2 = A[8];
+        C[6] = a0 * B[0] + a1 * B[3] + a2 * B[6];
+        C[7] = a0 * B[1] + a1 * B[4] + a2 * B[7];
+        C[8] = a0 * B[2] + a1 * B[5] + a2 * B[8];
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,43 @@
+/**
+ * @file dspm_mult_4x4x1_f32_ansi.c
+ * @brief Unrolled 4x4 float matrix by vector multiply
+ */
+
+#include "dspm_mult.h"
+
+// C(4,1) = A(4,4)*B(4,1), fully unrolled
+esp_err_t dspm_mult_4x4x1_f32_ansi(const float *A, const float *B, float *C)
+{
+    {
+        float a0 = A[0];
+        float a1 = A[1];
+        float a2 = A[2];
+        float a3 = A[3];
+        C[0] = a0 * B[0] + a1 * B[1] + a2 * B[2] + a3 * B[3];
+    }
+
+    {
+        float a0 = A[4];
+        float a1 = A[5];
+        float a2 = A[6];
+        float a3 = A[7];
+        C[1] = a0 * B[0] + a1 * B[1] + a2 * B[2] + a3 * B[3];
+    }
+
+    {
+        float a0 = A[8];
+        float a1 = A[9];
+        float a2 = A[10];
+        float a3 = A[11];
+        C[2] = a0 * B[0] + a1 * B[1] + a2 * B[2] + a3 * B[3];
+    }
+
+    {
+        float a0 = A[12];
+        float a1 = A[13];
+        float a2 = A[14];
+        float a3 = A[15];
+        C[3] = a0 * B[0] + a1 * B[1] + a2 * B[2] + a3 * B[3];
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,55 @@
+/**
+ * @file dspm_mult_4x4x4_f32_ansi.c
+ * @brief Unrolled 4x4 by 4x4 float matrix multiply
+ */
+
+#include "dspm_mult.h"
+
+// C(4,4) = A(4,4)*B(4,4), fully unrolled
+esp_err_t dspm_mult_4x4x4_f32_ansi(const float *A, const float *B, float *C)
+{
+    {
+        float a0 = A[0];
+        float a1 = A[1];
+        float a2 = A[2];
+        float a3 = A[3];
+        C[0] = a0 * B[0] + a1 * B[4] + a2 * B[8] + a3 * B[12];
+        C[1] = a0 * B[1] + a1 * B[5] + a2 * B[9] + a3 * B[13];
+        C[2] = a0 * B[2] + a1 * B[6] + a2 * B[10] + a3 * B[14];
+        C[3] = a0 * B[3] + a1 * B[7] + a2 * B[11] + a3 * B[15];
+    }
+
+    {
+        float a0 = A[4];
+        float a1 = A[5];
+        float a2 = A[6];
+        float a3 = A[7];
+        C[4] = a0 * B[0] + a1 * B[4] + a2 * B[8] + a3 * B[12];
+        C[5] = a0 * B[1] + a1 * B[5] + a2 * B[9] + a3 * B[13];
+        C[6] = a0 * B[2] + a1 * B[6] + a2 * B[10] + a3 * B[14];
+        C[7] = a0 * B[3] + a1 * B[7] + a2 * B[11] + a3 * B[15];
+    }
+
+    {
+        float a0 = A[8];
+        float a1 = A[9];
+        float a2 = A[10];
+        float a3 = A[11];
+        C[8] = a0 * B[0] + a1 * B[4] + a2 * B[8] + a3 * B[12];
+        C[9] = a0 * B[1] + a1 * B[5] + a2 * B[9] + a3 * B[13];
+        C[10] = a0 * B[2] + a1 * B[6] + a2 * B[10] + a3 * B[14];
+        C[11] = a0 * B[3] + a1 * B[7] + a2 * B[11] + a3 * B[15];
+    }
+
+    {
+        float a0 = A[12];
+        float a1 = A[13];
+        float a2 = A[14];
+        float a3 = A[15];
+        C[12] = a0 * B[0] + a1 * B[4] + a2 * B[8] + a3 * B[12];
+        C[13] = a0 * B[1] + a1 * B[5] + a2 * B[9] + a3 * B[13];
+        C[14] = a0 * B[2] + a1 * B[6] + a2 * B[10] + a3 * B[14];
+        C[15] = a0 * B[3] + a1 * B[7] + a2 * B[11] + a3 * B[15];
+    }
+    return ESP_OK;
+}
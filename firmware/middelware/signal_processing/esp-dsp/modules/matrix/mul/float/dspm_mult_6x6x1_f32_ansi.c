@@ -0,0 +1,71 @@
+/**
+ * @file dspm_mult_6x6x1_f32_ansi.c
+ * @brief Unrolled 6x6 float matrix by vector multiply
+ */
+
+#include "dspm_mult.h"
+
+// C(6,1) = A(6,6)*B(6,1), fully unrolled
+esp_err_t dspm_mult_6x6x1_f32_ansi(const float *A, const float *B, float *C)
+{
+    {
+        float a0 = A[0];
+        float a1 = A[1];
+        float a2 = A[2];
+        float a3 = A[3];
+        float a4 = A[4];
+        float a5 = A[5];
+        C[0] = a0 * B[0] + a1 * B[1] + a2 * B[2] + a3 * B[3] + a4 * B[4] + a5 * B[5];
+    }
+
+    {
+        float a0 = A[6];
+        float a1 = A[7];
+        float a2 = A[8];
+        float a3 = A[9];
+        float a4 = A[10];
+        float a5 = A[11];
+        C[1] = a0 * B[0] + a1 * B[1] + a2 * B[2] + a3 * B[3] + a4 * B[4] + a5 * B[5];
+    }
+
+    {
+        float a0 = A[12];
+        float a1 = A[13];
+        float a2 = A[14];
+        float a3 = A[15];
+        float a4 = A[16];
+        float a5 = A[17];
+        C[2] = a0 * B[0] + a1 * B[1] + a2 * B[2] + a3 * B[3] + a4 * B[4] + a5 * B[5];
+    }
+
+    {
+        float a0 = A[18];
+        float a1 = A[19];
+        float a2 = A[20];
+        float a3 = A[21];
+        float a4 = A[22];
+        float a5 = A[23];
+        C[3] = a0 * B[0] + a1 * B[1] + a2 * B[2] + a3 * B[3] + a4 * B[4] + a5 * B[5];
+    }
+
+    {
+        float a0 = A[24];
+        float a1 = A[25];
+        float a2 = A[26];
+        float a3 = A[27];
+        float a4 = A[28];
+        float a5 = A[29];
+        C[4] = a0 * B[0] + a1 * B[1] + a2 * B[2] + a3 * B[3] + a4 * B[4] + a5 * B[5];
+    }
+
+    {
+        float a0 = A[30];
+        float a1 = A[31];
+        float a2 = A[32];
+        float a3 = A[33];
+        float a4 = A[34];
+        float a5 = A[35];
+        C[5] = a0 * B[0] + a1 * B[1] + a2 * B[2] + a3 * B[3] + a4 * B[4] + a5 * B[5];
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,101 @@
+/**
+ * @file dspm_mult_6x6x6_f32_ansi.c
+ * @brief Unrolled 6x6 by 6x6 float matrix multiply
+ */
+
+#include "dspm_mult.h"
+
+// C(6,6) = A(6,6)*B(6,6), fully unrolled
+esp_err_t dspm_mult_6x6x6_f32_ansi(const float *A, const float *B, float *C)
+{
+    {
+        float a0 = A[0];
+        float a1 = A[1];
+        float a2 = A[2];
+        float a3 = A[3];
+        float a4 = A[4];
+        float a5 = A[5];
+        C[0] = a0 * B[0] + a1 * B[6] + a2 * B[12] + a3 * B[18] + a4 * B[24] + a5 * B[30];
+        C[1] = a0 * B[1] + a1 * B[7] + a2 * B[13] + a3 * B[19] + a4 * B[25] + a5 * B[31];
+        C[2] = a0 * B[2] + a1 * B[8] + a2 * B[14] + a3 * B[20] + a4 * B[26] + a5 * B[32];
+        C[3] = a0 * B[3] + a1 * B[9] + a2 * B[15] + a3 * B[21] + a4 * B[27] + a5 * B[33];
+        C[4] = a0 * B[4] + a1 * B[10] + a2 * B[16] + a3 * B[22] + a4 * B[28] + a5 * B[34];
+        C[5] = a0 * B[5] + a1 * B[11] + a2 * B[17] + a3 * B[23] + a4 * B[29] + a5 * B[35];
+    }
+
+    {
+        float a0 = A[6];
+        float a1 = A[7];
+        float a2 = A[8];
+        float a3 = A[9];
+        float a4 = A[10];
+        float a5 = A[11];
+        C[6] = a0 * B[0] + a1 * B[6] + a2 * B[12] + a3 * B[18] + a4 * B[24] + a5 * B[30];
+        C[7] = a0 * B[1] + a1 * B[7] + a2 * B[13] + a3 * B[19] + a4 * B[25] + a5 * B[31];
+        C[8] = a0 * B[2] + a1 * B[8] + a2 * B[14] + a3 * B[20] + a4 * B[26] + a5 * B[32];
+        C[9] = a0 * B[3] + a1 * B[9] + a2 * B[15] + a3 * B[21] + a4 * B[27] + a5 * B[33];
+        C[10] = a0 * B[4] + a1 * B[10] + a2 * B[16] + a3 * B[22] + a4 * B[28] + a5 * B[34];
+        C[11] = a0 * B[5] + a1 * B[11] + a2 * B[17] + a3 * B[23] + a4 * B[29] + a5 * B[35];
+    }
+
+    {
+        float a0 = A[12];
+        float a1 = A[13];
+        float a2 = A[14];
+        float a3 = A[15];
+        float a4 = A[16];
+        float a5 = A[17];
+        C[12] = a0 * B[0] + a1 * B[6] + a2 * B[12] + a3 * B[18] + a4 * B[24] + a5 * B[30];
+        C[13] = a0 * B[1] + a1 * B[7] + a2 * B[13] + a3 * B[19] + a4 * B[25] + a5 * B[31];
+        C[14] = a0 * B[2] + a1 * B[8] + a2 * B[14] + a3 * B[20] + a4 * B[26] + a5 * B[32];
+        C[15] = a0 * B[3] + a1 * B[9] + a2 * B[15] + a3 * B[21] + a4 * B[27] + a5 * B[33];
+        C[16] = a0 * B[4] + a1 * B[10] + a2 * B[16] + a3 * B[22] + a4 * B[28] + a5 * B[34];
+        C[17] = a0 * B[5] + a1 * B[11] + a2 * B[17] + a3 * B[23] + a4 * B[29] + a5 * B[35];
+    }
+
+    {
+        float a0 = A[18];
+        float a1 = A[19];
+        float a2 = A[20];
+        float a3 = A[21];
+        float a4 = A[22];
+        float a5 = A[23];
+        C[18] = a0 * B[0] + a1 * B[6] + a2 * B[12] + a3 * B[18] + a4 * B[24] + a5 * B[30];
+        C[19] = a0 * B[1] + a1 * B[7] + a2 * B[13] + a3 * B[19] + a4 * B[25] + a5 * B[31];
+        C[20] = a0 * B[2] + a1 * B[8] + a2 * B[14] + a3 * B[20] + a4 * B[26] + a5 * B[32];
+        C[21] = a0 * B[3] + a1 * B[9] + a2 * B[15] + a3 * B[21] + a4 * B[27] + a5 * B[33];
+        C[22] = a0 * B[4] + a1 * B[10] + a2 * B[16] + a3 * B[22] + a4 * B[28] + a5 * B[34];
+        C[23] = a0 * B[5] + a1 * B[11] + a2 * B[17] + a3 * B[23] + a4 * B[29] + a5 * B[35];
+    }
+
+    {
+        float a0 = A[24];
+        float a1 = A[25];
+        float a2 = A[26];
+        float a3 = A[27];
+        float a4 = A[28];
+        float a5 = A[29];
+        C[24] = a0 * B[0] + a1 * B[6] + a2 * B[12] + a3 * B[18] + a4 * B[24] + a5 * B[30];
+        C[25] = a0 * B[1] + a1 * B[7] + a2 * B[13] + a3 * B[19] + a4 * B[25] + a5 * B[31];
+        C[26] = a0 * B[2] + a1 * B[8] + a2 * B[14] + a3 * B[20] + a4 * B[26] + a5 * B[32];
+        C[27] = a0 * B[3] + a1 * B[9] + a2 * B[15] + a3 * B[21] + a4 * B[27] + a5 * B[33];
+        C[28] = a0 * B[4] + a1 * B[10] + a2 * B[16] + a3 * B[22] + a4 * B[28] + a5 * B[34];
+        C[29] = a0 * B[5] + a1 * B[11] + a2 * B[17] + a3 * B[23] + a4 * B[29] + a5 * B[35];
+    }
+
+    {
+        float a0 = A[30];
+        float a1 = A[31];
+        float a2 = A[32];
+        float a3 = A[33];
+        float a4 = A[34];
+        float a5 = A[35];
+        C[30] = a0 * B[0] + a1 * B[6] + a2 * B[12] + a3 * B[18] + a4 * B[24] + a5 * B[30];
+        C[31] = a0 * B[1] + a1 * B[7] + a2 * B[13] + a3 * B[19] + a4 * B[25] + a5 * B[31];
+        C[32] = a0 * B[2] + a1 * B[8] + a2 * B[14] + a3 * B[20] + a4 * B[26] + a5 * B[32];
+        C[33] = a0 * B[3] + a1 * B[9] + a2 * B[15] + a3 * B[21] + a4 * B[27] + a5 * B[33];
+        C[34] = a0 * B[4] + a1 * B[10] + a2 * B[16] + a3 * B[22] + a4 * B[28] + a5 * B[34];
+        C[35] = a0 * B[5] + a1 * B[11] + a2 * B[17] + a3 * B[23] + a4 * B[29] + a5 * B[35];
+    }
+    return ESP_OK;
+}
@@ -21,6 +21,22 @@
 // c(i,j) = sum(a(i,s)*b(s,j)) , s=1..n
 esp_err_t dspm_mult_f32_ansi(const float *A, const float *B, float *C, int m, int n, int k)
 {
+    // Common small shapes use the unrolled versions
+    if ((m == n) && (k == 1)) {
+        switch (n) {
+        case 3: return dspm_mult_3x3x1_f32_ansi(A, B, C);
+        case 4: return dspm_mult_4x4x1_f32_ansi(A, B, C);
+        case 6: return dspm_mult_6x6x1_f32_ansi(A, B, C);
+        default: break;
+        }
+    } else if ((m == n) && (k == n)) {
+        switch (n) {
+        case 3: return dspm_mult_3x3x3_f32_ansi(A, B, C);
+        case 4: return dspm_mult_4x4x4_f32_ansi(A, B, C);
+        case 6: return dspm_mult_6x6x6_f32_ansi(A, B, C);
+        default: break;
+        }
+    }
     for (int i = 0 ; i < m ; i++) {
         for (int j = 0 ; j < k ; j++) {
             C[i * k + j] = A[i * n] * B[j];
@@ -47,11 +47,13 @@ esp_err_t dspm_mult_f32_aes3(const float *A, const float *B, float *C, int m, in
 /**@}*/
 
 
+/**@{*/
 /**
  * @brief   Matrix multiplication A[3x3]xB[3x1]
  *
  * Matrix multiplication for two floating point matrices 3x3 and 3x1: C[1][3] = A[3][3] * B[3][1]
- * The implementation is optimized for ESP32 chip.
+ * The extension (_ansi) is fully unrolled ANSI C and could be compiled and run on any platform.
+ * The extension (_ae32) is optimized for ESP32 chip.
  *
  * @param[in] A  input matrix A[3][3]
  * @param[in] B  input matrix/vector B[3][1]
@@ -60,13 +62,17 @@ esp_err_t dspm_mult_f32_aes3(const float *A, const float *B, float *C, int m, in
  *      - ESP_OK on success
  *      - One of the error codes from DSP library
  */
+esp_err_t dspm_mult_3x3x1_f32_ansi(const float *A, const float *B, float *C);
 esp_err_t dspm_mult_3x3x1_f32_ae32(const float *A, const float *B, float *C);
+/**@}*/
 
+/**@{*/
 /**
  * @brief   Matrix multiplication A[3x3]xB[3x3]
  *
  * Matrix multiplication for two square 3x3 floating point matrices: C[3][3] = A[3][3] * B[3][3]
- * The implementation is optimized for ESP32 chip.
+ * The extension (_ansi) is fully unrolled ANSI C and could be compiled and run on any platform.
+ * The extension (_ae32) is optimized for ESP32 chip.
  *
  * @param[in] A  input matrix A[3][3]
  * @param[in] B  input matrix B[3][3]
@@ -75,13 +81,17 @@ esp_err_t dspm_mult_3x3x1_f32_ae32(const float *A, const float *B, float *C);
  *      - ESP_OK on success
  *      - One of the error codes from DSP library
  */
+esp_err_t dspm_mult_3x3x3_f32_ansi(const float *A, const float *B, float *C);
 esp_err_t dspm_mult_3x3x3_f32_ae32(const float *A, const float *B, float *C);
+/**@}*/
 
+/**@{*/
 /**
  * @brief   Matrix multiplication A[4x4]xB[4x1]
  *
  * Matrix multiplication for two floating point matrices 4x4 and 4x1: C[1][4] = A[4][4] * B[4][1]
- * The implementation is optimized for ESP32 chip.
+ * The extension (_ansi) is fully unrolled ANSI C and could be compiled and run on any platform.
+ * The extension (_ae32) is optimized for ESP32 chip.
  *
  * @param[in] A  input matrix A[4][4]
  * @param[in] B  input matrix/vector B[4][1]
@@ -90,14 +100,17 @@ esp_err_t dspm_mult_3x3x3_f32_ae32(const float *A, const float *B, float *C);
  *      - ESP_OK on success
  *      - One of the error codes from DSP library
  */
-
+esp_err_t dspm_mult_4x4x1_f32_ansi(const float *A, const float *B, float *C);
 esp_err_t dspm_mult_4x4x1_f32_ae32(const float *A, const float *B, float *C);
+/**@}*/
 
+/**@{*/
 /**
  * @brief   Matrix multiplication A[4x4]xB[4x4]
  *
  * Matrix multiplication for two square 3x3 floating point matrices: C[4][4] = A[4][4] * B[4][4]
- * The implementation is optimized for ESP32 chip.
+ * The extension (_ansi) is fully unrolled ANSI C and could be compiled and run on any platform.
+ * The extension (_ae32) is optimized for ESP32 chip.
  *
  * @param[in] A  input matrix A[4][4]
  * @param[in] B  input matrix B[4][4]
@@ -106,7 +119,43 @@ esp_err_t dspm_mult_4x4x1_f32_ae32(const float *A, const float *B, float *C);
  *      - ESP_OK on success
  *      - One of the error codes from DSP library
  */
+esp_err_t dspm_mult_4x4x4_f32_ansi(const float *A, const float *B, float *C);
 esp_err_t dspm_mult_4x4x4_f32_ae32(const float *A, const float *B, float *C);
+/**@}*/
+
+/**@{*/
+/**
+ * @brief   Matrix multiplication A[6x6]xB[6x1]
+ *
+ * Matrix multiplication for two floating point matrices 6x6 and 6x1: C[6][1] = A[6][6] * B[6][1]
+ * The implementation is fully unrolled ANSI C and could be compiled and run on any platform.
+ *
+ * @param[in] A  input matrix A[6][6]
+ * @param[in] B  input matrix/vector B[6][1]
+ * @param C  result matrix/vector C[6][1]
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dspm_mult_6x6x1_f32_ansi(const float *A, const float *B, float *C);
+/**@}*/
+
+/**@{*/
+/**
+ * @brief   Matrix multiplication A[6x6]xB[6x6]
+ *
+ * Matrix multiplication for two square 6x6 floating point matrices: C[6][6] = A[6][6] * B[6][6]
+ * The implementation is fully unrolled ANSI C and could be compiled and run on any platform.
+ *
+ * @param[in] A  input matrix A[6][6]
+ * @param[in] B  input matrix B[6][6]
+ * @param C  result matrix C[6][6]
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dspm_mult_6x6x6_f32_ansi(const float *A, const float *B, float *C);
+/**@}*/
 
 /**@{*/
 /**
@@ -132,6 +181,27 @@ esp_err_t dspm_mult_s16_ae32(const int16_t *A, const int16_t *B, int16_t *C, int
 esp_err_t dspm_mult_s16_aes3(const int16_t *A, const int16_t *B, int16_t *C, int m, int n, int k, int shift);
 /**@}*/
 
+/**@{*/
+/**
+ * @brief   Square matrix multiplication 16 bit signed int for 3x3, 4x4 and 6x6 matrices
+ *
+ * Matrix multiplication for two square signed 16 bit fixed point matrices: C[N][N] = (A[N][N] * B[N][N]) >> (15- shift)
+ * Result is the same as result of dspm_mult_s16_ansi() with m = n = k = N.
+ * The implementation is fully unrolled ANSI C and could be compiled and run on any platform.
+ *
+ * @param[in] A  input matrix A[N][N]
+ * @param[in] B  input matrix B[N][N]
+ * @param C  result matrix C[N][N]
+ * @param[in] shift every result will be shifted and stored as 16 bit signed value.
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dspm_mult_3x3x3_s16_ansi(const int16_t *A, const int16_t *B, int16_t *C, int shift);
+esp_err_t dspm_mult_4x4x4_s16_ansi(const int16_t *A, const int16_t *B, int16_t *C, int shift);
+esp_err_t dspm_mult_6x6x6_s16_ansi(const int16_t *A, const int16_t *B, int16_t *C, int shift);
+/**@}*/
+
 /**@{*/
 /**
  * @brief   Matrix subset multiplication
@@ -187,17 +257,17 @@ esp_err_t dspm_mult_ex_f32_aes3(const float *A, const float *B, float *C, int m,
 #if (dspm_mult_3x3x1_f32_ae32_enabled == 1)
 #define dspm_mult_3x3x1_f32 dspm_mult_3x3x1_f32_ae32
 #else
-#define dspm_mult_3x3x1_f32(A,B,C) dspm_mult_f32_ansi(A,B,C, 3, 3, 1)
+#define dspm_mult_3x3x1_f32 dspm_mult_3x3x1_f32_ansi
 #endif
 #if (dspm_mult_3x3x3_f32_ae32_enabled == 1)
-#define dspm_mult_3x3x3_f32(A,B,C) dspm_mult_3x3x3_f32_ae32(A,B,C)
+#define dspm_mult_3x3x3_f32 dspm_mult_3x3x3_f32_ae32
 #else
-#define dspm_mult_3x3x3_f32(A,B,C) dspm_mult_f32_ansi(A,B,B,3,3,3);
+#define dspm_mult_3x3x3_f32 dspm_mult_3x3x3_f32_ansi
 #endif
 #if (dspm_mult_4x4x1_f32_ae32_enabled == 1)
-#define dspm_mult_4x4x1_f32(A,B,C) dspm_mult_4x4x1_f32_ae32(A,B,C)
+#define dspm_mult_4x4x1_f32 dspm_mult_4x4x1_f32_ae32
 #else
-#define dspm_mult_4x4x1_f32(A,B,C) dspm_mult_f32_ansi(A,B,C, 4, 4, 1)
+#define dspm_mult_4x4x1_f32 dspm_mult_4x4x1_f32_ansi
 #endif
 
 #if (dspm_mult_f32_aes3_enabled == 1)
@@ -205,18 +275,27 @@ esp_err_t dspm_mult_ex_f32_aes3(const float *A, const float *B, float *C, int m,
 #elif (dspm_mult_4x4x4_f32_ae32_enabled == 1)
 #define dspm_mult_4x4x4_f32 dspm_mult_4x4x4_f32_ae32
 #else
-#define dspm_mult_4x4x4_f32(A,B,C) dspm_mult_f32_ansi(A,B,C, 4, 4, 4)
+#define dspm_mult_4x4x4_f32 dspm_mult_4x4x4_f32_ansi
 #endif
 
 #else
 #define dspm_mult_s16 dspm_mult_s16_ansi
 #define dspm_mult_f32 dspm_mult_f32_ansi
-#define dspm_mult_3x3x1_f32(A,B,C) dspm_mult_f32_ansi(A,B,C, 3, 3, 1)
+#define dspm_mult_3x3x1_f32 dspm_mult_3x3x1_f32_ansi
+#define dspm_mult_3x3x3_f32 dspm_mult_3x3x3_f32_ansi
+#define dspm_mult_4x4x1_f32 dspm_mult_4x4x1_f32_ansi
 #define dsps_sub_f32 dsps_sub_f32_ansi
 #define dsps_add_f32 dsps_add_f32_ansi
-#define dspm_mult_4x4x4_f32(A,B,C) dspm_mult_f32_ansi(A,B,C, 4, 4, 4)
+#define dspm_mult_4x4x4_f32 dspm_mult_4x4x4_f32_ansi
 #define dspm_mult_ex_f32 dspm_mult_ex_f32_ansi
 #endif // CONFIG_DSP_OPTIMIZED
 
+// Portable unrolled versions are used on all platforms
+#define dspm_mult_6x6x1_f32 dspm_mult_6x6x1_f32_ansi
+#define dspm_mult_6x6x6_f32 dspm_mult_6x6x6_f32_ansi
+#define dspm_mult_3x3x3_s16 dspm_mult_3x3x3_s16_ansi
+#define dspm_mult_4x4x4_s16 dspm_mult_4x4x4_s16_ansi
+#define dspm_mult_6x6x6_s16 dspm_mult_6x6x6_s16_ansi
+
 
 #endif // _dspm_mult_H_
@@ -257,3 +257,58 @@ TEST_CASE("Mat class operators", "[dspm]")
 
     delete[] check_array;
 }
+
+TEST_CASE("Mat class move and static storage", "[dspm]")
+{
+    int M = 3;
+    int N = 4;
+
+    dspm::Mat A(M, N);
+    dspm::Mat B(N, M);
+    dspm::Mat C(M, M);
+    for (int m = 0 ; m < M ; m++) {
+        for (int n = 0 ; n < N ; n++) {
+            A(m, n) = m * N + n;
+            B(n, m) = n - m;
+        }
+        for (int n = 0 ; n < M ; n++) {
+            C(m, n) = m + n;
+        }
+    }
+    dspm::Mat expected = A * B + C;
+
+    // Move constructor takes over the buffer of temporary matrix
+    float *temp_data = A.data;
+    dspm::Mat moved(std::move(A));
+    TEST_ASSERT_EQUAL_PTR(temp_data, moved.data);
+    TEST_ASSERT_EQUAL(0, A.length);
+
+    // Assignment of the same size matrix keeps the destination buffer
+    dspm::Mat result(M, M);
+    float *result_data = result.data;
+    result = moved * B + C;
+    TEST_ASSERT_EQUAL_PTR(result_data, result.data);
+    TEST_ASSERT_TRUE(result == expected);
+
+    // Fixed size matrices and results to the preallocated matrices
+    dspm::MatFixed<3, 4> A_fixed(moved);
+    dspm::MatFixed<4, 3> B_fixed;
+    dspm::MatFixed<3, 3> result_fixed;
+    B.t().t(B_fixed);
+    TEST_ASSERT_TRUE(B_fixed == B);
+    dspm::Mat::multAdd(A_fixed, B_fixed, C, result_fixed);
+    TEST_ASSERT_TRUE(result_fixed == expected);
+
+    dspm::Mat::mult(A_fixed, B_fixed, result_fixed);
+    result_fixed += C;
+    TEST_ASSERT_TRUE(result_fixed == expected);
+
+    // Result matrix could be the same as accumulator
+    dspm::Mat::multAdd(A_fixed, B_fixed, C, C);
+    TEST_ASSERT_TRUE(C == expected);
+
+    // Copy of the fixed matrix has own storage
+    dspm::MatFixed<3, 3> copy_fixed(result_fixed);
+    copy_fixed(0, 0) += 1;
+    TEST_ASSERT_FALSE(copy_fixed == result_fixed);
+}
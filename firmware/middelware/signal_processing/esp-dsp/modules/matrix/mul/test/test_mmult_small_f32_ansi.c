@@ -0,0 +1,95 @@
+/**
+ * @file test_mmult_small_f32_ansi.c
+ * @brief Tests of the unrolled small float matrix multiplies and their selection by dspm_mult_f32
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include "unity.h"
+#include "esp_dsp.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dspm_mult.h"
+#include "esp_attr.h"
+#include "dsp_tests.h"
+
+static const char *TAG = "dspm_mult_NxNxK_f32_ansi";
+
+typedef esp_err_t (*mult_small_f32_t)(const float *A, const float *B, float *C);
+
+typedef struct {
+    const char *name;
+    mult_small_f32_t func;
+    int n;
+    int k;
+} mult_small_f32_case_t;
+
+static const mult_small_f32_case_t small_cases[] = {
+    {"dspm_mult_3x3x1_f32_ansi", dspm_mult_3x3x1_f32_ansi, 3, 1},
+    {"dspm_mult_3x3x3_f32_ansi", dspm_mult_3x3x3_f32_ansi, 3, 3},
+    {"dspm_mult_4x4x1_f32_ansi", dspm_mult_4x4x1_f32_ansi, 4, 1},
+    {"dspm_mult_4x4x4_f32_ansi", dspm_mult_4x4x4_f32_ansi, 4, 4},
+    {"dspm_mult_6x6x1_f32_ansi", dspm_mult_6x6x1_f32_ansi, 6, 1},
+    {"dspm_mult_6x6x6_f32_ansi", dspm_mult_6x6x6_f32_ansi, 6, 6},
+};
+
+TEST_CASE("dspm_mult_NxNxK_f32_ansi functionality", "[dspm]")
+{
+    float A[36];
+    float B[36];
+    float C[36];
+    float C_compare[36];
+    float C_dispatch[36];
+
+    for (int i = 0 ; i < 36 ; i++) {
+        A[i] = (float)(rand() % 2000 - 1000) / 100;
+        B[i] = (float)(rand() % 2000 - 1000) / 100;
+    }
+    for (int c = 0 ; c < sizeof(small_cases) / sizeof(small_cases[0]) ; c++) {
+        int n = small_cases[c].n;
+        int k = small_cases[c].k;
+        small_cases[c].func(A, B, C);
+        // Generic implementation as reference
+        dspm_mult_ex_f32_ansi(A, B, C_compare, n, n, k, 0, 0, 0);
+        // dspm_mult_f32 must select the unrolled version
+        dspm_mult_f32(A, B, C_dispatch, n, n, k);
+        for (int i = 0 ; i < n * k ; i++) {
+            ESP_LOGD(TAG, "%s [%i] calc=%f, expected =%f", small_cases[c].name, i, C[i], C_compare[i]);
+            TEST_ASSERT_FLOAT_WITHIN(1e-3, C_compare[i], C[i]);
+            TEST_ASSERT_FLOAT_WITHIN(1e-3, C_compare[i], C_dispatch[i]);
+        }
+    }
+}
+
+static portMUX_TYPE testnlock = portMUX_INITIALIZER_UNLOCKED;
+
+TEST_CASE("dspm_mult_NxNxK_f32_ansi benchmark", "[dspm]")
+{
+    float A[36] = {0};
+    float B[36] = {0};
+    float C[36];
+    int repeat_count = 1024;
+
+    for (int c = 0 ; c < sizeof(small_cases) / sizeof(small_cases[0]) ; c++) {
+        int n = small_cases[c].n;
+        int k = small_cases[c].k;
+
+        portENTER_CRITICAL(&testnlock);
+        unsigned int start_b = xthal_get_ccount();
+        for (int i = 0 ; i < repeat_count ; i++) {
+            small_cases[c].func(A, B, C);
+        }
+        unsigned int end_b = xthal_get_ccount();
+        for (int i = 0 ; i < repeat_count ; i++) {
+            dspm_mult_ex_f32_ansi(A, B, C, n, n, k, 0, 0, 0);
+        }
+        unsigned int end_g = xthal_get_ccount();
+        portEXIT_CRITICAL(&testnlock);
+
+        float cycles = (float)(end_b - start_b) / repeat_count;
+        float cycles_generic = (float)(end_g - end_b) / repeat_count;
+        ESP_LOGI(TAG, "%s - %f per multiplication, generic - %f", small_cases[c].name, cycles, cycles_generic);
+        TEST_ASSERT_LESS_THAN((int)cycles_generic, (int)cycles);
+    }
+}
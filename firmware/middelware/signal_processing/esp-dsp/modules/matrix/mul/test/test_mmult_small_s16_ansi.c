@@ -0,0 +1,91 @@
+/**
+ * @file test_mmult_small_s16_ansi.c
+ * @brief Tests of the unrolled small Q15 matrix multiplies and their selection by dspm_mult_s16_ansi
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include "unity.h"
+#include "esp_dsp.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dspm_mult.h"
+#include "esp_attr.h"
+#include "dsp_tests.h"
+
+static const char *TAG = "dspm_mult_NxNxN_s16_ansi";
+
+typedef esp_err_t (*mult_small_s16_t)(const int16_t *A, const int16_t *B, int16_t *C, int shift);
+
+typedef struct {
+    const char *name;
+    mult_small_s16_t func;
+    int n;
+} mult_small_s16_case_t;
+
+static const mult_small_s16_case_t small_cases[] = {
+    {"dspm_mult_3x3x3_s16_ansi", dspm_mult_3x3x3_s16_ansi, 3},
+    {"dspm_mult_4x4x4_s16_ansi", dspm_mult_4x4x4_s16_ansi, 4},
+    {"dspm_mult_6x6x6_s16_ansi", dspm_mult_6x6x6_s16_ansi, 6},
+};
+
+TEST_CASE("dspm_mult_NxNxN_s16_ansi functionality", "[dspm]")
+{
+    int16_t A[36];
+    int16_t B[36];
+    int16_t C[36];
+    int16_t C_compare[36];
+    int16_t C_dispatch[36];
+
+    for (int i = 0 ; i < 36 ; i++) {
+        A[i] = rand() % 0x4000 - 0x2000;
+        B[i] = rand() % 0x4000 - 0x2000;
+    }
+    for (int c = 0 ; c < sizeof(small_cases) / sizeof(small_cases[0]) ; c++) {
+        int n = small_cases[c].n;
+        for (int shift = 0 ; shift < 4 ; shift++) {
+            long long store_reg = 0;
+            for (int i = 0 ; i < n ; i++) {
+                for (int j = 0 ; j < n ; j++) {
+                    store_reg = (0x7fff >> shift);
+                    for (int s = 0 ; s < n ; s++) {
+                        store_reg += ((int32_t)A[i * n + s] * (int32_t)B[s * n + j]);
+                    }
+                    C_compare[i * n + j] = store_reg >> (15 - shift);
+                }
+            }
+            small_cases[c].func(A, B, C, shift);
+            // dspm_mult_s16_ansi must select the unrolled version
+            dspm_mult_s16_ansi(A, B, C_dispatch, n, n, n, shift);
+            for (int i = 0 ; i < n * n ; i++) {
+                ESP_LOGD(TAG, "%s [%i] calc=%i, expected =%i", small_cases[c].name, i, C[i], C_compare[i]);
+                TEST_ASSERT_EQUAL(C_compare[i], C[i]);
+                TEST_ASSERT_EQUAL(C_compare[i], C_dispatch[i]);
+            }
+        }
+    }
+}
+
+static portMUX_TYPE testnlock = portMUX_INITIALIZER_UNLOCKED;
+
+TEST_CASE("dspm_mult_NxNxN_s16_ansi benchmark", "[dspm]")
+{
+    int16_t A[36] = {0};
+    int16_t B[36] = {0};
+    int16_t C[36];
+    int repeat_count = 1024;
+
+    for (int c = 0 ; c < sizeof(small_cases) / sizeof(small_cases[0]) ; c++) {
+        portENTER_CRITICAL(&testnlock);
+        unsigned int start_b = xthal_get_ccount();
+        for (int i = 0 ; i < repeat_count ; i++) {
+            small_cases[c].func(A, B, C, 0);
+        }
+        unsigned int end_b = xthal_get_ccount();
+        portEXIT_CRITICAL(&testnlock);
+
+        float cycles = (float)(end_b - start_b) / repeat_count;
+        ESP_LOGI(TAG, "%s - %f per multiplication", small_cases[c].name, cycles);
+    }
+}
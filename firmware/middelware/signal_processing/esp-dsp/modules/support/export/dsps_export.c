@@ -0,0 +1,163 @@
+/**
+ * @file dsps_export.c
+ * @brief Delta-compressed binary frames of spectra and waveforms for the host viewer
+ */
+
+#include "dsps_export.h"
+#include <string.h>
+#include <math.h>
+
+esp_err_t dsps_export_init(export_t *exporter, uint8_t type, uint8_t channel, int len, float min, float step, int16_t *prev, uint8_t *frame)
+{
+    if ((exporter == NULL) || (frame == NULL)) {
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    if ((type != DSPS_EXPORT_SPECTRUM) && (type != DSPS_EXPORT_WAVEFORM)) {
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    if ((type == DSPS_EXPORT_SPECTRUM) && (prev == NULL)) {
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    if ((len <= 0) || (len > 0xffff)) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    if (step <= 0) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    exporter->type = type;
+    exporter->channel = channel;
+    exporter->seq = 0;
+    exporter->len = len;
+    exporter->offset = min + 32767 * step;
+    exporter->scale = step;
+    exporter->prev = prev;
+    exporter->key_interval = DSPS_EXPORT_KEY_INTERVAL;
+    exporter->frame = frame;
+    exporter->write = NULL;
+    exporter->write_ctx = NULL;
+    exporter->chunk = 0;
+    return ESP_OK;
+}
+
+void dsps_export_set_writer(export_t *exporter, dsps_export_write_t write, void *ctx, int chunk)
+{
+    exporter->write = write;
+    exporter->write_ctx = ctx;
+    exporter->chunk = chunk;
+}
+
+uint16_t dsps_export_crc16(uint16_t crc, const uint8_t *data, int len)
+{
+    for (int i = 0; i < len; i++) {
+        uint8_t x = (crc >> 8) ^ data[i];
+        x ^= x >> 4;
+        crc = (crc << 8) ^ ((uint16_t)x << 12) ^ ((uint16_t)x << 5) ^ x;
+    }
+    return crc;
+}
+
+static inline uint8_t *export_put_u16(uint8_t *p, uint16_t val)
+{
+    p[0] = val;
+    p[1] = val >> 8;
+    return p + 2;
+}
+
+static inline uint8_t *export_put_f32(uint8_t *p, float val)
+{
+    uint32_t u;
+    memcpy(&u, &val, sizeof(u));
+    p[0] = u;
+    p[1] = u >> 8;
+    p[2] = u >> 16;
+    p[3] = u >> 24;
+    return p + 4;
+}
+
+// Zigzag varint: small positive and negative differences take one byte
+static inline uint8_t *export_put_diff(uint8_t *p, int32_t diff)
+{
+    uint32_t z = ((uint32_t)diff << 1) ^ (uint32_t)(diff >> 31);
+    while (z >= 0x80) {
+        *p++ = (uint8_t)(z | 0x80);
+        z >>= 7;
+    }
+    *p++ = (uint8_t)z;
+    return p;
+}
+
+esp_err_t dsps_export_encode_f32(export_t *exporter, const float *data, int *frame_len)
+{
+    if ((exporter == NULL) || (data == NULL) || (frame_len == NULL)) {
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    int len = exporter->len;
+    // NaN passes the limits below and its conversion to int is undefined
+    for (int i = 0; i < len; i++) {
+        if (!isfinite(data[i])) {
+            return ESP_ERR_DSP_INVALID_PARAM;
+        }
+    }
+    int16_t *prev = exporter->prev;
+    int key = (exporter->type == DSPS_EXPORT_WAVEFORM) || (exporter->seq % exporter->key_interval == 0);
+    float inv_scale = 1.0f / exporter->scale;
+    float offset = exporter->offset;
+
+    uint8_t *frame = exporter->frame;
+    uint8_t *p = frame;
+    *p++ = 0xA5;
+    *p++ = 0x5A;
+    *p++ = exporter->type;
+    *p++ = key ? DSPS_EXPORT_FLAG_KEY : 0;
+    *p++ = exporter->channel;
+    p = export_put_u16(p, exporter->seq);
+    p = export_put_u16(p, len);
+    p = export_put_f32(p, offset);
+    p = export_put_f32(p, exporter->scale);
+    uint8_t *payload_len = p;
+    p += 2;
+
+    uint8_t *payload = p;
+    int32_t last = 0;
+    for (int i = 0; i < len; i++) {
+        float v = (data[i] - offset) * inv_scale;
+        v = v > 32767 ? 32767 : v;
+        v = v < -32767 ? -32767 : v;
+        int32_t q = (int32_t)(v < 0 ? v - 0.5f : v + 0.5f);
+        if (key) {
+            p = export_put_diff(p, q - last);
+            last = q;
+        } else {
+            p = export_put_diff(p, q - prev[i]);
+        }
+        if (prev) {
+            prev[i] = q;
+        }
+    }
+    export_put_u16(payload_len, p - payload);
+
+    uint16_t crc = dsps_export_crc16(0xFFFF, frame + 2, p - frame - 2);
+    p = export_put_u16(p, crc);
+
+    exporter->seq++;
+    *frame_len = p - frame;
+    return ESP_OK;
+}
+
+esp_err_t dsps_export_f32(export_t *exporter, const float *data)
+{
+    if ((exporter == NULL) || (exporter->write == NULL)) {
+        return ESP_ERR_DSP_UNINITIALIZED;
+    }
+    int frame_len;
+    esp_err_t ret = dsps_export_encode_f32(exporter, data, &frame_len);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    int chunk = exporter->chunk > 0 ? exporter->chunk : frame_len;
+    for (int pos = 0; pos < frame_len; pos += chunk) {
+        int n = frame_len - pos < chunk ? frame_len - pos : chunk;
+        exporter->write(exporter->write_ctx, exporter->frame + pos, n);
+    }
+    return ESP_OK;
+}
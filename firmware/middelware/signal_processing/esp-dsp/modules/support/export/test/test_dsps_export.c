@@ -0,0 +1,227 @@
+/**
+ * @file test_dsps_export.c
+ * @brief Round-trip and size tests of the binary spectrum/waveform export
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "unity.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dsps_export.h"
+#include "dsp_tests.h"
+
+static const char *TAG = "dsps_export";
+
+#define TEST_EXPORT_LEN     256
+#define TEST_EXPORT_FRAMES  40
+
+static float data[TEST_EXPORT_FRAMES][TEST_EXPORT_LEN];
+static int16_t prev[TEST_EXPORT_LEN];
+static uint8_t frame[DSPS_EXPORT_FRAME_SIZE(TEST_EXPORT_LEN)];
+static uint8_t stream[TEST_EXPORT_FRAMES * DSPS_EXPORT_FRAME_SIZE(TEST_EXPORT_LEN)];
+static int stream_len;
+
+static void test_export_write(void *ctx, const uint8_t *buf, int len)
+{
+    TEST_ASSERT_LESS_OR_EQUAL(*(int *)ctx, len);
+    memcpy(&stream[stream_len], buf, len);
+    stream_len += len;
+}
+
+// Spectrum in dB with a moving peak and a noise floor
+static void test_export_spectrum(void)
+{
+    srand(1);
+    for (int f = 0 ; f < TEST_EXPORT_FRAMES ; f++) {
+        float peak = 40 + f * 0.5f;
+        for (int i = 0 ; i < TEST_EXPORT_LEN ; i++) {
+            float d = (i - peak) / 3;
+            data[f][i] = -90 + 80 * expf(-d * d) + (float)(rand() % 100) / 100;
+        }
+    }
+}
+
+/**
+ * Reference decoder, same as dsps_export_viewer.py
+ * Returns number of decoded frames, frames that could not be decoded are marked in ok[].
+ */
+static int test_export_decode(const uint8_t *buf, int len, float out[][TEST_EXPORT_LEN], int ok[])
+{
+    int32_t q_prev[TEST_EXPORT_LEN];
+    int have_prev = 0;
+    int decoded = 0;
+    int pos = 0;
+    while (pos + DSPS_EXPORT_HEADER_SIZE + 2 <= len) {
+        if ((buf[pos] != 0xA5) || (buf[pos + 1] != 0x5A)) {
+            pos++;
+            continue;
+        }
+        const uint8_t *h = &buf[pos];
+        int payload_len = h[17] | (h[18] << 8);
+        int frame_len = DSPS_EXPORT_HEADER_SIZE + payload_len + 2;
+        if (pos + frame_len > len) {
+            pos++;
+            continue;
+        }
+        uint16_t crc = h[frame_len - 2] | (h[frame_len - 1] << 8);
+        if (crc != dsps_export_crc16(0xFFFF, h + 2, frame_len - 4)) {
+            // Broken frame, the next delta frames could not be decoded
+            have_prev = 0;
+            pos++;
+            continue;
+        }
+        int key = h[3] & DSPS_EXPORT_FLAG_KEY;
+        int seq = h[5] | (h[6] << 8);
+        int n = h[7] | (h[8] << 8);
+        float offset;
+        float scale;
+        memcpy(&offset, &h[9], 4);
+        memcpy(&scale, &h[13], 4);
+        TEST_ASSERT_EQUAL(TEST_EXPORT_LEN, n);
+
+        const uint8_t *p = &h[DSPS_EXPORT_HEADER_SIZE];
+        int32_t last = 0;
+        for (int i = 0 ; i < n ; i++) {
+            uint32_t z = 0;
+            int shift = 0;
+            do {
+                z |= (uint32_t)(*p & 0x7f) << shift;
+                shift += 7;
+            } while (*p++ & 0x80);
+            int32_t diff = (int32_t)(z >> 1) ^ -(int32_t)(z & 1);
+            last = key ? last + diff : q_prev[i] + diff;
+            q_prev[i] = last;
+        }
+        if (key || have_prev) {
+            for (int i = 0 ; i < n ; i++) {
+                out[seq][i] = offset + q_prev[i] * scale;
+            }
+            ok[seq] = 1;
+            decoded++;
+            have_prev = 1;
+        }
+        pos += frame_len;
+    }
+    return decoded;
+}
+
+static float decoded[TEST_EXPORT_FRAMES][TEST_EXPORT_LEN];
+
+TEST_CASE("dsps_export_f32 functionality", "[dsps]")
+{
+    export_t exporter;
+    int chunk = 100;
+    int ok[TEST_EXPORT_FRAMES] = {0};
+
+    test_export_spectrum();
+    TEST_ESP_OK(dsps_export_init(&exporter, DSPS_EXPORT_SPECTRUM, 0, TEST_EXPORT_LEN, -100, 0.1f, prev, frame));
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_UNINITIALIZED, dsps_export_f32(&exporter, data[0]));
+    dsps_export_set_writer(&exporter, test_export_write, &chunk, chunk);
+
+    stream_len = 0;
+    for (int f = 0 ; f < TEST_EXPORT_FRAMES ; f++) {
+        TEST_ESP_OK(dsps_export_f32(&exporter, data[f]));
+    }
+    TEST_ASSERT_EQUAL(TEST_EXPORT_FRAMES, test_export_decode(stream, stream_len, decoded, ok));
+    for (int f = 0 ; f < TEST_EXPORT_FRAMES ; f++) {
+        for (int i = 0 ; i < TEST_EXPORT_LEN ; i++) {
+            TEST_ASSERT_FLOAT_WITHIN(exporter.scale, data[f][i], decoded[f][i]);
+        }
+    }
+    ESP_LOGI(TAG, "%i frames of %i samples: %i bytes, %i bytes as float", TEST_EXPORT_FRAMES, TEST_EXPORT_LEN,
+             stream_len, (int)(TEST_EXPORT_FRAMES * TEST_EXPORT_LEN * sizeof(float)));
+
+    // Corrupted frame 5: delta frames up to the next key frame are lost, decoding continues after it
+    int frame_pos[TEST_EXPORT_FRAMES];
+    int pos = 0;
+    for (int f = 0 ; f < TEST_EXPORT_FRAMES ; f++) {
+        frame_pos[f] = pos;
+        pos += DSPS_EXPORT_HEADER_SIZE + (stream[pos + 17] | (stream[pos + 18] << 8)) + 2;
+    }
+    stream[frame_pos[5] + DSPS_EXPORT_HEADER_SIZE + 10] ^= 0x40;
+    memset(ok, 0, sizeof(ok));
+    int frames_ok = test_export_decode(stream, stream_len, decoded, ok);
+    TEST_ASSERT_EQUAL(TEST_EXPORT_FRAMES - (DSPS_EXPORT_KEY_INTERVAL - 5), frames_ok);
+    TEST_ASSERT_EQUAL(0, ok[5]);
+    TEST_ASSERT_EQUAL(1, ok[DSPS_EXPORT_KEY_INTERVAL]);
+}
+
+TEST_CASE("dsps_export_f32 waveform", "[dsps]")
+{
+    export_t exporter;
+    int frame_len;
+    int ok[TEST_EXPORT_FRAMES] = {0};
+
+    for (int i = 0 ; i < TEST_EXPORT_LEN ; i++) {
+        data[0][i] = sinf(2 * M_PI * i / 64);
+    }
+    data[0][10] = 5;
+    TEST_ESP_OK(dsps_export_init(&exporter, DSPS_EXPORT_WAVEFORM, 1, TEST_EXPORT_LEN, -1, 2.0f / 65534, NULL, frame));
+    TEST_ESP_OK(dsps_export_encode_f32(&exporter, data[0], &frame_len));
+    TEST_ASSERT_EQUAL(DSPS_EXPORT_FLAG_KEY, frame[3]);
+    TEST_ASSERT_EQUAL(1, frame[4]);
+    TEST_ASSERT_EQUAL(1, test_export_decode(frame, frame_len, decoded, ok));
+    // Values outside of the range are limited
+    data[0][10] = 1;
+    for (int i = 0 ; i < TEST_EXPORT_LEN ; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(exporter.scale, data[0][i], decoded[0][i]);
+    }
+}
+
+TEST_CASE("dsps_export_f32 non-finite input", "[dsps]")
+{
+    export_t exporter;
+    int frame_len;
+    int ok[TEST_EXPORT_FRAMES] = {0};
+    int16_t prev_copy[TEST_EXPORT_LEN];
+
+    test_export_spectrum();
+    TEST_ESP_OK(dsps_export_init(&exporter, DSPS_EXPORT_SPECTRUM, 0, TEST_EXPORT_LEN, -100, 0.1f, prev, frame));
+    TEST_ESP_OK(dsps_export_encode_f32(&exporter, data[0], &frame_len));
+    memcpy(prev_copy, prev, sizeof(prev));
+
+    // The frame is rejected, the next delta frame is still decoded from frame 0
+    data[1][7] = NAN;
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_PARAM, dsps_export_encode_f32(&exporter, data[1], &frame_len));
+    data[1][7] = INFINITY;
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_PARAM, dsps_export_encode_f32(&exporter, data[1], &frame_len));
+    TEST_ASSERT_EQUAL(1, exporter.seq);
+    TEST_ASSERT_EQUAL(0, memcmp(prev_copy, prev, sizeof(prev)));
+
+    TEST_ESP_OK(dsps_export_init(&exporter, DSPS_EXPORT_SPECTRUM, 0, TEST_EXPORT_LEN, -100, 0.1f, prev, frame));
+    stream_len = 0;
+    TEST_ESP_OK(dsps_export_encode_f32(&exporter, data[0], &frame_len));
+    memcpy(&stream[stream_len], frame, frame_len);
+    stream_len += frame_len;
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_PARAM, dsps_export_encode_f32(&exporter, data[1], &frame_len));
+    TEST_ESP_OK(dsps_export_encode_f32(&exporter, data[2], &frame_len));
+    memcpy(&stream[stream_len], frame, frame_len);
+    stream_len += frame_len;
+    TEST_ASSERT_EQUAL(2, test_export_decode(stream, stream_len, decoded, ok));
+    for (int i = 0 ; i < TEST_EXPORT_LEN ; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(exporter.scale, data[2][i], decoded[1][i]);
+    }
+}
+
+TEST_CASE("dsps_export_f32 benchmark", "[dsps]")
+{
+    export_t exporter;
+    int frame_len[TEST_EXPORT_FRAMES];
+    test_export_spectrum();
+    dsps_export_init(&exporter, DSPS_EXPORT_SPECTRUM, 0, TEST_EXPORT_LEN, -100, 0.1f, prev, frame);
+
+    unsigned int start_b = xthal_get_ccount();
+    for (int f = 0 ; f < TEST_EXPORT_FRAMES ; f++) {
+        dsps_export_encode_f32(&exporter, data[f], &frame_len[f]);
+    }
+    unsigned int end_b = xthal_get_ccount();
+    float cycles = (float)(end_b - start_b) / TEST_EXPORT_FRAMES;
+
+    ESP_LOGI(TAG, "Benchmark dsps_export_encode_f32 - %6i cycles for %i samples, key frame %i bytes, delta frame %i bytes",
+             (int)cycles, TEST_EXPORT_LEN, frame_len[0], frame_len[1]);
+    // Delta frames of a slow changing spectrum are less than 2 bytes per sample
+    TEST_ASSERT_LESS_THAN(2 * TEST_EXPORT_LEN, frame_len[1]);
+}
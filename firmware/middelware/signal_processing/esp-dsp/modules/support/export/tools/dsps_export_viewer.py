@@ -0,0 +1,159 @@
+#!/usr/bin/env python3
+"""
+Host viewer for frames of dsps_export_f32(...)
+
+The frame format is described in dsps_export.h.
+
+Usage:
+    dsps_export_viewer.py /dev/ttyUSB0 [--baud 921600]     live plot from UART
+    dsps_export_viewer.py capture.bin --dump               print frames from a file
+
+The serial port requires pyserial, the plot requires matplotlib.
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+SYNC = b'\xa5\x5a'
+HEADER_SIZE = 19
+SPECTRUM = 1
+WAVEFORM = 2
+FLAG_KEY = 0x01
+
+
+def crc16(data, crc=0xFFFF):
+    for b in data:
+        x = ((crc >> 8) ^ b) & 0xFF
+        x ^= x >> 4
+        crc = ((crc << 8) ^ (x << 12) ^ (x << 5) ^ x) & 0xFFFF
+    return crc
+
+
+class Decoder:
+    """Stream decoder: feed() bytes in any chunks, get decoded frames."""
+
+    def __init__(self):
+        self.buf = bytearray()
+        self.prev = {}
+        self.frames = 0
+        self.errors = 0
+
+    def feed(self, data):
+        self.buf += data
+        frames = []
+        while True:
+            pos = self.buf.find(SYNC)
+            if pos < 0:
+                del self.buf[:-1]
+                break
+            del self.buf[:pos]
+            if len(self.buf) < HEADER_SIZE + 2:
+                break
+            payload_len = self.buf[17] | (self.buf[18] << 8)
+            frame_len = HEADER_SIZE + payload_len + 2
+            if len(self.buf) < frame_len:
+                break
+            frame = bytes(self.buf[:frame_len])
+            if struct.unpack_from('<H', frame, frame_len - 2)[0] != crc16(frame[2:frame_len - 2]):
+                # Not a frame or broken frame, search the next sync
+                self.errors += 1
+                del self.buf[:1]
+                continue
+            del self.buf[:frame_len]
+            decoded = self._decode(frame)
+            if decoded is not None:
+                frames.append(decoded)
+        return frames
+
+    def _decode(self, frame):
+        ftype, flags, channel, seq, n, offset, scale, _ = struct.unpack_from('<BBBHHffH', frame, 2)
+        key = flags & FLAG_KEY
+        prev = self.prev.get(channel)
+        if not key and (prev is None or len(prev[1]) != n or prev[0] != (seq - 1) & 0xFFFF):
+            # Delta frame without the previous one, wait for the key frame
+            self.prev.pop(channel, None)
+            return None
+        q = [0] * n
+        p = HEADER_SIZE
+        last = 0
+        for i in range(n):
+            z = 0
+            shift = 0
+            while True:
+                b = frame[p]
+                p += 1
+                z |= (b & 0x7F) << shift
+                shift += 7
+                if not b & 0x80:
+                    break
+            diff = (z >> 1) ^ -(z & 1)
+            last = last + diff if key else prev[1][i] + diff
+            q[i] = last
+        self.prev[channel] = (seq, q)
+        self.frames += 1
+        return ftype, channel, seq, [offset + v * scale for v in q]
+
+
+def open_input(name, baud):
+    if name == '-':
+        return sys.stdin.buffer, None
+    if os.path.isfile(name):
+        return open(name, 'rb'), None
+    import serial
+    port = serial.Serial(name, baud, timeout=0.05)
+    return None, port
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Viewer of dsps_export frames')
+    parser.add_argument('input', help='serial port, file name or - for stdin')
+    parser.add_argument('--baud', type=int, default=921600, help='UART baud rate')
+    parser.add_argument('--dump', action='store_true', help='print frames instead of plot')
+    args = parser.parse_args()
+
+    stream, port = open_input(args.input, args.baud)
+    decoder = Decoder()
+
+    def read():
+        if port is not None:
+            return port.read(max(1, port.in_waiting))
+        return stream.read(4096)
+
+    if args.dump:
+        while True:
+            data = read()
+            if not data and port is None:
+                break
+            for ftype, channel, seq, values in decoder.feed(data):
+                name = 'spectrum' if ftype == SPECTRUM else 'waveform'
+                print('ch%i %s seq=%i n=%i min=%.3f max=%.3f' % (channel, name, seq, len(values), min(values), max(values)))
+        print('%i frames, %i CRC errors' % (decoder.frames, decoder.errors))
+        return
+
+    import matplotlib.pyplot as plt
+    from matplotlib.animation import FuncAnimation
+
+    fig, ax = plt.subplots()
+    ax.grid()
+    lines = {}
+
+    def update(_):
+        for ftype, channel, seq, values in decoder.feed(read()):
+            if channel not in lines:
+                lines[channel], = ax.plot(values, label='ch%i' % channel)
+                ax.legend(loc='upper right')
+            else:
+                lines[channel].set_data(range(len(values)), values)
+            ax.relim()
+            ax.autoscale_view()
+        ax.set_title('%i frames, %i CRC errors' % (decoder.frames, decoder.errors))
+        return list(lines.values())
+
+    _ = FuncAnimation(fig, update, interval=20, cache_frame_data=False)
+    plt.show()
+
+
+if __name__ == '__main__':
+    main()
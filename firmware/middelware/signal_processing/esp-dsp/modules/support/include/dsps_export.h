@@ -0,0 +1,175 @@
+/**
+ * @file dsps_export.h
+ * @brief Frame format and encoder API of the binary spectrum/waveform export
+ */
+
+#ifndef _dsps_export_H_
+#define _dsps_export_H_
+
+#include <stdint.h>
+#include "dsp_err.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * Binary export of spectra and waveforms
+ *
+ * The export is a fast replacement of dsps_view(...) for live debugging. Every call sends one frame:
+ *
+ * | Offset | Size | Field                                                   |
+ * |:------:|:----:|:--------------------------------------------------------|
+ * | 0      | 2    | Sync bytes 0xA5, 0x5A                                   |
+ * | 2      | 1    | Type: DSPS_EXPORT_SPECTRUM or DSPS_EXPORT_WAVEFORM      |
+ * | 3      | 1    | Flags: DSPS_EXPORT_FLAG_KEY                             |
+ * | 4      | 1    | Channel                                                 |
+ * | 5      | 2    | Sequence number                                         |
+ * | 7      | 2    | Number of samples                                       |
+ * | 9      | 4    | Offset, float                                           |
+ * | 13     | 4    | Scale, float                                            |
+ * | 17     | 2    | Payload length                                          |
+ * | 19     | N    | Payload                                                 |
+ * | 19 + N | 2    | CRC16-CCITT (0x1021, init 0xFFFF) of bytes 2 .. 18 + N  |
+ *
+ * All fields are little endian. Samples are quantized to q = round((x - offset) / scale)
+ * in int16 range, the host restores x = offset + q * scale.
+ * The payload contains zigzag varint encoded differences:
+ *  - key frame: difference between neighbour samples, q[i] - q[i - 1], q[-1] = 0
+ *  - delta frame: difference to the same sample of the previous frame of the channel
+ * Waveforms are always sent as key frames. Spectra are sent as delta frames, and every
+ * key_interval frame is a key frame, so the host could start decoding at any time.
+ * The host viewer is support/export/tools/dsps_export_viewer.py
+ */
+
+#define DSPS_EXPORT_SPECTRUM        1   /*!< Spectrum frame, inter-frame delta encoding.*/
+#define DSPS_EXPORT_WAVEFORM        2   /*!< Waveform frame, sample to sample delta encoding.*/
+
+#define DSPS_EXPORT_FLAG_KEY        0x01    /*!< Frame could be decoded without the previous frame.*/
+
+#define DSPS_EXPORT_HEADER_SIZE     19  /*!< Size of the frame header in bytes.*/
+#define DSPS_EXPORT_KEY_INTERVAL    16  /*!< Default interval of key frames for spectra.*/
+
+/**
+ * Size of the frame buffer for len samples in the worst case
+ */
+#define DSPS_EXPORT_FRAME_SIZE(len) (DSPS_EXPORT_HEADER_SIZE + 3 * (len) + 2)
+
+/**
+ * Function to send frame bytes, for example to UART or BLE.
+ *
+ * @param ctx: context from dsps_export_set_writer(...)
+ * @param data: bytes to send
+ * @param len: number of bytes, not more than chunk size
+ */
+typedef void (*dsps_export_write_t)(void *ctx, const uint8_t *data, int len);
+
+/**
+ * @brief Data struct of the exporter
+ *
+ * This structure is used by the exporter internally. A user should access this structure only in case of
+ * extensions for the DSP Library.
+ * All fields of this structure are initialized by the dsps_export_init(...) function.
+ */
+typedef struct export_s {
+    uint8_t     type;           /*!< Type of the frames, DSPS_EXPORT_SPECTRUM or DSPS_EXPORT_WAVEFORM.*/
+    uint8_t     channel;        /*!< Channel number, to send several signals to one host.*/
+    uint16_t    seq;            /*!< Sequence number of the next frame.*/
+    int         len;            /*!< Number of samples in the frame.*/
+    float       offset;         /*!< Value of q = 0.*/
+    float       scale;          /*!< Quantization step.*/
+    int16_t    *prev;           /*!< Quantized previous frame for delta frames, len samples.*/
+    int         key_interval;   /*!< Interval of key frames for delta frames.*/
+    uint8_t    *frame;          /*!< Frame buffer, DSPS_EXPORT_FRAME_SIZE(len) bytes.*/
+    dsps_export_write_t write;  /*!< Function to send the frame.*/
+    void       *write_ctx;      /*!< Context of the write function.*/
+    int         chunk;          /*!< Maximum number of bytes in one write call, 0 - not limited.*/
+} export_t;
+
+/**
+ * @brief   initialize exporter
+ *
+ * Function initialize the exporter of one channel.
+ * Values are quantized with the step to 16 bit, range of the values is min .. min + 65534 * step,
+ * values outside of the range are limited. Smaller differences between frames and samples
+ * take less bytes, so the step should be not less than required for the view, for example 0.1 dB.
+ * The implementation use ANSI C and could be compiled and run on any platform
+ *
+ * @param exporter: pointer to the exporter structure, that must be preallocated
+ * @param type: DSPS_EXPORT_SPECTRUM or DSPS_EXPORT_WAVEFORM
+ * @param channel: channel number
+ * @param len: number of samples in the frame
+ * @param min: minimum value of the signal
+ * @param step: quantization step
+ * @param prev: buffer for the previous frame, len samples. Not used for DSPS_EXPORT_WAVEFORM, could be NULL
+ * @param frame: frame buffer, DSPS_EXPORT_FRAME_SIZE(len) bytes
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_export_init(export_t *exporter, uint8_t type, uint8_t channel, int len, float min, float step, int16_t *prev, uint8_t *frame);
+
+/**
+ * @brief   set the output of the exporter
+ *
+ * @param exporter: pointer to the exporter structure
+ * @param write: function to send the frames
+ * @param ctx: context of the function
+ * @param chunk: maximum bytes in one write call, for example 255 for UartSendBuffer(...) or BleSendBuffer(...). 0 - not limited
+ */
+void dsps_export_set_writer(export_t *exporter, dsps_export_write_t write, void *ctx, int chunk);
+
+/**
+ * @brief   encode one frame
+ *
+ * Function encodes the signal to the frame buffer of the exporter.
+ * The implementation use ANSI C and could be compiled and run on any platform
+ *
+ * @param exporter: pointer to the exporter structure
+ * @param[in] data: input signal, len samples
+ * @param[out] frame_len: number of bytes in the frame
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_DSP_INVALID_PARAM if the signal has NaN or infinite values, no frame is encoded
+ *        and the sequence number and previous frame are kept
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_export_encode_f32(export_t *exporter, const float *data, int *frame_len);
+
+/**
+ * @brief   export one frame
+ *
+ * Function encodes the signal and sends the frame by the write function.
+ * The implementation use ANSI C and could be compiled and run on any platform
+ *
+ * @param exporter: pointer to the exporter structure
+ * @param[in] data: input signal, len samples
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_DSP_UNINITIALIZED if the write function is not set
+ *      - ESP_ERR_DSP_INVALID_PARAM if the signal has NaN or infinite values, nothing is sent
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_export_f32(export_t *exporter, const float *data);
+
+/**
+ * @brief   CRC16-CCITT used by the frames
+ *
+ * @param crc: initial value, 0xFFFF for a new frame
+ * @param data: bytes
+ * @param len: number of bytes
+ *
+ * @return
+ *      - updated CRC
+ */
+uint16_t dsps_export_crc16(uint16_t crc, const uint8_t *data, int len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _dsps_export_H_
@@ -0,0 +1,120 @@
+/**
+ * @file dsps_quality.h
+ * @brief Streaming signal quality monitor on FFT magnitude frames: SNR, SFDR, THD and mains hum
+ */
+
+#ifndef _dsps_quality_H_
+#define _dsps_quality_H_
+
+#include "dsp_err.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define DSPS_QUALITY_TONE_WIDTH         3   /*!< Default half width of a tone in bins, covers main lobe of Hann window.*/
+#define DSPS_QUALITY_HARMONICS          5   /*!< Default number of harmonics used for THD, including the fundamental.*/
+#define DSPS_QUALITY_MAINS_HARMONICS    3   /*!< Number of mains frequency harmonics counted as hum.*/
+
+/**
+ * @brief Data struct of the signal quality monitor
+ *
+ * This structure is used by the monitor internally. A user should access this structure only in case of
+ * extensions for the DSP Library.
+ * All fields of this structure are initialized by the dsps_quality_init_f32(...) function.
+ * Fields tone_width and harmonics could be changed after init.
+ */
+typedef struct quality_f32_s {
+    int     len;            /*!< Number of bins in the magnitude frame (FFT length / 2).*/
+    float   bin_freq;       /*!< Frequency step of the bins, Hz.*/
+    float   mains_freq;     /*!< Mains frequency, Hz. 0 - hum is not measured.*/
+    float   alpha;          /*!< Averaging factor of the exponential smoothing, 0..1. 1 - no smoothing.*/
+    int     tone_width;     /*!< Half width of the tone in bins.*/
+    int     harmonics;      /*!< Number of harmonics for THD, including the fundamental.*/
+    int     frames;         /*!< Number of processed frames.*/
+    float   tone_bin;       /*!< Interpolated position of the fundamental in the last frame, bins.*/
+    float   p_tone;         /*!< Averaged power of the fundamental.*/
+    float   p_peak;         /*!< Averaged power of the fundamental peak bin.*/
+    float   p_spur;         /*!< Averaged power of the largest bin outside the fundamental.*/
+    float   p_harm;         /*!< Averaged power of harmonics 2..harmonics.*/
+    float   p_noise;        /*!< Averaged power of everything except DC, fundamental and harmonics.*/
+    float   p_mains;        /*!< Averaged power of the mains frequency and its harmonics.*/
+} quality_f32_t;
+
+/**
+ * @brief Result of the signal quality monitor
+ */
+typedef struct quality_result_s {
+    float tone_freq;        /*!< Frequency of the fundamental, Hz.*/
+    float snr;              /*!< Signal to noise ratio, dB. Harmonics are not included to the noise.*/
+    float sfdr;             /*!< Spurious-free dynamic range, dBc.*/
+    float thd;              /*!< Total harmonic distortion, dBc.*/
+    float mains;            /*!< Mains hum power relative to the fundamental, dBc.*/
+    float mains_power;      /*!< Mains hum power in units of the squared input magnitude.*/
+} quality_result_t;
+
+/**
+ * @brief   initialize signal quality monitor
+ *
+ * Function initialize the structure of the streaming signal quality monitor.
+ * The monitor consumes magnitude frames, for example from FFTMagnitude(...) or
+ * sqrt(re^2 + im^2) of dsps_fft2r_fc32(...) output, and does not make FFT by itself.
+ * The implementation use ANSI C and could be compiled and run on any platform
+ *
+ * @param quality: pointer to the monitor structure, that must be preallocated
+ * @param len: number of bins in the magnitude frame (FFT length / 2)
+ * @param sample_freq: sample frequency of the signal, Hz
+ * @param mains_freq: mains frequency, 50 or 60 Hz. 0 to disable hum measurement
+ * @param alpha: averaging factor of the metrics, 0..1. 1 - every frame is independent
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_quality_init_f32(quality_f32_t *quality, int len, float sample_freq, float mains_freq, float alpha);
+
+/**
+ * @brief   process magnitude frame
+ *
+ * Function search the fundamental tone in the frame and update averaged power of the
+ * tone, harmonics, noise, largest spur and mains hum.
+ * Bins from 0 to tone_width are DC and not used. Harmonics above Nyquist frequency are
+ * folded back to the spectrum, harmonics that overlap DC or the fundamental are skipped.
+ * Bins shared by the bands of two harmonics are counted once.
+ * The function makes only summation and comparison, all logarithms are calculated
+ * by dsps_quality_result_f32(...).
+ * The implementation use ANSI C and could be compiled and run on any platform
+ *
+ * @param quality: pointer to the monitor structure
+ * @param magnitude: magnitude frame with length quality->len
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_DSP_INVALID_LENGTH if tone_width is too wide for the frame length
+ *      - ESP_ERR_DSP_INVALID_PARAM if the frame has NaN or infinite values, the frame is
+ *        not used and the averages are kept
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_quality_process_f32(quality_f32_t *quality, const float *magnitude);
+
+/**
+ * @brief   read metrics of the monitor
+ *
+ * Function converts averaged powers to dB.
+ * The implementation use ANSI C and could be compiled and run on any platform
+ *
+ * @param quality: pointer to the monitor structure
+ * @param result: calculated metrics
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_DSP_UNINITIALIZED if no frames were processed
+ */
+esp_err_t dsps_quality_result_f32(const quality_f32_t *quality, quality_result_t *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _dsps_quality_H_
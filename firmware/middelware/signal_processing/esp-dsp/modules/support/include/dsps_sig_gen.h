@@ -0,0 +1,191 @@
+/**
+ * @file dsps_sig_gen.h
+ * @brief Fixed-point NCO, chirp, multitone and PRBS signal generator
+ */
+
+#ifndef _dsps_sig_gen_H_
+#define _dsps_sig_gen_H_
+
+#include <stdint.h>
+#include "dsp_err.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define DSPS_SIG_GEN_TONES_MAX  8   /*!< Maximum number of tones of the multitone signal.*/
+
+/**
+ * Convert Q15 sample to the unsigned 8 bit value of AnalogOutputWrite(...)
+ */
+#define DSPS_SIG_GEN_TO_U8(x)   ((uint8_t)(((x) >> 8) + 128))
+
+/**
+ * @brief Signal type of the generator
+ */
+typedef enum sig_gen_mode {
+    SIG_GEN_OFF = 0,        /*!< Output is zero.*/
+    SIG_GEN_TONE,           /*!< Sine tone, NCO.*/
+    SIG_GEN_MULTITONE,      /*!< Sum of up to DSPS_SIG_GEN_TONES_MAX tones.*/
+    SIG_GEN_CHIRP,          /*!< Linear frequency sweep, repeated.*/
+    SIG_GEN_PRBS,           /*!< Pseudo random binary sequence.*/
+} sig_gen_mode_t;
+
+/**
+ * @brief Data struct of the fixed point signal generator
+ *
+ * This structure is used by a generator internally. A user should access this structure only in case of
+ * extensions for the DSP Library.
+ * All the fields of this structure are initialized by the dsps_sig_gen_init_s16(...) function and
+ * by the functions that select the signal type.
+ */
+typedef struct sig_gen_s16_s {
+    int16_t        *lut;                            /*!< Q15 sine table, same as S16_FIXED table of cplx_gen.*/
+    int32_t         lut_len;                        /*!< Length of the table, power of 2.*/
+    int16_t         lut_shift;                      /*!< 32 - log2(lut_len), phase to table index shift.*/
+    int16_t         free_status;                    /*!< Indicator for dsps_sig_gen_free_s16(...) function.*/
+    sig_gen_mode_t  mode;                           /*!< Type of the signal.*/
+    int             tones;                          /*!< Number of tones.*/
+    uint32_t        phase[DSPS_SIG_GEN_TONES_MAX];  /*!< Phase accumulators, 2^32 is 2*Pi.*/
+    uint32_t        step[DSPS_SIG_GEN_TONES_MAX];   /*!< Phase increments per sample.*/
+    int16_t         ampl[DSPS_SIG_GEN_TONES_MAX];   /*!< Amplitudes, Q15.*/
+    uint32_t        step_start;                     /*!< Chirp: phase increment at the start of the sweep.*/
+    int32_t         step_delta;                     /*!< Chirp: change of the phase increment per sample.*/
+    int32_t         sweep_len;                      /*!< Chirp: length of the sweep in samples.*/
+    int32_t         sweep_pos;                      /*!< Chirp: current sample of the sweep.*/
+    uint32_t        lfsr;                           /*!< PRBS: shift register.*/
+    int16_t         prbs_order;                     /*!< PRBS: order of the sequence.*/
+    int16_t         prbs_tap;                       /*!< PRBS: second tap of the polynomial.*/
+} sig_gen_s16_t;
+
+/**
+ * @brief   initialize fixed point signal generator
+ *
+ * Function initializes the generator with a Q15 sine table. The table has the same format as the S16_FIXED
+ * table of dsps_cplx_gen_init(...), so one table could be used by both generators.
+ * If the table is NULL, it is allocated and calculated, and dsps_sig_gen_free_s16(...) must be called
+ * once the generator is not needed anymore.
+ * After init the output is zero, the signal is selected by dsps_sig_gen_tone_s16(...),
+ * dsps_sig_gen_multitone_s16(...), dsps_sig_gen_chirp_s16(...) or dsps_sig_gen_prbs_s16(...).
+ * The implementation use ANSI C and could be compiled and run on any platform
+ *
+ * @param gen: pointer to the generator structure
+ * @param lut: Q15 sine table with lut_len samples of one period, or NULL
+ * @param lut_len: length of the table, power of 2, 256 to 8192 if the table is allocated
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_NO_MEM if the table could not be allocated
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_sig_gen_init_s16(sig_gen_s16_t *gen, int16_t *lut, int32_t lut_len);
+
+/**
+ * @brief   select sine tone
+ *
+ * @param gen: pointer to the generator structure
+ * @param freq: frequency in range of [-1..1], where 1 is a Nyquist frequency
+ * @param ampl: amplitude, 0..1
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_DSP_INVALID_PARAM if the frequency or the amplitude is out of range
+ */
+esp_err_t dsps_sig_gen_tone_s16(sig_gen_s16_t *gen, float freq, float ampl);
+
+/**
+ * @brief   select sum of tones
+ *
+ * The sum of amplitudes should be not more than 1, otherwise the output is saturated.
+ *
+ * @param gen: pointer to the generator structure
+ * @param freq: array of frequencies in range of [-1..1], where 1 is a Nyquist frequency
+ * @param ampl: array of amplitudes, 0..1
+ * @param tones: number of tones, 1..DSPS_SIG_GEN_TONES_MAX
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_DSP_INVALID_PARAM if a parameter is out of range
+ */
+esp_err_t dsps_sig_gen_multitone_s16(sig_gen_s16_t *gen, const float *freq, const float *ampl, int tones);
+
+/**
+ * @brief   select linear chirp
+ *
+ * The frequency changes linearly from f_start to f_end during sweep_len samples,
+ * then the sweep starts again.
+ *
+ * @param gen: pointer to the generator structure
+ * @param f_start: start frequency in range of [-1..1], where 1 is a Nyquist frequency
+ * @param f_end: end frequency in range of [-1..1]
+ * @param sweep_len: length of the sweep in samples
+ * @param ampl: amplitude, 0..1
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_DSP_INVALID_PARAM if a parameter is out of range
+ */
+esp_err_t dsps_sig_gen_chirp_s16(sig_gen_s16_t *gen, float f_start, float f_end, int32_t sweep_len, float ampl);
+
+/**
+ * @brief   select pseudo random binary sequence
+ *
+ * Maximum length sequences PRBS7 (x^7 + x^6 + 1), PRBS15 (x^15 + x^14 + 1),
+ * PRBS23 (x^23 + x^18 + 1) and PRBS31 (x^31 + x^28 + 1). The output is +ampl or -ampl.
+ *
+ * @param gen: pointer to the generator structure
+ * @param order: 7, 15, 23 or 31
+ * @param ampl: amplitude, 0..1
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_DSP_INVALID_PARAM if a parameter is out of range
+ */
+esp_err_t dsps_sig_gen_prbs_s16(sig_gen_s16_t *gen, int order, float ampl);
+
+/**
+ * @brief   generate one sample
+ *
+ * The function uses only integer operations and could be called from the timer callback
+ * to stream the signal to the DAC:
+ *
+ *     static void dac_timer(void *param)
+ *     {
+ *         AnalogOutputWrite(DSPS_SIG_GEN_TO_U8(dsps_sig_gen_sample_s16((sig_gen_s16_t *)param)));
+ *     }
+ *
+ * @param gen: pointer to the generator structure
+ *
+ * @return
+ *      - next sample, Q15
+ */
+int16_t dsps_sig_gen_sample_s16(sig_gen_s16_t *gen);
+
+/**
+ * @brief   generate block of samples
+ *
+ * The implementation use ANSI C and could be compiled and run on any platform
+ *
+ * @param gen: pointer to the generator structure
+ * @param output: output array, Q15
+ * @param len: number of samples
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_sig_gen_s16(sig_gen_s16_t *gen, int16_t *output, int len);
+
+/**
+ * @brief   free the table allocated by dsps_sig_gen_init_s16(...)
+ *
+ * @param gen: pointer to the generator structure
+ */
+void dsps_sig_gen_free_s16(sig_gen_s16_t *gen);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _dsps_sig_gen_H_
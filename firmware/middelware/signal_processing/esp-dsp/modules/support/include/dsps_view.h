@@ -29,6 +29,7 @@ extern "C"
  * Generic view function.
  * This function takes input samples and show then in console view as a plot.
  * The main purpose to give and draft debug information to the DSP developer.
+ * The function prints text with printf and is slow, for live data use dsps_export_f32(...).
  *
  * @param[in] data: array with input samples.
  * @param len: length of the input array
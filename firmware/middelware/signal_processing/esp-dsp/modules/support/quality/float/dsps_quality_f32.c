@@ -0,0 +1,203 @@
+/**
+ * @file dsps_quality_f32.c
+ * @brief Streaming signal quality monitor on FFT magnitude frames
+ */
+
+#include "dsps_quality.h"
+#include <math.h>
+#include <float.h>
+#include <stdlib.h>
+
+esp_err_t dsps_quality_init_f32(quality_f32_t *quality, int len, float sample_freq, float mains_freq, float alpha)
+{
+    if (quality == NULL) {
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    if (len < 4 * DSPS_QUALITY_TONE_WIDTH) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    if (!isfinite(sample_freq) || !isfinite(mains_freq) || (sample_freq <= 0) || (mains_freq < 0) || !(alpha > 0) || (alpha > 1)) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    quality->len = len;
+    quality->bin_freq = sample_freq / (2 * len);
+    quality->mains_freq = mains_freq;
+    quality->alpha = alpha;
+    quality->tone_width = DSPS_QUALITY_TONE_WIDTH;
+    quality->harmonics = DSPS_QUALITY_HARMONICS;
+    quality->frames = 0;
+    quality->tone_bin = 0;
+    quality->p_tone = 0;
+    quality->p_peak = 0;
+    quality->p_spur = 0;
+    quality->p_harm = 0;
+    quality->p_noise = 0;
+    quality->p_mains = 0;
+    return ESP_OK;
+}
+
+static inline float quality_band_power(const float *magnitude, int start, int end)
+{
+    float power = 0;
+    for (int i = start; i <= end; i++) {
+        power += magnitude[i] * magnitude[i];
+    }
+    return power;
+}
+
+// Bin of a harmonic folded back from frequencies above Nyquist, -1 if it overlaps DC or the fundamental
+static inline int quality_harmonic_bin(const quality_f32_t *quality, int h, int peak_pos)
+{
+    int len = quality->len;
+    int w = quality->tone_width;
+    int k = (h * peak_pos) % (2 * len);
+    if (k >= len) {
+        k = 2 * len - k;
+    }
+    if ((k >= len) || (k <= 2 * w) || (abs(k - peak_pos) <= 2 * w)) {
+        return -1;
+    }
+    return k;
+}
+
+static inline float quality_average(float average, float value, float alpha, int frames)
+{
+    if (frames == 0) {
+        return value;
+    }
+    return average + alpha * (value - average);
+}
+
+esp_err_t dsps_quality_process_f32(quality_f32_t *quality, const float *magnitude)
+{
+    if ((quality == NULL) || (magnitude == NULL)) {
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    int len = quality->len;
+    int w = quality->tone_width;
+    int dc_end = w;
+    // tone_width could be changed after init
+    if (w < 0) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    if (len < 4 * w) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+
+    // Total power above DC and the largest bin
+    float total = 0;
+    float peak = 0;
+    int peak_pos = dc_end + 1;
+    for (int i = dc_end + 1; i < len; i++) {
+        float m = magnitude[i];
+        // A NaN would stay in the averages, and the bin position derived from it is undefined
+        if (!isfinite(m)) {
+            return ESP_ERR_DSP_INVALID_PARAM;
+        }
+        total += m * m;
+        if (m > peak) {
+            peak = m;
+            peak_pos = i;
+        }
+    }
+
+    int tone_start = peak_pos - w > dc_end ? peak_pos - w : dc_end + 1;
+    int tone_end = peak_pos + w < len ? peak_pos + w : len - 1;
+    float p_tone = quality_band_power(magnitude, tone_start, tone_end);
+
+    // Largest spur outside of the fundamental
+    float spur = 0;
+    for (int i = dc_end + 1; i < tone_start; i++) {
+        spur = magnitude[i] > spur ? magnitude[i] : spur;
+    }
+    for (int i = tone_end + 1; i < len; i++) {
+        spur = magnitude[i] > spur ? magnitude[i] : spur;
+    }
+
+    // Harmonics, folded back from frequencies above Nyquist
+    float p_harm = 0;
+    for (int h = 2; h <= quality->harmonics; h++) {
+        int k = quality_harmonic_bin(quality, h, peak_pos);
+        if (k < 0) {
+            continue;
+        }
+        int start = k - w;
+        int end = k + w < len ? k + w : len - 1;
+        // Bands of a low fundamental overlap, bins of the previous bands are not counted again
+        for (int j = 2; (j < h) && (start <= end); j++) {
+            int kj = quality_harmonic_bin(quality, j, peak_pos);
+            if ((kj < 0) || (kj + w < start) || (kj - w > end)) {
+                continue;
+            }
+            if (kj - w <= start) {
+                start = kj + w + 1;
+            } else {
+                end = kj - w - 1;
+            }
+        }
+        if (start <= end) {
+            p_harm += quality_band_power(magnitude, start, end);
+        }
+    }
+
+    float p_noise = total - p_tone - p_harm;
+    p_noise = p_noise > 0 ? p_noise : 0;
+
+    float p_mains = 0;
+    if (quality->mains_freq > 0) {
+        for (int m = 1; m <= DSPS_QUALITY_MAINS_HARMONICS; m++) {
+            int k = (int)(m * quality->mains_freq / quality->bin_freq + 0.5f);
+            if (k - w >= len) {
+                break;
+            }
+            int start = k - w > dc_end ? k - w : dc_end + 1;
+            int end = k + w < len ? k + w : len - 1;
+            p_mains += quality_band_power(magnitude, start, end);
+        }
+    }
+
+    // Parabolic interpolation of the peak position
+    float tone_bin = peak_pos;
+    if (peak_pos < len - 1) {
+        float a = magnitude[peak_pos - 1];
+        float c = magnitude[peak_pos + 1];
+        float d = a - 2 * peak + c;
+        if (d < 0) {
+            tone_bin += 0.5f * (a - c) / d;
+        }
+    }
+
+    float alpha = quality->alpha;
+    int frames = quality->frames;
+    quality->tone_bin = tone_bin;
+    quality->p_tone = quality_average(quality->p_tone, p_tone, alpha, frames);
+    quality->p_peak = quality_average(quality->p_peak, peak * peak, alpha, frames);
+    quality->p_spur = quality_average(quality->p_spur, spur * spur, alpha, frames);
+    quality->p_harm = quality_average(quality->p_harm, p_harm, alpha, frames);
+    quality->p_noise = quality_average(quality->p_noise, p_noise, alpha, frames);
+    quality->p_mains = quality_average(quality->p_mains, p_mains, alpha, frames);
+    quality->frames = frames + 1;
+    return ESP_OK;
+}
+
+static inline float quality_db(float num, float den)
+{
+    return 10 * log10f((num + FLT_MIN) / (den + FLT_MIN));
+}
+
+esp_err_t dsps_quality_result_f32(const quality_f32_t *quality, quality_result_t *result)
+{
+    if ((quality == NULL) || (result == NULL)) {
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    if (quality->frames == 0) {
+        return ESP_ERR_DSP_UNINITIALIZED;
+    }
+    result->tone_freq = quality->tone_bin * quality->bin_freq;
+    result->snr = quality_db(quality->p_tone, quality->p_noise);
+    result->sfdr = quality_db(quality->p_peak, quality->p_spur);
+    result->thd = quality_db(quality->p_harm, quality->p_tone);
+    result->mains = quality_db(quality->p_mains, quality->p_tone);
+    result->mains_power = quality->p_mains;
+    return ESP_OK;
+}
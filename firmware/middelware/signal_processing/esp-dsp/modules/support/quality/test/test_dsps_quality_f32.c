@@ -0,0 +1,182 @@
+/**
+ * @file test_dsps_quality_f32.c
+ * @brief Tests of the signal quality monitor on synthetic magnitude frames
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "unity.h"
+#include "esp_dsp.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dsps_quality.h"
+#include "dsps_fft2r.h"
+#include "dsps_wind.h"
+#include "dsp_tests.h"
+
+static const char *TAG = "dsps_quality_f32";
+
+#define TEST_QUALITY_N      1024
+#define TEST_QUALITY_FS     1024.0f
+
+static float data[TEST_QUALITY_N * 2];
+static float wind[TEST_QUALITY_N];
+static float magnitude[TEST_QUALITY_N / 2];
+
+// Tone 123 Hz with 2nd and 3rd harmonics, 50 Hz hum and white noise
+#define TEST_QUALITY_TONE   123
+#define TEST_QUALITY_H2     0.01f
+#define TEST_QUALITY_H3     0.005f
+#define TEST_QUALITY_HUM    0.02f
+#define TEST_QUALITY_NOISE  0.01f
+
+static void test_quality_frame(int frame)
+{
+    int N = TEST_QUALITY_N;
+    float noise_ampl = TEST_QUALITY_NOISE * sqrtf(3);
+    for (int i = 0 ; i < N ; i++) {
+        float t = (frame * N + i) / TEST_QUALITY_FS;
+        float x = sinf(2 * M_PI * TEST_QUALITY_TONE * t);
+        x += TEST_QUALITY_H2 * sinf(2 * M_PI * 2 * TEST_QUALITY_TONE * t);
+        x += TEST_QUALITY_H3 * sinf(2 * M_PI * 3 * TEST_QUALITY_TONE * t);
+        x += TEST_QUALITY_HUM * sinf(2 * M_PI * 50 * t);
+        x += noise_ampl * (2.0f * rand() / RAND_MAX - 1);
+        data[i * 2 + 0] = x * wind[i];
+        data[i * 2 + 1] = 0;
+    }
+    dsps_fft2r_fc32(data, N);
+    dsps_bit_rev_fc32(data, N);
+    dsps_cplx2reC_fc32(data, N);
+    for (int i = 0 ; i < N / 2 ; i++) {
+        magnitude[i] = sqrtf(data[i * 2 + 0] * data[i * 2 + 0] + data[i * 2 + 1] * data[i * 2 + 1]);
+    }
+}
+
+TEST_CASE("dsps_quality_f32 functionality", "[dsps]")
+{
+    TEST_ESP_OK(dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE));
+    dsps_wind_hann_f32(wind, TEST_QUALITY_N);
+    srand(1);
+
+    quality_f32_t quality;
+    quality_result_t result;
+    TEST_ESP_OK(dsps_quality_init_f32(&quality, TEST_QUALITY_N / 2, TEST_QUALITY_FS, 50, 0.1f));
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_UNINITIALIZED, dsps_quality_result_f32(&quality, &result));
+
+    for (int frame = 0 ; frame < 32 ; frame++) {
+        test_quality_frame(frame);
+        TEST_ESP_OK(dsps_quality_process_f32(&quality, magnitude));
+    }
+    TEST_ESP_OK(dsps_quality_result_f32(&quality, &result));
+
+    // Hum is a part of the noise, harmonics are not
+    float noise_power = TEST_QUALITY_NOISE * TEST_QUALITY_NOISE + TEST_QUALITY_HUM * TEST_QUALITY_HUM / 2;
+    float snr_exp = 10 * log10f(0.5f / noise_power);
+    float sfdr_exp = -20 * log10f(TEST_QUALITY_HUM);
+    float thd_exp = 10 * log10f(TEST_QUALITY_H2 * TEST_QUALITY_H2 + TEST_QUALITY_H3 * TEST_QUALITY_H3);
+    float mains_exp = 20 * log10f(TEST_QUALITY_HUM);
+    ESP_LOGI(TAG, "tone %f Hz, SNR %f (%f) dB, SFDR %f (%f) dBc, THD %f (%f) dBc, mains %f (%f) dBc",
+             result.tone_freq, result.snr, snr_exp, result.sfdr, sfdr_exp,
+             result.thd, thd_exp, result.mains, mains_exp);
+
+    TEST_ASSERT_FLOAT_WITHIN(0.1, TEST_QUALITY_TONE, result.tone_freq);
+    TEST_ASSERT_FLOAT_WITHIN(1, snr_exp, result.snr);
+    TEST_ASSERT_FLOAT_WITHIN(1, sfdr_exp, result.sfdr);
+    TEST_ASSERT_FLOAT_WITHIN(0.5, thd_exp, result.thd);
+    TEST_ASSERT_FLOAT_WITHIN(0.5, mains_exp, result.mains);
+
+    dsps_fft2r_deinit_fc32();
+}
+
+TEST_CASE("dsps_quality_f32 band limits", "[dsps]")
+{
+    quality_f32_t quality;
+    quality_result_t result;
+    int len = 64;
+    TEST_ESP_OK(dsps_quality_init_f32(&quality, len, 2 * len, 0, 1));
+
+    // Low fundamental: bands of harmonics 3, 4 and 5 overlap by two bins
+    memset(magnitude, 0, len * sizeof(float));
+    magnitude[5] = 1;
+    for (int i = 12 ; i <= 28 ; i++) {
+        magnitude[i] = 0.1f;
+    }
+    TEST_ESP_OK(dsps_quality_process_f32(&quality, magnitude));
+    TEST_ESP_OK(dsps_quality_result_f32(&quality, &result));
+    ESP_LOGI(TAG, "THD of overlapping bands %f dBc", result.thd);
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 10 * log10f(17 * 0.1f * 0.1f), result.thd);
+
+    // Width changed after init is checked against the frame length
+    quality.tone_width = len / 4 + 1;
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_LENGTH, dsps_quality_process_f32(&quality, magnitude));
+}
+
+TEST_CASE("dsps_quality_f32 non-finite input", "[dsps]")
+{
+    quality_f32_t quality;
+    quality_result_t result;
+    quality_result_t result_rejected;
+    int len = 64;
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_PARAM_OUTOFRANGE, dsps_quality_init_f32(&quality, len, NAN, 50, 1));
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_PARAM_OUTOFRANGE, dsps_quality_init_f32(&quality, len, 2 * len, INFINITY, 1));
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_PARAM_OUTOFRANGE, dsps_quality_init_f32(&quality, len, 2 * len, 50, NAN));
+    TEST_ESP_OK(dsps_quality_init_f32(&quality, len, 2 * len, 0, 0.5f));
+
+    for (int i = 0 ; i < len ; i++) {
+        magnitude[i] = 0.01f;
+    }
+    magnitude[20] = 1;
+    TEST_ESP_OK(dsps_quality_process_f32(&quality, magnitude));
+    TEST_ESP_OK(dsps_quality_result_f32(&quality, &result));
+
+    // Frames with NaN or infinite bins are rejected and do not change the averages
+    magnitude[30] = NAN;
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_PARAM, dsps_quality_process_f32(&quality, magnitude));
+    magnitude[30] = INFINITY;
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_PARAM, dsps_quality_process_f32(&quality, magnitude));
+    TEST_ESP_OK(dsps_quality_result_f32(&quality, &result_rejected));
+    TEST_ASSERT_EQUAL(1, quality.frames);
+    TEST_ASSERT_EQUAL(0, memcmp(&result, &result_rejected, sizeof(result)));
+}
+
+TEST_CASE("dsps_quality_f32 benchmark", "[dsps]")
+{
+    TEST_ESP_OK(dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE));
+    dsps_wind_hann_f32(wind, TEST_QUALITY_N);
+    test_quality_frame(0);
+
+    quality_f32_t quality;
+    dsps_quality_init_f32(&quality, TEST_QUALITY_N / 2, TEST_QUALITY_FS, 50, 0.1f);
+
+    int repeat_count = 16;
+    float fft_cycles = 0;
+    for (int i = 0 ; i < repeat_count ; i++) {
+        for (int j = 0 ; j < TEST_QUALITY_N ; j++) {
+            data[j * 2 + 0] = wind[j];
+            data[j * 2 + 1] = 0;
+        }
+        unsigned int start_b = xthal_get_ccount();
+        dsps_fft2r_fc32(data, TEST_QUALITY_N);
+        dsps_bit_rev_fc32(data, TEST_QUALITY_N);
+        dsps_cplx2reC_fc32(data, TEST_QUALITY_N);
+        unsigned int end_b = xthal_get_ccount();
+        fft_cycles += end_b - start_b;
+    }
+    fft_cycles /= repeat_count;
+
+    unsigned int start_b = xthal_get_ccount();
+    for (int i = 0 ; i < repeat_count ; i++) {
+        dsps_quality_process_f32(&quality, magnitude);
+    }
+    unsigned int end_b = xthal_get_ccount();
+    float cycles = (float)(end_b - start_b) / repeat_count;
+
+    ESP_LOGI(TAG, "Benchmark dsps_quality_process_f32 - %6i cycles for %i bins, FFT - %6i cycles, %i.%i%% of FFT",
+             (int)cycles, TEST_QUALITY_N / 2, (int)fft_cycles,
+             (int)(100 * cycles / fft_cycles), (int)(1000 * cycles / fft_cycles) % 10);
+    // The monitor must be a small fraction of the FFT
+    TEST_ASSERT_LESS_THAN(fft_cycles / 10, cycles);
+    dsps_fft2r_deinit_fc32();
+}
@@ -0,0 +1,157 @@
+/**
+ * @file dsps_sig_gen_init_s16.c
+ * @brief Initialization and tone, chirp and PRBS setup of the Q15 signal generator
+ */
+
+#include "dsps_sig_gen.h"
+#include "dsp_common.h"
+#include "esp_log.h"
+#include <math.h>
+#include <malloc.h>
+
+#define Q15_MAX INT16_MAX
+
+static const char *TAG = "dsps_sig_gen";
+
+esp_err_t dsps_sig_gen_init_s16(sig_gen_s16_t *gen, int16_t *lut, int32_t lut_len)
+{
+    gen->lut = lut;
+    gen->lut_len = lut_len;
+    gen->free_status = 0;
+    gen->mode = SIG_GEN_OFF;
+    gen->tones = 0;
+
+    // length of the LUT must be power of 2
+    if (!dsp_is_power_of_two(lut_len)) {
+        ESP_LOGE(TAG, "The length of the LUT must be power of 2");
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+
+    // LUT length must be in a range from 256 to 8192
+    if ((lut == NULL) && ((lut_len > 8192) || (lut_len < 256))) {
+        ESP_LOGE(TAG, "The length of the LUT table out of range. Valid range is 256 to 8192");
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    gen->lut_shift = 32 - dsp_power_of_two(lut_len);
+
+    // Same table as the S16_FIXED table of dsps_cplx_gen_init()
+    if (lut == NULL) {
+        int16_t *local_lut = (int16_t *)malloc(lut_len * sizeof(int16_t));
+        if (local_lut == NULL) {
+            ESP_LOGE(TAG, "No memory for the LUT table");
+            return ESP_ERR_NO_MEM;
+        }
+        gen->free_status |= 0x0001;
+        for (int i = 0 ; i < lut_len; i++) {
+            float term = (2.0 * M_PI) * ((float)(i) / (float)(lut_len));
+            local_lut[i] = (int16_t)(sin(term) * Q15_MAX);
+        }
+        gen->lut = local_lut;
+    }
+    return ESP_OK;
+}
+
+static inline uint32_t sig_gen_step(float freq)
+{
+    // 1 is a Nyquist frequency, half of the period per sample
+    return (uint32_t)(int32_t)(freq * 2147483648.0f);
+}
+
+static inline int16_t sig_gen_ampl(float ampl)
+{
+    return (int16_t)(ampl * Q15_MAX + 0.5f);
+}
+
+esp_err_t dsps_sig_gen_tone_s16(sig_gen_s16_t *gen, float freq, float ampl)
+{
+    return dsps_sig_gen_multitone_s16(gen, &freq, &ampl, 1);
+}
+
+esp_err_t dsps_sig_gen_multitone_s16(sig_gen_s16_t *gen, const float *freq, const float *ampl, int tones)
+{
+    if ((tones < 1) || (tones > DSPS_SIG_GEN_TONES_MAX)) {
+        ESP_LOGE(TAG, "The number of tones is out of range. Valid range is 1 to %i", DSPS_SIG_GEN_TONES_MAX);
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    for (int i = 0 ; i < tones; i++) {
+        if ((freq[i] >= 1) || (freq[i] <= -1) || (ampl[i] < 0) || (ampl[i] > 1)) {
+            ESP_LOGE(TAG, "The frequency or the amplitude is out of range.");
+            return ESP_ERR_DSP_INVALID_PARAM;
+        }
+    }
+    for (int i = 0 ; i < tones; i++) {
+        gen->phase[i] = 0;
+        gen->step[i] = sig_gen_step(freq[i]);
+        gen->ampl[i] = sig_gen_ampl(ampl[i]);
+    }
+    gen->tones = tones;
+    gen->mode = tones == 1 ? SIG_GEN_TONE : SIG_GEN_MULTITONE;
+    return ESP_OK;
+}
+
+esp_err_t dsps_sig_gen_chirp_s16(sig_gen_s16_t *gen, float f_start, float f_end, int32_t sweep_len, float ampl)
+{
+    if ((f_start >= 1) || (f_start <= -1) || (f_end >= 1) || (f_end <= -1) || (ampl < 0) || (ampl > 1)) {
+        ESP_LOGE(TAG, "The frequency or the amplitude is out of range.");
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    if (sweep_len < 2) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    float step_delta = (f_end - f_start) * 2147483648.0f / (sweep_len - 1);
+    if (fabsf(step_delta) >= 2147483648.0f) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    gen->phase[0] = 0;
+    gen->step_start = sig_gen_step(f_start);
+    gen->step_delta = (int32_t)step_delta;
+    gen->step[0] = gen->step_start;
+    gen->ampl[0] = sig_gen_ampl(ampl);
+    gen->sweep_len = sweep_len;
+    gen->sweep_pos = 0;
+    gen->tones = 1;
+    gen->mode = SIG_GEN_CHIRP;
+    return ESP_OK;
+}
+
+esp_err_t dsps_sig_gen_prbs_s16(sig_gen_s16_t *gen, int order, float ampl)
+{
+    int tap;
+    switch (order) {
+    case 7:
+        tap = 6;
+        break;
+    case 15:
+        tap = 14;
+        break;
+    case 23:
+        tap = 18;
+        break;
+    case 31:
+        tap = 28;
+        break;
+    default:
+        ESP_LOGE(TAG, "The PRBS order must be 7, 15, 23 or 31");
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    if ((ampl < 0) || (ampl > 1)) {
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    gen->prbs_order = order;
+    gen->prbs_tap = tap;
+    gen->lfsr = (1UL << order) - 1;
+    gen->ampl[0] = sig_gen_ampl(ampl);
+    gen->tones = 0;
+    gen->mode = SIG_GEN_PRBS;
+    return ESP_OK;
+}
+
+void dsps_sig_gen_free_s16(sig_gen_s16_t *gen)
+{
+    if (gen->free_status & 0x0001) {
+        free(gen->lut);
+        gen->lut = NULL;
+        gen->free_status = 0;
+    }
+    gen->mode = SIG_GEN_OFF;
+}
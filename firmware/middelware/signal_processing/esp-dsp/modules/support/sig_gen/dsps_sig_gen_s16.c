@@ -0,0 +1,89 @@
+/**
+ * @file dsps_sig_gen_s16.c
+ * @brief Q15 sample generation of the NCO, chirp, multitone and PRBS modes
+ */
+
+#include "dsps_sig_gen.h"
+
+// Table lookup with linear interpolation between neighbour entries
+static inline int32_t sig_gen_sin(const sig_gen_s16_t *gen, uint32_t phase)
+{
+    int shift = gen->lut_shift;
+    uint32_t pos = phase >> shift;
+    uint32_t next = (pos + 1) & (gen->lut_len - 1);
+    int32_t frac = (phase << (32 - shift)) >> 17;   // Q15
+    int32_t a = gen->lut[pos];
+    int32_t b = gen->lut[next];
+    return a + (((b - a) * frac + (1 << 14)) >> 15);
+}
+
+static inline int16_t sig_gen_sat(int32_t val)
+{
+    if (val > INT16_MAX) {
+        return INT16_MAX;
+    }
+    if (val < INT16_MIN) {
+        return INT16_MIN;
+    }
+    return val;
+}
+
+int16_t dsps_sig_gen_sample_s16(sig_gen_s16_t *gen)
+{
+    int32_t acc = 0;
+    switch (gen->mode) {
+    case SIG_GEN_TONE:
+        acc = (sig_gen_sin(gen, gen->phase[0]) * gen->ampl[0] + (1 << 14)) >> 15;
+        gen->phase[0] += gen->step[0];
+        break;
+    case SIG_GEN_MULTITONE:
+        for (int i = 0; i < gen->tones; i++) {
+            acc += (sig_gen_sin(gen, gen->phase[i]) * gen->ampl[i] + (1 << 14)) >> 15;
+            gen->phase[i] += gen->step[i];
+        }
+        break;
+    case SIG_GEN_CHIRP:
+        acc = (sig_gen_sin(gen, gen->phase[0]) * gen->ampl[0] + (1 << 14)) >> 15;
+        gen->phase[0] += gen->step[0];
+        if (++gen->sweep_pos < gen->sweep_len) {
+            gen->step[0] += gen->step_delta;
+        } else {
+            gen->sweep_pos = 0;
+            gen->step[0] = gen->step_start;
+        }
+        break;
+    case SIG_GEN_PRBS: {
+        uint32_t lfsr = gen->lfsr;
+        uint32_t bit = ((lfsr >> (gen->prbs_order - 1)) ^ (lfsr >> (gen->prbs_tap - 1))) & 1;
+        gen->lfsr = ((lfsr << 1) | bit) & ((1UL << gen->prbs_order) - 1);
+        acc = bit ? gen->ampl[0] : -gen->ampl[0];
+        break;
+    }
+    default:
+        break;
+    }
+    return sig_gen_sat(acc);
+}
+
+esp_err_t dsps_sig_gen_s16(sig_gen_s16_t *gen, int16_t *output, int len)
+{
+    if ((gen == NULL) || (output == NULL)) {
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    if (gen->mode == SIG_GEN_TONE) {
+        // The most used case without switch per sample
+        uint32_t phase = gen->phase[0];
+        uint32_t step = gen->step[0];
+        int32_t ampl = gen->ampl[0];
+        for (int i = 0; i < len; i++) {
+            output[i] = (sig_gen_sin(gen, phase) * ampl + (1 << 14)) >> 15;
+            phase += step;
+        }
+        gen->phase[0] = phase;
+        return ESP_OK;
+    }
+    for (int i = 0; i < len; i++) {
+        output[i] = dsps_sig_gen_sample_s16(gen);
+    }
+    return ESP_OK;
+}
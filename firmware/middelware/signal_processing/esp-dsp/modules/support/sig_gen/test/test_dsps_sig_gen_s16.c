@@ -0,0 +1,181 @@
+/**
+ * @file test_dsps_sig_gen_s16.c
+ * @brief Accuracy and spectrum tests of the Q15 signal generator
+ */
+
+#include <string.h>
+#include <math.h>
+#include <malloc.h>
+#include "unity.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dsps_sig_gen.h"
+#include "dsps_cplx_gen.h"
+#include "dsp_tests.h"
+
+static const char *TAG = "dsps_sig_gen_s16";
+
+#define TEST_SIG_GEN_LEN    4096
+
+static int16_t output[TEST_SIG_GEN_LEN];
+
+TEST_CASE("dsps_sig_gen_s16 tone and multitone", "[dsps]")
+{
+    sig_gen_s16_t gen;
+    float freq[3] = {0.01f, 0.1234f, -0.5f};
+    float ampl[3] = {0.5f, 0.25f, 0.2f};
+
+    TEST_ESP_OK(dsps_sig_gen_init_s16(&gen, NULL, 256));
+    TEST_ESP_OK(dsps_sig_gen_s16(&gen, output, 16));
+    for (int i = 0 ; i < 16 ; i++) {
+        TEST_ASSERT_EQUAL(0, output[i]);
+    }
+
+    // Single tone, block and sample by sample outputs are the same
+    TEST_ESP_OK(dsps_sig_gen_tone_s16(&gen, freq[1], 0.9f));
+    TEST_ASSERT_FLOAT_WITHIN(1e-6, freq[1], gen.step[0] / 2147483648.0f);
+    TEST_ESP_OK(dsps_sig_gen_s16(&gen, output, TEST_SIG_GEN_LEN / 2));
+    for (int i = TEST_SIG_GEN_LEN / 2 ; i < TEST_SIG_GEN_LEN ; i++) {
+        output[i] = dsps_sig_gen_sample_s16(&gen);
+    }
+    // Reference phase from the same integer increment, 2^32 is one period
+    int max_err = 0;
+    for (int i = 0 ; i < TEST_SIG_GEN_LEN ; i++) {
+        double ph = (uint32_t)(gen.step[0] * i) / 4294967296.0;
+        int err = abs(output[i] - (int)lrint(0.9 * 32767 * sin(2 * M_PI * ph)));
+        max_err = err > max_err ? err : max_err;
+    }
+    ESP_LOGI(TAG, "tone max error %i LSB", max_err);
+    // Interpolation error of the 256 table is about 2 LSB, plus truncation of the table values
+    TEST_ASSERT_LESS_OR_EQUAL(6, max_err);
+
+    TEST_ESP_OK(dsps_sig_gen_multitone_s16(&gen, freq, ampl, 3));
+    TEST_ESP_OK(dsps_sig_gen_s16(&gen, output, TEST_SIG_GEN_LEN));
+    max_err = 0;
+    for (int i = 0 ; i < TEST_SIG_GEN_LEN ; i++) {
+        double ref = 0;
+        for (int t = 0 ; t < 3 ; t++) {
+            ref += ampl[t] * 32767 * sin(2 * M_PI * ((uint32_t)(gen.step[t] * i) / 4294967296.0));
+        }
+        int err = abs(output[i] - (int)lrint(ref));
+        max_err = err > max_err ? err : max_err;
+    }
+    ESP_LOGI(TAG, "multitone max error %i LSB", max_err);
+    TEST_ASSERT_LESS_OR_EQUAL(8, max_err);
+
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_PARAM, dsps_sig_gen_tone_s16(&gen, 1.0f, 0.5f));
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_PARAM, dsps_sig_gen_multitone_s16(&gen, freq, ampl, DSPS_SIG_GEN_TONES_MAX + 1));
+    dsps_sig_gen_free_s16(&gen);
+}
+
+TEST_CASE("dsps_sig_gen_s16 shares table with cplx_gen", "[dsps]")
+{
+    cplx_sig_t cplx_gen;
+    sig_gen_s16_t gen;
+    int16_t cplx_out[2 * 64];
+
+    // cplx_gen phase step is freq periods per sample, 1/128 is 1/64 of the Nyquist frequency
+    TEST_ESP_OK(dsps_cplx_gen_init(&cplx_gen, S16_FIXED, NULL, 1024, 1.0f / 128, 0));
+    TEST_ESP_OK(dsps_sig_gen_init_s16(&gen, (int16_t *)cplx_gen.lut, cplx_gen.lut_len));
+    TEST_ESP_OK(dsps_sig_gen_tone_s16(&gen, 1.0f / 64, 1));
+    TEST_ESP_OK(dsps_cplx_gen_ansi(&cplx_gen, cplx_out, 64));
+    TEST_ESP_OK(dsps_sig_gen_s16(&gen, output, 64));
+    // The tone is on the table entries, the outputs are the same up to rounding of the amplitude
+    for (int i = 0 ; i < 64 ; i++) {
+        TEST_ASSERT_INT_WITHIN(1, cplx_out[i * 2 + 1], output[i]);
+    }
+    dsps_sig_gen_free_s16(&gen);
+    cplx_gen_free(&cplx_gen);
+}
+
+TEST_CASE("dsps_sig_gen_s16 chirp", "[dsps]")
+{
+    sig_gen_s16_t gen;
+    int sweep_len = 1000;
+
+    TEST_ESP_OK(dsps_sig_gen_init_s16(&gen, NULL, 1024));
+    TEST_ESP_OK(dsps_sig_gen_chirp_s16(&gen, 0.01f, 0.5f, sweep_len, 0.5f));
+    TEST_ESP_OK(dsps_sig_gen_s16(&gen, output, 2 * sweep_len));
+
+    // Reference phase from the same integer increments
+    uint32_t phase = 0;
+    uint32_t step = gen.step_start;
+    int max_err = 0;
+    for (int i = 0 ; i < 2 * sweep_len ; i++) {
+        int ref = (int)lrint(0.5 * 32767 * sin(2 * M_PI * (phase / 4294967296.0)));
+        int err = abs(output[i] - ref);
+        max_err = err > max_err ? err : max_err;
+        phase += step;
+        step = ((i + 1) % sweep_len) ? step + gen.step_delta : gen.step_start;
+    }
+    ESP_LOGI(TAG, "chirp max error %i LSB", max_err);
+    TEST_ASSERT_LESS_OR_EQUAL(4, max_err);
+    // The end frequency of the sweep
+    TEST_ASSERT_FLOAT_WITHIN(0.001, 0.5f, (gen.step_start + (sweep_len - 1) * gen.step_delta) / 2147483648.0f);
+    dsps_sig_gen_free_s16(&gen);
+}
+
+TEST_CASE("dsps_sig_gen_s16 prbs", "[dsps]")
+{
+    sig_gen_s16_t gen;
+    int orders[2] = {7, 15};
+
+    TEST_ESP_OK(dsps_sig_gen_init_s16(&gen, NULL, 256));
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_PARAM, dsps_sig_gen_prbs_s16(&gen, 8, 0.5f));
+    for (int n = 0 ; n < 2 ; n++) {
+        int period = (1 << orders[n]) - 1;
+        TEST_ESP_OK(dsps_sig_gen_prbs_s16(&gen, orders[n], 0.5f));
+        uint32_t start = gen.lfsr;
+        int ones = 0;
+        for (int i = 0 ; i < period ; i++) {
+            int16_t x = dsps_sig_gen_sample_s16(&gen);
+            TEST_ASSERT_EQUAL(16384, abs(x));
+            ones += x > 0;
+            // Maximum length sequence: the state does not repeat before the end of the period
+            if (i < period - 1) {
+                TEST_ASSERT_NOT_EQUAL(start, gen.lfsr);
+            }
+        }
+        TEST_ASSERT_EQUAL(start, gen.lfsr);
+        TEST_ASSERT_EQUAL((period + 1) / 2, ones);
+    }
+    dsps_sig_gen_free_s16(&gen);
+}
+
+TEST_CASE("dsps_sig_gen_s16 benchmark", "[dsps]")
+{
+    sig_gen_s16_t gen;
+    float freq[4] = {0.01f, 0.02f, 0.05f, 0.1f};
+    float ampl[4] = {0.2f, 0.2f, 0.2f, 0.2f};
+    int repeat_count = 256;
+
+    dsps_sig_gen_init_s16(&gen, NULL, 1024);
+
+    dsps_sig_gen_tone_s16(&gen, freq[0], 1);
+    unsigned int start_b = xthal_get_ccount();
+    dsps_sig_gen_s16(&gen, output, repeat_count);
+    unsigned int end_b = xthal_get_ccount();
+    float block_cycles = (float)(end_b - start_b) / repeat_count;
+
+    start_b = xthal_get_ccount();
+    for (int i = 0 ; i < repeat_count ; i++) {
+        output[i] = dsps_sig_gen_sample_s16(&gen);
+    }
+    end_b = xthal_get_ccount();
+    float sample_cycles = (float)(end_b - start_b) / repeat_count;
+
+    dsps_sig_gen_multitone_s16(&gen, freq, ampl, 4);
+    start_b = xthal_get_ccount();
+    for (int i = 0 ; i < repeat_count ; i++) {
+        output[i] = dsps_sig_gen_sample_s16(&gen);
+    }
+    end_b = xthal_get_ccount();
+    float multitone_cycles = (float)(end_b - start_b) / repeat_count;
+
+    ESP_LOGI(TAG, "Benchmark tone block - %f, tone sample - %f, 4 tones sample - %f cycles per sample",
+             block_cycles, sample_cycles, multitone_cycles);
+    // One sample of 4 tones in less than 2 us at 160 MHz, small part of a 10 kHz DAC timer period
+    TEST_ASSERT_EXEC_IN_RANGE(0, 320, multitone_cycles);
+    dsps_sig_gen_free_s16(&gen);
+}
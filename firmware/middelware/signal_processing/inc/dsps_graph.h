@@ -0,0 +1,377 @@
+/**
+ * @file dsps_graph.h
+ * @brief Block processing graph: typed ports, node types and buffer planning
+ */
+
+#ifndef _dsps_graph_H_
+#define _dsps_graph_H_
+
+#include <stdint.h>
+#include "dsp_err.h"
+#include "dsps_fir.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define DSPS_GRAPH_NODES_MAX    16  /*!< Maximum number of nodes of the graph.*/
+#define DSPS_GRAPH_PORTS_MAX    32  /*!< Maximum number of ports of the graph, including scratch buffers.*/
+
+/**
+ * @brief Type of the data block of a port
+ */
+typedef enum graph_port_type {
+    GRAPH_PORT_F32 = 0,     /*!< Block of float samples.*/
+    GRAPH_PORT_EVENTS,      /*!< Block of int32_t: number of events, then sample index of every event.*/
+    GRAPH_PORT_SCRATCH,     /*!< Work buffer of a node, valid only while the node runs.*/
+} graph_port_type_t;
+
+/**
+ * @brief Port of the graph: data block produced by one node and read by any number of nodes
+ */
+typedef struct graph_port_s {
+    graph_port_type_t   type;       /*!< Type of the data.*/
+    int32_t             len;        /*!< Length of the block in 32 bit words.*/
+    int16_t             first;      /*!< Index of the node that writes the block, -1 for the graph input.*/
+    int16_t             last;       /*!< Index of the last node that reads the block.*/
+    int16_t             root;       /*!< Port that owns the memory, differs from own index if processed in place.*/
+    int16_t             output;     /*!< The block is an output of the graph and kept up to the end of the run.*/
+    int32_t             offset;     /*!< Offset of the block in the pool, 32 bit words.*/
+    void               *data;       /*!< Pointer to the block, valid after dsps_graph_compile_f32(...).*/
+} graph_port_t;
+
+struct graph_node_f32_s;
+
+/**
+ * @brief Processing function of a node
+ *
+ * @param node: pointer to the node
+ * @param input: input block
+ * @param output: output block
+ * @param scratch: work buffer of the node or NULL
+ */
+typedef esp_err_t (*graph_process_f32_t)(struct graph_node_f32_s *node, const void *input, void *output, float *scratch);
+
+/**
+ * @brief Node of the graph
+ *
+ * The node objects (coefficients, delay lines, FIR filter structures, windows) are owned by the caller,
+ * small states are stored in the node.
+ */
+typedef struct graph_node_f32_s {
+    graph_process_f32_t process;    /*!< Processing function.*/
+    void               *ctx;        /*!< Object of the node: coefficients, FIR filter structure or window.*/
+    float              *state;      /*!< Delay line of the node.*/
+    float               param[2];   /*!< Float parameters and state of the node.*/
+    int32_t             ival[4];    /*!< Integer parameters and state of the node.*/
+    int16_t             in;         /*!< Input port.*/
+    int16_t             out;        /*!< Output port.*/
+    int16_t             scratch;    /*!< Scratch port or -1.*/
+    int16_t             in_place;   /*!< The node could write the output over the input.*/
+    int32_t             in_len;     /*!< Length of the input block.*/
+    int32_t             out_len;    /*!< Length of the output block.*/
+} graph_node_f32_t;
+
+/**
+ * @brief Data struct of the processing graph
+ *
+ * The graph is a chain or a tree of nodes with typed block ports. Nodes are added in the processing order,
+ * every node reads the port of the graph input or of a node added before.
+ * After dsps_graph_compile_f32(...) the lifetime of every block is known: from the node that writes it up to
+ * the last node that reads it. Blocks with not overlapped lifetimes share the same memory of the pool,
+ * filters and envelope write the output over the input if the input is not used later.
+ *
+ * All fields of this structure are initialized by the dsps_graph_init_f32(...) and node functions.
+ */
+typedef struct graph_f32_s {
+    graph_node_f32_t    node[DSPS_GRAPH_NODES_MAX];     /*!< Nodes in the processing order.*/
+    graph_port_t        port[DSPS_GRAPH_PORTS_MAX];     /*!< Ports, port 0 is the graph input.*/
+    int16_t             nodes;                          /*!< Number of nodes.*/
+    int16_t             ports;                          /*!< Number of ports.*/
+    int16_t             compiled;                       /*!< The pool is assigned.*/
+    int16_t             free_status;                    /*!< Indicator for dsps_graph_free_f32(...) function.*/
+    float              *pool;                           /*!< Memory of all blocks.*/
+    int32_t             pool_len;                       /*!< Length of the pool, 32 bit words.*/
+    int32_t             total_len;                      /*!< Sum of lengths of all blocks, memory without reuse.*/
+} graph_f32_t;
+
+/**
+ * @brief   initialize the graph
+ *
+ * Function clears the graph and creates port 0, the graph input with block of block_len samples.
+ *
+ * @param graph: pointer to the graph structure
+ * @param block_len: number of input samples processed by one dsps_graph_run_f32(...) call
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_graph_init_f32(graph_f32_t *graph, int32_t block_len);
+
+/**
+ * @brief   add biquad IIR filter
+ *
+ * Uses dsps_biquad_f32(...), coefficients could be generated by dsps_biquad_gen_xxx_f32(...).
+ * Higher order filters are chains of biquad nodes, they are processed in place.
+ *
+ * @param graph: pointer to the graph structure
+ * @param in: input port, GRAPH_PORT_F32
+ * @param coef: array of 5 coefficients, b0,b1,b2,a1,a2
+ * @param w: delay line of 2 samples, must be cleared before
+ * @param[out] out: output port, same length as the input
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_graph_biquad_f32(graph_f32_t *graph, int in, float *coef, float *w, int *out);
+
+/**
+ * @brief   add decimation FIR filter
+ *
+ * Uses dsps_fird_f32(...), the length of the input block must be divisible by the decimation factor.
+ *
+ * @param graph: pointer to the graph structure
+ * @param in: input port, GRAPH_PORT_F32
+ * @param fir: FIR filter structure initialized by dsps_fird_init_f32(...)
+ * @param[out] out: output port, input length / decimation
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_graph_fird_f32(graph_f32_t *graph, int in, fir_f32_t *fir, int *out);
+
+/**
+ * @brief   add FFT magnitude
+ *
+ * Same result as FFTMagnitude(...): 2*|X|/(N/2), DC divided by 2. The FFT tables must be initialized by
+ * dsps_fft2r_init_fc32(...) before the run. The complex work buffer of the FFT is a scratch block of the pool.
+ *
+ * @param graph: pointer to the graph structure
+ * @param in: input port, GRAPH_PORT_F32, length power of 2
+ * @param window: window of the input length or NULL
+ * @param[out] out: output port, half of the input length
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_graph_fft_f32(graph_f32_t *graph, int in, const float *window, int *out);
+
+/**
+ * @brief   add envelope detector
+ *
+ * Rectifier and first order low pass filter: y += alpha * (|x| - y). Processed in place.
+ *
+ * @param graph: pointer to the graph structure
+ * @param in: input port, GRAPH_PORT_F32
+ * @param alpha: filter coefficient, 0..1
+ * @param[out] out: output port, same length as the input
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_graph_envelope_f32(graph_f32_t *graph, int in, float alpha, int *out);
+
+/**
+ * @brief   add peak detector
+ *
+ * Detects local maximums above the threshold, after a peak next peaks are ignored for refractory samples.
+ * The output block has the number of peaks, then the sample indexes of the peaks counted from the start
+ * of the stream. The peak is reported one sample later, so it could be reported in the next block.
+ *
+ * @param graph: pointer to the graph structure
+ * @param in: input port, GRAPH_PORT_F32
+ * @param threshold: minimum value of the peak
+ * @param refractory: minimum distance between peaks in samples
+ * @param[out] out: output port, GRAPH_PORT_EVENTS
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_graph_peak_f32(graph_f32_t *graph, int in, float threshold, int32_t refractory, int *out);
+
+/**
+ * @brief   add node with user processing function
+ *
+ * Function is used by the node functions above and could be used for extensions of the graph:
+ * the caller sets process, ctx, state, param and in_place fields of the returned node.
+ *
+ * @param graph: pointer to the graph structure
+ * @param in: input port, GRAPH_PORT_F32
+ * @param out_type: type of the output port
+ * @param out_len: length of the output block in 32 bit words
+ * @param scratch_len: length of the work buffer in 32 bit words, 0 if not needed
+ * @param[out] node: pointer to the new node
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_graph_add_node_f32(graph_f32_t *graph, int in, graph_port_type_t out_type, int32_t out_len,
+                                  int32_t scratch_len, graph_node_f32_t **node);
+
+/**
+ * @brief   mark the port as an output of the graph
+ *
+ * The block of the output port is not reused by other nodes and could be read after dsps_graph_run_f32(...).
+ *
+ * @param graph: pointer to the graph structure
+ * @param port: port index
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_DSP_INVALID_PARAM if the port does not exist
+ */
+esp_err_t dsps_graph_output_f32(graph_f32_t *graph, int port);
+
+/**
+ * @brief   assign memory to the blocks
+ *
+ * Function finds the lifetime of every block and places the blocks in the pool with minimal length.
+ * If the pool is NULL, it is allocated, and dsps_graph_free_f32(...) must be called once the graph
+ * is not needed anymore. The required length is returned in graph->pool_len.
+ *
+ * @param graph: pointer to the graph structure
+ * @param pool: memory for the blocks, graph->pool_len words aligned to 16 bytes, or NULL
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_NO_MEM if pool is NULL and the pool could not be allocated
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_graph_compile_f32(graph_f32_t *graph, float *pool);
+
+/**
+ * @brief   calculate required length of the pool
+ *
+ * Same as dsps_graph_compile_f32(...) without memory assignment, the result is in graph->pool_len.
+ *
+ * @param graph: pointer to the graph structure
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_graph_plan_f32(graph_f32_t *graph);
+
+/**
+ * @brief   process one block
+ *
+ * Runs all nodes in the order they were added.
+ * The implementation use ANSI C and could be compiled and run on any platform
+ *
+ * Example, filter chain and spectrum with peaks of the envelope:
+ *
+ *     dsps_graph_init_f32(&graph, 256);
+ *     dsps_graph_biquad_f32(&graph, 0, hp_coef, hp_w, &hp);
+ *     dsps_graph_biquad_f32(&graph, hp, lp_coef, lp_w, &lp);
+ *     dsps_graph_fft_f32(&graph, lp, hann, &spectrum);
+ *     dsps_graph_envelope_f32(&graph, lp, 0.05, &env);
+ *     dsps_graph_peak_f32(&graph, env, 0.5, 50, &peaks);
+ *     dsps_graph_output_f32(&graph, spectrum);
+ *     dsps_graph_output_f32(&graph, peaks);
+ *     dsps_graph_compile_f32(&graph, NULL);
+ *     ...
+ *     dsps_graph_run_f32(&graph, samples);
+ *     float *mag = (float *)dsps_graph_data_f32(&graph, spectrum);
+ *
+ * @param graph: pointer to the graph structure
+ * @param input: block of the input samples
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_graph_run_f32(graph_f32_t *graph, const float *input);
+
+/**
+ * @brief   data block of the port
+ *
+ * @param graph: pointer to the graph structure
+ * @param port: port index
+ *
+ * @return
+ *      - pointer to the block, valid up to the next run for output ports
+ */
+void *dsps_graph_data_f32(graph_f32_t *graph, int port);
+
+/**
+ * @brief   free the pool allocated by dsps_graph_compile_f32(...)
+ *
+ * @param graph: pointer to the graph structure, NULL is ignored
+ */
+void dsps_graph_free_f32(graph_f32_t *graph);
+
+/**
+ * @brief Function that adds the nodes to the graph for a given block length
+ *
+ * The function is called by dsps_graph_tune_f32(...) for every tested block length, it should call
+ * dsps_graph_init_f32(graph, block_len) and add the nodes. An error means the length is not supported.
+ *
+ * @param graph: pointer to the graph structure
+ * @param block_len: length of the input block
+ * @param ctx: user context
+ */
+typedef esp_err_t (*graph_build_f32_t)(graph_f32_t *graph, int32_t block_len, void *ctx);
+
+/**
+ * @brief Result of the block length selection
+ *
+ * Processing time of the block is modeled as call_cycles + sample_cycles * block_len.
+ */
+typedef struct graph_tune_s {
+    int32_t block_len;      /*!< Selected length of the block.*/
+    float   call_cycles;    /*!< Measured overhead of one run, CPU cycles.*/
+    float   sample_cycles;  /*!< Measured cost of one sample, CPU cycles.*/
+    float   block_us;       /*!< Processing time of the selected block, us.*/
+    float   latency_us;     /*!< Time to collect the block plus processing time, us.*/
+    float   load;           /*!< Part of the CPU time used at the sample rate, 0..1.*/
+} graph_tune_t;
+
+/**
+ * @brief   select the block length for a latency deadline
+ *
+ * Small blocks have short latency, but the overhead of every call is paid more often. Function builds
+ * and runs the graph on zeros for block lengths of power of 2 from min_len to max_len, estimates the overhead
+ * per call and the cost per sample, and selects the largest block with latency not more than the deadline:
+ * block_len / sample_freq + processing time <= deadline_us. The processing time must be less than
+ * the block period, otherwise the graph could not run in real time.
+ * At the end the graph is built and compiled for the selected length, the pool is allocated, and
+ * dsps_graph_free_f32(...) must be called once the graph is not needed anymore.
+ * The filter states are cleared by the run on zeros only if they were zero before.
+ *
+ *     graph_tune_t tune;
+ *     dsps_graph_tune_f32(&graph, ecg_graph_build, &ecg, 250, 100000, 4, 1024, &tune);
+ *     ESP_LOGI(TAG, "block %i: %i + %i cycles/sample, latency %i us, load %i%%", tune.block_len,
+ *              (int)tune.call_cycles, (int)tune.sample_cycles, (int)tune.latency_us, (int)(tune.load * 100));
+ *
+ * @param graph: pointer to the graph structure
+ * @param build: function that adds the nodes to the graph
+ * @param ctx: user context of the build function
+ * @param sample_freq: sample frequency of the input, Hz
+ * @param deadline_us: maximum latency, us
+ * @param min_len: minimum block length
+ * @param max_len: maximum block length
+ * @param[out] tune: selected block length and the measured costs
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_DSP_PARAM_OUTOFRANGE if no block length meets the deadline, tune has the results
+ *        of the shortest supported block
+ *      - ESP_ERR_NO_MEM if the input block for the test runs could not be allocated
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_graph_tune_f32(graph_f32_t *graph, graph_build_f32_t build, void *ctx, float sample_freq,
+                              float deadline_us, int32_t min_len, int32_t max_len, graph_tune_t *tune);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _dsps_graph_H_
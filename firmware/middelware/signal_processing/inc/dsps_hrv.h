@@ -0,0 +1,129 @@
+/**
+ * @file dsps_hrv.h
+ * @brief Streaming heart rate variability: time domain statistics and Lomb-Scargle LF/HF power
+ */
+
+#ifndef _dsps_hrv_H_
+#define _dsps_hrv_H_
+
+#include <stdint.h>
+#include "dsp_err.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define DSPS_HRV_RR_MIN     250                         /*!< Shortest accepted RR interval, ms (240 bpm).*/
+#define DSPS_HRV_RR_MAX     2500                        /*!< Longest accepted RR interval, ms (24 bpm).*/
+#define DSPS_HRV_NN50       50                          /*!< Difference of successive intervals counted by pNN50, ms.*/
+#define DSPS_HRV_LF_MIN     0.04f                       /*!< Low frequency band start, Hz.*/
+#define DSPS_HRV_LF_MAX     0.15f                       /*!< Low frequency band end and high frequency band start, Hz.*/
+#define DSPS_HRV_HF_MAX     0.4f                        /*!< High frequency band end, Hz.*/
+#define DSPS_HRV_DF         0.0025f                     /*!< Frequency step of the spectrum, Hz, band powers are exact for windows up to 1 / DSPS_HRV_DF seconds.*/
+#define DSPS_HRV_WORK_LEN(len)  (4 * (len))             /*!< Length of the work buffer for the LF/HF ratio, floats.*/
+
+/**
+ * @brief Data struct of the HRV analysis
+ *
+ * Ring of the last RR intervals with running sums. The sums are integer, so removing the oldest
+ * interval does not accumulate rounding errors.
+ * Memory: 2 bytes per interval, plus 16 bytes per interval if the LF/HF ratio is used.
+ *
+ * All fields of this structure are initialized by the dsps_hrv_init_f32(...) function.
+ */
+typedef struct hrv_f32_s {
+    uint16_t   *rr;         /*!< Ring of RR intervals, ms.*/
+    int32_t     len;        /*!< Length of the ring.*/
+    int32_t     pos;        /*!< Position of the next interval.*/
+    int32_t     count;      /*!< Number of intervals in the ring.*/
+    int64_t     sum;        /*!< Sum of the intervals.*/
+    int64_t     sum2;       /*!< Sum of the squared intervals.*/
+    int64_t     sum_d2;     /*!< Sum of the squared differences of successive intervals.*/
+    int32_t     nn50;       /*!< Number of differences over DSPS_HRV_NN50.*/
+    int32_t     rejected;   /*!< Number of intervals out of DSPS_HRV_RR_MIN..DSPS_HRV_RR_MAX.*/
+    float      *work;       /*!< Work buffer of the LF/HF ratio, NULL if not used.*/
+} hrv_f32_t;
+
+/**
+ * @brief Time domain HRV parameters
+ */
+typedef struct hrv_stats_s {
+    int32_t     beats;      /*!< Number of RR intervals.*/
+    float       mean_rr;    /*!< Mean RR interval, ms.*/
+    float       hr;         /*!< Mean heart rate, bpm.*/
+    float       sdnn;       /*!< Standard deviation of the intervals, ms.*/
+    float       rmssd;      /*!< Root mean square of successive differences, ms.*/
+    float       pnn50;      /*!< Part of successive differences over 50 ms, %.*/
+} hrv_stats_t;
+
+/**
+ * @brief   initialize HRV analysis
+ *
+ * @param hrv: pointer to the HRV structure
+ * @param rr: buffer for len intervals
+ * @param len: number of intervals in the analysis window, at least 2
+ * @param work: buffer of DSPS_HRV_WORK_LEN(len) floats for dsps_hrv_lfhf_f32(...), or NULL
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_DSP_INVALID_PARAM if hrv or rr is NULL
+ *      - ESP_ERR_DSP_INVALID_LENGTH if len is less than 2
+ */
+esp_err_t dsps_hrv_init_f32(hrv_f32_t *hrv, uint16_t *rr, int32_t len, float *work);
+
+/**
+ * @brief   add RR interval
+ *
+ * Updates the running sums in constant time: about 10 integer operations to add the interval
+ * and the same to remove the oldest one when the window is full.
+ * The implementation use ANSI C and could be compiled and run on any platform
+ *
+ * @param hrv: pointer to the HRV structure
+ * @param rr_ms: interval from the previous beat, for example qrs_beat_t::rr_ms
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_DSP_PARAM_OUTOFRANGE if the interval is out of DSPS_HRV_RR_MIN..DSPS_HRV_RR_MAX, it is not added
+ */
+esp_err_t dsps_hrv_add_f32(hrv_f32_t *hrv, int32_t rr_ms);
+
+/**
+ * @brief   time domain parameters of the window
+ *
+ * Calculated from the running sums in constant time.
+ *
+ * @param hrv: pointer to the HRV structure
+ * @param[out] stats: SDNN, RMSSD, pNN50, mean RR and heart rate
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_DSP_INVALID_LENGTH if there are less than 2 intervals
+ */
+esp_err_t dsps_hrv_stats_f32(const hrv_f32_t *hrv, hrv_stats_t *stats);
+
+/**
+ * @brief   LF/HF ratio of the window
+ *
+ * Lomb-Scargle periodogram of the unevenly sampled intervals, without resampling, at
+ * DSPS_HRV_DF steps from DSPS_HRV_LF_MIN to DSPS_HRV_HF_MAX. Sines and cosines are calculated
+ * once per interval and rotated from step to step. Calculated only on request, the cost is
+ * about 144 * 2 * count multiply-accumulate loops.
+ *
+ * @param hrv: pointer to the HRV structure
+ * @param[out] lf: power of the low frequency band, ms^2, could be NULL
+ * @param[out] hf: power of the high frequency band, ms^2, could be NULL
+ * @param[out] ratio: LF/HF ratio, 0 without HF power, could be NULL
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_DSP_UNINITIALIZED if no work buffer was given to dsps_hrv_init_f32(...)
+ *      - ESP_ERR_DSP_INVALID_LENGTH if the window is shorter than 1 / DSPS_HRV_LF_MIN seconds
+ */
+esp_err_t dsps_hrv_lfhf_f32(hrv_f32_t *hrv, float *lf, float *hf, float *ratio);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _dsps_hrv_H_
@@ -0,0 +1,120 @@
+/**
+ * @file dsps_qrs.h
+ * @brief Fixed-point Pan-Tompkins QRS detector for blocks of ECG samples
+ */
+
+#ifndef _dsps_qrs_H_
+#define _dsps_qrs_H_
+
+#include <stdint.h>
+#include "dsp_err.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define DSPS_QRS_FS_MIN     100                                 /*!< Minimum sample frequency, Hz.*/
+#define DSPS_QRS_FS_MAX     400                                 /*!< Maximum sample frequency, Hz.*/
+#define DSPS_QRS_MWI_MAX    (DSPS_QRS_FS_MAX * 150 / 1000)      /*!< Length of the integration window at DSPS_QRS_FS_MAX.*/
+#define DSPS_QRS_BP_LEN     256                                 /*!< Length of the band pass history for the R peak search, power of 2.*/
+#define DSPS_QRS_RR_LEN     8                                   /*!< Number of RR intervals in the average.*/
+#define DSPS_QRS_DELAY      21                                  /*!< Delay of the band pass filter, samples.*/
+
+/**
+ * @brief Detected beat
+ */
+typedef struct qrs_beat_s {
+    int32_t r_peak;     /*!< Sample index of the R peak, counted from dsps_qrs_init_s16(...).*/
+    int32_t rr_ms;      /*!< Interval from the previous beat, ms, 0 for the first beat.*/
+} qrs_beat_t;
+
+/**
+ * @brief Data struct of the QRS detector
+ *
+ * Pan-Tompkins detector in fixed point: band pass filter 5..11 Hz (at 200 Hz) with integer coefficients,
+ * derivative, squaring, moving window integration over 150 ms and adaptive thresholds of signal and
+ * noise peaks with T-wave discrimination and search back for missed beats.
+ * All the buffers are in the structure, the cost of one sample is constant, except the R peak search
+ * over at most DSPS_QRS_MWI_MAX + DSPS_QRS_BP_LEN / 4 samples once per detected beat.
+ *
+ * All fields of this structure are initialized by the dsps_qrs_init_s16(...) function.
+ */
+typedef struct qrs_s16_s {
+    int32_t     fs;                         /*!< Sample frequency, Hz.*/
+    int16_t     shift;                      /*!< Right shift of the derivative before squaring.*/
+    int16_t     mwi_len;                    /*!< Length of the integration window, samples.*/
+    int32_t     n;                          /*!< Index of the next sample.*/
+    int16_t     lp_x[16];                   /*!< Low pass filter input history.*/
+    int32_t     lp_y[2];                    /*!< Low pass filter output history.*/
+    int32_t     hp_x[32];                   /*!< High pass filter input history.*/
+    int32_t     hp_sum;                     /*!< High pass filter moving sum.*/
+    int32_t     bp[DSPS_QRS_BP_LEN];        /*!< Band pass filter output history.*/
+    int32_t     d_x[4];                     /*!< Derivative input history.*/
+    uint32_t    mwi_x[DSPS_QRS_MWI_MAX];    /*!< Squared derivative history.*/
+    uint32_t    mwi_sum;                    /*!< Moving window integral.*/
+    int16_t     mwi_pos;                    /*!< Position in the integration window.*/
+    int16_t     falling;                    /*!< Integral is falling after the last peak.*/
+    uint32_t    mwi_prev;                   /*!< Previous value of the integral.*/
+    uint32_t    peak;                       /*!< Maximum of the integral since the last peak.*/
+    int32_t     peak_n;                     /*!< Index of the maximum.*/
+    int32_t     slope;                      /*!< Maximum slope since the last peak.*/
+    int32_t     peak_slope;                 /*!< Maximum slope at the maximum of the integral.*/
+    uint32_t    spki;                       /*!< Running estimate of the signal peak.*/
+    uint32_t    npki;                       /*!< Running estimate of the noise peak.*/
+    uint32_t    thr1;                       /*!< First threshold.*/
+    int32_t     learn;                      /*!< Samples to the end of the learning phase.*/
+    int32_t     last_qrs;                   /*!< Index of the integral peak of the last beat, -1 if none.*/
+    int32_t     last_slope;                 /*!< Maximum slope of the last beat.*/
+    int32_t     last_r;                     /*!< R peak of the last beat, -1 if none.*/
+    int32_t     rr[DSPS_QRS_RR_LEN];        /*!< Last RR intervals, samples.*/
+    int32_t     rr_sum;                     /*!< Sum of the RR intervals.*/
+    int16_t     rr_pos;                     /*!< Position in the RR intervals.*/
+    int16_t     rr_count;                   /*!< Number of RR intervals.*/
+    uint32_t    sb_peak;                    /*!< Search back: largest noise peak above the second threshold, 0 if none.*/
+    int32_t     sb_n;                       /*!< Search back: index of the peak.*/
+    int32_t     sb_slope;                   /*!< Search back: slope of the peak.*/
+    int32_t     sb_r;                       /*!< Search back: R peak of the peak.*/
+} qrs_s16_t;
+
+/**
+ * @brief   initialize QRS detector
+ *
+ * The filters have integer coefficients designed for 200 Hz, at other frequencies the pass band is scaled,
+ * time constants are in seconds. The first 2 seconds are used to learn initial thresholds, beats in this
+ * period are not reported.
+ *
+ * @param qrs: pointer to the detector structure
+ * @param sample_freq: sample frequency, DSPS_QRS_FS_MIN..DSPS_QRS_FS_MAX Hz
+ * @param input_bits: number of bits of the input values, for example 12 for ADC values, 8..16
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_DSP_PARAM_OUTOFRANGE if a parameter is out of range
+ */
+esp_err_t dsps_qrs_init_s16(qrs_s16_t *qrs, int32_t sample_freq, int input_bits);
+
+/**
+ * @brief   process block of ECG samples
+ *
+ * Beats are reported with latency: the band pass delay and the integration window, about 250 ms,
+ * and up to 1.66 of the average RR interval for beats found by search back. At most one beat is
+ * reported per 200 ms of samples.
+ * The implementation use ANSI C and could be compiled and run on any platform
+ *
+ * @param qrs: pointer to the detector structure
+ * @param input: ECG samples, DC offset is removed by the filter
+ * @param len: number of samples
+ * @param[out] beats: detected beats
+ * @param max_beats: length of the beats array, beats over this number are lost
+ *
+ * @return
+ *      - number of detected beats
+ */
+int dsps_qrs_s16(qrs_s16_t *qrs, const int16_t *input, int len, qrs_beat_t *beats, int max_beats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _dsps_qrs_H_
@@ -0,0 +1,226 @@
+/**
+ * @file dsps_graph_f32.c
+ * @brief Construction, buffer planning and execution of the block processing graph
+ */
+
+#include "dsps_graph.h"
+#include <string.h>
+#include <malloc.h>
+
+// Blocks are aligned to 16 bytes for the FFT and the vector extensions
+#define GRAPH_ALIGN(len) (((len) + 3) & ~3)
+
+esp_err_t dsps_graph_init_f32(graph_f32_t *graph, int32_t block_len)
+{
+    if (graph == NULL) {
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    if (block_len <= 0) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    memset(graph, 0, sizeof(graph_f32_t));
+    graph->port[0].type = GRAPH_PORT_F32;
+    graph->port[0].len = block_len;
+    graph->port[0].first = -1;
+    graph->port[0].last = -1;
+    graph->port[0].root = 0;
+    graph->ports = 1;
+    return ESP_OK;
+}
+
+static int graph_add_port(graph_f32_t *graph, graph_port_type_t type, int32_t len)
+{
+    int p = graph->ports++;
+    graph_port_t *port = &graph->port[p];
+    port->type = type;
+    port->len = len;
+    port->first = graph->nodes;
+    port->last = graph->nodes;
+    port->root = p;
+    port->output = 0;
+    port->offset = 0;
+    port->data = NULL;
+    return p;
+}
+
+// Common part of all node functions: checks of the input port and creation of output and scratch ports
+esp_err_t dsps_graph_add_node_f32(graph_f32_t *graph, int in, graph_port_type_t out_type, int32_t out_len,
+                                  int32_t scratch_len, graph_node_f32_t **node)
+{
+    if (graph == NULL) {
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    if (graph->compiled) {
+        return ESP_ERR_DSP_REINITIALIZED;
+    }
+    if ((in < 0) || (in >= graph->ports) || (graph->port[in].type != GRAPH_PORT_F32)) {
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    if ((graph->nodes >= DSPS_GRAPH_NODES_MAX) || (graph->ports + 2 > DSPS_GRAPH_PORTS_MAX)) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    if (out_len <= 0) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    graph_node_f32_t *n = &graph->node[graph->nodes];
+    memset(n, 0, sizeof(graph_node_f32_t));
+    n->in = in;
+    n->in_len = graph->port[in].len;
+    n->out_len = out_len;
+    n->out = graph_add_port(graph, out_type, out_len);
+    n->scratch = scratch_len > 0 ? graph_add_port(graph, GRAPH_PORT_SCRATCH, scratch_len) : -1;
+    graph->port[in].last = graph->nodes;
+    graph->nodes++;
+    *node = n;
+    return ESP_OK;
+}
+
+esp_err_t dsps_graph_output_f32(graph_f32_t *graph, int port)
+{
+    if ((graph == NULL) || (port < 0) || (port >= graph->ports) || (graph->port[port].type == GRAPH_PORT_SCRATCH)) {
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    graph->port[port].output = 1;
+    graph->compiled = 0;
+    return ESP_OK;
+}
+
+esp_err_t dsps_graph_plan_f32(graph_f32_t *graph)
+{
+    if ((graph == NULL) || (graph->nodes == 0)) {
+        return ESP_ERR_DSP_UNINITIALIZED;
+    }
+    graph_port_t *port = graph->port;
+    int16_t end[DSPS_GRAPH_PORTS_MAX];
+
+    // Lifetime of the blocks, outputs are kept up to the end of the run
+    for (int p = 1; p < graph->ports; p++) {
+        port[p].root = p;
+        end[p] = port[p].output ? graph->nodes : port[p].last;
+    }
+    // In place processing: output uses memory of the input, if the input is not read after the node
+    for (int k = 0; k < graph->nodes; k++) {
+        graph_node_f32_t *node = &graph->node[k];
+        int r = port[node->in].root;
+        if (node->in_place && (node->in != 0) && (node->in_len == node->out_len) && (end[r] == k)) {
+            port[node->out].root = r;
+            end[r] = end[node->out];
+        }
+    }
+
+    // Blocks that own memory, the largest first
+    int16_t order[DSPS_GRAPH_PORTS_MAX];
+    int roots = 0;
+    for (int p = 1; p < graph->ports; p++) {
+        if (port[p].root != p) {
+            continue;
+        }
+        int i = roots++;
+        for (; (i > 0) && (port[order[i - 1]].len < port[p].len); i--) {
+            order[i] = order[i - 1];
+        }
+        order[i] = p;
+    }
+    // Greedy placement: lowest offset that does not overlap any placed block with overlapped lifetime
+    int32_t pool_len = 0;
+    int32_t total_len = 0;
+    for (int n = 0; n < roots; n++) {
+        int p = order[n];
+        int32_t len = GRAPH_ALIGN(port[p].len);
+        int32_t offset = 0;
+        total_len += len;
+        for (int moved = 1; moved;) {
+            moved = 0;
+            for (int i = 0; i < n; i++) {
+                int q = order[i];
+                if ((port[q].first > end[p]) || (port[p].first > end[q])) {
+                    continue;
+                }
+                int32_t q_len = GRAPH_ALIGN(port[q].len);
+                if ((offset < port[q].offset + q_len) && (port[q].offset < offset + len)) {
+                    offset = port[q].offset + q_len;
+                    moved = 1;
+                }
+            }
+        }
+        port[p].offset = offset;
+        if (offset + len > pool_len) {
+            pool_len = offset + len;
+        }
+    }
+    for (int p = 1; p < graph->ports; p++) {
+        if (port[p].root != p) {
+            port[p].offset = port[port[p].root].offset;
+            total_len += GRAPH_ALIGN(port[p].len);
+        }
+    }
+    graph->pool_len = pool_len;
+    graph->total_len = total_len;
+    return ESP_OK;
+}
+
+esp_err_t dsps_graph_compile_f32(graph_f32_t *graph, float *pool)
+{
+    esp_err_t ret = dsps_graph_plan_f32(graph);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    if (graph->free_status & 0x0001) {
+        free(graph->pool);
+        graph->free_status = 0;
+    }
+    if (pool == NULL) {
+        pool = (float *)memalign(16, graph->pool_len * sizeof(float));
+        if (pool == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+        graph->free_status |= 0x0001;
+    }
+    graph->pool = pool;
+    for (int p = 1; p < graph->ports; p++) {
+        graph->port[p].data = pool + graph->port[p].offset;
+    }
+    graph->compiled = 1;
+    return ESP_OK;
+}
+
+esp_err_t dsps_graph_run_f32(graph_f32_t *graph, const float *input)
+{
+    if ((graph == NULL) || (input == NULL)) {
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    if (!graph->compiled) {
+        return ESP_ERR_DSP_UNINITIALIZED;
+    }
+    graph->port[0].data = (void *)input;
+    for (int k = 0; k < graph->nodes; k++) {
+        graph_node_f32_t *node = &graph->node[k];
+        float *scratch = node->scratch >= 0 ? (float *)graph->port[node->scratch].data : NULL;
+        esp_err_t ret = node->process(node, graph->port[node->in].data, graph->port[node->out].data, scratch);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+    }
+    return ESP_OK;
+}
+
+void *dsps_graph_data_f32(graph_f32_t *graph, int port)
+{
+    if ((graph == NULL) || (port < 0) || (port >= graph->ports)) {
+        return NULL;
+    }
+    return graph->port[port].data;
+}
+
+void dsps_graph_free_f32(graph_f32_t *graph)
+{
+    if (graph == NULL) {
+        return;
+    }
+    if (graph->free_status & 0x0001) {
+        free(graph->pool);
+        graph->free_status = 0;
+    }
+    graph->pool = NULL;
+    graph->compiled = 0;
+}
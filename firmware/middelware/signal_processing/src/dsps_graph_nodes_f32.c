@@ -0,0 +1,203 @@
+/**
+ * @file dsps_graph_nodes_f32.c
+ * @brief Biquad, decimating FIR, FFT magnitude, envelope and peak nodes of the processing graph
+ */
+
+#include "dsps_graph.h"
+#include "dsps_biquad.h"
+#include "dsps_fft2r.h"
+#include "dsps_mul.h"
+#include "dsp_common.h"
+#include <math.h>
+#include <string.h>
+
+static esp_err_t graph_biquad_process(graph_node_f32_t *node, const void *input, void *output, float *scratch)
+{
+    (void)scratch;
+    return dsps_biquad_f32((const float *)input, (float *)output, node->in_len, (float *)node->ctx, node->state);
+}
+
+esp_err_t dsps_graph_biquad_f32(graph_f32_t *graph, int in, float *coef, float *w, int *out)
+{
+    if ((graph == NULL) || (coef == NULL) || (w == NULL) || (out == NULL) || (in < 0) || (in >= graph->ports)) {
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    graph_node_f32_t *node;
+    esp_err_t ret = dsps_graph_add_node_f32(graph, in, GRAPH_PORT_F32, graph->port[in].len, 0, &node);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    node->process = graph_biquad_process;
+    node->ctx = coef;
+    node->state = w;
+    node->in_place = 1;
+    *out = node->out;
+    return ESP_OK;
+}
+
+static esp_err_t graph_fird_process(graph_node_f32_t *node, const void *input, void *output, float *scratch)
+{
+    (void)scratch;
+    dsps_fird_f32((fir_f32_t *)node->ctx, (const float *)input, (float *)output, node->out_len);
+    return ESP_OK;
+}
+
+esp_err_t dsps_graph_fird_f32(graph_f32_t *graph, int in, fir_f32_t *fir, int *out)
+{
+    if ((graph == NULL) || (fir == NULL) || (out == NULL) || (fir->decim < 1)) {
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    if ((in < 0) || (in >= graph->ports) || (graph->port[in].len % fir->decim)) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    graph_node_f32_t *node;
+    esp_err_t ret = dsps_graph_add_node_f32(graph, in, GRAPH_PORT_F32, graph->port[in].len / fir->decim, 0, &node);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    node->process = graph_fird_process;
+    node->ctx = fir;
+    *out = node->out;
+    return ESP_OK;
+}
+
+static esp_err_t graph_fft_process(graph_node_f32_t *node, const void *input, void *output, float *scratch)
+{
+    int len = node->in_len;
+    float *mag = (float *)output;
+    // Input as real part of the complex work buffer
+    memset(scratch, 0, 2 * len * sizeof(float));
+    if (node->ctx) {
+        dsps_mul_f32((const float *)input, (const float *)node->ctx, scratch, len, 1, 1, 2);
+    } else {
+        for (int i = 0; i < len; i++) {
+            scratch[i * 2] = ((const float *)input)[i];
+        }
+    }
+    esp_err_t ret = dsps_fft2r_fc32(scratch, len);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    dsps_bit_rev_fc32(scratch, len);
+    dsps_cplx2reC_fc32(scratch, len);
+    float scale = 2.0f / (len / 2);
+    for (int i = 0; i < len / 2; i++) {
+        mag[i] = scale * sqrtf(scratch[i * 2] * scratch[i * 2] + scratch[i * 2 + 1] * scratch[i * 2 + 1]);
+    }
+    mag[0] *= 0.5f;
+    return ESP_OK;
+}
+
+esp_err_t dsps_graph_fft_f32(graph_f32_t *graph, int in, const float *window, int *out)
+{
+    if ((graph == NULL) || (out == NULL) || (in < 0) || (in >= graph->ports)) {
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    int32_t len = graph->port[in].len;
+    if ((len < 4) || !dsp_is_power_of_two(len)) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    graph_node_f32_t *node;
+    esp_err_t ret = dsps_graph_add_node_f32(graph, in, GRAPH_PORT_F32, len / 2, 2 * len, &node);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    node->process = graph_fft_process;
+    node->ctx = (void *)window;
+    *out = node->out;
+    return ESP_OK;
+}
+
+static esp_err_t graph_envelope_process(graph_node_f32_t *node, const void *input, void *output, float *scratch)
+{
+    (void)scratch;
+    const float *x = (const float *)input;
+    float *y = (float *)output;
+    float alpha = node->param[0];
+    float env = node->param[1];
+    for (int i = 0; i < node->in_len; i++) {
+        env += alpha * (fabsf(x[i]) - env);
+        y[i] = env;
+    }
+    node->param[1] = env;
+    return ESP_OK;
+}
+
+esp_err_t dsps_graph_envelope_f32(graph_f32_t *graph, int in, float alpha, int *out)
+{
+    if ((graph == NULL) || (out == NULL) || (in < 0) || (in >= graph->ports)) {
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    if ((alpha <= 0) || (alpha > 1)) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    graph_node_f32_t *node;
+    esp_err_t ret = dsps_graph_add_node_f32(graph, in, GRAPH_PORT_F32, graph->port[in].len, 0, &node);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    node->process = graph_envelope_process;
+    node->param[0] = alpha;
+    node->param[1] = 0;
+    node->in_place = 1;
+    *out = node->out;
+    return ESP_OK;
+}
+
+// ival[0] - refractory, ival[1] - samples to the end of refractory period,
+// ival[2] - signal is rising, ival[3] - index of the next sample
+static esp_err_t graph_peak_process(graph_node_f32_t *node, const void *input, void *output, float *scratch)
+{
+    (void)scratch;
+    const float *x = (const float *)input;
+    int32_t *events = (int32_t *)output;
+    float threshold = node->param[0];
+    float prev = node->param[1];
+    int32_t hold = node->ival[1];
+    int32_t rising = node->ival[2];
+    int32_t index = node->ival[3];
+    int32_t count = 0;
+    for (int i = 0; i < node->in_len; i++) {
+        if (hold > 0) {
+            hold--;
+        }
+        if (rising && (x[i] < prev) && (prev > threshold) && (hold == 0)) {
+            events[1 + count++] = index - 1;
+            hold = node->ival[0];
+        }
+        if (x[i] != prev) {
+            rising = x[i] > prev;
+        }
+        prev = x[i];
+        index++;
+    }
+    events[0] = count;
+    node->param[1] = prev;
+    node->ival[1] = hold;
+    node->ival[2] = rising;
+    node->ival[3] = index;
+    return ESP_OK;
+}
+
+esp_err_t dsps_graph_peak_f32(graph_f32_t *graph, int in, float threshold, int32_t refractory, int *out)
+{
+    if ((graph == NULL) || (out == NULL) || (in < 0) || (in >= graph->ports)) {
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    if (refractory < 0) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    // Peaks are at least 2 samples and refractory period apart
+    int32_t distance = refractory > 2 ? refractory : 2;
+    graph_node_f32_t *node;
+    esp_err_t ret = dsps_graph_add_node_f32(graph, in, GRAPH_PORT_EVENTS, 2 + graph->port[in].len / distance, 0, &node);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    node->process = graph_peak_process;
+    node->param[0] = threshold;
+    node->param[1] = 0;
+    node->ival[0] = refractory;
+    *out = node->out;
+    return ESP_OK;
+}
@@ -0,0 +1,123 @@
+/**
+ * @file dsps_graph_tune_f32.c
+ * @brief Selection of the graph block length from measured cost and a latency deadline
+ */
+
+#include "dsps_graph.h"
+#include "dsp_common.h"
+#include "dsp_platform.h"
+#include "sdkconfig.h"
+#include <stdlib.h>
+
+#ifndef CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ
+#define CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ 160
+#endif
+
+#define GRAPH_TUNE_POINTS   16
+#define GRAPH_TUNE_REPEAT   8
+
+// Minimum time of few runs, interrupts only add time
+static esp_err_t graph_tune_measure(graph_f32_t *graph, const float *zeros, float *cycles)
+{
+    unsigned int best = 0xFFFFFFFF;
+    for (int i = 0; i < GRAPH_TUNE_REPEAT; i++) {
+        unsigned int start = dsp_get_cpu_cycle_count();
+        esp_err_t ret = dsps_graph_run_f32(graph, zeros);
+        unsigned int end = dsp_get_cpu_cycle_count();
+        if (ret != ESP_OK) {
+            return ret;
+        }
+        if (end - start < best) {
+            best = end - start;
+        }
+    }
+    *cycles = best;
+    return ESP_OK;
+}
+
+esp_err_t dsps_graph_tune_f32(graph_f32_t *graph, graph_build_f32_t build, void *ctx, float sample_freq,
+                              float deadline_us, int32_t min_len, int32_t max_len, graph_tune_t *tune)
+{
+    if ((graph == NULL) || (build == NULL) || (tune == NULL) || (sample_freq <= 0) || (deadline_us <= 0)) {
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    if ((min_len < 1) || (max_len < min_len)) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    float *zeros = (float *)calloc(max_len, sizeof(float));
+    if (zeros == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    // Cost of the supported block lengths
+    int32_t len[GRAPH_TUNE_POINTS];
+    float cycles[GRAPH_TUNE_POINTS];
+    int points = 0;
+    esp_err_t ret = ESP_OK;
+    for (int32_t n = 1; (n <= max_len) && (points < GRAPH_TUNE_POINTS); n <<= 1) {
+        if ((n < min_len) || (build(graph, n, ctx) != ESP_OK)) {
+            continue;
+        }
+        ret = dsps_graph_compile_f32(graph, NULL);
+        if (ret == ESP_OK) {
+            ret = graph_tune_measure(graph, zeros, &cycles[points]);
+        }
+        dsps_graph_free_f32(graph);
+        if (ret != ESP_OK) {
+            break;
+        }
+        len[points++] = n;
+    }
+    free(zeros);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    if (points == 0) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+
+    // Least squares line: cycles = call_cycles + sample_cycles * len
+    float call_cycles = cycles[0];
+    float sample_cycles = 0;
+    if (points > 1) {
+        float sn = 0, sc = 0, snn = 0, snc = 0;
+        for (int i = 0; i < points; i++) {
+            sn += len[i];
+            sc += cycles[i];
+            snn += (float)len[i] * len[i];
+            snc += (float)len[i] * cycles[i];
+        }
+        sample_cycles = (points * snc - sn * sc) / (points * snn - sn * sn);
+        call_cycles = (sc - sample_cycles * sn) / points;
+        if (call_cycles < 0) {
+            call_cycles = 0;
+        }
+    }
+
+    // Largest block that meets the deadline and runs in real time
+    int selected = 0;
+    ret = ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    for (int i = 0; i < points; i++) {
+        float period_us = len[i] * 1000000.0f / sample_freq;
+        float block_us = (call_cycles + sample_cycles * len[i]) / CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ;
+        if ((period_us + block_us <= deadline_us) && (block_us < period_us)) {
+            selected = i;
+            ret = ESP_OK;
+        }
+    }
+    tune->block_len = len[selected];
+    tune->call_cycles = call_cycles;
+    tune->sample_cycles = sample_cycles;
+    tune->block_us = (call_cycles + sample_cycles * tune->block_len) / CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ;
+    tune->latency_us = tune->block_len * 1000000.0f / sample_freq + tune->block_us;
+    tune->load = tune->block_us * sample_freq / (tune->block_len * 1000000.0f);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    ret = build(graph, tune->block_len, ctx);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    return dsps_graph_compile_f32(graph, NULL);
+}
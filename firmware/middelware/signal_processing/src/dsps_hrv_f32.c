@@ -0,0 +1,158 @@
+/**
+ * @file dsps_hrv_f32.c
+ * @brief Streaming HRV statistics over a ring of RR intervals and lazy Lomb-Scargle LF/HF
+ */
+
+#include "dsps_hrv.h"
+#include <math.h>
+
+esp_err_t dsps_hrv_init_f32(hrv_f32_t *hrv, uint16_t *rr, int32_t len, float *work)
+{
+    if ((hrv == NULL) || (rr == NULL)) {
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    if (len < 2) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    hrv->rr = rr;
+    hrv->len = len;
+    hrv->pos = 0;
+    hrv->count = 0;
+    hrv->sum = 0;
+    hrv->sum2 = 0;
+    hrv->sum_d2 = 0;
+    hrv->nn50 = 0;
+    hrv->rejected = 0;
+    hrv->work = work;
+    return ESP_OK;
+}
+
+esp_err_t dsps_hrv_add_f32(hrv_f32_t *hrv, int32_t rr_ms)
+{
+    if ((rr_ms < DSPS_HRV_RR_MIN) || (rr_ms > DSPS_HRV_RR_MAX)) {
+        hrv->rejected++;
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    if (hrv->count == hrv->len) {
+        // Oldest interval and its difference to the next one leave the window
+        int32_t old = hrv->rr[hrv->pos];
+        int32_t next = hrv->rr[(hrv->pos + 1) % hrv->len];
+        int32_t d = next - old;
+        hrv->sum -= old;
+        hrv->sum2 -= old * old;
+        hrv->sum_d2 -= d * d;
+        hrv->nn50 -= (d > DSPS_HRV_NN50) || (d < -DSPS_HRV_NN50);
+        hrv->count--;
+    }
+    if (hrv->count > 0) {
+        int32_t d = rr_ms - hrv->rr[(hrv->pos + hrv->len - 1) % hrv->len];
+        hrv->sum_d2 += d * d;
+        hrv->nn50 += (d > DSPS_HRV_NN50) || (d < -DSPS_HRV_NN50);
+    }
+    hrv->sum += rr_ms;
+    hrv->sum2 += rr_ms * rr_ms;
+    hrv->rr[hrv->pos] = rr_ms;
+    hrv->pos = (hrv->pos + 1) % hrv->len;
+    hrv->count++;
+    return ESP_OK;
+}
+
+esp_err_t dsps_hrv_stats_f32(const hrv_f32_t *hrv, hrv_stats_t *stats)
+{
+    int32_t n = hrv->count;
+    if (n < 2) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    stats->beats = n;
+    stats->mean_rr = (float)hrv->sum / n;
+    stats->hr = 60000.0f / stats->mean_rr;
+    // n * sum2 - sum^2 is exact in 64 bits
+    stats->sdnn = sqrtf((float)(n * hrv->sum2 - hrv->sum * hrv->sum) / ((float)n * (n - 1)));
+    stats->rmssd = sqrtf((float)hrv->sum_d2 / (n - 1));
+    stats->pnn50 = 100.0f * hrv->nn50 / (n - 1);
+    return ESP_OK;
+}
+
+esp_err_t dsps_hrv_lfhf_f32(hrv_f32_t *hrv, float *lf, float *hf, float *ratio)
+{
+    if (hrv->work == NULL) {
+        return ESP_ERR_DSP_UNINITIALIZED;
+    }
+    int32_t n = hrv->count;
+    float duration = hrv->sum * 0.001f;
+    if ((n < 2) || (duration * DSPS_HRV_LF_MIN < 1.0f)) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    float mean = (float)hrv->sum / n;
+    float *wr = hrv->work;          // cos(w * t)
+    float *wi = &wr[n];             // sin(w * t)
+    float *wpr = &wr[2 * n];        // cos(dw * t)
+    float *wpi = &wr[3 * n];        // sin(dw * t)
+
+    // Beat times from the start of the window, first frequency in the middle of the first step
+    float w0 = 2 * (float)M_PI * (DSPS_HRV_LF_MIN + DSPS_HRV_DF / 2);
+    float dw = 2 * (float)M_PI * DSPS_HRV_DF;
+    int32_t first = (hrv->pos + hrv->len - n) % hrv->len;
+    float t = 0;
+    for (int i = 0; i < n; i++) {
+        t += hrv->rr[(first + i) % hrv->len] * 0.001f;
+        wr[i] = cosf(w0 * t);
+        wi[i] = sinf(w0 * t);
+        wpr[i] = cosf(dw * t);
+        wpi[i] = sinf(dw * t);
+    }
+
+    int steps_lf = (int)((DSPS_HRV_LF_MAX - DSPS_HRV_LF_MIN) / DSPS_HRV_DF + 0.5f);
+    int steps = (int)((DSPS_HRV_HF_MAX - DSPS_HRV_LF_MIN) / DSPS_HRV_DF + 0.5f);
+    float p_lf = 0;
+    float p_hf = 0;
+    for (int k = 0; k < steps; k++) {
+        // Time offset tau makes sine and cosine terms orthogonal
+        float s2 = 0, c2 = 0;
+        for (int i = 0; i < n; i++) {
+            s2 += 2 * wi[i] * wr[i];
+            c2 += (wr[i] - wi[i]) * (wr[i] + wi[i]);
+        }
+        float wtau = 0.5f * atan2f(s2, c2);
+        float cwtau = cosf(wtau);
+        float swtau = sinf(wtau);
+        float sc = 0, ss = 0, scy = 0, ssy = 0;
+        for (int i = 0; i < n; i++) {
+            float y = hrv->rr[(first + i) % hrv->len] - mean;
+            float c = wr[i] * cwtau + wi[i] * swtau;
+            float s = wi[i] * cwtau - wr[i] * swtau;
+            sc += c * c;
+            ss += s * s;
+            scy += c * y;
+            ssy += s * y;
+            // Next frequency
+            float r = wr[i];
+            wr[i] = r * wpr[i] - wi[i] * wpi[i];
+            wi[i] = wi[i] * wpr[i] + r * wpi[i];
+        }
+        float p = 0;
+        if (sc > 0) {
+            p += scy * scy / sc;
+        }
+        if (ss > 0) {
+            p += ssy * ssy / ss;
+        }
+        if (k < steps_lf) {
+            p_lf += p;
+        } else {
+            p_hf += p;
+        }
+    }
+    // Periodogram 0.5 * p to power spectral density 2 * 0.5 * p * mean interval, integrated over the band
+    float scale = duration / n * DSPS_HRV_DF;
+    if (lf) {
+        *lf = p_lf * scale;
+    }
+    if (hf) {
+        *hf = p_hf * scale;
+    }
+    if (ratio) {
+        *ratio = p_hf > 0 ? p_lf / p_hf : 0;
+    }
+    return ESP_OK;
+}
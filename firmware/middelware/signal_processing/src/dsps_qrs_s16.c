@@ -0,0 +1,191 @@
+/**
+ * @file dsps_qrs_s16.c
+ * @brief Fixed-point Pan-Tompkins QRS detector with adaptive thresholds and search back
+ */
+
+#include "dsps_qrs.h"
+#include <string.h>
+
+#define QRS_BP_MASK (DSPS_QRS_BP_LEN - 1)
+
+esp_err_t dsps_qrs_init_s16(qrs_s16_t *qrs, int32_t sample_freq, int input_bits)
+{
+    if (qrs == NULL) {
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    if ((sample_freq < DSPS_QRS_FS_MIN) || (sample_freq > DSPS_QRS_FS_MAX) || (input_bits < 8) || (input_bits > 16)) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    memset(qrs, 0, sizeof(qrs_s16_t));
+    qrs->fs = sample_freq;
+    // Full scale derivative is about 2^(input_bits + 8), it is scaled to 15 bits
+    qrs->shift = input_bits > 7 ? input_bits - 7 : 0;
+    qrs->mwi_len = sample_freq * 150 / 1000;
+    qrs->learn = 2 * sample_freq;
+    qrs->last_qrs = -1;
+    qrs->last_r = -1;
+    return ESP_OK;
+}
+
+// Maximum of the band pass signal in the integration window of the peak, corrected by the filter delay
+static int32_t qrs_r_peak(qrs_s16_t *qrs, int32_t peak_n)
+{
+    int32_t start = peak_n - qrs->mwi_len - 2;
+    if (start <= qrs->n - DSPS_QRS_BP_LEN) {
+        start = qrs->n - DSPS_QRS_BP_LEN + 1;
+    }
+    int32_t r = peak_n;
+    int32_t max = -1;
+    for (int32_t k = start; k <= peak_n; k++) {
+        int32_t v = qrs->bp[k & QRS_BP_MASK];
+        v = v < 0 ? -v : v;
+        if (v > max) {
+            max = v;
+            r = k;
+        }
+    }
+    return r - DSPS_QRS_DELAY;
+}
+
+static void qrs_beat(qrs_s16_t *qrs, int32_t peak_n, int32_t slope, int32_t r, qrs_beat_t *beat)
+{
+    beat->r_peak = r;
+    beat->rr_ms = 0;
+    if (qrs->last_r >= 0) {
+        int32_t rr = r - qrs->last_r;
+        beat->rr_ms = rr * 1000 / qrs->fs;
+        qrs->rr_sum += rr - qrs->rr[qrs->rr_pos];
+        qrs->rr[qrs->rr_pos] = rr;
+        qrs->rr_pos = (qrs->rr_pos + 1) % DSPS_QRS_RR_LEN;
+        if (qrs->rr_count < DSPS_QRS_RR_LEN) {
+            qrs->rr_count++;
+        }
+    }
+    qrs->last_qrs = peak_n;
+    qrs->last_slope = slope;
+    qrs->last_r = r;
+    qrs->sb_peak = 0;
+}
+
+static void qrs_peak(qrs_s16_t *qrs, uint32_t peak, int32_t peak_n, int32_t slope, qrs_beat_t *beat, int *found)
+{
+    int32_t since = qrs->last_qrs < 0 ? INT32_MAX : peak_n - qrs->last_qrs;
+    if (since < qrs->fs / 5) {
+        // Refractory period 200 ms
+        return;
+    }
+    // Slope of the T-wave is less than half of the slope of the QRS complex
+    int t_wave = (since < qrs->fs * 36 / 100) && (slope < qrs->last_slope / 2);
+    if ((peak > qrs->thr1) && !t_wave) {
+        qrs->spki = qrs->spki - (qrs->spki >> 3) + (peak >> 3);
+        qrs_beat(qrs, peak_n, slope, qrs_r_peak(qrs, peak_n), beat);
+        *found = 1;
+    } else {
+        qrs->npki = qrs->npki - (qrs->npki >> 3) + (peak >> 3);
+        if (!t_wave && (peak > qrs->thr1 / 2) && (peak > qrs->sb_peak)) {
+            qrs->sb_peak = peak;
+            qrs->sb_n = peak_n;
+            qrs->sb_slope = slope;
+            qrs->sb_r = qrs_r_peak(qrs, peak_n);
+        }
+    }
+    qrs->thr1 = qrs->npki + ((qrs->spki - qrs->npki) >> 2);
+}
+
+static inline int qrs_sample(qrs_s16_t *qrs, int32_t x, qrs_beat_t *beat)
+{
+    int32_t n = qrs->n;
+    int found = 0;
+
+    // Low pass: y(n) = 2y(n-1) - y(n-2) + x(n) - 2x(n-6) + x(n-12), gain 36, delay 5
+    int32_t lp = 2 * qrs->lp_y[0] - qrs->lp_y[1] + x - 2 * qrs->lp_x[(n - 6) & 15] + qrs->lp_x[(n - 12) & 15];
+    qrs->lp_x[n & 15] = x;
+    qrs->lp_y[1] = qrs->lp_y[0];
+    qrs->lp_y[0] = lp;
+
+    // High pass: y(n) = 32x(n-16) - sum(x(n-31)..x(n)), gain 32, delay 16
+    qrs->hp_sum += lp - qrs->hp_x[n & 31];
+    qrs->hp_x[n & 31] = lp;
+    int32_t bp = 32 * qrs->hp_x[(n - 16) & 31] - qrs->hp_sum;
+    qrs->bp[n & QRS_BP_MASK] = bp;
+
+    // Derivative: y(n) = (2x(n) + x(n-1) - x(n-3) - 2x(n-4)) / 8
+    int32_t d = (2 * bp + qrs->d_x[(n - 1) & 3] - qrs->d_x[(n - 3) & 3] - 2 * qrs->d_x[n & 3]) >> 3;
+    qrs->d_x[n & 3] = bp;
+    d >>= qrs->shift;
+    d = d < 0 ? -d : d;
+    d = d > INT16_MAX ? INT16_MAX : d;
+
+    // Squaring and moving window integration
+    uint32_t sq = ((uint32_t)d * (uint32_t)d) >> 6;
+    qrs->mwi_sum += sq - qrs->mwi_x[qrs->mwi_pos];
+    qrs->mwi_x[qrs->mwi_pos] = sq;
+    if (++qrs->mwi_pos >= qrs->mwi_len) {
+        qrs->mwi_pos = 0;
+    }
+    uint32_t mwi = qrs->mwi_sum;
+
+    // Peak of the integral: maximum after the rise, confirmed when the integral falls below half of it
+    if (d > qrs->slope) {
+        qrs->slope = d;
+    }
+    int peak_found = 0;
+    if (qrs->falling) {
+        if (mwi > qrs->mwi_prev) {
+            qrs->falling = 0;
+            qrs->peak = 0;
+        }
+    }
+    if (!qrs->falling) {
+        if (mwi > qrs->peak) {
+            qrs->peak = mwi;
+            qrs->peak_n = n;
+            qrs->peak_slope = qrs->slope;
+        } else if (mwi < qrs->peak / 2) {
+            qrs->falling = 1;
+            peak_found = 1;
+        }
+    }
+    qrs->mwi_prev = mwi;
+
+    if (qrs->learn > 0) {
+        // Initial thresholds from the first 2 seconds
+        if (mwi > qrs->spki) {
+            qrs->spki = mwi;
+        }
+        qrs->npki += ((int32_t)(mwi - qrs->npki)) >> 6;
+        if (--qrs->learn == 0) {
+            qrs->spki /= 3;
+            qrs->npki /= 2;
+            qrs->thr1 = qrs->npki + ((qrs->spki - qrs->npki) >> 2);
+        }
+    } else {
+        if (peak_found) {
+            qrs_peak(qrs, qrs->peak, qrs->peak_n, qrs->peak_slope, beat, &found);
+        }
+        // Search back for the missed beat after 166% of the average RR interval
+        if (!found && qrs->sb_peak && qrs->rr_count && ((n - qrs->last_qrs) * qrs->rr_count > qrs->rr_sum * 166 / 100)) {
+            qrs->spki = qrs->spki - (qrs->spki >> 2) + (qrs->sb_peak >> 2);
+            qrs->thr1 = qrs->npki + ((qrs->spki - qrs->npki) >> 2);
+            qrs_beat(qrs, qrs->sb_n, qrs->sb_slope, qrs->sb_r, beat);
+            found = 1;
+        }
+    }
+    if (peak_found) {
+        qrs->slope = 0;
+    }
+    qrs->n++;
+    return found;
+}
+
+int dsps_qrs_s16(qrs_s16_t *qrs, const int16_t *input, int len, qrs_beat_t *beats, int max_beats)
+{
+    qrs_beat_t beat;
+    int count = 0;
+    for (int i = 0; i < len; i++) {
+        if (qrs_sample(qrs, input[i], &beat) && (count < max_beats)) {
+            beats[count++] = beat;
+        }
+    }
+    return count;
+}
@@ -0,0 +1,263 @@
+#!/usr/bin/env python3
+"""
+Generator of test_ecg_records.c for the QRS detector replay tests
+
+The script always writes the synthetic records: one recorded beat (the ecg[] signal of
+ej_lcdcolor_ecg, 250 Hz) placed at known R-peak positions with RR variability, baseline wander,
+mains interference and noise.
+
+Real records could be added from text files, for example exported from PhysioNet by
+"rdsamp -r mitdb/100 -c -p -s 0 > 100.csv" and "rdann -r mitdb/100 -a atr > 100.ann":
+    gen_ecg_records.py --fs 360 --record 100.csv 100.ann [--record ...]
+The first numeric column after the time of the csv file is used, ADC values are scaled to 12 bits.
+Only normal and ectopic beat annotations (N, L, R, A, V, ...) are used.
+
+The mitdb208 record of the tests is the excerpt from 240 s to 300 s of scipy/misc/ecg.dat, the
+5 minutes of MIT-BIH record 208 (lead MLII, 360 Hz, 11 bit) of scipy.misc.electrocardiogram()
+in scipy 1.10:
+    gen_ecg_records.py --scipy-ecg ecg.dat
+That file has no annotations. The reference R peaks are found offline by reference_beats(), a
+non-causal detector (zero-phase band pass, centered energy window, largest deviation from the
+baseline around each QRS), and were checked by eye on plots of the excerpt: every normal beat
+and every premature ventricular beat is marked once, at its peak.
+
+Usage:
+    gen_ecg_records.py [--fs 250] [--record signal.csv annotations.ann] [--scipy-ecg ecg.dat]
+                       [-o test_ecg_records.c]
+"""
+
+import argparse
+import math
+import random
+import struct
+import zipfile
+
+# One beat of ej_lcdcolor_ecg, 250 Hz, R peak at sample 146
+BEAT = [
+    76, 76, 77, 77, 76, 83, 85, 78, 76, 85, 93, 85, 79, 86, 93, 93, 85, 87, 94, 98, 93, 87, 95, 104, 99, 91,
+    93, 102, 104, 99, 96, 101, 106, 102, 96, 97, 104, 106, 97, 94, 100, 103, 101, 91, 95, 103, 100, 94, 90, 98,
+    104, 94, 87, 93, 99, 97, 87, 86, 96, 98, 90, 83, 90, 96, 89, 81, 80, 87, 92, 82, 78, 84, 89, 80, 72, 78, 82,
+    82, 73, 72, 81, 82, 79, 69, 77, 82, 81, 76, 68, 78, 80, 76, 73, 78, 82, 82, 75, 72, 86, 84, 78, 76, 85, 95,
+    88, 81, 83, 93, 90, 86, 83, 88, 93, 86, 82, 82, 92, 89, 82, 82, 88, 94, 84, 82, 90, 98, 94, 87, 91, 95, 98,
+    93, 90, 97, 104, 105, 96, 93, 107, 116, 118, 127, 148, 181, 208, 231, 252, 241, 198, 139, 76, 43, 32, 29,
+    42, 65, 86, 90, 88, 93, 101, 107, 102, 98, 103, 110, 104, 98, 99, 107, 109, 96, 95, 103, 107, 102, 95, 95,
+    102, 105, 94, 94, 102, 102, 99, 94, 96, 102, 99, 90, 92, 100, 102, 95, 90, 98, 104, 97, 89, 94, 102, 103, 97,
+    93, 100, 105, 102, 93, 97, 104, 104, 100, 96, 108, 111, 104, 99, 101, 108, 102, 96, 97, 104, 104, 97, 89, 91,
+    100, 91, 81, 79, 85, 86, 73, 69, 75, 79, 75, 68, 68, 76, 76, 69, 67, 74, 81, 77, 71, 72, 82, 82, 76, 77, 76,
+    76, 75,
+]
+BEAT_R = 146
+FS = 250
+GAIN = 8            # ADC counts per unit of BEAT
+OFFSET = 2048       # 12 bit ADC
+
+
+def beat_shape():
+    base = sorted(BEAT)[len(BEAT) // 2]
+    taper = 24
+    shape = []
+    for i, v in enumerate(BEAT):
+        w = 1.0
+        if i < taper:
+            w = 0.5 - 0.5 * math.cos(math.pi * i / taper)
+        elif i >= len(BEAT) - taper:
+            w = 0.5 - 0.5 * math.cos(math.pi * (len(BEAT) - 1 - i) / taper)
+        shape.append((v - base) * w)
+    return shape
+
+
+def synth(name, seconds, rr_func, ampl_func, wander, mains, noise, seed):
+    rnd = random.Random(seed)
+    n = seconds * FS
+    x = [0.0] * n
+    shape = beat_shape()
+    ann = []
+    t = 0.4 * FS
+    k = 0
+    while True:
+        r = int(round(t))
+        if r + len(shape) - BEAT_R >= n:
+            break
+        ann.append(r)
+        a = ampl_func(k, t / FS)
+        for i, v in enumerate(shape):
+            j = r - BEAT_R + i
+            if 0 <= j < n:
+                x[j] += a * v
+        t += rr_func(k, t / FS, rnd) * FS
+        k += 1
+    data = []
+    for i in range(n):
+        s = i / FS
+        v = x[i] * GAIN
+        v += wander * math.sin(2 * math.pi * 0.3 * s) + 0.5 * wander * math.sin(2 * math.pi * 0.05 * s + 1)
+        v += mains * math.sin(2 * math.pi * 50 * s)
+        v += rnd.gauss(0, noise)
+        data.append(max(0, min(4095, int(round(OFFSET + v)))))
+    return name, FS, data, ann, True
+
+
+def synth_records():
+    records = []
+    # Normal sinus rhythm 72 bpm with respiratory RR modulation
+    records.append(synth('nsr', 30,
+                         lambda k, s, rnd: 0.83 + 0.04 * math.sin(2 * math.pi * 0.25 * s) + rnd.gauss(0, 0.01),
+                         lambda k, s: 1.0, 150, 10, 6, 1))
+    # Heart rate from 50 to 130 bpm and back, amplitude modulated by breathing
+    records.append(synth('rate_change', 30,
+                         lambda k, s, rnd: 1.2 - 0.74 * math.sin(math.pi * s / 30) + rnd.gauss(0, 0.01),
+                         lambda k, s: 1.0 + 0.3 * math.sin(2 * math.pi * 0.2 * s), 250, 10, 8, 2))
+
+    # Noisy record with premature beats, compensatory pauses and low amplitude beats
+    def rr_ectopic(k, s, rnd):
+        if k % 9 == 4:
+            return 0.5
+        if k % 9 == 5:
+            return 1.2
+        return 0.9 + rnd.gauss(0, 0.03)
+    records.append(synth('ectopic_noise', 30, rr_ectopic,
+                         lambda k, s: 0.6 if k % 7 == 3 else 1.0, 400, 120, 25, 3))
+    return records
+
+
+def load_record(name, csv_name, ann_name, fs):
+    data = []
+    with open(csv_name) as f:
+        for line in f:
+            cols = line.replace(',', ' ').split()
+            try:
+                data.append(float(cols[1] if len(cols) > 1 else cols[0]))
+            except (ValueError, IndexError):
+                continue
+    lo, hi = min(data), max(data)
+    data = [int((v - lo) * 4095 / (hi - lo)) for v in data]
+    beats = set('NLRBAaJSVrFejnE/fQ')
+    ann = []
+    with open(ann_name) as f:
+        for line in f:
+            cols = line.split()
+            # rdann: time, sample, type, ...
+            if len(cols) > 2 and cols[1].isdigit() and cols[2] in beats:
+                ann.append(int(cols[1]))
+    return name, fs, data, ann, False
+
+
+def zero_phase_band_pass(x, fs, f0, q):
+    """Band pass biquad run forwards and backwards, no delay"""
+    w = 2 * math.pi * f0 / fs
+    alpha = math.sin(w) / (2 * q)
+    b0, b2 = alpha / (1 + alpha), -alpha / (1 + alpha)
+    a1, a2 = -2 * math.cos(w) / (1 + alpha), (1 - alpha) / (1 + alpha)
+
+    def run(x):
+        y = []
+        x1 = x2 = y1 = y2 = 0.0
+        for v in x:
+            o = b0 * v + b2 * x2 - a1 * y1 - a2 * y2
+            x2, x1, y2, y1 = x1, v, y1, o
+            y.append(o)
+        return y
+    return run(run(x)[::-1])[::-1]
+
+
+def centered_mean(x, width):
+    acc = [0.0]
+    for v in x:
+        acc.append(acc[-1] + v)
+    h = width // 2
+    return [(acc[min(len(x), i + h + 1)] - acc[max(0, i - h)]) / (min(len(x), i + h + 1) - max(0, i - h))
+            for i in range(len(x))]
+
+
+def reference_beats(x, fs):
+    """
+    Offline R peak reference for records without annotations. Unlike dsps_qrs_s16 it looks at the
+    samples after each beat: energy of the 5-20 Hz band in a centered 100 ms window, local maxima
+    over 8% of the 99th percentile of the surrounding 8 s, at least 250 ms apart. The R peak is
+    the sample with the largest deviation from the 600 ms baseline within 80 ms of the maximum,
+    so it is the top of the R wave of normal beats and of the wide QRS of ventricular beats.
+    """
+    bp = zero_phase_band_pass(x, fs, 12, 0.8)
+    energy = centered_mean([v * v for v in bp], int(0.1 * fs))
+    window = 8 * fs
+    peaks = []
+    for i in range(1, len(x) - 1):
+        if (energy[i] < energy[i - 1]) or (energy[i] <= energy[i + 1]):
+            continue
+        around = sorted(energy[max(0, i - window // 2):i + window // 2])
+        if energy[i] < 0.08 * around[int(len(around) * 0.99)]:
+            continue
+        if peaks and (i - peaks[-1] < 0.25 * fs):
+            if energy[i] > energy[peaks[-1]]:
+                peaks[-1] = i
+            continue
+        peaks.append(i)
+    base = centered_mean(x, int(0.6 * fs))
+    search = int(0.08 * fs)
+    return [max(range(max(0, p - search), min(len(x), p + search + 1)), key=lambda k: abs(x[k] - base[k]))
+            for p in peaks]
+
+
+def load_scipy_ecg(name, path, start, seconds):
+    """MIT-BIH record 208 from scipy/misc/ecg.dat, a numpy .npz file of 11 bit ADC values at 360 Hz"""
+    fs = 360
+    with zipfile.ZipFile(path) as z:
+        npy = z.read('ecg.npy')
+    header_len = struct.unpack('<H', npy[8:10])[0]
+    count = (len(npy) - 10 - header_len) // 2
+    raw = struct.unpack('<%iH' % count, npy[10 + header_len:])
+    raw = raw[start * fs:(start + seconds) * fs]
+    # 11 bit ADC of the MIT-BIH database, 200 counts/mV, to the 12 bit ADC of the tests
+    data = [2 * v for v in raw]
+    ann = reference_beats([float(v) for v in raw], fs)
+    return name, fs, data, ann, False
+
+
+def write_c(records, out):
+    lines = []
+    lines.append('/**')
+    lines.append(' * @file test_ecg_records.c')
+    lines.append(' * @brief Annotated ECG records for the QRS detector replay tests')
+    lines.append(' *')
+    lines.append(' * Generated by gen_ecg_records.py, do not edit.')
+    lines.append(' */')
+    lines.append('')
+    lines.append('#include "test_ecg_records.h"')
+    lines.append('')
+    for name, fs, data, ann, exact in records:
+        lines.append('static const int16_t %s_data[%i] = {' % (name, len(data)))
+        for i in range(0, len(data), 16):
+            lines.append('    ' + ', '.join('%i' % v for v in data[i:i + 16]) + ',')
+        lines.append('};')
+        lines.append('')
+        lines.append('static const int32_t %s_ann[%i] = {' % (name, len(ann)))
+        for i in range(0, len(ann), 12):
+            lines.append('    ' + ', '.join('%i' % v for v in ann[i:i + 12]) + ',')
+        lines.append('};')
+        lines.append('')
+    lines.append('const test_ecg_record_t test_ecg_records[TEST_ECG_RECORDS] = {')
+    for name, fs, data, ann, exact in records:
+        lines.append('    {"%s", %i, %s_data, %i, %s_ann, %i, %i},' % (name, fs, name, len(data), name, len(ann), exact))
+    lines.append('};')
+    with open(out, 'w') as f:
+        f.write('\n'.join(lines) + '\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generator of ECG records for QRS detector tests')
+    parser.add_argument('--fs', type=int, default=FS, help='sample frequency of the converted records')
+    parser.add_argument('--record', nargs=2, action='append', metavar=('CSV', 'ANN'), help='record to convert')
+    parser.add_argument('--scipy-ecg', metavar='ECG_DAT', help='scipy/misc/ecg.dat, MIT-BIH record 208')
+    parser.add_argument('-o', '--output', default='test_ecg_records.c', help='output file')
+    args = parser.parse_args()
+    records = synth_records()
+    if args.scipy_ecg:
+        records.append(load_scipy_ecg('mitdb208', args.scipy_ecg, 240, 60))
+    for i, (csv, ann) in enumerate(args.record or []):
+        records.append(load_record('record%i' % i, csv, ann, args.fs))
+    write_c(records, args.output)
+    print('%i records written to %s, update TEST_ECG_RECORDS if the number has changed' % (len(records), args.output))
+
+
+if __name__ == '__main__':
+    main()
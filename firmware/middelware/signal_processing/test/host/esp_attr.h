@@ -0,0 +1,13 @@
+/**
+ * @file esp_attr.h
+ * @brief Memory placement attributes, empty on the host
+ */
+
+#ifndef _esp_attr_H_
+#define _esp_attr_H_
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define DMA_ATTR
+
+#endif // _esp_attr_H_
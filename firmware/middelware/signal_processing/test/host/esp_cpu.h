@@ -0,0 +1,27 @@
+/**
+ * @file esp_cpu.h
+ * @brief CPU cycle counter for the host tests, derived from wall time
+ *
+ * The count is scaled to CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ, so budgets in
+ * cycles read as on the target. Host cycles are not target cycles: use them
+ * only to compare implementations with each other.
+ */
+
+#ifndef _esp_cpu_H_
+#define _esp_cpu_H_
+
+#include <stdint.h>
+#include <time.h>
+#include "sdkconfig.h"
+
+static inline uint32_t esp_cpu_get_cycle_count(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ * 1000000ULL + ts.tv_nsec * CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ / 1000);
+}
+
+// Used by the upstream esp-dsp tests
+#define xthal_get_ccount esp_cpu_get_cycle_count
+
+#endif // _esp_cpu_H_
@@ -0,0 +1,12 @@
+/**
+ * @file esp_idf_version.h
+ * @brief ESP-IDF version seen by esp-dsp in the host tests
+ */
+
+#ifndef _esp_idf_version_H_
+#define _esp_idf_version_H_
+
+#define ESP_IDF_VERSION_VAL(major, minor, patch) (((major) << 16) | ((minor) << 8) | (patch))
+#define ESP_IDF_VERSION ESP_IDF_VERSION_VAL(5, 1, 0)
+
+#endif // _esp_idf_version_H_
@@ -0,0 +1,17 @@
+/**
+ * @file esp_log.h
+ * @brief ESP-IDF log macros printing to stdout, for the host tests
+ */
+
+#ifndef _esp_log_H_
+#define _esp_log_H_
+
+#include <stdio.h>
+
+#define ESP_LOGE(tag, format, ...) printf("E %s: " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) printf("W %s: " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) printf("I %s: " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) do { } while (0)
+#define ESP_LOGV(tag, format, ...) do { } while (0)
+
+#endif // _esp_log_H_
@@ -0,0 +1,15 @@
+/**
+ * @file FreeRTOS.h
+ * @brief Critical sections of the esp-dsp benchmarks, empty on the host: the tests run in one thread
+ */
+
+#ifndef _FreeRTOS_H_
+#define _FreeRTOS_H_
+
+typedef int portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED    0
+#define portENTER_CRITICAL(mux)         ((void)(mux))
+#define portEXIT_CRITICAL(mux)          ((void)(mux))
+
+#endif // _FreeRTOS_H_
@@ -0,0 +1,4 @@
+/**
+ * @file portable.h
+ * @brief Empty on the host: dsp_platform.h includes it but the tests do not use it
+ */
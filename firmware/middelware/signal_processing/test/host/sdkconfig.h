@@ -0,0 +1,13 @@
+/**
+ * @file sdkconfig.h
+ * @brief Configuration of the host tests: ANSI C esp-dsp, ESP32-C6 clock
+ */
+
+#ifndef _sdkconfig_H_
+#define _sdkconfig_H_
+
+#define CONFIG_DSP_ANSI                     1
+#define CONFIG_DSP_MAX_FFT_SIZE             4096
+#define CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ     160
+
+#endif // _sdkconfig_H_
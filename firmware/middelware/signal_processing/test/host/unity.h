@@ -0,0 +1,62 @@
+/**
+ * @file unity.h
+ * @brief Subset of the Unity test macros to run the middleware tests on the host
+ *
+ * TEST_CASE() registers the test before main() runs, as the ESP-IDF unit
+ * test app does. A failed assertion ends the test case and unity_host.c
+ * runs the next one.
+ */
+
+#ifndef _unity_H_
+#define _unity_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+void unity_host_register(const char *name, void (*test)(void));
+void unity_host_fail(const char *file, int line, const char *msg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define UNITY_HOST_CAT_(a, b) a##b
+#define UNITY_HOST_CAT(a, b) UNITY_HOST_CAT_(a, b)
+
+#define TEST_CASE(name, tags) \
+    static void UNITY_HOST_CAT(test_case_, __LINE__)(void); \
+    __attribute__((constructor)) static void UNITY_HOST_CAT(test_case_register_, __LINE__)(void) \
+    { \
+        unity_host_register(name, UNITY_HOST_CAT(test_case_, __LINE__)); \
+    } \
+    static void UNITY_HOST_CAT(test_case_, __LINE__)(void)
+
+#define TEST_ASSERT_MESSAGE(cond, msg) do { if (!(cond)) { unity_host_fail(__FILE__, __LINE__, msg); } } while (0)
+#define TEST_ASSERT(cond) TEST_ASSERT_MESSAGE(cond, #cond)
+#define TEST_ASSERT_TRUE(cond) TEST_ASSERT_MESSAGE(cond, #cond)
+#define TEST_ASSERT_FALSE(cond) TEST_ASSERT_MESSAGE(!(cond), "!(" #cond ")")
+#define TEST_ASSERT_NULL(ptr) TEST_ASSERT_MESSAGE((ptr) == NULL, #ptr " == NULL")
+#define TEST_ASSERT_NOT_NULL(ptr) TEST_ASSERT_MESSAGE((ptr) != NULL, #ptr " != NULL")
+#define TEST_ASSERT_EQUAL(expected, actual) TEST_ASSERT_MESSAGE((expected) == (actual), #actual " == " #expected)
+#define TEST_ASSERT_NOT_EQUAL(expected, actual) TEST_ASSERT_MESSAGE((expected) != (actual), #actual " != " #expected)
+#define TEST_ASSERT_EQUAL_INT(expected, actual) TEST_ASSERT_EQUAL(expected, actual)
+#define TEST_ASSERT_EQUAL_PTR(expected, actual) TEST_ASSERT_MESSAGE((const void *)(expected) == (const void *)(actual), #actual " == " #expected)
+#define TEST_ASSERT_LESS_THAN(threshold, actual) TEST_ASSERT_MESSAGE((actual) < (threshold), #actual " < " #threshold)
+#define TEST_ASSERT_LESS_OR_EQUAL(threshold, actual) TEST_ASSERT_MESSAGE((actual) <= (threshold), #actual " <= " #threshold)
+#define TEST_ASSERT_GREATER_THAN(threshold, actual) TEST_ASSERT_MESSAGE((actual) > (threshold), #actual " > " #threshold)
+#define TEST_ASSERT_GREATER_OR_EQUAL(threshold, actual) TEST_ASSERT_MESSAGE((actual) >= (threshold), #actual " >= " #threshold)
+#define TEST_ASSERT_INT_WITHIN(delta, expected, actual) TEST_ASSERT_MESSAGE(labs((long)(expected) - (long)(actual)) <= (long)(delta), #actual " within " #delta " of " #expected)
+#define TEST_ASSERT_FLOAT_WITHIN(delta, expected, actual) TEST_ASSERT_MESSAGE(fabs((double)(expected) - (double)(actual)) <= (double)(delta), #actual " within " #delta " of " #expected)
+#define TEST_ASSERT_EQUAL_FLOAT(expected, actual) TEST_ASSERT_FLOAT_WITHIN(1e-5 * fabs((double)(expected)), expected, actual)
+#define TEST_ESP_OK(rc) TEST_ASSERT_MESSAGE((rc) == ESP_OK, #rc " == ESP_OK")
+
+#endif // _unity_H_
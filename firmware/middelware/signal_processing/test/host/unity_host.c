@@ -0,0 +1,58 @@
+/**
+ * @file unity_host.c
+ * @brief Runs the test cases registered by TEST_CASE() on the host
+ *
+ * Test cases with "benchmark" in the name assert cycle counts of the target,
+ * so they only run when HOST_TEST_BENCHMARK is set in the environment.
+ */
+
+#include <setjmp.h>
+#include "unity.h"
+
+#define UNITY_HOST_TESTS_MAX    128
+
+typedef struct unity_host_test_s {
+    const char *name;
+    void (*test)(void);
+} unity_host_test_t;
+
+static unity_host_test_t tests[UNITY_HOST_TESTS_MAX];
+static int tests_count = 0;
+static jmp_buf test_abort;
+
+void unity_host_register(const char *name, void (*test)(void))
+{
+    if (tests_count < UNITY_HOST_TESTS_MAX) {
+        tests[tests_count].name = name;
+        tests[tests_count].test = test;
+        tests_count++;
+    }
+}
+
+void unity_host_fail(const char *file, int line, const char *msg)
+{
+    printf("%s:%d: FAIL: %s\n", file, line, msg);
+    longjmp(test_abort, 1);
+}
+
+int main(void)
+{
+    int failed = 0;
+    int run = 0;
+    int benchmark = (getenv("HOST_TEST_BENCHMARK") != NULL);
+    for (int i = 0 ; i < tests_count ; i++) {
+        if (!benchmark && strstr(tests[i].name, "benchmark")) {
+            printf("Skipping %s\n", tests[i].name);
+            continue;
+        }
+        run++;
+        printf("Running %s...\n", tests[i].name);
+        if (setjmp(test_abort) == 0) {
+            tests[i].test();
+        } else {
+            failed++;
+        }
+    }
+    printf("%d Tests %d Failures\n", run, failed);
+    return failed;
+}
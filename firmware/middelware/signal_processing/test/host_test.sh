@@ -0,0 +1,46 @@
+#!/bin/sh
+# Builds the given middleware test files with the ANSI C code of esp-dsp and src
+# runs them on the host. The headers in test/host replace ESP-IDF and Unity.
+#
+# Usage, from firmware/middelware/signal_processing:
+#
+#     test/host_test.sh esp-dsp/modules/kalman/ekf_imu13states/test/test_ekf_imu13states.cpp \
+#         esp-dsp/modules/kalman/test/test_imu_log.c esp-dsp/modules/kalman/test/test_imu_replay.c
+#
+# The exit code is the number of failed test cases. The benchmarks only run
+# with HOST_TEST_BENCHMARK=1, the host cycle counts are not the ones of the
+# target.
+
+CC=${CC:-cc}
+CXX=${CXX:-c++}
+CFLAGS="-O2 -Wall -Wno-unused-function -Wno-unused-variable -Wno-sign-compare"
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+BUILD=$(mktemp -d)
+trap 'rm -rf "$BUILD"' EXIT
+
+INC="-I$ROOT/test/host -I$ROOT/test/include -I$ROOT/inc"
+for dir in $(find "$ROOT/esp-dsp/modules" -type d -name include | sort); do
+    INC="$INC -I$dir"
+done
+
+compile() {
+    obj="$BUILD/$(echo "$1" | tr '/' '_').o"
+    case "$1" in
+        *.cpp) $CXX $CFLAGS -std=gnu++17 $INC -c "$1" -o "$obj" || exit 1 ;;
+        *) $CC $CFLAGS -std=gnu11 $INC -c "$1" -o "$obj" || exit 1 ;;
+    esac
+}
+
+# Library: every ANSI C source of esp-dsp and of src, no assembler and no tests
+for src in $(find "$ROOT/esp-dsp/modules" -name '*.c' -o -name '*.cpp' | grep -v -e /test/ -e /test_sim/ -e _ae32 -e _aes3 -e _arp4 | sort) \
+        "$ROOT"/src/*.c; do
+    compile "$src"
+done
+ar rcs "$BUILD/libdsp.a" "$BUILD"/*.o
+rm "$BUILD"/*.o
+
+for src in "$ROOT/test/host/unity_host.c" "$@"; do
+    compile "$src"
+done
+$CXX "$BUILD"/*.o "$BUILD/libdsp.a" -lm -o "$BUILD/test" || exit 1
+"$BUILD/test"
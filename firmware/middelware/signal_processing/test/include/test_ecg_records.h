@@ -0,0 +1,54 @@
+/**
+ * @file test_ecg_records.h
+ * @brief Annotated ECG records for replay tests of beat detectors
+ */
+
+#ifndef _test_ecg_records_H_
+#define _test_ecg_records_H_
+
+#include <stdint.h>
+
+/**
+ * Annotated ECG records for replay tests of beat detectors, generated by gen_ecg_records.py, with 12 bit
+ * ADC values. The first records place the recorded beat of the ej_lcdcolor_ecg example at known R-peak
+ * positions, at 250 Hz:
+ *  - nsr: sinus rhythm 72 bpm with respiratory RR modulation, baseline wander and noise
+ *  - rate_change: heart rate from 50 to 130 bpm and back, amplitude modulation by breathing
+ *  - ectopic_noise: premature beats with compensatory pauses, low amplitude beats,
+ *    strong baseline wander, 50 Hz interference and noise
+ * The last one is a real recording:
+ *  - mitdb208: 60 s of MIT-BIH record 208, lead MLII, 360 Hz, sinus rhythm with frequent premature
+ *    ventricular beats. The copy shipped with scipy has no annotations: the reference R peaks come
+ *    from the offline non-causal detector of gen_ecg_records.py, checked by eye, not from the
+ *    cardiologist annotations of the database.
+ * The same script converts other real records, for example from PhysioNet, to this format.
+ */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define TEST_ECG_RECORDS    4
+
+/**
+ * Annotated record
+ */
+typedef struct test_ecg_record_s {
+    const char     *name;       /*!< Name of the record.*/
+    int32_t         fs;         /*!< Sample frequency, Hz.*/
+    const int16_t  *data;       /*!< ADC values.*/
+    int32_t         len;        /*!< Number of samples.*/
+    const int32_t  *ann;        /*!< Sample indexes of R peaks.*/
+    int32_t         ann_len;    /*!< Number of annotated beats.*/
+    int32_t         exact;      /*!< Annotations are the exact R peak samples of one beat shape. Otherwise
+                                     the fiducial point of the annotations differs between beat shapes.*/
+} test_ecg_record_t;
+
+extern const test_ecg_record_t test_ecg_records[TEST_ECG_RECORDS];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _test_ecg_records_H_
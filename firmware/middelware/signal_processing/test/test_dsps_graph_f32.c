@@ -0,0 +1,264 @@
+/**
+ * @file test_dsps_graph_f32.c
+ * @brief Buffer planning and output tests of the block processing graph
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "unity.h"
+#include "esp_dsp.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dsps_graph.h"
+#include "dsps_biquad.h"
+#include "dsps_biquad_gen.h"
+#include "dsps_fir.h"
+#include "dsps_fft2r.h"
+#include "dsps_wind.h"
+#include "dsp_tests.h"
+
+static const char *TAG = "dsps_graph_f32";
+
+// The test uses only ANSI C processing and could be run on the host with the same graph as on the target
+
+#define TEST_GRAPH_BLOCK    256
+#define TEST_GRAPH_FS       500.0f
+#define TEST_GRAPH_BEAT     100     // Pulse every 100 samples
+#define TEST_GRAPH_FIR_N    16
+#define TEST_GRAPH_DECIM    2
+#define TEST_GRAPH_MAX      1024
+
+typedef struct test_graph_chain_s {
+    float hp_coef[5];
+    float hp_w[2];
+    float lp_coef[5];
+    float lp_w[2];
+    float fir_coeffs[TEST_GRAPH_FIR_N];
+    float fir_delay[TEST_GRAPH_FIR_N];
+    fir_f32_t fir;
+    int spectrum;
+    int peaks;
+} test_graph_chain_t;
+
+static float input[TEST_GRAPH_BLOCK];
+static float wind[TEST_GRAPH_MAX / TEST_GRAPH_DECIM];
+
+// Hand wired processing, same as in the examples
+static float ref_filt[TEST_GRAPH_BLOCK];
+static float ref_decim[TEST_GRAPH_BLOCK / TEST_GRAPH_DECIM];
+static float ref_fft[TEST_GRAPH_BLOCK];
+static float ref_mag[TEST_GRAPH_BLOCK / TEST_GRAPH_DECIM / 2];
+
+static void test_graph_chain_init(test_graph_chain_t *chain)
+{
+    memset(chain, 0, sizeof(test_graph_chain_t));
+    dsps_biquad_gen_hpf_f32(chain->hp_coef, 0.5f / TEST_GRAPH_FS, 0.707f);
+    dsps_biquad_gen_lpf_f32(chain->lp_coef, 40.0f / TEST_GRAPH_FS, 0.707f);
+    for (int i = 0 ; i < TEST_GRAPH_FIR_N ; i++) {
+        chain->fir_coeffs[i] = 1.0f / TEST_GRAPH_FIR_N;
+    }
+    dsps_fird_init_f32(&chain->fir, chain->fir_coeffs, chain->fir_delay, TEST_GRAPH_FIR_N, TEST_GRAPH_DECIM);
+}
+
+static void test_graph_block(int block)
+{
+    for (int i = 0 ; i < TEST_GRAPH_BLOCK ; i++) {
+        int n = block * TEST_GRAPH_BLOCK + i;
+        float d = (n % TEST_GRAPH_BEAT) - TEST_GRAPH_BEAT / 2;
+        input[i] = expf(-d * d / 8.0f) + 0.1f * sinf(2 * M_PI * 50 * n / TEST_GRAPH_FS);
+    }
+}
+
+static void test_graph_reference(test_graph_chain_t *chain)
+{
+    int len = TEST_GRAPH_BLOCK / TEST_GRAPH_DECIM;
+    dsps_biquad_f32(input, ref_filt, TEST_GRAPH_BLOCK, chain->hp_coef, chain->hp_w);
+    dsps_biquad_f32(ref_filt, ref_filt, TEST_GRAPH_BLOCK, chain->lp_coef, chain->lp_w);
+    dsps_fird_f32(&chain->fir, ref_filt, ref_decim, len);
+    memset(ref_fft, 0, sizeof(ref_fft));
+    dsps_mul_f32(ref_decim, wind, ref_fft, len, 1, 1, 2);
+    dsps_fft2r_fc32(ref_fft, len);
+    dsps_bit_rev_fc32(ref_fft, len);
+    dsps_cplx2reC_fc32(ref_fft, len);
+    for (int i = 0 ; i < len / 2 ; i++) {
+        ref_mag[i] = 2 * sqrtf(ref_fft[i * 2] * ref_fft[i * 2] + ref_fft[i * 2 + 1] * ref_fft[i * 2 + 1]) / (len / 2);
+    }
+    ref_mag[0] /= 2;
+}
+
+static esp_err_t test_graph_build(graph_f32_t *graph, int32_t block_len, void *ctx)
+{
+    test_graph_chain_t *chain = (test_graph_chain_t *)ctx;
+    int hp, lp, decim, env;
+    esp_err_t ret = dsps_graph_init_f32(graph, block_len);
+    ret = ret != ESP_OK ? ret : dsps_graph_biquad_f32(graph, 0, chain->hp_coef, chain->hp_w, &hp);
+    ret = ret != ESP_OK ? ret : dsps_graph_biquad_f32(graph, hp, chain->lp_coef, chain->lp_w, &lp);
+    ret = ret != ESP_OK ? ret : dsps_graph_fird_f32(graph, lp, &chain->fir, &decim);
+    if ((ret == ESP_OK) && (block_len <= TEST_GRAPH_MAX)) {
+        dsps_wind_hann_f32(wind, block_len / TEST_GRAPH_DECIM);
+    }
+    ret = ret != ESP_OK ? ret : dsps_graph_fft_f32(graph, decim, wind, &chain->spectrum);
+    ret = ret != ESP_OK ? ret : dsps_graph_envelope_f32(graph, lp, 0.5f, &env);
+    ret = ret != ESP_OK ? ret : dsps_graph_peak_f32(graph, env, 0.2f, TEST_GRAPH_BEAT / 2, &chain->peaks);
+    ret = ret != ESP_OK ? ret : dsps_graph_output_f32(graph, chain->spectrum);
+    ret = ret != ESP_OK ? ret : dsps_graph_output_f32(graph, chain->peaks);
+    return ret;
+}
+
+TEST_CASE("dsps_graph_f32 functionality", "[dsps]")
+{
+    static graph_f32_t graph;
+    static test_graph_chain_t chain, ref_chain;
+
+    TEST_ESP_OK(dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE));
+    test_graph_chain_init(&chain);
+    test_graph_chain_init(&ref_chain);
+    TEST_ESP_OK(test_graph_build(&graph, TEST_GRAPH_BLOCK, &chain));
+    TEST_ESP_OK(dsps_graph_compile_f32(&graph, NULL));
+    int spectrum = chain.spectrum;
+    int peaks = chain.peaks;
+
+    // Both filters and the envelope use one block, the peak events reuse the FFT work buffer
+    ESP_LOGI(TAG, "pool %i words, without reuse %i words", (int)graph.pool_len, (int)graph.total_len);
+    TEST_ASSERT_EQUAL(TEST_GRAPH_BLOCK + TEST_GRAPH_BLOCK / 2 + TEST_GRAPH_BLOCK + TEST_GRAPH_BLOCK / 4, graph.pool_len);
+    TEST_ASSERT_EQUAL(graph.port[1].offset, graph.port[2].offset);
+    TEST_ASSERT_EQUAL(graph.port[1].offset, graph.port[6].offset);
+    TEST_ASSERT_EQUAL(graph.port[spectrum + 1].offset, graph.port[peaks].offset);
+    TEST_ASSERT_LESS_THAN(graph.total_len, graph.pool_len);
+
+    int32_t last_peak = -1;
+    int peak_count = 0;
+    for (int b = 0 ; b < 16 ; b++) {
+        test_graph_block(b);
+        TEST_ESP_OK(dsps_graph_run_f32(&graph, input));
+        test_graph_reference(&ref_chain);
+        float *mag = (float *)dsps_graph_data_f32(&graph, spectrum);
+        for (int i = 0 ; i < TEST_GRAPH_BLOCK / TEST_GRAPH_DECIM / 2 ; i++) {
+            TEST_ASSERT_FLOAT_WITHIN(1e-5, ref_mag[i], mag[i]);
+        }
+        int32_t *events = (int32_t *)dsps_graph_data_f32(&graph, peaks);
+        // Skip the step response of the high pass filter
+        if (b == 0) {
+            continue;
+        }
+        for (int i = 0 ; i < events[0] ; i++) {
+            // Pulses are in the middle of the period, delayed by the filters
+            if (last_peak >= 0) {
+                TEST_ASSERT_INT_WITHIN(2, TEST_GRAPH_BEAT, events[1 + i] - last_peak);
+            }
+            last_peak = events[1 + i];
+            peak_count++;
+        }
+    }
+    TEST_ASSERT_INT_WITHIN(1, 15 * TEST_GRAPH_BLOCK / TEST_GRAPH_BEAT, peak_count);
+    dsps_graph_free_f32(&graph);
+    dsps_graph_free_f32(&graph);
+    dsps_graph_free_f32(NULL);
+    dsps_fft2r_deinit_fc32();
+}
+
+TEST_CASE("dsps_graph_f32 parameters", "[dsps]")
+{
+    static graph_f32_t graph;
+    static test_graph_chain_t chain;
+    int hp, decim, spectrum, peaks, out;
+
+    test_graph_chain_init(&chain);
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_LENGTH, dsps_graph_init_f32(&graph, 0));
+    TEST_ESP_OK(dsps_graph_init_f32(&graph, 96));
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_UNINITIALIZED, dsps_graph_compile_f32(&graph, NULL));
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_PARAM, dsps_graph_biquad_f32(&graph, 1, chain.hp_coef, chain.hp_w, &out));
+    TEST_ESP_OK(dsps_graph_biquad_f32(&graph, 0, chain.hp_coef, chain.hp_w, &hp));
+    // 96 is not a power of 2, 96 / 2 is not divisible by 5
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_LENGTH, dsps_graph_fft_f32(&graph, hp, NULL, &spectrum));
+    chain.fir.decim = 5;
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_LENGTH, dsps_graph_fird_f32(&graph, hp, &chain.fir, &decim));
+    // Events could not be filtered
+    TEST_ESP_OK(dsps_graph_peak_f32(&graph, hp, 0, 10, &peaks));
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_PARAM, dsps_graph_biquad_f32(&graph, peaks, chain.lp_coef, chain.lp_w, &out));
+    for (int i = graph.nodes ; i < DSPS_GRAPH_NODES_MAX ; i++) {
+        TEST_ESP_OK(dsps_graph_envelope_f32(&graph, hp, 0.1f, &out));
+    }
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_PARAM_OUTOFRANGE, dsps_graph_envelope_f32(&graph, hp, 0.1f, &out));
+    TEST_ESP_OK(dsps_graph_compile_f32(&graph, NULL));
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_REINITIALIZED, dsps_graph_biquad_f32(&graph, 0, chain.hp_coef, chain.hp_w, &out));
+    dsps_graph_free_f32(&graph);
+}
+
+TEST_CASE("dsps_graph_f32 benchmark", "[dsps]")
+{
+    static graph_f32_t graph;
+    static test_graph_chain_t chain, ref_chain;
+    int repeat_count = 16;
+
+    TEST_ESP_OK(dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE));
+    test_graph_chain_init(&chain);
+    test_graph_chain_init(&ref_chain);
+    TEST_ESP_OK(test_graph_build(&graph, TEST_GRAPH_BLOCK, &chain));
+    TEST_ESP_OK(dsps_graph_compile_f32(&graph, NULL));
+    test_graph_block(0);
+
+    unsigned int start_b = xthal_get_ccount();
+    for (int i = 0 ; i < repeat_count ; i++) {
+        dsps_graph_run_f32(&graph, input);
+    }
+    unsigned int end_b = xthal_get_ccount();
+    float graph_cycles = (float)(end_b - start_b) / repeat_count;
+
+    start_b = xthal_get_ccount();
+    for (int i = 0 ; i < repeat_count ; i++) {
+        test_graph_reference(&ref_chain);
+    }
+    end_b = xthal_get_ccount();
+    float ref_cycles = (float)(end_b - start_b) / repeat_count;
+
+    ESP_LOGI(TAG, "Benchmark graph - %f, hand wired - %f cycles per block of %i samples",
+             graph_cycles, ref_cycles, TEST_GRAPH_BLOCK);
+    ESP_LOGI(TAG, "Memory graph - %i bytes, hand wired - %i bytes", (int)(graph.pool_len * sizeof(float)),
+             (int)(sizeof(ref_filt) + sizeof(ref_decim) + sizeof(ref_fft) + sizeof(ref_mag)));
+    // Envelope and peak detector are added by the graph
+    int max_cycles = (int)(2 * ref_cycles) + 20 * TEST_GRAPH_BLOCK;
+    TEST_ASSERT_EXEC_IN_RANGE(0, max_cycles, graph_cycles);
+    dsps_graph_free_f32(&graph);
+    dsps_fft2r_deinit_fc32();
+}
+
+TEST_CASE("dsps_graph_f32 block length for latency", "[dsps]")
+{
+    static graph_f32_t graph;
+    static test_graph_chain_t chain;
+    graph_tune_t tune;
+
+    TEST_ESP_OK(dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE));
+    test_graph_chain_init(&chain);
+
+    // 300 ms: 128 samples at 500 Hz take 256 ms
+    TEST_ESP_OK(dsps_graph_tune_f32(&graph, test_graph_build, &chain, TEST_GRAPH_FS, 300000, 4, TEST_GRAPH_MAX, &tune));
+    ESP_LOGI(TAG, "block %i: %i + %i cycles/sample, processing %i us, latency %i us, load %i.%02i%%",
+             (int)tune.block_len, (int)tune.call_cycles, (int)tune.sample_cycles, (int)tune.block_us,
+             (int)tune.latency_us, (int)(tune.load * 100), (int)(tune.load * 10000) % 100);
+    TEST_ASSERT_EQUAL(128, tune.block_len);
+    TEST_ASSERT_EQUAL(128, graph.port[0].len);
+    TEST_ASSERT_GREATER_THAN(0, tune.sample_cycles);
+    TEST_ASSERT_LESS_OR_EQUAL(300000, tune.latency_us);
+    TEST_ASSERT_LESS_THAN(1, tune.load);
+    // The graph is ready to run
+    test_graph_block(0);
+    TEST_ESP_OK(dsps_graph_run_f32(&graph, input));
+    dsps_graph_free_f32(&graph);
+
+    // 30 ms: 8 samples, shorter blocks are not supported by the FFT node
+    TEST_ESP_OK(dsps_graph_tune_f32(&graph, test_graph_build, &chain, TEST_GRAPH_FS, 30000, 4, TEST_GRAPH_MAX, &tune));
+    TEST_ASSERT_EQUAL(8, tune.block_len);
+    dsps_graph_free_f32(&graph);
+
+    // Not possible
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_PARAM_OUTOFRANGE,
+                      dsps_graph_tune_f32(&graph, test_graph_build, &chain, TEST_GRAPH_FS, 1000, 4, TEST_GRAPH_MAX, &tune));
+    TEST_ASSERT_EQUAL(8, tune.block_len);
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_LENGTH,
+                      dsps_graph_tune_f32(&graph, test_graph_build, &chain, TEST_GRAPH_FS, 30000, 3, 7, &tune));
+    dsps_fft2r_deinit_fc32();
+}
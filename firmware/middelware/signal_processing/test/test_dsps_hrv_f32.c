@@ -0,0 +1,170 @@
+/**
+ * @file test_dsps_hrv_f32.c
+ * @brief Tests of the streaming HRV statistics and the LF/HF power against references
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "unity.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dsps_hrv.h"
+#include "dsp_tests.h"
+
+static const char *TAG = "dsps_hrv_f32";
+
+#define TEST_HRV_LEN    256
+
+static hrv_f32_t hrv;
+static uint16_t rr_buf[TEST_HRV_LEN];
+static float work[DSPS_HRV_WORK_LEN(TEST_HRV_LEN)];
+static int32_t rr_all[1000];
+
+// Intervals of a rhythm modulated at 0.1 Hz (LF) and 0.25 Hz (HF)
+static int test_hrv_rhythm(int32_t *rr, int len, float lf_ampl, float hf_ampl)
+{
+    float t = 0;
+    for (int i = 0; i < len; i++) {
+        rr[i] = (int32_t)(850 + lf_ampl * sinf(2 * M_PI * 0.1f * t) + hf_ampl * sinf(2 * M_PI * 0.25f * t));
+        t += rr[i] * 0.001f;
+    }
+    return len;
+}
+
+TEST_CASE("dsps_hrv_f32 functionality", "[dsps]")
+{
+    // Random intervals, the window is full after TEST_HRV_LEN intervals
+    srand(1);
+    for (int i = 0; i < 1000; i++) {
+        rr_all[i] = 700 + rand() % 300;
+    }
+    TEST_ESP_OK(dsps_hrv_init_f32(&hrv, rr_buf, TEST_HRV_LEN, NULL));
+    hrv_stats_t stats;
+    for (int i = 0; i < 1000; i++) {
+        TEST_ESP_OK(dsps_hrv_add_f32(&hrv, rr_all[i]));
+        if ((i % 97) && (i != 999)) {
+            continue;
+        }
+        // Reference from the intervals in the window
+        int n = i + 1 < TEST_HRV_LEN ? i + 1 : TEST_HRV_LEN;
+        const int32_t *w = &rr_all[i + 1 - n];
+        double mean = 0, var = 0, d2 = 0;
+        int nn50 = 0;
+        for (int k = 0; k < n; k++) {
+            mean += w[k];
+        }
+        mean /= n;
+        for (int k = 0; k < n; k++) {
+            var += (w[k] - mean) * (w[k] - mean);
+        }
+        for (int k = 1; k < n; k++) {
+            d2 += (double)(w[k] - w[k - 1]) * (w[k] - w[k - 1]);
+            nn50 += abs(w[k] - w[k - 1]) > 50;
+        }
+        if (n < 2) {
+            TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_LENGTH, dsps_hrv_stats_f32(&hrv, &stats));
+            continue;
+        }
+        TEST_ESP_OK(dsps_hrv_stats_f32(&hrv, &stats));
+        TEST_ASSERT_EQUAL(n, stats.beats);
+        TEST_ASSERT_FLOAT_WITHIN(0.01f, mean, stats.mean_rr);
+        TEST_ASSERT_FLOAT_WITHIN(0.01f, sqrt(var / (n - 1)), stats.sdnn);
+        TEST_ASSERT_FLOAT_WITHIN(0.01f, sqrt(d2 / (n - 1)), stats.rmssd);
+        TEST_ASSERT_FLOAT_WITHIN(0.01f, 100.0 * nn50 / (n - 1), stats.pnn50);
+    }
+    ESP_LOGI(TAG, "SDNN %f, RMSSD %f, pNN50 %f, HR %f", stats.sdnn, stats.rmssd, stats.pnn50, stats.hr);
+
+    // Out of range intervals are not added
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_PARAM_OUTOFRANGE, dsps_hrv_add_f32(&hrv, DSPS_HRV_RR_MIN - 1));
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_PARAM_OUTOFRANGE, dsps_hrv_add_f32(&hrv, DSPS_HRV_RR_MAX + 1));
+    TEST_ASSERT_EQUAL(2, hrv.rejected);
+    hrv_stats_t same;
+    TEST_ESP_OK(dsps_hrv_stats_f32(&hrv, &same));
+    TEST_ASSERT_EQUAL_FLOAT(stats.sdnn, same.sdnn);
+}
+
+TEST_CASE("dsps_hrv_f32 LF/HF", "[dsps]")
+{
+    // Power of a sine is amplitude^2 / 2, intervals are rounded to 1 ms and leak few ms^2 to the other band
+    float ampl[][2] = {{40, 20}, {20, 40}, {30, 0.1f}};
+    for (int a = 0; a < sizeof(ampl) / sizeof(ampl[0]); a++) {
+        int n = test_hrv_rhythm(rr_all, 600, ampl[a][0], ampl[a][1]);
+        TEST_ESP_OK(dsps_hrv_init_f32(&hrv, rr_buf, TEST_HRV_LEN, work));
+        for (int i = 0; i < n; i++) {
+            TEST_ESP_OK(dsps_hrv_add_f32(&hrv, rr_all[i]));
+        }
+        float lf, hf, ratio;
+        TEST_ESP_OK(dsps_hrv_lfhf_f32(&hrv, &lf, &hf, &ratio));
+        float lf_ref = ampl[a][0] * ampl[a][0] / 2;
+        float hf_ref = ampl[a][1] * ampl[a][1] / 2;
+        ESP_LOGI(TAG, "LF %f (%f), HF %f (%f) ms^2, LF/HF %f", lf, lf_ref, hf, hf_ref, ratio);
+        TEST_ASSERT_FLOAT_WITHIN(lf_ref * 0.15f + 3, lf_ref, lf);
+        TEST_ASSERT_FLOAT_WITHIN(hf_ref * 0.15f + 3, hf_ref, hf);
+        if (hf_ref > 10) {
+            TEST_ASSERT_FLOAT_WITHIN(lf_ref / hf_ref * 0.3f, lf_ref / hf_ref, ratio);
+        }
+        // Every output is optional
+        float lf_only;
+        TEST_ESP_OK(dsps_hrv_lfhf_f32(&hrv, &lf_only, NULL, NULL));
+        TEST_ASSERT_EQUAL_FLOAT(lf, lf_only);
+    }
+}
+
+TEST_CASE("dsps_hrv_f32 parameters", "[dsps]")
+{
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_PARAM, dsps_hrv_init_f32(NULL, rr_buf, TEST_HRV_LEN, NULL));
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_PARAM, dsps_hrv_init_f32(&hrv, NULL, TEST_HRV_LEN, NULL));
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_LENGTH, dsps_hrv_init_f32(&hrv, rr_buf, 1, NULL));
+
+    float ratio;
+    TEST_ESP_OK(dsps_hrv_init_f32(&hrv, rr_buf, TEST_HRV_LEN, NULL));
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_UNINITIALIZED, dsps_hrv_lfhf_f32(&hrv, NULL, NULL, &ratio));
+    // Window shorter than one period of the LF band
+    TEST_ESP_OK(dsps_hrv_init_f32(&hrv, rr_buf, TEST_HRV_LEN, work));
+    for (int i = 0; i < 20; i++) {
+        TEST_ESP_OK(dsps_hrv_add_f32(&hrv, 1000));
+    }
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_LENGTH, dsps_hrv_lfhf_f32(&hrv, NULL, NULL, &ratio));
+
+    // Window of 2 intervals
+    TEST_ESP_OK(dsps_hrv_init_f32(&hrv, rr_buf, 2, NULL));
+    int32_t rr[] = {800, 900, 700};
+    for (int i = 0; i < 3; i++) {
+        TEST_ESP_OK(dsps_hrv_add_f32(&hrv, rr[i]));
+    }
+    hrv_stats_t stats;
+    TEST_ESP_OK(dsps_hrv_stats_f32(&hrv, &stats));
+    TEST_ASSERT_EQUAL_FLOAT(800, stats.mean_rr);
+    TEST_ASSERT_EQUAL_FLOAT(200, stats.rmssd);
+    TEST_ASSERT_EQUAL_FLOAT(100, stats.pnn50);
+}
+
+TEST_CASE("dsps_hrv_f32 benchmark", "[dsps]")
+{
+    int n = test_hrv_rhythm(rr_all, 1000, 40, 20);
+    TEST_ESP_OK(dsps_hrv_init_f32(&hrv, rr_buf, TEST_HRV_LEN, work));
+    unsigned int start_b = xthal_get_ccount();
+    for (int i = 0; i < n; i++) {
+        dsps_hrv_add_f32(&hrv, rr_all[i]);
+    }
+    unsigned int end_b = xthal_get_ccount();
+    float add_cycles = (float)(end_b - start_b) / n;
+
+    hrv_stats_t stats;
+    float ratio;
+    start_b = xthal_get_ccount();
+    dsps_hrv_stats_f32(&hrv, &stats);
+    end_b = xthal_get_ccount();
+    float stats_cycles = (float)(end_b - start_b);
+
+    start_b = xthal_get_ccount();
+    dsps_hrv_lfhf_f32(&hrv, NULL, NULL, &ratio);
+    end_b = xthal_get_ccount();
+    float lfhf_cycles = (float)(end_b - start_b);
+
+    ESP_LOGI(TAG, "Benchmark add - %f, stats - %f, LF/HF of %i intervals - %f cycles", add_cycles, stats_cycles,
+             TEST_HRV_LEN, lfhf_cycles);
+    TEST_ASSERT_EXEC_IN_RANGE(0, (400), add_cycles);
+}
@@ -0,0 +1,197 @@
+/**
+ * @file test_dsps_qrs_s16.c
+ * @brief Replay tests of the QRS detector on annotated ECG records
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include "unity.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dsps_qrs.h"
+#include "dsp_tests.h"
+#include "test_ecg_records.h"
+
+static const char *TAG = "dsps_qrs_s16";
+
+#define TEST_QRS_BLOCK_MS       100     // Block length of the acquisition task of the examples
+#define TEST_QRS_BEATS_MAX      256
+#define TEST_QRS_FS_EXAMPLE     200     // Sample frequency of the ej_lcdcolor_ecg example
+#define TEST_QRS_BLOCK_EXAMPLE  16      // Samples per block of the ej_lcdcolor_ecg example
+#define TEST_QRS_LEN_MAX        12000   // Longest record at TEST_QRS_FS_EXAMPLE
+
+static qrs_s16_t qrs;
+static qrs_beat_t beats[TEST_QRS_BEATS_MAX];
+
+// Replay of the record in blocks, returns number of detected beats
+static int test_qrs_replay(const test_ecg_record_t *rec, int block)
+{
+    TEST_ESP_OK(dsps_qrs_init_s16(&qrs, rec->fs, 12));
+    int count = 0;
+    for (int pos = 0; pos < rec->len; pos += block) {
+        int len = rec->len - pos < block ? rec->len - pos : block;
+        count += dsps_qrs_s16(&qrs, &rec->data[pos], len, &beats[count], TEST_QRS_BEATS_MAX - count);
+    }
+    return count;
+}
+
+// Replay of the record and comparison of the beats with the annotations
+static void test_qrs_check(const test_ecg_record_t *rec, int block)
+{
+    int count = test_qrs_replay(rec, block);
+
+    // Beats are matched to annotations within 50 ms, or within 150 ms as in ANSI/AAMI EC57 if the
+    // annotations of the record mark another point of the QRS than the detector for some beat shapes.
+    // The learning period and the end of the record, where the detection is delayed over the record,
+    // are not scored
+    int32_t tol = rec->exact ? rec->fs / 20 : rec->fs * 3 / 20;
+    int32_t first = 2 * rec->fs + tol;
+    int32_t last = rec->len - rec->fs;
+    int tp = 0, fn = 0, fp = 0;
+    int32_t max_rr_err = 0;
+    for (int a = 0; a < rec->ann_len; a++) {
+        int32_t ann = rec->ann[a];
+        if ((ann < first) || (ann >= last)) {
+            continue;
+        }
+        int found = -1;
+        for (int b = 0; b < count; b++) {
+            if (abs(beats[b].r_peak - ann) <= tol) {
+                found = b;
+                break;
+            }
+        }
+        if (found < 0) {
+            fn++;
+            continue;
+        }
+        tp++;
+        if ((found > 0) && (a > 0) && (abs(beats[found - 1].r_peak - rec->ann[a - 1]) <= tol)) {
+            int32_t rr_ms = (ann - rec->ann[a - 1]) * 1000 / rec->fs;
+            int32_t err = abs(beats[found].rr_ms - rr_ms);
+            max_rr_err = err > max_rr_err ? err : max_rr_err;
+        }
+    }
+    for (int b = 0; b < count; b++) {
+        if ((beats[b].r_peak < first) || (beats[b].r_peak >= last)) {
+            continue;
+        }
+        int found = 0;
+        for (int a = 0; a < rec->ann_len; a++) {
+            if (abs(beats[b].r_peak - rec->ann[a]) <= tol) {
+                found = 1;
+                break;
+            }
+        }
+        fp += !found;
+    }
+    float se = (float)tp / (tp + fn);
+    float ppv = (float)tp / (tp + fp);
+    ESP_LOGI(TAG, "%s: %i beats, TP %i, FN %i, FP %i, Se %i%%, PPV %i%%, max RR error %i ms", rec->name, count,
+             tp, fn, fp, (int)(se * 100), (int)(ppv * 100), (int)max_rr_err);
+    TEST_ASSERT_GREATER_THAN(0, tp);
+    TEST_ASSERT_GREATER_OR_EQUAL(95, (int)(se * 100));
+    TEST_ASSERT_GREATER_OR_EQUAL(95, (int)(ppv * 100));
+    // R peak is located on the band pass signal, jitter is up to 2 samples of each beat. With other
+    // annotations the RR error includes the distance between their fiducial points of normal and
+    // ventricular beats, so it is only reported
+    if (rec->exact) {
+        TEST_ASSERT_LESS_OR_EQUAL(4 * 1000 / rec->fs + 1, max_rr_err);
+    }
+}
+
+// Linear interpolation of a record at a lower sample frequency
+static void test_qrs_resample(const test_ecg_record_t *rec, int32_t fs, int16_t *data, int32_t *ann, test_ecg_record_t *out)
+{
+    int32_t len = (int64_t)(rec->len - 1) * fs / rec->fs + 1;
+    for (int32_t i = 0; i < len; i++) {
+        int32_t pos = (int64_t)i * rec->fs / fs;
+        int32_t frac = (int64_t)i * rec->fs % fs;
+        int32_t next = pos + 1 < rec->len ? rec->data[pos + 1] : rec->data[pos];
+        data[i] = (rec->data[pos] * (fs - frac) + next * frac) / fs;
+    }
+    for (int a = 0; a < rec->ann_len; a++) {
+        ann[a] = (rec->ann[a] * fs + rec->fs / 2) / rec->fs;
+    }
+    *out = *rec;
+    out->fs = fs;
+    out->data = data;
+    out->len = len;
+    out->ann = ann;
+}
+
+TEST_CASE("dsps_qrs_s16 functionality", "[dsps]")
+{
+    for (int r = 0; r < TEST_ECG_RECORDS; r++) {
+        test_qrs_check(&test_ecg_records[r], test_ecg_records[r].fs * TEST_QRS_BLOCK_MS / 1000);
+    }
+}
+
+TEST_CASE("dsps_qrs_s16 functionality at 200 Hz", "[dsps]")
+{
+    // Records resampled to the sample frequency of the ej_lcdcolor_ecg example
+    static int16_t data[TEST_QRS_LEN_MAX];
+    static int32_t ann[TEST_QRS_BEATS_MAX];
+    test_ecg_record_t rec;
+    for (int r = 0; r < TEST_ECG_RECORDS; r++) {
+        TEST_ASSERT_LESS_OR_EQUAL(TEST_QRS_LEN_MAX, (int64_t)test_ecg_records[r].len * TEST_QRS_FS_EXAMPLE / test_ecg_records[r].fs);
+        TEST_ASSERT_LESS_OR_EQUAL(TEST_QRS_BEATS_MAX, test_ecg_records[r].ann_len);
+        test_qrs_resample(&test_ecg_records[r], TEST_QRS_FS_EXAMPLE, data, ann, &rec);
+        test_qrs_check(&rec, TEST_QRS_BLOCK_EXAMPLE);
+    }
+}
+
+TEST_CASE("dsps_qrs_s16 block size", "[dsps]")
+{
+    // Result does not depend on the size of the processed blocks
+    const test_ecg_record_t *rec = &test_ecg_records[0];
+    int count = test_qrs_replay(rec, 1);
+    qrs_beat_t ref[TEST_QRS_BEATS_MAX];
+    memcpy(ref, beats, sizeof(qrs_beat_t) * count);
+    int blocks[] = {7, rec->fs * TEST_QRS_BLOCK_MS / 1000, 256, rec->len};
+    for (int i = 0; i < sizeof(blocks) / sizeof(blocks[0]); i++) {
+        TEST_ASSERT_EQUAL(count, test_qrs_replay(rec, blocks[i]));
+        for (int b = 0; b < count; b++) {
+            TEST_ASSERT_EQUAL(ref[b].r_peak, beats[b].r_peak);
+            TEST_ASSERT_EQUAL(ref[b].rr_ms, beats[b].rr_ms);
+        }
+    }
+}
+
+TEST_CASE("dsps_qrs_s16 parameters", "[dsps]")
+{
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_PARAM, dsps_qrs_init_s16(NULL, 250, 12));
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_PARAM_OUTOFRANGE, dsps_qrs_init_s16(&qrs, DSPS_QRS_FS_MIN - 1, 12));
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_PARAM_OUTOFRANGE, dsps_qrs_init_s16(&qrs, DSPS_QRS_FS_MAX + 1, 12));
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_PARAM_OUTOFRANGE, dsps_qrs_init_s16(&qrs, 250, 7));
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_PARAM_OUTOFRANGE, dsps_qrs_init_s16(&qrs, 250, 17));
+
+    // Full scale 16 bit square wave does not overflow, edges are detected as beats
+    static int16_t square[2000];
+    for (int i = 0; i < 2000; i++) {
+        square[i] = (i / 100) & 1 ? INT16_MAX : INT16_MIN;
+    }
+    TEST_ESP_OK(dsps_qrs_init_s16(&qrs, 200, 16));
+    int count = dsps_qrs_s16(&qrs, square, 2000, beats, TEST_QRS_BEATS_MAX);
+    TEST_ASSERT_GREATER_THAN(0, count);
+    for (int b = 1; b < count; b++) {
+        TEST_ASSERT_INT_WITHIN(2, 500, beats[b].rr_ms);
+    }
+    // Beats over max_beats are not written
+    TEST_ESP_OK(dsps_qrs_init_s16(&qrs, 200, 16));
+    TEST_ASSERT_EQUAL(1, dsps_qrs_s16(&qrs, square, 2000, beats, 1));
+}
+
+TEST_CASE("dsps_qrs_s16 benchmark", "[dsps]")
+{
+    const test_ecg_record_t *rec = &test_ecg_records[0];
+    TEST_ESP_OK(dsps_qrs_init_s16(&qrs, rec->fs, 12));
+    unsigned int start_b = xthal_get_ccount();
+    int count = dsps_qrs_s16(&qrs, rec->data, rec->len, beats, TEST_QRS_BEATS_MAX);
+    unsigned int end_b = xthal_get_ccount();
+    float cycles = (float)(end_b - start_b) / rec->len;
+    ESP_LOGI(TAG, "Benchmark dsps_qrs_s16 - %f cycles per sample, %i beats", cycles, count);
+    ESP_LOGI(TAG, "Memory - %i bytes", (int)sizeof(qrs_s16_t));
+    TEST_ASSERT_EXEC_IN_RANGE(0, (300), cycles);
+}
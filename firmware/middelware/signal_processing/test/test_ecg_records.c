@@ -0,0 +1,2815 @@
+/**
+ * @file test_ecg_records.c
+ * @brief Annotated ECG records for the QRS detector replay tests
+ *
+ * Generated by gen_ecg_records.py, do not edit.
+ */
+
+#include "test_ecg_records.h"
+
+static const int16_t nsr_data[7500] = {
+    2171, 2123, 2093, 2146, 2206, 2124, 2084, 2129, 2161, 2135, 2081, 2075, 2159, 2153, 2091, 2056,
+    2124, 2153, 2086, 2028, 2035, 2098, 2137, 2038, 2013, 2075, 2117, 2036, 1965, 2020, 2048, 2068,
+    1988, 1975, 2044, 2064, 2060, 1971, 2029, 2058, 2059, 2035, 1949, 2035, 2050, 2020, 2017, 2048,
+    2058, 2069, 2019, 2008, 2120, 2102, 2044, 2038, 2123, 2187, 2139, 2067, 2102, 2183, 2158, 2118,
+    2106, 2149, 2192, 2135, 2087, 2091, 2179, 2173, 2102, 2097, 2139, 2199, 2138, 2116, 2172, 2237,
+    2215, 2154, 2195, 2202, 2234, 2216, 2190, 2242, 2291, 2295, 2234, 2215, 2336, 2396, 2402, 2488,
+    2668, 2932, 3133, 3316, 3489, 3406, 3063, 2589, 2082, 1824, 1742, 1720, 1821, 2001, 2167, 2213,
+    2185, 2216, 2285, 2343, 2319, 2286, 2312, 2368, 2319, 2278, 2293, 2359, 2358, 2255, 2266, 2334,
+    2340, 2308, 2254, 2275, 2325, 2335, 2255, 2250, 2323, 2335, 2283, 2259, 2272, 2324, 2303, 2220,
+    2234, 2305, 2339, 2260, 2219, 2282, 2352, 2283, 2226, 2250, 2314, 2340, 2300, 2271, 2304, 2346,
+    2337, 2273, 2295, 2348, 2333, 2327, 2295, 2386, 2401, 2345, 2320, 2335, 2386, 2331, 2268, 2276,
+    2358, 2347, 2274, 2183, 2212, 2333, 2229, 2118, 2116, 2204, 2224, 2065, 2038, 2122, 2206, 2149,
+    2064, 2132, 2258, 2225, 2165, 2167, 2274, 2317, 2279, 2260, 2317, 2360, 2325, 2273, 2302, 2368,
+    2368, 2286, 2274, 2333, 2359, 2330, 2250, 2281, 2365, 2328, 2270, 2246, 2310, 2366, 2282, 2213,
+    2269, 2325, 2314, 2227, 2213, 2282, 2311, 2256, 2194, 2248, 2292, 2243, 2169, 2180, 2217, 2246,
+    2178, 2162, 2206, 2233, 2152, 2097, 2159, 2181, 2165, 2090, 2094, 2178, 2194, 2136, 2063, 2133,
+    2184, 2179, 2126, 2049, 2136, 2156, 2128, 2100, 2127, 2174, 2183, 2121, 2089, 2189, 2178, 2137,
+    2130, 2182, 2258, 2218, 2161, 2188, 2249, 2214, 2190, 2185, 2207, 2238, 2182, 2160, 2168, 2246,
+    2205, 2146, 2163, 2217, 2254, 2174, 2132, 2217, 2293, 2259, 2185, 2210, 2257, 2285, 2244, 2188,
+    2259, 2317, 2344, 2266, 2230, 2331, 2416, 2437, 2507, 2661, 2916, 3158, 3343, 3490, 3407, 3045,
+    2588, 2091, 1823, 1727, 1695, 1801, 2002, 2168, 2196, 2162, 2206, 2284, 2333, 2271, 2236, 2292,
+    2353, 2302, 2236, 2239, 2314, 2340, 2230, 2214, 2274, 2315, 2283, 2214, 2200, 2263, 2291, 2212,
+    2200, 2257, 2249, 2232, 2202, 2209, 2253, 2231, 2156, 2186, 2238, 2252, 2198, 2148, 2227, 2280,
+    2205, 2135, 2170, 2254, 2264, 2206, 2164, 2222, 2269, 2234, 2153, 2194, 2251, 2252, 2231, 2168,
+    2277, 2300, 2257, 2214, 2215, 2272, 2225, 2183, 2184, 2221, 2218, 2176, 2120, 2134, 2187, 2088,
+    2029, 2030, 2052, 2034, 1942, 1951, 2012, 1980, 1960, 1960, 2003, 2049, 2008, 2027, 2102, 2101,
+    2084, 2093, 2153, 2175, 2157, 2142, 2173, 2205, 2179, 2140, 2154, 2215, 2212, 2132, 2115, 2173,
+    2186, 2157, 2080, 2115, 2189, 2169, 2100, 2072, 2137, 2202, 2111, 2029, 2090, 2138, 2120, 2048,
+    2027, 2094, 2122, 2073, 2018, 2059, 2103, 2055, 1978, 1976, 2024, 2042, 1991, 1969, 2002, 2031,
+    1951, 1901, 1958, 1985, 1966, 1898, 1894, 1982, 1982, 1934, 1850, 1932, 1977, 1970, 1919, 1846,
+    1924, 1951, 1925, 1879, 1927, 1960, 1973, 1904, 1872, 1962, 1971, 1936, 1907, 1966, 2046, 2000,
+    1947, 1967, 2021, 2009, 1970, 1958, 2007, 2020, 1956, 1943, 1945, 2020, 1985, 1925, 1932, 1988,
+    2048, 1941, 1931, 1989, 2073, 2026, 1962, 1996, 2030, 2054, 2018, 1984, 2040, 2095, 2116, 2042,
+    1995, 2112, 2189, 2221, 2285, 2440, 2687, 2925, 3116, 3277, 3179, 2826, 2371, 1879, 1610, 1503,
+    1488, 1596, 1778, 1947, 1957, 1946, 2000, 2076, 2110, 2049, 2023, 2081, 2139, 2093, 2030, 2038,
+    2106, 2123, 2021, 2014, 2055, 2088, 2081, 2011, 1992, 2044, 2072, 2006, 1999, 2046, 2043, 2028,
+    2006, 2011, 2056, 2014, 1953, 1979, 2038, 2045, 1992, 1962, 2021, 2080, 2004, 1945, 1984, 2053,
+    2067, 2006, 1964, 2032, 2082, 2054, 1957, 1985, 2054, 2065, 2023, 1958, 2058, 2096, 2064, 2009,
+    1982, 2058, 2050, 2009, 1956, 2016, 2059, 2044, 1952, 1909, 2034, 2032, 1922, 1848, 1902, 1974,
+    1894, 1835, 1874, 1929, 1944, 1878, 1834, 1912, 1970, 1968, 1890, 1910, 2002, 2017, 1991, 1920,
+    1981, 2055, 2029, 1974, 1944, 2001, 2072, 1987, 1920, 1962, 2021, 2018, 1933, 1913, 1982, 2007,
+    1956, 1890, 1942, 1985, 1933, 1878, 1875, 1919, 1972, 1894, 1862, 1909, 1934, 1860, 1809, 1868,
+    1894, 1891, 1815, 1824, 1887, 1903, 1862, 1771, 1853, 1895, 1893, 1859, 1783, 1876, 1898, 1846,
+    1823, 1858, 1902, 1903, 1838, 1828, 1931, 1920, 1877, 1862, 1914, 2004, 1954, 1906, 1917, 1988,
+    1962, 1937, 1932, 1964, 1991, 1928, 1918, 1929, 2002, 1952, 1902, 1920, 1973, 2025, 1924, 1912,
+    1985, 2041, 2019, 1953, 1979, 2020, 2069, 2016, 1986, 2027, 2089, 2117, 2047, 2005, 2122, 2206,
+    2225, 2296, 2449, 2721, 2952, 3138, 3298, 3198, 2853, 2399, 1895, 1642, 1527, 1507, 1630, 1827,
+    1979, 2007, 1999, 2041, 2095, 2156, 2117, 2061, 2124, 2173, 2144, 2071, 2086, 2161, 2165, 2067,
+    2058, 2109, 2160, 2125, 2080, 2058, 2109, 2153, 2079, 2068, 2124, 2123, 2103, 2069, 2093, 2125,
+    2092, 2044, 2068, 2128, 2128, 2072, 2048, 2122, 2159, 2092, 2031, 2078, 2152, 2146, 2099, 2055,
+    2106, 2166, 2164, 2040, 2047, 2153, 2173, 2141, 2062, 2156, 2237, 2217, 2155, 2101, 2218, 2243,
+    2182, 2119, 2183, 2259, 2221, 2120, 2110, 2218, 2191, 2074, 2027, 2081, 2139, 2042, 1960, 2000,
+    2074, 2065, 2013, 1954, 2057, 2112, 2069, 2014, 2025, 2134, 2171, 2082, 2042, 2101, 2170, 2163,
+    2070, 2069, 2148, 2183, 2101, 2045, 2108, 2169, 2126, 2050, 2026, 2083, 2124, 2074, 2038, 2063,
+    2117, 2037, 1995, 2032, 2048, 2058, 1987, 2004, 2060, 2064, 2034, 1968, 2038, 2084, 2064, 2018,
+    1963, 2067, 2064, 2023, 2003, 2049, 2082, 2088, 2020, 1990, 2119, 2106, 2061, 2028, 2114, 2193,
+    2152, 2093, 2100, 2172, 2164, 2139, 2097, 2143, 2170, 2138, 2112, 2106, 2162, 2138, 2098, 2113,
+    2152, 2210, 2118, 2109, 2178, 2243, 2201, 2141, 2185, 2233, 2239, 2200, 2178, 2230, 2303, 2307,
+    2220, 2205, 2320, 2411, 2420, 2477, 2645, 2916, 3134, 3334, 3484, 3398, 3047, 2602, 2094, 1814,
+    1710, 1710, 1819, 2003, 2162, 2185, 2184, 2235, 2304, 2332, 2304, 2261, 2317, 2378, 2302, 2264,
+    2281, 2349, 2364, 2260, 2237, 2315, 2358, 2320, 2233, 2234, 2300, 2341, 2255, 2245, 2299, 2320,
+    2296, 2258, 2254, 2308, 2285, 2234, 2245, 2304, 2303, 2252, 2234, 2292, 2324, 2259, 2218, 2252,
+    2321, 2327, 2267, 2248, 2311, 2344, 2312, 2233, 2255, 2305, 2322, 2296, 2239, 2321, 2377, 2340,
+    2294, 2257, 2330, 2348, 2321, 2280, 2277, 2340, 2377, 2281, 2213, 2299, 2307, 2257, 2195, 2218,
+    2251, 2198, 2159, 2154, 2183, 2212, 2197, 2147, 2177, 2219, 2204, 2222, 2178, 2237, 2286, 2252,
+    2223, 2226, 2296, 2325, 2250, 2195, 2267, 2300, 2283, 2191, 2193, 2278, 2291, 2221, 2157, 2227,
+    2292, 2220, 2148, 2137, 2199, 2252, 2170, 2131, 2164, 2216, 2154, 2094, 2117, 2152, 2165, 2101,
+    2081, 2139, 2138, 2131, 2062, 2115, 2157, 2141, 2107, 2051, 2133, 2132, 2101, 2080, 2138, 2150,
+    2141, 2098, 2079, 2203, 2169, 2118, 2099, 2179, 2262, 2212, 2137, 2139, 2250, 2221, 2192, 2144,
+    2178, 2238, 2190, 2145, 2138, 2205, 2185, 2157, 2139, 2186, 2232, 2156, 2156, 2209, 2260, 2222,
+    2177, 2218, 2238, 2255, 2208, 2212, 2267, 2307, 2311, 2220, 2216, 2347, 2404, 2415, 2473, 2654,
+    2927, 3123, 3302, 3482, 3386, 3063, 2590, 2063, 1801, 1717, 1696, 1803, 1973, 2128, 2172, 2159,
+    2201, 2254, 2292, 2255, 2247, 2286, 2316, 2269, 2226, 2230, 2318, 2311, 2192, 2208, 2278, 2309,
+    2252, 2190, 2204, 2259, 2281, 2172, 2167, 2248, 2257, 2217, 2176, 2191, 2234, 2224, 2160, 2147,
+    2215, 2241, 2190, 2145, 2198, 2240, 2192, 2126, 2172, 2217, 2234, 2199, 2168, 2200, 2246, 2212,
+    2141, 2181, 2246, 2222, 2189, 2166, 2276, 2273, 2228, 2170, 2196, 2263, 2205, 2129, 2148, 2194,
+    2187, 2142, 2079, 2077, 2133, 2081, 2029, 1994, 1994, 2018, 1977, 1984, 1981, 1964, 2000, 2053,
+    2010, 1988, 2017, 2069, 2114, 2093, 2084, 2121, 2154, 2152, 2125, 2113, 2162, 2200, 2126, 2108,
+    2138, 2162, 2148, 2084, 2111, 2170, 2128, 2093, 2056, 2121, 2163, 2068, 2028, 2079, 2131, 2103,
+    2011, 2018, 2099, 2115, 2040, 1979, 2044, 2107, 2032, 1958, 1935, 2016, 2052, 1970, 1926, 1975,
+    2019, 1955, 1888, 1921, 1950, 1953, 1892, 1875, 1946, 1950, 1933, 1859, 1913, 1947, 1921, 1884,
+    1836, 1928, 1923, 1894, 1865, 1924, 1954, 1938, 1873, 1862, 1973, 1966, 1887, 1869, 1954, 2038,
+    1992, 1917, 1920, 2023, 2005, 1958, 1933, 1966, 2004, 1956, 1925, 1917, 1995, 1979, 1920, 1907,
+    1943, 2005, 1931, 1924, 1977, 2029, 1994, 1947, 1985, 2006, 2015, 1979, 1962, 2036, 2073, 2062,
+    1986, 1982, 2113, 2168, 2169, 2243, 2427, 2697, 2907, 3079, 3235, 3158, 2824, 2356, 1815, 1557,
+    1483, 1464, 1564, 1735, 1894, 1944, 1941, 1967, 2023, 2071, 2029, 2009, 2037, 2098, 2046, 1996,
+    2026, 2078, 2066, 1971, 1971, 2045, 2074, 2014, 1964, 1968, 2042, 2049, 1935, 1957, 2022, 2016,
+    1995, 1942, 1964, 2011, 2007, 1921, 1933, 1984, 2005, 1969, 1920, 1976, 2007, 1963, 1912, 1962,
+    2004, 1996, 1948, 1955, 1998, 2016, 2001, 1938, 1987, 2027, 2010, 1982, 1946, 2057, 2073, 2006,
+    1955, 1975, 2043, 1999, 1922, 1915, 1998, 2028, 1939, 1844, 1870, 1984, 1916, 1793, 1776, 1840,
+    1909, 1769, 1701, 1799, 1893, 1840, 1754, 1794, 1887, 1912, 1860, 1850, 1932, 1996, 1944, 1904,
+    1928, 2011, 2010, 1938, 1923, 1991, 2005, 1974, 1906, 1925, 2011, 1980, 1917, 1899, 1962, 2015,
+    1929, 1869, 1911, 1967, 1958, 1888, 1860, 1934, 1953, 1902, 1851, 1887, 1940, 1889, 1837, 1826,
+    1865, 1903, 1834, 1816, 1871, 1890, 1802, 1769, 1812, 1837, 1831, 1754, 1758, 1838, 1843, 1815,
+    1734, 1798, 1857, 1842, 1792, 1719, 1809, 1838, 1792, 1763, 1792, 1847, 1852, 1795, 1754, 1861,
+    1865, 1818, 1801, 1863, 1942, 1894, 1841, 1854, 1935, 1900, 1878, 1860, 1908, 1934, 1869, 1840,
+    1871, 1934, 1895, 1840, 1846, 1911, 1953, 1858, 1850, 1915, 1983, 1961, 1888, 1914, 1953, 1993,
+    1950, 1916, 1969, 2046, 2063, 1983, 1950, 2053, 2129, 2167, 2241, 2386, 2647, 2873, 3063, 3240,
+    3131, 2799, 2339, 1835, 1568, 1464, 1448, 1557, 1742, 1910, 1940, 1915, 1971, 2044, 2097, 2036,
+    2009, 2059, 2127, 2066, 2011, 2030, 2088, 2112, 2009, 1982, 2046, 2091, 2062, 2011, 1987, 2046,
+    2083, 2002, 2006, 2068, 2045, 2033, 2005, 2019, 2056, 2035, 1981, 2012, 2058, 2051, 2014, 1976,
+    2047, 2102, 2028, 1960, 2007, 2092, 2097, 2026, 1990, 2063, 2103, 2077, 1978, 2000, 2087, 2113,
+    2056, 1983, 2085, 2163, 2117, 2017, 2046, 2140, 2129, 2062, 2024, 2129, 2191, 2109, 2006, 2013,
+    2155, 2096, 1995, 1961, 2044, 2078, 1951, 1879, 1947, 2036, 2022, 1905, 1904, 2022, 2043, 1996,
+    1920, 2004, 2108, 2071, 2005, 1985, 2079, 2150, 2066, 2000, 2041, 2100, 2103, 2024, 2004, 2077,
+    2109, 2040, 2000, 2048, 2085, 2040, 1984, 1980, 2014, 2054, 1990, 1958, 2014, 2044, 1966, 1910,
+    1982, 1997, 1991, 1920, 1918, 2007, 2006, 1972, 1888, 1967, 2009, 2008, 1958, 1879, 1967, 1994,
+    1963, 1937, 1970, 2024, 2032, 1955, 1927, 2037, 2043, 2000, 1983, 2033, 2128, 2063, 2025, 2032,
+    2101, 2082, 2053, 2049, 2085, 2112, 2056, 2038, 2048, 2112, 2088, 2030, 2033, 2091, 2146, 2052,
+    2030, 2112, 2184, 2154, 2074, 2111, 2136, 2178, 2149, 2099, 2157, 2222, 2245, 2174, 2142, 2241,
+    2326, 2355, 2426, 2575, 2845, 3055, 3259, 3415, 3321, 2972, 2526, 2031, 1759, 1656, 1617, 1732,
+    1938, 2106, 2126, 2099, 2149, 2231, 2287, 2226, 2187, 2237, 2306, 2254, 2185, 2207, 2275, 2302,
+    2188, 2179, 2239, 2271, 2251, 2182, 2164, 2233, 2256, 2180, 2175, 2233, 2228, 2217, 2189, 2209,
+    2238, 2212, 2149, 2177, 2239, 2240, 2172, 2143, 2224, 2265, 2197, 2129, 2178, 2261, 2261, 2185,
+    2159, 2223, 2256, 2227, 2153, 2200, 2233, 2225, 2210, 2198, 2285, 2284, 2220, 2232, 2264, 2283,
+    2200, 2226, 2304, 2312, 2251, 2216, 2231, 2258, 2282, 2185, 2145, 2194, 2196, 2149, 2033, 2087,
+    2159, 2128, 2068, 2070, 2116, 2160, 2081, 2091, 2142, 2169, 2157, 2119, 2170, 2233, 2172, 2139,
+    2168, 2214, 2197, 2137, 2143, 2198, 2216, 2158, 2102, 2177, 2218, 2145, 2067, 2073, 2151, 2173,
+    2080, 2048, 2115, 2158, 2072, 2001, 2053, 2097, 2109, 2027, 2007, 2066, 2086, 2066, 1989, 2045,
+    2079, 2074, 2052, 1986, 2056, 2048, 2023, 2016, 2062, 2085, 2079, 2028, 2014, 2119, 2088, 2034,
+    2052, 2113, 2194, 2125, 2067, 2087, 2182, 2160, 2100, 2072, 2118, 2171, 2106, 2071, 2069, 2161,
+    2146, 2076, 2067, 2105, 2167, 2096, 2078, 2126, 2180, 2169, 2115, 2135, 2153, 2187, 2141, 2141,
+    2197, 2235, 2240, 2176, 2153, 2266, 2313, 2339, 2420, 2594, 2859, 3055, 3226, 3421, 3334, 2981,
+    2497, 1990, 1738, 1650, 1629, 1718, 1904, 2074, 2121, 2091, 2126, 2182, 2246, 2211, 2178, 2196,
+    2247, 2211, 2166, 2174, 2234, 2232, 2139, 2144, 2212, 2235, 2174, 2127, 2140, 2186, 2189, 2112,
+    2119, 2191, 2188, 2149, 2100, 2132, 2184, 2157, 2064, 2083, 2154, 2174, 2114, 2063, 2125, 2178,
+    2127, 2066, 2085, 2153, 2163, 2127, 2098, 2122, 2162, 2151, 2088, 2108, 2147, 2145, 2118, 2086,
+    2162, 2191, 2151, 2095, 2084, 2161, 2136, 2068, 2050, 2118, 2169, 2122, 2014, 2004, 2136, 2130,
+    2005, 1906, 1989, 2082, 1981, 1913, 1927, 2008, 2027, 1971, 1920, 1969, 2046, 2034, 1974, 1976,
+    2043, 2073, 2063, 1986, 2019, 2097, 2082, 2045, 2011, 2066, 2102, 2014, 1984, 2024, 2055, 2044,
+    1964, 1963, 2059, 2046, 1980, 1935, 1999, 2038, 1973, 1901, 1899, 1964, 2005, 1912, 1874, 1918,
+    1974, 1902, 1820, 1868, 1906, 1921, 1823, 1817, 1889, 1903, 1881, 1798, 1848, 1888, 1890, 1850,
+    1791, 1855, 1851, 1837, 1823, 1855, 1879, 1873, 1825, 1808, 1919, 1885, 1839, 1817, 1909, 1981,
+    1912, 1855, 1874, 1948, 1929, 1892, 1862, 1909, 1957, 1904, 1855, 1844, 1934, 1929, 1863, 1852,
+    1893, 1951, 1875, 1851, 1902, 1962, 1954, 1900, 1924, 1942, 1953, 1935, 1905, 1972, 2007, 2005,
+    1958, 1928, 2040, 2100, 2103, 2195, 2361, 2627, 2825, 3020, 3188, 3116, 2756, 2276, 1769, 1511,
+    1430, 1409, 1496, 1674, 1855, 1874, 1864, 1900, 1955, 2012, 1973, 1943, 1981, 2021, 1979, 1944,
+    1955, 1997, 2002, 1918, 1915, 1978, 1986, 1945, 1903, 1915, 1975, 1984, 1891, 1898, 1972, 1965,
+    1928, 1878, 1902, 1970, 1927, 1846, 1859, 1935, 1954, 1895, 1841, 1901, 1960, 1935, 1840, 1889,
+    1927, 1952, 1911, 1879, 1917, 1949, 1937, 1875, 1896, 1948, 1945, 1912, 1890, 1995, 1996, 1938,
+    1907, 1932, 1990, 1928, 1885, 1885, 1950, 1941, 1881, 1784, 1803, 1902, 1863, 1740, 1690, 1760,
+    1800, 1707, 1622, 1668, 1772, 1788, 1688, 1649, 1763, 1853, 1800, 1738, 1778, 1893, 1897, 1857,
+    1855, 1901, 1929, 1908, 1873, 1872, 1923, 1946, 1873, 1865, 1909, 1919, 1906, 1833, 1881, 1936,
+    1894, 1856, 1825, 1900, 1943, 1848, 1784, 1855, 1900, 1883, 1799, 1788, 1871, 1909, 1828, 1775,
+    1822, 1872, 1824, 1764, 1728, 1794, 1844, 1779, 1742, 1772, 1809, 1739, 1693, 1730, 1747, 1762,
+    1700, 1690, 1761, 1770, 1720, 1667, 1730, 1772, 1748, 1715, 1658, 1740, 1761, 1716, 1691, 1726,
+    1780, 1771, 1705, 1667, 1811, 1792, 1743, 1705, 1781, 1873, 1827, 1760, 1773, 1846, 1839, 1805,
+    1792, 1807, 1843, 1807, 1786, 1781, 1844, 1819, 1769, 1791, 1819, 1859, 1776, 1780, 1842, 1917,
+    1859, 1799, 1854, 1896, 1913, 1872, 1834, 1900, 1968, 1982, 1890, 1875, 1994, 2074, 2086, 2150,
+    2310, 2567, 2808, 2987, 3138, 3043, 2721, 2252, 1752, 1472, 1388, 1366, 1488, 1667, 1822, 1852,
+    1849, 1882, 1948, 1997, 1954, 1933, 1984, 2029, 1984, 1930, 1946, 2017, 2027, 1913, 1908, 1981,
+    2027, 1981, 1910, 1917, 1968, 2003, 1922, 1906, 1962, 1972, 1967, 1932, 1938, 1974, 1960, 1895,
+    1924, 1966, 1977, 1938, 1911, 1966, 2010, 1937, 1893, 1945, 2005, 2004, 1950, 1931, 1981, 2027,
+    2002, 1915, 1959, 2043, 2029, 1987, 1953, 2067, 2088, 2023, 1975, 1996, 2042, 2001, 1938, 1953,
+    2029, 2010, 1925, 1891, 1928, 1998, 1895, 1827, 1852, 1921, 1892, 1759, 1789, 1911, 1902, 1819,
+    1802, 1897, 1976, 1924, 1875, 1928, 2023, 2016, 1949, 1956, 2032, 2073, 2009, 1983, 2013, 2051,
+    2053, 1970, 1994, 2054, 2042, 2010, 1977, 2010, 2071, 1998, 1956, 1999, 2038, 2016, 1944, 1949,
+    2033, 2033, 1966, 1929, 1993, 2028, 1962, 1899, 1905, 1975, 1996, 1924, 1882, 1941, 1995, 1917,
+    1842, 1892, 1936, 1933, 1856, 1840, 1917, 1933, 1920, 1835, 1886, 1932, 1931, 1904, 1839, 1914,
+    1931, 1893, 1891, 1922, 1944, 1946, 1890, 1879, 1995, 1966, 1923, 1910, 1990, 2066, 2003, 1930,
+    1975, 2060, 2028, 1989, 1965, 2005, 2068, 1991, 1970, 1957, 2051, 2034, 1973, 1972, 2006, 2069,
+    2003, 1974, 2038, 2090, 2079, 2027, 2066, 2079, 2094, 2076, 2064, 2116, 2147, 2154, 2104, 2088,
+    2193, 2254, 2270, 2338, 2522, 2783, 3002, 3174, 3342, 3276, 2928, 2443, 1932, 1681, 1611, 1580,
+    1680, 1864, 2032, 2067, 2052, 2087, 2152, 2205, 2176, 2143, 2178, 2228, 2183, 2144, 2152, 2202,
+    2213, 2131, 2128, 2181, 2211, 2159, 2114, 2120, 2176, 2193, 2106, 2114, 2190, 2186, 2148, 2114,
+    2127, 2185, 2176, 2082, 2095, 2183, 2187, 2144, 2083, 2143, 2196, 2156, 2093, 2117, 2175, 2199,
+    2165, 2121, 2160, 2193, 2184, 2115, 2142, 2164, 2185, 2175, 2130, 2184, 2226, 2194, 2165, 2147,
+    2202, 2207, 2183, 2160, 2174, 2229, 2227, 2135, 2085, 2189, 2183, 2111, 2061, 2084, 2142, 2083,
+    2004, 1994, 2053, 2099, 2070, 2008, 2038, 2090, 2107, 2093, 2036, 2093, 2170, 2146, 2118, 2084,
+    2148, 2207, 2140, 2080, 2124, 2170, 2160, 2090, 2068, 2142, 2157, 2100, 2062, 2110, 2144, 2080,
+    2027, 2029, 2093, 2104, 2033, 2003, 2072, 2104, 2009, 1949, 1995, 2049, 2041, 1951, 1945, 2030,
+    2059, 2021, 1926, 1984, 2020, 2026, 1977, 1907, 1997, 2023, 1995, 1963, 1997, 2035, 2031, 1992,
+    1963, 2050, 2036, 1991, 1991, 2055, 2119, 2069, 2018, 2042, 2124, 2085, 2054, 2043, 2073, 2119,
+    2038, 2017, 2033, 2104, 2089, 2018, 2012, 2053, 2117, 2037, 2011, 2071, 2148, 2121, 2059, 2074,
+    2103, 2139, 2122, 2079, 2124, 2182, 2198, 2134, 2102, 2211, 2265, 2302, 2384, 2540, 2786, 2997,
+    3196, 3359, 3286, 2917, 2438, 1953, 1695, 1597, 1574, 1659, 1855, 2025, 2073, 2037, 2061, 2145,
+    2195, 2149, 2109, 2134, 2211, 2171, 2127, 2108, 2165, 2192, 2099, 2095, 2154, 2172, 2140, 2083,
+    2077, 2121, 2152, 2075, 2076, 2129, 2128, 2095, 2059, 2079, 2121, 2104, 2015, 2045, 2118, 2132,
+    2071, 2012, 2093, 2137, 2073, 2005, 2028, 2101, 2120, 2071, 2022, 2063, 2108, 2079, 2017, 2055,
+    2081, 2067, 2066, 2058, 2136, 2103, 2086, 2097, 2118, 2138, 2039, 2060, 2149, 2157, 2091, 2040,
+    2060, 2096, 2123, 2010, 1976, 1990, 2033, 1979, 1876, 1895, 1962, 1938, 1894, 1886, 1922, 1962,
+    1894, 1908, 1962, 1969, 1973, 1926, 1992, 2036, 1981, 1930, 1988, 2035, 2008, 1922, 1924, 2018,
+    2038, 1941, 1888, 1944, 2019, 1957, 1871, 1865, 1923, 1963, 1896, 1831, 1877, 1939, 1873, 1803,
+    1832, 1857, 1863, 1814, 1797, 1866, 1859, 1844, 1765, 1825, 1858, 1838, 1817, 1762, 1823, 1837,
+    1798, 1782, 1828, 1864, 1845, 1787, 1770, 1884, 1860, 1817, 1796, 1866, 1961, 1902, 1834, 1842,
+    1924, 1913, 1870, 1837, 1866, 1910, 1867, 1826, 1825, 1902, 1885, 1830, 1830, 1858, 1911, 1841,
+    1841, 1883, 1939, 1903, 1870, 1898, 1927, 1926, 1890, 1888, 1948, 1995, 1984, 1904, 1896, 2011,
+    2096, 2082, 2150, 2334, 2604, 2808, 2977, 3144, 3078, 2730, 2256, 1746, 1482, 1397, 1379, 1473,
+    1643, 1812, 1852, 1846, 1868, 1923, 1980, 1953, 1922, 1949, 2003, 1942, 1906, 1923, 1989, 1994,
+    1883, 1874, 1959, 1977, 1919, 1873, 1888, 1935, 1958, 1857, 1853, 1936, 1942, 1910, 1858, 1864,
+    1922, 1906, 1837, 1841, 1895, 1926, 1870, 1843, 1876, 1923, 1878, 1829, 1861, 1906, 1919, 1881,
+    1846, 1892, 1935, 1896, 1843, 1884, 1934, 1914, 1867, 1828, 1943, 1987, 1889, 1821, 1862, 1959,
+    1914, 1806, 1819, 1935, 1959, 1875, 1748, 1823, 1983, 1874, 1731, 1723, 1829, 1852, 1728, 1673,
+    1755, 1819, 1779, 1703, 1705, 1826, 1834, 1743, 1737, 1828, 1885, 1830, 1763, 1826, 1895, 1868,
+    1813, 1797, 1875, 1913, 1822, 1759, 1827, 1897, 1870, 1771, 1767, 1853, 1873, 1803, 1740, 1786,
+    1849, 1805, 1727, 1708, 1765, 1812, 1746, 1713, 1749, 1787, 1721, 1668, 1710, 1732, 1727, 1665,
+    1665, 1737, 1737, 1712, 1643, 1712, 1741, 1717, 1672, 1625, 1718, 1735, 1686, 1658, 1701, 1754,
+    1757, 1676, 1664, 1778, 1762, 1719, 1690, 1759, 1840, 1803, 1747, 1739, 1825, 1816, 1788, 1755,
+    1786, 1829, 1782, 1756, 1749, 1817, 1793, 1741, 1761, 1815, 1839, 1756, 1751, 1828, 1884, 1846,
+    1778, 1819, 1864, 1891, 1833, 1805, 1877, 1930, 1944, 1850, 1833, 1970, 2031, 2061, 2111, 2276,
+    2552, 2792, 2958, 3118, 3024, 2692, 2236, 1726, 1450, 1354, 1346, 1458, 1640, 1797, 1823, 1813,
+    1873, 1921, 1974, 1922, 1899, 1960, 2004, 1949, 1892, 1918, 1992, 2002, 1887, 1868, 1959, 1990,
+    1951, 1882, 1883, 1947, 1980, 1890, 1882, 1951, 1946, 1945, 1897, 1904, 1943, 1939, 1876, 1874,
+    1928, 1961, 1902, 1875, 1929, 1975, 1917, 1860, 1921, 1973, 1977, 1921, 1901, 1964, 2000, 1977,
+    1901, 1944, 1999, 1998, 1959, 1921, 2033, 2074, 2002, 1953, 1959, 2042, 1998, 1947, 1936, 1989,
+    1998, 1950, 1876, 1876, 1959, 1908, 1831, 1762, 1828, 1857, 1772, 1711, 1763, 1835, 1834, 1774,
+    1744, 1864, 1924, 1866, 1820, 1886, 1995, 1982, 1937, 1944, 2005, 2049, 1999, 1944, 1996, 2057,
+    2078, 1983, 1949, 2018, 2045, 2033, 1944, 1974, 2041, 2033, 1984, 1947, 1999, 2071, 1994, 1934,
+    1966, 2017, 2013, 1934, 1933, 2001, 2011, 1954, 1913, 1971, 2015, 1947, 1891, 1900, 1955, 1983,
+    1895, 1861, 1935, 1971, 1882, 1822, 1875, 1922, 1928, 1835, 1814, 1917, 1929, 1903, 1801, 1863,
+    1922, 1924, 1886, 1809, 1889, 1912, 1895, 1863, 1899, 1929, 1927, 1890, 1862, 1965, 1958, 1906,
+    1903, 1975, 2030, 1993, 1943, 1965, 2049, 2024, 1969, 1969, 2021, 2044, 1985, 1940, 1960, 2045,
+    2026, 1953, 1960, 2019, 2080, 1987, 1959, 2020, 2093, 2075, 2011, 2036, 2072, 2108, 2075, 2037,
+    2100, 2155, 2168, 2099, 2079, 2175, 2236, 2279, 2359, 2523, 2777, 2986, 3174, 3368, 3267, 2912,
+    2442, 1936, 1691, 1605, 1565, 1653, 1863, 2046, 2062, 2056, 2081, 2155, 2215, 2176, 2129, 2164,
+    2233, 2186, 2154, 2129, 2199, 2222, 2134, 2122, 2181, 2204, 2173, 2141, 2120, 2171, 2190, 2120,
+    2125, 2193, 2170, 2150, 2122, 2144, 2191, 2145, 2082, 2104, 2191, 2187, 2117, 2095, 2168, 2214,
+    2145, 2077, 2120, 2195, 2216, 2166, 2120, 2168, 2227, 2214, 2132, 2148, 2208, 2215, 2192, 2157,
+    2248, 2271, 2220, 2184, 2188, 2226, 2182, 2134, 2133, 2208, 2209, 2128, 2029, 2097, 2200, 2112,
+    1985, 1978, 2088, 2119, 1973, 1896, 2019, 2129, 2065, 1944, 1977, 2101, 2152, 2095, 2050, 2125,
+    2208, 2184, 2130, 2130, 2204, 2238, 2175, 2142, 2192, 2221, 2195, 2132, 2162, 2210, 2180, 2160,
+    2129, 2191, 2230, 2134, 2102, 2148, 2203, 2169, 2093, 2090, 2176, 2195, 2109, 2057, 2111, 2175,
+    2128, 2046, 2024, 2103, 2142, 2063, 2015, 2065, 2107, 2056, 1978, 2013, 2042, 2046, 1995, 1986,
+    2048, 2047, 2028, 1966, 2027, 2043, 2027, 2001, 1949, 2032, 2036, 1996, 1986, 2027, 2056, 2031,
+    1981, 1968, 2098, 2070, 2009, 1992, 2070, 2150, 2097, 2032, 2044, 2130, 2117, 2087, 2038, 2082,
+    2129, 2084, 2050, 2041, 2097, 2097, 2044, 2037, 2084, 2127, 2051, 2047, 2104, 2169, 2134, 2084,
+    2111, 2150, 2160, 2114, 2098, 2162, 2212, 2207, 2130, 2134, 2244, 2304, 2308, 2383, 2567, 2839,
+    3035, 3205, 3373, 3299, 2959, 2482, 1982, 1693, 1626, 1606, 1703, 1889, 2034, 2084, 2074, 2107,
+    2160, 2206, 2190, 2154, 2185, 2222, 2179, 2144, 2172, 2206, 2210, 2099, 2102, 2191, 2210, 2154,
+    2099, 2106, 2171, 2198, 2095, 2084, 2166, 2173, 2137, 2083, 2095, 2149, 2126, 2069, 2074, 2111,
+    2148, 2097, 2055, 2111, 2159, 2108, 2054, 2092, 2138, 2147, 2106, 2073, 2133, 2153, 2133, 2070,
+    2094, 2154, 2128, 2095, 2071, 2167, 2177, 2118, 2081, 2093, 2133, 2083, 2066, 2069, 2090, 2105,
+    2098, 2042, 2014, 2042, 2041, 2038, 1975, 1944, 1987, 1960, 1951, 1951, 1951, 1969, 1991, 1961,
+    1955, 1969, 2012, 2044, 1990, 1999, 2033, 2067, 2062, 2003, 2027, 2088, 2067, 2041, 1994, 2042,
+    2088, 2013, 1982, 2022, 2041, 2030, 1961, 1961, 2032, 2034, 1975, 1922, 1981, 2032, 1957, 1891,
+    1898, 1956, 2008, 1892, 1857, 1929, 1969, 1891, 1821, 1857, 1893, 1916, 1831, 1811, 1878, 1893,
+    1873, 1787, 1835, 1885, 1881, 1848, 1771, 1839, 1856, 1837, 1819, 1855, 1869, 1874, 1824, 1814,
+    1917, 1879, 1829, 1824, 1912, 1981, 1912, 1860, 1882, 1969, 1926, 1890, 1875, 1916, 1968, 1911,
+    1860, 1839, 1941, 1922, 1858, 1856, 1889, 1958, 1882, 1855, 1905, 1980, 1944, 1900, 1926, 1940,
+    1963, 1932, 1908, 1965, 2007, 2018, 1954, 1930, 2041, 2105, 2111, 2187, 2379, 2633, 2834, 3013,
+    3195, 3111, 2765, 2287, 1780, 1527, 1432, 1409, 1493, 1674, 1849, 1895, 1875, 1899, 1964, 2024,
+    1987, 1949, 1986, 2032, 1995, 1948, 1962, 2015, 2016, 1920, 1925, 1991, 2011, 1969, 1910, 1913,
+    1971, 1988, 1898, 1896, 1977, 1971, 1940, 1887, 1917, 1973, 1948, 1862, 1876, 1948, 1977, 1906,
+    1880, 1928, 1968, 1933, 1859, 1885, 1956, 1952, 1921, 1890, 1916, 1968, 1944, 1870, 1896, 1946,
+    1967, 1919, 1856, 1974, 2028, 1963, 1890, 1930, 2008, 1981, 1897, 1857, 1986, 2051, 1951, 1821,
+    1872, 2031, 1954, 1823, 1781, 1879, 1934, 1806, 1717, 1761, 1850, 1867, 1762, 1737, 1825, 1866,
+    1841, 1757, 1814, 1906, 1902, 1857, 1826, 1901, 1941, 1870, 1836, 1881, 1908, 1905, 1814, 1824,
+    1912, 1918, 1858, 1793, 1860, 1908, 1838, 1763, 1770, 1835, 1879, 1780, 1747, 1804, 1852, 1785,
+    1700, 1750, 1796, 1798, 1730, 1701, 1774, 1781, 1782, 1699, 1745, 1772, 1781, 1753, 1693, 1740,
+    1768, 1745, 1722, 1771, 1777, 1788, 1744, 1719, 1826, 1800, 1752, 1751, 1834, 1904, 1843, 1774,
+    1806, 1886, 1878, 1818, 1793, 1859, 1904, 1833, 1802, 1810, 1885, 1864, 1806, 1809, 1841, 1897,
+    1847, 1803, 1861, 1916, 1901, 1856, 1891, 1900, 1934, 1896, 1895, 1935, 1984, 1977, 1916, 1916,
+    2035, 2073, 2095, 2177, 2357, 2622, 2827, 3008, 3167, 3095, 2771, 2282, 1757, 1511, 1439, 1404,
+    1500, 1674, 1855, 1916, 1886, 1914, 1979, 2029, 2006, 1969, 2003, 2046, 2013, 1984, 1985, 2030,
+    2037, 1958, 1960, 2015, 2034, 1997, 1953, 1966, 2018, 2031, 1934, 1950, 2022, 2017, 1986, 1958,
+    1966, 2026, 2001, 1917, 1931, 2009, 2027, 1978, 1929, 1981, 2055, 1989, 1934, 1961, 2024, 2036,
+    1995, 1971, 2003, 2057, 2043, 1977, 2010, 2053, 2050, 2027, 2000, 2093, 2104, 2043, 2015, 2021,
+    2073, 2026, 1983, 1985, 2019, 2046, 2022, 1941, 1926, 2010, 1985, 1930, 1874, 1884, 1970, 1939,
+    1868, 1828, 1890, 1952, 1931, 1901, 1926, 1981, 2010, 1976, 1967, 1999, 2060, 2072, 2016, 1996,
+    2051, 2093, 2083, 2012, 2025, 2104, 2079, 2040, 2013, 2067, 2101, 2031, 1986, 2042, 2072, 2054,
+    1990, 1986, 2071, 2077, 2004, 1957, 2036, 2065, 2009, 1952, 1941, 2004, 2053, 1958, 1919, 1986,
+    2032, 1967, 1889, 1925, 1977, 1986, 1908, 1884, 1965, 1980, 1960, 1882, 1938, 1980, 1987, 1956,
+    1878, 1957, 1958, 1942, 1933, 1966, 1985, 1986, 1950, 1931, 2032, 2019, 1958, 1955, 2039, 2116,
+    2043, 1987, 2015, 2112, 2070, 2043, 2021, 2055, 2113, 2052, 2004, 2018, 2103, 2096, 2037, 2025,
+    2063, 2126, 2055, 2033, 2091, 2146, 2127, 2085, 2117, 2135, 2149, 2127, 2124, 2165, 2215, 2209,
+    2156, 2143, 2246, 2312, 2324, 2412, 2587, 2838, 3056, 3248, 3404, 3329, 2985, 2500, 1993, 1747,
+    1681, 1647, 1733, 1918, 2099, 2140, 2117, 2140, 2202, 2278, 2242, 2205, 2237, 2281, 2245, 2211,
+    2207, 2263, 2283, 2186, 2180, 2247, 2275, 2228, 2192, 2205, 2243, 2265, 2170, 2176, 2259, 2258,
+    2206, 2165, 2207, 2264, 2237, 2154, 2158, 2231, 2257, 2207, 2158, 2203, 2262, 2229, 2153, 2190,
+    2243, 2261, 2223, 2196, 2243, 2272, 2260, 2198, 2231, 2274, 2272, 2246, 2227, 2320, 2332, 2276,
+    2237, 2274, 2331, 2265, 2203, 2237, 2294, 2290, 2218, 2163, 2170, 2244, 2156, 2086, 2087, 2118,
+    2104, 2024, 2017, 2065, 2060, 2051, 2073, 2089, 2088, 2077, 2126, 2191, 2184, 2148, 2166, 2249,
+    2262, 2247, 2205, 2256, 2321, 2275, 2234, 2238, 2304, 2316, 2253, 2209, 2264, 2298, 2277, 2199,
+    2215, 2293, 2277, 2224, 2195, 2230, 2297, 2225, 2170, 2222, 2253, 2231, 2165, 2169, 2251, 2251,
+    2179, 2138, 2202, 2245, 2179, 2115, 2111, 2182, 2212, 2118, 2078, 2135, 2207, 2105, 2041, 2086,
+    2121, 2129, 2066, 2035, 2108, 2124, 2106, 2027, 2079, 2117, 2122, 2083, 2020, 2076, 2099, 2070,
+    2061, 2090, 2125, 2109, 2077, 2042, 2155, 2135, 2090, 2072, 2151, 2227, 2151, 2091, 2143, 2207,
+    2185, 2147, 2119, 2164, 2213, 2162, 2123, 2106, 2187, 2170, 2118, 2114, 2153, 2206, 2140, 2118,
+    2170, 2232, 2209, 2159, 2181, 2208, 2219, 2197, 2178, 2224, 2289, 2276, 2222, 2197, 2309, 2375,
+    2373, 2461, 2646, 2894, 3104, 3280, 3455, 3375, 3031, 2546, 2035, 1785, 1702, 1676, 1771, 1947,
+    2122, 2157, 2141, 2158, 2222, 2287, 2258, 2225, 2247, 2288, 2262, 2223, 2217, 2277, 2278, 2184,
+    2192, 2254, 2276, 2229, 2177, 2190, 2242, 2246, 2159, 2172, 2246, 2230, 2200, 2151, 2182, 2241,
+    2204, 2123, 2135, 2209, 2234, 2172, 2118, 2182, 2216, 2173, 2112, 2142, 2203, 2223, 2178, 2140,
+    2185, 2219, 2210, 2150, 2175, 2220, 2215, 2186, 2151, 2243, 2254, 2201, 2168, 2178, 2223, 2167,
+    2137, 2128, 2162, 2179, 2135, 2076, 2057, 2132, 2111, 2051, 1995, 2005, 2078, 2049, 1971, 1952,
+    2003, 2066, 2039, 1993, 2018, 2084, 2099, 2078, 2042, 2083, 2145, 2162, 2106, 2081, 2130, 2158,
+    2149, 2078, 2094, 2164, 2147, 2097, 2056, 2115, 2164, 2086, 2051, 2083, 2117, 2101, 2027, 2034,
+    2102, 2101, 2040, 1991, 2057, 2097, 2040, 1953, 1954, 2020, 2068, 1959, 1929, 1978, 2040, 1958,
+    1874, 1932, 1964, 1970, 1900, 1878, 1946, 1965, 1939, 1873, 1923, 1947, 1936, 1924, 1845, 1922,
+    1926, 1898, 1884, 1910, 1937, 1946, 1902, 1881, 1977, 1955, 1904, 1893, 1959, 2048, 1978, 1924,
+    1936, 2036, 2004, 1975, 1941, 1975, 2023, 1967, 1924, 1925, 2002, 1993, 1931, 1919, 1966, 2010,
+    1948, 1925, 1978, 2042, 2001, 1961, 1988, 2023, 2042, 2005, 1983, 2042, 2076, 2076, 2028, 2004,
+    2108, 2174, 2193, 2269, 2442, 2689, 2908, 3093, 3263, 3179, 2834, 2356, 1837, 1576, 1505, 1487,
+    1585, 1747, 1930, 1962, 1945, 1968, 2029, 2091, 2070, 2024, 2050, 2103, 2059, 2036, 2039, 2087,
+    2090, 1998, 1987, 2060, 2084, 2035, 1984, 1989, 2045, 2066, 1963, 1974, 2057, 2037, 1995, 1961,
+    1987, 2045, 2026, 1930, 1946, 2019, 2043, 1977, 1937, 1997, 2037, 1997, 1928, 1957, 2012, 2054,
+    2001, 1960, 2012, 2033, 2020, 1966, 1965, 1996, 2017, 2007, 1963, 2016, 2048, 2043, 2008, 1982,
+    2041, 2023, 2007, 1978, 1998, 2059, 2065, 1954, 1913, 2016, 2008, 1935, 1875, 1909, 1962, 1896,
+    1834, 1833, 1870, 1928, 1906, 1824, 1854, 1913, 1941, 1906, 1869, 1919, 1992, 1972, 1931, 1914,
+    1966, 2032, 1961, 1901, 1946, 1988, 1978, 1906, 1905, 1963, 1972, 1923, 1886, 1934, 1959, 1903,
+    1847, 1866, 1898, 1941, 1860, 1830, 1891, 1923, 1842, 1773, 1824, 1881, 1871, 1795, 1776, 1852,
+    1880, 1842, 1750, 1819, 1871, 1878, 1826, 1745, 1829, 1853, 1825, 1806, 1840, 1855, 1876, 1834,
+    1811, 1893, 1869, 1839, 1836, 1900, 1976, 1912, 1863, 1895, 1966, 1924, 1899, 1888, 1945, 1971,
+    1902, 1880, 1877, 1963, 1951, 1871, 1869, 1942, 1981, 1913, 1871, 1939, 2015, 1998, 1927, 1952,
+    1982, 2023, 1979, 1962, 2005, 2043, 2067, 2013, 1990, 2090, 2151, 2187, 2267, 2437, 2683, 2887,
+    3095, 3262, 3178, 2814, 2355, 1859, 1598, 1505, 1476, 1570, 1778, 1939, 1968, 1956, 1988, 2066,
+    2122, 2076, 2031, 2063, 2134, 2101, 2056, 2049, 2103, 2139, 2043, 2036, 2085, 2117, 2078, 2049,
+    2041, 2076, 2099, 2017, 2030, 2093, 2083, 2054, 2028, 2060, 2094, 2073, 2002, 2021, 2096, 2098,
+    2038, 1994, 2070, 2133, 2065, 1997, 2021, 2119, 2117, 2081, 2028, 2082, 2125, 2119, 2024, 2038,
+    2095, 2124, 2095, 2031, 2131, 2189, 2143, 2048, 2085, 2167, 2162, 2074, 2049, 2172, 2241, 2139,
+    2029, 2051, 2207, 2132, 2012, 1976, 2083, 2123, 1986, 1906, 1973, 2078, 2055, 1945, 1916, 2041,
+    2087, 2046, 1956, 2035, 2132, 2116, 2057, 2041, 2109, 2176, 2101, 2056, 2091, 2127, 2136, 2057,
+    2052, 2125, 2142, 2084, 2033, 2094, 2126, 2070, 2012, 2020, 2079, 2111, 2022, 2005, 2050, 2095,
+    2018, 1943, 2007, 2044, 2039, 1959, 1951, 2031, 2052, 2039, 1928, 1995, 2038, 2064, 2014, 1931,
+    2007, 2037, 2012, 1990, 2013, 2045, 2065, 2007, 1989, 2079, 2070, 2039, 2023, 2102, 2176, 2113,
+    2076, 2085, 2167, 2133, 2085, 2085, 2127, 2166, 2106, 2071, 2087, 2169, 2138, 2080, 2070, 2137,
+    2197, 2113, 2084, 2148, 2212, 2202, 2148, 2155, 2192, 2220, 2193, 2166, 2212, 2272, 2271, 2215,
+    2202, 2300, 2359, 2397, 2480, 2639, 2910, 3110, 3309, 3486, 3392, 3040, 2560, 2062, 1811, 1728,
+    1700, 1784, 1996, 2168, 2195, 2170, 2195, 2279, 2334, 2293, 2261, 2287, 2342, 2306, 2274, 2263,
+    2316, 2354, 2257, 2245, 2297, 2322, 2296, 2251, 2257, 2297, 2313, 2249, 2257, 2309, 2303, 2270,
+    2239, 2273, 2313, 2280, 2198, 2233, 2310, 2316, 2250, 2223, 2282, 2337, 2280, 2211, 2243, 2312,
+    2343, 2279, 2248, 2285, 2340, 2323, 2258, 2273, 2322, 2335, 2315, 2289, 2367, 2394, 2342, 2310,
+    2306, 2348, 2288, 2239, 2270, 2344, 2304, 2211, 2202, 2245, 2323, 2190, 2118, 2142, 2246, 2222,
+    2058, 2083, 2216, 2232, 2134, 2100, 2180, 2251, 2240, 2180, 2223, 2296, 2297, 2254, 2267, 2315,
+    2340, 2293, 2271, 2328, 2337, 2327, 2257, 2292, 2357, 2313, 2254, 2250, 2316, 2357, 2279, 2222,
+    2265, 2336, 2311, 2211, 2202, 2295, 2319, 2248, 2183, 2235, 2300, 2255, 2179, 2161, 2215, 2265,
+    2195, 2155, 2194, 2231, 2162, 2114, 2149, 2171, 2163, 2104, 2109, 2177, 2180, 2154, 2072, 2149,
+    2192, 2161, 2115, 2066, 2165, 2164, 2124, 2088, 2140, 2185, 2172, 2109, 2085, 2208, 2199, 2160,
+    2122, 2194, 2284, 2241, 2173, 2164, 2245, 2229, 2216, 2195, 2205, 2251, 2206, 2179, 2185, 2243,
+    2221, 2174, 2171, 2209, 2261, 2166, 2168, 2236, 2303, 2253, 2194, 2235, 2279, 2295, 2250, 2209,
+    2277, 2346, 2347, 2260, 2235, 2355, 2444, 2457, 2510, 2671, 2949, 3165, 3355, 3508, 3403, 3077,
+    2629, 2113, 1828, 1734, 1718, 1840, 2019, 2173, 2199, 2196, 2246, 2303, 2330, 2290, 2273, 2327,
+    2377, 2307, 2250, 2284, 2353, 2354, 2251, 2236, 2298, 2342, 2300, 2228, 2221, 2302, 2317, 2224,
+    2210, 2275, 2280, 2267, 2226, 2222, 2274, 2250, 2189, 2202, 2255, 2279, 2229, 2173, 2260, 2286,
+    2221, 2161, 2226, 2272, 2270, 2209, 2187, 2246, 2289, 2255, 2181, 2229, 2294, 2286, 2237, 2209,
+    2305, 2332, 2282, 2221, 2246, 2311, 2257, 2213, 2209, 2256, 2264, 2205, 2132, 2145, 2194, 2111,
+    2062, 2058, 2080, 2027, 1983, 1988, 2039, 2008, 1982, 2013, 2047, 2077, 2012, 2037, 2135, 2135,
+    2106, 2108, 2159, 2209, 2189, 2161, 2198, 2240, 2212, 2165, 2185, 2224, 2225, 2165, 2153, 2203,
+    2200, 2188, 2127, 2165, 2210, 2186, 2121, 2104, 2179, 2220, 2131, 2069, 2124, 2175, 2150, 2061,
+    2057, 2139, 2159, 2088, 2018, 2078, 2125, 2086, 2015, 2004, 2048, 2087, 2025, 1987, 2019, 2058,
+    1991, 1949, 1985, 2003, 1988, 1937, 1941, 1995, 1989, 1959, 1890, 1969, 1999, 1975, 1945, 1881,
+    1966, 1979, 1933, 1908, 1957, 1982, 1997, 1920, 1888, 2017, 2011, 1954, 1926, 1985, 2071, 2038,
+    1974, 1979, 2047, 2039, 2025, 1977, 2004, 2044, 2008, 1988, 1967, 2045, 2007, 1960, 1965, 2012,
+    2034, 1965, 1956, 2018, 2088, 2037, 1981, 2017, 2068, 2074, 2026, 2005, 2071, 2128, 2132, 2054,
+    2032, 2138, 2226, 2236, 2290, 2464, 2737, 2954, 3128, 3294, 3198, 2869, 2385, 1886, 1608, 1524,
+    1506, 1618, 1802, 1947, 1976, 1971, 2025, 2070, 2123, 2067, 2051, 2105, 2153, 2096, 2036, 2049,
+    2132, 2134, 2023, 2002, 2091, 2115, 2076, 2007, 2017, 2076, 2100, 2019, 1996, 2056, 2068, 2049,
+    2009, 2010, 2048, 2050, 1974, 1986, 2048, 2055, 2016, 1974, 2038, 2077, 2014, 1947, 1995, 2064,
+    2059, 2011, 1981, 2044, 2084, 2039, 1974, 2008, 2081, 2092, 2020, 2001, 2086, 2133, 2058, 2005,
+    1995, 2071, 2067, 1982, 1954, 2021, 2063, 2020, 1903, 1916, 2030, 1998, 1884, 1828, 1916, 2001,
+    1859, 1779, 1845, 1946, 1933, 1868, 1865, 1948, 1998, 1933, 1895, 1951, 2028, 2042, 1952, 1946,
+    2024, 2048, 2020, 1940, 1991, 2057, 2035, 1979, 1941, 2016, 2067, 1983, 1921, 1954, 2016, 2018,
+    1929, 1906, 1979, 2011, 1959, 1896, 1944, 1994, 1943, 1889, 1875, 1930, 1950, 1890, 1859, 1905,
+    1938, 1860, 1795, 1869, 1894, 1874, 1805, 1808, 1893, 1902, 1854, 1768, 1843, 1896, 1886, 1822,
+    1769, 1850, 1882, 1852, 1807, 1847, 1882, 1897, 1835, 1810, 1904, 1901, 1872, 1844, 1919, 1990,
+    1943, 1899, 1902, 1981, 1957, 1926, 1905, 1949, 1972, 1924, 1903, 1919, 1981, 1944, 1882, 1894,
+    1971, 2005, 1911, 1890, 1971, 2036, 2007, 1948, 1971, 2004, 2040, 2005, 1966, 2022, 2092, 2107,
+    2029, 1988, 2102, 2187, 2216, 2281, 2433, 2711, 2921, 3133, 3285, 3181, 2838, 2374, 1890, 1612,
+    1513, 1480, 1603, 1801, 1962, 1980, 1957, 2022, 2092, 2140, 2079, 2046, 2098, 2168, 2107, 2065,
+    2063, 2133, 2160, 2050, 2043, 2097, 2136, 2108, 2056, 2035, 2096, 2136, 2049, 2047, 2111, 2113,
+    2088, 2053, 2068, 2111, 2086, 2019, 2054, 2115, 2112, 2053, 2023, 2102, 2137, 2073, 2008, 2060,
+    2131, 2133, 2066, 2032, 2103, 2133, 2108, 2043, 2090, 2137, 2108, 2094, 2073, 2171, 2164, 2129,
+    2125, 2158, 2187, 2096, 2118, 2200, 2205, 2143, 2117, 2124, 2162, 2186, 2079, 2054, 2084, 2101,
+    2055, 1967, 2000, 2061, 2029, 1967, 1973, 2032, 2070, 1991, 2000, 2058, 2083, 2074, 2040, 2095,
+    2137, 2098, 2056, 2101, 2141, 2121, 2057, 2057, 2153, 2152, 2093, 2032, 2102, 2147, 2081, 2014,
+    2020, 2084, 2115, 2041, 1999, 2059, 2110, 2041, 1956, 2001, 2038, 2050, 1972, 1953, 2028, 2044,
+    2031, 1949, 2008, 2061, 2048, 2021, 1950, 2024, 2040, 2009, 1995, 2040, 2063, 2053, 2004, 1999,
+    2105, 2076, 2037, 2027, 2102, 2190, 2120, 2058, 2088, 2185, 2143, 2101, 2079, 2131, 2177, 2119,
+    2071, 2078, 2166, 2153, 2102, 2086, 2137, 2191, 2107, 2106, 2154, 2205, 2194, 2141, 2180, 2200,
+    2215, 2196, 2180, 2244, 2283, 2278, 2212, 2197, 2311, 2378, 2383, 2469, 2654, 2921, 3106, 3292,
+    3471, 3389, 3039, 2571, 2062, 1805, 1721, 1704, 1788, 1975, 2153, 2187, 2180, 2199, 2274, 2342,
+    2293, 2250, 2284, 2357, 2308, 2270, 2280, 2328, 2331, 2255, 2257, 2316, 2334, 2288, 2230, 2255,
+    2301, 2317, 2223, 2235, 2298, 2299, 2277, 2232, 2252, 2313, 2277, 2214, 2219, 2297, 2307, 2257,
+    2209, 2260, 2326, 2265, 2211, 2233, 2303, 2327, 2277, 2239, 2282, 2319, 2284, 2220, 2258, 2321,
+    2297, 2240, 2255, 2376, 2374, 2274, 2257, 2329, 2409, 2319, 2215, 2305, 2437, 2396, 2263, 2205,
+    2306, 2389, 2289, 2162, 2193, 2298, 2280, 2125, 2089, 2189, 2256, 2170, 2101, 2144, 2230, 2224,
+    2136, 2156, 2264, 2268, 2227, 2186, 2256, 2318, 2250, 2195, 2257, 2312, 2278, 2201, 2196, 2287,
+    2305, 2226, 2170, 2234, 2286, 2237, 2168, 2146, 2203, 2260, 2173, 2111, 2162, 2222, 2164, 2093,
+    2116, 2157, 2159, 2105, 2083, 2152, 2161, 2143, 2066, 2132, 2156, 2144, 2126, 2074, 2130, 2149,
+    2116, 2088, 2140, 2164, 2158, 2091, 2081, 2201, 2179, 2116, 2101, 2188, 2271, 2209, 2143, 2151,
+    2232, 2236, 2205, 2158, 2196, 2238, 2188, 2153, 2148, 2233, 2212, 2169, 2172, 2189, 2239, 2163,
+    2156, 2216, 2262, 2239, 2193, 2235, 2245, 2270, 2214, 2202, 2284, 2322, 2320, 2242, 2230, 2352,
+    2414, 2420, 2487, 2672, 2941, 3155, 3320, 3498, 3407, 3075, 2598, 2078, 1816, 1729, 1709, 1811,
+    1993, 2147, 2197, 2188, 2216, 2277, 2299, 2279, 2255, 2295, 2334, 2286, 2249, 2266, 2322, 2324,
+    2219, 2224, 2280, 2325, 2266, 2215, 2206, 2271, 2290, 2188, 2192, 2267, 2275, 2246, 2198, 2203,
+    2253, 2246, 2174, 2176, 2222, 2268, 2216, 2174, 2211, 2251, 2214, 2150, 2199, 2241, 2245, 2208,
+    2188, 2239, 2261, 2231, 2178, 2214, 2262, 2249, 2198, 2179, 2281, 2302, 2244, 2208, 2216, 2283,
+    2221, 2160, 2174, 2239, 2227, 2153, 2106, 2126, 2172, 2078, 2033, 2028, 2071, 2033, 1948, 1960,
+    2041, 2029, 1970, 2007, 2077, 2084, 2017, 2020, 2101, 2152, 2134, 2096, 2150, 2199, 2191, 2122,
+    2136, 2205, 2225, 2159, 2111, 2169, 2192, 2184, 2109, 2115, 2168, 2158, 2130, 2087, 2137, 2168,
+    2105, 2075, 2092, 2127, 2106, 2042, 2041, 2119, 2131, 2049, 2002, 2071, 2111, 2048, 1971, 1983,
+    2052, 2084, 1986, 1944, 2002, 2045, 1974, 1898, 1946, 1982, 2003, 1901, 1894, 1954, 1978, 1961,
+    1877, 1915, 1969, 1956, 1929, 1874, 1921, 1936, 1926, 1908, 1932, 1961, 1949, 1896, 1883, 1982,
+    1966, 1912, 1905, 1968, 2066, 1985, 1932, 1957, 2035, 2009, 1969, 1940, 1994, 2049, 1982, 1934,
+    1926, 2022, 2011, 1933, 1924, 1970, 2026, 1956, 1924, 1991, 2041, 2022, 1974, 2003, 2018, 2033,
+    2015, 1987, 2036, 2085, 2094, 2026, 2010, 2119, 2183, 2188, 2263, 2452, 2708, 2902, 3085, 3254,
+    3192, 2842, 2352, 1830, 1588, 1513, 1470, 1574, 1750, 1924, 1971, 1949, 1984, 2030, 2088, 2060,
+    2019, 2055, 2105, 2068, 2018, 2024, 2082, 2087, 1986, 1989, 2036, 2083, 2025, 1976, 1984, 2038,
+    2051, 1965, 1970, 2039, 2032, 1999, 1958, 1979, 2032, 2010, 1916, 1943, 2008, 2032, 1987, 1919,
+    1984, 2039, 1977, 1915, 1951, 2012, 2023, 1990, 1947, 1998, 2027, 2013, 1940, 1988, 2025, 2029,
+    1990, 1979, 2076, 2077, 2015, 1981, 2010, 2055, 2001, 1939, 1959, 2021, 2005, 1923, 1871, 1915,
+    1966, 1860, 1789, 1810, 1868, 1845, 1738, 1747, 1835, 1826, 1775, 1790, 1857, 1868, 1823, 1825,
+    1900, 1943, 1916, 1897, 1950, 2005, 1976, 1932, 1943, 2025, 2027, 1945, 1910, 1982, 2019, 2004,
+    1899, 1922, 2013, 1982, 1939, 1899, 1942, 2015, 1944, 1883, 1925, 1962, 1954, 1890, 1867, 1928,
+    1946, 1899, 1861, 1895, 1928, 1886, 1828, 1823, 1879, 1906, 1821, 1801, 1848, 1890, 1808, 1736,
+    1804, 1843, 1847, 1753, 1743, 1826, 1832, 1812, 1725, 1792, 1826, 1835, 1783, 1711, 1803, 1817,
+    1795, 1763, 1793, 1835, 1837, 1795, 1756, 1853, 1847, 1810, 1803, 1870, 1939, 1877, 1832, 1847,
+    1934, 1904, 1868, 1855, 1899, 1938, 1865, 1833, 1850, 1936, 1926, 1844, 1828, 1891, 1945, 1869,
+    1838, 1900, 1973, 1942, 1885, 1915, 1944, 1969, 1948, 1931, 1964, 2029, 2035, 1982, 1940, 2049,
+    2119, 2145, 2230, 2388, 2652, 2856, 3045, 3235, 3132, 2761, 2317, 1805, 1570, 1469, 1430, 1535,
+    1733, 1904, 1929, 1914, 1948, 2024, 2078, 2030, 1992, 2020, 2102, 2058, 2012, 2009, 2070, 2092,
+    1998, 1981, 2044, 2059, 2033, 1995, 1991, 2039, 2062, 1983, 1992, 2067, 2052, 2018, 2001, 2018,
+    2054, 2017, 1940, 1966, 2049, 2058, 2003, 1946, 2028, 2083, 2035, 1946, 1992, 2071, 2079, 2024,
+    1985, 2036, 2094, 2082, 2004, 2018, 2073, 2085, 2047, 2013, 2089, 2101, 2068, 2071, 2061, 2059,
+    2035, 2031, 2054, 2054, 2059, 2039, 2019, 2010, 2027, 2013, 1998, 1943, 1937, 1977, 1937, 1917,
+    1939, 1960, 1973, 1970, 1946, 1959, 1994, 2029, 2019, 1985, 2009, 2055, 2080, 2055, 2001, 2047,
+    2121, 2097, 2043, 2004, 2086, 2142, 2073, 1998, 2042, 2108, 2095, 2017, 1993, 2075, 2094, 2034,
+    1986, 2024, 2066, 2026, 1983, 1960, 2016, 2048, 1983, 1956, 2006, 2027, 1944, 1910, 1960, 1988,
+    1988, 1904, 1916, 1982, 1999, 1961, 1879, 1953, 2003, 1993, 1942, 1872, 1967, 1987, 1955, 1923,
+    1960, 2003, 2012, 1954, 1924, 2033, 2031, 1985, 1963, 2026, 2107, 2061, 1998, 2025, 2094, 2067,
+    2039, 2047, 2076, 2115, 2035, 2026, 2030, 2110, 2082, 2024, 2020, 2079, 2141, 2035, 2009, 2104,
+    2161, 2135, 2073, 2105, 2139, 2176, 2129, 2096, 2164, 2209, 2234, 2156, 2119, 2234, 2324, 2336,
+    2408, 2580, 2832, 3060, 3255, 3416, 3316, 2967, 2505, 2025, 1759, 1656, 1623, 1746, 1926, 2100,
+    2113, 2104, 2141, 2224, 2264, 2215, 2177, 2228, 2291, 2247, 2191, 2195, 2265, 2292, 2191, 2178,
+    2226, 2270, 2238, 2171, 2168, 2221, 2258, 2178, 2171, 2223, 2229, 2205, 2172, 2197, 2239, 2208,
+    2147, 2164, 2222, 2234, 2168, 2149, 2209, 2259, 2194, 2126, 2179, 2243, 2260, 2200, 2156, 2229,
+    2250, 2225, 2146, 2194, 2227, 2211, 2191, 2194, 2295, 2274, 2241, 2241, 2278, 2298, 2200, 2231,
+    2307, 2316, 2243, 2219, 2226, 2257, 2279, 2181, 2157, 2184, 2186, 2142, 2036, 2079, 2154, 2106,
+    2056, 2058, 2109, 2160, 2082, 2082, 2142, 2176, 2167, 2129, 2176, 2217, 2178, 2131, 2171, 2228,
+    2208, 2127, 2147, 2205, 2220, 2136, 2092, 2174, 2217, 2151, 2072, 2073, 2142, 2188, 2080, 2052,
+    2110, 2152, 2073, 2008, 2058, 2085, 2107, 2018, 2011, 2074, 2094, 2080, 1992, 2043, 2093, 2087,
+    2050, 1983, 2045, 2064, 2048, 2027, 2060, 2092, 2067, 2033, 2013, 2132, 2105, 2033, 2039, 2138,
+    2209, 2133, 2066, 2087, 2181, 2150, 2109, 2077, 2127, 2181, 2118, 2058, 2086, 2172, 2145, 2088,
+    2070, 2114, 2166, 2112, 2077, 2137, 2185, 2163, 2123, 2143, 2168, 2185, 2159, 2142, 2192, 2238,
+    2254, 2181, 2164, 2282, 2340, 2342, 2421, 2580, 2850, 3052, 3234, 3429, 3324, 2990, 2510, 2004,
+    1741, 1675, 1635, 1718, 1907, 2091, 2121, 2115, 2135, 2201, 2245, 2218, 2177, 2212, 2260, 2227,
+    2179, 2168, 2241, 2246, 2158, 2141, 2209, 2237, 2183, 2131, 2145, 2193, 2210, 2116, 2124, 2200,
+    2208, 2151, 2115, 2141, 2197, 2170, 2070, 2101, 2168, 2197, 2137, 2077, 2135, 2187, 2142, 2075,
+    2108, 2159, 2164, 2132, 2106, 2147, 2165, 2168, 2103, 2134, 2165, 2166, 2138, 2107, 2207, 2219,
+    2147, 2088, 2137, 2202, 2112, 2040, 2076, 2167, 2172, 2052, 1991, 2064, 2178, 2060, 1923, 1969,
+    2085, 2074, 1892, 1871, 1993, 2035, 1985, 1925, 1964, 2070, 2041, 1978, 1986, 2056, 2104, 2038,
+    2022, 2077, 2108, 2094, 2016, 2061, 2113, 2082, 2041, 1999, 2084, 2123, 2043, 1978, 2017, 2089,
+    2072, 1985, 1961, 2048, 2062, 2009, 1927, 1981, 2043, 1996, 1915, 1899, 1954, 2000, 1931, 1895,
+    1936, 1952, 1902, 1838, 1891, 1915, 1897, 1844, 1837, 1892, 1897, 1878, 1799, 1874, 1904, 1896,
+    1843, 1791, 1872, 1890, 1840, 1819, 1865, 1899, 1896, 1825, 1791, 1918, 1906, 1860, 1830, 1896,
+    1982, 1934, 1883, 1882, 1954, 1940, 1915, 1892, 1920, 1957, 1896, 1883, 1871, 1931, 1913, 1859,
+    1864, 1917, 1949, 1868, 1862, 1933, 2005, 1947, 1891, 1929, 1962, 1983, 1925, 1902, 1971, 2030,
+    2038, 1951, 1922, 2043, 2124, 2129, 2193, 2349, 2632, 2857, 3026, 3202, 3102, 2756, 2292, 1783,
+    1517, 1417, 1392, 1509, 1696, 1852, 1882, 1869, 1905, 1979, 2016, 1975, 1942, 2000, 2054, 1977,
+    1933, 1953, 2021, 2033, 1921, 1910, 1976, 2011, 1973, 1908, 1905, 1967, 1999, 1911, 1888, 1954,
+    1947, 1944, 1900, 1906, 1948, 1929, 1861, 1887, 1931, 1954, 1901, 1874, 1920, 1968, 1909, 1845,
+    1890, 1959, 1947, 1900, 1878, 1940, 1970, 1935, 1855, 1900, 1972, 1962, 1913, 1881, 1992, 2017,
+    1963, 1906, 1922, 1988, 1939, 1879, 1875, 1926, 1929, 1874, 1821, 1831, 1868, 1794, 1736, 1755,
+    1792, 1747, 1663, 1690, 1765, 1750, 1680, 1698, 1803, 1823, 1745, 1733, 1823, 1884, 1872, 1823,
+    1862, 1921, 1905, 1878, 1863, 1934, 1954, 1890, 1862, 1907, 1925, 1921, 1844, 1876, 1917, 1891,
+    1856, 1839, 1880, 1926, 1850, 1798, 1850, 1900, 1892, 1785, 1790, 1887, 1894, 1821, 1766, 1839,
+    1876, 1820, 1746, 1737, 1799, 1846, 1769, 1713, 1770, 1819, 1759, 1686, 1733, 1748, 1767, 1700,
+    1690, 1751, 1754, 1733, 1657, 1728, 1757, 1759, 1707, 1658, 1728, 1742, 1703, 1698, 1729, 1767,
+    1759, 1696, 1675, 1803, 1778, 1725, 1707, 1790, 1884, 1814, 1737, 1752, 1848, 1851, 1798, 1762,
+    1810, 1856, 1812, 1768, 1768, 1839, 1828, 1787, 1779, 1808, 1856, 1777, 1783, 1845, 1902, 1862,
+    1818, 1860, 1890, 1892, 1857, 1836, 1910, 1973, 1959, 1886, 1874, 1983, 2058, 2065, 2133, 2314,
+    2582, 2794, 2977, 3136, 3067, 2721, 2258, 1726, 1460, 1384, 1375, 1465, 1650, 1813, 1845, 1859,
+    1890, 1935, 1984, 1960, 1925, 1964, 2018, 1966, 1922, 1948, 1996, 2009, 1908, 1897, 1974, 2005,
+    1968, 1897, 1918, 1986, 1996, 1890, 1894, 1968, 1981, 1956, 1890, 1921, 1988, 1964, 1892, 1891,
+    1945, 1987, 1932, 1890, 1949, 1993, 1949, 1885, 1937, 1978, 1991, 1945, 1927, 1977, 2018, 1989,
+    1935, 1949, 2011, 2019, 1979, 1951, 2050, 2084, 2022, 1975, 1991, 2057, 2018, 1948, 1957, 2029,
+    2041, 1976, 1900, 1911, 2004, 1952, 1851, 1834, 1886, 1884, 1804, 1773, 1803, 1844, 1832, 1808,
+    1800, 1860, 1860, 1856, 1872, 1903, 1923, 1917, 1909, 1950, 1957, 1949, 1949, 1968, 1976, 1971,
+    1959, 1957, 1972, 1991, 1985, 1967, 1972, 1979, 1979, 1988, 1983, 1976,
+};
+
+static const int32_t nsr_ann[36] = {
+    100, 317, 537, 742, 938, 1139, 1354, 1567, 1767, 1965, 2170, 2388,
+    2600, 2801, 2999, 3203, 3421, 3634, 3840, 4040, 4250, 4470, 4680, 4881,
+    5081, 5293, 5513, 5722, 5920, 6119, 6335, 6551, 6757, 6955, 7163, 7379,
+};
+
+static const int16_t rate_change_data[7500] = {
+    2216, 2174, 2123, 2189, 2255, 2154, 2121, 2158, 2218, 2188, 2131, 2127, 2205, 2202, 2136, 2090,
+    2158, 2221, 2153, 2070, 2069, 2154, 2190, 2097, 2050, 2132, 2174, 2083, 2009, 2057, 2102, 2120,
+    2043, 2001, 2099, 2118, 2102, 2017, 2063, 2123, 2118, 2086, 2009, 2089, 2104, 2087, 2084, 2120,
+    2145, 2141, 2080, 2072, 2211, 2155, 2116, 2110, 2198, 2292, 2223, 2163, 2186, 2291, 2251, 2209,
+    2174, 2232, 2283, 2226, 2186, 2171, 2277, 2264, 2193, 2190, 2238, 2292, 2213, 2207, 2269, 2344,
+    2312, 2259, 2279, 2329, 2336, 2317, 2283, 2349, 2410, 2412, 2339, 2335, 2459, 2529, 2540, 2629,
+    2835, 3135, 3376, 3591, 3786, 3691, 3297, 2762, 2174, 1883, 1794, 1766, 1871, 2088, 2288, 2306,
+    2307, 2368, 2404, 2482, 2454, 2407, 2453, 2493, 2449, 2414, 2416, 2476, 2505, 2394, 2394, 2461,
+    2493, 2441, 2383, 2403, 2464, 2478, 2380, 2376, 2468, 2462, 2439, 2384, 2425, 2486, 2441, 2342,
+    2370, 2448, 2477, 2403, 2360, 2427, 2494, 2440, 2354, 2378, 2464, 2481, 2437, 2409, 2454, 2510,
+    2482, 2414, 2446, 2502, 2482, 2474, 2440, 2538, 2567, 2498, 2470, 2494, 2552, 2470, 2438, 2456,
+    2524, 2519, 2450, 2356, 2397, 2484, 2390, 2298, 2277, 2352, 2366, 2226, 2180, 2250, 2297, 2275,
+    2224, 2236, 2289, 2312, 2308, 2304, 2328, 2357, 2369, 2389, 2381, 2410, 2391, 2405, 2426, 2414,
+    2411, 2397, 2422, 2436, 2418, 2413, 2404, 2400, 2448, 2428, 2418, 2410, 2418, 2445, 2408, 2408,
+    2403, 2414, 2431, 2416, 2399, 2396, 2418, 2432, 2427, 2421, 2400, 2421, 2428, 2417, 2400, 2409,
+    2406, 2418, 2409, 2418, 2400, 2405, 2416, 2412, 2403, 2384, 2397, 2420, 2420, 2390, 2393, 2393,
+    2383, 2395, 2375, 2369, 2356, 2384, 2393, 2358, 2301, 2358, 2417, 2392, 2335, 2347, 2400, 2456,
+    2398, 2322, 2384, 2492, 2447, 2392, 2382, 2466, 2486, 2468, 2410, 2469, 2512, 2472, 2413, 2424,
+    2472, 2504, 2429, 2400, 2458, 2462, 2445, 2340, 2394, 2480, 2451, 2366, 2333, 2407, 2480, 2357,
+    2277, 2345, 2428, 2398, 2292, 2270, 2382, 2422, 2330, 2246, 2318, 2377, 2304, 2219, 2190, 2271,
+    2324, 2238, 2195, 2230, 2283, 2209, 2126, 2188, 2207, 2196, 2118, 2103, 2210, 2197, 2176, 2062,
+    2162, 2210, 2182, 2130, 2048, 2155, 2167, 2120, 2082, 2150, 2193, 2186, 2101, 2055, 2218, 2212,
+    2131, 2106, 2200, 2299, 2243, 2161, 2191, 2279, 2255, 2207, 2182, 2212, 2262, 2191, 2164, 2151,
+    2248, 2224, 2135, 2144, 2214, 2264, 2147, 2142, 2230, 2307, 2260, 2167, 2226, 2270, 2288, 2233,
+    2183, 2260, 2360, 2347, 2265, 2223, 2361, 2457, 2461, 2557, 2752, 3122, 3378, 3621, 3798, 3700,
+    3284, 2676, 2026, 1680, 1569, 1550, 1681, 1895, 2114, 2155, 2153, 2194, 2270, 2312, 2266, 2241,
+    2277, 2352, 2268, 2204, 2226, 2321, 2325, 2183, 2181, 2263, 2313, 2254, 2164, 2164, 2244, 2278,
+    2169, 2147, 2230, 2230, 2213, 2145, 2153, 2204, 2200, 2110, 2123, 2194, 2197, 2141, 2093, 2158,
+    2218, 2137, 2082, 2123, 2200, 2209, 2135, 2091, 2183, 2220, 2196, 2076, 2127, 2190, 2202, 2168,
+    2106, 2229, 2277, 2196, 2133, 2169, 2244, 2188, 2122, 2097, 2155, 2185, 2118, 2029, 2034, 2127,
+    2042, 1946, 1922, 1964, 1968, 1861, 1820, 1898, 1916, 1878, 1846, 1855, 1923, 1919, 1888, 1907,
+    1974, 1995, 1964, 1955, 1969, 2023, 2024, 2007, 2007, 2020, 2029, 2026, 2010, 1995, 2019, 2030,
+    2000, 1999, 1986, 2008, 2010, 2019, 2003, 1985, 1993, 2000, 2003, 1975, 1977, 1971, 1998, 1975,
+    1939, 1951, 1985, 1968, 1911, 1946, 1982, 1974, 1930, 1955, 1977, 1999, 1977, 1927, 1985, 2036,
+    1994, 1949, 1966, 2051, 2044, 2004, 1970, 2028, 2061, 2021, 1974, 1979, 2040, 2065, 1996, 1967,
+    2002, 2029, 2017, 1932, 1968, 2020, 2002, 1967, 1910, 1965, 2030, 1957, 1893, 1932, 1972, 1967,
+    1897, 1896, 1951, 1959, 1922, 1862, 1924, 1955, 1891, 1844, 1832, 1894, 1909, 1831, 1819, 1865,
+    1906, 1828, 1769, 1818, 1862, 1844, 1767, 1764, 1845, 1855, 1821, 1729, 1786, 1850, 1835, 1799,
+    1734, 1804, 1819, 1820, 1779, 1805, 1836, 1836, 1801, 1768, 1855, 1836, 1811, 1803, 1865, 1926,
+    1871, 1836, 1863, 1924, 1894, 1843, 1836, 1886, 1919, 1867, 1811, 1842, 1928, 1914, 1828, 1833,
+    1896, 1946, 1852, 1830, 1881, 1960, 1945, 1895, 1907, 1936, 1970, 1927, 1913, 1957, 1997, 2008,
+    1959, 1933, 2031, 2076, 2112, 2209, 2358, 2583, 2781, 2964, 3127, 3045, 2714, 2258, 1804, 1569,
+    1471, 1444, 1530, 1726, 1895, 1916, 1895, 1933, 2005, 2044, 2012, 1961, 1993, 2079, 2042, 1998,
+    1991, 2038, 2069, 1976, 1981, 2000, 2049, 2014, 1983, 1984, 2011, 2047, 1972, 1961, 2046, 2011,
+    1985, 1976, 1988, 2038, 2003, 1925, 1972, 2041, 2042, 1991, 1938, 2011, 2063, 1999, 1937, 1967,
+    2048, 2065, 2011, 1986, 2028, 2088, 2059, 1989, 2006, 2064, 2071, 2054, 2035, 2107, 2116, 2082,
+    2050, 2063, 2106, 2061, 2031, 2052, 2095, 2078, 2029, 1979, 2004, 2062, 1993, 1902, 1923, 1974,
+    1980, 1861, 1842, 1909, 1940, 1910, 1872, 1863, 1952, 1967, 1929, 1939, 1976, 2012, 2020, 2021,
+    2010, 2036, 2038, 2045, 2049, 2033, 2042, 2045, 2064, 2052, 2045, 2054, 2060, 2055, 2033, 2037,
+    2077, 2083, 2049, 2044, 2072, 2096, 2094, 2050, 2114, 2131, 2116, 2070, 2098, 2131, 2156, 2122,
+    2108, 2138, 2181, 2149, 2102, 2134, 2180, 2181, 2124, 2092, 2162, 2192, 2170, 2095, 2117, 2180,
+    2169, 2143, 2102, 2159, 2206, 2147, 2104, 2111, 2167, 2169, 2114, 2123, 2155, 2160, 2143, 2112,
+    2129, 2164, 2118, 2093, 2102, 2134, 2157, 2105, 2084, 2122, 2150, 2104, 2065, 2094, 2133, 2121,
+    2063, 2068, 2118, 2140, 2121, 2063, 2099, 2136, 2140, 2108, 2065, 2129, 2121, 2131, 2096, 2117,
+    2140, 2150, 2123, 2102, 2190, 2151, 2135, 2134, 2190, 2225, 2194, 2167, 2204, 2248, 2215, 2192,
+    2200, 2224, 2245, 2196, 2174, 2195, 2248, 2232, 2187, 2178, 2235, 2272, 2221, 2200, 2250, 2308,
+    2276, 2231, 2245, 2278, 2306, 2285, 2266, 2308, 2340, 2351, 2315, 2279, 2369, 2424, 2431, 2488,
+    2617, 2778, 2932, 3077, 3199, 3142, 2869, 2532, 2215, 2039, 1972, 1940, 2014, 2157, 2274, 2305,
+    2275, 2324, 2366, 2409, 2385, 2351, 2377, 2415, 2398, 2368, 2358, 2399, 2416, 2360, 2361, 2375,
+    2394, 2377, 2346, 2366, 2400, 2403, 2348, 2369, 2409, 2372, 2370, 2373, 2372, 2400, 2374, 2338,
+    2344, 2406, 2421, 2362, 2330, 2377, 2420, 2396, 2322, 2366, 2422, 2440, 2391, 2352, 2396, 2444,
+    2431, 2378, 2384, 2429, 2416, 2410, 2407, 2454, 2470, 2420, 2411, 2422, 2453, 2427, 2389, 2411,
+    2440, 2433, 2395, 2361, 2387, 2416, 2371, 2309, 2298, 2358, 2344, 2263, 2245, 2294, 2314, 2309,
+    2250, 2237, 2310, 2337, 2288, 2260, 2315, 2366, 2368, 2329, 2316, 2382, 2424, 2384, 2344, 2389,
+    2453, 2425, 2386, 2388, 2448, 2461, 2435, 2416, 2458, 2461, 2438, 2411, 2438, 2469, 2478, 2421,
+    2413, 2461, 2458, 2441, 2371, 2409, 2472, 2442, 2391, 2349, 2429, 2476, 2397, 2356, 2379, 2424,
+    2429, 2356, 2338, 2397, 2426, 2376, 2333, 2361, 2389, 2349, 2316, 2308, 2325, 2371, 2306, 2291,
+    2319, 2338, 2277, 2230, 2283, 2310, 2297, 2246, 2226, 2300, 2306, 2278, 2192, 2252, 2309, 2298,
+    2253, 2195, 2255, 2297, 2256, 2241, 2251, 2273, 2298, 2248, 2216, 2306, 2295, 2254, 2247, 2295,
+    2356, 2322, 2280, 2275, 2340, 2315, 2301, 2304, 2320, 2346, 2273, 2280, 2274, 2346, 2300, 2256,
+    2271, 2314, 2352, 2263, 2245, 2315, 2374, 2345, 2278, 2302, 2347, 2381, 2327, 2292, 2341, 2403,
+    2413, 2353, 2309, 2394, 2456, 2499, 2550, 2673, 2901, 3081, 3263, 3401, 3314, 3003, 2624, 2198,
+    1974, 1860, 1855, 1955, 2107, 2254, 2262, 2253, 2282, 2347, 2373, 2351, 2296, 2336, 2393, 2354,
+    2300, 2304, 2375, 2392, 2279, 2272, 2318, 2360, 2329, 2286, 2263, 2319, 2325, 2274, 2267, 2295,
+    2285, 2277, 2259, 2277, 2280, 2264, 2202, 2240, 2284, 2283, 2235, 2205, 2277, 2298, 2235, 2179,
+    2221, 2293, 2281, 2226, 2192, 2246, 2279, 2269, 2197, 2216, 2264, 2285, 2250, 2206, 2285, 2307,
+    2271, 2232, 2219, 2266, 2229, 2201, 2174, 2231, 2222, 2164, 2110, 2119, 2203, 2096, 2004, 2042,
+    2101, 2105, 1948, 1941, 2044, 2093, 2027, 1939, 2037, 2171, 2127, 2006, 2024, 2156, 2209, 2141,
+    2112, 2150, 2228, 2195, 2143, 2144, 2206, 2219, 2151, 2134, 2159, 2185, 2171, 2080, 2129, 2189,
+    2138, 2099, 2080, 2138, 2176, 2085, 2026, 2073, 2127, 2113, 1998, 2000, 2096, 2129, 2016, 1957,
+    2025, 2089, 2011, 1926, 1916, 1992, 2030, 1946, 1888, 1944, 1995, 1922, 1841, 1889, 1917, 1911,
+    1829, 1822, 1905, 1894, 1879, 1816, 1867, 1901, 1891, 1854, 1779, 1871, 1859, 1835, 1817, 1853,
+    1905, 1900, 1794, 1792, 1943, 1913, 1833, 1809, 1903, 2012, 1929, 1846, 1872, 1965, 1965, 1901,
+    1870, 1907, 1951, 1901, 1847, 1853, 1930, 1907, 1848, 1866, 1901, 1940, 1861, 1857, 1926, 1982,
+    1923, 1896, 1927, 1971, 1964, 1929, 1913, 1985, 2026, 2030, 1955, 1917, 2067, 2139, 2133, 2232,
+    2436, 2747, 2990, 3197, 3363, 3285, 2907, 2344, 1750, 1427, 1338, 1306, 1436, 1635, 1820, 1868,
+    1858, 1901, 1967, 2020, 1956, 1947, 1995, 2029, 1977, 1949, 1943, 2026, 2026, 1887, 1895, 1965,
+    2010, 1960, 1889, 1894, 1961, 1994, 1884, 1875, 1960, 1964, 1932, 1862, 1895, 1939, 1921, 1835,
+    1840, 1927, 1942, 1885, 1834, 1898, 1960, 1904, 1821, 1877, 1924, 1928, 1888, 1831, 1880, 1931,
+    1914, 1803, 1814, 1908, 1939, 1898, 1820, 1944, 2033, 1990, 1883, 1856, 2000, 2032, 1929, 1848,
+    1944, 2054, 1987, 1858, 1825, 1980, 1970, 1814, 1723, 1793, 1901, 1805, 1668, 1690, 1784, 1794,
+    1738, 1650, 1741, 1837, 1778, 1741, 1730, 1849, 1902, 1789, 1762, 1829, 1876, 1847, 1768, 1770,
+    1865, 1873, 1791, 1723, 1809, 1866, 1792, 1681, 1717, 1780, 1831, 1706, 1680, 1742, 1802, 1701,
+    1618, 1676, 1719, 1746, 1629, 1624, 1706, 1715, 1702, 1601, 1665, 1718, 1716, 1678, 1583, 1696,
+    1701, 1679, 1644, 1697, 1718, 1723, 1672, 1641, 1775, 1745, 1688, 1672, 1793, 1880, 1794, 1724,
+    1762, 1851, 1824, 1771, 1727, 1803, 1866, 1798, 1744, 1741, 1855, 1826, 1777, 1755, 1800, 1868,
+    1786, 1766, 1834, 1917, 1888, 1821, 1849, 1883, 1902, 1882, 1849, 1925, 2003, 1987, 1911, 1884,
+    2018, 2124, 2133, 2238, 2473, 2806, 3084, 3325, 3539, 3444, 2992, 2375, 1728, 1368, 1285, 1240,
+    1369, 1603, 1829, 1872, 1859, 1893, 1993, 2058, 2009, 1966, 2020, 2070, 2031, 1979, 1979, 2067,
+    2075, 1962, 1955, 2030, 2065, 2020, 1943, 1955, 2031, 2057, 1941, 1939, 2032, 2038, 1996, 1945,
+    1963, 2044, 2004, 1918, 1903, 2007, 2041, 1940, 1875, 1971, 2061, 1975, 1871, 1932, 2060, 2081,
+    1964, 1928, 2029, 2115, 2070, 1932, 2045, 2185, 2141, 2029, 2032, 2234, 2257, 2147, 2092, 2153,
+    2271, 2161, 2044, 2080, 2228, 2247, 2074, 1970, 2064, 2180, 2074, 1866, 1880, 2027, 2025, 1829,
+    1742, 1880, 2004, 1882, 1755, 1826, 1953, 1967, 1855, 1833, 1985, 2035, 1975, 1898, 1986, 2059,
+    2002, 1916, 1933, 2002, 2038, 1938, 1916, 1986, 2046, 1937, 1867, 1923, 1977, 1973, 1879, 1856,
+    1964, 2004, 1954, 1839, 1941, 1985, 1986, 1922, 1846, 1939, 1970, 1937, 1919, 1941, 1996, 1998,
+    1940, 1901, 2038, 2017, 1958, 1974, 2043, 2117, 2070, 1998, 2029, 2117, 2082, 2048, 2024, 2093,
+    2128, 2059, 2003, 2027, 2136, 2111, 2027, 2029, 2099, 2157, 2071, 2040, 2107, 2189, 2181, 2112,
+    2132, 2175, 2217, 2169, 2144, 2199, 2263, 2279, 2202, 2181, 2299, 2392, 2413, 2506, 2692, 3002,
+    3258, 3483, 3688, 3565, 3164, 2612, 2039, 1717, 1624, 1571, 1709, 1928, 2139, 2177, 2140, 2185,
+    2284, 2333, 2287, 2252, 2296, 2361, 2316, 2263, 2276, 2346, 2362, 2248, 2239, 2292, 2343, 2301,
+    2256, 2238, 2299, 2314, 2222, 2249, 2289, 2274, 2260, 2254, 2245, 2267, 2256, 2209, 2230, 2272,
+    2309, 2250, 2243, 2280, 2321, 2304, 2285, 2290, 2316, 2326, 2347, 2339, 2349, 2383, 2408, 2360,
+    2351, 2376, 2391, 2406, 2386, 2428, 2416, 2412, 2391, 2396, 2366, 2349, 2356, 2367, 2374, 2352,
+    2335, 2300, 2276, 2291, 2241, 2175, 2161, 2149, 2143, 2087, 2086, 2081, 2083, 2099, 2090, 2047,
+    2066, 2080, 2108, 2132, 2098, 2109, 2170, 2197, 2126, 2075, 2147, 2171, 2200, 2113, 2114, 2180,
+    2205, 2186, 2093, 2135, 2178, 2187, 2152, 2070, 2135, 2170, 2153, 2114, 2152, 2185, 2180, 2147,
+    2119, 2214, 2196, 2151, 2157, 2232, 2281, 2211, 2177, 2219, 2273, 2241, 2196, 2181, 2239, 2276,
+    2204, 2178, 2181, 2252, 2239, 2182, 2191, 2215, 2283, 2205, 2178, 2232, 2311, 2288, 2217, 2233,
+    2265, 2285, 2269, 2248, 2277, 2327, 2340, 2289, 2265, 2345, 2423, 2432, 2516, 2669, 2893, 3095,
+    3269, 3450, 3355, 3011, 2585, 2116, 1896, 1794, 1765, 1843, 2030, 2196, 2230, 2205, 2228, 2295,
+    2342, 2302, 2263, 2305, 2372, 2318, 2263, 2252, 2322, 2349, 2245, 2232, 2277, 2313, 2268, 2193,
+    2214, 2273, 2281, 2187, 2206, 2300, 2297, 2254, 2175, 2260, 2338, 2278, 2149, 2208, 2312, 2346,
+    2241, 2184, 2285, 2353, 2284, 2170, 2203, 2329, 2346, 2255, 2185, 2263, 2325, 2303, 2167, 2220,
+    2302, 2308, 2236, 2180, 2299, 2375, 2237, 2189, 2237, 2311, 2255, 2156, 2141, 2261, 2251, 2152,
+    2059, 2133, 2228, 2100, 1966, 1962, 2054, 2082, 1925, 1874, 1947, 2033, 1934, 1843, 1875, 1973,
+    2000, 1897, 1886, 1966, 2017, 2011, 1922, 1984, 2036, 2023, 2003, 1959, 1987, 2003, 1999, 1985,
+    2015, 2011, 2012, 1974, 1960, 2052, 2035, 1973, 1979, 2042, 2101, 2030, 1976, 2011, 2068, 2041,
+    2011, 1990, 2029, 2063, 2001, 1963, 1978, 2052, 2035, 1975, 1978, 1992, 2053, 1994, 1981, 2001,
+    2054, 2017, 2009, 2008, 2027, 2047, 2025, 2008, 2031, 2081, 2068, 2014, 2027, 2113, 2129, 2147,
+    2206, 2333, 2525, 2668, 2780, 2921, 2866, 2603, 2248, 1869, 1687, 1642, 1595, 1670, 1808, 1926,
+    1944, 1938, 1962, 1995, 2023, 2014, 1971, 1976, 2033, 1992, 1976, 1959, 1992, 2017, 1943, 1926,
+    1966, 1997, 1982, 1943, 1921, 1983, 2060, 1946, 1913, 1970, 2032, 2002, 1940, 1945, 2008, 2030,
+    1932, 1896, 1953, 2023, 1987, 1890, 1907, 2004, 1978, 1920, 1876, 1935, 1990, 1940, 1894, 1890,
+    1973, 1998, 1888, 1863, 1932, 1966, 1925, 1858, 1925, 1966, 1944, 1870, 1855, 1934, 1911, 1835,
+    1813, 1849, 1882, 1852, 1743, 1747, 1832, 1801, 1676, 1615, 1696, 1732, 1650, 1585, 1585, 1679,
+    1680, 1624, 1563, 1633, 1687, 1677, 1634, 1614, 1692, 1702, 1684, 1657, 1708, 1738, 1738, 1712,
+    1657, 1740, 1726, 1704, 1696, 1732, 1788, 1733, 1711, 1741, 1800, 1760, 1734, 1704, 1746, 1784,
+    1731, 1700, 1701, 1768, 1754, 1712, 1692, 1717, 1796, 1721, 1687, 1744, 1792, 1768, 1723, 1744,
+    1756, 1792, 1756, 1734, 1756, 1800, 1832, 1755, 1755, 1809, 1858, 1901, 1929, 2056, 2216, 2378,
+    2527, 2651, 2592, 2333, 1983, 1638, 1462, 1387, 1340, 1420, 1567, 1693, 1683, 1658, 1707, 1766,
+    1800, 1727, 1706, 1762, 1839, 1749, 1720, 1760, 1818, 1796, 1704, 1760, 1832, 1819, 1755, 1741,
+    1791, 1852, 1814, 1733, 1787, 1863, 1822, 1759, 1765, 1829, 1864, 1769, 1701, 1763, 1834, 1818,
+    1715, 1705, 1800, 1839, 1757, 1670, 1741, 1837, 1781, 1698, 1717, 1789, 1800, 1737, 1682, 1763,
+    1805, 1749, 1693, 1711, 1808, 1769, 1696, 1672, 1720, 1802, 1679, 1638, 1703, 1755, 1700, 1591,
+    1608, 1647, 1681, 1559, 1486, 1553, 1603, 1593, 1422, 1455, 1547, 1572, 1531, 1429, 1498, 1571,
+    1543, 1519, 1551, 1601, 1619, 1600, 1562, 1654, 1656, 1631, 1609, 1678, 1734, 1687, 1654, 1679,
+    1738, 1714, 1688, 1670, 1699, 1726, 1681, 1652, 1663, 1743, 1718, 1672, 1658, 1705, 1756, 1695,
+    1660, 1714, 1780, 1758, 1701, 1720, 1746, 1777, 1759, 1743, 1772, 1810, 1848, 1787, 1748, 1848,
+    1896, 1928, 1999, 2144, 2340, 2534, 2705, 2835, 2771, 2470, 2066, 1648, 1406, 1347, 1343, 1402,
+    1533, 1714, 1767, 1748, 1722, 1803, 1894, 1891, 1806, 1796, 1925, 1965, 1887, 1825, 1883, 1978,
+    1922, 1858, 1899, 1971, 1969, 1932, 1848, 1908, 1979, 1945, 1875, 1902, 1945, 1939, 1902, 1830,
+    1925, 1947, 1864, 1834, 1858, 1935, 1931, 1813, 1813, 1925, 1930, 1848, 1787, 1849, 1961, 1932,
+    1818, 1804, 1918, 1935, 1836, 1772, 1813, 1884, 1920, 1787, 1842, 1919, 1904, 1818, 1777, 1844,
+    1844, 1805, 1751, 1768, 1851, 1828, 1759, 1680, 1815, 1779, 1704, 1654, 1657, 1730, 1668, 1594,
+    1639, 1705, 1710, 1673, 1628, 1668, 1802, 1750, 1714, 1717, 1830, 1915, 1864, 1795, 1816, 1926,
+    1915, 1878, 1844, 1891, 1932, 1902, 1855, 1839, 1935, 1930, 1880, 1859, 1902, 1964, 1888, 1884,
+    1951, 1989, 1979, 1909, 1966, 1989, 2015, 1978, 1959, 2018, 2081, 2079, 2000, 1994, 2107, 2189,
+    2178, 2267, 2454, 2721, 2941, 3144, 3332, 3218, 2821, 2355, 1871, 1566, 1455, 1447, 1598, 1824,
+    1947, 1951, 2006, 2151, 2148, 2109, 2114, 2178, 2237, 2241, 2146, 2148, 2228, 2258, 2205, 2094,
+    2176, 2260, 2215, 2137, 2133, 2176, 2208, 2144, 2080, 2157, 2205, 2161, 2099, 2127, 2192, 2155,
+    2077, 2042, 2127, 2161, 2102, 2041, 2095, 2180, 2147, 2026, 2026, 2125, 2117, 2046, 1994, 2037,
+    2161, 2069, 2039, 2011, 2105, 2057, 1986, 2011, 2031, 2120, 2064, 2003, 2036, 2083, 2118, 1972,
+    1975, 2040, 2095, 2038, 1918, 1930, 1972, 2017, 1909, 1896, 1896, 1946, 1879, 1770, 1878, 1903,
+    1862, 1850, 1888, 2010, 1990, 1929, 1920, 2046, 2033, 2038, 1996, 2056, 2124, 2058, 2037, 2024,
+    2144, 2101, 2058, 2035, 2088, 2170, 2080, 2072, 2139, 2196, 2173, 2114, 2147, 2166, 2195, 2151,
+    2136, 2212, 2276, 2254, 2182, 2167, 2306, 2377, 2405, 2492, 2681, 3003, 3250, 3512, 3697, 3565,
+    3164, 2625, 1996, 1611, 1534, 1567, 1718, 1898, 2051, 2184, 2253, 2215, 2220, 2318, 2358, 2348,
+    2324, 2370, 2358, 2379, 2322, 2332, 2352, 2341, 2344, 2315, 2321, 2331, 2309, 2284, 2250, 2319,
+    2284, 2275, 2308, 2253, 2291, 2296, 2189, 2213, 2231, 2193, 2189, 2190, 2195, 2245, 2192, 2180,
+    2185, 2187, 2168, 2136, 2139, 2125, 2170, 2173, 2126, 2117, 2169, 2151, 2086, 2061, 2119, 2127,
+    2095, 2119, 2133, 2151, 2102, 2103, 2072, 2089, 2065, 2084, 2100, 2033, 2056, 1984, 1979, 2030,
+    1986, 1923, 1903, 1893, 1885, 1892, 1831, 1835, 1861, 1927, 1988, 1920, 1903, 1947, 2031, 2007,
+    1995, 2002, 2051, 2110, 2038, 2008, 2002, 2128, 2114, 2041, 2022, 2083, 2153, 2048, 2032, 2102,
+    2183, 2141, 2101, 2125, 2145, 2180, 2125, 2100, 2161, 2231, 2211, 2112, 2111, 2271, 2329, 2298,
+    2440, 2697, 3027, 3247, 3492, 3777, 3700, 3197, 2530, 1949, 1693, 1539, 1412, 1568, 1880, 2137,
+    2145, 2076, 2165, 2289, 2322, 2216, 2192, 2290, 2388, 2245, 2153, 2218, 2319, 2311, 2102, 2113,
+    2283, 2292, 2158, 2075, 2142, 2278, 2204, 2015, 2073, 2233, 2190, 2061, 1979, 2115, 2198, 2087,
+    1914, 2006, 2157, 2117, 1956, 1871, 2036, 2143, 1975, 1837, 1940, 2072, 2002, 1855, 1880, 1975,
+    2025, 1911, 1817, 1946, 2019, 1969, 1844, 1888, 2077, 2070, 1941, 1814, 1935, 2039, 1902, 1804,
+    1883, 1994, 2008, 1854, 1722, 1880, 1986, 1828, 1677, 1746, 1908, 1856, 1648, 1607, 1793, 1808,
+    1745, 1660, 1712, 1828, 1793, 1704, 1706, 1851, 1840, 1791, 1784, 1835, 1918, 1810, 1822, 1890,
+    1965, 1892, 1839, 1899, 1933, 1922, 1871, 1889, 1961, 1974, 1987, 1943, 1942, 2041, 2092, 2183,
+    2318, 2505, 2763, 3045, 3359, 3555, 3415, 2978, 2437, 1844, 1454, 1304, 1274, 1472, 1709, 1831,
+    1831, 1884, 1961, 2017, 1983, 1973, 2000, 2026, 2038, 1938, 1926, 2010, 1997, 1956, 1881, 1908,
+    1988, 1941, 1864, 1888, 1879, 1889, 1874, 1818, 1868, 1885, 1816, 1778, 1787, 1840, 1807, 1738,
+    1724, 1771, 1765, 1694, 1696, 1681, 1762, 1708, 1639, 1646, 1730, 1757, 1681, 1670, 1703, 1776,
+    1763, 1649, 1640, 1704, 1739, 1726, 1722, 1708, 1812, 1800, 1705, 1764, 1762, 1763, 1715, 1724,
+    1823, 1828, 1775, 1717, 1730, 1710, 1743, 1635, 1593, 1626, 1612, 1562, 1449, 1513, 1556, 1522,
+    1487, 1486, 1573, 1536, 1528, 1539, 1642, 1675, 1649, 1653, 1661, 1728, 1718, 1670, 1702, 1782,
+    1840, 1726, 1677, 1804, 1915, 1939, 1963, 2173, 2486, 2774, 2949, 3101, 3034, 2717, 2149, 1539,
+    1281, 1233, 1209, 1293, 1471, 1706, 1761, 1717, 1718, 1796, 1912, 1882, 1765, 1786, 1883, 1869,
+    1809, 1720, 1819, 1904, 1786, 1721, 1763, 1837, 1849, 1734, 1675, 1745, 1830, 1722, 1649, 1719,
+    1792, 1752, 1673, 1645, 1770, 1773, 1609, 1580, 1660, 1709, 1689, 1562, 1612, 1723, 1711, 1538,
+    1522, 1635, 1689, 1641, 1522, 1574, 1691, 1679, 1571, 1534, 1647, 1682, 1665, 1589, 1618, 1713,
+    1690, 1603, 1608, 1700, 1654, 1614, 1591, 1620, 1706, 1631, 1522, 1542, 1680, 1671, 1516, 1462,
+    1543, 1626, 1466, 1407, 1450, 1549, 1552, 1437, 1422, 1495, 1585, 1547, 1464, 1532, 1616, 1661,
+    1568, 1542, 1636, 1717, 1689, 1633, 1636, 1683, 1725, 1672, 1618, 1683, 1765, 1783, 1687, 1667,
+    1799, 1883, 1880, 1914, 2119, 2405, 2565, 2704, 2870, 2849, 2523, 2058, 1602, 1405, 1340, 1275,
+    1317, 1519, 1734, 1769, 1683, 1709, 1805, 1886, 1829, 1726, 1802, 1912, 1854, 1756, 1742, 1844,
+    1909, 1766, 1695, 1792, 1855, 1819, 1715, 1701, 1815, 1831, 1736, 1694, 1790, 1802, 1734, 1657,
+    1689, 1777, 1776, 1641, 1640, 1731, 1787, 1678, 1583, 1701, 1772, 1728, 1604, 1599, 1742, 1782,
+    1717, 1604, 1706, 1790, 1777, 1677, 1629, 1742, 1763, 1724, 1684, 1790, 1833, 1791, 1739, 1720,
+    1840, 1789, 1713, 1718, 1822, 1857, 1770, 1688, 1715, 1845, 1746, 1641, 1636, 1720, 1746, 1613,
+    1574, 1620, 1721, 1668, 1595, 1602, 1680, 1747, 1673, 1636, 1690, 1812, 1809, 1740, 1742, 1809,
+    1862, 1856, 1789, 1834, 1906, 1936, 1874, 1822, 1926, 2065, 2044, 2071, 2207, 2448, 2629, 2763,
+    2881, 2829, 2592, 2202, 1779, 1600, 1570, 1548, 1580, 1710, 1883, 1926, 1888, 1892, 1961, 2046,
+    1986, 1935, 1944, 2022, 2040, 1959, 1909, 2000, 2039, 1961, 1895, 1925, 2004, 2005, 1945, 1886,
+    1962, 1993, 1917, 1879, 1917, 1939, 1970, 1893, 1883, 1949, 1955, 1839, 1811, 1913, 1966, 1888,
+    1817, 1871, 1961, 1942, 1875, 1835, 1937, 1990, 1944, 1853, 1876, 1971, 1976, 1900, 1892, 1964,
+    1988, 1975, 1915, 1961, 2072, 2026, 1963, 1969, 2044, 2052, 1999, 1975, 2034, 2076, 2013, 1954,
+    1969, 2044, 2006, 1912, 1868, 1907, 1984, 1888, 1808, 1861, 1949, 1948, 1860, 1850, 1949, 2005,
+    1938, 1920, 1973, 2014, 2011, 2005, 2020, 2075, 2092, 2105, 2088, 2083, 2126, 2188, 2242, 2345,
+    2414, 2551, 2726, 2920, 3034, 2946, 2687, 2381, 2088, 1864, 1771, 1747, 1869, 2022, 2087, 2087,
+    2097, 2169, 2201, 2172, 2170, 2174, 2213, 2223, 2166, 2164, 2202, 2207, 2190, 2138, 2164, 2200,
+    2166, 2152, 2160, 2180, 2156, 2140, 2133, 2154, 2148, 2099, 2104, 2127, 2158, 2106, 2064, 2072,
+    2142, 2127, 2078, 2051, 2067, 2113, 2103, 2061, 2064, 2086, 2134, 2082, 2074, 2096, 2122, 2141,
+    2078, 2070, 2087, 2127, 2129, 2119, 2100, 2180, 2166, 2113, 2173, 2165, 2174, 2121, 2154, 2216,
+    2204, 2169, 2142, 2161, 2174, 2155, 2094, 2092, 2104, 2119, 2075, 2013, 2057, 2071, 2061, 2053,
+    2029, 2083, 2061, 2064, 2066, 2119, 2156, 2123, 2114, 2158, 2173, 2188, 2145, 2185, 2262, 2298,
+    2214, 2175, 2314, 2394, 2378, 2392, 2554, 2797, 2933, 3051, 3138, 3135, 2927, 2524, 2119, 1937,
+    1923, 1924, 1938, 2030, 2218, 2267, 2223, 2185, 2264, 2359, 2335, 2254, 2237, 2323, 2352, 2260,
+    2214, 2279, 2326, 2247, 2198, 2226, 2300, 2280, 2181, 2157, 2218, 2289, 2179, 2137, 2176, 2218,
+    2217, 2123, 2118, 2207, 2217, 2092, 2041, 2137, 2191, 2135, 2032, 2081, 2170, 2158, 2080, 2015,
+    2139, 2167, 2154, 2080, 2059, 2156, 2157, 2079, 2076, 2150, 2170, 2152, 2091, 2140, 2239, 2173,
+    2123, 2127, 2232, 2246, 2149, 2120, 2195, 2246, 2172, 2093, 2084, 2201, 2173, 2044, 2012, 2059,
+    2141, 2040, 1960, 1979, 2059, 2084, 1960, 1945, 2054, 2133, 2086, 2006, 2072, 2147, 2165, 2091,
+    2093, 2181, 2248, 2239, 2138, 2171, 2334, 2349, 2302, 2387, 2597, 2836, 2973, 3102, 3305, 3255,
+    2916, 2466, 2061, 1884, 1824, 1730, 1781, 1996, 2168, 2179, 2070, 2135, 2253, 2286, 2182, 2136,
+    2231, 2330, 2209, 2098, 2137, 2259, 2257, 2088, 2080, 2198, 2240, 2147, 2041, 2093, 2182, 2135,
+    2010, 2001, 2119, 2129, 2031, 1973, 2044, 2096, 2016, 1890, 1944, 2045, 2050, 1928, 1876, 2018,
+    2064, 1983, 1842, 1945, 2039, 2057, 1965, 1848, 1974, 2034, 1991, 1901, 1958, 2021, 2040, 1976,
+    1908, 2063, 2097, 1999, 1962, 2038, 2142, 2045, 1949, 1985, 2105, 2083, 1972, 1914, 1984, 2072,
+    1935, 1829, 1823, 1965, 1922, 1778, 1734, 1811, 1891, 1816, 1759, 1795, 1897, 1903, 1854, 1890,
+    1893, 1954, 1984, 1984, 1984, 1998, 2089, 2111, 2042, 2070, 2158, 2267, 2351, 2483, 2721, 2974,
+    3207, 3360, 3196, 2846, 2424, 1950, 1611, 1476, 1504, 1615, 1775, 1874, 1938, 1988, 1993, 2007,
+    2037, 2061, 2062, 2014, 2014, 2029, 2035, 2003, 1970, 1995, 1978, 1985, 1973, 1928, 1957, 1969,
+    1896, 1846, 1862, 1851, 1909, 1869, 1807, 1849, 1861, 1796, 1768, 1788, 1746, 1767, 1761, 1765,
+    1776, 1739, 1771, 1746, 1767, 1733, 1766, 1778, 1719, 1770, 1747, 1754, 1779, 1796, 1773, 1777,
+    1771, 1754, 1857, 1790, 1821, 1829, 1871, 1924, 1867, 1841, 1808, 1865, 1865, 1876, 1835, 1810,
+    1807, 1747, 1801, 1711, 1706, 1681, 1654, 1661, 1602, 1624, 1598, 1604, 1636, 1660, 1666, 1646,
+    1651, 1683, 1740, 1732, 1697, 1773, 1900, 1931, 1821, 1731, 1977, 2134, 2102, 2106, 2326, 2740,
+    2993, 3156, 3316, 3275, 2931, 2326, 1655, 1359, 1334, 1325, 1356, 1515, 1788, 1853, 1832, 1768,
+    1862, 1993, 1944, 1849, 1837, 1981, 1984, 1835, 1769, 1907, 1976, 1824, 1729, 1806, 1951, 1918,
+    1742, 1688, 1834, 1918, 1734, 1656, 1714, 1801, 1809, 1666, 1639, 1761, 1786, 1611, 1531, 1667,
+    1745, 1687, 1539, 1580, 1733, 1699, 1583, 1532, 1694, 1720, 1670, 1603, 1581, 1709, 1710, 1589,
+    1601, 1715, 1749, 1704, 1594, 1685, 1862, 1768, 1662, 1649, 1818, 1872, 1739, 1661, 1761, 1874,
+    1767, 1643, 1623, 1776, 1731, 1586, 1510, 1556, 1667, 1534, 1433, 1449, 1524, 1598, 1486, 1440,
+    1543, 1655, 1635, 1589, 1611, 1680, 1756, 1761, 1704, 1747, 1874, 1983, 1856, 1754, 1914, 2084,
+    2132, 2175, 2372, 2748, 3073, 3266, 3433, 3334, 2964, 2380, 1629, 1277, 1241, 1228, 1334, 1455,
+    1724, 1865, 1805, 1793, 1829, 1977, 1980, 1846, 1802, 1937, 1962, 1882, 1798, 1855, 1973, 1871,
+    1782, 1798, 1891, 1921, 1777, 1714, 1763, 1861, 1784, 1687, 1757, 1813, 1835, 1689, 1623, 1770,
+    1766, 1651, 1589, 1662, 1803, 1732, 1633, 1606, 1764, 1757, 1659, 1648, 1652, 1771, 1736, 1668,
+    1678, 1804, 1824, 1738, 1685, 1724, 1861, 1817, 1732, 1839, 1937, 1971, 1860, 1809, 1897, 1936,
+    1846, 1821, 1880, 1922, 1899, 1726, 1717, 1823, 1835, 1697, 1603, 1678, 1756, 1681, 1532, 1587,
+    1718, 1769, 1679, 1600, 1690, 1749, 1792, 1773, 1732, 1816, 1912, 1975, 1885, 1822, 1984, 2137,
+    2216, 2264, 2413, 2830, 3201, 3388, 3563, 3433, 3077, 2504, 1811, 1439, 1369, 1389, 1479, 1686,
+    1897, 2013, 2005, 1989, 2027, 2163, 2127, 2074, 2028, 2153, 2166, 2081, 2017, 2060, 2178, 2100,
+    1994, 2001, 2117, 2131, 2027, 1923, 1980, 2123, 2052, 1963, 1974, 2051, 2071, 1970, 1919, 1960,
+    1986, 1952, 1895, 1931, 2005, 1977, 1855, 1861, 1979, 1941, 1876, 1854, 1916, 2014, 1967, 1881,
+    1865, 1996, 2035, 1911, 1903, 1919, 2024, 2008, 1898, 2006, 2089, 2071, 2028, 1941, 2006, 2082,
+    2009, 1968, 2008, 2112, 2125, 1988, 1940, 2046, 2050, 1923, 1878, 1914, 1951, 1880, 1778, 1811,
+    1865, 1924, 1839, 1790, 1870, 1950, 1948, 1852, 1892, 2024, 2112, 2032, 1946, 2061, 2139, 2156,
+    2068, 2056, 2187, 2274, 2264, 2114, 2140, 2369, 2431, 2351, 2463, 2740, 3093, 3327, 3501, 3767,
+    3679, 3246, 2646, 2037, 1781, 1681, 1577, 1692, 1964, 2194, 2206, 2109, 2212, 2362, 2386, 2274,
+    2193, 2333, 2455, 2311, 2194, 2246, 2391, 2406, 2163, 2156, 2338, 2392, 2276, 2140, 2205, 2315,
+    2306, 2128, 2104, 2246, 2284, 2194, 2112, 2168, 2275, 2176, 2032, 2099, 2200, 2219, 2084, 2034,
+    2199, 2250, 2147, 2002, 2150, 2243, 2231, 2133, 2033, 2189, 2268, 2186, 2091, 2172, 2281, 2264,
+    2150, 2096, 2339, 2367, 2243, 2166, 2276, 2449, 2336, 2197, 2220, 2373, 2367, 2267, 2152, 2204,
+    2344, 2211, 2096, 2072, 2195, 2180, 1990, 1985, 2091, 2183, 2054, 1987, 2069, 2231, 2193, 2075,
+    2132, 2231, 2301, 2219, 2158, 2274, 2389, 2406, 2278, 2248, 2423, 2545, 2528, 2553, 2765, 3132,
+    3323, 3469, 3640, 3621, 3274, 2761, 2185, 1934, 1875, 1837, 1923, 2120, 2319, 2368, 2296, 2328,
+    2452, 2503, 2444, 2330, 2422, 2544, 2456, 2353, 2347, 2486, 2530, 2346, 2286, 2404, 2498, 2427,
+    2293, 2297, 2422, 2462, 2319, 2257, 2373, 2422, 2371, 2265, 2244, 2363, 2357, 2225, 2216, 2326,
+    2375, 2242, 2169, 2270, 2343, 2280, 2152, 2203, 2329, 2338, 2249, 2154, 2284, 2364, 2317, 2223,
+    2184, 2320, 2342, 2260, 2211, 2341, 2390, 2345, 2231, 2235, 2391, 2346, 2248, 2234, 2352, 2410,
+    2332, 2211, 2208, 2368, 2282, 2168, 2131, 2196, 2235, 2097, 2040, 2114, 2197, 2160, 2070, 2082,
+    2188, 2206, 2134, 2117, 2239, 2313, 2262, 2198, 2250, 2312, 2322, 2276, 2251, 2345, 2366, 2347,
+    2290, 2283, 2390, 2412, 2435, 2537, 2702, 2898, 3073, 3283, 3481, 3354, 3015, 2627, 2225, 2000,
+    1890, 1852, 1973, 2165, 2289, 2263, 2257, 2345, 2402, 2400, 2349, 2350, 2400, 2449, 2331, 2297,
+    2361, 2418, 2401, 2277, 2300, 2396, 2390, 2287, 2262, 2297, 2347, 2318, 2225, 2265, 2332, 2286,
+    2248, 2244, 2263, 2279, 2214, 2147, 2207, 2284, 2221, 2155, 2162, 2238, 2236, 2115, 2096, 2174,
+    2226, 2172, 2113, 2149, 2219, 2215, 2122, 2096, 2174, 2230, 2193, 2097, 2140, 2226, 2237, 2163,
+    2139, 2180, 2231, 2174, 2097, 2182, 2216, 2169, 2118, 2128, 2180, 2202, 2096, 2037, 2093, 2103,
+    2078, 1972, 1988, 2061, 2031, 1980, 1956, 2037, 2062, 1995, 1976, 2037, 2119, 2076, 2047, 2087,
+    2157, 2131, 2101, 2113, 2133, 2169, 2136, 2126, 2124, 2156, 2178, 2141, 2128, 2171, 2199, 2247,
+    2328, 2440, 2595, 2762, 2933, 3083, 2999, 2685, 2377, 2067, 1859, 1738, 1709, 1827, 1985, 2100,
+    2116, 2083, 2126, 2191, 2188, 2160, 2155, 2203, 2199, 2139, 2146, 2155, 2189, 2143, 2111, 2143,
+    2154, 2141, 2102, 2110, 2143, 2113, 2073, 2052, 2117, 2124, 2060, 2031, 2060, 2094, 2079, 1998,
+    1987, 2044, 2068, 2020, 1949, 1968, 2041, 2046, 1964, 1937, 1995, 1997, 1958, 1962, 1926, 1978,
+    1976, 1950, 1928, 1968, 1977, 1932, 1973, 1967, 1998, 1997, 1927, 1948, 1970, 1986, 1924, 1920,
+    1967, 1989, 1949, 1880, 1914, 1924, 1941, 1851, 1836, 1913, 1887, 1868, 1793, 1812, 1838, 1868,
+    1812, 1811, 1846, 1837, 1837, 1830, 1851, 1883, 1858, 1864, 1888, 1921, 1870, 1882, 1926, 1966,
+    1939, 1885, 1927, 1959, 1980, 1917, 1901, 1939, 1990, 2004, 1928, 1878, 1992, 2062, 2046, 2066,
+    2203, 2419, 2583, 2660, 2769, 2753, 2529, 2188, 1779, 1647, 1627, 1585, 1637, 1755, 1915, 1955,
+    1913, 1939, 2018, 2063, 1995, 1962, 1995, 2082, 2033, 1953, 1942, 2039, 2058, 1958, 1883, 1960,
+    2040, 2022, 1915, 1881, 1985, 2039, 1923, 1856, 1937, 1995, 1941, 1869, 1874, 1968, 1962, 1867,
+    1830, 1901, 1937, 1860, 1808, 1853, 1901, 1896, 1809, 1820, 1882, 1891, 1796, 1736, 1847, 1890,
+    1846, 1742, 1776, 1882, 1875, 1832, 1744, 1866, 1921, 1885, 1809, 1758, 1873, 1867, 1804, 1775,
+    1837, 1875, 1845, 1759, 1732, 1860, 1819, 1725, 1707, 1772, 1848, 1734, 1685, 1737, 1817, 1773,
+    1728, 1721, 1801, 1836, 1765, 1741, 1771, 1854, 1824, 1794, 1797, 1839, 1892, 1815, 1810, 1856,
+    1910, 1907, 1855, 1879, 1907, 1925, 1901, 1876, 1904, 1950, 1985, 1923, 1885, 1983, 2049, 2051,
+    2094, 2233, 2404, 2595, 2770, 2872, 2760, 2514, 2184, 1798, 1555, 1481, 1496, 1624, 1742, 1837,
+    1907, 1951, 1975, 1946, 2013, 2034, 2034, 2020, 2049, 2057, 2040, 2012, 2033, 2056, 2012, 2035,
+    2001, 2028, 2048, 2029, 2003, 1977, 2020, 2023, 2000, 1996, 1973, 2017, 2028, 1959, 1937, 1969,
+    1973, 1978, 1957, 1957, 1966, 1968, 1965, 1955, 1947, 1951, 1929, 1932, 1938, 1941, 1935, 1926,
+    1935, 1969, 1932, 1900, 1877, 1928, 1941, 1918, 1898, 1917, 1981, 1954, 1921, 1891, 1928, 1933,
+    1930, 1919, 1858, 1912, 1879, 1886, 1893, 1871, 1835, 1835, 1827, 1792, 1824, 1803, 1801, 1811,
+    1853, 1905, 1862, 1871, 1900, 1941, 1919, 1931, 1939, 1982, 2004, 1950, 1952, 1960, 2031, 2003,
+    1948, 1966, 2017, 2069, 1972, 1958, 2021, 2102, 2077, 2000, 2040, 2084, 2117, 2076, 2038, 2091,
+    2154, 2169, 2096, 2047, 2139, 2242, 2296, 2316, 2436, 2722, 2988, 3138, 3270, 3187, 2914, 2498,
+    1969, 1672, 1668, 1712, 1783, 1881, 2049, 2175, 2173, 2167, 2230, 2316, 2297, 2246, 2238, 2306,
+    2328, 2283, 2206, 2258, 2342, 2260, 2239, 2195, 2279, 2321, 2234, 2171, 2186, 2301, 2299, 2187,
+    2178, 2229, 2289, 2217, 2156, 2180, 2253, 2198, 2165, 2150, 2209, 2222, 2133, 2146, 2156, 2168,
+    2143, 2125, 2144, 2213, 2192, 2077, 2069, 2179, 2198, 2109, 2061, 2129, 2208, 2190, 2120, 2121,
+    2226, 2225, 2170, 2133, 2114, 2188, 2142, 2119, 2138, 2176, 2182, 2132, 2079, 2120, 2175, 2089,
+    2019, 2048, 2134, 2112, 2045, 2038, 2106, 2155, 2081, 2077, 2098, 2150, 2176, 2109, 2122, 2155,
+    2243, 2200, 2141, 2169, 2250, 2307, 2205, 2176, 2269, 2364, 2328, 2241, 2300, 2319, 2354, 2322,
+    2267, 2347, 2416, 2446, 2357, 2314, 2448, 2548, 2577, 2651, 2837, 3129, 3387, 3613, 3791, 3674,
+    3277, 2749, 2181, 1849, 1761, 1738, 1845, 2022, 2246, 2322, 2296, 2304, 2382, 2509, 2488, 2392,
+    2385, 2540, 2577, 2465, 2388, 2499, 2621, 2503, 2441, 2481, 2572, 2591, 2508, 2424, 2494, 2584,
+    2531, 2455, 2475, 2523, 2539, 2480, 2405, 2484, 2526, 2427, 2393, 2418, 2518, 2514, 2375, 2389,
+    2499, 2466, 2398, 2338, 2406, 2515, 2468, 2359, 2359, 2487, 2515, 2355, 2299, 2361, 2440, 2471,
+    2301, 2387, 2469, 2473, 2326, 2259, 2389, 2378, 2336, 2241, 2286, 2379, 2330, 2250, 2158, 2308,
+    2269, 2182, 2110, 2081, 2177, 2092, 2029, 2068, 2149, 2151, 2101, 2060, 2105, 2244, 2198, 2141,
+    2172, 2303, 2397, 2304, 2259, 2307, 2406, 2373, 2336, 2299, 2368, 2421, 2371, 2285, 2283, 2403,
+    2381, 2304, 2297, 2366, 2429, 2340, 2295, 2382, 2460, 2418, 2363, 2401, 2427, 2457, 2397, 2394,
+    2454, 2515, 2521, 2446, 2428, 2560, 2648, 2651, 2754, 2973, 3322, 3596, 3817, 4059, 3950, 3484,
+    2868, 2231, 1902, 1794, 1748, 1860, 2090, 2327, 2356, 2308, 2391, 2472, 2514, 2420, 2425, 2484,
+    2577, 2439, 2421, 2476, 2578, 2541, 2359, 2445, 2603, 2603, 2456, 2402, 2499, 2616, 2577, 2420,
+    2482, 2609, 2574, 2460, 2435, 2512, 2622, 2490, 2345, 2449, 2565, 2552, 2371, 2355, 2528, 2549,
+    2428, 2316, 2415, 2566, 2480, 2344, 2354, 2493, 2508, 2402, 2301, 2430, 2511, 2413, 2328, 2352,
+    2530, 2499, 2324, 2278, 2366, 2489, 2303, 2223, 2282, 2421, 2316, 2153, 2137, 2194, 2286, 2105,
+    1983, 2061, 2127, 2124, 1878, 1911, 2017, 2067, 1990, 1858, 1961, 2059, 2010, 1945, 2015, 2107,
+    2130, 2060, 2034, 2190, 2166, 2111, 2110, 2203, 2308, 2221, 2157, 2176, 2297, 2265, 2219, 2156,
+    2231, 2280, 2211, 2163, 2142, 2262, 2225, 2158, 2147, 2203, 2265, 2179, 2140, 2212, 2300, 2271,
+    2181, 2226, 2269, 2278, 2250, 2211, 2299, 2350, 2349, 2253, 2249, 2379, 2457, 2459, 2575, 2800,
+    3128, 3375, 3623, 3839, 3730, 3295, 2665, 2022, 1688, 1592, 1570, 1671, 1883, 2108, 2162, 2150,
+    2167, 2243, 2326, 2249, 2199, 2257, 2349, 2262, 2168, 2214, 2299, 2328, 2152, 2141, 2281, 2342,
+    2239, 2152, 2198, 2364, 2308, 2130, 2164, 2319, 2340, 2263, 2166, 2231, 2339, 2290, 2120, 2142,
+    2305, 2345, 2200, 2100, 2226, 2332, 2235, 2049, 2123, 2284, 2281, 2162, 2091, 2207, 2322, 2201,
+    2057, 2141, 2246, 2229, 2121, 2068, 2275, 2312, 2183, 2055, 2150, 2280, 2125, 1992, 2002, 2146,
+    2192, 2014, 1883, 1972, 2112, 1936, 1744, 1787, 1898, 1893, 1685, 1613, 1747, 1836, 1791, 1635,
+    1693, 1824, 1827, 1761, 1674, 1813, 1868, 1835, 1802, 1858, 1895, 1907, 1852, 1841, 1969, 1920,
+    1885, 1867, 1957, 2050, 1963, 1894, 1935, 2009, 2000, 1945, 1896, 1960, 2027, 1943, 1887, 1879,
+    1999, 1963, 1899, 1888, 1932, 2000, 1910, 1883, 1953, 2009, 1984, 1929, 1960, 1987, 2022, 1985,
+    1959, 2020, 2065, 2070, 1999, 1980, 2088, 2158, 2180, 2279, 2459, 2744, 2993, 3181, 3365, 3276,
+    2906, 2353, 1793, 1509, 1426, 1387, 1505, 1697, 1886, 1936, 1908, 1941, 1999, 2067, 2032, 2004,
+    2037, 2090, 2043, 2001, 2007, 2061, 2076, 1960, 1956, 2020, 2064, 1980, 1928, 1939, 2012, 2034,
+    1910, 1894, 1995, 2015, 1977, 1892, 1923, 2018, 2015, 1899, 1868, 2000, 2092, 1989, 1887, 1973,
+    2078, 2049, 1918, 1950, 2041, 2116, 2045, 1964, 2009, 2101, 2092, 1957, 1972, 2055, 2076, 2037,
+    1962, 2083, 2133, 2053, 1989, 1974, 2077, 2067, 1943, 1916, 2023, 2068, 1987, 1840, 1863, 1999,
+    1955, 1785, 1722, 1844, 1883, 1719, 1634, 1665, 1775, 1784, 1679, 1635, 1737, 1796, 1722, 1655,
+    1738, 1806, 1813, 1751, 1746, 1819, 1835, 1814, 1763, 1823, 1838, 1835, 1799, 1771, 1812, 1832,
+    1811, 1803, 1829, 1856, 1844, 1798, 1788, 1875, 1888, 1827, 1791, 1881, 1935, 1927, 1845, 1866,
+    1942, 1921, 1900, 1868, 1897, 1946, 1908, 1878, 1844, 1940, 1924, 1893, 1893, 1919, 1942, 1902,
+    1881, 1936, 1974, 1956, 1918, 1953, 1975, 1982, 1948, 1949, 1994, 2046, 2040, 1978, 1967, 2091,
+    2129, 2144, 2189, 2373, 2599, 2782, 2927, 3072, 2998, 2731, 2307, 1857, 1639, 1557, 1558, 1643,
+    1776, 1915, 1961, 1957, 1999, 2030, 2077, 2050, 2040, 2070, 2108, 2073, 2036, 2056, 2121, 2100,
+    2018, 2029, 2099, 2120, 2065, 2010, 2013, 2078, 2078, 1987, 2009, 2076, 2072, 2040, 2003, 2029,
+    2093, 2050, 2003, 2033, 2094, 2107, 2024, 2037, 2125, 2156, 2058, 2031, 2121, 2169, 2147, 2113,
+    2129, 2173, 2184, 2139, 2075, 2158, 2227, 2159, 2120, 2138, 2247, 2258, 2131, 2132, 2196, 2242,
+    2157, 2074, 2128, 2244, 2187, 2092, 2059, 2100, 2180, 2069, 1978, 2020, 2071, 2032, 1934, 1932,
+    2018, 1993, 1930, 1926, 1968, 2016, 1988, 1935, 2010, 2049, 2023, 1970, 2016, 2060, 2058, 2008,
+    2002, 2070, 2079, 2077, 2007, 2041, 2096, 2094, 2069, 2000, 2076, 2075, 2067, 2065, 2071, 2094,
+    2111, 2085, 2062, 2147, 2112, 2099, 2097, 2147, 2204, 2144, 2121, 2147, 2203, 2160, 2143, 2159,
+    2196, 2196, 2157, 2135, 2151, 2214, 2194, 2140, 2143, 2170, 2229, 2158, 2134, 2188, 2248, 2244,
+    2202, 2221, 2224, 2264, 2235, 2214, 2252, 2301, 2315, 2280, 2253, 2309, 2361, 2401, 2452, 2589,
+    2747, 2895, 3047, 3171, 3108, 2843, 2519, 2163, 1977, 1938, 1895, 1957, 2120, 2243, 2269, 2245,
+    2277, 2326, 2379, 2342, 2319, 2327, 2390, 2364, 2344, 2327, 2356, 2381, 2331, 2301, 2363, 2369,
+    2344, 2320, 2315, 2363, 2371, 2317, 2318, 2360, 2366, 2343, 2334, 2335, 2378, 2349, 2280, 2321,
+    2351, 2357, 2327, 2311, 2339, 2353, 2339, 2314, 2329, 2347, 2388, 2376, 2355, 2374, 2363, 2414,
+    2414, 2399, 2392, 2405, 2443, 2431, 2470, 2462, 2461, 2477, 2462, 2452, 2429, 2428, 2485, 2439,
+    2425, 2415, 2411, 2409, 2393, 2358, 2356, 2338, 2345, 2305, 2277, 2301, 2285, 2270, 2289, 2289,
+    2287, 2273, 2282, 2324, 2321, 2298, 2276, 2353, 2387, 2333, 2279, 2289, 2352, 2364, 2312, 2284,
+    2326, 2378, 2314, 2249, 2274, 2312, 2327, 2264, 2245, 2308, 2316, 2328, 2246, 2277, 2309, 2303,
+    2294, 2237, 2312, 2305, 2285, 2285, 2313, 2312, 2311, 2268, 2271, 2358, 2334, 2285, 2287, 2340,
+    2420, 2369, 2315, 2346, 2404, 2375, 2333, 2326, 2362, 2393, 2345, 2323, 2312, 2369, 2376, 2323,
+    2316, 2356, 2396, 2343, 2322, 2361, 2419, 2405, 2369, 2384, 2409, 2413, 2388, 2366, 2418, 2446,
+    2451, 2392, 2405, 2484, 2517, 2534, 2591, 2729, 2928, 3070, 3216, 3379, 3295, 3043, 2670, 2277,
+    2068, 2022, 1985, 2061, 2188, 2328, 2360, 2360, 2365, 2405, 2457, 2432, 2403, 2446, 2448, 2435,
+    2397, 2409, 2446, 2440, 2369, 2397, 2442, 2434, 2415, 2380, 2386, 2418, 2438, 2352, 2356, 2416,
+    2418, 2382, 2335, 2364, 2411, 2398, 2306, 2327, 2374, 2394, 2353, 2304, 2357, 2384, 2337, 2276,
+    2302, 2381, 2368, 2295, 2291, 2351, 2390, 2319, 2281, 2367, 2431, 2374, 2306, 2350, 2510, 2476,
+    2363, 2334, 2427, 2493, 2404, 2323, 2381, 2497, 2448, 2340, 2287, 2372, 2466, 2314, 2222, 2248,
+    2316, 2316, 2144, 2150, 2254, 2270, 2193, 2134, 2180, 2277, 2208, 2150, 2201, 2248, 2268, 2185,
+    2186, 2267, 2285, 2197, 2160, 2216, 2275, 2197, 2147, 2130, 2206, 2215, 2155, 2113, 2160, 2223,
+    2127, 2057, 2095, 2136, 2151, 2060, 2054, 2095, 2133, 2110, 2027, 2072, 2093, 2108, 2066, 2003,
+    2079, 2090, 2074, 2045, 2083, 2093, 2089, 2031, 2031, 2123, 2085, 2044, 2034, 2110, 2200, 2113,
+    2056, 2081, 2180, 2141, 2102, 2067, 2117, 2178, 2098, 2060, 2048, 2137, 2132, 2055, 2052, 2095,
+    2138, 2078, 2057, 2092, 2152, 2138, 2084, 2115, 2137, 2142, 2117, 2091, 2144, 2193, 2192, 2111,
+    2111, 2221, 2283, 2298, 2379, 2564, 2812, 3025, 3204, 3384, 3294, 2951, 2448, 1930, 1668, 1581,
+    1563, 1632, 1844, 2010, 2052, 2040, 2054, 2106, 2172, 2133, 2098, 2118, 2168, 2153, 2092, 2110,
+    2159, 2154, 2066, 2069, 2125, 2143, 2091, 2032, 2045, 2101, 2110, 2017, 2036, 2092, 2096, 2047,
+    2012, 2032, 2081, 2054, 1968, 1977, 2055, 2066, 2012, 1963, 2017, 2086, 2032, 1956, 1981, 2055,
+    2061, 2033, 1980, 2022, 2068, 2051, 1980, 2000, 2061, 2038, 2027, 1999, 2077, 2097, 2017, 1965,
+    1981, 2060, 2018, 1915, 1908, 2003, 2035, 1956, 1832, 1880, 2006, 1978, 1832, 1735, 1882, 1997,
+    1839, 1722, 1770, 1928, 1919, 1802, 1788, 1889, 1968, 1902, 1859, 1884, 1986, 1999, 1910, 1900,
+    1951, 1984, 1990, 1893, 1934, 1999, 1953, 1908, 1868, 1970, 1986, 1873, 1839, 1899, 1970, 1907,
+    1813, 1810, 1920, 1939, 1838, 1765, 1857, 1921, 1847, 1748, 1724, 1823, 1871, 1774, 1711, 1771,
+    1832, 1758, 1664, 1713, 1739, 1754, 1665, 1653, 1741, 1743, 1722, 1623, 1704, 1737, 1733, 1690,
+    1616, 1712, 1724, 1673, 1649, 1717, 1754, 1734, 1654, 1638, 1786, 1780, 1698, 1653, 1762, 1864,
+    1797, 1702, 1724, 1839, 1828, 1798, 1728, 1776, 1846, 1782, 1736, 1719, 1817, 1804, 1741, 1739,
+    1784, 1830, 1744, 1730, 1838, 1874, 1850, 1772, 1820, 1867, 1888, 1822, 1813, 1882, 1947, 1947,
+    1849, 1828, 1980, 2082, 2075, 2168, 2407, 2735, 3015, 3231, 3443, 3337, 2918, 2314, 1653, 1316,
+    1213, 1198, 1339, 1547, 1759, 1817, 1793, 1852, 1896, 1966, 1919, 1898, 1942, 1991, 1944, 1895,
+    1916, 1978, 1999, 1868, 1860, 1952, 1992, 1927, 1851, 1849, 1943, 1981, 1858, 1839, 1934, 1951,
+    1904, 1835, 1876, 1941, 1913, 1829, 1837, 1901, 1936, 1875, 1820, 1904, 1952, 1900, 1820, 1863,
+    1944, 1945, 1886, 1865, 1925, 1955, 1933, 1871, 1918, 1997, 1963, 1926, 1903, 2053, 2079, 1976,
+    1931, 1950, 2045, 2000, 1899, 1898, 1979, 1988, 1911, 1816, 1826, 1922, 1848, 1779, 1708, 1738,
+    1809, 1708, 1656, 1663, 1705, 1752, 1754, 1721, 1710, 1819, 1872, 1847, 1820, 1857, 1926, 1957,
+    1939, 1933, 1967, 2020, 1993, 1948, 1970, 2024, 2040, 1953, 1943, 2002, 2027, 2002, 1902, 1957,
+    2031, 2001, 1935, 1899, 1987, 2061, 1942, 1871, 1947, 2025, 1995, 1890, 1860, 1996, 2002, 1927,
+    1858, 1904, 1992, 1929, 1849, 1832, 1885, 1946, 1858, 1836, 1878, 1916, 1855, 1774, 1819, 1863,
+    1858, 1794, 1794, 1860, 1875, 1852, 1757, 1854, 1881, 1880, 1812, 1750, 1860, 1889, 1834, 1783,
+    1850, 1910, 1918, 1828, 1788, 1923, 1934, 1880, 1847, 1945, 2045, 1980, 1916, 1923, 2005, 2001,
+    1978, 1940, 1992, 2033, 1962, 1937, 1927, 2032, 2013, 1944, 1949, 2011, 2063, 1960, 1939, 2062,
+    2123, 2067, 2005, 2060, 2089, 2127, 2071, 2035, 2123, 2193, 2207, 2102, 2080, 2235, 2341, 2336,
+    2406, 2621, 2965, 3242, 3475, 3668, 3542, 3143, 2574, 1928, 1605, 1511, 1483, 1619, 1833, 2055,
+    2072, 2063, 2126, 2207, 2244, 2212, 2178, 2234, 2311, 2225, 2160, 2203, 2284, 2303, 2167, 2149,
+    2253, 2277, 2238, 2156, 2154, 2249, 2282, 2168, 2175, 2237, 2240, 2228, 2177, 2187, 2228, 2240,
+    2138, 2172, 2248, 2250, 2193, 2155, 2245, 2276, 2214, 2137, 2209, 2280, 2270, 2227, 2180, 2242,
+    2320, 2273, 2197, 2227, 2316, 2319, 2265, 2224, 2349, 2382, 2324, 2256, 2278, 2352, 2316, 2241,
+    2234, 2322, 2326, 2268, 2201, 2188, 2277, 2191, 2112, 2083, 2145, 2153, 2022, 2003, 2061, 2084,
+    2058, 2024, 2063, 2115, 2092, 2059, 2092, 2151, 2163, 2128, 2142, 2205, 2241, 2176, 2186, 2238,
+    2283, 2255, 2204, 2263, 2329, 2300, 2248, 2253, 2306, 2323, 2276, 2280, 2317, 2338, 2303, 2279,
+    2283, 2342, 2336, 2265, 2263, 2334, 2343, 2323, 2237, 2276, 2336, 2314, 2265, 2233, 2313, 2363,
+    2273, 2214, 2251, 2321, 2317, 2227, 2214, 2293, 2308, 2258, 2199, 2232, 2285, 2244, 2188, 2191,
+    2208, 2265, 2208, 2169, 2221, 2240, 2153, 2106, 2161, 2211, 2195, 2104, 2119, 2184, 2191, 2151,
+    2071, 2161, 2200, 2200, 2155, 2066, 2159, 2185, 2156, 2118, 2155, 2202, 2194, 2151, 2103, 2208,
+    2193, 2166, 2147, 2211, 2280, 2238, 2193, 2199, 2259, 2231, 2204, 2201, 2235, 2261, 2201, 2172,
+    2197, 2276, 2232, 2172, 2185, 2253, 2285, 2182, 2169, 2238, 2292, 2257, 2208, 2243, 2257, 2299,
+    2259, 2237, 2282, 2332, 2336, 2286, 2242, 2349, 2425, 2448, 2517, 2663, 2872, 3102, 3274, 3424,
+    3324, 3010, 2584, 2122, 1885, 1791, 1757, 1861, 2038, 2188, 2208, 2177, 2232, 2302, 2323, 2293,
+    2256, 2301, 2350, 2301, 2259, 2252, 2337, 2336, 2249, 2228, 2294, 2312, 2289, 2237, 2206, 2285,
+    2309, 2223, 2224, 2259, 2263, 2248, 2216, 2234, 2249, 2226, 2180, 2193, 2251, 2264, 2211, 2157,
+    2231, 2276, 2216, 2155, 2209, 2262, 2257, 2202, 2173, 2232, 2268, 2234, 2172, 2186, 2245, 2253,
+    2230, 2175, 2269, 2291, 2247, 2208, 2208, 2247, 2214, 2196, 2187, 2218, 2213, 2173, 2112, 2132,
+    2189, 2124, 2028, 2037, 2066, 2072, 1998, 1947, 2008, 2035, 2004, 1943, 1979, 2033, 2038, 1990,
+    2012, 2045, 2081, 2061, 2045, 2052, 2087, 2094, 2093, 2076, 2066, 2077, 2102, 2092, 2068, 2064,
+    2083, 2082, 2095, 2062, 2060, 2062, 2061, 2056, 2039, 2045, 2036, 2053, 2051, 2046, 2017, 2001,
+    2036, 2042, 2040, 1986, 2009, 2043, 2058, 2022, 1985, 2051, 2079, 2060, 2009, 2012, 2070, 2085,
+    2050, 2024, 2043, 2089, 2059, 2030, 2012, 2057, 2062, 2047, 1996, 2017, 2041, 2050, 1981, 2004,
+    2027, 2014, 1993, 1964, 2007, 2029, 1963, 1926, 1984, 2001, 1980, 1912, 1928, 1986, 1995, 1914,
+    1895, 1929, 1965, 1936, 1872, 1854, 1898, 1938, 1886, 1834, 1872, 1911, 1859, 1811, 1834, 1868,
+    1851, 1810, 1790, 1840, 1816, 1828, 1776, 1836, 1837, 1827, 1793, 1763, 1815, 1802, 1783, 1754,
+    1808, 1824, 1811, 1759, 1766, 1854, 1836, 1792, 1761, 1832, 1897, 1841, 1791, 1790, 1878, 1857,
+    1822, 1803, 1817, 1858, 1829, 1787, 1794, 1830, 1816, 1786, 1789, 1818, 1843, 1788, 1784, 1814,
+    1845, 1829, 1799, 1806, 1835, 1847, 1812, 1782, 1851, 1878, 1863, 1801, 1811, 1895, 1947, 1957,
+    1989, 2126, 2300, 2476, 2555, 2671, 2630, 2393, 2060, 1688, 1508, 1442, 1440, 1504, 1624, 1736,
+    1767, 1762, 1792, 1805, 1848, 1829, 1816, 1841, 1858, 1832, 1789, 1808, 1863, 1853, 1772, 1772,
+    1841, 1856, 1800, 1759, 1769, 1806, 1834, 1755, 1743, 1817, 1817, 1806, 1753, 1751, 1815, 1780,
+    1724, 1731, 1764, 1786, 1767, 1726, 1766, 1798, 1756, 1722, 1756, 1778, 1777, 1740, 1744, 1765,
+    1790, 1775, 1731, 1755, 1798, 1789, 1759, 1744, 1814, 1829, 1786, 1755, 1775, 1825, 1784, 1741,
+    1726, 1765, 1787, 1744, 1701, 1702, 1749, 1716, 1675, 1642, 1651, 1681, 1629, 1589, 1627, 1630,
+    1623, 1609, 1609, 1652, 1662, 1634, 1641, 1687, 1675, 1673, 1683, 1694, 1717, 1701, 1688, 1709,
+    1712, 1724, 1699, 1703, 1712, 1723, 1717, 1709, 1719, 1718, 1720, 1710, 1702, 1703, 1728, 1712,
+    1736, 1717, 1718, 1715, 1720, 1725, 1712, 1703, 1732, 1714, 1711, 1711, 1709, 1722, 1729, 1718,
+    1728, 1712, 1724, 1736, 1730, 1714, 1721, 1721, 1741, 1726, 1718, 1718, 1735, 1738, 1726, 1710,
+    1719, 1730, 1728, 1731, 1715, 1721, 1737, 1751, 1730, 1723, 1723, 1738, 1741, 1729, 1736, 1721,
+    1753, 1752, 1747, 1741, 1738, 1735, 1758, 1736, 1743, 1747, 1748, 1752, 1762, 1751, 1730, 1777,
+    1762, 1745, 1760, 1745, 1759, 1776, 1767, 1761, 1749, 1764, 1762, 1767, 1763, 1770, 1781, 1775,
+    1773, 1765, 1772, 1784, 1787, 1779, 1773, 1766, 1786, 1790, 1781, 1781, 1772, 1777, 1817, 1803,
+    1785, 1782, 1812, 1810, 1798, 1822, 1780, 1803, 1818, 1815, 1791, 1799, 1796, 1803, 1820, 1812,
+    1806, 1819, 1826, 1825, 1818, 1807, 1825, 1835, 1829, 1814, 1801, 1829, 1850, 1855, 1829, 1834,
+    1822, 1842, 1843, 1845, 1838, 1835, 1868, 1833, 1846, 1834, 1836, 1853, 1862, 1855, 1842, 1860,
+    1872, 1882, 1861, 1868, 1876, 1885, 1864, 1872, 1879, 1873, 1895, 1893, 1884, 1871, 1888, 1892,
+    1891, 1881, 1888, 1891, 1904, 1907, 1903, 1905, 1914, 1917, 1907, 1899, 1906, 1920, 1926, 1915,
+    1919, 1901, 1912, 1923, 1930, 1928, 1938, 1940, 1947, 1943, 1928, 1925,
+};
+
+static const int32_t rate_change_ann[45] = {
+    100, 398, 666, 916, 1147, 1364, 1560, 1746, 1921, 2085, 2241, 2391,
+    2534, 2670, 2805, 2933, 3051, 3176, 3296, 3412, 3530, 3646, 3761, 3874,
+    3990, 4102, 4223, 4338, 4458, 4581, 4708, 4837, 4972, 5102, 5245, 5395,
+    5550, 5719, 5891, 6075, 6265, 6474, 6693, 6927, 7189,
+};
+
+static const int16_t ectopic_noise_data[7500] = {
+    2278, 2360, 2248, 2185, 2152, 2227, 2246, 2273, 2246, 2107, 2220, 2317, 2341, 2238, 2135, 2210,
+    2351, 2349, 2155, 2041, 2174, 2329, 2375, 2083, 2030, 2199, 2327, 2315, 2005, 2066, 2209, 2381,
+    2177, 2107, 2094, 2233, 2314, 2226, 2107, 2133, 2253, 2367, 2157, 2197, 2158, 2207, 2320, 2300,
+    2247, 2170, 2221, 2313, 2385, 2232, 2126, 2300, 2390, 2387, 2280, 2182, 2328, 2511, 2447, 2289,
+    2240, 2362, 2520, 2481, 2276, 2197, 2477, 2531, 2400, 2247, 2291, 2427, 2458, 2395, 2341, 2404,
+    2450, 2486, 2530, 2408, 2410, 2496, 2554, 2570, 2490, 2430, 2519, 2629, 2670, 2593, 2568, 2743,
+    3027, 3260, 3326, 3479, 3735, 3812, 3419, 2778, 2204, 2113, 2170, 2058, 2030, 2170, 2485, 2594,
+    2584, 2453, 2506, 2648, 2717, 2613, 2533, 2558, 2650, 2707, 2650, 2603, 2591, 2575, 2676, 2699,
+    2622, 2533, 2557, 2705, 2698, 2576, 2496, 2601, 2742, 2720, 2567, 2457, 2602, 2785, 2658, 2499,
+    2483, 2657, 2742, 2686, 2477, 2534, 2699, 2748, 2618, 2522, 2580, 2660, 2762, 2688, 2584, 2649,
+    2682, 2777, 2663, 2573, 2611, 2686, 2745, 2805, 2643, 2576, 2641, 2792, 2833, 2624, 2542, 2638,
+    2815, 2786, 2580, 2512, 2589, 2845, 2656, 2484, 2375, 2599, 2683, 2531, 2362, 2349, 2507, 2546,
+    2518, 2365, 2412, 2549, 2643, 2521, 2513, 2513, 2611, 2616, 2681, 2663, 2602, 2653, 2726, 2780,
+    2653, 2538, 2627, 2836, 2819, 2637, 2579, 2645, 2854, 2813, 2598, 2544, 2698, 2838, 2779, 2599,
+    2531, 2742, 2822, 2706, 2561, 2540, 2752, 2736, 2644, 2571, 2588, 2687, 2720, 2641, 2560, 2570,
+    2613, 2639, 2699, 2586, 2457, 2541, 2602, 2625, 2555, 2382, 2503, 2629, 2677, 2426, 2341, 2460,
+    2634, 2621, 2395, 2285, 2539, 2659, 2559, 2382, 2339, 2516, 2651, 2571, 2364, 2340, 2452, 2587,
+    2472, 2402, 2361, 2532, 2582, 2507, 2463, 2403, 2459, 2572, 2596, 2539, 2415, 2530, 2618, 2681,
+    2512, 2380, 2448, 2674, 2628, 2441, 2355, 2477, 2636, 2594, 2386, 2352, 2454, 2693, 2556, 2345,
+    2388, 2584, 2679, 2561, 2485, 2437, 2548, 2628, 2594, 2473, 2519, 2644, 2673, 2614, 2553, 2583,
+    2697, 2880, 2979, 3124, 3282, 3569, 3888, 3762, 3254, 2779, 2376, 2227, 2051, 1862, 1971, 2260,
+    2551, 2529, 2390, 2346, 2545, 2666, 2544, 2415, 2458, 2546, 2677, 2540, 2412, 2441, 2572, 2550,
+    2523, 2452, 2447, 2479, 2592, 2555, 2480, 2363, 2425, 2485, 2559, 2420, 2307, 2367, 2539, 2551,
+    2348, 2243, 2314, 2534, 2525, 2326, 2275, 2382, 2514, 2479, 2245, 2260, 2446, 2563, 2489, 2311,
+    2245, 2436, 2575, 2396, 2319, 2303, 2405, 2534, 2442, 2362, 2368, 2368, 2454, 2464, 2354, 2232,
+    2333, 2449, 2482, 2330, 2197, 2239, 2374, 2398, 2224, 2100, 2190, 2324, 2270, 2054, 1948, 2124,
+    2220, 2179, 2039, 1943, 2097, 2236, 2201, 2071, 2037, 2147, 2236, 2188, 2111, 2076, 2114, 2257,
+    2268, 2140, 2053, 2169, 2367, 2338, 2151, 2063, 2172, 2342, 2365, 2121, 2058, 2211, 2356, 2294,
+    2122, 2105, 2253, 2365, 2214, 2076, 2055, 2212, 2334, 2188, 2066, 2070, 2175, 2242, 2137, 2068,
+    2104, 2072, 2158, 2141, 2113, 2027, 2056, 2157, 2188, 2060, 1903, 2004, 2180, 2131, 1988, 1873,
+    1922, 2116, 2114, 1884, 1829, 1947, 2125, 2018, 1822, 1807, 1944, 2079, 1893, 1815, 1810, 1906,
+    2014, 1853, 1768, 1805, 1897, 2007, 1856, 1782, 1761, 1907, 1953, 1931, 1810, 1761, 1841, 1943,
+    2027, 1868, 1752, 1825, 2004, 2002, 1835, 1769, 1878, 2087, 1975, 1856, 1771, 1917, 2078, 1910,
+    1777, 1723, 1983, 2021, 1911, 1802, 1757, 1979, 1958, 1913, 1812, 1874, 1880, 2008, 1957, 1868,
+    1816, 1923, 2010, 2031, 1937, 1908, 1958, 2012, 2059, 1985, 2005, 2163, 2480, 2673, 2720, 2907,
+    3214, 3185, 2778, 2165, 1660, 1472, 1501, 1459, 1404, 1546, 1810, 1953, 1912, 1809, 1840, 1973,
+    2067, 1994, 1882, 1906, 1982, 2026, 1987, 1883, 1886, 1885, 1985, 1991, 1916, 1882, 1886, 1990,
+    2011, 1867, 1752, 1847, 2024, 2002, 1836, 1743, 1856, 2044, 1942, 1775, 1719, 1905, 2054, 1948,
+    1721, 1767, 1944, 1965, 1824, 1781, 1802, 1936, 1993, 1918, 1836, 1860, 1928, 1971, 1936, 1889,
+    1813, 1918, 1929, 2040, 1914, 1806, 1924, 2032, 2031, 1832, 1799, 1892, 2057, 1979, 1833, 1699,
+    1802, 2001, 1860, 1679, 1559, 1785, 1895, 1745, 1573, 1582, 1725, 1860, 1775, 1596, 1619, 1813,
+    1863, 1796, 1718, 1747, 1863, 1914, 1917, 1807, 1787, 1897, 2032, 1916, 1803, 1830, 1863, 2016,
+    1945, 1832, 1812, 1882, 2004, 2000, 1831, 1752, 1854, 2045, 2017, 1812, 1744, 1901, 2054, 1969,
+    1782, 1746, 1966, 2032, 1977, 1734, 1784, 1873, 1963, 1893, 1761, 1761, 1905, 1969, 1892, 1856,
+    1784, 1863, 1974, 1935, 1805, 1757, 1867, 1905, 1910, 1803, 1692, 1791, 1993, 1936, 1807, 1755,
+    1786, 1986, 1932, 1762, 1726, 1872, 1998, 1950, 1818, 1767, 1935, 2026, 1932, 1789, 1783, 1980,
+    2080, 2005, 1853, 1851, 1966, 2062, 2018, 1925, 1854, 2006, 1999, 1966, 1882, 1838, 1941, 2114,
+    2033, 1968, 1842, 1962, 2088, 2167, 1952, 1863, 2070, 2154, 2133, 1957, 1884, 2020, 2201, 2209,
+    1998, 1928, 2142, 2253, 2278, 2149, 2188, 2501, 2743, 2791, 2768, 2693, 2614, 2392, 2004, 1823,
+    1672, 1771, 1971, 2019, 2018, 1940, 2073, 2188, 2254, 2101, 2069, 2174, 2251, 2268, 2124, 2038,
+    2155, 2335, 2306, 2068, 2033, 2208, 2333, 2267, 2064, 2094, 2196, 2340, 2239, 2103, 2103, 2195,
+    2328, 2284, 2135, 2131, 2228, 2290, 2304, 2142, 2137, 2237, 2311, 2276, 2166, 2157, 2173, 2338,
+    2349, 2205, 2089, 2183, 2379, 2345, 2205, 2130, 2268, 2382, 2332, 2240, 2141, 2302, 2413, 2402,
+    2195, 2169, 2361, 2442, 2379, 2200, 2153, 2317, 2417, 2329, 2239, 2228, 2267, 2376, 2308, 2190,
+    2194, 2181, 2348, 2337, 2138, 2126, 2222, 2320, 2312, 2163, 2144, 2268, 2340, 2373, 2249, 2194,
+    2360, 2469, 2351, 2287, 2275, 2384, 2434, 2428, 2428, 2308, 2387, 2558, 2514, 2400, 2352, 2419,
+    2591, 2577, 2477, 2333, 2451, 2618, 2599, 2338, 2307, 2497, 2589, 2563, 2341, 2321, 2577, 2625,
+    2526, 2328, 2372, 2527, 2569, 2479, 2445, 2423, 2533, 2561, 2548, 2402, 2361, 2450, 2512, 2521,
+    2413, 2349, 2427, 2498, 2501, 2437, 2278, 2361, 2542, 2476, 2369, 2213, 2393, 2536, 2497, 2242,
+    2270, 2428, 2545, 2551, 2221, 2293, 2428, 2501, 2505, 2215, 2295, 2421, 2512, 2418, 2376, 2338,
+    2416, 2477, 2448, 2385, 2367, 2432, 2508, 2505, 2461, 2404, 2442, 2633, 2613, 2470, 2403, 2480,
+    2641, 2656, 2431, 2369, 2467, 2721, 2609, 2430, 2292, 2517, 2664, 2571, 2403, 2409, 2608, 2717,
+    2624, 2473, 2498, 2595, 2700, 2582, 2535, 2595, 2672, 2725, 2563, 2580, 2723, 2785, 2938, 3019,
+    3229, 3412, 3724, 3917, 3925, 3421, 2902, 2390, 2297, 2278, 2096, 2087, 2407, 2741, 2756, 2581,
+    2470, 2737, 2928, 2790, 2645, 2558, 2801, 2829, 2755, 2512, 2632, 2799, 2768, 2682, 2610, 2615,
+    2770, 2705, 2593, 2585, 2618, 2640, 2693, 2671, 2611, 2587, 2589, 2650, 2717, 2539, 2408, 2448,
+    2649, 2708, 2486, 2386, 2495, 2713, 2647, 2398, 2296, 2486, 2699, 2595, 2369, 2372, 2552, 2684,
+    2542, 2347, 2427, 2585, 2637, 2530, 2449, 2457, 2555, 2572, 2519, 2489, 2443, 2541, 2563, 2579,
+    2539, 2410, 2332, 2525, 2623, 2461, 2309, 2384, 2495, 2554, 2321, 2149, 2307, 2527, 2516, 2286,
+    2208, 2416, 2569, 2435, 2268, 2281, 2466, 2564, 2493, 2316, 2369, 2591, 2630, 2521, 2426, 2401,
+    2605, 2647, 2580, 2453, 2464, 2607, 2586, 2597, 2508, 2569, 2703, 2859, 3010, 3139, 3340, 3598,
+    3914, 3746, 3242, 2751, 2324, 2189, 2067, 1912, 1949, 2201, 2550, 2508, 2337, 2318, 2529, 2682,
+    2605, 2409, 2445, 2567, 2648, 2549, 2435, 2409, 2546, 2556, 2490, 2411, 2383, 2503, 2577, 2469,
+    2425, 2355, 2387, 2511, 2539, 2404, 2274, 2361, 2523, 2517, 2408, 2230, 2348, 2569, 2442, 2262,
+    2290, 2382, 2559, 2450, 2224, 2236, 2382, 2558, 2459, 2281, 2250, 2376, 2500, 2366, 2291, 2250,
+    2379, 2484, 2413, 2356, 2300, 2369, 2507, 2450, 2318, 2292, 2304, 2426, 2415, 2329, 2191, 2234,
+    2340, 2356, 2176, 2045, 2179, 2276, 2251, 2039, 1961, 2085, 2283, 2189, 2017, 1968, 2150, 2235,
+    2170, 2063, 2037, 2178, 2304, 2230, 2101, 2009, 2166, 2310, 2225, 2098, 2066, 2169, 2305, 2248,
+    2087, 2072, 2147, 2249, 2228, 2091, 2025, 2113, 2238, 2210, 2077, 2057, 2120, 2229, 2134, 2075,
+    2019, 2108, 2201, 2107, 2046, 1961, 2129, 2221, 2188, 2008, 1994, 2041, 2223, 2139, 1966, 1939,
+    2036, 2177, 2106, 1948, 1924, 2038, 2160, 2126, 1996, 1928, 2070, 2077, 2089, 1967, 1860, 2000,
+    2120, 2015, 1885, 1882, 1990, 2119, 2065, 1885, 1843, 1982, 2032, 1973, 1900, 1881, 1959, 2056,
+    2075, 1987, 1881, 1948, 2065, 2096, 1938, 1799, 1985, 2100, 2096, 1932, 1837, 1950, 2163, 2098,
+    1884, 1786, 1965, 2115, 2039, 1825, 1779, 1988, 2040, 1961, 1777, 1818, 2000, 2012, 1881, 1810,
+    1835, 1923, 1949, 1854, 1805, 1772, 1824, 1898, 1903, 1798, 1719, 1735, 1848, 1869, 1729, 1616,
+    1682, 1851, 1867, 1652, 1554, 1714, 1821, 1850, 1622, 1505, 1702, 1827, 1774, 1561, 1565, 1653,
+    1892, 1757, 1549, 1544, 1693, 1794, 1690, 1627, 1587, 1737, 1755, 1722, 1614, 1628, 1668, 1744,
+    1807, 1711, 1636, 1696, 1827, 1891, 1703, 1654, 1698, 1837, 1838, 1629, 1522, 1669, 1828, 1782,
+    1583, 1532, 1680, 1870, 1742, 1618, 1619, 1804, 1849, 1753, 1619, 1616, 1792, 1843, 1775, 1679,
+    1743, 1824, 1895, 1797, 1791, 1771, 1891, 2137, 2226, 2362, 2549, 2842, 3113, 2944, 2470, 1972,
+    1597, 1443, 1307, 1113, 1192, 1514, 1750, 1745, 1624, 1637, 1786, 1937, 1830, 1677, 1656, 1849,
+    1929, 1831, 1719, 1681, 1805, 1880, 1820, 1693, 1709, 1753, 1837, 1802, 1733, 1665, 1684, 1844,
+    1842, 1744, 1613, 1700, 1778, 1879, 1719, 1581, 1693, 1829, 1818, 1642, 1619, 1773, 1898, 1824,
+    1623, 1619, 1762, 1896, 1841, 1661, 1648, 1872, 1909, 1777, 1701, 1712, 1803, 1934, 1841, 1771,
+    1769, 1827, 1878, 1877, 1761, 1678, 1767, 1842, 1878, 1723, 1665, 1683, 1871, 1889, 1622, 1520,
+    1592, 1754, 1751, 1549, 1469, 1598, 1694, 1681, 1510, 1427, 1620, 1801, 1738, 1564, 1586, 1753,
+    1973, 1819, 1674, 1676, 1859, 1938, 1893, 1699, 1690, 1874, 1971, 1863, 1734, 1766, 1866, 1937,
+    1880, 1785, 1765, 1826, 1880, 1867, 1820, 1693, 1808, 1848, 1926, 1806, 1699, 1781, 1964, 1903,
+    1776, 1603, 1754, 1939, 1946, 1724, 1632, 1774, 1958, 1841, 1666, 1577, 1795, 1972, 1888, 1690,
+    1692, 1835, 1899, 1753, 1673, 1607, 1758, 1843, 1723, 1707, 1664, 1749, 1802, 1818, 1691, 1667,
+    1701, 1836, 1837, 1736, 1619, 1780, 1916, 1890, 1748, 1655, 1720, 1963, 1904, 1733, 1704, 1884,
+    2058, 1970, 1753, 1723, 1892, 1993, 1922, 1787, 1784, 1955, 2034, 1949, 1790, 1821, 1919, 2002,
+    1923, 1818, 1857, 1925, 2030, 2038, 1901, 1872, 1954, 2112, 2122, 1939, 1890, 1935, 2142, 2152,
+    2052, 1923, 1968, 2238, 2281, 2186, 2163, 2444, 2832, 3047, 3060, 3197, 3234, 2976, 2510, 1801,
+    1582, 1549, 1635, 1703, 1738, 1872, 2023, 2115, 2139, 2076, 2061, 2157, 2217, 2242, 2146, 2038,
+    2137, 2255, 2266, 2159, 2028, 2094, 2292, 2312, 2118, 2040, 2197, 2279, 2303, 2058, 2062, 2221,
+    2290, 2286, 2081, 2048, 2221, 2319, 2179, 2069, 2135, 2209, 2280, 2233, 2116, 2141, 2215, 2237,
+    2251, 2162, 2146, 2227, 2305, 2326, 2230, 2176, 2174, 2352, 2403, 2220, 2146, 2237, 2432, 2446,
+    2238, 2153, 2308, 2492, 2338, 2174, 2146, 2290, 2459, 2397, 2160, 2143, 2247, 2330, 2186, 2069,
+    2043, 2181, 2232, 2142, 2047, 2057, 2172, 2186, 2180, 2077, 2049, 2214, 2289, 2243, 2222, 2191,
+    2313, 2390, 2326, 2326, 2249, 2328, 2464, 2440, 2296, 2252, 2354, 2447, 2463, 2352, 2238, 2313,
+    2471, 2487, 2351, 2136, 2357, 2551, 2439, 2309, 2162, 2403, 2583, 2459, 2159, 2233, 2370, 2505,
+    2408, 2235, 2304, 2353, 2425, 2335, 2281, 2301, 2309, 2358, 2353, 2214, 2259, 2260, 2362, 2421,
+    2263, 2156, 2186, 2384, 2397, 2235, 2072, 2221, 2438, 2341, 2197, 2055, 2243, 2387, 2328, 2193,
+    2073, 2215, 2375, 2308, 2134, 2163, 2301, 2430, 2288, 2139, 2216, 2316, 2383, 2314, 2261, 2343,
+    2341, 2378, 2399, 2308, 2284, 2373, 2479, 2438, 2291, 2274, 2340, 2463, 2470, 2294, 2204, 2272,
+    2505, 2469, 2248, 2214, 2361, 2581, 2470, 2347, 2308, 2440, 2569, 2479, 2300, 2277, 2481, 2597,
+    2488, 2338, 2357, 2559, 2702, 2736, 2797, 3061, 3320, 3638, 3746, 3523, 3172, 2774, 2394, 2073,
+    1827, 1801, 1987, 2326, 2385, 2314, 2285, 2381, 2582, 2614, 2406, 2299, 2464, 2650, 2535, 2349,
+    2326, 2469, 2671, 2466, 2330, 2353, 2531, 2559, 2519, 2372, 2355, 2440, 2466, 2448, 2383, 2347,
+    2451, 2504, 2466, 2380, 2250, 2371, 2432, 2441, 2345, 2251, 2304, 2506, 2516, 2331, 2216, 2346,
+    2538, 2530, 2301, 2227, 2346, 2559, 2533, 2286, 2248, 2454, 2566, 2491, 2254, 2304, 2487, 2539,
+    2452, 2277, 2343, 2436, 2482, 2479, 2339, 2285, 2384, 2411, 2299, 2247, 2174, 2187, 2341, 2337,
+    2195, 2007, 2095, 2282, 2242, 2102, 2008, 2143, 2294, 2232, 2010, 2003, 2151, 2345, 2228, 2091,
+    2097, 2254, 2350, 2261, 2174, 2109, 2266, 2266, 2253, 2176, 2164, 2217, 2273, 2274, 2176, 2098,
+    2235, 2277, 2308, 2179, 2127, 2214, 2357, 2333, 2186, 2060, 2223, 2420, 2328, 2141, 2053, 2215,
+    2327, 2299, 2073, 2091, 2295, 2295, 2255, 2030, 2055, 2198, 2271, 2187, 2058, 2067, 2136, 2180,
+    2100, 2067, 1987, 2143, 2172, 2135, 2042, 1940, 2001, 2107, 2158, 1995, 1831, 1965, 2128, 2090,
+    1915, 1779, 1923, 2084, 2006, 1813, 1811, 1981, 2085, 2002, 1782, 1763, 1948, 2028, 1944, 1791,
+    1766, 1913, 1992, 1945, 1809, 1813, 1921, 1962, 1881, 1837, 1827, 1841, 1987, 2025, 1905, 1792,
+    1846, 1985, 2064, 1843, 1757, 1829, 2024, 2026, 1853, 1743, 1846, 2037, 2040, 1807, 1742, 1870,
+    2033, 1909, 1748, 1780, 1925, 2069, 1894, 1823, 1811, 1951, 2032, 1935, 1844, 1884, 1999, 2006,
+    1957, 1873, 1938, 2003, 2269, 2344, 2503, 2660, 2929, 3244, 3130, 2578, 2129, 1698, 1513, 1394,
+    1242, 1308, 1565, 1855, 1862, 1696, 1732, 1879, 2039, 1908, 1732, 1722, 1914, 1994, 1926, 1772,
+    1745, 1891, 1954, 1849, 1779, 1717, 1787, 1865, 1825, 1756, 1718, 1702, 1916, 1883, 1688, 1701,
+    1751, 1853, 1860, 1704, 1516, 1726, 1883, 1863, 1632, 1545, 1775, 1811, 1824, 1615, 1539, 1749,
+    1857, 1766, 1573, 1581, 1769, 1847, 1750, 1644, 1621, 1799, 1867, 1709, 1697, 1670, 1745, 1782,
+    1816, 1680, 1649, 1640, 1828, 1800, 1669, 1553, 1601, 1696, 1742, 1512, 1398, 1487, 1676, 1626,
+    1359, 1243, 1481, 1597, 1521, 1344, 1312, 1502, 1623, 1477, 1409, 1406, 1590, 1660, 1570, 1522,
+    1507, 1621, 1686, 1659, 1568, 1524, 1574, 1690, 1708, 1552, 1483, 1576, 1716, 1661, 1547, 1449,
+    1542, 1719, 1656, 1519, 1434, 1569, 1720, 1668, 1460, 1354, 1587, 1748, 1605, 1440, 1445, 1545,
+    1667, 1565, 1443, 1434, 1596, 1608, 1535, 1409, 1434, 1505, 1577, 1549, 1402, 1370, 1523, 1565,
+    1526, 1458, 1348, 1396, 1570, 1563, 1414, 1306, 1459, 1553, 1530, 1391, 1262, 1456, 1586, 1553,
+    1371, 1330, 1410, 1557, 1490, 1348, 1344, 1435, 1600, 1526, 1345, 1332, 1486, 1566, 1479, 1388,
+    1396, 1455, 1580, 1564, 1453, 1369, 1480, 1581, 1608, 1435, 1381, 1456, 1607, 1563, 1441, 1342,
+    1480, 1574, 1593, 1433, 1370, 1481, 1723, 1609, 1417, 1391, 1511, 1701, 1628, 1477, 1407, 1534,
+    1647, 1578, 1446, 1455, 1601, 1779, 1750, 1735, 1873, 2068, 2301, 2403, 2141, 1918, 1733, 1569,
+    1358, 1186, 1112, 1331, 1508, 1583, 1482, 1391, 1537, 1703, 1683, 1549, 1450, 1570, 1772, 1665,
+    1501, 1473, 1661, 1779, 1659, 1517, 1496, 1684, 1759, 1637, 1541, 1477, 1620, 1686, 1701, 1610,
+    1520, 1608, 1745, 1667, 1609, 1490, 1611, 1692, 1752, 1582, 1488, 1599, 1691, 1739, 1582, 1544,
+    1599, 1810, 1775, 1593, 1507, 1669, 1784, 1756, 1538, 1532, 1697, 1789, 1719, 1590, 1616, 1756,
+    1833, 1798, 1627, 1653, 1682, 1812, 1777, 1700, 1597, 1742, 1771, 1731, 1603, 1580, 1608, 1751,
+    1721, 1588, 1457, 1553, 1726, 1688, 1519, 1450, 1647, 1723, 1657, 1564, 1562, 1774, 1849, 1708,
+    1626, 1691, 1778, 1853, 1797, 1729, 1704, 1800, 1873, 1890, 1813, 1717, 1763, 1929, 1950, 1786,
+    1685, 1748, 1927, 1908, 1747, 1645, 1858, 2020, 1915, 1751, 1669, 1851, 1963, 1888, 1669, 1693,
+    1867, 1880, 1785, 1714, 1777, 1898, 1900, 1822, 1766, 1752, 1762, 1890, 1806, 1740, 1695, 1748,
+    1892, 1857, 1782, 1699, 1712, 1877, 1861, 1750, 1625, 1737, 1954, 1895, 1751, 1578, 1773, 1954,
+    1868, 1674, 1603, 1790, 1945, 1903, 1689, 1672, 1841, 1951, 1855, 1735, 1792, 1889, 1942, 1916,
+    1822, 1907, 1925, 1984, 1979, 1957, 1794, 1935, 1985, 1974, 1906, 1841, 1863, 2011, 2107, 1930,
+    1793, 1935, 2085, 2076, 1851, 1847, 1979, 2173, 2091, 1871, 1895, 2096, 2164, 2107, 1977, 1973,
+    2133, 2274, 2153, 1982, 2033, 2231, 2331, 2410, 2430, 2643, 2951, 3278, 3372, 3207, 2777, 2473,
+    2042, 1776, 1546, 1489, 1679, 1939, 2125, 1992, 1911, 2079, 2294, 2310, 2124, 2060, 2226, 2362,
+    2281, 2088, 2054, 2238, 2379, 2216, 2085, 2127, 2245, 2342, 2208, 2071, 2150, 2243, 2305, 2183,
+    2098, 2115, 2202, 2226, 2277, 2183, 2084, 2161, 2293, 2302, 2162, 2095, 2144, 2321, 2306, 2148,
+    2071, 2183, 2362, 2308, 2148, 2101, 2247, 2422, 2369, 2107, 2104, 2307, 2399, 2306, 2161, 2225,
+    2382, 2392, 2340, 2220, 2150, 2307, 2354, 2281, 2283, 2206, 2262, 2366, 2306, 2187, 2098, 2176,
+    2263, 2276, 2103, 1986, 2024, 2202, 2212, 2016, 1943, 2065, 2267, 2250, 2021, 2020, 2140, 2307,
+    2250, 2051, 2095, 2261, 2382, 2218, 2175, 2220, 2300, 2307, 2352, 2270, 2258, 2315, 2406, 2380,
+    2280, 2181, 2289, 2370, 2441, 2301, 2158, 2267, 2385, 2380, 2232, 2090, 2256, 2444, 2366, 2172,
+    2088, 2246, 2472, 2324, 2168, 2112, 2291, 2418, 2314, 2153, 2187, 2260, 2358, 2292, 2105, 2172,
+    2277, 2244, 2226, 2183, 2144, 2168, 2267, 2244, 2166, 2028, 2103, 2221, 2227, 2093, 1916, 2102,
+    2255, 2212, 2026, 1935, 2091, 2284, 2256, 2022, 1907, 2115, 2241, 2184, 1954, 2014, 2145, 2244,
+    2119, 2015, 2087, 2164, 2239, 2182, 2095, 2146, 2157, 2260, 2149, 2178, 2120, 2190, 2228, 2238,
+    2157, 2020, 2132, 2233, 2308, 2091, 1988, 2129, 2302, 2270, 2021, 1962, 2131, 2350, 2244, 2071,
+    2022, 2195, 2353, 2226, 2115, 2099, 2245, 2378, 2267, 2081, 2154, 2359, 2432, 2570, 2554, 2782,
+    3137, 3394, 3497, 3264, 2891, 2553, 2104, 1861, 1576, 1488, 1765, 2014, 2167, 2004, 1994, 2116,
+    2334, 2266, 2105, 2020, 2202, 2339, 2262, 2078, 2030, 2221, 2352, 2154, 2069, 2033, 2185, 2320,
+    2157, 2027, 2059, 2160, 2197, 2146, 2069, 1998, 2142, 2188, 2172, 2062, 1976, 2060, 2139, 2201,
+    2029, 1928, 2020, 2252, 2218, 1998, 1896, 2065, 2200, 2125, 1955, 1902, 2052, 2215, 2188, 1929,
+    1906, 2089, 2230, 2164, 1963, 1988, 2119, 2157, 2084, 1994, 1995, 2052, 2081, 2067, 1963, 1972,
+    1990, 2034, 2005, 1934, 1817, 1833, 1948, 1945, 1830, 1673, 1760, 1891, 1890, 1665, 1610, 1744,
+    1860, 1898, 1715, 1667, 1891, 1906, 1869, 1746, 1726, 1907, 1964, 1912, 1782, 1796, 1869, 1945,
+    1912, 1850, 1817, 1838, 1962, 1988, 1793, 1810, 1824, 1981, 2019, 1864, 1765, 1841, 2001, 2006,
+    1780, 1659, 1897, 1950, 1945, 1720, 1715, 1875, 1981, 1872, 1666, 1691, 1900, 1849, 1812, 1683,
+    1656, 1773, 1837, 1701, 1730, 1708, 1713, 1770, 1790, 1715, 1564, 1625, 1749, 1712, 1654, 1518,
+    1619, 1730, 1750, 1546, 1427, 1558, 1757, 1679, 1470, 1413, 1612, 1716, 1627, 1441, 1436, 1592,
+    1698, 1577, 1401, 1440, 1524, 1632, 1567, 1483, 1443, 1565, 1634, 1517, 1498, 1447, 1536, 1647,
+    1642, 1573, 1462, 1532, 1699, 1688, 1510, 1485, 1530, 1680, 1657, 1506, 1396, 1467, 1651, 1643,
+    1422, 1402, 1562, 1748, 1619, 1397, 1435, 1599, 1719, 1557, 1496, 1419, 1625, 1699, 1545, 1489,
+    1498, 1611, 1688, 1547, 1587, 1630, 1792, 1872, 2036, 2186, 2371, 2668, 2877, 2793, 2393, 1799,
+    1403, 1283, 1142, 1031, 1038, 1302, 1661, 1710, 1484, 1415, 1651, 1815, 1738, 1494, 1502, 1697,
+    1788, 1660, 1470, 1511, 1749, 1688, 1563, 1520, 1536, 1649, 1638, 1527, 1434, 1514, 1555, 1580,
+    1549, 1498, 1465, 1514, 1545, 1601, 1462, 1294, 1356, 1538, 1542, 1398, 1214, 1417, 1614, 1533,
+    1253, 1211, 1421, 1558, 1410, 1185, 1252, 1456, 1539, 1373, 1245, 1275, 1462, 1530, 1402, 1277,
+    1374, 1405, 1466, 1426, 1413, 1313, 1393, 1471, 1383, 1391, 1290, 1282, 1435, 1502, 1397, 1225,
+    1237, 1431, 1503, 1224, 1099, 1195, 1409, 1398, 1173, 1105, 1270, 1448, 1398, 1215, 1184, 1380,
+    1558, 1400, 1274, 1329, 1469, 1567, 1454, 1341, 1311, 1506, 1635, 1497, 1460, 1460, 1547, 1623,
+    1522, 1452, 1556, 1658, 1846, 1995, 2125, 2269, 2580, 2864, 2704, 2260, 1712, 1348, 1212, 1083,
+    845, 937, 1247, 1518, 1523, 1369, 1371, 1605, 1718, 1631, 1438, 1449, 1621, 1710, 1573, 1466,
+    1467, 1582, 1654, 1582, 1519, 1542, 1613, 1634, 1602, 1498, 1487, 1481, 1654, 1660, 1544, 1498,
+    1507, 1664, 1661, 1534, 1383, 1563, 1759, 1726, 1530, 1408, 1580, 1708, 1650, 1401, 1416, 1651,
+    1769, 1627, 1539, 1470, 1626, 1783, 1673, 1521, 1556, 1618, 1761, 1654, 1649, 1592, 1655, 1762,
+    1735, 1626, 1509, 1623, 1774, 1773, 1581, 1520, 1577, 1742, 1730, 1517, 1442, 1471, 1650, 1610,
+    1422, 1307, 1509, 1624, 1616, 1416, 1357, 1562, 1679, 1607, 1449, 1518, 1620, 1721, 1688, 1557,
+    1506, 1684, 1735, 1760, 1555, 1528, 1710, 1760, 1757, 1625, 1611, 1738, 1833, 1784, 1661, 1617,
+    1669, 1841, 1764, 1712, 1636, 1705, 1887, 1776, 1675, 1590, 1729, 1860, 1781, 1691, 1662, 1793,
+    1897, 1839, 1712, 1631, 1755, 1919, 1816, 1693, 1688, 1780, 1870, 1844, 1704, 1650, 1784, 1934,
+    1861, 1742, 1679, 1809, 1947, 1898, 1742, 1696, 1848, 1927, 1846, 1751, 1724, 1842, 1920, 1899,
+    1784, 1753, 1860, 1947, 1942, 1790, 1816, 1825, 1933, 1984, 1906, 1793, 1896, 2026, 2060, 1910,
+    1834, 1926, 2096, 2091, 1916, 1848, 1983, 2132, 2136, 1852, 1893, 1973, 2125, 2091, 1887, 1858,
+    1994, 2118, 2009, 1891, 1881, 1997, 2076, 2004, 1880, 1927, 1975, 2046, 2029, 1947, 1898, 1957,
+    2061, 2069, 1970, 1884, 1916, 2028, 2040, 1933, 1852, 1885, 2129, 2093, 1857, 1795, 1966, 2080,
+    2002, 1824, 1774, 1947, 2051, 1999, 1808, 1822, 2007, 2062, 2028, 1790, 1860, 1987, 2102, 2016,
+    1896, 1899, 1975, 2073, 2020, 1987, 1911, 2000, 2100, 2133, 2042, 1988, 2029, 2133, 2197, 2067,
+    2003, 2050, 2195, 2204, 2035, 1979, 2066, 2252, 2229, 2009, 1938, 2116, 2309, 2156, 2010, 2015,
+    2226, 2333, 2230, 2083, 2056, 2259, 2317, 2196, 2187, 2154, 2275, 2334, 2235, 2214, 2307, 2397,
+    2604, 2752, 2853, 3015, 3332, 3643, 3485, 2980, 2524, 2123, 1910, 1819, 1705, 1673, 1974, 2310,
+    2270, 2088, 2162, 2301, 2479, 2417, 2222, 2191, 2440, 2476, 2363, 2221, 2218, 2401, 2363, 2390,
+    2221, 2280, 2308, 2368, 2369, 2271, 2267, 2249, 2388, 2405, 2280, 2229, 2279, 2390, 2421, 2213,
+    2125, 2302, 2437, 2445, 2218, 2122, 2327, 2499, 2385, 2190, 2223, 2360, 2492, 2373, 2240, 2215,
+    2392, 2466, 2380, 2268, 2294, 2384, 2481, 2437, 2323, 2304, 2406, 2463, 2435, 2287, 2251, 2347,
+    2458, 2459, 2313, 2201, 2257, 2397, 2375, 2237, 2053, 2210, 2346, 2262, 2045, 2010, 2165, 2236,
+    2229, 2086, 2031, 2167, 2279, 2259, 2136, 2097, 2235, 2401, 2426, 2229, 2164, 2310, 2443, 2424,
+    2244, 2207, 2363, 2559, 2462, 2181, 2217, 2370, 2533, 2366, 2190, 2207, 2383, 2456, 2358, 2279,
+    2223, 2330, 2413, 2351, 2233, 2257, 2264, 2384, 2371, 2303, 2233, 2241, 2355, 2388, 2244, 2129,
+    2183, 2368, 2370, 2196, 2060, 2169, 2373, 2314, 2078, 2087, 2159, 2326, 2264, 2012, 2006, 2167,
+    2272, 2136, 1963, 2015, 2127, 2233, 2100, 2062, 2054, 2125, 2257, 2154, 1998, 1988, 2140, 2187,
+    2175, 2056, 2018, 2102, 2179, 2228, 2059, 1968, 2103, 2249, 2292, 2099, 1999, 2091, 2382, 2262,
+    2110, 1972, 2114, 2309, 2196, 2006, 2025, 2145, 2224, 2208, 2028, 1986, 2207, 2192, 2139, 2066,
+    2089, 2217, 2206, 2190, 2071, 2076, 2124, 2240, 2285, 2211, 2118, 2167, 2236, 2309, 2264, 2166,
+    2378, 2655, 2874, 2955, 3114, 3380, 3481, 3051, 2385, 1848, 1686, 1732, 1657, 1633, 1756, 2066,
+    2173, 2117, 2022, 2033, 2189, 2275, 2199, 2089, 2103, 2142, 2206, 2205, 2130, 2060, 2109, 2169,
+    2233, 2104, 1999, 2067, 2149, 2163, 2041, 1941, 2048, 2200, 2162, 1967, 1902, 2007, 2226, 2142,
+    1890, 1862, 2092, 2181, 2047, 1876, 1896, 2065, 2093, 2028, 1895, 1974, 2068, 2073, 2010, 1944,
+    1896, 1994, 2104, 2032, 1946, 1922, 2006, 2078, 2147, 1988, 1933, 2005, 2093, 2109, 1916, 1814,
+    1915, 2115, 2042, 1847, 1731, 1887, 2039, 1970, 1678, 1632, 1814, 1930, 1760, 1672, 1609, 1726,
+    1845, 1797, 1663, 1647, 1750, 1874, 1802, 1719, 1662, 1759, 1898, 1825, 1779, 1704, 1787, 1949,
+    1955, 1812, 1659, 1840, 1959, 1931, 1775, 1706, 1865, 1960, 1927, 1733, 1649, 1810, 1996, 1870,
+    1736, 1703, 1816, 1998, 1870, 1684, 1707, 1807, 1830, 1786, 1745, 1731, 1796, 1816, 1832, 1714,
+    1650, 1704, 1828, 1777, 1617, 1594, 1723, 1798, 1793, 1639, 1521, 1664, 1790, 1768, 1562, 1530,
+    1682, 1835, 1701, 1501, 1515, 1666, 1729, 1679, 1579, 1544, 1600, 1724, 1603, 1504, 1575, 1617,
+    1695, 1635, 1506, 1542, 1607, 1689, 1690, 1566, 1512, 1529, 1661, 1744, 1527, 1455, 1548, 1743,
+    1722, 1540, 1503, 1574, 1780, 1711, 1548, 1502, 1616, 1752, 1716, 1508, 1480, 1621, 1707, 1661,
+    1476, 1510, 1658, 1714, 1638, 1505, 1517, 1692, 1678, 1698, 1562, 1532, 1587, 1678, 1697, 1598,
+    1551, 1641, 1705, 1712, 1655, 1609, 1712, 2010, 2111, 2112, 2148, 2373, 2396, 2138, 1782, 1380,
+    1303, 1395, 1351, 1267, 1317, 1571, 1691, 1672, 1511, 1555, 1665, 1747, 1676, 1581, 1555, 1601,
+    1724, 1664, 1585, 1515, 1606, 1759, 1690, 1628, 1512, 1572, 1713, 1747, 1543, 1463, 1632, 1738,
+    1707, 1492, 1486, 1556, 1734, 1711, 1465, 1452, 1674, 1771, 1683, 1525, 1511, 1677, 1693, 1673,
+    1523, 1505, 1638, 1671, 1668, 1530, 1579, 1623, 1752, 1709, 1639, 1543, 1638, 1688, 1723, 1610,
+    1515, 1627, 1739, 1736, 1595, 1504, 1628, 1772, 1754, 1531, 1439, 1550, 1726, 1676, 1455, 1386,
+    1494, 1667, 1578, 1405, 1387, 1594, 1717, 1594, 1390, 1447, 1668, 1678, 1637, 1557, 1587, 1741,
+    1800, 1711, 1672, 1612, 1743, 1719, 1745, 1637, 1646, 1666, 1776, 1804, 1659, 1620, 1659, 1783,
+    1763, 1600, 1528, 1655, 1878, 1835, 1597, 1538, 1695, 1819, 1801, 1565, 1501, 1714, 1869, 1756,
+    1569, 1545, 1714, 1812, 1711, 1576, 1574, 1691, 1729, 1716, 1579, 1617, 1626, 1635, 1671, 1585,
+    1570, 1575, 1718, 1748, 1577, 1529, 1572, 1697, 1761, 1596, 1484, 1541, 1745, 1711, 1563, 1520,
+    1646, 1788, 1793, 1569, 1514, 1687, 1848, 1729, 1604, 1611, 1850, 1874, 1812, 1652, 1697, 1771,
+    1918, 1821, 1753, 1738, 1786, 1826, 1834, 1772, 1695, 1710, 1905, 1831, 1789, 1598, 1756, 1996,
+    1999, 1804, 1726, 1832, 2003, 2049, 1811, 1745, 1902, 2097, 2089, 1844, 1803, 2022, 2225, 2178,
+    2127, 2221, 2682, 2976, 3071, 3188, 2987, 2783, 2426, 1862, 1502, 1353, 1440, 1648, 1763, 1832,
+    1869, 1936, 2077, 2094, 1996, 1941, 2010, 2180, 2194, 2037, 1929, 2033, 2252, 2226, 2043, 1890,
+    2112, 2214, 2206, 2001, 1982, 2123, 2294, 2088, 1995, 2008, 2167, 2223, 2178, 1984, 1975, 2159,
+    2156, 2156, 2102, 2073, 2125, 2187, 2193, 2153, 2024, 2044, 2254, 2272, 2063, 1981, 2109, 2324,
+    2265, 2087, 2054, 2115, 2361, 2274, 2145, 2065, 2269, 2433, 2299, 2130, 2081, 2278, 2321, 2277,
+    2150, 2139, 2254, 2333, 2215, 2045, 2104, 2166, 2177, 2155, 2072, 2026, 2030, 2111, 2145, 2067,
+    1987, 2032, 2145, 2216, 2108, 2015, 2096, 2301, 2335, 2190, 2030, 2218, 2417, 2402, 2231, 2176,
+    2306, 2436, 2427, 2263, 2194, 2330, 2535, 2399, 2212, 2176, 2392, 2531, 2349, 2233, 2272, 2377,
+    2422, 2340, 2270, 2306, 2309, 2355, 2430, 2293, 2160, 2295, 2403, 2420, 2284, 2227, 2248, 2465,
+    2453, 2251, 2190, 2271, 2379, 2449, 2226, 2154, 2362, 2474, 2369, 2133, 2127, 2281, 2402, 2314,
+    2154, 2202, 2315, 2370, 2221, 2196, 2224, 2296, 2360, 2266, 2238, 2202, 2253, 2367, 2350, 2249,
+    2234, 2277, 2381, 2401, 2310, 2150, 2225, 2471, 2537, 2323, 2253, 2388, 2583, 2479, 2317, 2221,
+    2402, 2566, 2480, 2246, 2168, 2427, 2522, 2457, 2300, 2303, 2491, 2481, 2448, 2395, 2437, 2509,
+    2517, 2549, 2397, 2391, 2441, 2534, 2531, 2477, 2411, 2480, 2573, 2675, 2539, 2564, 2764, 3051,
+    3254, 3336, 3485, 3764, 3799, 3424, 2836, 2237, 2086, 2133, 2032, 2007, 2126, 2438, 2578, 2525,
+    2414, 2420, 2608, 2661, 2581, 2506, 2496, 2511, 2628, 2549, 2520, 2554, 2531, 2556, 2696, 2527,
+    2431, 2510, 2607, 2594, 2510, 2390, 2507, 2686, 2620, 2471, 2357, 2532, 2723, 2595, 2410, 2428,
+    2501, 2642, 2635, 2428, 2442, 2560, 2624, 2508, 2437, 2432, 2542, 2598, 2571, 2463, 2473, 2504,
+    2598, 2585, 2517, 2466, 2527, 2637, 2662, 2560, 2488, 2544, 2634, 2662, 2486, 2420, 2504, 2670,
+    2604, 2384, 2322, 2428, 2590, 2524, 2262, 2235, 2370, 2501, 2377, 2136, 2199, 2373, 2402, 2275,
+    2164, 2263, 2378, 2504, 2391, 2347, 2389, 2473, 2511, 2475, 2417, 2373, 2471, 2538, 2514, 2456,
+    2375, 2431, 2591, 2605, 2494, 2320, 2441, 2591, 2592, 2408, 2267, 2401, 2599, 2552, 2348, 2238,
+    2411, 2636, 2471, 2309, 2258, 2414, 2482, 2433, 2223, 2280, 2435, 2469, 2359, 2240, 2309, 2327,
+    2411, 2308, 2271, 2240, 2260, 2306, 2376, 2188, 2164, 2173, 2366, 2346, 2224, 2015, 2171, 2341,
+    2293, 2149, 2010, 2232, 2325, 2292, 2140, 1981, 2212, 2343, 2230, 2065, 2061, 2235, 2330, 2167,
+    2078, 2069, 2190, 2224, 2188, 2140, 2181, 2232, 2250, 2262, 2209, 2070, 2212, 2277, 2260, 2159,
+    2067, 2145, 2278, 2300, 2129, 2022, 2142, 2330, 2338, 2100, 1996, 2232, 2360, 2258, 2083, 2088,
+    2221, 2356, 2245, 2121, 2107, 2275, 2415, 2308, 2099, 2177, 2370, 2484, 2512, 2548, 2744, 3087,
+    3329, 3492, 3300, 2867, 2492, 2080, 1841, 1581, 1544, 1759, 2024, 2169, 2028, 1968, 2099, 2279,
+    2315, 2130, 2021, 2217, 2363, 2231, 2051, 2009, 2209, 2329, 2164, 2029, 2064, 2207, 2269, 2149,
+    1994, 2009, 2167, 2183, 2177, 2072, 2008, 2077, 2112, 2090, 2031, 1994, 2054, 2156, 2171, 2034,
+    1931, 2003, 2154, 2152, 2010, 1868, 2070, 2223, 2220, 1986, 1866, 2100, 2188, 2157, 1915, 1889,
+    2085, 2156, 2119, 1946, 1965, 2099, 2167, 2079, 1960, 1932, 2015, 2047, 2022, 1928, 1889, 1986,
+    2021, 1982, 1900, 1772, 1823, 1939, 1902, 1743, 1656, 1782, 1890, 1835, 1733, 1734, 1825, 1892,
+    1864, 1759, 1795, 1902, 1958, 1979, 1866, 1783, 1928, 2024, 2057, 1975, 1801, 1865, 2013, 2071,
+    1886, 1729, 1879, 2060, 2034, 1842, 1708, 1937, 2075, 1931, 1757, 1775, 1916, 1998, 1898, 1672,
+    1760, 1883, 1969, 1810, 1715, 1762, 1794, 1863, 1796, 1678, 1722, 1763, 1812, 1812, 1691, 1649,
+    1670, 1826, 1794, 1652, 1570, 1709, 1812, 1810, 1656, 1514, 1691, 1851, 1843, 1617, 1485, 1662,
+    1792, 1694, 1590, 1586, 1725, 1869, 1764, 1570, 1603, 1768, 1817, 1741, 1612, 1731, 1741, 1767,
+    1786, 1752, 1690, 1725, 1850, 1822, 1716, 1594, 1739, 1769, 1881, 1680, 1566, 1674, 1860, 1843,
+    1608, 1572, 1760, 1948, 1850, 1633, 1618, 1791, 1939, 1842, 1684, 1708, 1885, 2008, 1905, 1711,
+    1753, 1975, 2093, 2114, 2171, 2336, 2694, 2996, 3151, 2880, 2524, 2190, 1776, 1480, 1230, 1162,
+    1403, 1663, 1757, 1715, 1607, 1786, 1969, 2001, 1832, 1697, 1886, 2027, 1968, 1768, 1745, 1878,
+    2041, 1900, 1745, 1790, 1913, 1953, 1844, 1717, 1778, 1904, 1894, 1868, 1802, 1746, 1818, 1917,
+    1938, 1814, 1756, 1772, 1946, 1926, 1829, 1756, 1785, 1971, 1988, 1771, 1621, 1825, 1974, 2015,
+    1782, 1736, 1907, 2017, 1997, 1784, 1784, 1921, 2023, 1952, 1781, 1838, 1965, 2075, 1957, 1845,
+    1854, 1914, 1961, 1930, 1829, 1822, 1890, 1910, 1865, 1831, 1756, 1705, 1826, 1885, 1764, 1608,
+    1665, 1866, 1950, 1750, 1615, 1710, 2031, 1951, 1768, 1681, 1907, 2133, 2027, 1744, 1795, 1979,
+    2113, 2026, 1854, 1872, 2019, 2116, 1998, 1892, 1895, 1982, 2065, 1987, 1927, 1910, 1975, 2009,
+    1952, 1947, 1906, 1862, 1976, 2098, 1956, 1813, 1914, 2059, 2041, 1848, 1808, 1871, 2051, 2065,
+    1856, 1787, 1887, 2107, 2005, 1783, 1786, 1917, 2019, 1911, 1800, 1797, 1952, 2025, 1974, 1873,
+    1856, 1962, 2050, 1937, 1869, 1836, 1922, 1989, 2036, 1902, 1867, 1913, 2036, 2114, 1896, 1818,
+    1932, 2086, 2220, 1980, 1842, 2047, 2257, 2141, 1956, 1939, 2071, 2263, 2165, 1985, 1997, 2154,
+    2208, 2139, 1956, 2023, 2145, 2221, 2217, 2067, 2104, 2183, 2200, 2237, 2102, 2141, 2154, 2252,
+    2256, 2194, 2155, 2211, 2279, 2378, 2316, 2247, 2452, 2729, 2981, 3095, 3246, 3419, 3540, 3227,
+    2574, 2010, 1816, 1935, 1901, 1779, 1961, 2269, 2482, 2358, 2188, 2270, 2457, 2570, 2410, 2342,
+    2381, 2467, 2567, 2393, 2382, 2404, 2385, 2473, 2438, 2422, 2374, 2363, 2424, 2442, 2407, 2296,
+    2382, 2481, 2522, 2367, 2222, 2310, 2510, 2538, 2241, 2142, 2333, 2495, 2457, 2222, 2202, 2402,
+    2524, 2246, 2166, 2209, 2371, 2451, 2341, 2220, 2344, 2440, 2397, 2295, 2332, 2297, 2429, 2446,
+    2418, 2456, 2348, 2313, 2442, 2542, 2325, 2288, 2353, 2455, 2598, 2348, 2180, 2343, 2609, 2545,
+    2263, 2148, 2345, 2535, 2375, 2163, 2170, 2412, 2507, 2382, 2236, 2200, 2386, 2461, 2402, 2279,
+    2354, 2504, 2539, 2452, 2414, 2459, 2518, 2560, 2552, 2473, 2426, 2510, 2634, 2641, 2550, 2481,
+    2551, 2634, 2740, 2648, 2598, 2811, 3141, 3347, 3378, 3573, 3916, 3844, 3508, 2902, 2333, 2121,
+    2182, 2135, 2104, 2228, 2548, 2664, 2595, 2521, 2488, 2772, 2791, 2720, 2610, 2655, 2706, 2770,
+    2711, 2582, 2588, 2629, 2714, 2701, 2661, 2585, 2604, 2731, 2748, 2601, 2534, 2638, 2805, 2754,
+    2592, 2530, 2681, 2817, 2766, 2555, 2488, 2676, 2802, 2681, 2526, 2524, 2718, 2806, 2681, 2544,
+    2619, 2709, 2832, 2656, 2629, 2594, 2702, 2729, 2745, 2629, 2604, 2682, 2862, 2856, 2704, 2568,
+    2667, 2798, 2809, 2594, 2547, 2694, 2851, 2825, 2616, 2519, 2627, 2824, 2710, 2490, 2410, 2543,
+    2729, 2556, 2400, 2359, 2554, 2634, 2566, 2435, 2436, 2525, 2663, 2594, 2528, 2490, 2575, 2696,
+    2630, 2587, 2491, 2600, 2714, 2661, 2596, 2525, 2651, 2764, 2720, 2586, 2492, 2677, 2745, 2710,
+    2559, 2503, 2623, 2745, 2654, 2584, 2496, 2601, 2738, 2671, 2576, 2507, 2598, 2689, 2674, 2543,
+    2532, 2602, 2742, 2691, 2591, 2508, 2606, 2690, 2649, 2531, 2510, 2563, 2712, 2647, 2524, 2466,
+    2565, 2707, 2633, 2524, 2452, 2538, 2636, 2629, 2541, 2451, 2564, 2648, 2604, 2524, 2468, 2526,
+    2585, 2626, 2503, 2420, 2513, 2658, 2640, 2471, 2443, 2491, 2674, 2624, 2495, 2411, 2561, 2712,
+    2616, 2497, 2369, 2513, 2701, 2638, 2437, 2422, 2536, 2672, 2591, 2437, 2400, 2521, 2664, 2561,
+    2364, 2450, 2495, 2597, 2570, 2419, 2401, 2500, 2548, 2476, 2417, 2378, 2461, 2594, 2516, 2374,
+    2339, 2394, 2544, 2576, 2328, 2285, 2368, 2477, 2486, 2339, 2204, 2418, 2530, 2421, 2258, 2219,
+    2359, 2462, 2407, 2215, 2243, 2316, 2446, 2359, 2258, 2218, 2332, 2361, 2322, 2235, 2249, 2270,
+    2406, 2369, 2212, 2136, 2271, 2391, 2399, 2225, 2186, 2224, 2403, 2400, 2294, 2200, 2266, 2404,
+    2350, 2247, 2165, 2267, 2431, 2334, 2158, 2143, 2286, 2387, 2338, 2173, 2157, 2279, 2333, 2321,
+    2218, 2202, 2246, 2336, 2308, 2235, 2142, 2264, 2320, 2340, 2254, 2158, 2275, 2359, 2382, 2256,
+    2227, 2402, 2624, 2666, 2711, 2791, 2967, 3013, 2756, 2330, 1985, 1973, 1990, 1951, 1895, 1936,
+    2139, 2316, 2217, 2078, 2090, 2230, 2341, 2247, 2097, 2094, 2201, 2272, 2249, 2109, 2126, 2208,
+    2261, 2274, 2125, 2043, 2159, 2238, 2262, 2150, 2013, 2155, 2236, 2209, 2042, 1962, 2083, 2254,
+    2159, 2003, 1941, 2125, 2235, 2175, 1984, 1987, 2128, 2238, 2097, 1983, 1986, 2099, 2180, 2116,
+    1980, 1981, 2084, 2122, 2079, 1964, 1982, 2067, 2171, 2148, 2040, 1982, 2034, 2189, 2142, 1982,
+    1898, 1995, 2124, 2114, 1964, 1797, 2008, 2143, 2047, 1840, 1758, 1904, 2077, 1934, 1791, 1780,
+    2043, 1999, 1921, 1843, 1849, 2009, 2072, 2007, 1889, 1923, 2021, 2062, 2032, 1946, 1920, 1944,
+    2065, 2064, 1916, 1845, 1923, 2069, 2098, 1915, 1837, 1915, 2014, 2115, 1836, 1774, 1916, 2053,
+    2026, 1749, 1741, 1958, 2055, 1983, 1760, 1791, 1902, 1985, 1796, 1732, 1715, 1856, 1893, 1808,
+    1737, 1757, 1778, 1876, 1837, 1720, 1665, 1681, 1779, 1821, 1685, 1619, 1679, 1848, 1858, 1693,
+    1630, 1642, 1867, 1800, 1727, 1589, 1764, 1895, 1818, 1673, 1583, 1775, 1934, 1793, 1666, 1639,
+    1865, 1932, 1832, 1701, 1716, 1867, 1889, 1829, 1735, 1733, 1796, 1845, 1812, 1764, 1676, 1799,
+    1842, 1864, 1754, 1685, 1743, 1986, 1955, 1801, 1694, 1794, 2010, 1929, 1754, 1757, 1872, 2029,
+    1989, 1804, 1781, 1941, 2090, 2063, 2080, 2189, 2559, 2920, 3006, 3058, 2937, 2693, 2364, 1770,
+    1346, 1239, 1342, 1528, 1746, 1721, 1680, 1790, 1954, 2004, 1897, 1811, 1899, 2037, 2081, 1853,
+    1798, 1913, 2056, 2085, 1796, 1752, 1968, 2085, 1995, 1795, 1707, 1935, 2042, 1951, 1806, 1808,
+    1937, 2048, 1977, 1868, 1847, 1948, 1985, 2012, 1914, 1846, 1934, 1998, 2002, 1904, 1812, 1888,
+    1993, 2065, 1913, 1836, 1919, 2075, 2054, 1921, 1768, 1892, 2064, 2089, 1935, 1851, 2022, 2182,
+    2122, 1893, 1876, 2057, 2106, 2024, 1877, 1878, 2032, 2078, 2008, 1871, 1874, 1875, 1917, 1915,
+    1824, 1794, 1781, 1878, 1845, 1763, 1756, 1821, 1940, 1918, 1821, 1799, 1849, 1953, 2028, 1942,
+    1898, 1920, 2080, 2129, 2027, 1940, 2053, 2140, 2166, 1986, 1892, 2047, 2241, 2226, 2007, 1947,
+    2061, 2198, 2162, 1903, 1924, 2083, 2209, 2135, 1957, 1924, 2120, 2167, 2105, 1980, 2004, 2084,
+    2167, 2063, 2043, 1965, 2046, 2083, 2101, 2064, 1917, 1942, 2080, 2087, 2029, 1928, 1999, 2097,
+    2117, 1953, 1839, 1998, 2101, 2095, 1878, 1873, 2019, 2185, 2055, 1861, 1874, 2049, 2154, 2084,
+    1824, 1894, 2031, 2138, 2038, 2007, 2004, 2089, 2128, 2070, 2051, 1999, 2091, 2125, 2201, 2181,
+    2030, 2096, 2259, 2304, 2133, 2019, 2158, 2261, 2310, 2100, 2000, 2105, 2341, 2286, 2114, 2057,
+    2218, 2343, 2260, 2057, 2151, 2293, 2429, 2285, 2165, 2165, 2353, 2360, 2312, 2253, 2248, 2416,
+    2498, 2352, 2370, 2367, 2515, 2708, 2780, 2941, 3130, 3423, 3686, 3578, 3076, 2595, 2194, 2038,
+    1934, 1725, 1789, 2142, 2427, 2419, 2231, 2234, 2383, 2572, 2556, 2344, 2308, 2511, 2588, 2508,
+    2332, 2354, 2509, 2541, 2477, 2450, 2413, 2493, 2520, 2465, 2383, 2458, 2407, 2574, 2601, 2401,
+    2338, 2432, 2556, 2589, 2360, 2311, 2437, 2667, 2576, 2341, 2264, 2509, 2664, 2558, 2344, 2343,
+    2542, 2592, 2525, 2347, 2411, 2589, 2668, 2607, 2423, 2452, 2583, 2645, 2636, 2550, 2531, 2567,
+    2679, 2635, 2516, 2464, 2497, 2659, 2642, 2504, 2411, 2464, 2616, 2649, 2401, 2332, 2384, 2589,
+    2536, 2295, 2199, 2360, 2535, 2434, 2354, 2277, 2387, 2488, 2567, 2407, 2344, 2415, 2661, 2675,
+    2494, 2400, 2517, 2713, 2686, 2493, 2465, 2620, 2764, 2643, 2480, 2490, 2649, 2766, 2666, 2524,
+    2509, 2670, 2734, 2635, 2513, 2506, 2625, 2680, 2634, 2552, 2542, 2614, 2601, 2667, 2527, 2476,
+    2550, 2643, 2699, 2547, 2447, 2544, 2678, 2721, 2477, 2390, 2492, 2688, 2666, 2433, 2330, 2577,
+    2693, 2563, 2340, 2396, 2463, 2611, 2536, 2380, 2386, 2525, 2654, 2472, 2379, 2393, 2488, 2598,
+    2477, 2432, 2328, 2454, 2570, 2524, 2447, 2384, 2426, 2543, 2631, 2444, 2358, 2467, 2660, 2684,
+    2491, 2349, 2508, 2692, 2696, 2456, 2426, 2530, 2677, 2612, 2428, 2396, 2586, 2690, 2585, 2388,
+    2420, 2615, 2601, 2540, 2483, 2513, 2607, 2639, 2645, 2512, 2491, 2600, 2662, 2679, 2573, 2559,
+    2623, 2622, 2738, 2686, 2659, 2882, 3145, 3393, 3438, 3575, 3883, 3827, 3514, 2832, 2313, 2180,
+    2181, 2055, 2088, 2163, 2486, 2603, 2586, 2463, 2483, 2619, 2704, 2634, 2553, 2569, 2642, 2711,
+    2639, 2570, 2568, 2545, 2603, 2690, 2579, 2494, 2537, 2627, 2657, 2565, 2433, 2522, 2730, 2653,
+    2488, 2407, 2561, 2693, 2618, 2373, 2347, 2555, 2654, 2604, 2394, 2376, 2578, 2639, 2562, 2407,
+    2404, 2533, 2615, 2541, 2438, 2420, 2532, 2528, 2552, 2459, 2447, 2485, 2558, 2648, 2501, 2345,
+    2448, 2600, 2612, 2420, 2336, 2491, 2640, 2556, 2354, 2236, 2394, 2572, 2453, 2272, 2146, 2259,
+    2431, 2309, 2066, 2031, 2247, 2338, 2272, 2096, 2103, 2266, 2389, 2303, 2165, 2189, 2388, 2450,
+    2339, 2278, 2301, 2374, 2505, 2412, 2309, 2302, 2383, 2476, 2392, 2301, 2280, 2351, 2424, 2415,
+    2314, 2255, 2264, 2392, 2427, 2266, 2155, 2259, 2416, 2419, 2223, 2089, 2262, 2413, 2340, 2123,
+    2073, 2283, 2395, 2275, 2076, 2064, 2252, 2366, 2178, 2004, 2023, 2227, 2235, 2189, 2022, 2035,
+    2043, 2162, 2120, 2037, 2007, 2015, 2168, 2153, 2052, 1912, 1934, 2145, 2160, 1905, 1883, 1927,
+    2092, 2127, 1922, 1831, 1981, 2127, 2109, 1893, 1837, 2070, 2140, 2065, 1872, 1913, 2114, 2145,
+    2060, 1902, 1996, 2060, 2127, 2048, 1904, 1976, 1967, 2088, 2007, 1988, 1906, 1964, 2043, 2030,
+    1978, 1829, 1952, 2103, 2188, 1917, 1865, 1988, 2119, 2093, 1950, 1830, 2026, 2204, 2185, 1942,
+    1852, 2056, 2296, 2229, 2149, 2328, 2694, 2999, 3124, 3184, 3074, 2750, 2444, 1931, 1495, 1325,
+    1418, 1632, 1752, 1813, 1867, 1907, 2041, 2083, 1916, 1899, 2008, 2122, 2126, 1925, 1813, 1932,
+    2143, 2067, 1843, 1789, 1993, 2075, 2034, 1828, 1782, 1949, 2045, 1937, 1768, 1833, 1937, 2046,
+    1919, 1781, 1842, 1907, 2001, 1900, 1810, 1798, 1823, 1922, 1956, 1863, 1772, 1743, 1969, 1947,
+    1857, 1761, 1781, 1954, 1935, 1783, 1654, 1829, 1990, 1927, 1758, 1697, 1890, 2084, 1955, 1787,
+    1689, 1883, 1953, 1880, 1758, 1755, 1859, 1902, 1820, 1618, 1757, 1785, 1793, 1714, 1611, 1575,
+    1589, 1680, 1716, 1582, 1395, 1536, 1705, 1709, 1533, 1467, 1642, 1802, 1779, 1556, 1588, 1775,
+    1872, 1768, 1677, 1681, 1819, 1872, 1799, 1737, 1773, 1778, 1825, 1774, 1771, 1715, 1788, 1825,
+    1845, 1671, 1680, 1745, 1855, 1887, 1730, 1602, 1664, 1892, 1835, 1671, 1555, 1710, 1837, 1808,
+    1593, 1551, 1755, 1825, 1753, 1560, 1608, 1719, 1773, 1695, 1520, 1549, 1682, 1737, 1631, 1543,
+    1604, 1573, 1685, 1649, 1549, 1500, 1564, 1657, 1686, 1524, 1467, 1507, 1672, 1739, 1551, 1458,
+    1461, 1686, 1684, 1513, 1432, 1579, 1733, 1675, 1552, 1452, 1636, 1781, 1679, 1548, 1509, 1749,
+    1797, 1683, 1567, 1580, 1717, 1774, 1752, 1629, 1601, 1627, 1745, 1722, 1672, 1536, 1618, 1708,
+    1733, 1664, 1531, 1645, 1793, 1817, 1661, 1550, 1708, 1823, 1872, 1676, 1626, 1773, 1947, 1935,
+    1715, 1665, 1858, 2048, 2029, 1941, 2139, 2443, 2836, 2924, 2954, 2854, 2588, 2297, 1712, 1288,
+    1159, 1236, 1493, 1627, 1683, 1661, 1709, 1918, 1981, 1814, 1733, 1861, 1935, 2031, 1747, 1712,
+    1842, 2056, 1978, 1832, 1703, 1879, 2023, 1960, 1750, 1692, 1901, 2039, 1917, 1756, 1767, 1890,
+    1975, 1944, 1830, 1792, 1887, 1906, 1882, 1769, 1778, 1855, 1970, 1968, 1855, 1758, 1812, 1990,
+    2003, 1889, 1823, 1901, 2062, 2021, 1908, 1740, 1883, 2100, 2039, 1894, 1809, 2037, 2161, 2074,
+    1875, 1846, 2026, 2080, 1972, 1808, 1856, 1967, 2082, 1964, 1870, 1838, 1882, 1966, 1889, 1781,
+    1740, 1787, 1928, 1879, 1751, 1712, 1917, 1977, 1956, 1826, 1793, 1970, 2080, 2050, 1947, 1921,
+    1985, 2105, 2085, 1946, 1953, 1998, 2132, 2103, 2007, 1968, 1992, 2092, 2194, 2051, 1950, 1976,
+    2172, 2246, 1938, 1885, 2053, 2225, 2156, 1906, 1874, 2073, 2205, 2131, 1916, 1916, 2115, 2131,
+    2022, 1910, 1918, 2114, 2115, 2081, 1929, 1905, 2004, 2034, 2046, 1981, 1923, 1912, 2053, 2073,
+    1971, 1899, 1959, 2080, 2116, 1923, 1889, 1981, 2159, 2116, 1961, 1871, 2032, 2178, 2137, 1929,
+    1877, 2085, 2181, 2131, 1950, 1985, 2229, 2264, 2109, 2074, 2047, 2193, 2250, 2156, 2037, 2064,
+    2149, 2244, 2196, 2151, 2081, 2156, 2278, 2269, 2185, 2030, 2157, 2328, 2365, 2177, 2043, 2204,
+    2371, 2333, 2218, 2141, 2298, 2462, 2390, 2200, 2160, 2359, 2527, 2547, 2488, 2598, 2968, 3335,
+    3429, 3496, 3405, 3103, 2797, 2208, 1821, 1681, 1793, 1988, 2085, 2188, 2169, 2233, 2431, 2409,
+    2368, 2281, 2352, 2524, 2547, 2310, 2213, 2318, 2550, 2577, 2277, 2179, 2462, 2519, 2456, 2283,
+    2235, 2456, 2550, 2400, 2249, 2282, 2443, 2497, 2444, 2283, 2324, 2413, 2421, 2447, 2377, 2304,
+    2324, 2452, 2474, 2426, 2327, 2323, 2469, 2521, 2375, 2299, 2359, 2593, 2551, 2381, 2262, 2386,
+    2527, 2564, 2346, 2318, 2467, 2590, 2538, 2373, 2354, 2472, 2610, 2503, 2367, 2298, 2485, 2471,
+    2427, 2328, 2349, 2386, 2423, 2367, 2234, 2182, 2240, 2399, 2332, 2154, 2108, 2265, 2393, 2360,
+    2185, 2147, 2347, 2484, 2391, 2305, 2284, 2371, 2476, 2479, 2408, 2371, 2462, 2531, 2518, 2380,
+    2375, 2398, 2560, 2521, 2401, 2285, 2416, 2553, 2506, 2420, 2289, 2414, 2562, 2526, 2381, 2266,
+    2447, 2528, 2448, 2300, 2283, 2372, 2575, 2421, 2270, 2282, 2387, 2546, 2432, 2323, 2322, 2377,
+    2457, 2418, 2319, 2270, 2315, 2391, 2441, 2272, 2188, 2271, 2417, 2424, 2255, 2188, 2335, 2399,
+    2412, 2224, 2150, 2283, 2453, 2365, 2232, 2155, 2301, 2412, 2331, 2203, 2223, 2318, 2477, 2378,
+    2186, 2165, 2340, 2393, 2337, 2198, 2234, 2327, 2361, 2363, 2328, 2217, 2285, 2414, 2361, 2274,
+    2222, 2296, 2354, 2417, 2176, 2170, 2212, 2394, 2406, 2193, 2171, 2280, 2471, 2414, 2224, 2159,
+    2294, 2429, 2435, 2203, 2125, 2325, 2455, 2337, 2200, 2211, 2380, 2482, 2441, 2438, 2580, 2865,
+    3015, 3063, 2919, 2733, 2470, 2283, 2070, 1905, 1945, 2027, 2238, 2322, 2279, 2194, 2272, 2457,
+    2426, 2321, 2202, 2293, 2463, 2406, 2261, 2105, 2330, 2482, 2322, 2196, 2045, 2315, 2476, 2309,
+    2105, 2138, 2296, 2331, 2168, 2079, 2134, 2249, 2231, 2179, 2157, 2092, 2071, 2128, 2167, 2083,
+    2043, 2025, 2132, 2184, 2051, 1904, 2002, 2192, 2160, 1957, 1855, 1938, 2229, 2157, 1912, 1821,
+    1991, 2199, 2039, 1878, 1870, 2035, 2177, 2037, 1926, 1918, 2013, 2097, 1996, 1879, 1935, 1946,
+    2024, 2012, 1964, 1911, 1940, 1955, 1940, 1891, 1792, 1882, 1923, 2002, 1888, 1787, 1807, 2010,
+    2052, 1793, 1675, 1795, 2088, 2033, 1787, 1742, 1934, 2106, 2001, 1829, 1854, 1981, 2091, 1995,
+    1854, 1863, 2008, 2178, 2017, 1874, 1919, 2091, 2244, 2254, 2268, 2536, 2849, 3135, 3191, 2993,
+    2602, 2252, 1907, 1557, 1334, 1265, 1417, 1758, 1896, 1784, 1700, 1825, 1979, 2044, 1854, 1752,
+    1913, 2115, 1990, 1834, 1743, 1933, 2081, 1885, 1755, 1795, 1913, 1983, 1909, 1746, 1715, 1876,
+    1904, 1843, 1763, 1747, 1804, 1879, 1911, 1827, 1703, 1745, 1824, 1865, 1763, 1641, 1757, 1935,
+    1948, 1719, 1575, 1761, 1872, 1925, 1645, 1657, 1778, 1962, 1809, 1637, 1613, 1772, 1883, 1830,
+    1668, 1717, 1804, 1908, 1829, 1641, 1755, 1742, 1801, 1770, 1744, 1616, 1688, 1733, 1715, 1677,
+    1534, 1571, 1708, 1635, 1527, 1409, 1444, 1637, 1571, 1430, 1319, 1464, 1675, 1604, 1495, 1386,
+    1570, 1696, 1643, 1553, 1475, 1617, 1745, 1648, 1548, 1491, 1638, 1733, 1674, 1540, 1444, 1575,
+    1698, 1673, 1518, 1534, 1563, 1673, 1680, 1465, 1482, 1531, 1711, 1686, 1509, 1404, 1613, 1684,
+    1648, 1470, 1431, 1566, 1686, 1593, 1512, 1406, 1538, 1679, 1653, 1481, 1434, 1558, 1663, 1656,
+    1431, 1407, 1535, 1621, 1638, 1445, 1405, 1517, 1624, 1619, 1457, 1418, 1522, 1684, 1576, 1472,
+    1406, 1521, 1619, 1559, 1465, 1356, 1562, 1657, 1605, 1485, 1450, 1491, 1612, 1567, 1451, 1429,
+    1519, 1612, 1606, 1436, 1386, 1519, 1641, 1603, 1369, 1408, 1531, 1638, 1607, 1390, 1386, 1521,
+    1646, 1594, 1435, 1453, 1482, 1631, 1568, 1400, 1387, 1494, 1627, 1555, 1413, 1391, 1500, 1648,
+    1594, 1437, 1372, 1535, 1628, 1590, 1439, 1404, 1526, 1616, 1530, 1436, 1422, 1533, 1646, 1584,
+    1462, 1386, 1511, 1673, 1611, 1432, 1423, 1541, 1626, 1604, 1446, 1427, 1527, 1698, 1548, 1445,
+    1447, 1506, 1613, 1601, 1506, 1421, 1543, 1633, 1564, 1450, 1439, 1482, 1643, 1590, 1446, 1438,
+    1548, 1627, 1570, 1476, 1431, 1499, 1646, 1616, 1504, 1490, 1555, 1667, 1661, 1512, 1464, 1596,
+    1654, 1620, 1445, 1434, 1635, 1698, 1653, 1476, 1481, 1572, 1704, 1693, 1521, 1466, 1626, 1709,
+    1697, 1534, 1490, 1621, 1739, 1675, 1572, 1546, 1653, 1746, 1701, 1553, 1492, 1631, 1780, 1724,
+    1568, 1459, 1647, 1723, 1738, 1572, 1530, 1617, 1742, 1757, 1573, 1513, 1658, 1811, 1704, 1652,
+    1514, 1632, 1828, 1713, 1570, 1557, 1655, 1804, 1735, 1611, 1527, 1716, 1848, 1748, 1615, 1605,
+    1691, 1850, 1797, 1689, 1592, 1758, 1834, 1824, 1653, 1584, 1723, 1847, 1827, 1696, 1661, 1748,
+    1894, 1862, 1660, 1679, 1779, 1865, 1842, 1708, 1677, 1788, 1842, 1812, 1740, 1673, 1802, 1925,
+    1850, 1716, 1711, 1823, 1923, 1910, 1764, 1706, 1818, 1877, 1898, 1745, 1721, 1816, 1992, 1888,
+    1792, 1730, 1904, 1929, 1914, 1784, 1780, 1898, 1985, 1922, 1805, 1780,
+};
+
+static const int32_t ectopic_noise_ann[33] = {
+    100, 326, 560, 778, 1011, 1136, 1436, 1659, 1882, 2121, 2347, 2572,
+    2802, 3036, 3161, 3461, 3685, 3915, 4133, 4355, 4577, 4792, 5005, 5130,
+    5430, 5643, 5866, 6090, 6313, 6538, 6753, 6977, 7102,
+};
+
+static const int16_t mitdb208_data[21600] = {
+    1584, 1564, 1560, 1562, 1562, 1560, 1554, 1540, 1532, 1530, 1528, 1532, 1530, 1518, 1508, 1500,
+    1502, 1502, 1494, 1490, 1486, 1480, 1484, 1486, 1482, 1480, 1470, 1464, 1466, 1460, 1452, 1448,
+    1438, 1432, 1436, 1430, 1424, 1422, 1412, 1418, 1418, 1422, 1416, 1408, 1402, 1402, 1404, 1400,
+    1400, 1398, 1400, 1404, 1414, 1418, 1426, 1428, 1432, 1450, 1464, 1464, 1474, 1476, 1492, 1506,
+    1520, 1534, 1546, 1552, 1554, 1566, 1578, 1596, 1610, 1614, 1624, 1628, 1642, 1656, 1654, 1652,
+    1648, 1654, 1658, 1658, 1658, 1654, 1652, 1654, 1668, 1670, 1674, 1664, 1656, 1658, 1672, 1674,
+    1674, 1668, 1664, 1662, 1664, 1670, 1668, 1660, 1654, 1650, 1666, 1678, 1680, 1674, 1678, 1680,
+    1688, 1690, 1688, 1680, 1678, 1684, 1688, 1694, 1700, 1696, 1696, 1698, 1702, 1712, 1716, 1710,
+    1706, 1702, 1714, 1720, 1716, 1706, 1708, 1718, 1730, 1746, 1752, 1752, 1750, 1750, 1760, 1772,
+    1780, 1784, 1786, 1792, 1788, 1796, 1796, 1786, 1784, 1784, 1790, 1796, 1796, 1780, 1772, 1760,
+    1758, 1762, 1762, 1750, 1740, 1734, 1736, 1742, 1736, 1728, 1728, 1728, 1738, 1742, 1736, 1734,
+    1732, 1730, 1732, 1740, 1742, 1738, 1724, 1722, 1728, 1734, 1728, 1732, 1718, 1726, 1752, 1792,
+    1844, 1912, 1988, 2082, 2180, 2272, 2338, 2386, 2360, 2246, 2086, 1938, 1834, 1776, 1756, 1756,
+    1752, 1748, 1744, 1746, 1748, 1746, 1744, 1742, 1744, 1742, 1732, 1728, 1738, 1744, 1744, 1734,
+    1728, 1738, 1744, 1752, 1750, 1748, 1744, 1744, 1752, 1756, 1756, 1752, 1752, 1750, 1766, 1770,
+    1770, 1762, 1760, 1766, 1772, 1780, 1776, 1770, 1772, 1768, 1782, 1788, 1792, 1790, 1784, 1790,
+    1800, 1814, 1820, 1818, 1818, 1826, 1836, 1844, 1854, 1854, 1854, 1854, 1868, 1884, 1886, 1896,
+    1900, 1904, 1912, 1918, 1922, 1922, 1928, 1932, 1934, 1942, 1944, 1942, 1938, 1936, 1934, 1944,
+    1938, 1932, 1924, 1910, 1906, 1902, 1896, 1886, 1870, 1854, 1852, 1848, 1842, 1828, 1818, 1810,
+    1806, 1806, 1808, 1800, 1794, 1798, 1798, 1794, 1798, 1784, 1780, 1778, 1784, 1782, 1788, 1788,
+    1788, 1796, 1792, 1798, 1794, 1794, 1792, 1792, 1796, 1794, 1794, 1788, 1784, 1788, 1796, 1800,
+    1796, 1792, 1776, 1788, 1788, 1788, 1786, 1772, 1778, 1780, 1790, 1802, 1802, 1798, 1796, 1796,
+    1806, 1816, 1826, 1834, 1838, 1836, 1836, 1842, 1846, 1842, 1838, 1830, 1824, 1820, 1820, 1812,
+    1802, 1800, 1794, 1786, 1782, 1776, 1776, 1768, 1766, 1768, 1766, 1754, 1758, 1758, 1760, 1764,
+    1774, 1770, 1764, 1762, 1766, 1768, 1768, 1768, 1768, 1770, 1774, 1766, 1766, 1764, 1760, 1780,
+    1822, 1876, 1946, 2030, 2130, 2244, 2356, 2440, 2430, 2318, 2156, 1994, 1862, 1796, 1782, 1778,
+    1778, 1770, 1776, 1790, 1790, 1780, 1772, 1762, 1770, 1774, 1774, 1766, 1762, 1758, 1762, 1772,
+    1778, 1770, 1768, 1772, 1780, 1790, 1788, 1786, 1778, 1782, 1790, 1796, 1798, 1788, 1790, 1788,
+    1794, 1806, 1820, 1814, 1810, 1814, 1814, 1822, 1826, 1828, 1822, 1826, 1828, 1840, 1844, 1842,
+    1838, 1842, 1850, 1870, 1874, 1874, 1872, 1876, 1880, 1886, 1898, 1892, 1896, 1902, 1912, 1926,
+    1926, 1924, 1918, 1924, 1940, 1948, 1950, 1936, 1926, 1922, 1922, 1926, 1926, 1908, 1896, 1894,
+    1894, 1886, 1874, 1856, 1842, 1838, 1840, 1838, 1826, 1810, 1804, 1802, 1802, 1808, 1806, 1794,
+    1794, 1798, 1802, 1806, 1804, 1796, 1792, 1796, 1794, 1802, 1800, 1790, 1794, 1800, 1806, 1808,
+    1808, 1804, 1804, 1808, 1806, 1814, 1810, 1802, 1798, 1802, 1806, 1812, 1812, 1806, 1804, 1814,
+    1816, 1824, 1824, 1826, 1830, 1838, 1842, 1848, 1850, 1850, 1860, 1864, 1882, 1888, 1882, 1878,
+    1880, 1880, 1876, 1880, 1878, 1866, 1858, 1838, 1830, 1832, 1832, 1830, 1832, 1826, 1826, 1818,
+    1814, 1806, 1800, 1798, 1804, 1812, 1818, 1816, 1826, 1850, 1878, 1908, 1926, 1952, 1974, 1996,
+    2030, 2064, 2088, 2096, 2116, 2156, 2212, 2292, 2390, 2480, 2580, 2656, 2726, 2784, 2794, 2712,
+    2532, 2312, 2106, 1956, 1890, 1858, 1822, 1810, 1810, 1816, 1816, 1798, 1782, 1778, 1784, 1784,
+    1784, 1770, 1764, 1766, 1768, 1772, 1772, 1764, 1760, 1758, 1764, 1774, 1772, 1766, 1756, 1764,
+    1768, 1774, 1766, 1754, 1750, 1748, 1756, 1760, 1764, 1756, 1748, 1752, 1764, 1766, 1764, 1750,
+    1748, 1758, 1762, 1764, 1762, 1754, 1752, 1762, 1774, 1776, 1774, 1762, 1766, 1766, 1776, 1784,
+    1786, 1784, 1780, 1784, 1796, 1810, 1810, 1812, 1806, 1810, 1820, 1836, 1844, 1838, 1842, 1844,
+    1856, 1868, 1868, 1862, 1856, 1856, 1866, 1872, 1870, 1856, 1854, 1852, 1858, 1862, 1860, 1850,
+    1840, 1840, 1850, 1862, 1856, 1842, 1830, 1840, 1854, 1858, 1856, 1850, 1844, 1844, 1852, 1860,
+    1856, 1848, 1836, 1838, 1846, 1850, 1854, 1844, 1842, 1848, 1854, 1866, 1862, 1850, 1848, 1846,
+    1854, 1858, 1852, 1850, 1846, 1852, 1856, 1862, 1866, 1860, 1860, 1866, 1886, 1892, 1896, 1884,
+    1880, 1890, 1904, 1918, 1920, 1914, 1912, 1918, 1926, 1934, 1926, 1916, 1912, 1906, 1910, 1902,
+    1894, 1876, 1874, 1868, 1866, 1866, 1868, 1860, 1860, 1854, 1866, 1868, 1866, 1860, 1856, 1860,
+    1856, 1860, 1860, 1860, 1862, 1854, 1856, 1866, 1864, 1862, 1854, 1850, 1868, 1906, 1972, 2062,
+    2166, 2280, 2400, 2508, 2584, 2576, 2442, 2236, 2034, 1900, 1854, 1856, 1864, 1866, 1868, 1878,
+    1882, 1884, 1870, 1866, 1862, 1872, 1874, 1868, 1860, 1858, 1862, 1874, 1878, 1870, 1860, 1864,
+    1872, 1876, 1884, 1880, 1874, 1876, 1880, 1892, 1892, 1886, 1884, 1882, 1892, 1900, 1898, 1892,
+    1894, 1904, 1914, 1926, 1920, 1912, 1912, 1924, 1934, 1944, 1948, 1942, 1946, 1954, 1966, 1972,
+    1980, 1978, 1982, 1986, 2004, 2008, 2010, 2012, 2016, 2020, 2026, 2026, 2034, 2026, 2032, 2038,
+    2042, 2044, 2044, 2044, 2036, 2038, 2034, 2024, 2018, 2002, 1994, 1990, 1980, 1972, 1962, 1950,
+    1942, 1934, 1938, 1936, 1922, 1910, 1908, 1904, 1904, 1904, 1896, 1892, 1886, 1888, 1890, 1886,
+    1892, 1884, 1886, 1892, 1896, 1898, 1898, 1892, 1892, 1892, 1894, 1898, 1894, 1890, 1892, 1894,
+    1900, 1902, 1904, 1900, 1904, 1906, 1910, 1912, 1906, 1906, 1906, 1904, 1908, 1904, 1912, 1908,
+    1906, 1910, 1924, 1936, 1942, 1942, 1942, 1948, 1948, 1962, 1968, 1964, 1968, 1964, 1956, 1962,
+    1966, 1962, 1960, 1956, 1956, 1952, 1944, 1934, 1920, 1920, 1922, 1920, 1908, 1898, 1896, 1892,
+    1902, 1898, 1898, 1896, 1896, 1898, 1900, 1902, 1898, 1896, 1896, 1896, 1902, 1898, 1900, 1900,
+    1892, 1898, 1900, 1902, 1898, 1908, 1940, 1984, 2054, 2130, 2226, 2328, 2440, 2546, 2608, 2588,
+    2486, 2348, 2198, 2074, 1982, 1936, 1924, 1912, 1900, 1890, 1894, 1910, 1910, 1906, 1898, 1894,
+    1896, 1902, 1900, 1894, 1892, 1892, 1896, 1898, 1900, 1894, 1896, 1892, 1896, 1900, 1906, 1902,
+    1898, 1908, 1910, 1914, 1912, 1914, 1912, 1918, 1924, 1924, 1926, 1924, 1926, 1926, 1928, 1942,
+    1948, 1946, 1956, 1958, 1956, 1968, 1974, 1980, 1980, 1980, 1986, 1992, 2002, 2008, 2010, 2014,
+    2022, 2032, 2042, 2044, 2044, 2048, 2054, 2062, 2072, 2070, 2072, 2072, 2076, 2088, 2094, 2082,
+    2072, 2062, 2058, 2062, 2054, 2040, 2018, 2008, 2006, 2010, 1998, 1980, 1960, 1954, 1958, 1956,
+    1948, 1932, 1924, 1924, 1926, 1930, 1932, 1924, 1928, 1930, 1938, 1936, 1930, 1930, 1922, 1926,
+    1932, 1934, 1934, 1928, 1926, 1930, 1934, 1942, 1938, 1942, 1938, 1940, 1940, 1942, 1948, 1944,
+    1946, 1936, 1938, 1950, 1954, 1954, 1954, 1950, 1952, 1956, 1956, 1960, 1954, 1962, 1974, 1984,
+    1988, 1986, 1984, 1988, 2000, 2016, 2022, 2022, 2014, 2012, 2012, 2022, 2020, 2008, 1988, 1982,
+    1980, 1986, 1982, 1966, 1956, 1952, 1960, 1964, 1958, 1948, 1938, 1942, 1946, 1952, 1952, 1940,
+    1936, 1936, 1946, 1950, 1950, 1940, 1936, 1942, 1952, 1958, 1956, 1942, 1936, 1948, 1978, 2026,
+    2082, 2142, 2226, 2328, 2442, 2546, 2604, 2580, 2458, 2308, 2174, 2064, 1996, 1968, 1950, 1944,
+    1938, 1946, 1952, 1952, 1952, 1948, 1952, 1948, 1944, 1944, 1944, 1940, 1948, 1948, 1948, 1940,
+    1948, 1950, 1956, 1958, 1960, 1958, 1958, 1960, 1966, 1976, 1968, 1962, 1964, 1968, 1974, 1982,
+    1978, 1976, 1980, 1976, 1990, 1994, 1998, 1996, 1996, 1998, 2006, 2014, 2016, 2010, 2008, 2018,
+    2028, 2040, 2046, 2046, 2050, 2054, 2062, 2068, 2080, 2082, 2086, 2090, 2102, 2102, 2098, 2106,
+    2104, 2110, 2122, 2122, 2126, 2130, 2132, 2134, 2138, 2134, 2132, 2124, 2116, 2106, 2096, 2094,
+    2086, 2074, 2062, 2052, 2052, 2050, 2040, 2028, 2022, 2016, 2014, 2008, 2004, 2002, 1990, 1986,
+    1978, 1988, 1984, 1988, 1986, 1986, 1988, 1986, 1988, 1992, 1986, 1986, 1984, 1988, 1990, 1984,
+    1986, 1988, 1988, 1996, 2002, 2000, 2002, 1992, 1992, 2004, 2004, 2004, 2002, 2000, 1998, 1996,
+    2002, 2008, 1998, 1992, 2004, 2008, 2010, 2012, 2008, 2004, 2004, 2008, 2012, 2012, 2010, 2012,
+    2024, 2042, 2062, 2070, 2078, 2090, 2120, 2154, 2188, 2218, 2238, 2274, 2302, 2334, 2358, 2380,
+    2400, 2428, 2466, 2508, 2538, 2554, 2564, 2590, 2622, 2642, 2638, 2610, 2572, 2536, 2524, 2522,
+    2500, 2480, 2458, 2438, 2430, 2424, 2416, 2402, 2386, 2384, 2400, 2398, 2378, 2334, 2278, 2210,
+    2140, 2078, 2020, 1964, 1922, 1902, 1892, 1892, 1880, 1864, 1844, 1840, 1848, 1846, 1836, 1834,
+    1820, 1812, 1818, 1814, 1806, 1796, 1792, 1788, 1782, 1782, 1784, 1772, 1760, 1746, 1744, 1748,
+    1744, 1732, 1724, 1718, 1722, 1720, 1724, 1722, 1718, 1728, 1728, 1738, 1736, 1738, 1742, 1746,
+    1756, 1766, 1770, 1774, 1784, 1796, 1808, 1826, 1844, 1852, 1862, 1878, 1892, 1914, 1922, 1926,
+    1932, 1940, 1950, 1958, 1968, 1966, 1970, 1978, 1984, 1994, 1996, 1996, 1990, 1988, 1994, 1996,
+    2002, 2000, 1992, 1986, 1990, 1994, 1996, 1990, 1992, 1992, 1996, 2004, 2004, 2002, 1992, 1984,
+    2000, 2006, 2006, 2004, 2000, 2000, 2004, 2014, 2022, 2016, 2012, 2006, 2012, 2020, 2020, 2020,
+    2018, 2022, 2020, 2028, 2028, 2024, 2022, 2026, 2026, 2038, 2038, 2042, 2032, 2038, 2040, 2044,
+    2046, 2042, 2036, 2034, 2038, 2044, 2050, 2044, 2046, 2046, 2048, 2056, 2056, 2058, 2052, 2050,
+    2054, 2058, 2062, 2062, 2052, 2046, 2050, 2054, 2060, 2062, 2054, 2050, 2054, 2068, 2072, 2070,
+    2070, 2068, 2076, 2082, 2088, 2084, 2088, 2094, 2104, 2118, 2120, 2124, 2120, 2118, 2122, 2124,
+    2124, 2120, 2110, 2104, 2096, 2094, 2094, 2090, 2078, 2074, 2076, 2078, 2078, 2074, 2074, 2072,
+    2074, 2080, 2078, 2070, 2064, 2062, 2068, 2080, 2082, 2082, 2076, 2080, 2080, 2084, 2088, 2088,
+    2078, 2072, 2068, 2084, 2120, 2164, 2222, 2298, 2386, 2478, 2572, 2654, 2720, 2750, 2710, 2600,
+    2466, 2324, 2208, 2144, 2120, 2114, 2106, 2100, 2086, 2090, 2100, 2098, 2094, 2080, 2076, 2080,
+    2082, 2084, 2086, 2080, 2076, 2078, 2078, 2082, 2084, 2084, 2082, 2086, 2092, 2096, 2094, 2092,
+    2094, 2094, 2096, 2098, 2100, 2100, 2102, 2102, 2108, 2114, 2110, 2112, 2108, 2114, 2124, 2130,
+    2138, 2134, 2136, 2140, 2150, 2158, 2154, 2150, 2150, 2164, 2170, 2182, 2190, 2186, 2188, 2194,
+    2204, 2218, 2222, 2226, 2228, 2234, 2240, 2252, 2254, 2252, 2252, 2254, 2266, 2280, 2284, 2280,
+    2280, 2284, 2292, 2298, 2294, 2282, 2272, 2264, 2260, 2258, 2248, 2230, 2214, 2208, 2206, 2200,
+    2192, 2180, 2172, 2162, 2156, 2154, 2148, 2144, 2134, 2128, 2130, 2128, 2130, 2126, 2122, 2124,
+    2126, 2128, 2120, 2114, 2112, 2116, 2120, 2126, 2120, 2118, 2110, 2118, 2126, 2134, 2132, 2132,
+    2132, 2132, 2134, 2138, 2132, 2126, 2126, 2128, 2134, 2136, 2132, 2124, 2122, 2128, 2134, 2142,
+    2138, 2138, 2136, 2138, 2140, 2144, 2138, 2136, 2132, 2130, 2134, 2132, 2142, 2138, 2152, 2158,
+    2162, 2168, 2170, 2170, 2174, 2180, 2186, 2192, 2190, 2190, 2190, 2192, 2188, 2186, 2180, 2176,
+    2168, 2160, 2156, 2156, 2152, 2144, 2134, 2128, 2134, 2132, 2134, 2126, 2124, 2126, 2126, 2130,
+    2134, 2126, 2124, 2128, 2130, 2136, 2128, 2128, 2132, 2132, 2134, 2138, 2140, 2138, 2134, 2132,
+    2148, 2180, 2226, 2288, 2358, 2438, 2530, 2626, 2712, 2784, 2818, 2782, 2680, 2552, 2416, 2294,
+    2200, 2172, 2170, 2170, 2152, 2132, 2132, 2142, 2152, 2160, 2146, 2136, 2128, 2130, 2136, 2144,
+    2142, 2128, 2126, 2128, 2136, 2140, 2140, 2138, 2136, 2134, 2140, 2148, 2146, 2144, 2140, 2140,
+    2150, 2162, 2162, 2158, 2152, 2144, 2160, 2174, 2174, 2168, 2164, 2164, 2170, 2178, 2184, 2176,
+    2176, 2178, 2190, 2206, 2216, 2210, 2210, 2206, 2220, 2236, 2244, 2242, 2236, 2232, 2242, 2256,
+    2264, 2270, 2272, 2276, 2280, 2288, 2306, 2300, 2292, 2292, 2302, 2310, 2318, 2324, 2316, 2306,
+    2308, 2316, 2316, 2304, 2286, 2274, 2270, 2270, 2266, 2254, 2244, 2230, 2224, 2218, 2216, 2200,
+    2196, 2178, 2178, 2182, 2190, 2182, 2174, 2166, 2162, 2166, 2172, 2164, 2154, 2152, 2154, 2158,
+    2160, 2162, 2158, 2150, 2152, 2160, 2170, 2170, 2168, 2160, 2164, 2166, 2174, 2170, 2172, 2164,
+    2166, 2172, 2172, 2174, 2174, 2176, 2182, 2178, 2190, 2182, 2184, 2182, 2178, 2182, 2180, 2176,
+    2174, 2170, 2174, 2184, 2180, 2178, 2178, 2178, 2184, 2180, 2178, 2176, 2172, 2184, 2186, 2190,
+    2184, 2176, 2172, 2174, 2176, 2188, 2190, 2186, 2182, 2182, 2184, 2192, 2198, 2208, 2210, 2222,
+    2230, 2238, 2248, 2266, 2288, 2312, 2346, 2370, 2398, 2430, 2454, 2490, 2522, 2552, 2574, 2586,
+    2602, 2624, 2654, 2690, 2726, 2746, 2766, 2790, 2818, 2832, 2832, 2810, 2776, 2746, 2736, 2724,
+    2714, 2690, 2674, 2658, 2642, 2636, 2624, 2604, 2592, 2584, 2590, 2606, 2602, 2574, 2528, 2478,
+    2420, 2352, 2274, 2196, 2130, 2088, 2082, 2080, 2076, 2064, 2044, 2040, 2040, 2036, 2036, 2024,
+    2020, 2012, 2014, 2008, 2004, 1998, 1990, 1990, 1992, 1996, 1996, 1982, 1976, 1974, 1976, 1974,
+    1972, 1962, 1950, 1948, 1948, 1944, 1948, 1934, 1920, 1922, 1926, 1932, 1936, 1924, 1912, 1910,
+    1906, 1914, 1914, 1904, 1902, 1900, 1908, 1920, 1926, 1932, 1928, 1928, 1944, 1964, 1974, 1976,
+    1978, 1986, 1994, 2022, 2036, 2046, 2050, 2058, 2066, 2092, 2114, 2122, 2126, 2130, 2136, 2154,
+    2164, 2164, 2160, 2154, 2164, 2172, 2172, 2168, 2162, 2158, 2160, 2172, 2178, 2170, 2164, 2154,
+    2166, 2178, 2178, 2168, 2164, 2162, 2164, 2172, 2172, 2168, 2160, 2162, 2166, 2174, 2182, 2176,
+    2166, 2166, 2170, 2176, 2182, 2176, 2170, 2168, 2172, 2184, 2188, 2180, 2176, 2180, 2188, 2196,
+    2192, 2190, 2182, 2176, 2178, 2190, 2192, 2180, 2170, 2170, 2180, 2192, 2196, 2186, 2182, 2176,
+    2184, 2192, 2198, 2190, 2182, 2178, 2184, 2188, 2192, 2188, 2186, 2186, 2190, 2196, 2202, 2200,
+    2192, 2186, 2192, 2198, 2200, 2196, 2196, 2192, 2198, 2208, 2206, 2206, 2196, 2196, 2206, 2208,
+    2210, 2208, 2200, 2196, 2194, 2200, 2202, 2198, 2194, 2192, 2196, 2202, 2200, 2200, 2194, 2194,
+    2192, 2202, 2202, 2198, 2196, 2194, 2202, 2216, 2222, 2220, 2216, 2218, 2218, 2236, 2242, 2248,
+    2248, 2246, 2256, 2256, 2258, 2248, 2240, 2228, 2230, 2228, 2222, 2212, 2200, 2196, 2196, 2202,
+    2196, 2188, 2186, 2184, 2180, 2186, 2188, 2186, 2178, 2178, 2184, 2192, 2194, 2186, 2190, 2186,
+    2188, 2198, 2202, 2200, 2190, 2182, 2184, 2192, 2202, 2224, 2260, 2316, 2396, 2480, 2566, 2650,
+    2730, 2802, 2846, 2814, 2708, 2558, 2428, 2318, 2256, 2238, 2232, 2216, 2190, 2186, 2198, 2214,
+    2220, 2206, 2192, 2190, 2192, 2200, 2198, 2192, 2182, 2176, 2174, 2188, 2194, 2198, 2190, 2186,
+    2194, 2200, 2204, 2196, 2192, 2192, 2196, 2198, 2200, 2200, 2194, 2194, 2202, 2212, 2216, 2218,
+    2212, 2210, 2214, 2224, 2228, 2232, 2224, 2218, 2226, 2244, 2246, 2240, 2238, 2236, 2248, 2266,
+    2276, 2280, 2274, 2272, 2280, 2296, 2306, 2306, 2304, 2304, 2312, 2324, 2334, 2340, 2342, 2338,
+    2344, 2358, 2370, 2368, 2364, 2362, 2374, 2382, 2388, 2388, 2376, 2366, 2362, 2364, 2368, 2364,
+    2354, 2338, 2326, 2320, 2318, 2308, 2292, 2280, 2276, 2268, 2250, 2242, 2238, 2230, 2226, 2226,
+    2222, 2222, 2212, 2208, 2206, 2208, 2214, 2212, 2198, 2192, 2190, 2194, 2202, 2202, 2194, 2186,
+    2188, 2198, 2204, 2204, 2196, 2182, 2186, 2194, 2204, 2200, 2192, 2186, 2180, 2180, 2180, 2188,
+    2192, 2192, 2194, 2196, 2194, 2194, 2190, 2184, 2186, 2192, 2186, 2188, 2184, 2182, 2180, 2184,
+    2186, 2184, 2182, 2184, 2180, 2178, 2180, 2172, 2168, 2174, 2172, 2174, 2174, 2172, 2176, 2178,
+    2178, 2188, 2198, 2198, 2192, 2194, 2192, 2206, 2222, 2226, 2226, 2220, 2218, 2224, 2226, 2226,
+    2218, 2216, 2216, 2210, 2198, 2182, 2174, 2170, 2164, 2166, 2166, 2164, 2158, 2146, 2148, 2152,
+    2160, 2162, 2158, 2154, 2156, 2162, 2164, 2164, 2152, 2156, 2158, 2164, 2164, 2166, 2162, 2158,
+    2156, 2156, 2170, 2198, 2234, 2284, 2346, 2432, 2536, 2636, 2730, 2792, 2796, 2714, 2580, 2432,
+    2292, 2178, 2126, 2118, 2138, 2142, 2144, 2140, 2146, 2156, 2160, 2156, 2144, 2144, 2148, 2148,
+    2154, 2146, 2140, 2138, 2144, 2150, 2150, 2152, 2144, 2138, 2138, 2148, 2156, 2158, 2160, 2158,
+    2154, 2164, 2170, 2174, 2158, 2168, 2168, 2166, 2178, 2174, 2176, 2172, 2184, 2190, 2194, 2194,
+    2190, 2192, 2200, 2208, 2208, 2214, 2210, 2212, 2214, 2220, 2226, 2226, 2230, 2228, 2236, 2246,
+    2260, 2260, 2256, 2242, 2244, 2250, 2266, 2270, 2272, 2272, 2272, 2278, 2284, 2280, 2278, 2272,
+    2280, 2290, 2288, 2284, 2272, 2266, 2262, 2262, 2252, 2242, 2218, 2206, 2196, 2190, 2196, 2182,
+    2168, 2162, 2158, 2164, 2164, 2156, 2144, 2138, 2134, 2140, 2132, 2124, 2116, 2108, 2114, 2118,
+    2124, 2126, 2114, 2110, 2112, 2116, 2120, 2118, 2112, 2110, 2114, 2120, 2122, 2114, 2112, 2110,
+    2116, 2122, 2128, 2124, 2118, 2108, 2108, 2122, 2126, 2122, 2124, 2118, 2122, 2122, 2126, 2120,
+    2116, 2110, 2116, 2126, 2132, 2132, 2126, 2116, 2122, 2134, 2134, 2132, 2128, 2120, 2120, 2124,
+    2128, 2128, 2134, 2124, 2126, 2132, 2148, 2156, 2148, 2144, 2146, 2156, 2164, 2170, 2166, 2170,
+    2170, 2176, 2180, 2176, 2162, 2156, 2156, 2148, 2148, 2138, 2130, 2126, 2128, 2128, 2132, 2140,
+    2144, 2152, 2176, 2206, 2234, 2266, 2286, 2314, 2344, 2376, 2410, 2430, 2444, 2460, 2484, 2524,
+    2568, 2604, 2632, 2652, 2686, 2728, 2770, 2798, 2820, 2844, 2882, 2914, 2950, 2960, 2966, 2928,
+    2816, 2654, 2486, 2344, 2236, 2168, 2130, 2106, 2086, 2064, 2046, 2040, 2028, 2018, 2014, 2004,
+    1994, 1984, 1984, 1992, 1994, 1988, 1980, 1970, 1970, 1974, 1976, 1970, 1964, 1956, 1960, 1958,
+    1964, 1958, 1942, 1940, 1942, 1944, 1950, 1946, 1940, 1928, 1924, 1936, 1934, 1924, 1914, 1908,
+    1910, 1910, 1916, 1914, 1906, 1902, 1900, 1906, 1912, 1900, 1894, 1886, 1890, 1898, 1908, 1902,
+    1900, 1900, 1910, 1920, 1934, 1936, 1934, 1940, 1948, 1976, 1986, 1994, 1992, 1986, 1994, 2012,
+    2026, 2036, 2038, 2044, 2054, 2064, 2074, 2070, 2072, 2068, 2072, 2078, 2074, 2070, 2068, 2068,
+    2072, 2080, 2082, 2078, 2072, 2068, 2074, 2076, 2088, 2090, 2076, 2066, 2066, 2076, 2080, 2082,
+    2078, 2076, 2080, 2090, 2090, 2088, 2076, 2076, 2080, 2088, 2102, 2110, 2118, 2116, 2118, 2112,
+    2096, 2092, 2080, 2078, 2086, 2110, 2114, 2106, 2084, 2068, 2068, 2074, 2084, 2086, 2086, 2084,
+    2090, 2114, 2134, 2134, 2130, 2114, 2110, 2122, 2128, 2128, 2120, 2124, 2128, 2126, 2126, 2126,
+    2138, 2168, 2218, 2264, 2308, 2344, 2370, 2390, 2402, 2432, 2466, 2502, 2546, 2590, 2640, 2684,
+    2714, 2742, 2770, 2788, 2792, 2778, 2748, 2704, 2662, 2628, 2616, 2618, 2602, 2578, 2544, 2526,
+    2526, 2530, 2540, 2544, 2546, 2556, 2558, 2550, 2530, 2488, 2430, 2334, 2222, 2122, 2056, 2018,
+    2002, 1990, 1984, 1970, 1962, 1940, 1924, 1912, 1916, 1920, 1926, 1924, 1908, 1896, 1896, 1896,
+    1896, 1892, 1878, 1876, 1870, 1870, 1874, 1872, 1862, 1856, 1852, 1852, 1840, 1830, 1822, 1814,
+    1814, 1812, 1812, 1806, 1796, 1788, 1788, 1792, 1788, 1784, 1776, 1770, 1766, 1766, 1776, 1776,
+    1776, 1770, 1776, 1790, 1800, 1802, 1804, 1810, 1818, 1832, 1846, 1858, 1862, 1872, 1892, 1910,
+    1924, 1934, 1946, 1960, 1978, 1988, 1996, 2012, 2018, 2018, 2032, 2040, 2042, 2042, 2034, 2040,
+    2042, 2048, 2050, 2048, 2048, 2044, 2046, 2054, 2054, 2052, 2048, 2042, 2042, 2042, 2046, 2046,
+    2044, 2048, 2050, 2052, 2060, 2056, 2052, 2048, 2052, 2062, 2068, 2062, 2058, 2054, 2058, 2062,
+    2064, 2066, 2064, 2062, 2062, 2072, 2070, 2074, 2068, 2068, 2078, 2078, 2080, 2074, 2068, 2066,
+    2070, 2070, 2084, 2082, 2074, 2074, 2082, 2080, 2092, 2092, 2084, 2080, 2072, 2076, 2080, 2078,
+    2076, 2078, 2078, 2080, 2090, 2088, 2084, 2082, 2084, 2088, 2088, 2090, 2084, 2080, 2082, 2088,
+    2094, 2092, 2086, 2082, 2082, 2082, 2100, 2102, 2096, 2092, 2094, 2092, 2096, 2096, 2094, 2098,
+    2108, 2122, 2124, 2112, 2108, 2108, 2126, 2138, 2150, 2154, 2144, 2134, 2140, 2140, 2140, 2140,
+    2130, 2118, 2104, 2106, 2102, 2098, 2088, 2082, 2078, 2084, 2078, 2074, 2076, 2074, 2078, 2082,
+    2092, 2088, 2084, 2078, 2080, 2086, 2084, 2086, 2086, 2086, 2084, 2080, 2094, 2118, 2152, 2212,
+    2284, 2372, 2466, 2566, 2656, 2728, 2742, 2664, 2526, 2382, 2242, 2148, 2118, 2108, 2098, 2080,
+    2074, 2086, 2096, 2094, 2082, 2074, 2078, 2074, 2082, 2086, 2092, 2088, 2080, 2076, 2082, 2092,
+    2088, 2086, 2086, 2082, 2078, 2086, 2094, 2096, 2094, 2092, 2100, 2110, 2114, 2116, 2108, 2104,
+    2104, 2112, 2118, 2122, 2118, 2124, 2124, 2138, 2146, 2154, 2152, 2150, 2154, 2158, 2168, 2176,
+    2168, 2172, 2172, 2184, 2194, 2200, 2206, 2210, 2214, 2220, 2234, 2234, 2232, 2234, 2242, 2246,
+    2256, 2262, 2260, 2258, 2260, 2270, 2278, 2284, 2278, 2270, 2264, 2272, 2266, 2256, 2234, 2214,
+    2202, 2202, 2194, 2180, 2170, 2160, 2158, 2154, 2150, 2140, 2130, 2124, 2116, 2114, 2110, 2108,
+    2098, 2098, 2094, 2098, 2100, 2098, 2096, 2090, 2088, 2090, 2082, 2092, 2096, 2094, 2096, 2102,
+    2102, 2102, 2088, 2084, 2084, 2092, 2100, 2100, 2092, 2092, 2088, 2098, 2104, 2106, 2098, 2090,
+    2094, 2100, 2102, 2102, 2098, 2096, 2108, 2114, 2124, 2124, 2122, 2128, 2134, 2140, 2146, 2150,
+    2154, 2158, 2162, 2172, 2184, 2186, 2182, 2174, 2174, 2170, 2166, 2154, 2142, 2122, 2122, 2128,
+    2134, 2134, 2136, 2146, 2166, 2186, 2212, 2238, 2254, 2260, 2288, 2324, 2370, 2390, 2414, 2434,
+    2458, 2484, 2526, 2568, 2596, 2626, 2658, 2690, 2736, 2786, 2818, 2848, 2886, 2932, 2974, 2994,
+    2984, 2940, 2820, 2630, 2442, 2288, 2196, 2152, 2136, 2120, 2094, 2080, 2058, 2044, 2038, 2034,
+    2038, 2040, 2030, 2022, 2022, 2024, 2030, 2030, 2022, 2018, 2022, 2022, 2024, 2018, 2008, 1998,
+    2006, 2012, 2014, 2008, 1998, 1986, 1984, 1994, 1998, 1996, 1976, 1966, 1966, 1964, 1976, 1978,
+    1974, 1968, 1970, 1966, 1958, 1966, 1956, 1952, 1956, 1958, 1964, 1964, 1950, 1948, 1954, 1966,
+    1974, 1976, 1968, 1968, 1972, 1992, 2000, 2008, 2006, 2006, 2014, 2028, 2038, 2044, 2048, 2054,
+    2066, 2078, 2088, 2092, 2084, 2080, 2086, 2088, 2100, 2096, 2092, 2084, 2084, 2090, 2094, 2096,
+    2090, 2090, 2086, 2090, 2094, 2098, 2092, 2084, 2086, 2092, 2098, 2098, 2090, 2090, 2084, 2094,
+    2102, 2100, 2090, 2088, 2082, 2092, 2094, 2096, 2086, 2082, 2082, 2084, 2092, 2096, 2096, 2088,
+    2098, 2104, 2110, 2108, 2100, 2100, 2102, 2110, 2116, 2118, 2112, 2106, 2110, 2110, 2118, 2124,
+    2118, 2110, 2118, 2118, 2124, 2120, 2114, 2110, 2116, 2126, 2136, 2144, 2138, 2136, 2150, 2166,
+    2176, 2172, 2170, 2168, 2168, 2170, 2170, 2166, 2164, 2154, 2140, 2142, 2140, 2136, 2128, 2120,
+    2116, 2110, 2108, 2108, 2102, 2102, 2102, 2106, 2110, 2108, 2096, 2096, 2092, 2100, 2108, 2110,
+    2102, 2104, 2098, 2096, 2090, 2084, 2092, 2116, 2168, 2244, 2336, 2434, 2532, 2628, 2716, 2796,
+    2834, 2792, 2652, 2478, 2312, 2170, 2082, 2054, 2052, 2042, 2040, 2044, 2066, 2078, 2070, 2062,
+    2054, 2054, 2060, 2054, 2042, 2040, 2040, 2052, 2054, 2056, 2056, 2046, 2052, 2056, 2058, 2060,
+    2062, 2058, 2060, 2060, 2070, 2072, 2062, 2060, 2064, 2072, 2078, 2080, 2078, 2070, 2072, 2078,
+    2074, 2076, 2078, 2076, 2088, 2094, 2108, 2110, 2106, 2104, 2102, 2104, 2110, 2124, 2128, 2134,
+    2138, 2144, 2160, 2176, 2190, 2190, 2188, 2190, 2198, 2204, 2208, 2208, 2218, 2226, 2238, 2238,
+    2228, 2218, 2214, 2208, 2206, 2208, 2196, 2180, 2176, 2172, 2164, 2160, 2146, 2126, 2116, 2122,
+    2118, 2110, 2098, 2090, 2088, 2086, 2098, 2094, 2086, 2084, 2080, 2086, 2080, 2082, 2076, 2068,
+    2064, 2070, 2076, 2078, 2074, 2068, 2068, 2078, 2080, 2082, 2076, 2076, 2082, 2086, 2088, 2086,
+    2086, 2078, 2074, 2078, 2086, 2088, 2080, 2074, 2076, 2086, 2096, 2090, 2082, 2076, 2074, 2084,
+    2086, 2086, 2078, 2072, 2074, 2076, 2080, 2082, 2080, 2086, 2086, 2094, 2106, 2108, 2118, 2110,
+    2108, 2118, 2128, 2132, 2130, 2136, 2140, 2142, 2152, 2144, 2134, 2128, 2122, 2122, 2122, 2114,
+    2098, 2088, 2086, 2088, 2094, 2096, 2088, 2074, 2070, 2076, 2084, 2088, 2080, 2070, 2074, 2088,
+    2098, 2100, 2096, 2090, 2096, 2100, 2106, 2108, 2106, 2098, 2094, 2094, 2100, 2112, 2140, 2190,
+    2266, 2360, 2478, 2590, 2682, 2764, 2826, 2836, 2754, 2608, 2448, 2296, 2188, 2148, 2154, 2150,
+    2126, 2100, 2108, 2138, 2152, 2150, 2142, 2134, 2132, 2132, 2128, 2130, 2120, 2112, 2106, 2110,
+    2114, 2114, 2108, 2104, 2102, 2104, 2110, 2110, 2106, 2098, 2100, 2108, 2112, 2110, 2098, 2090,
+    2090, 2086, 2096, 2096, 2096, 2090, 2096, 2106, 2114, 2122, 2124, 2126, 2128, 2126, 2138, 2146,
+    2146, 2144, 2142, 2152, 2164, 2170, 2170, 2174, 2180, 2192, 2204, 2204, 2196, 2190, 2190, 2200,
+    2212, 2210, 2208, 2210, 2212, 2220, 2230, 2236, 2230, 2220, 2224, 2240, 2244, 2236, 2226, 2216,
+    2198, 2196, 2188, 2188, 2186, 2180, 2174, 2172, 2170, 2164, 2146, 2134, 2124, 2122, 2118, 2114,
+    2104, 2090, 2086, 2082, 2088, 2082, 2078, 2066, 2062, 2070, 2072, 2070, 2068, 2060, 2054, 2062,
+    2070, 2070, 2062, 2060, 2062, 2068, 2078, 2082, 2080, 2076, 2078, 2080, 2084, 2082, 2078, 2078,
+    2084, 2080, 2078, 2080, 2076, 2074, 2074, 2084, 2094, 2096, 2090, 2084, 2082, 2086, 2090, 2092,
+    2090, 2078, 2076, 2078, 2078, 2076, 2068, 2070, 2074, 2082, 2088, 2086, 2072, 2060, 2066, 2078,
+    2098, 2110, 2104, 2096, 2094, 2092, 2094, 2096, 2104, 2110, 2110, 2110, 2112, 2122, 2120, 2118,
+    2118, 2122, 2112, 2106, 2090, 2092, 2096, 2110, 2138, 2166, 2194, 2222, 2252, 2288, 2322, 2350,
+    2368, 2386, 2416, 2458, 2502, 2536, 2560, 2594, 2632, 2680, 2722, 2748, 2744, 2714, 2686, 2668,
+    2650, 2634, 2624, 2628, 2632, 2640, 2646, 2652, 2648, 2638, 2620, 2610, 2594, 2554, 2498, 2412,
+    2316, 2228, 2148, 2080, 2020, 1974, 1954, 1944, 1942, 1938, 1928, 1918, 1912, 1912, 1912, 1906,
+    1896, 1888, 1884, 1884, 1890, 1886, 1876, 1868, 1860, 1862, 1868, 1858, 1858, 1854, 1846, 1854,
+    1854, 1844, 1838, 1826, 1824, 1824, 1826, 1826, 1812, 1800, 1802, 1802, 1806, 1796, 1788, 1774,
+    1770, 1770, 1770, 1770, 1764, 1756, 1754, 1758, 1762, 1760, 1744, 1742, 1742, 1752, 1754, 1758,
+    1762, 1768, 1768, 1778, 1790, 1802, 1806, 1806, 1814, 1832, 1850, 1850, 1852, 1858, 1880, 1900,
+    1912, 1920, 1924, 1932, 1942, 1950, 1964, 1970, 1966, 1962, 1964, 1968, 1978, 1980, 1976, 1978,
+    1978, 1984, 1990, 1990, 1982, 1974, 1972, 1980, 1986, 1980, 1978, 1974, 1974, 1978, 1984, 1984,
+    1972, 1970, 1972, 1978, 1980, 1976, 1972, 1966, 1968, 1976, 1984, 1986, 1976, 1978, 1976, 1974,
+    1980, 1984, 1986, 1982, 1984, 1988, 1998, 2000, 1994, 1990, 1994, 1996, 2002, 2002, 1996, 1988,
+    1988, 1994, 2000, 2000, 1998, 1998, 1996, 2000, 2002, 2002, 1994, 1990, 1990, 1994, 1994, 1994,
+    1994, 1984, 1984, 1990, 1992, 1996, 1984, 1980, 1980, 1992, 1998, 2000, 2000, 2006, 2010, 2014,
+    2018, 2022, 2030, 2028, 2034, 2040, 2050, 2054, 2052, 2050, 2052, 2050, 2054, 2050, 2040, 2032,
+    2020, 2008, 2006, 1998, 1988, 1984, 1988, 1992, 1996, 1994, 1984, 1986, 1986, 1992, 1996, 1992,
+    1988, 1984, 1980, 1984, 1988, 1990, 1990, 1982, 1986, 1986, 1994, 1998, 1994, 1984, 1982, 1984,
+    1996, 2014, 2044, 2090, 2146, 2230, 2326, 2422, 2502, 2570, 2628, 2642, 2570, 2442, 2288, 2150,
+    2058, 2026, 2018, 2012, 2002, 1986, 1978, 1990, 2002, 2010, 1996, 1986, 1990, 1994, 2002, 1994,
+    1990, 1990, 1984, 1986, 1990, 1996, 1992, 1984, 1984, 1992, 2000, 2002, 2002, 1998, 2002, 2012,
+    2018, 2016, 2012, 2008, 2012, 2022, 2028, 2032, 2022, 2020, 2020, 2028, 2036, 2040, 2042, 2046,
+    2046, 2054, 2064, 2064, 2062, 2060, 2062, 2066, 2080, 2078, 2084, 2082, 2092, 2100, 2118, 2118,
+    2124, 2126, 2134, 2148, 2162, 2170, 2168, 2164, 2166, 2176, 2182, 2188, 2186, 2186, 2192, 2198,
+    2210, 2212, 2208, 2200, 2192, 2188, 2186, 2176, 2164, 2142, 2130, 2116, 2110, 2102, 2100, 2084,
+    2076, 2070, 2062, 2062, 2050, 2032, 2028, 2030, 2028, 2026, 2024, 2018, 2010, 2012, 2026, 2022,
+    2020, 2012, 2012, 2016, 2022, 2022, 2020, 2010, 2012, 2018, 2016, 2020, 2014, 2008, 2008, 2018,
+    2030, 2026, 2026, 2016, 2014, 2018, 2026, 2028, 2022, 2018, 2016, 2016, 2024, 2026, 2028, 2016,
+    2018, 2026, 2034, 2034, 2028, 2018, 2020, 2028, 2032, 2034, 2028, 2024, 2030, 2044, 2056, 2060,
+    2056, 2056, 2054, 2066, 2084, 2094, 2096, 2088, 2088, 2092, 2092, 2090, 2076, 2064, 2062, 2068,
+    2060, 2062, 2056, 2048, 2040, 2046, 2044, 2040, 2028, 2024, 2022, 2028, 2034, 2034, 2030, 2024,
+    2026, 2026, 2030, 2034, 2028, 2022, 2024, 2028, 2032, 2034, 2028, 2030, 2026, 2030, 2026, 2034,
+    2048, 2078, 2132, 2208, 2296, 2384, 2468, 2552, 2622, 2666, 2636, 2524, 2386, 2246, 2140, 2082,
+    2064, 2054, 2050, 2032, 2032, 2044, 2054, 2054, 2042, 2030, 2022, 2032, 2038, 2040, 2038, 2032,
+    2030, 2032, 2038, 2040, 2036, 2028, 2032, 2038, 2036, 2038, 2034, 2030, 2036, 2040, 2050, 2054,
+    2052, 2042, 2058, 2060, 2068, 2070, 2064, 2060, 2060, 2068, 2076, 2082, 2080, 2078, 2078, 2084,
+    2100, 2108, 2108, 2104, 2108, 2114, 2122, 2130, 2128, 2122, 2120, 2130, 2142, 2152, 2152, 2148,
+    2160, 2166, 2176, 2180, 2172, 2170, 2178, 2180, 2192, 2188, 2182, 2182, 2182, 2188, 2194, 2190,
+    2184, 2176, 2168, 2160, 2160, 2150, 2136, 2122, 2110, 2102, 2100, 2092, 2086, 2074, 2064, 2062,
+    2062, 2056, 2054, 2042, 2034, 2038, 2040, 2038, 2028, 2018, 2016, 2018, 2024, 2026, 2020, 2018,
+    2018, 2022, 2030, 2024, 2020, 2014, 2020, 2026, 2028, 2028, 2022, 2020, 2020, 2026, 2032, 2038,
+    2034, 2032, 2034, 2036, 2040, 2042, 2042, 2036, 2028, 2034, 2038, 2040, 2038, 2038, 2038, 2044,
+    2052, 2050, 2046, 2046, 2040, 2042, 2054, 2050, 2042, 2038, 2040, 2052, 2062, 2070, 2070, 2066,
+    2078, 2088, 2096, 2108, 2108, 2094, 2094, 2090, 2094, 2088, 2082, 2080, 2070, 2082, 2094, 2118,
+    2138, 2158, 2180, 2210, 2246, 2282, 2304, 2322, 2350, 2376, 2412, 2442, 2462, 2488, 2524, 2560,
+    2604, 2646, 2686, 2710, 2712, 2704, 2692, 2672, 2644, 2632, 2628, 2632, 2630, 2616, 2612, 2604,
+    2602, 2596, 2574, 2526, 2464, 2378, 2280, 2192, 2112, 2050, 1998, 1966, 1952, 1952, 1950, 1938,
+    1924, 1902, 1896, 1902, 1898, 1898, 1890, 1876, 1874, 1874, 1880, 1874, 1874, 1868, 1864, 1860,
+    1870, 1866, 1854, 1842, 1836, 1834, 1844, 1842, 1830, 1810, 1806, 1804, 1802, 1794, 1802, 1794,
+    1794, 1796, 1796, 1800, 1790, 1782, 1770, 1774, 1780, 1782, 1778, 1772, 1778, 1790, 1800, 1800,
+    1800, 1798, 1800, 1810, 1822, 1838, 1840, 1852, 1858, 1870, 1882, 1886, 1894, 1906, 1918, 1936,
+    1950, 1964, 1962, 1964, 1970, 1980, 1990, 1998, 2002, 2008, 2004, 2000, 2002, 2004, 1998, 1984,
+    1990, 2002, 2008, 2008, 2004, 2002, 2004, 2014, 2018, 2012, 2004, 1996, 1996, 2004, 2004, 2006,
+    1998, 1984, 1984, 1994, 2008, 2008, 2004, 1998, 2002, 2004, 2010, 2010, 2002, 1998, 2000, 2004,
+    2014, 2016, 2014, 2006, 1996, 2010, 2028, 2034, 2024, 2020, 2018, 2026, 2032, 2032, 2028, 2020,
+    2016, 2016, 2032, 2042, 2052, 2052, 2050, 2050, 2068, 2076, 2084, 2086, 2084, 2088, 2090, 2098,
+    2092, 2082, 2078, 2082, 2086, 2084, 2074, 2058, 2046, 2044, 2040, 2048, 2044, 2028, 2022, 2014,
+    2018, 2022, 2018, 2016, 2014, 2018, 2034, 2038, 2032, 2024, 2028, 2030, 2032, 2034, 2028, 2032,
+    2032, 2032, 2030, 2030, 2036, 2060, 2110, 2192, 2282, 2382, 2480, 2580, 2672, 2734, 2720, 2602,
+    2428, 2252, 2114, 2046, 2040, 2042, 2046, 2044, 2046, 2058, 2072, 2078, 2068, 2048, 2056, 2054,
+    2054, 2052, 2050, 2048, 2050, 2050, 2052, 2054, 2056, 2056, 2056, 2062, 2066, 2066, 2058, 2050,
+    2048, 2054, 2062, 2066, 2066, 2064, 2064, 2062, 2070, 2082, 2076, 2076, 2070, 2078, 2084, 2082,
+    2072, 2072, 2078, 2096, 2116, 2120, 2114, 2112, 2122, 2128, 2132, 2144, 2138, 2138, 2148, 2160,
+    2170, 2174, 2174, 2178, 2178, 2188, 2200, 2210, 2214, 2214, 2214, 2222, 2230, 2230, 2228, 2222,
+    2220, 2214, 2220, 2208, 2202, 2184, 2172, 2172, 2172, 2164, 2146, 2128, 2112, 2110, 2102, 2090,
+    2066, 2058, 2052, 2050, 2052, 2050, 2040, 2032, 2026, 2034, 2034, 2032, 2026, 2020, 2012, 2014,
+    2016, 2018, 2012, 2008, 2006, 2018, 2018, 2014, 2006, 2006, 2006, 2016, 2024, 2024, 2014, 2010,
+    2012, 2014, 2020, 2022, 2022, 2016, 2010, 2022, 2020, 2026, 2022, 2016, 2016, 2018, 2024, 2020,
+    2018, 2014, 2010, 2008, 2016, 2024, 2028, 2030, 2038, 2036, 2046, 2054, 2052, 2040, 2042, 2046,
+    2062, 2072, 2074, 2068, 2068, 2070, 2068, 2076, 2072, 2054, 2046, 2046, 2048, 2040, 2028, 2014,
+    2010, 2004, 2014, 2012, 2006, 2000, 1994, 1998, 2006, 2000, 2004, 1996, 1992, 1998, 2004, 2002,
+    1996, 1990, 1988, 1996, 2008, 2012, 2006, 2004, 2000, 1994, 2030, 2064, 2108, 2164, 2240, 2334,
+    2432, 2528, 2602, 2658, 2646, 2556, 2412, 2262, 2130, 2040, 2008, 2008, 2010, 1998, 1998, 2004,
+    2004, 2008, 2002, 2002, 1996, 1990, 1988, 1992, 1996, 2004, 1994, 1994, 1988, 1996, 2000, 2004,
+    2002, 2000, 1994, 1998, 2006, 2006, 2006, 2000, 1998, 2006, 2012, 2008, 2006, 2004, 2008, 2014,
+    2022, 2024, 2020, 2018, 2022, 2030, 2046, 2048, 2044, 2042, 2042, 2044, 2060, 2076, 2082, 2076,
+    2070, 2074, 2092, 2104, 2104, 2100, 2108, 2114, 2126, 2134, 2134, 2130, 2132, 2136, 2140, 2146,
+    2152, 2154, 2150, 2152, 2158, 2158, 2162, 2156, 2152, 2154, 2160, 2154, 2142, 2126, 2118, 2114,
+    2112, 2102, 2088, 2072, 2062, 2058, 2054, 2050, 2046, 2036, 2024, 2028, 2032, 2028, 2020, 2016,
+    2008, 2006, 2014, 2010, 2000, 1992, 1996, 1998, 2000, 2006, 2004, 2004, 1998, 2002, 2006, 2010,
+    2006, 2004, 2000, 2002, 2008, 2012, 2014, 2014, 2012, 2014, 2024, 2024, 2018, 2016, 2014, 2020,
+    2028, 2032, 2022, 2016, 2014, 2016, 2022, 2024, 2022, 2020, 2022, 2028, 2034, 2032, 2032, 2026,
+    2030, 2038, 2044, 2040, 2048, 2040, 2038, 2046, 2060, 2070, 2078, 2078, 2080, 2076, 2078, 2088,
+    2080, 2074, 2068, 2060, 2064, 2054, 2046, 2034, 2024, 2020, 2024, 2012, 2018, 2010, 2008, 2022,
+    2040, 2054, 2066, 2074, 2092, 2122, 2156, 2180, 2218, 2248, 2274, 2302, 2330, 2356, 2376, 2396,
+    2422, 2450, 2478, 2498, 2524, 2566, 2616, 2668, 2716, 2746, 2768, 2788, 2806, 2822, 2796, 2700,
+    2550, 2398, 2258, 2158, 2078, 2022, 1984, 1956, 1942, 1942, 1944, 1936, 1920, 1902, 1890, 1882,
+    1888, 1888, 1888, 1878, 1870, 1868, 1868, 1866, 1858, 1856, 1856, 1864, 1870, 1870, 1860, 1844,
+    1838, 1840, 1850, 1852, 1842, 1834, 1816, 1824, 1828, 1832, 1840, 1832, 1832, 1826, 1818, 1812,
+    1810, 1806, 1802, 1802, 1798, 1800, 1802, 1804, 1804, 1816, 1822, 1824, 1816, 1820, 1820, 1830,
+    1840, 1842, 1838, 1828, 1830, 1842, 1864, 1880, 1892, 1890, 1894, 1896, 1918, 1940, 1940, 1942,
+    1944, 1954, 1952, 1956, 1954, 1954, 1958, 1960, 1964, 1964, 1966, 1956, 1954, 1956, 1966, 1968,
+    1952, 1940, 1932, 1936, 1950, 1958, 1972, 1968, 1964, 1956, 1956, 1950, 1946, 1940, 1938, 1938,
+    1948, 1948, 1950, 1946, 1946, 1944, 1946, 1948, 1948, 1950, 1948, 1958, 1952, 1948, 1950, 1944,
+    1950, 1948, 1962, 1960, 1952, 1948, 1950, 1956, 1968, 1966, 1976, 1974, 1974, 1982, 1982, 1990,
+    1992, 1994, 1998, 2012, 2014, 2020, 2022, 2014, 2010, 2014, 2014, 2010, 1998, 1988, 1974, 1974,
+    1966, 1968, 1962, 1956, 1956, 1958, 1962, 1964, 1958, 1950, 1946, 1946, 1952, 1956, 1952, 1946,
+    1940, 1950, 1966, 1970, 1970, 1964, 1964, 1962, 1960, 1960, 1956, 1940, 1938, 1958, 2010, 2082,
+    2168, 2270, 2380, 2482, 2576, 2648, 2648, 2526, 2340, 2140, 2006, 1946, 1942, 1950, 1950, 1958,
+    1978, 1988, 1996, 1984, 1970, 1964, 1972, 1980, 1978, 1968, 1962, 1956, 1958, 1958, 1970, 1968,
+    1974, 1978, 1976, 1976, 1976, 1976, 1980, 1980, 1986, 1988, 1984, 1976, 1978, 1986, 1994, 1996,
+    1998, 1992, 1992, 2004, 2008, 2018, 2016, 2014, 2012, 2018, 2032, 2030, 2032, 2030, 2028, 2040,
+    2048, 2054, 2066, 2066, 2072, 2084, 2088, 2100, 2096, 2096, 2100, 2108, 2120, 2126, 2126, 2128,
+    2130, 2138, 2150, 2150, 2150, 2144, 2140, 2144, 2144, 2136, 2130, 2110, 2100, 2096, 2096, 2100,
+    2082, 2068, 2056, 2048, 2044, 2042, 2032, 2020, 2010, 2012, 2006, 2002, 1998, 1996, 1992, 1986,
+    1988, 1990, 1982, 1972, 1960, 1968, 1982, 1990, 1988, 1986, 1982, 1980, 1982, 1988, 1984, 1980,
+    1976, 1980, 1982, 1982, 1988, 1984, 1984, 1982, 1980, 1988, 1990, 1982, 1984, 1984, 1986, 1990,
+    1988, 1986, 1988, 1990, 2002, 2006, 2008, 2010, 2012, 2020, 2026, 2038, 2042, 2044, 2036, 2038,
+    2044, 2042, 2042, 2028, 2018, 2008, 2004, 1996, 1986, 1976, 1970, 1974, 1980, 1982, 1972, 1964,
+    1960, 1960, 1968, 1974, 1972, 1964, 1962, 1966, 1980, 1984, 1978, 1972, 1974, 1966, 1968, 1970,
+    1990, 2040, 2106, 2200, 2308, 2414, 2510, 2594, 2642, 2604, 2464, 2270, 2090, 1958, 1906, 1910,
+    1932, 1950, 1954, 1946, 1946, 1958, 1962, 1960, 1956, 1950, 1940, 1940, 1942, 1940, 1946, 1942,
+    1940, 1950, 1954, 1954, 1956, 1944, 1940, 1950, 1950, 1954, 1958, 1956, 1952, 1956, 1964, 1974,
+    1972, 1966, 1962, 1966, 1978, 1986, 1986, 1982, 1980, 1980, 1994, 1998, 2006, 2004, 2004, 2016,
+    2032, 2042, 2040, 2030, 2038, 2044, 2050, 2062, 2070, 2064, 2062, 2070, 2080, 2090, 2102, 2100,
+    2102, 2104, 2102, 2106, 2090, 2092, 2090, 2086, 2080, 2076, 2066, 2060, 2056, 2046, 2030, 2028,
+    2016, 2008, 2000, 2000, 1998, 1992, 1988, 1980, 1972, 1968, 1966, 1972, 1968, 1958, 1952, 1954,
+    1962, 1968, 1970, 1966, 1956, 1958, 1964, 1962, 1958, 1958, 1958, 1960, 1962, 1974, 1978, 1972,
+    1958, 1960, 1970, 1974, 1970, 1966, 1962, 1970, 1980, 1978, 1972, 1968, 1970, 1976, 1978, 1972,
+    1970, 1966, 1962, 1960, 1954, 1966, 1966, 1968, 1966, 1976, 1984, 1994, 2002, 2004, 2002, 2000,
+    2008, 2014, 2018, 2026, 2030, 2036, 2038, 2042, 2040, 2044, 2042, 2040, 2042, 2044, 2028, 2010,
+    1992, 1998, 2000, 1994, 1992, 1976, 1964, 1968, 1974, 1976, 1964, 1960, 1948, 1952, 1966, 1966,
+    1968, 1960, 1958, 1958, 1968, 1968, 1964, 1962, 1976, 1990, 2012, 2038, 2062, 2086, 2118, 2156,
+    2216, 2274, 2340, 2408, 2498, 2604, 2718, 2824, 2906, 2952, 2934, 2828, 2658, 2476, 2290, 2138,
+    2062, 2034, 2020, 2002, 1988, 1982, 1982, 1986, 1974, 1964, 1952, 1942, 1932, 1940, 1942, 1948,
+    1950, 1942, 1934, 1944, 1948, 1946, 1940, 1942, 1940, 1946, 1950, 1950, 1952, 1952, 1950, 1950,
+    1946, 1944, 1944, 1932, 1922, 1934, 1940, 1942, 1944, 1946, 1942, 1952, 1960, 1954, 1958, 1950,
+    1948, 1948, 1944, 1942, 1938, 1936, 1944, 1948, 1958, 1960, 1966, 1968, 1980, 1994, 2006, 2006,
+    2000, 2000, 2000, 1998, 2004, 2010, 2024, 2028, 2028, 2030, 2028, 2032, 2040, 2042, 2046, 2038,
+    2036, 2038, 2032, 2024, 2010, 2004, 2004, 1992, 1994, 1984, 1980, 1984, 1986, 1996, 1996, 1986,
+    1976, 1970, 1970, 1968, 1974, 1970, 1964, 1962, 1970, 1972, 1968, 1962, 1962, 1972, 1978, 1986,
+    1982, 1970, 1956, 1950, 1954, 1966, 1968, 1966, 1968, 1968, 1980, 1978, 1976, 1970, 1972, 1972,
+    1978, 1986, 1988, 1982, 1982, 1974, 1972, 1970, 1976, 1984, 1980, 1984, 1992, 2002, 2002, 1988,
+    1986, 1988, 1990, 1992, 1998, 1994, 1986, 1998, 2014, 2032, 2038, 2044, 2054, 2078, 2108, 2138,
+    2158, 2178, 2196, 2226, 2258, 2298, 2330, 2350, 2378, 2414, 2454, 2494, 2532, 2566, 2594, 2626,
+    2662, 2688, 2696, 2684, 2658, 2618, 2580, 2546, 2520, 2494, 2474, 2452, 2438, 2428, 2412, 2402,
+    2388, 2382, 2382, 2388, 2392, 2394, 2386, 2370, 2346, 2312, 2258, 2182, 2098, 2020, 1956, 1914,
+    1886, 1860, 1846, 1840, 1840, 1834, 1826, 1806, 1788, 1792, 1784, 1776, 1776, 1776, 1774, 1770,
+    1776, 1768, 1770, 1758, 1746, 1748, 1746, 1748, 1734, 1714, 1706, 1710, 1718, 1720, 1706, 1694,
+    1684, 1680, 1690, 1692, 1684, 1672, 1660, 1662, 1660, 1660, 1652, 1636, 1632, 1630, 1628, 1624,
+    1620, 1612, 1614, 1626, 1642, 1652, 1648, 1646, 1650, 1656, 1662, 1674, 1688, 1700, 1704, 1720,
+    1732, 1750, 1762, 1772, 1784, 1798, 1822, 1840, 1848, 1852, 1862, 1874, 1884, 1890, 1896, 1898,
+    1900, 1904, 1914, 1920, 1924, 1920, 1912, 1914, 1918, 1926, 1926, 1922, 1924, 1916, 1920, 1922,
+    1922, 1916, 1910, 1910, 1912, 1914, 1918, 1912, 1908, 1908, 1912, 1930, 1940, 1934, 1914, 1914,
+    1918, 1928, 1932, 1924, 1922, 1924, 1936, 1942, 1938, 1932, 1926, 1934, 1940, 1954, 1950, 1946,
+    1936, 1930, 1940, 1946, 1942, 1934, 1932, 1948, 1956, 1966, 1962, 1956, 1944, 1952, 1960, 1962,
+    1962, 1952, 1948, 1944, 1954, 1960, 1960, 1956, 1956, 1954, 1954, 1964, 1966, 1960, 1952, 1954,
+    1962, 1958, 1956, 1952, 1952, 1954, 1960, 1968, 1962, 1956, 1956, 1964, 1972, 1972, 1976, 1962,
+    1948, 1948, 1956, 1962, 1964, 1964, 1962, 1964, 1968, 1966, 1964, 1960, 1956, 1964, 1974, 1976,
+    1972, 1962, 1954, 1956, 1962, 1966, 1968, 1960, 1954, 1954, 1962, 1972, 1966, 1966, 1964, 1970,
+    1980, 1986, 1976, 1968, 1970, 1982, 1992, 1998, 1996, 2002, 2010, 2026, 2036, 2036, 2038, 2032,
+    2026, 2020, 2020, 2010, 2010, 1998, 1994, 1990, 1998, 1998, 1990, 1982, 1980, 1978, 1982, 1978,
+    1966, 1960, 1960, 1962, 1972, 1976, 1972, 1962, 1956, 1962, 1966, 1966, 1974, 1968, 1970, 1974,
+    1978, 1980, 1974, 1966, 1970, 1986, 2036, 2102, 2186, 2286, 2386, 2484, 2594, 2692, 2758, 2738,
+    2622, 2468, 2294, 2138, 2022, 1968, 1962, 1976, 1974, 1968, 1966, 1970, 1974, 1982, 1978, 1974,
+    1968, 1958, 1950, 1954, 1956, 1964, 1964, 1960, 1956, 1958, 1960, 1970, 1974, 1968, 1962, 1968,
+    1972, 1978, 1972, 1968, 1972, 1974, 1974, 1980, 1982, 1974, 1976, 1982, 1994, 2002, 2004, 2002,
+    2000, 2002, 2008, 2014, 2006, 2006, 2008, 2018, 2022, 2034, 2036, 2036, 2030, 2042, 2060, 2070,
+    2076, 2076, 2078, 2086, 2088, 2098, 2110, 2114, 2122, 2130, 2134, 2146, 2146, 2152, 2148, 2164,
+    2172, 2180, 2182, 2176, 2172, 2176, 2176, 2182, 2178, 2170, 2162, 2156, 2154, 2148, 2138, 2122,
+    2112, 2104, 2104, 2094, 2080, 2058, 2044, 2036, 2030, 2032, 2026, 2016, 2012, 2002, 2006, 1998,
+    1994, 1996, 1994, 1990, 1990, 1988, 1978, 1974, 1976, 1974, 1976, 1982, 1982, 1980, 1974, 1974,
+    1980, 1990, 1986, 1984, 1978, 1982, 1986, 1996, 1992, 1980, 1974, 1974, 1986, 1988, 1984, 1988,
+    1988, 1988, 1994, 1998, 1994, 1986, 1984, 1984, 1988, 1988, 1986, 1982, 1980, 1984, 1990, 1990,
+    1998, 1988, 1990, 1990, 1990, 2000, 1992, 1990, 1980, 1982, 1988, 1990, 1992, 1988, 1984, 1984,
+    1994, 2002, 2010, 2006, 2006, 2012, 2034, 2060, 2082, 2096, 2108, 2130, 2162, 2204, 2250, 2280,
+    2316, 2350, 2374, 2396, 2420, 2450, 2482, 2520, 2562, 2590, 2614, 2630, 2644, 2662, 2660, 2642,
+    2612, 2564, 2530, 2504, 2492, 2486, 2470, 2442, 2422, 2414, 2414, 2404, 2398, 2382, 2390, 2396,
+    2398, 2384, 2354, 2298, 2230, 2154, 2072, 2006, 1952, 1902, 1870, 1862, 1862, 1856, 1846, 1838,
+    1822, 1824, 1818, 1816, 1816, 1808, 1796, 1796, 1798, 1798, 1792, 1778, 1770, 1770, 1774, 1772,
+    1762, 1752, 1750, 1750, 1750, 1748, 1740, 1728, 1712, 1712, 1710, 1706, 1708, 1698, 1688, 1686,
+    1690, 1692, 1686, 1678, 1670, 1674, 1676, 1680, 1678, 1674, 1672, 1674, 1678, 1688, 1696, 1700,
+    1706, 1710, 1722, 1742, 1754, 1760, 1766, 1780, 1800, 1812, 1822, 1826, 1838, 1856, 1872, 1884,
+    1892, 1902, 1906, 1914, 1926, 1938, 1938, 1940, 1934, 1936, 1942, 1944, 1944, 1932, 1934, 1932,
+    1942, 1950, 1950, 1942, 1936, 1938, 1946, 1946, 1946, 1938, 1936, 1934, 1934, 1944, 1946, 1934,
+    1928, 1930, 1938, 1946, 1944, 1944, 1942, 1946, 1946, 1950, 1952, 1948, 1942, 1942, 1946, 1954,
+    1958, 1954, 1956, 1954, 1960, 1964, 1964, 1958, 1952, 1954, 1952, 1964, 1964, 1958, 1954, 1952,
+    1956, 1968, 1966, 1964, 1952, 1956, 1962, 1972, 1974, 1966, 1958, 1958, 1962, 1964, 1970, 1962,
+    1962, 1962, 1964, 1966, 1968, 1964, 1968, 1964, 1970, 1976, 1976, 1968, 1964, 1968, 1970, 1970,
+    1976, 1966, 1962, 1968, 1970, 1974, 1986, 1984, 1976, 1976, 1980, 1980, 1976, 1970, 1970, 1964,
+    1976, 1976, 1978, 1976, 1976, 1984, 1992, 1994, 1992, 1986, 1984, 1988, 1990, 2004, 2018, 2016,
+    2010, 2014, 2016, 2030, 2032, 2038, 2038, 2042, 2046, 2050, 2042, 2040, 2034, 2024, 2016, 2012,
+    2010, 1998, 1990, 1988, 1990, 1994, 1996, 1988, 1982, 1986, 1986, 1992, 1984, 1982, 1978, 1976,
+    1978, 1982, 1986, 1980, 1978, 1980, 1982, 1992, 1994, 1990, 1978, 1982, 1978, 1980, 1986, 2006,
+    2048, 2110, 2198, 2302, 2410, 2502, 2588, 2658, 2668, 2586, 2432, 2254, 2104, 2014, 1988, 1990,
+    1992, 1984, 1974, 1976, 1988, 1998, 2000, 1986, 1978, 1976, 1984, 1984, 1982, 1976, 1974, 1968,
+    1970, 1972, 1974, 1970, 1966, 1970, 1978, 1984, 1982, 1984, 1980, 1986, 1990, 1994, 1992, 1986,
+    1984, 1984, 1988, 1992, 1992, 1990, 1982, 1986, 1996, 2012, 2012, 2020, 2022, 2020, 2022, 2032,
+    2038, 2028, 2026, 2030, 2038, 2050, 2056, 2062, 2064, 2064, 2082, 2098, 2100, 2100, 2100, 2102,
+    2116, 2130, 2136, 2130, 2136, 2142, 2150, 2158, 2166, 2166, 2168, 2166, 2166, 2166, 2170, 2160,
+    2152, 2144, 2138, 2138, 2134, 2116, 2104, 2094, 2092, 2082, 2078, 2068, 2054, 2048, 2040, 2036,
+    2034, 2028, 2022, 2014, 2012, 2012, 2008, 1996, 1996, 1998, 1998, 2008, 2004, 1998, 1986, 1984,
+    1986, 1992, 1994, 1990, 1980, 1986, 1994, 1998, 2004, 1998, 1994, 1992, 2000, 2006, 1998, 1994,
+    1990, 1992, 1994, 2000, 1998, 1994, 1990, 1986, 2002, 2006, 2010, 1998, 1988, 1986, 1986, 1994,
+    1998, 1986, 1982, 1986, 1994, 2002, 2006, 2002, 2002, 2000, 2002, 2006, 2002, 1996, 1992, 1994,
+    2002, 2018, 2026, 2024, 2016, 2022, 2032, 2048, 2050, 2050, 2052, 2052, 2060, 2062, 2060, 2048,
+    2032, 2020, 2010, 2006, 2006, 2000, 1996, 1998, 1996, 1992, 1994, 1988, 1982, 1984, 1986, 1986,
+    1994, 1988, 1980, 1986, 1990, 1996, 1992, 1992, 1990, 1992, 1994, 2002, 1994, 1978, 1972, 1994,
+    2038, 2098, 2172, 2266, 2380, 2486, 2566, 2644, 2658, 2580, 2422, 2230, 2068, 1958, 1926, 1934,
+    1944, 1954, 1966, 1980, 1994, 2006, 2006, 2002, 2000, 2008, 1996, 1984, 1976, 1982, 1992, 2004,
+    2010, 2006, 2002, 2010, 2020, 2036, 2036, 2032, 2028, 2022, 2038, 2050, 2058, 2058, 2062, 2068,
+    2074, 2078, 2074, 2074, 2076, 2074, 2090, 2106, 2110, 2106, 2100, 2106, 2110, 2122, 2126, 2116,
+    2112, 2114, 2122, 2136, 2140, 2138, 2140, 2154, 2160, 2170, 2178, 2170, 2170, 2172, 2186, 2196,
+    2206, 2214, 2210, 2214, 2222, 2224, 2224, 2216, 2216, 2216, 2220, 2220, 2210, 2192, 2174, 2166,
+    2162, 2160, 2148, 2130, 2116, 2100, 2092, 2094, 2086, 2074, 2060, 2044, 2040, 2038, 2034, 2016,
+    2016, 2010, 2016, 2016, 2014, 2010, 2002, 1996, 1996, 2000, 2000, 1990, 1984, 1980, 1980, 1982,
+    1974, 1970, 1968, 1970, 1972, 1984, 1998, 2006, 2018, 2024, 2030, 2032, 2024, 2020, 2016, 2016,
+    2022, 2024, 2022, 2020, 2014, 2014, 2018, 2018, 2020, 2016, 2008, 2002, 2006, 2010, 2010, 2006,
+    2004, 2006, 2008, 2016, 2024, 2012, 2004, 2008, 2010, 2016, 2022, 2020, 2022, 2028, 2042, 2060,
+    2070, 2064, 2064, 2066, 2072, 2086, 2088, 2082, 2074, 2062, 2064, 2074, 2080, 2074, 2072, 2092,
+    2114, 2154, 2198, 2236, 2260, 2282, 2310, 2350, 2390, 2422, 2454, 2482, 2506, 2532, 2562, 2592,
+    2612, 2626, 2620, 2600, 2566, 2530, 2500, 2476, 2462, 2448, 2434, 2416, 2400, 2396, 2398, 2406,
+    2418, 2418, 2406, 2380, 2354, 2310, 2224, 2126, 2024, 1956, 1922, 1912, 1904, 1888, 1876, 1866,
+    1864, 1864, 1854, 1852, 1842, 1836, 1840, 1840, 1826, 1816, 1806, 1810, 1814, 1812, 1806, 1798,
+    1794, 1794, 1794, 1796, 1798, 1782, 1770, 1762, 1758, 1756, 1760, 1750, 1744, 1736, 1742, 1748,
+    1744, 1732, 1726, 1726, 1724, 1726, 1726, 1720, 1714, 1716, 1716, 1730, 1734, 1734, 1728, 1742,
+    1754, 1768, 1772, 1778, 1780, 1782, 1794, 1818, 1836, 1850, 1860, 1868, 1886, 1900, 1916, 1918,
+    1928, 1932, 1950, 1962, 1958, 1952, 1944, 1948, 1956, 1954, 1962, 1954, 1954, 1948, 1958, 1960,
+    1960, 1950, 1948, 1946, 1948, 1952, 1950, 1942, 1936, 1934, 1936, 1940, 1942, 1932, 1936, 1934,
+    1938, 1942, 1938, 1938, 1932, 1928, 1932, 1934, 1932, 1934, 1936, 1940, 1944, 1954, 1950, 1944,
+    1940, 1944, 1948, 1950, 1948, 1942, 1940, 1940, 1946, 1954, 1958, 1950, 1942, 1932, 1944, 1944,
+    1948, 1936, 1940, 1936, 1936, 1936, 1934, 1932, 1934, 1940, 1948, 1952, 1962, 1964, 1960, 1966,
+    1970, 1972, 1976, 1984, 1982, 1992, 1998, 2010, 2014, 2002, 1992, 1994, 2004, 2012, 2006, 1980,
+    1958, 1948, 1950, 1960, 1958, 1950, 1938, 1938, 1950, 1956, 1956, 1948, 1938, 1944, 1956, 1962,
+    1958, 1946, 1936, 1930, 1932, 1940, 1938, 1934, 1932, 1936, 1938, 1950, 1956, 1972, 2000, 2048,
+    2120, 2222, 2314, 2398, 2474, 2550, 2588, 2536, 2388, 2208, 2048, 1960, 1942, 1952, 1956, 1936,
+    1924, 1934, 1954, 1964, 1954, 1956, 1952, 1942, 1946, 1948, 1942, 1928, 1912, 1902, 1910, 1920,
+    1928, 1922, 1924, 1924, 1924, 1930, 1932, 1942, 1942, 1940, 1940, 1952, 1960, 1952, 1944, 1944,
+    1946, 1954, 1954, 1950, 1940, 1944, 1956, 1970, 1976, 1978, 1974, 1982, 1986, 1992, 1994, 1990,
+    1986, 1988, 1996, 2012, 2022, 2028, 2028, 2032, 2040, 2054, 2062, 2064, 2068, 2064, 2070, 2086,
+    2096, 2092, 2096, 2100, 2116, 2136, 2140, 2136, 2126, 2116, 2112, 2116, 2104, 2082, 2062, 2062,
+    2060, 2048, 2042, 2024, 2014, 2014, 2000, 1992, 1986, 1970, 1968, 1968, 1970, 1966, 1960, 1950,
+    1938, 1930, 1928, 1914, 1908, 1912, 1916, 1918, 1924, 1926, 1916, 1914, 1906, 1910, 1914, 1924,
+    1926, 1918, 1912, 1910, 1922, 1930, 1932, 1928, 1920, 1920, 1928, 1928, 1932, 1922, 1918, 1912,
+    1912, 1922, 1928, 1922, 1920, 1926, 1936, 1946, 1946, 1940, 1922, 1922, 1924, 1930, 1930, 1932,
+    1940, 1948, 1962, 1964, 1958, 1946, 1938, 1954, 1968, 1984, 1988, 1988, 1980, 1976, 1976, 1974,
+    1972, 1964, 1960, 1956, 1946, 1944, 1938, 1932, 1928, 1928, 1934, 1930, 1926, 1912, 1910, 1904,
+    1908, 1924, 1922, 1922, 1918, 1916, 1924, 1932, 1938, 1920, 1912, 1910, 1904, 1908, 1916, 1920,
+    1912, 1908, 1926, 1966, 2018, 2074, 2146, 2236, 2340, 2450, 2536, 2592, 2554, 2430, 2268, 2124,
+    2014, 1956, 1938, 1932, 1918, 1922, 1932, 1944, 1948, 1940, 1934, 1932, 1928, 1922, 1908, 1898,
+    1894, 1888, 1900, 1910, 1918, 1918, 1918, 1920, 1904, 1900, 1896, 1904, 1916, 1922, 1920, 1914,
+    1908, 1914, 1922, 1926, 1920, 1914, 1914, 1920, 1932, 1942, 1940, 1934, 1924, 1924, 1930, 1944,
+    1952, 1952, 1950, 1954, 1964, 1972, 1976, 1980, 1984, 2000, 2008, 2024, 2022, 2010, 2006, 2012,
+    2032, 2048, 2056, 2050, 2042, 2054, 2070, 2080, 2076, 2060, 2044, 2042, 2052, 2056, 2044, 2028,
+    2010, 1996, 1998, 1996, 1992, 1980, 1974, 1964, 1962, 1952, 1950, 1934, 1926, 1920, 1918, 1918,
+    1916, 1914, 1912, 1914, 1922, 1928, 1924, 1914, 1910, 1918, 1926, 1928, 1928, 1910, 1906, 1906,
+    1918, 1938, 1948, 1950, 1946, 1930, 1926, 1926, 1926, 1930, 1930, 1930, 1938, 1942, 1942, 1936,
+    1932, 1932, 1946, 1958, 1958, 1948, 1938, 1934, 1942, 1946, 1950, 1942, 1944, 1940, 1946, 1942,
+    1938, 1932, 1932, 1938, 1950, 1960, 1970, 1970, 1970, 1972, 1976, 1984, 1990, 1984, 1984, 1988,
+    1998, 2006, 2016, 2012, 2002, 1992, 1984, 1978, 1970, 1958, 1948, 1960, 1984, 2008, 2026, 2038,
+    2054, 2074, 2104, 2146, 2188, 2210, 2234, 2250, 2278, 2304, 2330, 2346, 2370, 2392, 2424, 2470,
+    2508, 2526, 2536, 2538, 2526, 2508, 2506, 2500, 2510, 2522, 2534, 2544, 2538, 2528, 2538, 2550,
+    2548, 2506, 2424, 2322, 2218, 2134, 2048, 1986, 1932, 1888, 1848, 1828, 1828, 1836, 1836, 1822,
+    1804, 1792, 1792, 1800, 1804, 1796, 1780, 1776, 1772, 1774, 1780, 1776, 1766, 1756, 1758, 1760,
+    1764, 1762, 1754, 1750, 1748, 1750, 1740, 1722, 1710, 1700, 1702, 1712, 1714, 1704, 1696, 1698,
+    1706, 1718, 1714, 1704, 1688, 1688, 1688, 1690, 1692, 1690, 1684, 1674, 1678, 1684, 1694, 1700,
+    1704, 1716, 1728, 1734, 1740, 1728, 1724, 1730, 1746, 1766, 1780, 1782, 1792, 1802, 1812, 1828,
+    1842, 1850, 1852, 1862, 1870, 1882, 1888, 1884, 1878, 1878, 1886, 1882, 1882, 1874, 1880, 1878,
+    1886, 1896, 1900, 1880, 1878, 1876, 1882, 1886, 1884, 1880, 1874, 1874, 1878, 1886, 1888, 1886,
+    1880, 1880, 1890, 1898, 1896, 1888, 1880, 1880, 1884, 1894, 1886, 1886, 1888, 1888, 1890, 1894,
+    1908, 1906, 1906, 1904, 1904, 1906, 1910, 1910, 1908, 1914, 1908, 1908, 1898, 1898, 1904, 1914,
+    1916, 1912, 1906, 1906, 1904, 1908, 1916, 1924, 1922, 1926, 1926, 1924, 1932, 1942, 1952, 1958,
+    1962, 1968, 1972, 1982, 1984, 1976, 1960, 1946, 1948, 1960, 1962, 1946, 1934, 1924, 1928, 1932,
+    1938, 1936, 1932, 1928, 1914, 1904, 1898, 1898, 1900, 1908, 1914, 1918, 1922, 1926, 1920, 1914,
+    1912, 1916, 1918, 1912, 1908, 1908, 1912, 1924, 1926, 1918, 1896, 1888, 1896, 1936, 1988, 2052,
+    2124, 2216, 2326, 2424, 2510, 2570, 2588, 2522, 2386, 2226, 2084, 1966, 1908, 1894, 1900, 1914,
+    1920, 1924, 1930, 1938, 1946, 1944, 1944, 1936, 1926, 1920, 1928, 1938, 1944, 1934, 1918, 1900,
+    1910, 1918, 1930, 1934, 1926, 1930, 1936, 1948, 1952, 1946, 1940, 1940, 1940, 1948, 1952, 1950,
+    1954, 1948, 1950, 1958, 1962, 1960, 1960, 1958, 1960, 1966, 1970, 1968, 1962, 1968, 1978, 1986,
+    1994, 1998, 1996, 1996, 1996, 2010, 2026, 2030, 2032, 2034, 2042, 2050, 2058, 2054, 2048, 2046,
+    2058, 2076, 2084, 2086, 2082, 2082, 2084, 2100, 2110, 2110, 2102, 2100, 2110, 2114, 2114, 2104,
+    2096, 2094, 2092, 2096, 2086, 2074, 2052, 2038, 2040, 2044, 2032, 2016, 2002, 1988, 1974, 1978,
+    1974, 1964, 1954, 1950, 1950, 1950, 1950, 1942, 1940, 1940, 1948, 1948, 1948, 1938, 1926, 1926,
+    1924, 1932, 1936, 1938, 1940, 1942, 1944, 1936, 1944, 1936, 1934, 1934, 1940, 1946, 1950, 1948,
+    1938, 1940, 1942, 1950, 1942, 1944, 1940, 1936, 1942, 1948, 1956, 1958, 1964, 1966, 1972, 1974,
+    1976, 1978, 1988, 1996, 2004, 2016, 2014, 2008, 2006, 2004, 2010, 2010, 2010, 1994, 1992, 1980,
+    1972, 1960, 1956, 1950, 1946, 1948, 1944, 1948, 1944, 1950, 1944, 1940, 1942, 1942, 1940, 1930,
+    1916, 1916, 1926, 1936, 1940, 1936, 1930, 1928, 1942, 1948, 1944, 1928, 1916, 1924, 1958, 2008,
+    2070, 2142, 2244, 2358, 2482, 2588, 2644, 2604, 2456, 2258, 2070, 1940, 1894, 1896, 1902, 1908,
+    1912, 1926, 1940, 1944, 1934, 1924, 1926, 1936, 1940, 1934, 1926, 1918, 1922, 1926, 1928, 1932,
+    1928, 1926, 1930, 1940, 1936, 1934, 1934, 1934, 1938, 1948, 1946, 1942, 1938, 1932, 1938, 1948,
+    1950, 1948, 1946, 1948, 1958, 1968, 1974, 1976, 1976, 1976, 1980, 1986, 1986, 1990, 1982, 1990,
+    1998, 2008, 2006, 2006, 2008, 2016, 2024, 2030, 2030, 2034, 2024, 2028, 2044, 2056, 2062, 2060,
+    2052, 2056, 2068, 2076, 2080, 2076, 2070, 2072, 2080, 2086, 2086, 2078, 2064, 2056, 2050, 2046,
+    2042, 2034, 2022, 2016, 2010, 2004, 2004, 1994, 1986, 1978, 1980, 1974, 1976, 1962, 1950, 1940,
+    1942, 1946, 1944, 1942, 1938, 1936, 1938, 1938, 1940, 1940, 1936, 1936, 1942, 1944, 1946, 1936,
+    1926, 1928, 1936, 1942, 1942, 1944, 1944, 1936, 1944, 1954, 1960, 1952, 1950, 1950, 1954, 1958,
+    1962, 1956, 1944, 1948, 1950, 1954, 1954, 1956, 1952, 1958, 1960, 1972, 1972, 1980, 1980, 1980,
+    1984, 1992, 1996, 1994, 1998, 1998, 2004, 2010, 2018, 2018, 2012, 2010, 2016, 2018, 2016, 2008,
+    1994, 1988, 1980, 1974, 1968, 1962, 1948, 1946, 1946, 1950, 1946, 1946, 1934, 1934, 1944, 1948,
+    1946, 1938, 1932, 1930, 1932, 1936, 1938, 1942, 1944, 1946, 1956, 1962, 1958, 1956, 1958, 1968,
+    1992, 2034, 2098, 2180, 2280, 2382, 2486, 2604, 2706, 2790, 2844, 2866, 2800, 2652, 2462, 2272,
+    2114, 2028, 1998, 1986, 1966, 1948, 1944, 1942, 1940, 1938, 1934, 1930, 1920, 1914, 1920, 1922,
+    1924, 1920, 1916, 1914, 1916, 1918, 1916, 1910, 1906, 1906, 1908, 1920, 1924, 1920, 1918, 1922,
+    1926, 1932, 1928, 1924, 1920, 1918, 1922, 1934, 1936, 1938, 1932, 1924, 1934, 1940, 1944, 1940,
+    1938, 1936, 1948, 1950, 1958, 1952, 1952, 1946, 1952, 1960, 1972, 1970, 1966, 1978, 1984, 1994,
+    2008, 2002, 1996, 1996, 2002, 2006, 2008, 2014, 2010, 2016, 2028, 2038, 2042, 2040, 2032, 2030,
+    2030, 2032, 2030, 2022, 2002, 1992, 1992, 1998, 1998, 1990, 1982, 1966, 1958, 1954, 1958, 1960,
+    1956, 1950, 1954, 1958, 1960, 1948, 1938, 1930, 1942, 1942, 1952, 1954, 1950, 1950, 1952, 1950,
+    1946, 1940, 1934, 1936, 1940, 1942, 1948, 1944, 1940, 1940, 1942, 1952, 1960, 1954, 1956, 1956,
+    1962, 1970, 1970, 1968, 1962, 1948, 1952, 1958, 1962, 1958, 1946, 1948, 1966, 1976, 1984, 1984,
+    1980, 1988, 1994, 1998, 2002, 1996, 2000, 2002, 2008, 2020, 2024, 2022, 2018, 2014, 2020, 2028,
+    2026, 2016, 2010, 2004, 1998, 1998, 1984, 1976, 1964, 1956, 1954, 1964, 1968, 1960, 1950, 1942,
+    1946, 1954, 1958, 1962, 1958, 1948, 1948, 1942, 1950, 1948, 1942, 1942, 1952, 1968, 1972, 1970,
+    1968, 1960, 1958, 1964, 1970, 1980, 2022, 2082, 2176, 2284, 2390, 2480, 2560, 2644, 2688, 2662,
+    2544, 2382, 2216, 2080, 2002, 1976, 1980, 1968, 1948, 1936, 1956, 1974, 1974, 1966, 1952, 1944,
+    1948, 1954, 1960, 1964, 1948, 1944, 1932, 1938, 1940, 1940, 1936, 1938, 1942, 1958, 1960, 1958,
+    1946, 1944, 1948, 1954, 1958, 1964, 1954, 1956, 1962, 1966, 1970, 1974, 1962, 1966, 1974, 1984,
+    1998, 2002, 2002, 2002, 2006, 2012, 2010, 2006, 1994, 1994, 2010, 2024, 2026, 2032, 2034, 2040,
+    2048, 2054, 2056, 2064, 2066, 2068, 2076, 2088, 2096, 2094, 2090, 2094, 2100, 2112, 2124, 2130,
+    2128, 2124, 2118, 2126, 2124, 2114, 2100, 2088, 2082, 2082, 2074, 2060, 2046, 2026, 2020, 2016,
+    2012, 2006, 1994, 1988, 1986, 1988, 1980, 1974, 1962, 1960, 1960, 1964, 1962, 1962, 1960, 1956,
+    1960, 1960, 1972, 1968, 1956, 1946, 1956, 1958, 1964, 1964, 1962, 1952, 1956, 1968, 1978, 1982,
+    1980, 1974, 1970, 1968, 1962, 1958, 1960, 1962, 1970, 1976, 1974, 1968, 1952, 1952, 1962, 1972,
+    1972, 1974, 1966, 1966, 1964, 1974, 1978, 1978, 1970, 1966, 1970, 1982, 1994, 1998, 1996, 2008,
+    2006, 2006, 2008, 2006, 2002, 2010, 2018, 2022, 2020, 2018, 2010, 2000, 2004, 2000, 1992, 1992,
+    1984, 1976, 1972, 1962, 1950, 1948, 1944, 1944, 1944, 1950, 1940, 1936, 1932, 1930, 1948, 1954,
+    1960, 1960, 1952, 1948, 1946, 1954, 1960, 1962, 1960, 1950, 1958, 1982, 2022, 2092, 2176, 2280,
+    2384, 2488, 2588, 2654, 2656, 2560, 2394, 2220, 2080, 2000, 1976, 1974, 1970, 1958, 1958, 1964,
+    1970, 1964, 1954, 1950, 1950, 1944, 1948, 1946, 1948, 1954, 1956, 1950, 1944, 1946, 1946, 1948,
+    1942, 1950, 1944, 1940, 1944, 1948, 1954, 1954, 1948, 1952, 1956, 1964, 1964, 1970, 1976, 1974,
+    1972, 1976, 1978, 1978, 1978, 1982, 1990, 2004, 2004, 2006, 2002, 2000, 2008, 2024, 2034, 2034,
+    2028, 2028, 2032, 2040, 2054, 2058, 2060, 2058, 2068, 2078, 2084, 2092, 2090, 2096, 2100, 2108,
+    2116, 2114, 2110, 2102, 2098, 2108, 2116, 2112, 2112, 2104, 2100, 2094, 2088, 2078, 2060, 2058,
+    2048, 2044, 2034, 2024, 2004, 1994, 1988, 1986, 1986, 1976, 1970, 1966, 1964, 1970, 1974, 1970,
+    1962, 1956, 1962, 1960, 1954, 1946, 1942, 1940, 1944, 1942, 1952, 1956, 1956, 1954, 1956, 1962,
+    1966, 1962, 1962, 1958, 1956, 1958, 1966, 1964, 1956, 1954, 1960, 1966, 1972, 1968, 1964, 1960,
+    1966, 1972, 1976, 1970, 1966, 1954, 1950, 1964, 1966, 1972, 1974, 1964, 1954, 1958, 1958, 1958,
+    1960, 1958, 1962, 1960, 1958, 1956, 1956, 1954, 1954, 1964, 1970, 1966, 1964, 1962, 1962, 1976,
+    1980, 1988, 1994, 1996, 1996, 1996, 1996, 1998, 1994, 2004, 2018, 2028, 2038, 2040, 2040, 2028,
+    2022, 2016, 2022, 2024, 2008, 2004, 2006, 2016, 2030, 2050, 2078, 2104, 2132, 2172, 2214, 2256,
+    2278, 2302, 2338, 2370, 2406, 2438, 2472, 2508, 2540, 2582, 2622, 2648, 2654, 2642, 2618, 2598,
+    2570, 2554, 2534, 2528, 2524, 2530, 2526, 2520, 2522, 2518, 2510, 2512, 2510, 2492, 2446, 2396,
+    2332, 2244, 2148, 2054, 1968, 1906, 1870, 1852, 1856, 1846, 1836, 1818, 1808, 1804, 1800, 1798,
+    1788, 1786, 1786, 1788, 1792, 1786, 1776, 1768, 1766, 1766, 1760, 1758, 1746, 1746, 1740, 1746,
+    1746, 1734, 1724, 1718, 1708, 1718, 1716, 1714, 1702, 1688, 1688, 1686, 1686, 1680, 1672, 1666,
+    1664, 1674, 1672, 1662, 1648, 1644, 1644, 1660, 1668, 1662, 1662, 1658, 1672, 1682, 1700, 1702,
+    1708, 1716, 1730, 1740, 1752, 1758, 1758, 1766, 1782, 1802, 1820, 1828, 1836, 1838, 1848, 1866,
+    1884, 1884, 1884, 1886, 1890, 1892, 1898, 1900, 1894, 1890, 1896, 1894, 1904, 1906, 1898, 1890,
+    1888, 1898, 1912, 1906, 1898, 1896, 1890, 1898, 1910, 1902, 1902, 1896, 1900, 1910, 1916, 1922,
+    1920, 1914, 1910, 1914, 1918, 1912, 1914, 1918, 1928, 1934, 1932, 1926, 1918, 1906, 1916, 1934,
+    1940, 1944, 1932, 1924, 1922, 1932, 1940, 1932, 1928, 1926, 1928, 1934, 1946, 1944, 1934, 1930,
+    1936, 1956, 1962, 1966, 1960, 1958, 1972, 1986, 2004, 2026, 2052, 2070, 2102, 2144, 2182, 2224,
+    2254, 2284, 2314, 2348, 2388, 2422, 2450, 2484, 2516, 2558, 2600, 2630, 2644, 2640, 2642, 2630,
+    2616, 2596, 2564, 2538, 2532, 2526, 2520, 2512, 2498, 2492, 2492, 2494, 2492, 2498, 2482, 2472,
+    2446, 2402, 2340, 2254, 2148, 2044, 1962, 1920, 1882, 1860, 1842, 1830, 1818, 1816, 1812, 1806,
+    1800, 1794, 1786, 1788, 1786, 1786, 1778, 1764, 1756, 1766, 1766, 1756, 1752, 1744, 1742, 1740,
+    1744, 1740, 1732, 1726, 1722, 1724, 1722, 1718, 1706, 1696, 1694, 1694, 1694, 1692, 1682, 1676,
+    1674, 1678, 1684, 1678, 1666, 1656, 1658, 1662, 1664, 1666, 1660, 1652, 1654, 1666, 1682, 1686,
+    1678, 1680, 1690, 1704, 1720, 1728, 1730, 1736, 1752, 1772, 1788, 1796, 1796, 1802, 1812, 1832,
+    1848, 1860, 1864, 1874, 1884, 1894, 1904, 1896, 1896, 1890, 1896, 1902, 1904, 1910, 1900, 1894,
+    1900, 1918, 1920, 1918, 1908, 1902, 1906, 1906, 1908, 1906, 1906, 1904, 1904, 1912, 1916, 1920,
+    1916, 1920, 1924, 1934, 1936, 1930, 1930, 1926, 1926, 1930, 1936, 1940, 1932, 1930, 1926, 1928,
+    1936, 1932, 1928, 1930, 1932, 1942, 1940, 1944, 1936, 1928, 1924, 1936, 1948, 1946, 1938, 1936,
+    1934, 1940, 1950, 1948, 1938, 1930, 1928, 1930, 1934, 1932, 1922, 1922, 1930, 1940, 1940, 1934,
+    1936, 1932, 1940, 1946, 1946, 1948, 1940, 1932, 1932, 1940, 1942, 1942, 1942, 1934, 1940, 1948,
+    1954, 1948, 1940, 1928, 1936, 1942, 1944, 1948, 1938, 1938, 1942, 1954, 1956, 1950, 1948, 1940,
+    1946, 1954, 1954, 1962, 1950, 1942, 1940, 1948, 1946, 1948, 1942, 1942, 1940, 1950, 1946, 1956,
+    1956, 1954, 1954, 1958, 1962, 1968, 1978, 1978, 1976, 1986, 1994, 2000, 2000, 2008, 2010, 2022,
+    2024, 2016, 2004, 1996, 1990, 1986, 1982, 1974, 1964, 1958, 1956, 1952, 1954, 1956, 1948, 1944,
+    1946, 1952, 1952, 1954, 1948, 1934, 1940, 1944, 1948, 1948, 1946, 1946, 1950, 1952, 1954, 1950,
+    1948, 1968, 2008, 2068, 2146, 2230, 2320, 2420, 2516, 2576, 2544, 2434, 2278, 2138, 2028, 1966,
+    1956, 1946, 1926, 1910, 1924, 1946, 1960, 1950, 1940, 1930, 1934, 1936, 1940, 1940, 1934, 1926,
+    1928, 1932, 1934, 1938, 1936, 1934, 1936, 1938, 1936, 1940, 1938, 1940, 1946, 1956, 1958, 1958,
+    1950, 1946, 1944, 1954, 1958, 1956, 1958, 1956, 1962, 1972, 1980, 1978, 1982, 1978, 1978, 1984,
+    1988, 1988, 1990, 1988, 1994, 2002, 2016, 2020, 2020, 2016, 2020, 2034, 2042, 2044, 2044, 2042,
+    2046, 2052, 2064, 2066, 2060, 2056, 2054, 2064, 2078, 2084, 2084, 2082, 2088, 2096, 2104, 2108,
+    2100, 2092, 2088, 2084, 2086, 2086, 2068, 2056, 2048, 2036, 2036, 2030, 2018, 2008, 1998, 1994,
+    1988, 1982, 1966, 1956, 1958, 1958, 1964, 1964, 1964, 1956, 1954, 1958, 1964, 1962, 1958, 1950,
+    1952, 1948, 1954, 1952, 1944, 1938, 1944, 1952, 1964, 1964, 1960, 1952, 1954, 1960, 1958, 1954,
+    1946, 1942, 1944, 1950, 1954, 1954, 1948, 1938, 1948, 1952, 1956, 1958, 1948, 1944, 1948, 1950,
+    1954, 1950, 1942, 1936, 1936, 1950, 1956, 1972, 1972, 1972, 1974, 1978, 1982, 1986, 1990, 1992,
+    2004, 2010, 2020, 2020, 2010, 2012, 2034, 2058, 2078, 2090, 2104, 2130, 2160, 2190, 2226, 2250,
+    2280, 2296, 2330, 2370, 2416, 2452, 2478, 2502, 2534, 2580, 2616, 2628, 2612, 2586, 2564, 2546,
+    2536, 2516, 2484, 2460, 2438, 2414, 2398, 2382, 2366, 2362, 2356, 2332, 2290, 2240, 2186, 2118,
+    2042, 1976, 1918, 1880, 1848, 1824, 1820, 1820, 1824, 1810, 1794, 1778, 1772, 1774, 1772, 1772,
+    1760, 1758, 1758, 1758, 1768, 1760, 1750, 1744, 1734, 1730, 1728, 1726, 1720, 1714, 1712, 1714,
+    1718, 1712, 1706, 1694, 1698, 1698, 1696, 1686, 1668, 1672, 1672, 1678, 1676, 1678, 1670, 1666,
+    1672, 1682, 1688, 1692, 1692, 1700, 1710, 1728, 1752, 1760, 1762, 1768, 1788, 1800, 1820, 1830,
+    1834, 1830, 1842, 1850, 1860, 1864, 1864, 1866, 1872, 1882, 1888, 1888, 1888, 1876, 1886, 1892,
+    1896, 1890, 1882, 1870, 1866, 1872, 1888, 1890, 1884, 1878, 1876, 1882, 1890, 1892, 1882, 1872,
+    1876, 1876, 1882, 1888, 1882, 1886, 1882, 1884, 1890, 1890, 1884, 1880, 1882, 1890, 1892, 1890,
+    1886, 1880, 1886, 1892, 1898, 1900, 1892, 1890, 1892, 1892, 1902, 1900, 1894, 1896, 1898, 1908,
+    1910, 1910, 1900, 1898, 1910, 1916, 1934, 1942, 1940, 1938, 1940, 1946, 1960, 1964, 1962, 1964,
+    1974, 1976, 1980, 1970, 1962, 1960, 1962, 1952, 1938, 1928, 1916, 1912, 1916, 1916, 1920, 1916,
+    1906, 1900, 1894, 1908, 1918, 1912, 1906, 1896, 1894, 1902, 1900, 1902, 1898, 1896, 1906, 1912,
+    1916, 1912, 1910, 1908, 1906, 1932, 1976, 2036, 2108, 2206, 2312, 2424, 2522, 2586, 2576, 2470,
+    2308, 2144, 2012, 1936, 1910, 1908, 1910, 1910, 1914, 1924, 1926, 1922, 1914, 1910, 1914, 1920,
+    1914, 1908, 1912, 1916, 1926, 1920, 1920, 1910, 1908, 1920, 1920, 1922, 1918, 1916, 1914, 1918,
+    1922, 1924, 1922, 1920, 1920, 1928, 1936, 1934, 1930, 1926, 1928, 1930, 1940, 1944, 1940, 1948,
+    1948, 1952, 1962, 1970, 1970, 1964, 1966, 1972, 1982, 1984, 1986, 1988, 1988, 2004, 2016, 2018,
+    2020, 2020, 2026, 2036, 2048, 2056, 2050, 2056, 2060, 2064, 2074, 2076, 2072, 2066, 2066, 2072,
+    2084, 2080, 2080, 2076, 2072, 2076, 2072, 2068, 2052, 2036, 2028, 2016, 2008, 1998, 1986, 1972,
+    1972, 1970, 1970, 1958, 1944, 1938, 1938, 1936, 1938, 1930, 1920, 1904, 1906, 1912, 1918, 1916,
+    1914, 1910, 1912, 1916, 1922, 1924, 1914, 1906, 1904, 1908, 1918, 1920, 1916, 1906, 1912, 1914,
+    1922, 1924, 1920, 1912, 1922, 1924, 1926, 1924, 1922, 1920, 1916, 1922, 1930, 1928, 1918, 1920,
+    1916, 1920, 1930, 1932, 1926, 1932, 1928, 1938, 1954, 1958, 1956, 1954, 1954, 1962, 1980, 1984,
+    1978, 1978, 1982, 1992, 1998, 1992, 1970, 1960, 1958, 1956, 1956, 1948, 1938, 1920, 1918, 1914,
+    1916, 1912, 1906, 1900, 1902, 1908, 1912, 1910, 1902, 1894, 1894, 1900, 1904, 1906, 1898, 1894,
+    1894, 1896, 1906, 1910, 1904, 1904, 1896, 1892, 1906, 1928, 1976, 2042, 2126, 2220, 2314, 2412,
+    2498, 2568, 2620, 2600, 2496, 2344, 2190, 2058, 1978, 1936, 1938, 1924, 1902, 1892, 1900, 1906,
+    1912, 1908, 1898, 1886, 1890, 1898, 1904, 1908, 1900, 1898, 1890, 1884, 1890, 1888, 1884, 1882,
+    1888, 1892, 1890, 1890, 1890, 1888, 1890, 1900, 1904, 1914, 1914, 1900, 1900, 1894, 1904, 1912,
+    1906, 1904, 1904, 1910, 1922, 1930, 1934, 1930, 1932, 1940, 1948, 1952, 1952, 1948, 1950, 1952,
+    1956, 1962, 1960, 1964, 1968, 1978, 1992, 2000, 1998, 1998, 2002, 2006, 2016, 2018, 2018, 2010,
+    2006, 2014, 2024, 2032, 2032, 2026, 2030, 2036, 2044, 2046, 2040, 2034, 2032, 2030, 2024, 2022,
+    2012, 2002, 1994, 1986, 1972, 1972, 1962, 1950, 1948, 1946, 1944, 1940, 1928, 1920, 1916, 1922,
+    1920, 1918, 1904, 1892, 1886, 1896, 1904, 1906, 1900, 1890, 1894, 1902, 1912, 1912, 1906, 1898,
+    1894, 1902, 1910, 1910, 1908, 1904, 1892, 1896, 1906, 1906, 1908, 1908, 1908, 1920, 1914, 1918,
+    1914, 1908, 1902, 1910, 1912, 1916, 1910, 1910, 1904, 1914, 1926, 1926, 1922, 1918, 1912, 1926,
+    1938, 1942, 1940, 1944, 1944, 1948, 1950, 1954, 1960, 1964, 1966, 1978, 1986, 1986, 1988, 1978,
+    1986, 1984, 1988, 1980, 1968, 1956, 1944, 1934, 1928, 1926, 1920, 1912, 1908, 1918, 1920, 1920,
+    1908, 1908, 1914, 1920, 1924, 1922, 1920, 1912, 1916, 1930, 1950, 1970, 1982, 2002, 2026, 2066,
+    2108, 2150, 2186, 2212, 2236, 2252, 2280, 2312, 2358, 2416, 2488, 2582, 2684, 2782, 2858, 2912,
+    2934, 2916, 2816, 2630, 2392, 2194, 2068, 2024, 2002, 1964, 1922, 1896, 1890, 1898, 1896, 1886,
+    1878, 1868, 1862, 1856, 1860, 1856, 1850, 1842, 1844, 1848, 1848, 1846, 1836, 1828, 1828, 1830,
+    1836, 1844, 1842, 1830, 1832, 1836, 1842, 1842, 1838, 1834, 1830, 1830, 1834, 1828, 1822, 1812,
+    1820, 1828, 1832, 1834, 1832, 1826, 1826, 1826, 1826, 1818, 1814, 1816, 1820, 1816, 1824, 1824,
+    1822, 1820, 1818, 1826, 1838, 1842, 1832, 1826, 1828, 1834, 1844, 1846, 1846, 1844, 1846, 1844,
+    1860, 1868, 1868, 1878, 1880, 1892, 1908, 1912, 1910, 1910, 1908, 1910, 1916, 1924, 1918, 1912,
+    1920, 1922, 1924, 1920, 1922, 1918, 1916, 1922, 1926, 1928, 1916, 1918, 1914, 1916, 1920, 1918,
+    1920, 1918, 1920, 1922, 1928, 1926, 1922, 1918, 1922, 1930, 1934, 1936, 1918, 1922, 1916, 1920,
+    1924, 1928, 1926, 1922, 1920, 1928, 1934, 1940, 1936, 1934, 1930, 1934, 1928, 1934, 1932, 1920,
+    1922, 1932, 1944, 1944, 1934, 1934, 1938, 1940, 1950, 1952, 1948, 1946, 1944, 1944, 1954, 1960,
+    1968, 1966, 1964, 1970, 1980, 1988, 1988, 1996, 2002, 2004, 2018, 2024, 2016, 2004, 1998, 1996,
+    1996, 1998, 1982, 1968, 1954, 1952, 1952, 1958, 1948, 1940, 1936, 1940, 1944, 1944, 1934, 1930,
+    1932, 1936, 1942, 1946, 1940, 1934, 1934, 1932, 1942, 1938, 1934, 1934, 1938, 1942, 1934, 1928,
+    1922, 1934, 1970, 2036, 2122, 2204, 2292, 2388, 2490, 2574, 2620, 2578, 2456, 2284, 2126, 2024,
+    1984, 1978, 1968, 1940, 1926, 1936, 1950, 1964, 1954, 1944, 1944, 1944, 1948, 1946, 1940, 1930,
+    1928, 1930, 1936, 1936, 1938, 1932, 1936, 1944, 1954, 1954, 1954, 1944, 1948, 1956, 1958, 1954,
+    1948, 1946, 1944, 1948, 1964, 1968, 1966, 1960, 1968, 1974, 1982, 1982, 1982, 1978, 1978, 1986,
+    1994, 1996, 1994, 1990, 1992, 1996, 2002, 2012, 2012, 2018, 2026, 2032, 2038, 2046, 2046, 2044,
+    2040, 2048, 2056, 2068, 2066, 2060, 2062, 2066, 2074, 2082, 2086, 2094, 2096, 2104, 2108, 2102,
+    2092, 2088, 2082, 2088, 2090, 2096, 2084, 2070, 2056, 2054, 2050, 2044, 2032, 2022, 2012, 2016,
+    2016, 2008, 1992, 1976, 1970, 1974, 1978, 1976, 1974, 1964, 1964, 1960, 1960, 1960, 1956, 1954,
+    1958, 1964, 1966, 1960, 1950, 1946, 1946, 1956, 1966, 1968, 1968, 1962, 1958, 1960, 1968, 1966,
+    1968, 1960, 1964, 1972, 1976, 1974, 1966, 1954, 1946, 1952, 1964, 1970, 1962, 1952, 1948, 1954,
+    1966, 1966, 1960, 1952, 1950, 1950, 1958, 1962, 1952, 1944, 1946, 1948, 1956, 1962, 1966, 1964,
+    1976, 1986, 1996, 1996, 1984, 1976, 1976, 1986, 2002, 2008, 2008, 2008, 2012, 2018, 2018, 2012,
+    2002, 1998, 1992, 1988, 1988, 1982, 1968, 1950, 1946, 1946, 1952, 1948, 1944, 1938, 1936, 1934,
+    1944, 1952, 1950, 1944, 1942, 1946, 1948, 1946, 1948, 1938, 1938, 1938, 1948, 1958, 1952, 1952,
+    1936, 1932, 1950, 1988, 2044, 2110, 2184, 2274, 2372, 2468, 2550, 2598, 2562, 2430, 2260, 2118,
+    2028, 1984, 1974, 1968, 1960, 1950, 1948, 1946, 1950, 1956, 1954, 1956, 1948, 1940, 1938, 1938,
+    1948, 1950, 1944, 1938, 1938, 1942, 1952, 1946, 1946, 1938, 1942, 1950, 1958, 1960, 1950, 1954,
+    1960, 1968, 1976, 1966, 1960, 1954, 1954, 1960, 1966, 1974, 1970, 1974, 1978, 1982, 1996, 2004,
+    2008, 2004, 2006, 2006, 2012, 2012, 2018, 2022, 2026, 2032, 2040, 2044, 2042, 2038, 2048, 2052,
+    2072, 2070, 2072, 2068, 2070, 2070, 2080, 2084, 2078, 2078, 2078, 2086, 2090, 2090, 2092, 2084,
+    2080, 2078, 2080, 2070, 2064, 2050, 2038, 2026, 2018, 2014, 2004, 1996, 1992, 1996, 1990, 1990,
+    1982, 1974, 1972, 1972, 1974, 1966, 1958, 1954, 1954, 1962, 1966, 1970, 1970, 1970, 1974, 1982,
+    1982, 1980, 1970, 1958, 1960, 1968, 1978, 1984, 1986, 1978, 1964, 1968, 1978, 1978, 1978, 1974,
+    1974, 1976, 1976, 1976, 1968, 1960, 1964, 1974, 1984, 1974, 1978, 1966, 1966, 1968, 1980, 1978,
+    1970, 1966, 1956, 1958, 1966, 1968, 1970, 1968, 1968, 1978, 1990, 2000, 1998, 1992, 1986, 2000,
+    2010, 2028, 2030, 2024, 2022, 2026, 2036, 2042, 2036, 2026, 2022, 2020, 2022, 2020, 2018, 2026,
+    2048, 2062, 2084, 2090, 2108, 2126, 2156, 2190, 2238, 2272, 2296, 2310, 2334, 2352, 2398, 2434,
+    2470, 2496, 2522, 2558, 2600, 2644, 2668, 2666, 2648, 2636, 2620, 2610, 2594, 2580, 2580, 2582,
+    2582, 2578, 2576, 2566, 2550, 2534, 2502, 2432, 2346, 2234, 2130, 2052, 1996, 1952, 1918, 1890,
+    1874, 1870, 1866, 1856, 1844, 1838, 1838, 1834, 1838, 1832, 1824, 1816, 1810, 1808, 1820, 1820,
+    1808, 1798, 1784, 1792, 1790, 1794, 1784, 1774, 1772, 1770, 1770, 1774, 1772, 1764, 1764, 1756,
+    1768, 1764, 1758, 1750, 1742, 1744, 1752, 1756, 1744, 1736, 1732, 1734, 1738, 1744, 1738, 1734,
+    1732, 1734, 1732, 1738, 1736, 1730, 1732, 1740, 1758, 1764, 1760, 1762, 1764, 1778, 1802, 1824,
+    1832, 1838, 1838, 1854, 1870, 1876, 1882, 1884, 1894, 1910, 1926, 1940, 1940, 1940, 1946, 1958,
+    1972, 1970, 1972, 1964, 1952, 1954, 1960, 1964, 1956, 1964, 1964, 1972, 1978, 1978, 1972, 1966,
+    1962, 1964, 1968, 1964, 1966, 1962, 1960, 1962, 1978, 1984, 1984, 1974, 1972, 1974, 1978, 1982,
+    1984, 1980, 1982, 1982, 1986, 1978, 1976, 1970, 1968, 1984, 1996, 2006, 2004, 1996, 1988, 1992,
+    2000, 2006, 1998, 1990, 1988, 1992, 2000, 2006, 2008, 2006, 2010, 2008, 2026, 2036, 2030, 2028,
+    2030, 2038, 2042, 2054, 2052, 2052, 2054, 2066, 2072, 2078, 2074, 2066, 2060, 2054, 2052, 2042,
+    2028, 2022, 2008, 2002, 2010, 2014, 2008, 1998, 1996, 2000, 2002, 2006, 2004, 2002, 2002, 2000,
+    2010, 2012, 2010, 2002, 1996, 1996, 1998, 2002, 2002, 2000, 1992, 1984, 1990, 2014, 2060, 2124,
+    2212, 2330, 2452, 2558, 2646, 2710, 2728, 2650, 2488, 2316, 2160, 2064, 2028, 2028, 2038, 2032,
+    2026, 2020, 2022, 2022, 2020, 2010, 2002, 1998, 1994, 2000, 2002, 2014, 2010, 2008, 2008, 2006,
+    2010, 2006, 2010, 2006, 2004, 2010, 2016, 2016, 2014, 2010, 2014, 2012, 2022, 2026, 2024, 2014,
+    2002, 2004, 2002, 1998, 1996, 1986, 1984, 1988, 1994, 2000, 1998, 1990, 1990, 2000, 2014, 2018,
+    2020, 2022, 2026, 2040, 2056, 2066, 2076, 2076, 2092, 2100, 2110, 2122, 2124, 2118, 2122, 2124,
+    2134, 2140, 2146, 2146, 2150, 2160, 2172, 2178, 2174, 2166, 2164, 2166, 2164, 2160, 2146, 2134,
+    2124, 2116, 2114, 2106, 2094, 2080, 2068, 2064, 2060, 2054, 2046, 2036, 2028, 2032, 2030, 2020,
+    2008, 2004, 1998, 2000, 2004, 2006, 1994, 1994, 1990, 1994, 2000, 2006, 2000, 1994, 1990, 1992,
+    1998, 1996, 1988, 1984, 1986, 1986, 1996, 2002, 2002, 2000, 2000, 2004, 2006, 2004, 1994, 1996,
+    1992, 2002, 2014, 2016, 2016, 2006, 2002, 2006, 2012, 2020, 2018, 2010, 2012, 2012, 2016, 2018,
+    2022, 2020, 2018, 2020, 2026, 2032, 2034, 2030, 2038, 2052, 2064, 2064, 2056, 2044, 2046, 2048,
+    2072, 2082, 2082, 2076, 2066, 2068, 2074, 2072, 2070, 2050, 2046, 2036, 2030, 2020, 2006, 2004,
+    1996, 1994, 1994, 1994, 1988, 1988, 1986, 1990, 1992, 1996, 1992, 1984, 1984, 1984, 1984, 1986,
+    1982, 1984, 1998, 2016, 2044, 2068, 2092, 2116, 2144, 2180, 2246, 2342, 2460, 2578, 2664, 2724,
+    2674, 2542, 2382, 2222, 2102, 2044, 2034, 2018, 1998, 1984, 1990, 2006, 2014, 2008, 1996, 1992,
+    1988, 1996, 2000, 2002, 1998, 1994, 1988, 1992, 1996, 1998, 1990, 1982, 1982, 1986, 1992, 1998,
+    2004, 2000, 1996, 2000, 2010, 2016, 2012, 2008, 2002, 2008, 2018, 2028, 2022, 2018, 2016, 2026,
+    2038, 2038, 2032, 2032, 2032, 2042, 2046, 2058, 2060, 2056, 2058, 2062, 2076, 2088, 2090, 2092,
+    2094, 2096, 2118, 2128, 2128, 2130, 2134, 2134, 2144, 2148, 2150, 2150, 2148, 2154, 2160, 2156,
+    2150, 2142, 2138, 2132, 2136, 2122, 2110, 2092, 2078, 2072, 2066, 2054, 2054, 2042, 2032, 2020,
+    2024, 2026, 2020, 2008, 2002, 2002, 2000, 1996, 1984, 1982, 1986, 1986, 1990, 1988, 1976, 1978,
+    1982, 1992, 2000, 2000, 1998, 1990, 1984, 1982, 1988, 1998, 1996, 1990, 1986, 1990, 1996, 1992,
+    1998, 2000, 2006, 2008, 2012, 2004, 1996, 1992, 1986, 1998, 2008, 2010, 2000, 1994, 1988, 1996,
+    2004, 2006, 2008, 2000, 1998, 1994, 2000, 2008, 2002, 1994, 1990, 1996, 2002, 2006, 2004, 2006,
+    2006, 2022, 2030, 2034, 2024, 2012, 2016, 2032, 2046, 2064, 2072, 2078, 2090, 2110, 2138, 2162,
+    2176, 2194, 2222, 2252, 2274, 2294, 2308, 2318, 2336, 2368, 2404, 2432, 2450, 2478, 2508, 2548,
+    2582, 2612, 2648, 2690, 2714, 2722, 2716, 2702, 2680, 2658, 2640, 2626, 2612, 2590, 2576, 2556,
+    2542, 2528, 2520, 2504, 2492, 2486, 2484, 2478, 2454, 2416, 2372, 2306, 2224, 2142, 2068, 2010,
+    1968, 1938, 1916, 1912, 1906, 1900, 1882, 1864, 1852, 1854, 1854, 1854, 1846, 1830, 1830, 1826,
+    1830, 1830, 1824, 1818, 1810, 1804, 1802, 1798, 1794, 1784, 1776, 1772, 1770, 1770, 1764, 1752,
+    1750, 1754, 1752, 1748, 1742, 1738, 1724, 1720, 1718, 1722, 1716, 1710, 1708, 1712, 1716, 1722,
+    1720, 1718, 1718, 1728, 1738, 1740, 1744, 1744, 1748, 1752, 1772, 1784, 1798, 1800, 1810, 1830,
+    1858, 1872, 1888, 1896, 1900, 1904, 1918, 1932, 1940, 1946, 1946, 1958, 1970, 1978, 1978, 1968,
+    1964, 1968, 1978, 1984, 1978, 1968, 1960, 1966, 1970, 1974, 1966, 1962, 1960, 1962, 1964, 1964,
+    1962, 1956, 1952, 1958, 1960, 1962, 1954, 1946, 1944, 1946, 1954, 1954, 1964, 1960, 1956, 1964,
+    1974, 1978, 1974, 1964, 1964, 1966, 1972, 1972, 1968, 1966, 1958, 1968, 1976, 1978, 1978, 1976,
+    1978, 1984, 1994, 1988, 1984, 1976, 1972, 1978, 1986, 1990, 1986, 1978, 1972, 1976, 1982, 1982,
+    1986, 1982, 1980, 1980, 1980, 1982, 1982, 1966, 1974, 1974, 1982, 1986, 1986, 1982, 1980, 1988,
+    1988, 1986, 1978, 1980, 1982, 1980, 1990, 1994, 1996, 2002, 2002, 2006, 2014, 2022, 2020, 2030,
+    2036, 2046, 2054, 2052, 2050, 2040, 2042, 2038, 2038, 2032, 2028, 2012, 2006, 2006, 2004, 2006,
+    2008, 1994, 1988, 1980, 1984, 1984, 1982, 1978, 1974, 1976, 1984, 1992, 1992, 1986, 1978, 1976,
+    1990, 1990, 1988, 1982, 1982, 1978, 1976, 1972, 1960, 1974, 2008, 2068, 2150, 2236, 2334, 2436,
+    2532, 2622, 2670, 2622, 2486, 2306, 2132, 2018, 1978, 1972, 1974, 1974, 1972, 1984, 1998, 2008,
+    2002, 1994, 1986, 1976, 1978, 1978, 1974, 1972, 1972, 1976, 1982, 1982, 1980, 1978, 1976, 1982,
+    1986, 1992, 1984, 1970, 1968, 1980, 1988, 1994, 1998, 1998, 2000, 2002, 2008, 2012, 2020, 2012,
+    2020, 2018, 2020, 2026, 2030, 2034, 2036, 2042, 2054, 2064, 2068, 2072, 2070, 2080, 2092, 2098,
+    2108, 2110, 2118, 2120, 2128, 2136, 2140, 2142, 2150, 2152, 2168, 2170, 2176, 2172, 2170, 2170,
+    2174, 2176, 2172, 2160, 2150, 2144, 2142, 2142, 2128, 2116, 2100, 2094, 2088, 2078, 2064, 2050,
+    2040, 2036, 2032, 2030, 2024, 2012, 2002, 1996, 1998, 1998, 1994, 1984, 1982, 1992, 1992, 1988,
+    1988, 1980, 1976, 1978, 1984, 1992, 1984, 1980, 1970, 1978, 1992, 1994, 1988, 1982, 1972, 1974,
+    1980, 1988, 1984, 1978, 1978, 1984, 1990, 1990, 1996, 1988, 1988, 1988, 1994, 1994, 1992, 1978,
+    1978, 1980, 1992, 1996, 1990, 1988, 1986, 1996, 2002, 2010, 2012, 2010, 2002, 2006, 2018, 2022,
+    2028, 2028, 2036, 2042, 2050, 2056, 2052, 2042, 2034, 2030, 2038, 2042, 2034, 2018, 1998, 1990,
+    1988, 1988, 1986, 1978, 1972, 1970, 1972, 1976, 1978, 1978, 1972, 1972, 1972, 1970, 1972, 1962,
+    1958, 1964, 1968, 1974, 1978, 1970, 1968, 1972, 1970, 1972, 1968, 1974, 2016, 2094, 2204, 2322,
+    2440, 2538, 2624, 2668, 2610, 2444, 2238, 2054, 1946, 1928, 1942, 1954, 1962, 1962, 1968, 1972,
+    1976, 1974, 1972, 1960, 1960, 1958, 1968, 1972, 1976, 1970, 1964, 1964, 1970, 1970, 1968, 1964,
+    1956, 1958, 1972, 1976, 1972, 1976, 1978, 1980, 1980, 1988, 1988, 1984, 1986, 1986, 1990, 1996,
+    1998, 1998, 1992, 2002, 2010, 2018, 2022, 2022, 2022, 2030, 2040, 2042, 2040, 2032, 2036, 2046,
+    2058, 2068, 2074, 2074, 2080, 2086, 2102, 2116, 2126, 2120, 2120, 2122, 2132, 2138, 2136, 2142,
+    2144, 2146, 2150, 2156, 2148, 2138, 2138, 2134, 2130, 2124, 2114, 2094, 2082, 2074, 2064, 2056,
+    2048, 2034, 2024, 2020, 2018, 2014, 2010, 2000, 1994, 1996, 1996, 1992, 1986, 1980, 1978, 1972,
+    1978, 1974, 1974, 1968, 1970, 1970, 1980, 1984, 1976, 1970, 1962, 1964, 1968, 1970, 1966, 1964,
+    1956, 1964, 1974, 1980, 1976, 1972, 1968, 1972, 1978, 1984, 1982, 1976, 1970, 1974, 1980, 1982,
+    1986, 1978, 1982, 1980, 1984, 1990, 1988, 1978, 1976, 1974, 1986, 1990, 1982, 1976, 1972, 1972,
+    1984, 1988, 1988, 1984, 1992, 2004, 2024, 2030, 2022, 2022, 2026, 2030, 2040, 2044, 2046, 2042,
+    2044, 2062, 2074, 2072, 2066, 2062, 2072, 2094, 2120, 2138, 2152, 2166, 2184, 2206, 2246, 2282,
+    2296, 2314, 2334, 2346, 2372, 2404, 2434, 2454, 2480, 2510, 2550, 2586, 2618, 2636, 2648, 2646,
+    2634, 2608, 2586, 2560, 2536, 2516, 2500, 2478, 2450, 2422, 2410, 2400, 2394, 2398, 2402, 2406,
+    2394, 2378, 2356, 2318, 2260, 2182, 2088, 2012, 1958, 1930, 1904, 1870, 1852, 1840, 1838, 1834,
+    1824, 1814, 1804, 1804, 1804, 1800, 1798, 1784, 1782, 1780, 1792, 1792, 1784, 1772, 1764, 1760,
+    1766, 1772, 1770, 1754, 1738, 1734, 1742, 1742, 1738, 1722, 1710, 1704, 1706, 1702, 1702, 1686,
+    1670, 1678, 1686, 1686, 1684, 1674, 1664, 1670, 1680, 1684, 1678, 1658, 1656, 1656, 1670, 1680,
+    1684, 1686, 1686, 1692, 1704, 1712, 1724, 1730, 1748, 1766, 1784, 1800, 1816, 1828, 1834, 1842,
+    1854, 1868, 1888, 1894, 1902, 1918, 1928, 1938, 1940, 1944, 1944, 1948, 1954, 1952, 1954, 1942,
+    1938, 1940, 1948, 1952, 1950, 1944, 1940, 1944, 1952, 1952, 1950, 1942, 1936, 1938, 1936, 1930,
+    1934, 1932, 1934, 1936, 1936, 1948, 1948, 1946, 1940, 1938, 1944, 1948, 1954, 1948, 1942, 1946,
+    1948, 1946, 1952, 1946, 1940, 1944, 1960, 1966, 1968, 1966, 1964, 1964, 1968, 1978, 1980, 1974,
+    1966, 1966, 1968, 1972, 1970, 1966, 1968, 1968, 1978, 1980, 1980, 1974, 1968, 1972, 1976, 1978,
+    1976, 1970, 1970, 1972, 1980, 1980, 1984, 1978, 1976, 1974, 1984, 1998, 1998, 1998, 1992, 1998,
+    2000, 2006, 2010, 2010, 2016, 2024, 2036, 2040, 2048, 2042, 2042, 2040, 2038, 2036, 2028, 2008,
+    2000, 1994, 1996, 1998, 1992, 1986, 1982, 1978, 1986, 1990, 1984, 1972, 1964, 1972, 1970, 1982,
+    1978, 1970, 1964, 1968, 1976, 1972, 1984, 1980, 1976, 1982, 1988, 1994, 1990, 1978, 1982, 2004,
+    2048, 2114, 2186, 2262, 2358, 2468, 2588, 2694, 2740, 2694, 2566, 2424, 2296, 2154, 2056, 2020,
+    2004, 1990, 1972, 1960, 1974, 1986, 1986, 1984, 1980, 1978, 1980, 1970, 1964, 1970, 1974, 1976,
+    1972, 1960, 1960, 1964, 1974, 1976, 1978, 1970, 1966, 1972, 1980, 1988, 1994, 1990, 1978, 1980,
+    1982, 1988, 1988, 1988, 1990, 1992, 1998, 2004, 2004, 2000, 2000, 2006, 2012, 2016, 2020, 2020,
+    2018, 2020, 2030, 2038, 2036, 2040, 2048, 2050, 2064, 2070, 2080, 2086, 2092, 2102, 2114, 2122,
+    2124, 2122, 2126, 2136, 2146, 2156, 2164, 2162, 2158, 2170, 2182, 2190, 2194, 2186, 2174, 2180,
+    2182, 2178, 2174, 2162, 2146, 2132, 2134, 2130, 2116, 2102, 2088, 2082, 2072, 2064, 2046, 2030,
+    2024, 2016, 2018, 2012, 2012, 2000, 1990, 1986, 1996, 1992, 1990, 1984, 1978, 1982, 1988, 1988,
+    1974, 1972, 1972, 1972, 1980, 1982, 1980, 1974, 1972, 1972, 1978, 1988, 1992, 1988, 1984, 1984,
+    1980, 1984, 1982, 1978, 1978, 1980, 1986, 1988, 1978, 1978, 1978, 1982, 1986, 1990, 1994, 1992,
+    1982, 1978, 1984, 1990, 1990, 1982, 1980, 1984, 1982, 1990, 1990, 1984, 1980, 1980, 1984, 1986,
+    1990, 1980, 1978, 1978, 1980, 1992, 1994, 1992, 1994, 1998, 2004, 2010, 2010, 2012, 2008, 2026,
+    2034, 2040, 2042, 2036, 2028, 2034, 2038, 2038, 2034, 2020, 2008, 2000, 2004, 2004, 2000, 1986,
+    1970, 1978, 1980, 1980, 1978, 1976, 1968, 1956, 1960, 1970, 1970, 1970, 1966, 1970, 1970, 1974,
+    1972, 1968, 1966, 1962, 1968, 1970, 1968, 1964, 1958, 1954, 1966, 1984, 2026, 2070, 2132, 2200,
+    2292, 2398, 2504, 2600, 2676, 2694, 2622, 2488, 2336, 2190, 2078, 2030, 2020, 2010, 1984, 1954,
+    1950, 1968, 1982, 1982, 1974, 1970, 1958, 1952, 1956, 1956, 1960, 1956, 1946, 1948, 1952, 1964,
+    1968, 1968, 1958, 1956, 1962, 1968, 1966, 1962, 1954, 1952, 1960, 1968, 1974, 1972, 1964, 1974,
+    1978, 1984, 1990, 1984, 1982, 1982, 1982, 1984, 1986, 1984, 1986, 1992, 2002, 2006, 2010, 2016,
+    2018, 2026, 2032, 2044, 2042, 2046, 2044, 2052, 2058, 2070, 2074, 2072, 2082, 2094, 2106, 2114,
+    2118, 2122, 2124, 2128, 2134, 2142, 2138, 2126, 2124, 2128, 2132, 2142, 2140, 2130, 2118, 2118,
+    2112, 2108, 2102, 2092, 2078, 2074, 2064, 2052, 2042, 2028, 2008, 2000, 2004, 2000, 1998, 1984,
+    1978, 1978, 1978, 1978, 1976, 1968, 1950, 1950, 1956, 1966, 1962, 1956, 1954, 1956, 1960, 1966,
+    1962, 1954, 1946, 1950, 1954, 1964, 1968, 1958, 1952, 1956, 1960, 1966, 1966, 1966, 1962, 1970,
+    1978, 1978, 1972, 1968, 1962, 1970, 1972, 1978, 1978, 1972, 1964, 1964, 1962, 1976, 1976, 1972,
+    1968, 1974, 1970, 1974, 1972, 1960, 1962, 1964, 1970, 1974, 1976, 1966, 1964, 1970, 1980, 1986,
+    1982, 1974, 1970, 1966, 1978, 1980, 1984, 1980, 1984, 1994, 2002, 2024, 2046, 2064, 2082, 2118,
+    2150, 2174, 2200, 2238, 2272, 2304, 2336, 2374, 2398, 2426, 2460, 2506, 2550, 2576, 2604, 2628,
+    2656, 2666, 2662, 2640, 2610, 2572, 2542, 2522, 2510, 2498, 2484, 2464, 2446, 2436, 2432, 2430,
+    2422, 2414, 2408, 2408, 2414, 2406, 2386, 2348, 2290, 2222, 2150, 2072, 2002, 1936, 1888, 1864,
+    1858, 1858, 1850, 1836, 1824, 1812, 1804, 1804, 1796, 1786, 1778, 1776, 1774, 1778, 1778, 1766,
+    1758, 1756, 1758, 1756, 1754, 1744, 1736, 1728, 1728, 1724, 1720, 1714, 1708, 1696, 1694, 1692,
+    1688, 1682, 1680, 1676, 1668, 1664, 1660, 1650, 1636, 1636, 1642, 1644, 1638, 1630, 1632, 1638,
+    1640, 1644, 1656, 1658, 1666, 1666, 1670, 1680, 1694, 1698, 1708, 1722, 1742, 1764, 1778, 1792,
+    1796, 1808, 1828, 1844, 1860, 1864, 1870, 1880, 1890, 1906, 1904, 1910, 1912, 1920, 1920, 1928,
+    1928, 1920, 1920, 1924, 1932, 1926, 1924, 1916, 1914, 1916, 1924, 1924, 1926, 1916, 1918, 1916,
+    1916, 1928, 1928, 1924, 1918, 1918, 1916, 1928, 1926, 1924, 1922, 1924, 1924, 1928, 1928, 1928,
+    1928, 1924, 1930, 1934, 1940, 1934, 1926, 1922, 1924, 1932, 1932, 1932, 1934, 1932, 1932, 1938,
+    1938, 1932, 1926, 1928, 1934, 1944, 1940, 1938, 1928, 1930, 1934, 1940, 1940, 1938, 1938, 1942,
+    1946, 1950, 1946, 1946, 1940, 1936, 1934, 1934, 1936, 1926, 1928, 1932, 1938, 1942, 1946, 1942,
+    1938, 1946, 1948, 1952, 1950, 1940, 1928, 1930, 1936, 1940, 1946, 1944, 1940, 1942, 1942, 1944,
+    1942, 1942, 1938, 1942, 1944, 1950, 1956, 1946, 1942, 1948, 1956, 1976, 1984, 1976, 1980, 1984,
+    1994, 2008, 2012, 2008, 2002, 2000, 2004, 2012, 2006, 1994, 1984, 1974, 1974, 1972, 1974, 1966,
+    1956, 1966, 1956, 1962, 1954, 1950, 1946, 1950, 1954, 1952, 1954, 1946, 1942, 1944, 1952, 1966,
+    1964, 1960, 1952, 1958, 1960, 1954, 1946, 1938, 1954, 1992, 2044, 2122, 2206, 2312, 2428, 2546,
+    2634, 2666, 2580, 2426, 2250, 2104, 2012, 1984, 1978, 1968, 1950, 1952, 1960, 1976, 1974, 1962,
+    1952, 1946, 1948, 1942, 1946, 1940, 1940, 1936, 1944, 1950, 1954, 1950, 1942, 1946, 1950, 1960,
+    1964, 1958, 1954, 1950, 1958, 1958, 1964, 1960, 1958, 1964, 1968, 1974, 1974, 1982, 1984, 1992,
+    1994, 1996, 1992, 1986, 1976, 1982, 1986, 1998, 2006, 2004, 2004, 2014, 2022, 2032, 2038, 2038,
+    2038, 2046, 2050, 2060, 2072, 2068, 2072, 2076, 2084, 2100, 2110, 2112, 2112, 2114, 2122, 2132,
+    2136, 2138, 2140, 2144, 2148, 2152, 2154, 2150, 2142, 2142, 2142, 2134, 2128, 2114, 2106, 2098,
+    2092, 2088, 2078, 2064, 2040, 2028, 2022, 2020, 2020, 2008, 2002, 2000, 1998, 1994, 1990, 1978,
+    1976, 1974, 1978, 1976, 1970, 1960, 1958, 1956, 1964, 1964, 1966, 1958, 1958, 1962, 1972, 1980,
+    1982, 1970, 1960, 1958, 1964, 1968, 1966, 1970, 1968, 1964, 1964, 1968, 1962, 1960, 1958, 1964,
+    1968, 1978, 1976, 1966, 1958, 1960, 1960, 1972, 1970, 1964, 1958, 1964, 1968, 1974, 1982, 1968,
+    1962, 1968, 1976, 1992, 1994, 1994, 1990, 1998, 2006, 2008, 2016, 2008, 2008, 2010, 2022, 2030,
+    2026, 2024, 2018, 2004, 1998, 1990, 1984, 1972, 1962, 1960, 1966, 1968, 1972, 1960, 1956, 1956,
+    1958, 1966, 1962, 1954, 1952, 1950, 1960, 1962, 1960, 1954, 1956, 1958, 1962, 1968, 1968, 1956,
+    1952, 1960, 1982, 2030, 2090, 2168, 2270, 2408, 2538, 2646, 2672, 2578, 2396, 2190, 2024, 1946,
+    1934, 1942, 1942, 1948, 1958, 1972, 1972, 1960, 1948, 1950, 1952, 1952, 1956, 1948, 1946, 1946,
+    1948, 1948, 1948, 1940, 1942, 1942, 1950, 1956, 1954, 1950, 1952, 1958, 1966, 1976, 1972, 1966,
+    1960, 1964, 1972, 1984, 1994, 1986, 1984, 1982, 1996, 2004, 2012, 2006, 2002, 2008, 2014, 2024,
+    2028, 2026, 2026, 2030, 2036, 2046, 2058, 2064, 2068, 2078, 2090, 2094, 2092, 2086, 2086, 2096,
+    2106, 2120, 2118, 2112, 2108, 2110, 2122, 2126, 2118, 2110, 2106, 2094, 2086, 2084, 2074, 2068,
+    2050, 2038, 2026, 2020, 2016, 2004, 1992, 1988, 1990, 1990, 1980, 1972, 1962, 1954, 1962, 1968,
+    1968, 1960, 1948, 1942, 1948, 1956, 1966, 1960, 1942, 1940, 1950, 1958, 1956, 1954, 1952, 1954,
+    1958, 1964, 1970, 1962, 1958, 1964, 1976, 1980, 1980, 1970, 1960, 1960, 1968, 1974, 1978, 1970,
+    1972, 1974, 1978, 1980, 1978, 1976, 1974, 1972, 1980, 1978, 1980, 1970, 1974, 1978, 1990, 2000,
+    2006, 2008, 2012, 2018, 2024, 2038, 2042, 2040, 2030, 2022, 2022, 2022, 2018, 2014, 2004, 1992,
+    1994, 1998, 2004, 2012, 2022, 2050, 2066, 2096, 2116, 2130, 2150, 2188, 2226, 2256, 2276, 2296,
+    2320, 2340, 2372, 2412, 2454, 2478, 2512, 2554, 2608, 2642, 2644, 2614, 2592, 2586, 2610, 2640,
+    2664, 2676, 2682, 2702, 2710, 2710, 2672, 2580, 2444, 2326, 2228, 2146, 2062, 1990, 1936, 1902,
+    1884, 1874, 1864, 1842, 1834, 1830, 1826, 1824, 1814, 1804, 1794, 1788, 1786, 1788, 1784, 1784,
+    1772, 1770, 1776, 1780, 1780, 1766, 1754, 1750, 1750, 1754, 1754, 1740, 1732, 1728, 1726, 1732,
+    1730, 1720, 1718, 1714, 1714, 1714, 1710, 1694, 1684, 1678, 1684, 1690, 1690, 1692, 1684, 1680,
+    1682, 1692, 1694, 1690, 1682, 1686, 1690, 1704, 1704, 1714, 1720, 1730, 1742, 1766, 1782, 1786,
+    1804, 1818, 1832, 1850, 1864, 1862, 1864, 1870, 1888, 1902, 1906, 1908, 1904, 1908, 1910, 1918,
+    1924, 1914, 1910, 1912, 1914, 1914, 1908, 1906, 1902, 1902, 1910, 1918, 1920, 1918, 1912, 1910,
+    1918, 1924, 1926, 1912, 1908, 1908, 1916, 1922, 1926, 1924, 1918, 1924, 1928, 1930, 1934, 1926,
+    1926, 1924, 1930, 1922, 1928, 1928, 1922, 1928, 1930, 1936, 1936, 1934, 1936, 1938, 1944, 1948,
+    1948, 1944, 1942, 1950, 1960, 1970, 1982, 1994, 2020, 2038, 2056, 2080, 2110, 2138, 2174, 2216,
+    2256, 2288, 2314, 2328, 2352, 2380, 2420, 2462, 2502, 2530, 2554, 2570, 2594, 2608, 2596, 2556,
+    2514, 2480, 2458, 2444, 2430, 2412, 2388, 2376, 2370, 2366, 2356, 2348, 2344, 2350, 2362, 2364,
+    2348, 2306, 2258, 2196, 2126, 2046, 1968, 1904, 1858, 1836, 1830, 1828, 1826, 1810, 1798, 1790,
+    1784, 1788, 1782, 1770, 1766, 1752, 1750, 1752, 1752, 1744, 1734, 1728, 1728, 1726, 1722, 1716,
+    1708, 1700, 1702, 1704, 1702, 1692, 1684, 1680, 1684, 1684, 1676, 1670, 1664, 1668, 1666, 1664,
+    1654, 1644, 1640, 1640, 1648, 1656, 1656, 1642, 1642, 1640, 1656, 1668, 1674, 1672, 1666, 1674,
+    1688, 1702, 1712, 1720, 1738, 1748, 1764, 1776, 1788, 1806, 1812, 1824, 1830, 1842, 1854, 1850,
+    1852, 1854, 1858, 1870, 1870, 1874, 1878, 1884, 1888, 1886, 1886, 1880, 1880, 1878, 1878, 1874,
+    1876, 1870, 1860, 1860, 1874, 1884, 1880, 1868, 1866, 1870, 1874, 1878, 1876, 1874, 1868, 1870,
+    1872, 1884, 1878, 1872, 1872, 1872, 1882, 1892, 1894, 1890, 1886, 1890, 1894, 1894, 1898, 1888,
+    1886, 1888, 1882, 1892, 1904, 1902, 1896, 1894, 1900, 1910, 1908, 1904, 1900, 1896, 1900, 1904,
+    1910, 1900, 1896, 1892, 1900, 1912, 1908, 1900, 1890, 1890, 1900, 1906, 1896, 1892, 1884, 1882,
+    1884, 1892, 1894, 1890, 1880, 1884, 1896, 1904, 1910, 1914, 1914, 1908, 1910, 1920, 1926, 1934,
+    1928, 1926, 1934, 1940, 1940, 1938, 1932, 1930, 1932, 1934, 1926, 1900, 1878, 1870, 1876, 1886,
+    1886, 1882, 1868, 1868, 1868, 1870, 1862, 1864, 1860, 1864, 1860, 1868, 1866, 1864, 1858, 1858,
+    1862, 1862, 1862, 1852, 1844, 1862, 1910, 1992, 2092, 2228, 2378, 2502, 2542, 2436, 2218, 1978,
+    1830, 1810, 1840, 1854, 1846, 1840, 1838, 1838, 1836, 1838, 1836, 1828, 1828, 1826, 1830, 1836,
+    1832, 1818, 1810, 1822, 1828, 1834, 1830, 1826, 1818, 1822, 1826, 1826, 1822, 1820, 1814, 1812,
+    1812, 1826, 1828, 1832, 1828, 1848, 1854, 1860, 1854, 1858, 1858, 1870, 1882, 1888, 1886, 1892,
+    1888, 1898, 1906, 1924, 1928, 1926, 1928, 1934, 1948, 1966, 1978, 1976, 1980, 1990, 1996, 2020,
+    2030, 2032, 2028, 2032, 2052, 2068, 2068, 2066, 2060, 2058, 2072, 2076, 2074, 2060, 2038, 2026,
+    2022, 2022, 2014, 2002, 1990, 1974, 1958, 1948, 1940, 1932, 1922, 1916, 1914, 1912, 1896, 1886,
+    1880, 1880, 1882, 1890, 1888, 1884, 1880, 1878, 1876, 1884, 1882, 1874, 1866, 1862, 1866, 1866,
+    1872, 1866, 1854, 1864, 1872, 1878, 1866, 1862, 1856, 1868, 1870, 1876, 1882, 1876, 1870, 1870,
+    1872, 1888, 1890, 1888, 1888, 1884, 1894, 1902, 1910, 1910, 1910, 1920, 1930, 1932, 1918, 1914,
+    1908, 1912, 1920, 1924, 1916, 1908, 1892, 1882, 1882, 1884, 1878, 1866, 1846, 1846, 1846, 1852,
+    1846, 1830, 1826, 1824, 1822, 1832, 1826, 1822, 1822, 1820, 1830, 1838, 1842, 1832, 1828, 1834,
+    1854, 1876, 1894, 1912, 1930, 1948, 1978, 2016, 2068, 2144, 2236, 2344, 2454, 2568, 2672, 2748,
+    2806, 2812, 2726, 2558, 2358, 2176, 2036, 1960, 1926, 1900, 1878, 1852, 1836, 1844, 1850, 1844,
+    1826, 1816, 1810, 1796, 1796, 1792, 1794, 1786, 1780, 1772, 1774, 1778, 1774, 1770, 1764, 1760,
+    1760, 1768, 1766, 1756, 1756, 1758, 1762, 1768, 1770, 1764, 1758, 1764, 1772, 1786, 1794, 1790,
+    1786, 1788, 1790, 1798, 1796, 1790, 1784, 1782, 1784, 1796, 1794, 1786, 1782, 1780, 1796, 1800,
+    1802, 1804, 1800, 1806, 1810, 1816, 1818, 1818, 1816, 1828, 1834, 1848, 1850, 1852, 1850, 1856,
+    1862, 1876, 1882, 1878, 1876, 1872, 1878, 1886, 1892, 1884, 1880, 1878, 1882, 1884, 1876, 1874,
+    1866, 1866, 1866, 1868, 1868, 1860, 1848, 1850, 1852, 1856, 1864, 1858, 1852, 1852, 1856, 1862,
+    1856, 1854, 1846, 1844, 1848, 1854, 1864, 1860, 1852, 1848, 1854, 1858, 1862, 1866, 1866, 1866,
+    1870, 1874, 1878, 1874, 1868, 1866, 1864, 1868, 1862, 1862, 1862, 1868, 1872, 1880, 1884, 1888,
+    1884, 1884, 1886, 1884, 1884, 1880, 1880, 1878, 1886, 1898, 1906, 1912, 1910, 1912, 1918, 1934,
+    1942, 1936, 1940, 1938, 1940, 1948, 1958, 1956, 1948, 1940, 1946, 1950, 1950, 1948, 1934, 1928,
+    1922, 1918, 1918, 1908, 1896, 1894, 1888, 1892, 1888, 1886, 1890, 1898, 1902, 1906, 1900, 1896,
+    1892, 1892, 1898, 1910, 1914, 1904, 1892, 1892, 1894, 1906, 1912, 1906, 1900, 1894, 1908, 1936,
+    1982, 2042, 2118, 2208, 2300, 2392, 2480, 2550, 2596, 2566, 2444, 2264, 2102, 1976, 1916, 1896,
+    1914, 1910, 1894, 1884, 1886, 1892, 1902, 1902, 1894, 1892, 1888, 1892, 1896, 1900, 1900, 1898,
+    1890, 1886, 1904, 1910, 1914, 1910, 1902, 1904, 1906, 1908, 1908, 1906, 1902, 1906, 1908, 1920,
+    1924, 1920, 1916, 1914, 1924, 1936, 1936, 1928, 1920, 1916, 1924, 1932, 1944, 1942, 1940, 1944,
+    1950, 1956, 1956, 1954, 1956, 1956, 1968, 1986, 2000, 1998, 1998, 1998, 2006, 2020, 2018, 2020,
+    2022, 2034, 2046, 2060, 2066, 2062, 2052, 2060, 2074, 2092, 2100, 2096, 2092, 2078, 2082, 2088,
+    2092, 2080, 2078, 2074, 2072, 2068, 2066, 2062, 2052, 2036, 2028, 2030, 2018, 2012, 1998, 1986,
+    1986, 1980, 1978, 1972, 1964, 1958, 1954, 1964, 1962, 1958, 1952, 1952, 1952, 1952, 1946, 1946,
+    1940, 1944, 1950, 1956, 1954, 1946, 1938, 1940, 1946, 1952, 1950, 1952, 1952, 1948, 1952, 1954,
+    1952, 1952, 1950, 1956, 1962, 1972, 1966, 1962, 1962, 1958, 1972, 1978, 1978, 1980, 1970, 1964,
+    1966, 1966, 1968, 1966, 1960, 1960, 1968, 1970, 1974, 1964, 1962, 1964, 1966, 1976, 1980, 1976,
+    1964, 1962, 1972, 1980, 1992, 1992, 1988, 1990, 1992, 1994, 2002, 2004, 2006, 2020, 2028, 2040,
+    2034, 2032, 2020, 2012, 2008, 2012, 2006, 1994, 1984, 1978, 1976, 1976, 1978, 1970, 1966, 1964,
+    1962, 1964, 1962, 1958, 1950, 1952, 1956, 1960, 1960, 1956, 1954, 1956, 1962, 1962, 1968, 1962,
+    1966, 1966, 1966, 1968, 1972, 1964, 1954, 1966, 1998, 2062, 2134, 2208, 2290, 2386, 2484, 2584,
+    2650, 2654, 2560, 2412, 2258, 2126, 2030, 1980, 1972, 1970, 1966, 1968, 1972, 1976, 1976, 1974,
+    1970, 1970, 1970, 1964, 1956, 1950, 1950, 1960, 1958, 1958, 1948, 1948, 1952, 1960, 1962, 1960,
+    1962, 1960, 1962, 1964, 1966, 1962, 1960, 1960, 1968, 1972, 1976, 1978, 1972, 1970, 1978, 1990,
+    1994, 1990, 1988, 1990, 1990, 1994, 1996, 1998, 1996, 1994, 2010, 2016, 2028, 2030, 2032, 2042,
+    2050, 2060, 2066, 2060, 2060, 2066, 2070, 2080, 2084, 2088, 2086, 2090, 2100, 2108, 2110, 2112,
+    2112, 2116, 2114, 2124, 2120, 2112, 2104, 2100, 2104, 2102, 2094, 2080, 2070, 2062, 2058, 2058,
+    2050, 2036, 2018, 2012, 2006, 2000, 1998, 1990, 1984, 1980, 1980, 1984, 1982, 1980, 1970, 1970,
+    1968, 1970, 1968, 1960, 1950, 1954, 1966, 1968, 1968, 1966, 1966, 1966, 1970, 1974, 1978, 1972,
+    1964, 1964, 1964, 1976, 1978, 1976, 1970, 1966, 1968, 1982, 1986, 1984, 1978, 1978, 1980, 1986,
+    1988, 1980, 1976, 1970, 1974, 1982, 1982, 1972, 1970, 1968, 1974, 1980, 1980, 1982, 1978, 1978,
+    1980, 1982, 1980, 1974, 1968, 1970, 1976, 1974, 1978, 1970, 1972, 1966, 1974, 1988, 1994, 1992,
+    1996, 2002, 2008, 2012, 2012, 2008, 2004, 2014, 2024, 2032, 2040, 2034, 2034, 2036, 2038, 2046,
+    2062, 2060, 2070, 2076, 2096, 2114, 2136, 2150, 2176, 2212, 2250, 2284, 2306, 2324, 2346, 2374,
+    2404, 2436, 2464, 2490, 2508, 2538, 2572, 2606, 2624, 2626, 2606, 2588, 2570, 2548, 2538, 2520,
+    2500, 2488, 2474, 2470, 2458, 2442, 2414, 2388, 2386, 2400, 2400, 2384, 2356, 2330, 2302, 2256,
+    2192, 2110, 2030, 1964, 1926, 1904, 1884, 1870, 1852, 1844, 1844, 1844, 1842, 1834, 1832, 1826,
+    1824, 1822, 1820, 1814, 1810, 1804, 1802, 1804, 1802, 1794, 1786, 1780, 1784, 1788, 1786, 1782,
+    1778, 1772, 1774, 1774, 1778, 1768, 1760, 1752, 1744, 1748, 1742, 1740, 1730, 1728, 1728, 1734,
+    1734, 1728, 1724, 1726, 1732, 1734, 1734, 1728, 1724, 1724, 1726, 1736, 1742, 1738, 1744, 1746,
+    1760, 1770, 1784, 1788, 1794, 1798, 1808, 1826, 1838, 1844, 1848, 1858, 1866, 1884, 1892, 1896,
+    1896, 1902, 1918, 1928, 1930, 1928, 1930, 1928, 1932, 1934, 1928, 1926, 1916, 1922, 1924, 1932,
+    1932, 1928, 1922, 1920, 1926, 1928, 1930, 1922, 1920, 1916, 1912, 1920, 1916, 1922, 1916, 1910,
+    1918, 1920, 1916, 1916, 1918, 1922, 1920, 1912, 1916, 1914, 1906, 1904, 1912, 1920, 1920, 1912,
+    1906, 1914, 1922, 1932, 1934, 1928, 1930, 1926, 1930, 1934, 1932, 1930, 1930, 1924, 1932, 1930,
+    1938, 1938, 1934, 1934, 1930, 1932, 1930, 1922, 1922, 1918, 1918, 1926, 1922, 1926, 1920, 1922,
+    1920, 1930, 1934, 1926, 1922, 1920, 1922, 1934, 1938, 1938, 1940, 1938, 1940, 1944, 1948, 1950,
+    1958, 1964, 1966, 1980, 1984, 1980, 1972, 1964, 1960, 1960, 1954, 1940, 1922, 1908, 1910, 1924,
+    1932, 1928, 1916, 1902, 1894, 1900, 1910, 1918, 1912, 1910, 1908, 1912, 1916, 1920, 1912, 1910,
+    1916, 1928, 1932, 1922, 1906, 1902, 1904, 1912, 1926, 1942, 1976, 2034, 2120, 2236, 2348, 2446,
+    2528, 2566, 2504, 2336, 2136, 1982, 1900, 1886, 1898, 1906, 1910, 1910, 1924, 1928, 1932, 1940,
+    1950, 1950, 1932, 1914, 1914, 1918, 1910, 1908, 1912, 1922, 1938, 1936, 1944, 1942, 1930, 1922,
+    1928, 1938, 1936, 1930, 1924, 1916, 1920, 1944, 1944, 1940, 1938, 1950, 1944, 1950, 1956, 1942,
+    1946, 1940, 1944, 1954, 1958, 1964, 1970, 1974, 1972, 1978, 1980, 1976, 1972, 1984, 1998, 1998,
+    1998, 1996, 1986, 2002, 2018, 2024, 2024, 2018, 2014, 2016, 2022, 2034, 2038, 2032, 2032, 2040,
+    2036, 2030, 2034, 2036, 2026, 2016, 2012, 2000, 1992, 1978, 1970, 1964, 1966, 1958, 1954, 1934,
+    1918, 1916, 1910, 1910, 1902, 1888, 1874, 1868, 1866, 1870, 1870, 1866, 1862, 1856, 1854, 1858,
+    1858, 1854, 1846, 1842, 1844, 1848, 1852, 1854, 1852, 1854, 1856, 1866, 1872, 1876, 1878, 1876,
+    1880, 1886, 1890, 1888, 1888, 1890, 1894, 1902, 1904, 1910, 1912, 1916, 1922, 1924, 1928, 1932,
+    1926, 1922, 1934, 1946, 1950, 1956, 1958, 1958, 1958, 1970, 1982, 1988, 1984, 1992, 1994, 2000,
+    2004, 1994, 1978, 1966, 1968, 1984, 1978, 1966, 1960, 1952, 1950, 1944, 1938, 1944, 1940, 1936,
+    1936, 1932, 1930, 1922, 1918, 1916, 1918, 1926, 1930, 1936, 1932, 1932, 1936, 1944, 1946, 1940,
+    1938, 1938, 1940, 1942, 1934, 1934, 1940, 1968, 2022, 2088, 2182, 2290, 2410, 2516, 2594, 2640,
+    2596, 2454, 2264, 2096, 1980, 1930, 1922, 1926, 1930, 1934, 1942, 1956, 1966, 1964, 1956, 1952,
+    1958, 1958, 1956, 1946, 1940, 1944, 1948, 1954, 1960, 1958, 1950, 1948, 1954, 1964, 1968, 1964,
+    1960, 1962, 1958, 1962, 1968, 1966, 1960, 1964, 1972, 1974, 1976, 1976, 1970, 1974, 1980, 1986,
+    1992, 1996, 1990, 1988, 1998, 2006, 2010, 2016, 2008, 2014, 2024, 2030, 2040, 2042, 2042, 2042,
+    2054, 2064, 2064, 2068, 2072, 2068, 2072, 2084, 2094, 2096, 2098, 2098, 2102, 2108, 2118, 2114,
+    2112, 2110, 2108, 2112, 2104, 2094, 2082, 2074, 2074, 2066, 2064, 2044, 2038, 2030, 2022, 2028,
+    2028, 2018, 2006, 1998, 1986, 1988, 1982, 1978, 1968, 1960, 1966, 1976, 1974, 1978, 1974, 1968,
+    1970, 1970, 1970, 1962, 1956, 1958, 1960, 1964, 1966, 1962, 1958, 1960, 1964, 1972, 1976, 1976,
+    1968, 1966, 1970, 1970, 1978, 1972, 1968, 1968, 1972, 1976, 1982, 1976, 1968, 1962, 1970, 1980,
+    1988, 1986, 1984, 1986, 1988, 1998, 2002, 2002, 2002, 1998, 1998, 2012, 2020, 2024, 2026, 2032,
+    2036, 2040, 2046, 2042, 2036, 2030, 2024, 2026, 2024, 2012, 1996, 1988, 1986, 1988, 1986, 1980,
+    1974, 1968, 1968, 1968, 1968, 1964, 1956, 1956, 1964, 1966, 1980, 1988, 1996, 2016, 2040, 2078,
+    2114, 2144, 2176, 2202, 2230, 2252, 2268, 2280, 2294, 2326, 2386, 2460, 2524, 2598, 2678, 2770,
+    2866, 2950, 2982, 2936, 2796, 2594, 2378, 2186, 2060, 2000, 1978, 1962, 1948, 1950, 1950, 1946,
+    1928, 1920, 1916, 1916, 1912, 1910, 1896, 1890, 1892, 1898, 1896, 1890, 1880, 1880, 1882, 1890,
+    1892, 1890, 1880, 1880, 1884, 1886, 1884, 1876, 1870, 1868, 1870, 1874, 1882, 1876, 1862, 1860,
+    1870, 1872, 1874, 1868, 1864, 1858, 1860, 1862, 1864, 1856, 1852, 1850, 1854, 1856, 1860, 1856,
+    1854, 1858, 1862, 1872, 1876, 1872, 1868, 1866, 1876, 1884, 1892, 1892, 1882, 1888, 1894, 1912,
+    1926, 1930, 1934, 1936, 1944, 1946, 1946, 1946, 1946, 1942, 1946, 1956, 1956, 1952, 1942, 1928,
+    1932, 1942, 1944, 1948, 1938, 1932, 1924, 1930, 1930, 1918, 1914, 1914, 1916, 1914, 1918, 1914,
+    1904, 1906, 1914, 1930, 1938, 1934, 1920, 1916, 1910, 1906, 1910, 1900, 1886, 1884, 1896, 1912,
+    1914, 1900, 1884, 1860, 1864, 1886, 1904, 1908, 1896, 1880, 1872, 1882, 1902, 1924, 1936, 1934,
+    1928, 1928, 1926, 1928, 1916, 1900, 1890, 1890, 1904, 1926, 1948, 1968, 1972, 1970, 1968, 1974,
+    1986, 2000, 2010, 2014, 2006, 1994, 1986, 1982, 1974, 1972, 1968, 1968, 1954, 1960, 1964, 1958,
+    1956, 1946, 1942, 1936, 1938, 1930, 1926, 1920, 1908, 1898, 1908, 1926, 1940, 1934, 1916, 1912,
+    1920, 1934, 1936, 1936, 1920, 1912, 1908, 1914, 1912, 1902, 1922, 1962, 2026, 2106, 2202, 2304,
+    2422, 2542, 2644, 2660, 2532, 2330, 2128, 1970, 1898, 1900, 1916, 1908, 1890, 1882, 1896, 1906,
+    1914, 1910, 1900, 1890, 1890, 1900, 1900, 1894, 1890, 1894, 1902, 1906, 1904, 1906, 1902, 1908,
+    1906, 1912, 1910, 1906, 1898, 1896, 1900, 1912, 1922, 1926, 1926, 1922, 1926, 1930, 1936, 1940,
+    1936, 1934, 1942, 1950, 1958, 1958, 1954, 1956, 1966, 1976, 1978, 1984, 1992, 1994, 1998, 2010,
+    2014, 2014, 2016, 2028, 2038, 2038, 2046, 2048, 2060, 2064, 2070, 2076, 2078, 2078, 2078, 2082,
+    2088, 2090, 2096, 2092, 2078, 2072, 2066, 2066, 2054, 2034, 2022, 2012, 2004, 2004, 1990, 1982,
+    1970, 1958, 1958, 1960, 1958, 1954, 1946, 1938, 1932, 1930, 1936, 1932, 1926, 1926, 1932, 1936,
+    1936, 1934, 1924, 1930, 1930, 1936, 1940, 1934, 1922, 1922, 1928, 1940, 1942, 1938, 1938, 1938,
+    1938, 1942, 1956, 1956, 1952, 1948, 1952, 1960, 1958, 1960, 1948, 1954, 1964, 1970, 1970, 1972,
+    1966, 1968, 1988, 1992, 1990, 1992, 1986, 1988, 1996, 2000, 2006, 2002, 1994, 1988, 1994, 2002,
+    2002, 1996, 1984, 1974, 1974, 1974, 1970, 1952, 1940, 1934, 1938, 1940, 1934, 1932, 1922, 1916,
+    1926, 1936, 1938, 1938, 1934, 1936, 1938, 1942, 1942, 1936, 1928, 1926, 1930, 1930, 1942, 1942,
+    1936, 1932, 1938, 1960, 2010, 2070, 2148, 2236, 2326, 2428, 2536, 2620, 2672, 2652, 2542, 2386,
+    2230, 2094, 2000, 1962, 1964, 1956, 1938, 1932, 1928, 1928, 1934, 1942, 1938, 1928, 1924, 1918,
+    1922, 1930, 1934, 1932, 1922, 1916, 1916, 1924, 1924, 1930, 1918, 1918, 1922, 1926, 1930, 1932,
+    1930, 1928, 1930, 1946, 1940, 1940, 1932, 1930, 1930, 1936, 1942, 1944, 1942, 1948, 1950, 1958,
+    1962, 1970, 1964, 1970, 1976, 1990, 1992, 1990, 1994, 1998, 2002, 2020, 2028, 2030, 2030, 2032,
+    2046, 2060, 2064, 2062, 2062, 2062, 2068, 2078, 2084, 2084, 2078, 2076, 2086, 2092, 2088, 2080,
+    2066, 2054, 2050, 2044, 2034, 2012, 2004, 1996, 1986, 1972, 1966, 1960, 1944, 1940, 1944, 1950,
+    1946, 1938, 1936, 1932, 1932, 1942, 1938, 1940, 1932, 1922, 1924, 1930, 1936, 1936, 1932, 1936,
+    1934, 1940, 1944, 1946, 1938, 1934, 1938, 1950, 1950, 1948, 1942, 1942, 1952, 1956, 1958, 1956,
+    1946, 1946, 1954, 1968, 1984, 1988, 1976, 1976, 1984, 1996, 2004, 2006, 2010, 2010, 2010, 2016,
+    2020, 2008, 1994, 1986, 1988, 1992, 1988, 1984, 1958, 1950, 1946, 1956, 1958, 1950, 1936, 1926,
+    1934, 1936, 1940, 1938, 1928, 1924, 1926, 1936, 1946, 1942, 1934, 1934, 1944, 1956, 1960, 1960,
+    1962, 1980, 2036, 2130, 2252, 2372, 2492, 2606, 2714, 2814, 2872, 2856, 2732, 2556, 2362, 2192,
+    2072, 2010, 1980, 1958, 1948, 1954, 1958, 1948, 1938, 1920, 1912, 1912, 1900, 1900, 1896, 1896,
+    1894, 1900, 1892, 1898, 1898, 1898, 1898, 1896, 1906, 1906, 1902, 1894, 1896, 1894, 1898, 1914,
+    1906, 1902, 1912, 1924, 1926, 1924, 1916, 1908, 1918, 1930, 1934, 1940, 1938, 1940, 1948, 1956,
+    1954, 1954, 1954, 1958, 1962, 1978, 1984, 1984, 1988, 1976, 1976, 1982, 1994, 2002, 2008, 2006,
+    2002, 1998, 2004, 2004, 2008, 2006, 2004, 2006, 2004, 2000, 1988, 1976, 1976, 1974, 1976, 1974,
+    1964, 1960, 1958, 1958, 1952, 1944, 1936, 1926, 1934, 1942, 1938, 1932, 1922, 1924, 1932, 1944,
+    1938, 1932, 1922, 1916, 1922, 1924, 1930, 1924, 1924, 1918, 1924, 1926, 1932, 1936, 1920, 1914,
+    1924, 1930, 1934, 1928, 1916, 1912, 1914, 1918, 1916, 1910, 1908, 1916, 1934, 1946, 1952, 1954,
+    1944, 1940, 1942, 1946, 1944, 1944, 1952, 1958, 1964, 1972, 1978, 1982, 1978, 1978, 1976, 1960,
+    1954, 1948, 1930, 1920, 1924, 1922, 1924, 1912, 1902, 1888, 1880, 1882, 1890, 1884, 1894, 1900,
+    1906, 1910, 1912, 1920, 1930, 1934, 1930, 1932, 1934, 1934, 1932, 1928, 1930, 1928, 1920, 1908,
+    1908, 1942, 1990, 2062, 2136, 2226, 2324, 2432, 2528, 2576, 2526, 2396, 2230, 2078, 1972, 1934,
+    1928, 1928, 1912, 1904, 1912, 1932, 1938, 1934, 1912, 1902, 1896, 1900, 1898, 1896, 1884, 1872,
+    1870, 1864, 1868, 1872, 1872, 1868, 1870, 1874, 1874, 1874, 1868, 1868, 1862, 1874, 1876, 1878,
+    1872, 1876, 1888, 1898, 1908, 1912, 1904, 1902, 1900, 1914, 1924, 1924, 1912, 1906, 1910, 1916,
+    1932, 1946, 1944, 1944, 1946, 1952, 1964, 1972, 1970, 1964, 1974, 1976, 1984, 1988, 1982, 1986,
+    1994, 2012, 2026, 2030, 2036, 2034, 2038, 2044, 2058, 2056, 2060, 2052, 2056, 2054, 2050, 2048,
+    2032, 2022, 2016, 2018, 2010, 2006, 1994, 1982, 1982, 1974, 1962, 1952, 1932, 1920, 1918, 1914,
+    1906, 1904, 1898, 1900, 1904, 1904, 1906, 1906, 1896, 1890, 1886, 1890, 1890, 1888, 1882, 1884,
+    1894, 1904, 1902, 1906, 1900, 1896, 1900, 1908, 1908, 1910, 1898, 1890, 1882, 1894, 1898, 1902,
+    1906, 1910, 1910, 1912, 1910, 1910, 1904, 1900, 1902, 1912, 1914, 1920, 1918, 1920, 1918, 1930,
+    1932, 1942, 1936, 1942, 1956, 1964, 1972, 1974, 1978, 1980, 1982, 1978, 1972, 1972, 1964, 1952,
+    1946, 1938, 1932, 1924, 1914, 1912, 1912, 1914, 1916, 1908, 1912, 1912, 1916, 1920, 1914, 1902,
+    1896, 1894, 1898, 1900, 1896, 1888, 1886, 1890, 1906, 1918, 1922, 1914, 1898, 1886, 1882, 1880,
+    1882, 1888, 1900, 1942, 1992, 2066, 2146, 2238, 2328, 2422, 2506, 2572, 2556, 2440, 2274, 2108,
+    1976, 1904, 1890, 1888, 1894, 1898, 1898, 1914, 1924, 1926, 1918, 1904, 1906, 1906, 1902, 1902,
+    1896, 1892, 1904, 1908, 1920, 1914, 1908, 1900, 1904, 1914, 1920, 1928, 1920, 1918, 1914, 1924,
+    1926, 1922, 1916, 1914, 1926, 1936, 1938, 1942, 1942, 1954, 1962, 1958, 1966, 1972, 1972, 1966,
+    1960, 1968, 1978, 1984, 1982, 1984, 1988, 2006, 2016, 2020, 2020, 2018, 2018, 2028, 2040, 2044,
+    2040, 2034, 2048, 2062, 2076, 2074, 2072, 2062, 2070, 2084, 2096, 2096, 2104, 2098, 2098, 2102,
+    2112, 2106, 2094, 2080, 2078, 2080, 2082, 2074, 2068, 2062, 2062, 2062, 2060, 2056, 2042, 2028,
+    2010, 1998, 2002, 2004, 1996, 1996, 1992, 1992, 1990, 1998, 1992, 1984, 1980, 1984, 1986, 1984,
+    1966, 1956, 1954, 1966, 1986, 1990, 1984, 1974, 1972, 1986, 2000, 1996, 1986, 1984, 1986, 1990,
+    2000, 2002, 1998, 1990, 1992, 1992, 1992, 1996, 1990, 1986, 1992, 1998, 2008, 2010, 2004, 2004,
+    2010, 2020, 2026, 2034, 2034, 2040, 2052, 2060, 2066, 2068, 2060, 2054, 2054, 2064, 2064, 2062,
+    2046, 2026, 2020, 2016, 2026, 2030, 2026, 2016, 2014, 2016, 2026, 2032, 2028, 2016, 2016, 2016,
+    2022, 2024, 2016, 2008, 2006, 2010, 2016, 2012, 2000, 1992, 1996, 2000, 2012, 2018, 2006, 1990,
+    1980, 1994, 2034, 2096, 2160, 2228, 2330, 2442, 2556, 2634, 2654, 2592, 2462, 2302, 2144, 2018,
+    1956, 1946, 1952, 1962, 1980, 1982, 1984, 1990, 1990, 1996, 1994, 1988, 1976, 1976, 1988, 2006,
+    2010, 2004, 1978, 1954, 1954, 1964, 1972, 1978, 1970, 1970, 1972, 1984, 1992, 1994, 1996, 1992,
+    1984, 1982, 1986, 1990, 1994, 1992, 2002, 2002, 2006, 2010, 2002, 2000, 2002, 2010, 2022, 2040,
+    2052, 2052, 2046, 2036, 2034, 2044, 2050, 2056, 2054, 2066, 2088, 2100, 2106, 2104, 2104, 2104,
+    2100, 2110, 2122, 2148, 2162, 2168, 2150, 2136, 2124, 2126, 2144, 2160, 2166, 2158, 2134, 2120,
+    2118, 2120, 2138, 2150, 2140, 2132, 2116, 2108, 2116, 2110, 2092, 2072, 2062, 2056, 2044, 2028,
+    2024, 2028, 2040, 2056, 2068, 2056, 2030, 1996, 1976, 1980, 1984, 1984, 1974, 1976, 1980, 1988,
+    1990, 1978, 1958, 1948, 1948, 1970, 1994, 2000, 1984, 1966, 1954, 1948, 1964, 1974, 1984, 1986,
+    2000, 2006, 2006, 2002, 1988, 1980, 1986, 2006, 2016, 2014, 2000, 2000, 2010, 2026, 2042, 2038,
+    2028, 2026, 2038, 2054, 2068, 2066, 2054, 2048, 2052, 2068, 2080, 2088, 2078, 2068, 2062, 2066,
+    2082, 2094, 2082, 2066, 2058, 2066, 2090, 2102, 2088, 2092, 2102, 2124, 2156, 2188, 2210, 2218,
+    2236, 2262, 2294, 2316, 2330, 2360, 2412, 2466, 2506, 2544, 2568, 2594, 2634, 2668, 2678, 2660,
+    2610, 2562, 2532, 2506, 2496, 2486, 2476, 2458, 2450, 2446, 2448, 2452, 2444, 2438, 2398, 2352,
+    2312, 2266, 2202, 2132, 2066, 2002, 1962, 1932, 1914, 1904, 1904, 1894, 1890, 1876, 1858, 1850,
+    1842, 1836, 1846, 1850, 1850, 1854, 1848, 1832, 1820, 1816, 1818, 1810, 1814, 1800, 1808, 1814,
+    1820, 1816, 1804, 1796, 1804, 1808, 1798, 1794, 1786, 1784, 1774, 1770, 1754, 1744, 1738, 1750,
+    1764, 1776, 1772, 1758, 1762, 1768, 1772, 1778, 1772, 1754, 1750, 1764, 1786, 1792, 1780, 1780,
+    1792, 1804, 1810, 1814, 1820, 1830, 1844, 1860, 1870, 1878, 1886, 1892, 1898, 1922, 1942, 1954,
+    1958, 1960, 1958, 1964, 1974, 1984, 1986, 1982, 1990, 2004, 2018, 2020, 2002, 1998, 1994, 1994,
+    1988, 1984, 1984, 1992, 2000, 1996, 1996, 1998, 1996, 1992, 2004, 2008, 2000, 1986, 1980, 1992,
+    1992, 1986, 1984, 1988, 1988, 1980, 1980, 1992, 2004, 2000, 1994, 2002, 2000, 1998, 1994, 2004,
+    2008, 2006, 2010, 2030, 2054, 2064, 2026, 2000, 2002, 2024, 2040, 2046, 2044, 2032, 2032, 2046,
+    2056, 2058, 2056, 2062, 2070, 2078, 2082, 2086, 2084, 2078, 2090, 2098, 2102, 2090, 2076, 2068,
+    2070, 2072, 2068, 2058, 2042, 2034, 2032, 2034, 2042, 2036, 2028, 2020, 2012, 2012, 2014, 2012,
+    2008, 2000, 2000, 2006, 2012, 2018, 2010, 1998, 2002, 2008, 2018, 2016, 2004, 1992, 1990, 1998,
+    2002, 1992, 1984, 1992, 2026, 2092, 2176, 2276, 2362, 2450, 2536, 2622, 2694, 2706, 2630, 2462,
+    2262, 2082, 1962, 1920, 1924, 1948, 1966, 1990, 2008, 2020, 2012, 2000, 1994, 1990, 2004, 2002,
+    1992, 1984, 1978, 1988, 1998, 2000, 2002, 1992, 1988, 1990, 1998, 2004, 1994, 1992, 1994, 1998,
+    2004, 2002, 2004, 2002, 1998, 2006, 2010, 2014, 2012, 2006, 2006, 2010, 2018, 2028, 2030, 2028,
+    2032, 2032, 2030, 2038, 2046, 2048, 2048, 2054, 2066, 2076, 2076, 2078, 2092, 2098, 2104, 2108,
+    2112, 2112, 2122, 2130, 2142, 2140, 2132, 2128, 2136, 2150, 2158, 2166, 2174, 2184, 2182, 2190,
+    2186, 2182, 2178, 2178, 2170, 2152, 2134, 2122, 2116, 2128, 2144, 2148, 2140, 2130, 2116, 2118,
+    2112, 2100, 2064, 2030, 2010, 2012, 2022, 2030, 2036, 2026, 2014, 1990, 1964, 1948, 1952, 1964,
+    1970, 1988, 2006, 2016, 2018, 2002, 1984, 1990, 2028, 2068, 2078, 2056, 2012, 1980, 1974, 1984,
+    1982, 1976, 1960, 1958, 1960, 1952, 1968, 1998, 2012, 2002, 1974, 1958, 1968, 1988, 2002, 2018,
+    2028, 2028, 2024, 2012, 2008, 1986, 1972, 1968, 1984, 2000, 2002, 1990, 1994, 2018, 2024, 2024,
+    2020, 2012, 2012, 2008, 2008, 2022, 2022, 2024, 2032, 2038, 2052, 2048, 2038, 2026, 2028, 2030,
+    2034, 2016, 2000, 1978, 1972, 1972, 1980, 1974, 1972, 1956, 1962, 1966, 1972, 1974, 1968, 1962,
+    1958, 1956, 1966, 1964, 1948, 1934, 1942, 1958, 1966, 1972, 1960, 1958, 1956, 1966, 2000, 2058,
+    2134, 2228, 2326, 2426, 2532, 2622, 2670, 2640, 2530, 2374, 2210, 2060, 1960, 1930, 1948, 1962,
+    1960, 1950, 1954, 1952, 1950, 1958, 1960, 1956, 1948, 1938, 1936, 1944, 1948, 1950, 1936, 1932,
+    1930, 1938, 1944, 1946, 1936, 1936, 1942, 1950, 1956, 1962, 1958, 1958, 1958, 1956, 1954, 1960,
+    1956, 1962, 1964, 1970, 1980, 1982, 1976, 1972, 1970, 1978, 1990, 1994, 1990, 1986, 1992, 1994,
+    2004, 2008, 2008, 2002, 2008, 2018, 2030, 2038, 2040, 2044, 2046, 2052, 2060, 2066, 2068, 2070,
+    2078, 2078, 2086, 2096, 2088, 2086, 2088, 2096, 2092, 2092, 2086, 2072, 2066, 2058, 2052, 2040,
+    2028, 2020, 2010, 2002, 2002, 1994, 1986, 1980, 1966, 1966, 1966, 1960, 1950, 1938, 1934, 1938,
+    1936, 1934, 1934, 1926, 1918, 1924, 1934, 1940, 1938, 1932, 1926, 1928, 1926, 1924, 1920, 1916,
+    1920, 1922, 1922, 1930, 1930, 1932, 1932, 1936, 1940, 1938, 1930, 1922, 1914, 1918, 1918, 1930,
+    1926, 1916, 1918, 1926, 1928, 1932, 1934, 1930, 1924, 1922, 1924, 1922, 1918, 1904, 1906, 1912,
+    1922, 1928, 1922, 1910, 1902, 1910, 1922, 1930, 1922, 1912, 1908, 1914, 1916, 1916, 1914, 1916,
+    1918, 1922, 1932, 1942, 1946, 1960, 1984, 2014, 2044, 2060, 2074, 2102, 2142, 2180, 2220, 2258,
+    2288, 2314, 2350, 2394, 2446, 2492, 2532, 2566, 2598, 2616, 2606, 2576, 2540, 2492, 2462, 2436,
+    2426, 2410, 2380, 2346, 2328, 2318, 2320, 2312, 2298, 2292, 2296, 2302, 2294, 2272, 2234, 2186,
+    2122, 2052, 1974, 1904, 1856, 1822, 1794, 1788, 1778, 1770, 1758, 1744, 1740, 1736, 1730, 1724,
+    1712, 1700, 1692, 1696, 1692, 1690, 1680, 1670, 1670, 1668, 1672, 1670, 1656, 1638, 1632, 1632,
+    1630, 1626, 1618, 1612, 1608, 1610, 1612, 1602, 1592, 1576, 1570, 1572, 1570, 1570, 1560, 1548,
+    1546, 1552, 1556, 1548, 1554, 1552, 1554, 1560, 1568, 1566, 1572, 1576, 1578, 1588, 1600, 1622,
+    1622, 1632, 1646, 1666, 1690, 1710, 1728, 1736, 1748, 1764, 1782, 1792, 1792, 1796, 1810, 1820,
+    1830, 1840, 1844, 1846, 1850, 1858, 1862, 1844, 1836, 1832, 1832, 1842, 1846, 1842, 1838, 1834,
+    1836, 1844, 1864, 1860, 1850, 1840, 1834, 1836, 1834, 1836, 1830, 1822, 1822, 1836, 1844, 1838,
+    1834, 1832, 1834, 1844, 1852, 1864, 1866, 1860, 1834, 1804, 1796, 1812, 1810, 1820, 1814, 1816,
+    1828, 1838, 1834, 1828, 1830, 1836, 1842, 1836, 1830, 1820, 1826, 1844, 1848, 1856, 1842, 1822,
+    1824, 1828, 1838, 1844, 1842, 1844, 1854, 1866, 1862, 1850, 1830, 1830, 1848, 1860, 1866, 1856,
+    1852, 1862, 1874, 1880, 1872, 1864, 1858, 1858, 1858, 1874, 1882, 1886, 1884, 1892, 1894, 1896,
+    1886, 1872, 1864, 1864, 1890, 1904, 1900, 1878, 1856, 1858, 1872, 1886, 1890, 1886, 1876, 1874,
+    1874, 1888, 1896, 1888, 1866, 1852, 1854, 1868, 1880, 1882, 1880, 1872, 1874, 1880, 1892, 1890,
+    1890, 1890, 1890, 1894, 1912, 1918, 1926, 1922, 1926, 1930, 1928, 1920, 1912, 1904, 1900, 1900,
+    1906, 1904, 1894, 1898, 1894, 1906, 1910, 1900, 1898, 1896, 1904, 1910, 1916, 1918, 1912, 1918,
+    1924, 1932, 1942, 1950, 1942, 1934, 1934, 1942, 1958, 1964, 1984, 2014, 2058, 2120, 2208, 2288,
+    2378, 2462, 2540, 2586, 2572, 2458, 2302, 2156, 2032, 1968, 1960, 1964, 1944, 1926, 1930, 1946,
+    1962, 1954, 1948, 1940, 1932, 1936, 1932, 1934, 1920, 1914, 1914, 1918, 1928, 1930, 1934, 1930,
+    1926, 1930, 1930, 1932, 1926, 1918, 1920, 1924, 1936, 1944, 1948, 1942, 1940, 1944, 1950, 1950,
+    1944, 1934, 1942, 1952, 1964, 1976, 1978, 1980, 1980, 1992, 1998, 2004, 2008, 2012, 2020, 2028,
+    2042, 2052, 2054, 2050, 2048, 2058, 2064, 2074, 2072, 2080, 2076, 2090, 2106, 2112, 2116, 2114,
+    2116, 2118, 2126, 2126, 2130, 2128, 2126, 2134, 2142, 2136, 2130, 2124, 2118, 2116, 2118, 2104,
+    2090, 2068, 2056, 2052, 2040, 2034, 2016, 2004, 1996, 1988, 1982, 1978, 1970, 1964, 1958, 1954,
+    1950, 1944, 1938, 1932, 1934, 1936, 1938, 1942, 1934, 1934, 1932, 1930, 1936, 1934, 1930, 1928,
+    1922, 1924, 1928, 1922, 1926, 1928, 1940, 1958, 1966, 1956, 1930, 1910, 1898, 1908, 1928, 1940,
+    1940, 1938, 1934, 1930, 1922, 1928, 1926, 1926, 1938, 1948, 1956, 1954, 1942, 1920, 1918, 1924,
+    1938, 1956, 1954, 1944, 1938, 1940, 1956, 1962, 1960, 1948, 1946, 1948, 1966, 1970, 1974, 1972,
+    1980, 1994, 2008, 2014, 2010, 2002, 1992, 1990, 1992, 1980, 1962, 1940, 1930, 1940, 1950, 1954,
+    1944, 1934, 1938, 1948, 1966, 1982, 1996, 2010, 2036, 2070, 2098, 2124, 2148, 2176, 2206, 2246,
+    2278, 2298, 2314, 2324, 2342, 2374, 2408, 2444, 2490, 2552, 2628, 2704, 2764, 2802, 2824, 2840,
+    2814, 2708, 2530, 2354, 2210, 2108, 2046, 2002, 1962, 1932, 1910, 1892, 1892, 1890, 1888, 1880,
+    1874, 1860, 1850, 1846, 1844, 1846, 1836, 1832, 1834, 1846, 1850, 1844, 1830, 1810, 1802, 1808,
+    1820, 1830, 1824, 1814, 1816, 1820, 1828, 1828, 1824, 1814, 1822, 1830, 1838, 1822, 1808, 1800,
+    1810, 1812, 1806, 1784, 1764, 1768, 1774, 1790, 1800, 1800, 1798, 1792, 1792, 1810, 1828, 1832,
+    1828, 1820, 1810, 1796, 1790, 1796, 1804, 1802, 1806, 1820, 1838, 1838, 1834, 1830, 1838, 1848,
+    1870, 1882, 1878, 1880, 1884, 1898, 1912, 1918, 1916, 1912, 1910, 1916, 1922, 1918, 1916, 1908,
+    1908, 1914, 1922, 1922, 1912, 1910, 1910, 1916, 1920, 1924, 1912, 1904, 1906, 1910, 1918, 1916,
+    1914, 1914, 1912, 1916, 1920, 1926, 1920, 1912, 1912, 1910, 1918, 1918, 1920, 1906, 1912, 1916,
+    1924, 1932, 1934, 1934, 1940, 1954, 1968, 1976, 1990, 2000, 2010, 2034, 2060, 2090, 2118, 2136,
+    2166, 2202, 2238, 2276, 2296, 2332, 2362, 2396, 2418, 2432, 2448, 2464, 2482, 2488, 2486, 2474,
+    2442, 2410, 2384, 2370, 2356, 2342, 2310, 2282, 2280, 2282, 2282, 2288, 2286, 2284, 2276, 2262,
+    2234, 2186, 2116, 2044, 1996, 1964, 1946, 1926, 1900, 1870, 1842, 1824, 1820, 1816, 1810, 1798,
+    1790, 1786, 1776, 1784, 1784, 1774, 1772, 1768, 1772, 1770, 1762, 1748, 1746, 1748, 1748, 1742,
+    1736, 1730, 1730, 1734, 1736, 1738, 1724, 1714, 1720, 1722, 1718, 1712, 1706, 1698, 1698, 1704,
+    1708, 1702, 1694, 1688, 1694, 1698, 1702, 1702, 1700, 1694, 1698, 1710, 1720, 1726, 1732, 1728,
+    1744, 1752, 1768, 1780, 1788, 1794, 1802, 1814, 1828, 1836, 1834, 1838, 1850, 1856, 1866, 1872,
+    1880, 1870, 1878, 1882, 1882, 1884, 1878, 1878, 1870, 1878, 1880, 1886, 1890, 1882, 1884, 1894,
+    1898, 1902, 1896, 1890, 1886, 1890, 1898, 1898, 1900, 1896, 1896, 1904, 1912, 1920, 1910, 1908,
+    1902, 1904, 1910, 1910, 1908, 1906, 1904, 1908, 1918, 1918, 1914, 1906, 1904, 1916, 1924, 1922,
+    1910, 1906, 1908, 1910, 1916, 1922, 1918, 1914, 1916, 1916, 1922, 1918, 1916, 1910, 1912, 1920,
+    1926, 1928, 1918, 1910, 1914, 1922, 1924, 1934, 1926, 1922, 1926, 1914, 1922, 1924, 1918, 1916,
+    1920, 1922, 1930, 1930, 1922, 1924, 1924, 1926, 1936, 1926, 1928, 1916, 1916, 1918, 1926, 1930,
+    1932, 1932, 1932, 1932, 1932, 1930, 1936, 1932, 1930, 1926, 1936, 1936, 1936, 1932, 1928, 1934,
+    1940, 1944, 1936, 1934, 1938, 1942, 1940, 1942, 1948, 1944, 1936, 1942, 1946, 1948, 1948, 1948,
+    1944, 1952, 1966, 1980, 1984, 1978, 1980, 1986, 2006, 2010, 2010, 2008, 2004, 2010, 2012, 2006,
+    1994, 1982, 1976, 1972, 1978, 1974, 1968, 1962, 1960, 1956, 1958, 1958, 1952, 1950, 1950, 1952,
+    1958, 1962, 1954, 1956, 1964, 1972, 1972, 1970, 1966, 1958, 1950, 1948, 1962, 1986, 2020, 2066,
+    2128, 2218, 2322, 2420, 2500, 2554, 2600, 2614, 2548, 2406, 2230, 2058, 1952, 1928, 1942, 1954,
+    1954, 1950, 1958, 1968, 1976, 1978, 1970, 1964, 1966, 1964, 1966, 1962, 1954, 1952, 1954, 1960,
+    1972, 1974, 1966, 1968, 1962, 1962, 1966, 1968, 1970, 1968, 1966, 1960, 1964, 1970, 1970, 1964,
+    1966, 1968, 1976, 1978, 1978, 1968, 1976, 1986, 1996, 1996, 1994, 1988, 1994, 1994, 2004, 2008,
+    2006, 2000, 2006, 2008, 2018, 2022, 2028, 2026, 2030, 2036, 2046, 2052, 2054, 2050, 2054, 2058,
+    2064, 2070, 2070, 2066, 2068, 2080, 2086, 2094, 2092, 2088, 2084, 2094, 2108, 2112, 2110, 2102,
+    2100, 2106, 2108, 2112, 2106, 2102, 2098, 2096, 2100, 2100, 2088, 2074, 2062, 2056, 2052, 2044,
+    2032, 2022, 2012, 2014, 2018, 2016, 2010, 2002, 2000, 1998, 2004, 2000, 1990, 1988, 1978, 1982,
+    1988, 1988, 1986, 1982, 1976, 1982, 1986, 1986, 1980, 1978, 1980, 1982, 1986, 1988, 1986, 1980,
+    1968, 1964, 1970, 1976, 1974, 1968, 1960, 1962, 1966, 1968, 1964, 1958, 1952, 1954, 1954, 1942,
+    1930, 1918, 1912, 1916, 1922, 1918, 1916, 1912, 1910, 1926, 1938, 1946, 1944, 1952, 1956, 1964,
+    1968, 1970, 1978, 1984, 1986, 1998, 2004, 2014, 2014, 2012, 2010, 2010, 2016, 2018, 2026, 2032,
+    2040, 2058, 2084, 2118, 2156, 2182, 2216, 2238, 2260, 2296, 2334, 2360, 2388, 2426, 2474, 2508,
+    2532, 2556, 2576, 2598, 2600, 2590, 2558, 2534, 2506, 2494, 2496, 2484, 2470, 2450, 2442, 2444,
+    2448, 2436, 2420, 2406, 2396, 2378, 2344, 2302, 2238, 2144, 2034, 1944, 1886, 1852, 1834, 1828,
+    1820, 1814, 1810, 1802, 1790, 1778, 1772, 1772, 1776, 1776, 1770, 1770, 1768, 1762, 1754, 1744,
+    1744, 1740, 1736, 1736, 1734, 1742, 1734, 1728, 1726, 1736, 1734, 1722, 1708, 1704, 1694, 1694,
+    1690, 1686, 1672, 1666, 1656, 1664, 1668, 1666, 1662, 1654, 1650, 1652, 1656, 1654, 1650, 1644,
+    1642, 1642, 1656, 1672, 1680, 1676, 1684, 1698, 1712, 1734, 1744, 1746, 1762, 1778, 1794, 1804,
+    1806, 1816, 1826, 1848, 1868, 1878, 1884, 1890, 1898, 1906, 1916, 1922, 1924, 1918, 1910, 1912,
+    1914, 1916, 1910, 1906, 1906, 1908, 1912, 1910, 1912, 1912, 1912, 1912, 1922, 1924, 1918, 1908,
+    1910, 1918, 1924, 1920, 1918, 1918, 1926, 1926, 1934, 1934, 1934, 1940, 1936, 1946, 1950, 1948,
+    1934, 1932, 1932, 1938, 1938, 1940, 1944, 1940, 1938, 1938, 1940, 1944, 1948, 1944, 1946, 1944,
+    1946, 1952, 1940, 1942, 1934, 1950, 1954, 1956, 1954, 1954, 1952, 1960, 1968, 1970, 1980, 1976,
+    1986, 1994, 2004, 2000, 1998, 1994, 2004, 2018, 2034, 2038, 2042, 2040, 2042, 2048, 2050, 2046,
+    2042, 2028, 2020, 2006, 2002, 1992, 1988, 1982, 1976, 1972, 1968, 1964, 1962, 1954, 1952, 1952,
+    1954, 1950, 1946, 1942, 1934, 1936, 1938, 1942, 1940, 1928, 1932, 1932, 1934, 1948, 1954, 1950,
+    1936, 1940, 1942, 1960, 1984, 2018, 2074, 2144, 2240, 2346, 2440, 2526, 2590, 2604, 2532, 2380,
+    2216, 2072, 1984, 1954, 1944, 1934, 1920, 1920, 1942, 1960, 1958, 1950, 1938, 1936, 1936, 1938,
+    1928, 1928, 1924, 1928, 1940, 1940, 1932, 1932, 1930, 1930, 1930, 1934, 1946, 1962, 1958, 1946,
+    1944, 1948, 1952, 1954, 1952, 1948, 1952, 1956, 1956, 1966, 1958, 1958, 1954, 1960, 1970, 1984,
+    1982, 1982, 1982, 1982, 1994, 2004, 2026, 2022, 2022, 2022, 2030, 2036, 2036, 2034, 2034, 2044,
+    2062, 2076, 2084, 2092, 2098, 2110, 2110, 2102, 2092, 2076, 2082, 2078, 2082, 2092, 2094, 2094,
+    2092, 2094, 2098, 2098, 2104, 2088, 2080, 2072, 2070, 2070, 2064, 2056, 2052, 2044, 2034, 2016,
+    2000, 1980, 1972, 1982, 1988, 1974, 1968, 1954, 1948, 1950, 1952, 1948, 1938, 1936, 1934, 1932,
+    1934, 1938, 1930, 1920, 1914, 1916, 1918, 1918, 1912, 1900, 1902, 1912, 1930, 1940, 1940, 1930,
+    1920, 1930, 1946, 1950, 1944, 1934, 1936, 1928, 1920, 1920, 1912, 1908, 1910, 1920, 1926, 1930,
+    1932, 1938, 1944, 1954, 1954, 1948, 1938, 1932, 1944, 1958, 1976, 1980, 1988, 1992, 2000, 2002,
+    2010, 2014, 2022, 2026, 2032, 2034, 2026, 2020, 2014, 2014, 2020, 2022, 2020, 2024, 2008, 1984,
+    1968, 1952, 1942, 1940, 1934, 1930, 1918, 1912, 1914, 1928, 1932, 1928, 1926, 1926, 1930, 1922,
+    1914, 1912, 1912, 1908, 1914, 1938, 1976, 2030, 2094, 2178, 2280, 2386, 2484, 2552, 2566, 2510,
+    2378, 2230, 2084, 1954, 1888, 1878, 1896, 1906, 1908, 1900, 1904, 1914, 1914, 1912, 1910, 1904,
+    1900, 1902, 1914, 1918, 1920, 1906, 1894, 1886, 1894, 1912, 1920, 1914, 1908, 1904, 1906, 1912,
+    1910, 1902, 1892, 1902, 1920, 1934, 1938, 1918, 1904, 1910, 1918, 1926, 1928, 1918, 1906, 1906,
+    1908, 1908, 1918, 1910, 1920, 1924, 1932, 1932, 1934, 1922, 1924, 1932, 1936, 1926, 1936, 1946,
+    1950, 1962, 1976, 1980, 1974, 1972, 1974, 1980, 1982, 1982, 1986, 1984, 1986, 1990, 1988, 1986,
+    1986, 1990, 1998, 2000, 2004, 1994, 1994, 2002, 2010, 2006, 1988, 1978, 1972, 1960, 1938, 1918,
+    1912, 1906, 1904, 1894, 1888, 1892, 1876, 1866, 1858, 1852, 1848, 1846, 1840, 1834, 1830, 1828,
+    1826, 1836, 1848, 1834, 1818, 1800, 1794, 1804, 1816, 1826, 1828, 1812, 1812, 1804, 1808, 1802,
+    1798, 1792, 1786, 1796, 1802, 1806, 1800, 1802, 1800, 1806, 1810, 1812, 1808, 1804, 1808, 1818,
+    1822, 1830, 1824, 1826, 1834, 1842, 1850, 1864, 1866, 1872, 1872, 1880, 1884, 1888, 1880, 1870,
+    1856, 1852, 1848, 1838, 1826, 1822, 1824, 1818, 1810, 1808, 1804, 1794, 1788, 1796, 1804, 1802,
+    1800, 1788, 1786, 1790, 1794, 1796, 1792, 1786, 1790, 1798, 1800, 1792, 1780, 1772, 1768, 1784,
+    1808, 1862, 1930, 2030, 2148, 2286, 2410, 2506, 2562, 2546, 2420, 2242, 2054, 1908, 1842, 1828,
+    1820, 1816, 1812, 1826, 1840, 1840, 1838, 1840, 1844, 1842, 1836, 1824, 1820, 1816, 1820, 1824,
+    1822, 1822, 1816, 1816, 1826, 1838, 1840, 1830, 1826, 1824, 1828, 1832, 1836, 1830, 1828, 1828,
+    1838, 1844, 1850, 1840, 1832, 1840, 1840, 1842, 1834, 1820, 1812, 1810, 1814, 1816, 1818, 1814,
+    1820, 1838, 1856, 1872, 1878, 1880, 1886, 1894, 1894, 1898, 1898, 1890, 1892, 1898, 1910, 1926,
+    1934, 1926, 1922, 1922, 1928, 1936, 1940, 1930, 1936, 1940, 1940, 1938, 1938, 1924, 1916, 1918,
+    1920, 1926, 1918, 1906, 1898, 1902, 1908, 1904, 1898, 1882, 1874, 1880, 1882, 1886, 1878, 1872,
+    1866, 1870, 1880, 1882, 1878, 1874, 1872, 1872, 1870, 1874, 1868, 1864, 1860, 1866, 1874, 1880,
+    1878, 1870, 1864, 1856, 1858, 1870, 1878, 1874, 1870, 1872, 1890, 1892, 1892, 1890, 1890, 1900,
+    1900, 1904, 1908, 1908, 1914, 1922, 1948, 1960, 1968, 1972, 1968, 1964, 1976, 1988, 1990, 1988,
+    1976, 1978, 1990, 1996, 1994, 1988, 1988, 1990, 1994, 2000, 1990, 1970, 1952, 1934, 1938, 1946,
+    1958, 1974, 1988, 2020, 2058, 2100, 2128, 2142, 2160, 2190, 2240, 2278, 2312, 2344, 2390, 2438,
+    2480, 2516, 2558, 2590, 2624, 2648, 2654, 2648, 2624, 2594, 2566, 2554, 2572, 2600, 2614, 2612,
+    2604, 2612, 2628, 2628, 2610, 2566, 2490, 2404, 2316, 2218, 2112, 2014, 1940, 1888, 1860, 1834,
+    1830, 1822, 1816, 1810, 1800, 1796, 1798, 1786, 1778, 1776, 1772, 1766, 1758, 1744, 1738, 1736,
+    1734, 1742, 1746, 1744, 1734, 1730, 1736, 1736, 1736, 1724, 1712, 1714, 1712, 1716, 1716, 1712,
+    1706, 1684, 1676, 1672, 1672, 1658, 1646, 1650, 1658, 1668, 1656, 1644, 1634, 1634, 1628, 1630,
+    1632, 1620, 1622, 1622, 1632, 1640, 1650, 1650, 1658, 1666, 1684, 1690, 1700, 1700, 1714, 1740,
+    1762, 1782, 1782, 1794, 1798, 1804, 1816, 1828, 1846, 1860, 1864, 1866, 1876, 1880, 1880, 1876,
+    1870, 1878, 1868, 1864, 1868, 1872, 1876, 1880, 1888, 1884, 1874, 1862, 1848, 1854, 1868, 1878,
+    1884, 1882, 1886, 1900, 1902, 1886, 1870, 1864, 1870, 1878, 1880, 1868, 1870, 1872, 1872, 1872,
+    1882, 1890, 1892, 1892, 1888, 1892, 1896, 1904, 1912, 1914, 1902, 1902, 1906, 1916, 1922, 1918,
+    1912, 1904, 1912, 1922, 1930, 1936, 1930, 1934, 1946, 1952, 1952, 1950, 1958, 1968, 1982, 1988,
+    1988, 1974, 1972, 1984, 2006, 2024, 2026, 2020, 2006, 2000, 2002, 2008, 2014, 1992, 1976, 1958,
+    1960, 1960, 1952, 1946, 1936, 1934, 1938, 1936, 1940, 1928, 1924, 1918, 1926, 1930, 1930, 1920,
+    1908, 1912, 1920, 1914, 1910, 1904, 1900, 1892, 1886, 1886, 1884, 1886, 1896, 1916, 1946, 2002,
+    2076, 2168, 2266, 2370, 2486, 2584, 2656, 2648, 2540, 2362, 2184, 2046, 1958, 1918, 1912, 1916,
+    1912, 1916, 1922, 1924, 1924, 1916, 1908, 1908, 1908, 1894, 1880, 1886, 1892, 1896, 1894, 1892,
+    1892, 1890, 1894, 1906, 1910, 1918, 1916, 1914, 1908, 1898, 1894, 1888, 1878, 1864, 1862, 1868,
+    1872, 1866, 1868, 1870, 1886, 1904, 1912, 1912, 1908, 1916, 1920, 1932, 1938, 1938, 1936, 1936,
+    1948, 1960, 1966, 1968, 1976, 1986, 1992, 1984, 1974, 1976, 1996, 2008, 2018, 2016, 2008, 2010,
+    2010, 2024, 2036, 2050, 2056, 2056, 2054, 2068, 2094, 2102, 2098, 2078, 2064, 2060, 2062, 2052,
+    2052, 2046, 2034, 2022, 2020, 2008, 2004, 1998, 1992, 1990, 1992, 1988, 1980, 1970, 1958, 1952,
+    1950, 1948, 1942, 1938, 1934, 1930, 1922, 1914, 1912, 1904, 1894, 1896, 1896, 1902, 1902, 1904,
+    1910, 1924, 1940, 1944, 1936, 1940, 1932, 1938, 1948, 1958, 1966, 1958, 1962, 1966, 1968, 1968,
+    1970, 1962, 1956, 1958, 1962, 1960, 1962, 1962, 1942, 1940, 1942, 1944, 1936, 1932, 1924, 1930,
+    1948, 1964, 1966, 1958, 1940, 1936, 1940, 1962, 1972, 1974, 1968, 1974, 1986, 1996, 1998, 1996,
+    1992, 1990, 1998, 2006, 2018, 2010, 1994, 1998, 2006, 2014, 2002, 1988, 1976, 1974, 1968, 1972,
+    1972, 1968, 1956, 1962, 1976, 1980, 1980, 1974, 1964, 1960, 1964, 1980, 1982, 1978, 1966, 1968,
+    1980, 1984, 1976, 1960, 1950, 1948, 1978, 2018, 2080, 2160, 2278, 2402, 2516, 2624, 2688, 2676,
+    2548, 2366, 2186, 2058, 2004, 1998, 1994, 1976, 1964, 1968, 1982, 1984, 1980, 1976, 1972, 1972,
+    1958, 1950, 1946, 1948, 1952, 1958, 1962, 1964, 1956, 1946, 1952, 1956, 1956, 1952, 1956, 1958,
+    1960, 1964, 1958, 1962, 1960, 1966, 1976, 1974, 1972, 1970, 1968, 1974, 1990, 1988, 1990, 1978,
+    1974, 1982, 1998, 2006, 2012, 2012, 2008, 2004, 2014, 2022, 2028, 2026, 2026, 2030, 2038, 2050,
+    2058, 2052, 2052, 2058, 2074, 2086, 2090, 2086, 2084, 2086, 2090, 2098, 2094, 2092, 2088, 2080,
+    2074, 2078, 2068, 2062, 2052, 2042, 2040, 2030, 2028, 2016, 2006, 2008, 2008, 2006, 2000, 1994,
+    1992, 1990, 1988, 1990, 1986, 1982, 1978, 1980, 1988, 1992, 1988, 1984, 1982, 1988, 1992, 1986,
+    1982, 1972, 1974, 1978, 1976, 1976, 1974, 1968, 1964, 1956, 1958, 1956, 1950, 1940, 1936, 1936,
+    1944, 1956, 1956, 1958, 1952, 1952, 1962, 1964, 1966, 1964, 1960, 1964, 1970, 1974, 1972, 1974,
+    1974, 1968, 1968, 1970, 1966, 1964, 1962, 1962, 1968, 1970, 1968, 1964, 1968, 1982, 2004, 2026,
+    2054, 2066, 2074, 2098, 2130, 2180, 2216, 2244, 2280, 2312, 2350, 2386, 2420, 2444, 2470, 2502,
+    2530, 2558, 2588, 2602, 2606, 2590, 2568, 2544, 2526, 2496, 2476, 2464, 2462, 2454, 2438, 2414,
+    2396, 2382, 2372, 2374, 2382, 2376, 2360, 2340, 2310, 2260, 2190, 2102, 2014, 1940, 1892, 1860,
+    1850, 1836, 1822, 1820, 1824, 1824, 1816, 1798, 1784, 1784, 1784, 1792, 1794, 1790, 1786, 1782,
+    1782, 1778, 1774, 1768, 1754, 1752, 1766, 1778, 1780, 1764, 1750, 1740, 1728, 1732, 1736, 1728,
+    1728, 1740, 1740, 1736, 1722, 1706, 1700, 1702, 1698, 1704, 1702, 1698, 1698, 1688, 1694, 1694,
+    1702, 1704, 1706, 1706, 1710, 1726, 1724, 1712, 1704, 1724, 1758, 1782, 1794, 1792, 1794, 1804,
+    1820, 1834, 1838, 1836, 1836, 1840, 1852, 1880, 1888, 1876, 1882, 1894, 1912, 1930, 1936, 1930,
+    1938, 1934, 1928, 1920, 1908, 1902, 1914, 1930, 1934, 1936, 1936, 1930, 1922, 1918, 1932, 1942,
+    1938, 1924, 1922, 1934, 1950, 1954, 1948, 1938, 1942, 1944, 1948, 1954, 1966, 1958, 1952, 1954,
+    1952, 1958, 1958, 1950, 1944, 1950, 1954, 1958, 1960, 1964, 1978, 1992, 1992, 1970, 1950, 1936,
+    1934, 1936, 1946, 1954, 1964, 1968, 1966, 1968, 1966, 1970, 1974, 1960, 1954, 1956, 1966, 1974,
+    1976, 1970, 1958, 1952, 1952, 1954, 1964, 1958, 1960, 1966, 1974, 1976, 1972, 1970, 1974, 1976,
+    1980, 1986, 1992, 1986, 1976, 1976, 1978, 1992, 1992, 1976, 1978, 1990, 2004, 2020, 2028, 2022,
+    2012, 2012, 2022, 2036, 2044, 2042, 2040, 2048, 2056, 2054, 2054, 2042, 2026, 2026, 2030, 2030,
+    2018, 1998, 1986, 1992, 2006, 2012, 2010, 1984, 1966, 1956, 1966, 1978, 1986, 1980, 1980, 1984,
+    1990, 1996, 2006, 2004, 1992, 1984, 1988, 1986, 1988, 1978, 1972, 1988, 2030, 2102, 2174, 2260,
+    2360, 2458, 2554, 2620, 2612, 2502, 2342, 2180, 2046, 1976, 1964, 1966, 1968, 1972, 1984, 2000,
+    2006, 1996, 1984, 1980, 1982, 1988, 1992, 1986, 1976, 1964, 1964, 1970, 1974, 1978, 1972, 1976,
+    1978, 1984, 1982, 1972, 1968, 1970, 1984, 1988, 1984, 1974, 1974, 1974, 1984, 1994, 2008, 2006,
+    1998, 2002, 2008, 2022, 2018, 2010, 2006, 2008, 2028, 2044, 2058, 2060, 2056, 2056, 2070, 2080,
+    2086, 2086, 2092, 2102, 2112, 2116, 2130, 2120, 2126, 2142, 2140, 2144, 2142, 2140, 2134, 2138,
+    2134, 2134, 2128, 2110, 2092, 2080, 2074, 2080, 2064, 2046, 2024, 2022, 2010, 2006, 2008, 1996,
+    1982, 1976, 1976, 1980, 1974, 1966, 1968, 1972, 1974, 1966, 1958, 1954, 1946, 1946, 1948, 1954,
+    1952, 1948, 1950, 1958, 1966, 1970, 1964, 1960, 1960, 1958, 1960, 1958, 1958, 1950, 1944, 1952,
+    1954, 1960, 1958, 1962, 1952, 1950, 1942, 1948, 1962, 1960, 1956, 1944, 1938, 1944, 1952, 1956,
+    1954, 1954, 1954, 1968, 1970, 1964, 1966, 1970, 1968, 1970, 1976, 1986, 1994, 2006, 2006, 2004,
+    2008, 2000, 1996, 1998, 2002, 2004, 1998, 1984, 1966, 1952, 1948, 1948, 1944, 1938, 1930, 1928,
+    1926, 1930, 1938, 1934, 1934, 1938, 1948, 1958, 1976, 1984, 1992, 2012, 2042, 2074, 2096, 2124,
+    2144, 2164, 2182, 2214, 2234, 2246, 2262, 2306, 2370, 2460, 2548, 2636, 2722, 2794, 2854, 2856,
+    2752, 2558, 2324, 2136, 2020, 1974, 1954, 1930, 1914, 1902, 1908, 1920, 1910, 1892, 1870, 1864,
+    1866, 1872, 1876, 1864, 1858, 1852, 1854, 1858, 1864, 1856, 1842, 1842, 1848, 1850, 1852, 1842,
+    1842, 1840, 1844, 1846, 1848, 1836, 1832, 1838, 1844, 1850, 1846, 1840, 1828, 1822, 1828, 1832,
+    1822, 1826, 1816, 1814, 1818, 1830, 1828, 1820, 1800, 1798, 1802, 1816, 1818, 1818, 1820, 1834,
+    1842, 1846, 1840, 1832, 1832, 1832, 1828, 1832, 1826, 1820, 1818, 1826, 1824, 1826, 1822, 1820,
+    1816, 1824, 1830, 1834, 1832, 1834, 1846, 1858, 1870, 1876, 1872, 1872, 1870, 1874, 1878, 1876,
+    1876, 1872, 1870, 1868, 1866, 1880, 1892, 1900, 1904, 1914, 1918, 1928, 1928, 1922, 1930, 1930,
+    1936, 1930, 1932, 1926, 1922, 1926, 1928, 1932, 1924, 1922, 1926, 1930, 1932, 1932, 1930, 1924,
+    1910, 1918, 1926, 1932, 1932, 1926, 1910, 1912, 1914, 1912, 1914, 1906, 1894, 1892, 1904, 1906,
+    1902, 1896, 1892, 1900, 1908, 1912, 1910, 1894, 1888, 1888, 1884, 1904, 1912, 1920, 1930, 1940,
+    1956, 1980, 2002, 2018, 2044, 2076, 2108, 2140, 2164, 2172, 2188, 2216, 2246, 2282, 2318, 2348,
+    2370, 2396, 2422, 2454, 2484, 2508, 2528, 2554, 2552, 2542, 2512, 2474, 2438, 2412, 2390, 2376,
+    2362, 2338, 2326, 2318, 2318, 2322, 2312, 2316, 2314, 2316, 2316, 2304, 2274, 2240, 2194, 2140,
+    2082, 2008, 1944, 1898, 1866, 1856, 1850, 1842, 1832, 1824, 1812, 1806, 1804, 1802, 1794, 1786,
+    1780, 1774, 1776, 1780, 1782, 1766, 1762, 1758, 1764, 1762, 1760, 1748, 1738, 1734, 1734, 1740,
+    1734, 1728, 1722, 1728, 1724, 1726, 1724, 1720, 1704, 1704, 1718, 1724, 1714, 1702, 1690, 1690,
+    1688, 1698, 1700, 1690, 1682, 1678, 1676, 1678, 1682, 1682, 1682, 1686, 1700, 1712, 1716, 1712,
+    1704, 1712, 1734, 1744, 1758, 1762, 1774, 1786, 1792, 1814, 1824, 1834, 1844, 1852, 1862, 1870,
+    1884, 1892, 1894, 1902, 1910, 1924, 1928, 1920, 1922, 1924, 1936, 1936, 1934, 1930, 1936, 1930,
+    1934, 1932, 1934, 1930, 1918, 1914, 1918, 1918, 1922, 1908, 1906, 1906, 1916, 1916, 1914, 1906,
+    1908, 1912, 1912, 1916, 1912, 1898, 1896, 1900, 1916, 1922, 1922, 1916, 1904, 1904, 1910, 1918,
+    1920, 1918, 1916, 1908, 1904, 1904, 1906, 1898, 1898, 1898, 1906, 1916, 1912, 1908, 1910, 1914,
+    1918, 1936, 1936, 1932, 1922, 1922, 1926, 1936, 1926, 1924, 1920, 1920, 1920, 1926, 1930, 1928,
+    1926, 1926, 1926, 1934, 1938, 1932, 1922, 1924, 1924, 1930, 1928, 1922, 1926, 1934, 1940, 1944,
+    1942, 1942, 1944, 1950, 1962, 1970, 1978, 1978, 1980, 1980, 1986, 1992, 1994, 1990, 1988, 1994,
+    1992, 2000, 1992, 1986, 1984, 1976, 1962, 1954, 1946, 1942, 1932, 1930, 1926, 1930, 1928, 1924,
+    1922, 1916, 1920, 1926, 1928, 1924, 1916, 1914, 1912, 1922, 1916, 1916, 1914, 1914, 1914, 1928,
+    1932, 1932, 1930, 1926, 1928, 1936, 1950, 1988, 2044, 2124, 2220, 2330, 2430, 2514, 2578, 2586,
+    2504, 2346, 2180, 2040, 1944, 1912, 1920, 1928, 1928, 1922, 1928, 1938, 1948, 1952, 1950, 1940,
+    1932, 1934, 1938, 1940, 1942, 1938, 1934, 1938, 1940, 1940, 1942, 1936, 1930, 1932, 1946, 1942,
+    1944, 1932, 1930, 1944, 1948, 1964, 1950, 1946, 1942, 1942, 1944, 1948, 1954, 1950, 1948, 1952,
+    1960, 1968, 1964, 1962, 1960, 1960, 1968, 1974, 1974, 1978, 1976, 1982, 1992, 1998, 2002, 2002,
+    2004, 2010, 2016, 2026, 2032, 2032, 2038, 2042, 2046, 2058, 2060, 2058, 2046, 2056, 2066, 2080,
+    2080, 2082, 2070, 2074, 2082, 2090, 2090, 2074, 2060, 2054, 2054, 2054, 2046, 2032, 2018, 2010,
+    2006, 2008, 2004, 1996, 1982, 1968, 1956, 1942, 1930, 1906, 1878, 1866, 1868, 1870, 1864, 1848,
+    1838, 1840, 1848, 1856, 1862, 1854, 1848, 1860, 1860, 1868, 1872, 1872, 1872, 1886, 1890, 1894,
+};
+
+static const int32_t mitdb208_ann[99] = {
+    199, 407, 606, 804, 1006, 1206, 1385, 1629, 1850, 2058, 2338, 2572,
+    2798, 2980, 3238, 3439, 3648, 3863, 4075, 4331, 4553, 4756, 4973, 5187,
+    5405, 5605, 5800, 6009, 6194, 6494, 6701, 6984, 7208, 7409, 7638, 7851,
+    8063, 8278, 8486, 8699, 8910, 9124, 9340, 9532, 9817, 10011, 10221, 10434,
+    10656, 10874, 11099, 11302, 11526, 11743, 11941, 12194, 12403, 12606, 12856, 13093,
+    13297, 13569, 13786, 13989, 14157, 14396, 14593, 14808, 15041, 15257, 15505, 15711,
+    15922, 16131, 16332, 16522, 16713, 16923, 17130, 17326, 17549, 17766, 17961, 18243,
+    18463, 18621, 18903, 19108, 19341, 19550, 19752, 19942, 20166, 20382, 20564, 20819,
+    21023, 21207, 21471,
+};
+
+const test_ecg_record_t test_ecg_records[TEST_ECG_RECORDS] = {
+    {"nsr", 250, nsr_data, 7500, nsr_ann, 36, 1},
+    {"rate_change", 250, rate_change_data, 7500, rate_change_ann, 45, 1},
+    {"ectopic_noise", 250, ectopic_noise_data, 7500, ectopic_noise_ann, 33, 1},
+    {"mitdb208", 360, mitdb208_data, 21600, mitdb208_ann, 99, 0},
+};